@@ -93,6 +93,40 @@ AC_DEFUN([AX_LIBODRAW_CHECK_LOCAL],
 
   dnl Check for internationalization functions in libodraw/libodraw_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Headers included in libodraw/libodraw_data_file_descriptor.c and libodraw/libodraw_layout_cache.c
+  AC_CHECK_HEADERS([errno.h fcntl.h sys/stat.h])
+
+  dnl Functions used in libodraw/libodraw_data_file_descriptor.c and libodraw/libodraw_layout_cache.c
+  AC_CHECK_FUNCS([stat statx])
+
+  dnl Functions used in libodraw/libodraw_data_file_writer.c
+  AC_CHECK_FUNCS([ftruncate posix_fallocate posix_memalign pwrite])
+
+  dnl Functions used in libodraw/libodraw_direct_file_io_handle.c
+  AC_CHECK_FUNCS([posix_fadvise pread])
+
+  dnl Headers included in libodraw/libodraw_statistics.c
+  AC_CHECK_HEADERS([time.h])
+
+  dnl Functions used in libodraw/libodraw_statistics.c
+  AC_CHECK_FUNCS([clock_gettime])
+
+  dnl Check if the hand-written CUE reader should be used instead of the flex and bison based CUE parser
+  AX_COMMON_ARG_ENABLE(
+    [cue-reader],
+    [cue_reader],
+    [use the hand-written CUE reader to parse CUE files],
+    [no])
+
+  AS_IF(
+    [test "x$ac_cv_enable_cue_reader" != xno],
+    [AC_DEFINE(
+      [HAVE_LIBODRAW_CUE_READER],
+      [1],
+      [Define to 1 if the hand-written CUE reader should be used.])
+
+    ac_cv_enable_cue_reader=yes])
 ])
 
 dnl Function to detect if odrawtools dependencies are available
@@ -139,6 +173,27 @@ AC_DEFUN([AX_ODRAWTOOLS_CHECK_LOCAL],
       [Missing function: time],
       [1])
   ])
+
+  dnl Functions included in odrawtools/storage_media_buffer.c
+  AC_CHECK_FUNCS([posix_memalign])
+
+  dnl Headers included in odrawtools/catalogue_handle.c
+  AC_CHECK_HEADERS([dirent.h errno.h sys/stat.h])
+
+  dnl Functions included in odrawtools/catalogue_handle.c
+  AC_CHECK_FUNCS([opendir stat])
+
+  dnl Headers included in odrawtools/device_scheduler.c
+  AC_CHECK_HEADERS([sys/stat.h sys/sysmacros.h])
+
+  dnl Functions included in odrawtools/rate_limiter.c
+  AC_CHECK_FUNCS([clock_gettime gettimeofday nanosleep])
+
+  dnl Headers included in odrawtools/scrub_handle.c
+  AC_CHECK_HEADERS([sys/syscall.h])
+
+  dnl Headers included in odrawtools/process_status.c
+  AC_CHECK_HEADERS([sys/socket.h sys/un.h])
 ])
 
 dnl Function to check if DLL support is needed
@@ -0,0 +1,169 @@
+/*
+ * MAME Compressed Hunks of Data (CHD) file format definitions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CHD_FILE_H )
+#define _CHD_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct chd_file_header_v5 chd_file_header_v5_t;
+
+struct chd_file_header_v5
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * "MComprHD"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The header size
+	 * Consists of 4 bytes
+	 */
+	uint8_t header_size[ 4 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The compression methods
+	 * Consists of 4 x 4 bytes
+	 * Contains a four character code per method or 0 if not used
+	 */
+	uint8_t compression_methods[ 16 ];
+
+	/* The logical size
+	 * Consists of 8 bytes
+	 */
+	uint8_t logical_size[ 8 ];
+
+	/* The hunk map offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t map_offset[ 8 ];
+
+	/* The first metadata entry offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t metadata_offset[ 8 ];
+
+	/* The hunk size
+	 * Consists of 4 bytes
+	 */
+	uint8_t hunk_size[ 4 ];
+
+	/* The unit size
+	 * Consists of 4 bytes
+	 */
+	uint8_t unit_size[ 4 ];
+
+	/* The SHA1 of the raw data
+	 * Consists of 20 bytes
+	 */
+	uint8_t raw_sha1[ 20 ];
+
+	/* The SHA1 of the raw data and metadata
+	 * Consists of 20 bytes
+	 */
+	uint8_t sha1[ 20 ];
+
+	/* The SHA1 of the parent
+	 * Consists of 20 bytes
+	 */
+	uint8_t parent_sha1[ 20 ];
+};
+
+typedef struct chd_compressed_map_header chd_compressed_map_header_t;
+
+struct chd_compressed_map_header
+{
+	/* The compressed map size
+	 * Consists of 4 bytes
+	 */
+	uint8_t map_size[ 4 ];
+
+	/* The offset of the first hunk
+	 * Consists of 6 bytes
+	 */
+	uint8_t first_hunk_offset[ 6 ];
+
+	/* The CRC-16 of the uncompressed map
+	 * Consists of 2 bytes
+	 */
+	uint8_t checksum[ 2 ];
+
+	/* The number of bits of a compressed hunk size
+	 * Consists of 1 byte
+	 */
+	uint8_t hunk_size_bits;
+
+	/* The number of bits of a self hunk reference
+	 * Consists of 1 byte
+	 */
+	uint8_t self_reference_bits;
+
+	/* The number of bits of a parent unit reference
+	 * Consists of 1 byte
+	 */
+	uint8_t parent_reference_bits;
+
+	/* Reserved
+	 * Consists of 1 byte
+	 */
+	uint8_t reserved;
+};
+
+typedef struct chd_metadata_entry_header chd_metadata_entry_header_t;
+
+struct chd_metadata_entry_header
+{
+	/* The tag
+	 * Consists of 4 bytes
+	 */
+	uint8_t tag[ 4 ];
+
+	/* The flags
+	 * Consists of 1 byte
+	 */
+	uint8_t flags;
+
+	/* The data size
+	 * Consists of 3 bytes
+	 */
+	uint8_t data_size[ 3 ];
+
+	/* The next metadata entry offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t next_offset[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CHD_FILE_H ) */
+
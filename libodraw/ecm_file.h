@@ -0,0 +1,103 @@
+/*
+ * Error Code Modeler (ECM) file format definitions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ECM_FILE_H )
+#define _ECM_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The file header is followed by records, each consisting of a variable-size
+ * record header and the (encoded) record data, and a 4-byte EDC of the decoded data
+ */
+typedef struct ecm_file_header ecm_file_header_t;
+
+struct ecm_file_header
+{
+	/* The signature
+	 * Consists of 4 bytes
+	 * "ECM\x00"
+	 */
+	uint8_t signature[ 4 ];
+};
+
+/* A MODE1 sector without synchronisation, mode, EDC, padding and ECC
+ */
+typedef struct ecm_mode1_sector ecm_mode1_sector_t;
+
+struct ecm_mode1_sector
+{
+	/* The address
+	 * Consists of 3 bytes
+	 * Contains the MSF of the sector header
+	 */
+	uint8_t address[ 3 ];
+
+	/* The data
+	 * Consists of 2048 bytes
+	 */
+	uint8_t data[ 2048 ];
+};
+
+/* A MODE2 form 1 sector without synchronisation, header, duplicate sub-header, EDC and ECC
+ */
+typedef struct ecm_mode2_form1_sector ecm_mode2_form1_sector_t;
+
+struct ecm_mode2_form1_sector
+{
+	/* The XA sub-header
+	 * Consists of 4 bytes
+	 */
+	uint8_t sub_header[ 4 ];
+
+	/* The data
+	 * Consists of 2048 bytes
+	 */
+	uint8_t data[ 2048 ];
+};
+
+/* A MODE2 form 2 sector without synchronisation, header, duplicate sub-header and EDC
+ */
+typedef struct ecm_mode2_form2_sector ecm_mode2_form2_sector_t;
+
+struct ecm_mode2_form2_sector
+{
+	/* The XA sub-header
+	 * Consists of 4 bytes
+	 */
+	uint8_t sub_header[ 4 ];
+
+	/* The data
+	 * Consists of 2324 bytes
+	 */
+	uint8_t data[ 2324 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ECM_FILE_H ) */
+
@@ -0,0 +1,881 @@
+/*
+ * Block cache functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_block_cache.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_libcnotify.h"
+#include "libodraw_libcthreads.h"
+
+/* Creates a block cache
+ * Make sure the value block_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_block_cache_initialize(
+     libodraw_block_cache_t **block_cache,
+     uint32_t number_of_blocks,
+     size_t block_size,
+     intptr_t *data_handle,
+     int (*read_block)(
+            intptr_t *data_handle,
+            uint32_t block_index,
+            uint8_t *block_data,
+            size_t block_data_size,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_block_cache_initialize";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read block function.",
+		 function );
+
+		return( -1 );
+	}
+	*block_cache = memory_allocate_structure(
+	                libodraw_block_cache_t );
+
+	if( *block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *block_cache,
+	     0,
+	     sizeof( libodraw_block_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block cache.",
+		 function );
+
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *block_cache )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *block_cache )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *block_cache )->number_of_blocks = number_of_blocks;
+	( *block_cache )->block_size       = block_size;
+	( *block_cache )->data_handle      = data_handle;
+	( *block_cache )->read_block       = read_block;
+	( *block_cache )->last_block_index = (uint32_t) -1;
+
+	return( 1 );
+
+on_error:
+	if( *block_cache != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *block_cache )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *block_cache )->mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a block cache
+ * Blocks that are being decompressed ahead are waited for
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_block_cache_free(
+     libodraw_block_cache_t **block_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_block_cache_free";
+	int cache_entry_index = 0;
+	int result            = 1;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *block_cache )->read_ahead_thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *block_cache )->read_ahead_thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join read-ahead thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		for( cache_entry_index = 0;
+		     cache_entry_index < LIBODRAW_BLOCK_CACHE_NUMBER_OF_ENTRIES;
+		     cache_entry_index++ )
+		{
+			if( ( *block_cache )->entries[ cache_entry_index ].data != NULL )
+			{
+				memory_free(
+				 ( *block_cache )->entries[ cache_entry_index ].data );
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_free(
+		     &( ( *block_cache )->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *block_cache )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the cache entry of a specific block
+ * The block cache mutex must be held by the caller
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libodraw_block_cache_get_entry(
+     libodraw_block_cache_t *block_cache,
+     uint32_t block_index,
+     libodraw_block_cache_entry_t **cache_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_block_cache_get_entry";
+	int cache_entry_index = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	for( cache_entry_index = 0;
+	     cache_entry_index < LIBODRAW_BLOCK_CACHE_NUMBER_OF_ENTRIES;
+	     cache_entry_index++ )
+	{
+		if( ( block_cache->entries[ cache_entry_index ].state != LIBODRAW_BLOCK_CACHE_ENTRY_STATE_EMPTY )
+		 && ( block_cache->entries[ cache_entry_index ].block_index == block_index ) )
+		{
+			*cache_entry = &( block_cache->entries[ cache_entry_index ] );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves a cache entry that can be (re)used
+ * An empty cache entry is preferred, otherwise the least recently used entry
+ * that is not pending or excluded is returned
+ * The block cache mutex must be held by the caller
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libodraw_block_cache_get_free_entry(
+     libodraw_block_cache_t *block_cache,
+     libodraw_block_cache_entry_t *excluded_cache_entry,
+     libodraw_block_cache_entry_t **cache_entry,
+     libcerror_error_t **error )
+{
+	libodraw_block_cache_entry_t *free_cache_entry = NULL;
+	libodraw_block_cache_entry_t *safe_cache_entry = NULL;
+	static char *function                          = "libodraw_block_cache_get_free_entry";
+	int cache_entry_index                          = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	for( cache_entry_index = 0;
+	     cache_entry_index < LIBODRAW_BLOCK_CACHE_NUMBER_OF_ENTRIES;
+	     cache_entry_index++ )
+	{
+		safe_cache_entry = &( block_cache->entries[ cache_entry_index ] );
+
+		if( safe_cache_entry == excluded_cache_entry )
+		{
+			continue;
+		}
+		if( safe_cache_entry->state == LIBODRAW_BLOCK_CACHE_ENTRY_STATE_EMPTY )
+		{
+			free_cache_entry = safe_cache_entry;
+
+			break;
+		}
+		if( safe_cache_entry->state != LIBODRAW_BLOCK_CACHE_ENTRY_STATE_VALID )
+		{
+			continue;
+		}
+		if( ( free_cache_entry == NULL )
+		 || ( safe_cache_entry->access_count < free_cache_entry->access_count ) )
+		{
+			free_cache_entry = safe_cache_entry;
+		}
+	}
+	if( free_cache_entry == NULL )
+	{
+		return( 0 );
+	}
+	if( free_cache_entry->data == NULL )
+	{
+		free_cache_entry->data = (uint8_t *) memory_allocate(
+		                                      sizeof( uint8_t ) * block_cache->block_size );
+
+		if( free_cache_entry->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create cache entry data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	free_cache_entry->state = LIBODRAW_BLOCK_CACHE_ENTRY_STATE_EMPTY;
+
+	*cache_entry = free_cache_entry;
+
+	return( 1 );
+}
+
+/* Retrieves the decompressed data of a specific block
+ * The data remains valid until the next call to this function
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_block_cache_get_block_data(
+     libodraw_block_cache_t *block_cache,
+     uint32_t block_index,
+     const uint8_t **block_data,
+     libcerror_error_t **error )
+{
+	libodraw_block_cache_entry_t *cache_entry = NULL;
+	static char *function                     = "libodraw_block_cache_get_block_data";
+	int result                                = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_index >= block_cache->number_of_blocks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	do
+	{
+		result = libodraw_block_cache_get_entry(
+		          block_cache,
+		          block_index,
+		          &cache_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache entry of block: %" PRIu32 ".",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			result = libodraw_block_cache_get_free_entry(
+			          block_cache,
+			          NULL,
+			          &cache_entry,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve free cache entry.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				cache_entry->block_index = block_index;
+				cache_entry->state       = LIBODRAW_BLOCK_CACHE_ENTRY_STATE_PENDING;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+				if( libcthreads_mutex_release(
+				     block_cache->mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to release mutex.",
+					 function );
+
+					cache_entry->state = LIBODRAW_BLOCK_CACHE_ENTRY_STATE_EMPTY;
+
+					return( -1 );
+				}
+#endif
+				result = block_cache->read_block(
+				          block_cache->data_handle,
+				          block_index,
+				          cache_entry->data,
+				          block_cache->block_size,
+				          error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+				if( libcthreads_mutex_grab(
+				     block_cache->mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to grab mutex.",
+					 function );
+
+					cache_entry->state = LIBODRAW_BLOCK_CACHE_ENTRY_STATE_EMPTY;
+
+					return( -1 );
+				}
+#endif
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read block: %" PRIu32 ".",
+					 function,
+					 block_index );
+
+					cache_entry->state = LIBODRAW_BLOCK_CACHE_ENTRY_STATE_EMPTY;
+
+					goto on_error;
+				}
+				cache_entry->state = LIBODRAW_BLOCK_CACHE_ENTRY_STATE_VALID;
+			}
+		}
+		if( ( result == 0 )
+		 || ( cache_entry->state == LIBODRAW_BLOCK_CACHE_ENTRY_STATE_PENDING ) )
+		{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			/* Wait for a read-ahead thread to finish decompressing
+			 */
+			if( libcthreads_condition_wait(
+			     block_cache->condition,
+			     block_cache->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				goto on_error;
+			}
+			result = 0;
+#else
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing free cache entry.",
+			 function );
+
+			goto on_error;
+#endif
+		}
+	}
+	while( result == 0 );
+
+	block_cache->access_count += 1;
+
+	cache_entry->access_count = block_cache->access_count;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Decompress the next blocks ahead when the blocks are read sequentially
+	 */
+	if( ( block_index == ( block_cache->last_block_index + 1 ) )
+	 && ( ( block_index + 1 ) < block_cache->number_of_blocks ) )
+	{
+		if( libodraw_block_cache_read_ahead(
+		     block_cache,
+		     block_index + 1,
+		     cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to read ahead from block: %" PRIu32 ".",
+			 function,
+			 block_index + 1 );
+
+			goto on_error;
+		}
+	}
+#endif
+	block_cache->last_block_index = block_index;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*block_data = cache_entry->data;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 block_cache->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Queues the blocks following a specific block to be decompressed by the read-ahead threads
+ * The block cache mutex must be held by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_block_cache_read_ahead(
+     libodraw_block_cache_t *block_cache,
+     uint32_t block_index,
+     libodraw_block_cache_entry_t *current_cache_entry,
+     libcerror_error_t **error )
+{
+	libodraw_block_cache_entry_t *cache_entry = NULL;
+	static char *function                     = "libodraw_block_cache_read_ahead";
+	uint32_t read_ahead_block_index           = 0;
+	int result                                = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_cache->read_ahead_thread_pool == NULL )
+	{
+		/* The queue can hold every cache entry so pushing never blocks
+		 */
+		if( libcthreads_thread_pool_create(
+		     &( block_cache->read_ahead_thread_pool ),
+		     NULL,
+		     LIBODRAW_BLOCK_CACHE_NUMBER_OF_READ_AHEAD_THREADS,
+		     LIBODRAW_BLOCK_CACHE_NUMBER_OF_ENTRIES,
+		     (int (*)(intptr_t *, void *)) &libodraw_block_cache_read_ahead_callback,
+		     (void *) block_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read-ahead thread pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( read_ahead_block_index = block_index;
+	     read_ahead_block_index < block_cache->number_of_blocks;
+	     read_ahead_block_index++ )
+	{
+		if( ( read_ahead_block_index - block_index ) >= LIBODRAW_BLOCK_CACHE_NUMBER_OF_READ_AHEAD_BLOCKS )
+		{
+			break;
+		}
+		result = libodraw_block_cache_get_entry(
+		          block_cache,
+		          read_ahead_block_index,
+		          &cache_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache entry of block: %" PRIu32 ".",
+			 function,
+			 read_ahead_block_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			continue;
+		}
+		result = libodraw_block_cache_get_free_entry(
+		          block_cache,
+		          current_cache_entry,
+		          &cache_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve free cache entry.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		block_cache->access_count += 1;
+
+		cache_entry->block_index  = read_ahead_block_index;
+		cache_entry->state        = LIBODRAW_BLOCK_CACHE_ENTRY_STATE_PENDING;
+		cache_entry->access_count = block_cache->access_count;
+
+		if( libcthreads_thread_pool_push(
+		     block_cache->read_ahead_thread_pool,
+		     (intptr_t *) cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push cache entry of block: %" PRIu32 " onto read-ahead queue.",
+			 function,
+			 read_ahead_block_index );
+
+			cache_entry->state = LIBODRAW_BLOCK_CACHE_ENTRY_STATE_EMPTY;
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Decompresses a block on a read-ahead thread
+ * A block that fails to decompress is marked empty, so that it is read again
+ * by the reading thread, which reports the error
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_block_cache_read_ahead_callback(
+     libodraw_block_cache_entry_t *cache_entry,
+     libodraw_block_cache_t *block_cache )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libodraw_block_cache_read_ahead_callback";
+	int result               = 0;
+
+	if( cache_entry == NULL )
+	{
+		return( -1 );
+	}
+	if( block_cache == NULL )
+	{
+		return( -1 );
+	}
+	result = block_cache->read_block(
+	          block_cache->data_handle,
+	          cache_entry->block_index,
+	          cache_entry->data,
+	          block_cache->block_size,
+	          &error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block: %" PRIu32 ".",
+		 function,
+		 cache_entry->block_index );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	if( libcthreads_mutex_grab(
+	     block_cache->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( result == 1 )
+	{
+		cache_entry->state = LIBODRAW_BLOCK_CACHE_ENTRY_STATE_VALID;
+	}
+	else
+	{
+		cache_entry->state = LIBODRAW_BLOCK_CACHE_ENTRY_STATE_EMPTY;
+	}
+	result = libcthreads_condition_broadcast(
+	          block_cache->condition,
+	          NULL );
+
+	if( libcthreads_mutex_release(
+	     block_cache->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
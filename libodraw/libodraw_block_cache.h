@@ -0,0 +1,187 @@
+/*
+ * Block cache functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_BLOCK_CACHE_H )
+#define _LIBODRAW_BLOCK_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+#include "libodraw_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of decompressed blocks kept in the block cache
+ */
+#define LIBODRAW_BLOCK_CACHE_NUMBER_OF_ENTRIES			16
+
+/* The number of blocks decompressed ahead during sequential reads
+ */
+#define LIBODRAW_BLOCK_CACHE_NUMBER_OF_READ_AHEAD_BLOCKS	4
+
+/* The number of threads used to decompress ahead
+ */
+#define LIBODRAW_BLOCK_CACHE_NUMBER_OF_READ_AHEAD_THREADS	4
+
+/* The block cache entry states
+ */
+enum LIBODRAW_BLOCK_CACHE_ENTRY_STATES
+{
+	LIBODRAW_BLOCK_CACHE_ENTRY_STATE_EMPTY,
+	LIBODRAW_BLOCK_CACHE_ENTRY_STATE_PENDING,
+	LIBODRAW_BLOCK_CACHE_ENTRY_STATE_VALID
+};
+
+typedef struct libodraw_block_cache_entry libodraw_block_cache_entry_t;
+
+struct libodraw_block_cache_entry
+{
+	/* The block index
+	 */
+	uint32_t block_index;
+
+	/* The state
+	 */
+	uint8_t state;
+
+	/* The last access count
+	 */
+	uint64_t access_count;
+
+	/* The decompressed block data
+	 */
+	uint8_t *data;
+};
+
+typedef struct libodraw_block_cache libodraw_block_cache_t;
+
+/* The block cache keeps the most recently used blocks of a compressed data file
+ * and decompresses the blocks following a sequential read on a thread pool
+ */
+struct libodraw_block_cache
+{
+	/* The number of blocks
+	 */
+	uint32_t number_of_blocks;
+
+	/* The (maximum) block size
+	 */
+	size_t block_size;
+
+	/* The data handle passed to the read block function
+	 */
+	intptr_t *data_handle;
+
+	/* The read block function, which is called by the read-ahead threads
+	 * as well and therefore must be thread-safe
+	 */
+	int (*read_block)(
+	       intptr_t *data_handle,
+	       uint32_t block_index,
+	       uint8_t *block_data,
+	       size_t block_data_size,
+	       libcerror_error_t **error );
+
+	/* The cache entries
+	 */
+	libodraw_block_cache_entry_t entries[ LIBODRAW_BLOCK_CACHE_NUMBER_OF_ENTRIES ];
+
+	/* The access count
+	 */
+	uint64_t access_count;
+
+	/* The index of the last block that was retrieved
+	 */
+	uint32_t last_block_index;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the cache entries
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that signals a pending block has been decompressed
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The thread pool that decompresses blocks ahead
+	 */
+	libcthreads_thread_pool_t *read_ahead_thread_pool;
+#endif
+};
+
+int libodraw_block_cache_initialize(
+     libodraw_block_cache_t **block_cache,
+     uint32_t number_of_blocks,
+     size_t block_size,
+     intptr_t *data_handle,
+     int (*read_block)(
+            intptr_t *data_handle,
+            uint32_t block_index,
+            uint8_t *block_data,
+            size_t block_data_size,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libodraw_block_cache_free(
+     libodraw_block_cache_t **block_cache,
+     libcerror_error_t **error );
+
+int libodraw_block_cache_get_entry(
+     libodraw_block_cache_t *block_cache,
+     uint32_t block_index,
+     libodraw_block_cache_entry_t **cache_entry,
+     libcerror_error_t **error );
+
+int libodraw_block_cache_get_free_entry(
+     libodraw_block_cache_t *block_cache,
+     libodraw_block_cache_entry_t *excluded_cache_entry,
+     libodraw_block_cache_entry_t **cache_entry,
+     libcerror_error_t **error );
+
+int libodraw_block_cache_get_block_data(
+     libodraw_block_cache_t *block_cache,
+     uint32_t block_index,
+     const uint8_t **block_data,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libodraw_block_cache_read_ahead(
+     libodraw_block_cache_t *block_cache,
+     uint32_t block_index,
+     libodraw_block_cache_entry_t *current_cache_entry,
+     libcerror_error_t **error );
+
+int libodraw_block_cache_read_ahead_callback(
+     libodraw_block_cache_entry_t *cache_entry,
+     libodraw_block_cache_t *block_cache );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_BLOCK_CACHE_H ) */
+
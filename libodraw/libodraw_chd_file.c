@@ -0,0 +1,2866 @@
+/*
+ * MAME Compressed Hunks of Data (CHD) file functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libodraw_bit_stream.h"
+#include "libodraw_block_cache.h"
+#include "libodraw_checksum.h"
+#include "libodraw_chd_file.h"
+#include "libodraw_compression.h"
+#include "libodraw_definitions.h"
+#include "libodraw_flac.h"
+#include "libodraw_huffman_tree.h"
+#include "libodraw_libbfio.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_libcnotify.h"
+#include "libodraw_libcthreads.h"
+
+#include "chd_file.h"
+
+const uint8_t chd_file_signature[ 8 ] = { 'M', 'C', 'o', 'm', 'p', 'r', 'H', 'D' };
+
+const uint8_t chd_file_cd_sync_header[ 12 ] = {
+	0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00 };
+
+/* The compression methods as four character codes
+ */
+#define CHD_COMPRESSION_METHOD_NONE			0x00000000UL
+#define CHD_COMPRESSION_METHOD_ZLIB			0x7a6c6962UL
+#define CHD_COMPRESSION_METHOD_LZMA			0x6c7a6d61UL
+#define CHD_COMPRESSION_METHOD_CD_ZLIB			0x63647a6cUL
+#define CHD_COMPRESSION_METHOD_CD_LZMA			0x63646c7aUL
+#define CHD_COMPRESSION_METHOD_FLAC			0x666c6163UL
+#define CHD_COMPRESSION_METHOD_CD_FLAC			0x6364666cUL
+
+/* The metadata tags
+ */
+#define CHD_METADATA_TAG_CD_TRACK			0x43485452UL
+#define CHD_METADATA_TAG_CD_TRACK2			0x43485432UL
+#define CHD_METADATA_TAG_GD_ROM_TRACK			0x43484744UL
+
+/* Creates a CHD file
+ * Make sure the value chd_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_chd_file_initialize(
+     libodraw_chd_file_t **chd_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_chd_file_initialize";
+
+	if( chd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CHD file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chd_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid CHD file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*chd_file = memory_allocate_structure(
+	             libodraw_chd_file_t );
+
+	if( *chd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create CHD file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chd_file,
+	     0,
+	     sizeof( libodraw_chd_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear CHD file.",
+		 function );
+
+		memory_free(
+		 *chd_file );
+
+		*chd_file = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *chd_file )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *chd_file != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *chd_file )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *chd_file )->mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *chd_file );
+
+		*chd_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a CHD file
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_chd_file_free(
+     libodraw_chd_file_t **chd_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_chd_file_free";
+	int result            = 1;
+
+	if( chd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CHD file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chd_file != NULL )
+	{
+		if( ( *chd_file )->block_cache != NULL )
+		{
+			if( libodraw_block_cache_free(
+			     &( ( *chd_file )->block_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free block cache.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *chd_file )->hunk_descriptors != NULL )
+		{
+			memory_free(
+			 ( *chd_file )->hunk_descriptors );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *chd_file )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *chd_file );
+
+		*chd_file = NULL;
+	}
+	return( result );
+}
+
+/* Opens a CHD file for reading
+ * The file IO handle must be open and remain open while the CHD file is used
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_chd_file_open_read(
+     libodraw_chd_file_t *chd_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libodraw_chd_track_t *track = NULL;
+	static char *function       = "libodraw_chd_file_open_read";
+	uint64_t number_of_frames   = 0;
+	int track_index             = 0;
+
+	if( chd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CHD file.",
+		 function );
+
+		return( -1 );
+	}
+	if( chd_file->hunk_descriptors != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid CHD file - hunk descriptors value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_chd_file_read_file_header(
+	     chd_file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_chd_file_read_hunk_map(
+	     chd_file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read hunk map.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_chd_file_read_metadata(
+	     chd_file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata.",
+		 function );
+
+		return( -1 );
+	}
+	chd_file->data_size = chd_file->logical_size;
+
+	if( chd_file->number_of_tracks > 0 )
+	{
+		if( chd_file->unit_size != LIBODRAW_CHD_FILE_CD_FRAME_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported unit size: %" PRIu32 " for CD tracks.",
+			 function,
+			 chd_file->unit_size );
+
+			return( -1 );
+		}
+		/* The frames of every track are padded to a multiple of 4 frames
+		 * the padding frames are not part of the exposed data
+		 */
+		chd_file->data_size = 0;
+
+		for( track_index = 0;
+		     track_index < chd_file->number_of_tracks;
+		     track_index++ )
+		{
+			track = &( chd_file->tracks[ track_index ] );
+
+			track->data_offset = (uint64_t) chd_file->data_size;
+			track->start_frame = number_of_frames;
+
+			chd_file->data_size += (size64_t) track->number_of_frames * track->bytes_per_frame;
+			number_of_frames    += ( (uint64_t) track->number_of_frames + 3 ) & ~( (uint64_t) 3 );
+		}
+		if( ( number_of_frames * LIBODRAW_CHD_FILE_CD_FRAME_SIZE ) > chd_file->logical_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of track frames value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libodraw_block_cache_initialize(
+	     &( chd_file->block_cache ),
+	     chd_file->number_of_hunks,
+	     (size_t) chd_file->hunk_size,
+	     (intptr_t *) chd_file,
+	     (int (*)(intptr_t *, uint32_t, uint8_t *, size_t, libcerror_error_t **)) &libodraw_chd_file_read_hunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block cache.",
+		 function );
+
+		return( -1 );
+	}
+	chd_file->file_io_handle = file_io_handle;
+
+	return( 1 );
+}
+
+/* Reads the file header
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_chd_file_read_file_header(
+     libodraw_chd_file_t *chd_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	chd_file_header_v5_t file_header;
+
+	static char *function        = "libodraw_chd_file_read_file_header";
+	uint64_t number_of_hunks     = 0;
+	uint64_t value_64bit         = 0;
+	uint32_t header_size         = 0;
+	ssize_t read_count           = 0;
+	int compression_method_index = 0;
+	int parent_sha1_index        = 0;
+
+	if( chd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CHD file.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &file_header,
+	              sizeof( chd_file_header_v5_t ),
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( chd_file_header_v5_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header data at offset: 0 (0x00000000).",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: file header data:\n",
+		 function );
+		libcnotify_print_data(
+		 (uint8_t *) &file_header,
+		 sizeof( chd_file_header_v5_t ),
+		 0 );
+	}
+#endif
+	if( memory_compare(
+	     file_header.signature,
+	     chd_file_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_big_endian(
+	 file_header.header_size,
+	 header_size );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 file_header.format_version,
+	 chd_file->format_version );
+
+	if( chd_file->format_version != 5 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 chd_file->format_version );
+
+		return( -1 );
+	}
+	if( header_size != (uint32_t) sizeof( chd_file_header_v5_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported header size: %" PRIu32 ".",
+		 function,
+		 header_size );
+
+		return( -1 );
+	}
+	for( compression_method_index = 0;
+	     compression_method_index < 4;
+	     compression_method_index++ )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( file_header.compression_methods[ compression_method_index * 4 ] ),
+		 chd_file->compression_methods[ compression_method_index ] );
+	}
+	byte_stream_copy_to_uint64_big_endian(
+	 file_header.logical_size,
+	 chd_file->logical_size );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 file_header.map_offset,
+	 value_64bit );
+
+	chd_file->map_offset = (off64_t) value_64bit;
+
+	byte_stream_copy_to_uint64_big_endian(
+	 file_header.metadata_offset,
+	 value_64bit );
+
+	chd_file->metadata_offset = (off64_t) value_64bit;
+
+	byte_stream_copy_to_uint32_big_endian(
+	 file_header.hunk_size,
+	 chd_file->hunk_size );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 file_header.unit_size,
+	 chd_file->unit_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format version\t\t\t: %" PRIu32 "\n",
+		 function,
+		 chd_file->format_version );
+
+		for( compression_method_index = 0;
+		     compression_method_index < 4;
+		     compression_method_index++ )
+		{
+			libcnotify_printf(
+			 "%s: compression method: %d\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 compression_method_index,
+			 chd_file->compression_methods[ compression_method_index ] );
+		}
+		libcnotify_printf(
+		 "%s: logical size\t\t\t: %" PRIu64 "\n",
+		 function,
+		 chd_file->logical_size );
+
+		libcnotify_printf(
+		 "%s: map offset\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 chd_file->map_offset );
+
+		libcnotify_printf(
+		 "%s: metadata offset\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 chd_file->metadata_offset );
+
+		libcnotify_printf(
+		 "%s: hunk size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 chd_file->hunk_size );
+
+		libcnotify_printf(
+		 "%s: unit size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 chd_file->unit_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	for( parent_sha1_index = 0;
+	     parent_sha1_index < 20;
+	     parent_sha1_index++ )
+	{
+		if( file_header.parent_sha1[ parent_sha1_index ] != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported CHD file with parent.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* A hunk is decompressed into a single buffer, so its size is limited
+	 */
+	if( ( chd_file->hunk_size == 0 )
+	 || ( chd_file->hunk_size > ( 16 * 1024 * 1024 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chd_file->unit_size == 0 )
+	 || ( ( chd_file->hunk_size % chd_file->unit_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid unit size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_hunks = chd_file->logical_size / chd_file->hunk_size;
+
+	if( ( chd_file->logical_size % chd_file->hunk_size ) != 0 )
+	{
+		number_of_hunks += 1;
+	}
+	if( ( number_of_hunks == 0 )
+	 || ( number_of_hunks > (uint64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libodraw_chd_hunk_descriptor_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of hunks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	chd_file->number_of_hunks = (uint32_t) number_of_hunks;
+
+	return( 1 );
+}
+
+/* Reads the hunk map
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_chd_file_read_hunk_map(
+     libodraw_chd_file_t *chd_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	chd_compressed_map_header_t map_header;
+	uint8_t map_entry_data[ 12 ];
+
+	libodraw_chd_hunk_descriptor_t *hunk_descriptor = NULL;
+	uint8_t *map_data                               = NULL;
+	static char *function                           = "libodraw_chd_file_read_hunk_map";
+	size_t map_data_offset                          = 0;
+	size_t map_data_size                            = 0;
+	ssize_t read_count                              = 0;
+	uint64_t first_hunk_offset                      = 0;
+	uint32_t hunk_index                             = 0;
+	uint32_t map_entry                              = 0;
+	uint16_t calculated_checksum                    = 0;
+	uint16_t stored_checksum                        = 0;
+
+	if( chd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CHD file.",
+		 function );
+
+		return( -1 );
+	}
+	if( chd_file->hunk_descriptors != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid CHD file - hunk descriptors value already set.",
+		 function );
+
+		return( -1 );
+	}
+	chd_file->hunk_descriptors = (libodraw_chd_hunk_descriptor_t *) memory_allocate(
+	                                                                 sizeof( libodraw_chd_hunk_descriptor_t ) * chd_file->number_of_hunks );
+
+	if( chd_file->hunk_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hunk descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     chd_file->hunk_descriptors,
+	     0,
+	     sizeof( libodraw_chd_hunk_descriptor_t ) * chd_file->number_of_hunks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hunk descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	if( chd_file->compression_methods[ 0 ] == CHD_COMPRESSION_METHOD_NONE )
+	{
+		/* An uncompressed file contains a 32-bit hunk number per hunk
+		 */
+		map_data_size = (size_t) chd_file->number_of_hunks * 4;
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              (uint8_t *) &map_header,
+		              sizeof( chd_compressed_map_header_t ),
+		              chd_file->map_offset,
+		              error );
+
+		if( read_count != (ssize_t) sizeof( chd_compressed_map_header_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed map header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 chd_file->map_offset,
+			 chd_file->map_offset );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_big_endian(
+		 map_header.map_size,
+		 map_data_size );
+
+		byte_stream_copy_to_uint48_big_endian(
+		 map_header.first_hunk_offset,
+		 first_hunk_offset );
+
+		byte_stream_copy_to_uint16_big_endian(
+		 map_header.checksum,
+		 stored_checksum );
+
+		map_data_offset = sizeof( chd_compressed_map_header_t );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: compressed map size\t\t: %" PRIzd "\n",
+			 function,
+			 map_data_size );
+
+			libcnotify_printf(
+			 "%s: first hunk offset\t\t: 0x%08" PRIx64 "\n",
+			 function,
+			 first_hunk_offset );
+
+			libcnotify_printf(
+			 "%s: checksum\t\t\t\t: 0x%04" PRIx16 "\n",
+			 function,
+			 stored_checksum );
+
+			libcnotify_printf(
+			 "%s: hunk size bits\t\t\t: %" PRIu8 "\n",
+			 function,
+			 map_header.hunk_size_bits );
+
+			libcnotify_printf(
+			 "%s: self reference bits\t\t: %" PRIu8 "\n",
+			 function,
+			 map_header.self_reference_bits );
+
+			libcnotify_printf(
+			 "%s: parent reference bits\t\t: %" PRIu8 "\n",
+			 function,
+			 map_header.parent_reference_bits );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		if( ( map_header.hunk_size_bits > 32 )
+		 || ( map_header.self_reference_bits > 32 )
+		 || ( map_header.parent_reference_bits > 64 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid compressed map header - number of bits value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( map_data_size == 0 )
+	 || ( map_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid map data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	map_data = (uint8_t *) memory_allocate(
+	                        sizeof( uint8_t ) * map_data_size );
+
+	if( map_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create map data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              map_data,
+	              map_data_size,
+	              chd_file->map_offset + (off64_t) map_data_offset,
+	              error );
+
+	if( read_count != (ssize_t) map_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read map data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 chd_file->map_offset + (off64_t) map_data_offset,
+		 chd_file->map_offset + (off64_t) map_data_offset );
+
+		goto on_error;
+	}
+	if( chd_file->compression_methods[ 0 ] == CHD_COMPRESSION_METHOD_NONE )
+	{
+		for( hunk_index = 0;
+		     hunk_index < chd_file->number_of_hunks;
+		     hunk_index++ )
+		{
+			hunk_descriptor = &( chd_file->hunk_descriptors[ hunk_index ] );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( map_data[ hunk_index * 4 ] ),
+			 map_entry );
+
+			if( map_entry == 0 )
+			{
+				hunk_descriptor->type = LIBODRAW_CHD_HUNK_TYPE_ZERO;
+			}
+			else
+			{
+				hunk_descriptor->type   = LIBODRAW_CHD_HUNK_TYPE_UNCOMPRESSED;
+				hunk_descriptor->offset = (uint64_t) map_entry * chd_file->hunk_size;
+				hunk_descriptor->size   = chd_file->hunk_size;
+			}
+		}
+	}
+	else
+	{
+		if( libodraw_chd_file_read_compressed_hunk_map(
+		     chd_file,
+		     map_data,
+		     map_data_size,
+		     (off64_t) first_hunk_offset,
+		     map_header.hunk_size_bits,
+		     map_header.self_reference_bits,
+		     map_header.parent_reference_bits,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read compressed hunk map.",
+			 function );
+
+			goto on_error;
+		}
+		/* The checksum is calculated over the decoded map stored as 12 bytes per hunk
+		 */
+		for( hunk_index = 0;
+		     hunk_index < chd_file->number_of_hunks;
+		     hunk_index++ )
+		{
+			hunk_descriptor = &( chd_file->hunk_descriptors[ hunk_index ] );
+
+			map_entry_data[ 0 ] = hunk_descriptor->type;
+
+			byte_stream_copy_from_uint24_big_endian(
+			 &( map_entry_data[ 1 ] ),
+			 hunk_descriptor->size );
+
+			byte_stream_copy_from_uint48_big_endian(
+			 &( map_entry_data[ 4 ] ),
+			 hunk_descriptor->offset );
+
+			byte_stream_copy_from_uint16_big_endian(
+			 &( map_entry_data[ 10 ] ),
+			 hunk_descriptor->checksum );
+
+			if( libodraw_checksum_calculate_crc16(
+			     &calculated_checksum,
+			     map_entry_data,
+			     12,
+			     ( hunk_index == 0 ) ? 0xffff : calculated_checksum,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to calculate map checksum.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( stored_checksum != calculated_checksum )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: mismatch in map checksum ( 0x%04" PRIx16 " != 0x%04" PRIx16 " ).",
+			 function,
+			 stored_checksum,
+			 calculated_checksum );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 map_data );
+
+	return( 1 );
+
+on_error:
+	if( map_data != NULL )
+	{
+		memory_free(
+		 map_data );
+	}
+	if( chd_file->hunk_descriptors != NULL )
+	{
+		memory_free(
+		 chd_file->hunk_descriptors );
+
+		chd_file->hunk_descriptors = NULL;
+	}
+	return( -1 );
+}
+
+/* Reads the compressed hunk map
+ * The hunk types are stored Huffman and run-length encoded followed by the per hunk values
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_chd_file_read_compressed_hunk_map(
+     libodraw_chd_file_t *chd_file,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t first_hunk_offset,
+     uint8_t hunk_size_bits,
+     uint8_t self_reference_bits,
+     uint8_t parent_reference_bits,
+     libcerror_error_t **error )
+{
+	libodraw_bit_stream_t *bit_stream               = NULL;
+	libodraw_chd_hunk_descriptor_t *hunk_descriptor = NULL;
+	libodraw_huffman_tree_t *huffman_tree           = NULL;
+	static char *function                           = "libodraw_chd_file_read_compressed_hunk_map";
+	uint64_t current_offset                         = 0;
+	uint64_t last_parent_reference                  = 0;
+	uint32_t hunk_index                             = 0;
+	uint32_t last_self_reference                    = 0;
+	uint32_t repeat_count                           = 0;
+	uint32_t value_32bit                            = 0;
+	uint16_t symbol                                 = 0;
+	uint8_t last_hunk_type                          = 0;
+	int result                                      = 0;
+
+	if( chd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CHD file.",
+		 function );
+
+		return( -1 );
+	}
+	if( chd_file->hunk_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid CHD file - missing hunk descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_hunk_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first hunk offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_bit_stream_initialize(
+	     &bit_stream,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_huffman_tree_initialize(
+	     &huffman_tree,
+	     16,
+	     8,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_huffman_tree_read_code_sizes(
+	     huffman_tree,
+	     bit_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read Huffman tree code sizes.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_huffman_tree_build(
+	     huffman_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	/* First pass: decode the hunk types
+	 */
+	for( hunk_index = 0;
+	     hunk_index < chd_file->number_of_hunks;
+	     hunk_index++ )
+	{
+		hunk_descriptor = &( chd_file->hunk_descriptors[ hunk_index ] );
+
+		if( repeat_count > 0 )
+		{
+			hunk_descriptor->type = last_hunk_type;
+
+			repeat_count--;
+
+			continue;
+		}
+		if( libodraw_huffman_tree_get_symbol_from_bit_stream(
+		     huffman_tree,
+		     bit_stream,
+		     &symbol,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hunk: %" PRIu32 " type symbol.",
+			 function,
+			 hunk_index );
+
+			goto on_error;
+		}
+		if( symbol == LIBODRAW_CHD_HUNK_TYPE_RLE_SMALL )
+		{
+			if( libodraw_huffman_tree_get_symbol_from_bit_stream(
+			     huffman_tree,
+			     bit_stream,
+			     &symbol,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve hunk: %" PRIu32 " repeat count symbol.",
+				 function,
+				 hunk_index );
+
+				goto on_error;
+			}
+			hunk_descriptor->type = last_hunk_type;
+			repeat_count          = 2 + (uint32_t) symbol;
+		}
+		else if( symbol == LIBODRAW_CHD_HUNK_TYPE_RLE_LARGE )
+		{
+			if( libodraw_huffman_tree_get_symbol_from_bit_stream(
+			     huffman_tree,
+			     bit_stream,
+			     &symbol,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve hunk: %" PRIu32 " repeat count upper symbol.",
+				 function,
+				 hunk_index );
+
+				goto on_error;
+			}
+			repeat_count = 2 + 16 + ( (uint32_t) symbol << 4 );
+
+			if( libodraw_huffman_tree_get_symbol_from_bit_stream(
+			     huffman_tree,
+			     bit_stream,
+			     &symbol,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve hunk: %" PRIu32 " repeat count lower symbol.",
+				 function,
+				 hunk_index );
+
+				goto on_error;
+			}
+			hunk_descriptor->type = last_hunk_type;
+			repeat_count         += (uint32_t) symbol;
+		}
+		else
+		{
+			hunk_descriptor->type = (uint8_t) symbol;
+			last_hunk_type        = (uint8_t) symbol;
+		}
+	}
+	/* Second pass: decode the sizes, offsets and checksums
+	 */
+	current_offset = (uint64_t) first_hunk_offset;
+
+	for( hunk_index = 0;
+	     hunk_index < chd_file->number_of_hunks;
+	     hunk_index++ )
+	{
+		hunk_descriptor = &( chd_file->hunk_descriptors[ hunk_index ] );
+
+		hunk_descriptor->offset = current_offset;
+
+		switch( hunk_descriptor->type )
+		{
+			case LIBODRAW_CHD_HUNK_TYPE_COMPRESSED_0:
+			case LIBODRAW_CHD_HUNK_TYPE_COMPRESSED_1:
+			case LIBODRAW_CHD_HUNK_TYPE_COMPRESSED_2:
+			case LIBODRAW_CHD_HUNK_TYPE_COMPRESSED_3:
+			case LIBODRAW_CHD_HUNK_TYPE_UNCOMPRESSED:
+				if( hunk_descriptor->type == LIBODRAW_CHD_HUNK_TYPE_UNCOMPRESSED )
+				{
+					hunk_descriptor->size = chd_file->hunk_size;
+				}
+				else
+				{
+					result = libodraw_bit_stream_get_value(
+					          bit_stream,
+					          hunk_size_bits,
+					          &value_32bit,
+					          error );
+
+					if( result != 1 )
+					{
+						break;
+					}
+					hunk_descriptor->size = value_32bit;
+				}
+				result = libodraw_bit_stream_get_value(
+				          bit_stream,
+				          16,
+				          &value_32bit,
+				          error );
+
+				hunk_descriptor->checksum = (uint16_t) value_32bit;
+
+				current_offset += hunk_descriptor->size;
+
+				break;
+
+			case LIBODRAW_CHD_HUNK_TYPE_SELF:
+				result = libodraw_bit_stream_get_value(
+				          bit_stream,
+				          self_reference_bits,
+				          &last_self_reference,
+				          error );
+
+				hunk_descriptor->offset = last_self_reference;
+
+				break;
+
+			case LIBODRAW_CHD_HUNK_TYPE_PARENT:
+				last_parent_reference = 0;
+
+				/* Parent references can be larger than 32 bits
+				 */
+				if( parent_reference_bits > 32 )
+				{
+					result = libodraw_bit_stream_get_value(
+					          bit_stream,
+					          parent_reference_bits - 32,
+					          &value_32bit,
+					          error );
+
+					if( result != 1 )
+					{
+						break;
+					}
+					last_parent_reference = (uint64_t) value_32bit << 32;
+				}
+				result = libodraw_bit_stream_get_value(
+				          bit_stream,
+				          ( parent_reference_bits > 32 ) ? 32 : parent_reference_bits,
+				          &value_32bit,
+				          error );
+
+				last_parent_reference  |= value_32bit;
+				hunk_descriptor->offset = last_parent_reference;
+
+				break;
+
+			case LIBODRAW_CHD_HUNK_TYPE_SELF_1:
+				last_self_reference++;
+
+				hunk_descriptor->type   = LIBODRAW_CHD_HUNK_TYPE_SELF;
+				hunk_descriptor->offset = last_self_reference;
+				result                  = 1;
+
+				break;
+
+			case LIBODRAW_CHD_HUNK_TYPE_SELF_0:
+				hunk_descriptor->type   = LIBODRAW_CHD_HUNK_TYPE_SELF;
+				hunk_descriptor->offset = last_self_reference;
+				result                  = 1;
+
+				break;
+
+			case LIBODRAW_CHD_HUNK_TYPE_PARENT_SELF:
+				last_parent_reference = ( (uint64_t) hunk_index * chd_file->hunk_size ) / chd_file->unit_size;
+
+				hunk_descriptor->type   = LIBODRAW_CHD_HUNK_TYPE_PARENT;
+				hunk_descriptor->offset = last_parent_reference;
+				result                  = 1;
+
+				break;
+
+			case LIBODRAW_CHD_HUNK_TYPE_PARENT_1:
+				last_parent_reference += chd_file->hunk_size / chd_file->unit_size;
+
+				hunk_descriptor->type   = LIBODRAW_CHD_HUNK_TYPE_PARENT;
+				hunk_descriptor->offset = last_parent_reference;
+				result                  = 1;
+
+				break;
+
+			case LIBODRAW_CHD_HUNK_TYPE_PARENT_0:
+				hunk_descriptor->type   = LIBODRAW_CHD_HUNK_TYPE_PARENT;
+				hunk_descriptor->offset = last_parent_reference;
+				result                  = 1;
+
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported hunk: %" PRIu32 " type: %" PRIu8 ".",
+				 function,
+				 hunk_index,
+				 hunk_descriptor->type );
+
+				goto on_error;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hunk: %" PRIu32 " values.",
+			 function,
+			 hunk_index );
+
+			goto on_error;
+		}
+	}
+	result = libodraw_bit_stream_is_overflow(
+	          bit_stream,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if bit stream overflowed.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+		 "%s: invalid compressed map data - data too small.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_huffman_tree_free(
+	     &huffman_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_bit_stream_free(
+	     &bit_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( huffman_tree != NULL )
+	{
+		libodraw_huffman_tree_free(
+		 &huffman_tree,
+		 NULL );
+	}
+	if( bit_stream != NULL )
+	{
+		libodraw_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the metadata
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_chd_file_read_metadata(
+     libodraw_chd_file_t *chd_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	chd_metadata_entry_header_t entry_header;
+
+	uint8_t *entry_data            = NULL;
+	static char *function          = "libodraw_chd_file_read_metadata";
+	ssize_t read_count             = 0;
+	off64_t metadata_offset        = 0;
+	uint64_t next_offset           = 0;
+	uint32_t entry_data_size       = 0;
+	uint32_t tag                   = 0;
+	int number_of_metadata_entries = 0;
+
+	if( chd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CHD file.",
+		 function );
+
+		return( -1 );
+	}
+	chd_file->number_of_tracks = 0;
+
+	metadata_offset = chd_file->metadata_offset;
+
+	while( metadata_offset != 0 )
+	{
+		/* Protect against a loop in the metadata chain
+		 */
+		if( number_of_metadata_entries >= 65536 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of metadata entries value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_metadata_entries++;
+
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              (uint8_t *) &entry_header,
+		              sizeof( chd_metadata_entry_header_t ),
+		              metadata_offset,
+		              error );
+
+		if( read_count != (ssize_t) sizeof( chd_metadata_entry_header_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read metadata entry header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 metadata_offset,
+			 metadata_offset );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_big_endian(
+		 entry_header.tag,
+		 tag );
+
+		byte_stream_copy_to_uint24_big_endian(
+		 entry_header.data_size,
+		 entry_data_size );
+
+		byte_stream_copy_to_uint64_big_endian(
+		 entry_header.next_offset,
+		 next_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: metadata entry tag\t\t: %c%c%c%c\n",
+			 function,
+			 entry_header.tag[ 0 ],
+			 entry_header.tag[ 1 ],
+			 entry_header.tag[ 2 ],
+			 entry_header.tag[ 3 ] );
+
+			libcnotify_printf(
+			 "%s: metadata entry flags\t\t: 0x%02" PRIx8 "\n",
+			 function,
+			 entry_header.flags );
+
+			libcnotify_printf(
+			 "%s: metadata entry data size\t\t: %" PRIu32 "\n",
+			 function,
+			 entry_data_size );
+
+			libcnotify_printf(
+			 "%s: metadata entry next offset\t: 0x%08" PRIx64 "\n",
+			 function,
+			 next_offset );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		if( tag == CHD_METADATA_TAG_GD_ROM_TRACK )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported GD-ROM track metadata.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( tag == CHD_METADATA_TAG_CD_TRACK )
+		 || ( tag == CHD_METADATA_TAG_CD_TRACK2 ) )
+		{
+			if( ( entry_data_size == 0 )
+			 || ( entry_data_size > 1024 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid track metadata entry data size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			entry_data = (uint8_t *) memory_allocate(
+			                          sizeof( uint8_t ) * entry_data_size );
+
+			if( entry_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create metadata entry data.",
+				 function );
+
+				goto on_error;
+			}
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              entry_data,
+			              (size_t) entry_data_size,
+			              metadata_offset + sizeof( chd_metadata_entry_header_t ),
+			              error );
+
+			if( read_count != (ssize_t) entry_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read metadata entry data.",
+				 function );
+
+				goto on_error;
+			}
+			if( libodraw_chd_file_read_track_metadata(
+			     chd_file,
+			     entry_data,
+			     (size_t) entry_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read track metadata.",
+				 function );
+
+				goto on_error;
+			}
+			memory_free(
+			 entry_data );
+
+			entry_data = NULL;
+		}
+		if( next_offset > (uint64_t) INT64_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid next metadata entry offset value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		metadata_offset = (off64_t) next_offset;
+	}
+	return( 1 );
+
+on_error:
+	if( entry_data != NULL )
+	{
+		memory_free(
+		 entry_data );
+	}
+	return( -1 );
+}
+
+/* Reads CD track metadata
+ * The metadata consists of a string of KEY:VALUE pairs, such as:
+ * "TRACK:1 TYPE:MODE1_RAW SUBTYPE:NONE FRAMES:1234 ..."
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_chd_file_read_track_metadata(
+     libodraw_chd_file_t *chd_file,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libodraw_chd_track_t *track = NULL;
+	const char *key             = NULL;
+	const char *value           = NULL;
+	static char *function       = "libodraw_chd_file_read_track_metadata";
+	size_t data_offset          = 0;
+	size_t key_length           = 0;
+	size_t value_length         = 0;
+	size_t value_index          = 0;
+	uint64_t number_of_frames   = 0;
+	uint64_t track_number       = 0;
+	uint64_t value_64bit        = 0;
+	uint32_t bytes_per_frame    = 0;
+	uint8_t is_audio            = 0;
+
+	if( chd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CHD file.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chd_file->number_of_tracks >= LIBODRAW_CHD_FILE_MAXIMUM_NUMBER_OF_TRACKS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of tracks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		while( ( data_offset < data_size )
+		    && ( data[ data_offset ] == (uint8_t) ' ' ) )
+		{
+			data_offset++;
+		}
+		if( ( data_offset >= data_size )
+		 || ( data[ data_offset ] == 0 ) )
+		{
+			break;
+		}
+		key        = (const char *) &( data[ data_offset ] );
+		key_length = 0;
+
+		while( ( data_offset < data_size )
+		    && ( data[ data_offset ] != 0 )
+		    && ( data[ data_offset ] != (uint8_t) ' ' )
+		    && ( data[ data_offset ] != (uint8_t) ':' ) )
+		{
+			data_offset++;
+			key_length++;
+		}
+		value        = NULL;
+		value_length = 0;
+
+		if( ( data_offset < data_size )
+		 && ( data[ data_offset ] == (uint8_t) ':' ) )
+		{
+			data_offset++;
+
+			value = (const char *) &( data[ data_offset ] );
+
+			while( ( data_offset < data_size )
+			    && ( data[ data_offset ] != 0 )
+			    && ( data[ data_offset ] != (uint8_t) ' ' ) )
+			{
+				data_offset++;
+				value_length++;
+			}
+		}
+		if( value == NULL )
+		{
+			continue;
+		}
+		if( ( ( key_length == 5 )
+		  &&  ( narrow_string_compare(
+		         key,
+		         "TRACK",
+		         5 ) == 0 ) )
+		 || ( ( key_length == 6 )
+		  &&  ( narrow_string_compare(
+		         key,
+		         "FRAMES",
+		         6 ) == 0 ) ) )
+		{
+			if( ( value_length == 0 )
+			 || ( value_length > 9 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported %s value.",
+				 function,
+				 ( key_length == 5 ) ? "TRACK" : "FRAMES" );
+
+				return( -1 );
+			}
+			value_64bit = 0;
+
+			for( value_index = 0;
+			     value_index < value_length;
+			     value_index++ )
+			{
+				if( ( value[ value_index ] < '0' )
+				 || ( value[ value_index ] > '9' ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported %s value.",
+					 function,
+					 ( key_length == 5 ) ? "TRACK" : "FRAMES" );
+
+					return( -1 );
+				}
+				value_64bit *= 10;
+				value_64bit += (uint64_t) ( value[ value_index ] - '0' );
+			}
+			if( key_length == 5 )
+			{
+				track_number = value_64bit;
+			}
+			else
+			{
+				number_of_frames = value_64bit;
+			}
+		}
+		else if( ( key_length == 4 )
+		      && ( narrow_string_compare(
+		            key,
+		            "TYPE",
+		            4 ) == 0 ) )
+		{
+			if( ( ( value_length == 5 )
+			  &&  ( narrow_string_compare(
+			         value,
+			         "MODE1",
+			         5 ) == 0 ) )
+			 || ( ( value_length == 10 )
+			  &&  ( narrow_string_compare(
+			         value,
+			         "MODE1/2048",
+			         10 ) == 0 ) )
+			 || ( ( value_length == 11 )
+			  &&  ( narrow_string_compare(
+			         value,
+			         "MODE2_FORM1",
+			         11 ) == 0 ) )
+			 || ( ( value_length == 10 )
+			  &&  ( narrow_string_compare(
+			         value,
+			         "MODE2/2048",
+			         10 ) == 0 ) ) )
+			{
+				bytes_per_frame = 2048;
+			}
+			else if( ( ( value_length == 11 )
+			       &&  ( narrow_string_compare(
+			              value,
+			              "MODE2_FORM2",
+			              11 ) == 0 ) )
+			      || ( ( value_length == 10 )
+			       &&  ( narrow_string_compare(
+			              value,
+			              "MODE2/2324",
+			              10 ) == 0 ) ) )
+			{
+				bytes_per_frame = 2324;
+			}
+			else if( ( ( value_length == 5 )
+			       &&  ( narrow_string_compare(
+			              value,
+			              "MODE2",
+			              5 ) == 0 ) )
+			      || ( ( value_length == 14 )
+			       &&  ( narrow_string_compare(
+			              value,
+			              "MODE2_FORM_MIX",
+			              14 ) == 0 ) )
+			      || ( ( value_length == 10 )
+			       &&  ( narrow_string_compare(
+			              value,
+			              "MODE2/2336",
+			              10 ) == 0 ) ) )
+			{
+				bytes_per_frame = 2336;
+			}
+			else if( ( ( value_length == 9 )
+			       &&  ( narrow_string_compare(
+			              value,
+			              "MODE1_RAW",
+			              9 ) == 0 ) )
+			      || ( ( value_length == 10 )
+			       &&  ( narrow_string_compare(
+			              value,
+			              "MODE1/2352",
+			              10 ) == 0 ) )
+			      || ( ( value_length == 9 )
+			       &&  ( narrow_string_compare(
+			              value,
+			              "MODE2_RAW",
+			              9 ) == 0 ) )
+			      || ( ( value_length == 10 )
+			       &&  ( narrow_string_compare(
+			              value,
+			              "MODE2/2352",
+			              10 ) == 0 ) )
+			      || ( ( value_length == 8 )
+			       &&  ( narrow_string_compare(
+			              value,
+			              "CDI/2352",
+			              8 ) == 0 ) ) )
+			{
+				bytes_per_frame = 2352;
+			}
+			else if( ( value_length == 5 )
+			      && ( narrow_string_compare(
+			            value,
+			            "AUDIO",
+			            5 ) == 0 ) )
+			{
+				bytes_per_frame = 2352;
+				is_audio        = 1;
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported track type.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	/* The tracks are stored in order
+	 */
+	if( track_number != (uint64_t) ( chd_file->number_of_tracks + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported track number: %" PRIu64 ".",
+		 function,
+		 track_number );
+
+		return( -1 );
+	}
+	if( bytes_per_frame == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing track type.",
+		 function );
+
+		return( -1 );
+	}
+	track = &( chd_file->tracks[ chd_file->number_of_tracks ] );
+
+	track->number_of_frames = (uint32_t) number_of_frames;
+	track->bytes_per_frame  = bytes_per_frame;
+	track->is_audio         = is_audio;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: track: %" PRIu64 " number of frames\t: %" PRIu32 "\n",
+		 function,
+		 track_number,
+		 track->number_of_frames );
+
+		libcnotify_printf(
+		 "%s: track: %" PRIu64 " bytes per frame\t: %" PRIu32 "\n",
+		 function,
+		 track_number,
+		 track->bytes_per_frame );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	chd_file->number_of_tracks += 1;
+
+	return( 1 );
+}
+
+/* Reads and decompresses a hunk
+ * This function can be called by the read-ahead threads, the CHD file mutex is
+ * only held while the file IO handle is used
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_chd_file_read_hunk(
+     libodraw_chd_file_t *chd_file,
+     uint32_t hunk_index,
+     uint8_t *hunk_data,
+     size_t hunk_data_size,
+     libcerror_error_t **error )
+{
+	libodraw_chd_hunk_descriptor_t *hunk_descriptor = NULL;
+	uint8_t *compressed_data                        = NULL;
+	static char *function                           = "libodraw_chd_file_read_hunk";
+	size_t read_size                                = 0;
+	ssize_t read_count                              = 0;
+	uint32_t compression_method                     = 0;
+	uint16_t calculated_checksum                    = 0;
+	int cd_compression_method                       = 0;
+	int result                                      = 0;
+
+	if( chd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CHD file.",
+		 function );
+
+		return( -1 );
+	}
+	if( chd_file->hunk_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid CHD file - missing hunk descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( hunk_index >= chd_file->number_of_hunks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( hunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( hunk_data_size != (size_t) chd_file->hunk_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hunk data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	hunk_descriptor = &( chd_file->hunk_descriptors[ hunk_index ] );
+
+	/* A self reference refers to an earlier hunk with the same data
+	 */
+	while( hunk_descriptor->type == LIBODRAW_CHD_HUNK_TYPE_SELF )
+	{
+		if( hunk_descriptor->offset >= (uint64_t) hunk_index )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid hunk: %" PRIu32 " self reference value out of bounds.",
+			 function,
+			 hunk_index );
+
+			return( -1 );
+		}
+		hunk_index      = (uint32_t) hunk_descriptor->offset;
+		hunk_descriptor = &( chd_file->hunk_descriptors[ hunk_index ] );
+	}
+	switch( hunk_descriptor->type )
+	{
+		case LIBODRAW_CHD_HUNK_TYPE_COMPRESSED_0:
+		case LIBODRAW_CHD_HUNK_TYPE_COMPRESSED_1:
+		case LIBODRAW_CHD_HUNK_TYPE_COMPRESSED_2:
+		case LIBODRAW_CHD_HUNK_TYPE_COMPRESSED_3:
+			compression_method = chd_file->compression_methods[ hunk_descriptor->type ];
+
+			if( ( hunk_descriptor->size == 0 )
+			 || ( hunk_descriptor->size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid hunk: %" PRIu32 " compressed size value out of bounds.",
+				 function,
+				 hunk_index );
+
+				goto on_error;
+			}
+			read_size = (size_t) hunk_descriptor->size;
+
+			compressed_data = (uint8_t *) memory_allocate(
+			                               sizeof( uint8_t ) * read_size );
+
+			if( compressed_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create compressed data.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBODRAW_CHD_HUNK_TYPE_UNCOMPRESSED:
+			read_size = (size_t) chd_file->hunk_size;
+
+			break;
+
+		case LIBODRAW_CHD_HUNK_TYPE_ZERO:
+			if( memory_set(
+			     hunk_data,
+			     0,
+			     hunk_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear hunk data.",
+				 function );
+
+				goto on_error;
+			}
+			return( 1 );
+
+		case LIBODRAW_CHD_HUNK_TYPE_PARENT:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported hunk: %" PRIu32 " in parent CHD file.",
+			 function,
+			 hunk_index );
+
+			goto on_error;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported hunk: %" PRIu32 " type: %" PRIu8 ".",
+			 function,
+			 hunk_index,
+			 hunk_descriptor->type );
+
+			goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     chd_file->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              chd_file->file_io_handle,
+	              ( compressed_data != NULL ) ? compressed_data : hunk_data,
+	              read_size,
+	              (off64_t) hunk_descriptor->offset,
+	              error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     chd_file->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read hunk: %" PRIu32 " data at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+		 function,
+		 hunk_index,
+		 hunk_descriptor->offset,
+		 hunk_descriptor->offset );
+
+		goto on_error;
+	}
+	if( compressed_data != NULL )
+	{
+		switch( compression_method )
+		{
+			case CHD_COMPRESSION_METHOD_ZLIB:
+			case CHD_COMPRESSION_METHOD_LZMA:
+				result = libodraw_decompress_data(
+				          compressed_data,
+				          read_size,
+				          ( compression_method == CHD_COMPRESSION_METHOD_ZLIB ) ? LIBODRAW_COMPRESSION_METHOD_DEFLATE : LIBODRAW_COMPRESSION_METHOD_LZMA,
+				          hunk_data,
+				          hunk_data_size,
+				          error );
+				break;
+
+			case CHD_COMPRESSION_METHOD_FLAC:
+				result = libodraw_chd_file_decompress_flac_hunk(
+				          compressed_data,
+				          read_size,
+				          hunk_data,
+				          hunk_data_size,
+				          error );
+				break;
+
+			case CHD_COMPRESSION_METHOD_CD_ZLIB:
+			case CHD_COMPRESSION_METHOD_CD_LZMA:
+			case CHD_COMPRESSION_METHOD_CD_FLAC:
+				if( compression_method == CHD_COMPRESSION_METHOD_CD_ZLIB )
+				{
+					cd_compression_method = LIBODRAW_COMPRESSION_METHOD_DEFLATE;
+				}
+				else if( compression_method == CHD_COMPRESSION_METHOD_CD_LZMA )
+				{
+					cd_compression_method = LIBODRAW_COMPRESSION_METHOD_LZMA;
+				}
+				else
+				{
+					cd_compression_method = LIBODRAW_COMPRESSION_METHOD_FLAC;
+				}
+				result = libodraw_chd_file_decompress_cd_hunk(
+				          chd_file,
+				          compressed_data,
+				          read_size,
+				          cd_compression_method,
+				          hunk_data,
+				          hunk_data_size,
+				          error );
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported compression method: %c%c%c%c.",
+				 function,
+				 (char) ( ( compression_method >> 24 ) & 0xff ),
+				 (char) ( ( compression_method >> 16 ) & 0xff ),
+				 (char) ( ( compression_method >> 8 ) & 0xff ),
+				 (char) ( compression_method & 0xff ) );
+
+				goto on_error;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress hunk: %" PRIu32 ".",
+			 function,
+			 hunk_index );
+
+			goto on_error;
+		}
+		memory_free(
+		 compressed_data );
+
+		compressed_data = NULL;
+	}
+	/* The hunks of an uncompressed file have no checksum
+	 */
+	if( chd_file->compression_methods[ 0 ] != CHD_COMPRESSION_METHOD_NONE )
+	{
+		if( libodraw_checksum_calculate_crc16(
+		     &calculated_checksum,
+		     hunk_data,
+		     hunk_data_size,
+		     0xffff,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate hunk: %" PRIu32 " checksum.",
+			 function,
+			 hunk_index );
+
+			goto on_error;
+		}
+		if( hunk_descriptor->checksum != calculated_checksum )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: mismatch in hunk: %" PRIu32 " checksum ( 0x%04" PRIx16 " != 0x%04" PRIx16 " ).",
+			 function,
+			 hunk_index,
+			 hunk_descriptor->checksum,
+			 calculated_checksum );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	return( -1 );
+}
+
+/* Decompresses a CD hunk
+ * The sector data and subcode data of the frames are compressed separately,
+ * sync headers and ECC data that could be regenerated were removed before compression
+ * FLAC compressed sector data is stored as big-endian samples without a header, the
+ * subcode data directly follows the last FLAC frame
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_chd_file_decompress_cd_hunk(
+     libodraw_chd_file_t *chd_file,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int compression_method,
+     uint8_t *hunk_data,
+     size_t hunk_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *frame_data           = NULL;
+	uint8_t *sector_data          = NULL;
+	static char *function         = "libodraw_chd_file_decompress_cd_hunk";
+	size_t compressed_sector_size = 0;
+	size_t ecc_bitmap_size        = 0;
+	size_t frame_index            = 0;
+	size_t header_size            = 0;
+	size_t number_of_frames       = 0;
+	int result                    = 0;
+
+	if( chd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CHD file.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( hunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hunk_data_size == 0 )
+	 || ( ( hunk_data_size % LIBODRAW_CHD_FILE_CD_FRAME_SIZE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hunk data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_frames = hunk_data_size / LIBODRAW_CHD_FILE_CD_FRAME_SIZE;
+
+	if( compression_method != LIBODRAW_COMPRESSION_METHOD_FLAC )
+	{
+		ecc_bitmap_size = ( number_of_frames + 7 ) / 8;
+		header_size     = ecc_bitmap_size + ( ( hunk_data_size < 65536 ) ? 2 : 3 );
+
+		if( compressed_data_size < header_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( hunk_data_size < 65536 )
+		{
+			byte_stream_copy_to_uint16_big_endian(
+			 &( compressed_data[ ecc_bitmap_size ] ),
+			 compressed_sector_size );
+		}
+		else
+		{
+			byte_stream_copy_to_uint24_big_endian(
+			 &( compressed_data[ ecc_bitmap_size ] ),
+			 compressed_sector_size );
+		}
+		if( compressed_sector_size > ( compressed_data_size - header_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid compressed sector data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The sector data of all frames is followed by the subcode data of all frames
+	 */
+	sector_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * hunk_data_size );
+
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sector data.",
+		 function );
+
+		goto on_error;
+	}
+	if( compression_method == LIBODRAW_COMPRESSION_METHOD_FLAC )
+	{
+		result = libodraw_flac_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          &compressed_sector_size,
+		          sector_data,
+		          number_of_frames * LIBODRAW_CHD_FILE_CD_SECTOR_DATA_SIZE,
+		          _BYTE_STREAM_ENDIAN_BIG,
+		          error );
+	}
+	else
+	{
+		result = libodraw_decompress_data(
+		          &( compressed_data[ header_size ] ),
+		          compressed_sector_size,
+		          compression_method,
+		          sector_data,
+		          number_of_frames * LIBODRAW_CHD_FILE_CD_SECTOR_DATA_SIZE,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress sector data.",
+		 function );
+
+		goto on_error;
+	}
+	/* The subcode data is always deflate compressed
+	 */
+	if( libodraw_decompress_data(
+	     &( compressed_data[ header_size + compressed_sector_size ] ),
+	     compressed_data_size - header_size - compressed_sector_size,
+	     LIBODRAW_COMPRESSION_METHOD_DEFLATE,
+	     &( sector_data[ number_of_frames * LIBODRAW_CHD_FILE_CD_SECTOR_DATA_SIZE ] ),
+	     number_of_frames * LIBODRAW_CHD_FILE_CD_SUBCODE_DATA_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress subcode data.",
+		 function );
+
+		goto on_error;
+	}
+	for( frame_index = 0;
+	     frame_index < number_of_frames;
+	     frame_index++ )
+	{
+		frame_data = &( hunk_data[ frame_index * LIBODRAW_CHD_FILE_CD_FRAME_SIZE ] );
+
+		if( memory_copy(
+		     frame_data,
+		     &( sector_data[ frame_index * LIBODRAW_CHD_FILE_CD_SECTOR_DATA_SIZE ] ),
+		     LIBODRAW_CHD_FILE_CD_SECTOR_DATA_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy frame: %" PRIzd " sector data.",
+			 function,
+			 frame_index );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     &( frame_data[ LIBODRAW_CHD_FILE_CD_SECTOR_DATA_SIZE ] ),
+		     &( sector_data[ ( number_of_frames * LIBODRAW_CHD_FILE_CD_SECTOR_DATA_SIZE ) + ( frame_index * LIBODRAW_CHD_FILE_CD_SUBCODE_DATA_SIZE ) ] ),
+		     LIBODRAW_CHD_FILE_CD_SUBCODE_DATA_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy frame: %" PRIzd " subcode data.",
+			 function,
+			 frame_index );
+
+			goto on_error;
+		}
+		if( ( ecc_bitmap_size > 0 )
+		 && ( ( compressed_data[ frame_index / 8 ] & ( 1 << ( frame_index % 8 ) ) ) != 0 ) )
+		{
+			if( memory_copy(
+			     frame_data,
+			     chd_file_cd_sync_header,
+			     12 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy frame: %" PRIzd " sync header.",
+				 function,
+				 frame_index );
+
+				goto on_error;
+			}
+			if( libodraw_checksum_calculate_ecc(
+			     frame_data,
+			     LIBODRAW_CHD_FILE_CD_SECTOR_DATA_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to calculate frame: %" PRIzd " ECC.",
+				 function,
+				 frame_index );
+
+				goto on_error;
+			}
+		}
+	}
+	memory_free(
+	 sector_data );
+
+	return( 1 );
+
+on_error:
+	if( sector_data != NULL )
+	{
+		memory_free(
+		 sector_data );
+	}
+	return( -1 );
+}
+
+/* Decompresses a FLAC hunk
+ * The hunk data is stored as 16-bit stereo samples, the first byte of the
+ * compressed data indicates the byte order of the samples: 'L' or 'B'
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_chd_file_decompress_flac_hunk(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *hunk_data,
+     size_t hunk_data_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libodraw_chd_file_decompress_flac_hunk";
+	size_t compressed_data_offset = 0;
+	uint8_t byte_order            = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data[ 0 ] == (uint8_t) 'L' )
+	{
+		byte_order = _BYTE_STREAM_ENDIAN_LITTLE;
+	}
+	else if( compressed_data[ 0 ] == (uint8_t) 'B' )
+	{
+		byte_order = _BYTE_STREAM_ENDIAN_BIG;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order: 0x%02" PRIx8 ".",
+		 function,
+		 compressed_data[ 0 ] );
+
+		return( -1 );
+	}
+	if( libodraw_flac_decompress(
+	     &( compressed_data[ 1 ] ),
+	     compressed_data_size - 1,
+	     &compressed_data_offset,
+	     hunk_data,
+	     hunk_data_size,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress FLAC data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads data at a specific offset of the exposed data
+ * For a CD the exposed data consists of the sector data of the tracks, as in a BIN file
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_chd_file_read_buffer_at_offset(
+         libodraw_chd_file_t *chd_file,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libodraw_chd_track_t *track = NULL;
+	const uint8_t *hunk_data    = NULL;
+	static char *function       = "libodraw_chd_file_read_buffer_at_offset";
+	size_t buffer_offset        = 0;
+	size_t data_offset          = 0;
+	size_t read_size            = 0;
+	uint64_t frame_index        = 0;
+	uint64_t hunk_data_offset   = 0;
+	uint64_t relative_offset    = 0;
+	uint32_t hunk_index         = 0;
+	int track_index             = 0;
+
+	if( chd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CHD file.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= chd_file->data_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( chd_file->data_size - (size64_t) offset ) )
+	{
+		buffer_size = (size_t) ( chd_file->data_size - (size64_t) offset );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		if( chd_file->number_of_tracks == 0 )
+		{
+			hunk_index  = (uint32_t) ( (uint64_t) offset / chd_file->hunk_size );
+			data_offset = (size_t) ( (uint64_t) offset % chd_file->hunk_size );
+			read_size   = (size_t) chd_file->hunk_size - data_offset;
+		}
+		else
+		{
+			/* Most reads are within the track of the previous read
+			 */
+			track_index = chd_file->last_track_index;
+
+			if( ( track_index < 0 )
+			 || ( track_index >= chd_file->number_of_tracks )
+			 || ( (uint64_t) offset < chd_file->tracks[ track_index ].data_offset ) )
+			{
+				track_index = 0;
+			}
+			while( track_index < chd_file->number_of_tracks )
+			{
+				track = &( chd_file->tracks[ track_index ] );
+
+				if( (uint64_t) offset < ( track->data_offset + ( (uint64_t) track->number_of_frames * track->bytes_per_frame ) ) )
+				{
+					break;
+				}
+				track_index++;
+			}
+			if( track_index >= chd_file->number_of_tracks )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid offset value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			chd_file->last_track_index = track_index;
+
+			relative_offset  = (uint64_t) offset - track->data_offset;
+			frame_index      = track->start_frame + ( relative_offset / track->bytes_per_frame );
+			hunk_data_offset = frame_index * LIBODRAW_CHD_FILE_CD_FRAME_SIZE;
+
+			hunk_index  = (uint32_t) ( hunk_data_offset / chd_file->hunk_size );
+			data_offset = (size_t) ( hunk_data_offset % chd_file->hunk_size );
+			read_size   = (size_t) ( track->bytes_per_frame - ( relative_offset % track->bytes_per_frame ) );
+
+			/* The track data is stored at the start of the frame
+			 */
+			data_offset += (size_t) ( relative_offset % track->bytes_per_frame );
+		}
+		if( read_size > ( buffer_size - buffer_offset ) )
+		{
+			read_size = buffer_size - buffer_offset;
+		}
+		if( libodraw_block_cache_get_block_data(
+		     chd_file->block_cache,
+		     hunk_index,
+		     &hunk_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hunk: %" PRIu32 " data.",
+			 function,
+			 hunk_index );
+
+			return( -1 );
+		}
+		if( ( chd_file->number_of_tracks > 0 )
+		 && ( track->is_audio != 0 ) )
+		{
+			/* Audio is stored as big-endian 16-bit samples, where the BIN format uses little-endian
+			 * the frame data size is even so the byte swapped index remains within the frame
+			 */
+			while( read_size > 0 )
+			{
+				buffer[ buffer_offset++ ] = hunk_data[ data_offset ^ 1 ];
+
+				data_offset++;
+				read_size--;
+				offset++;
+			}
+		}
+		else
+		{
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( hunk_data[ data_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy hunk: %" PRIu32 " data.",
+				 function,
+				 hunk_index );
+
+				return( -1 );
+			}
+			buffer_offset += read_size;
+			offset        += (off64_t) read_size;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Retrieves the size of the exposed data
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_chd_file_get_data_size(
+     libodraw_chd_file_t *chd_file,
+     size64_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_chd_file_get_data_size";
+
+	if( chd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CHD file.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = chd_file->data_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,270 @@
+/*
+ * MAME Compressed Hunks of Data (CHD) file functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_CHD_FILE_H )
+#define _LIBODRAW_CHD_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_block_cache.h"
+#include "libodraw_libbfio.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define LIBODRAW_CHD_FILE_MAXIMUM_NUMBER_OF_TRACKS		99
+
+/* The size of a CD frame: 2352 bytes of sector data and 96 bytes of subcode data
+ */
+#define LIBODRAW_CHD_FILE_CD_FRAME_SIZE				2448
+#define LIBODRAW_CHD_FILE_CD_SECTOR_DATA_SIZE			2352
+#define LIBODRAW_CHD_FILE_CD_SUBCODE_DATA_SIZE			96
+
+/* The hunk types as stored in the (compressed) hunk map
+ */
+enum LIBODRAW_CHD_HUNK_TYPES
+{
+	LIBODRAW_CHD_HUNK_TYPE_COMPRESSED_0			= 0,
+	LIBODRAW_CHD_HUNK_TYPE_COMPRESSED_1			= 1,
+	LIBODRAW_CHD_HUNK_TYPE_COMPRESSED_2			= 2,
+	LIBODRAW_CHD_HUNK_TYPE_COMPRESSED_3			= 3,
+	LIBODRAW_CHD_HUNK_TYPE_UNCOMPRESSED			= 4,
+	LIBODRAW_CHD_HUNK_TYPE_SELF				= 5,
+	LIBODRAW_CHD_HUNK_TYPE_PARENT				= 6,
+	LIBODRAW_CHD_HUNK_TYPE_RLE_SMALL			= 7,
+	LIBODRAW_CHD_HUNK_TYPE_RLE_LARGE			= 8,
+	LIBODRAW_CHD_HUNK_TYPE_SELF_0				= 9,
+	LIBODRAW_CHD_HUNK_TYPE_SELF_1				= 10,
+	LIBODRAW_CHD_HUNK_TYPE_PARENT_SELF			= 11,
+	LIBODRAW_CHD_HUNK_TYPE_PARENT_0				= 12,
+	LIBODRAW_CHD_HUNK_TYPE_PARENT_1				= 13,
+
+	/* Not stored, used for hunks of an uncompressed file that contain 0-byte values
+	 */
+	LIBODRAW_CHD_HUNK_TYPE_ZERO				= 0xff
+};
+
+typedef struct libodraw_chd_hunk_descriptor libodraw_chd_hunk_descriptor_t;
+
+struct libodraw_chd_hunk_descriptor
+{
+	/* The offset, or the referenced hunk or unit
+	 */
+	uint64_t offset;
+
+	/* The (compressed) size
+	 */
+	uint32_t size;
+
+	/* The CRC-16 of the decompressed data
+	 */
+	uint16_t checksum;
+
+	/* The type
+	 */
+	uint8_t type;
+};
+
+typedef struct libodraw_chd_track libodraw_chd_track_t;
+
+struct libodraw_chd_track
+{
+	/* The offset of the track data in the exposed data
+	 */
+	uint64_t data_offset;
+
+	/* The first frame of the track in the CHD
+	 */
+	uint64_t start_frame;
+
+	/* The number of frames
+	 */
+	uint32_t number_of_frames;
+
+	/* The number of bytes per frame of the track data
+	 */
+	uint32_t bytes_per_frame;
+
+	/* Value to indicate the track contains audio, which is stored big-endian
+	 */
+	uint8_t is_audio;
+};
+
+typedef struct libodraw_chd_file libodraw_chd_file_t;
+
+struct libodraw_chd_file
+{
+	/* The format version
+	 */
+	uint32_t format_version;
+
+	/* The compression methods
+	 */
+	uint32_t compression_methods[ 4 ];
+
+	/* The logical size
+	 */
+	size64_t logical_size;
+
+	/* The hunk map offset
+	 */
+	off64_t map_offset;
+
+	/* The first metadata entry offset
+	 */
+	off64_t metadata_offset;
+
+	/* The hunk size
+	 */
+	uint32_t hunk_size;
+
+	/* The unit size
+	 */
+	uint32_t unit_size;
+
+	/* The number of hunks
+	 */
+	uint32_t number_of_hunks;
+
+	/* The hunk descriptors
+	 */
+	libodraw_chd_hunk_descriptor_t *hunk_descriptors;
+
+	/* The CD tracks
+	 */
+	libodraw_chd_track_t tracks[ LIBODRAW_CHD_FILE_MAXIMUM_NUMBER_OF_TRACKS ];
+
+	/* The number of CD tracks
+	 */
+	int number_of_tracks;
+
+	/* The size of the data as exposed, which for a CD is the sector data of all tracks
+	 */
+	size64_t data_size;
+
+	/* The file IO handle of the CHD file
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The block cache of decompressed hunks
+	 */
+	libodraw_block_cache_t *block_cache;
+
+	/* The index of the track that was last read
+	 */
+	int last_track_index;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the file IO handle
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libodraw_chd_file_initialize(
+     libodraw_chd_file_t **chd_file,
+     libcerror_error_t **error );
+
+int libodraw_chd_file_free(
+     libodraw_chd_file_t **chd_file,
+     libcerror_error_t **error );
+
+int libodraw_chd_file_open_read(
+     libodraw_chd_file_t *chd_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libodraw_chd_file_read_file_header(
+     libodraw_chd_file_t *chd_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libodraw_chd_file_read_hunk_map(
+     libodraw_chd_file_t *chd_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libodraw_chd_file_read_compressed_hunk_map(
+     libodraw_chd_file_t *chd_file,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t first_hunk_offset,
+     uint8_t hunk_size_bits,
+     uint8_t self_reference_bits,
+     uint8_t parent_reference_bits,
+     libcerror_error_t **error );
+
+int libodraw_chd_file_read_metadata(
+     libodraw_chd_file_t *chd_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libodraw_chd_file_read_track_metadata(
+     libodraw_chd_file_t *chd_file,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libodraw_chd_file_read_hunk(
+     libodraw_chd_file_t *chd_file,
+     uint32_t hunk_index,
+     uint8_t *hunk_data,
+     size_t hunk_data_size,
+     libcerror_error_t **error );
+
+int libodraw_chd_file_decompress_cd_hunk(
+     libodraw_chd_file_t *chd_file,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int compression_method,
+     uint8_t *hunk_data,
+     size_t hunk_data_size,
+     libcerror_error_t **error );
+
+int libodraw_chd_file_decompress_flac_hunk(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *hunk_data,
+     size_t hunk_data_size,
+     libcerror_error_t **error );
+
+ssize_t libodraw_chd_file_read_buffer_at_offset(
+         libodraw_chd_file_t *chd_file,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libodraw_chd_file_get_data_size(
+     libodraw_chd_file_t *chd_file,
+     size64_t *data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_CHD_FILE_H ) */
+
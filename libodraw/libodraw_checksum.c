@@ -0,0 +1,615 @@
+/*
+ * Checksum functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_checksum.h"
+#include "libodraw_libcerror.h"
+
+/* Table of the CRC-16 values of all 8-bit values
+ */
+uint16_t libodraw_checksum_crc16_table[ 256 ];
+
+/* Value to indicate the CRC-16 table been computed
+ */
+int libodraw_checksum_crc16_table_computed = 0;
+
+/* Table of the CRC-8 values of all 8-bit values
+ */
+uint8_t libodraw_checksum_crc8_table[ 256 ];
+
+/* Value to indicate the CRC-8 table been computed
+ */
+int libodraw_checksum_crc8_table_computed = 0;
+
+/* Table of the CRC-16 IBM values of all 8-bit values
+ */
+uint16_t libodraw_checksum_crc16_ibm_table[ 256 ];
+
+/* Value to indicate the CRC-16 IBM table been computed
+ */
+int libodraw_checksum_crc16_ibm_table_computed = 0;
+
+/* Table of the EDC values of all 8-bit values
+ */
+uint32_t libodraw_checksum_edc_table[ 256 ];
+
+/* Value to indicate the EDC table been computed
+ */
+int libodraw_checksum_edc_table_computed = 0;
+
+/* Tables of the Galois field (GF(2^8)) multiplication by 2 and its inverse
+ * as used by the CD-ROM Reed-Solomon Product Code (RSPC) ECC
+ */
+uint8_t libodraw_checksum_ecc_forward_table[ 256 ];
+uint8_t libodraw_checksum_ecc_backward_table[ 256 ];
+
+/* Value to indicate the ECC tables been computed
+ */
+int libodraw_checksum_ecc_tables_computed = 0;
+
+/* Initializes the internal CRC-16 table
+ * The table speeds up the CRC-16 calculation
+ */
+void libodraw_checksum_initialize_crc16_table(
+      uint16_t polynomial )
+{
+	uint16_t crc16             = 0;
+	uint16_t crc16_table_index = 0;
+	uint8_t bit_iterator       = 0;
+
+	for( crc16_table_index = 0;
+	     crc16_table_index < 256;
+	     crc16_table_index++ )
+	{
+		crc16 = (uint16_t) ( crc16_table_index << 8 );
+
+		for( bit_iterator = 0;
+		     bit_iterator < 8;
+		     bit_iterator++ )
+		{
+			if( ( crc16 & 0x8000 ) != 0 )
+			{
+				crc16 = (uint16_t) ( ( crc16 << 1 ) ^ polynomial );
+			}
+			else
+			{
+				crc16 = (uint16_t) ( crc16 << 1 );
+			}
+		}
+		libodraw_checksum_crc16_table[ crc16_table_index ] = crc16;
+	}
+	libodraw_checksum_crc16_table_computed = 1;
+}
+
+/* Calculates the CRC-16 of a buffer
+ * This is the non-reflected CCITT variant (polynomial 0x1021) as used by CHD
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_checksum_calculate_crc16(
+     uint16_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint16_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function  = "libodraw_checksum_calculate_crc16";
+	size_t buffer_offset   = 0;
+	uint16_t safe_checksum = 0;
+	uint8_t table_index    = 0;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_checksum_crc16_table_computed == 0 )
+	{
+		libodraw_checksum_initialize_crc16_table(
+		 0x1021 );
+	}
+	safe_checksum = initial_value;
+
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset++ )
+	{
+		table_index = (uint8_t) ( ( safe_checksum >> 8 ) ^ buffer[ buffer_offset ] );
+
+		safe_checksum = (uint16_t) ( ( safe_checksum << 8 ) ^ libodraw_checksum_crc16_table[ table_index ] );
+	}
+	*checksum_value = safe_checksum;
+
+	return( 1 );
+}
+
+/* Initializes the internal CRC-8 table
+ * The table speeds up the CRC-8 calculation
+ */
+void libodraw_checksum_initialize_crc8_table(
+      uint8_t polynomial )
+{
+	uint16_t crc8_table_index = 0;
+	uint8_t bit_iterator      = 0;
+	uint8_t crc8              = 0;
+
+	for( crc8_table_index = 0;
+	     crc8_table_index < 256;
+	     crc8_table_index++ )
+	{
+		crc8 = (uint8_t) crc8_table_index;
+
+		for( bit_iterator = 0;
+		     bit_iterator < 8;
+		     bit_iterator++ )
+		{
+			if( ( crc8 & 0x80 ) != 0 )
+			{
+				crc8 = (uint8_t) ( ( crc8 << 1 ) ^ polynomial );
+			}
+			else
+			{
+				crc8 = (uint8_t) ( crc8 << 1 );
+			}
+		}
+		libodraw_checksum_crc8_table[ crc8_table_index ] = crc8;
+	}
+	libodraw_checksum_crc8_table_computed = 1;
+}
+
+/* Calculates the CRC-8 of a buffer
+ * This is the non-reflected variant (polynomial 0x07) as used by FLAC frame headers
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_checksum_calculate_crc8(
+     uint8_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint8_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_checksum_calculate_crc8";
+	size_t buffer_offset  = 0;
+	uint8_t safe_checksum = 0;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_checksum_crc8_table_computed == 0 )
+	{
+		libodraw_checksum_initialize_crc8_table(
+		 0x07 );
+	}
+	safe_checksum = initial_value;
+
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset++ )
+	{
+		safe_checksum = libodraw_checksum_crc8_table[ safe_checksum ^ buffer[ buffer_offset ] ];
+	}
+	*checksum_value = safe_checksum;
+
+	return( 1 );
+}
+
+/* Initializes the internal CRC-16 IBM table
+ * The table speeds up the CRC-16 IBM calculation
+ */
+void libodraw_checksum_initialize_crc16_ibm_table(
+      uint16_t polynomial )
+{
+	uint16_t crc16             = 0;
+	uint16_t crc16_table_index = 0;
+	uint8_t bit_iterator       = 0;
+
+	for( crc16_table_index = 0;
+	     crc16_table_index < 256;
+	     crc16_table_index++ )
+	{
+		crc16 = (uint16_t) ( crc16_table_index << 8 );
+
+		for( bit_iterator = 0;
+		     bit_iterator < 8;
+		     bit_iterator++ )
+		{
+			if( ( crc16 & 0x8000 ) != 0 )
+			{
+				crc16 = (uint16_t) ( ( crc16 << 1 ) ^ polynomial );
+			}
+			else
+			{
+				crc16 = (uint16_t) ( crc16 << 1 );
+			}
+		}
+		libodraw_checksum_crc16_ibm_table[ crc16_table_index ] = crc16;
+	}
+	libodraw_checksum_crc16_ibm_table_computed = 1;
+}
+
+/* Calculates the CRC-16 IBM of a buffer
+ * This is the non-reflected variant (polynomial 0x8005) as used by FLAC frames
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_checksum_calculate_crc16_ibm(
+     uint16_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint16_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function  = "libodraw_checksum_calculate_crc16_ibm";
+	size_t buffer_offset   = 0;
+	uint16_t safe_checksum = 0;
+	uint8_t table_index    = 0;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_checksum_crc16_ibm_table_computed == 0 )
+	{
+		libodraw_checksum_initialize_crc16_ibm_table(
+		 0x8005 );
+	}
+	safe_checksum = initial_value;
+
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset++ )
+	{
+		table_index = (uint8_t) ( ( safe_checksum >> 8 ) ^ buffer[ buffer_offset ] );
+
+		safe_checksum = (uint16_t) ( ( safe_checksum << 8 ) ^ libodraw_checksum_crc16_ibm_table[ table_index ] );
+	}
+	*checksum_value = safe_checksum;
+
+	return( 1 );
+}
+
+/* Initializes the internal EDC table
+ * The table speeds up the EDC calculation
+ */
+void libodraw_checksum_initialize_edc_table(
+      uint32_t polynomial )
+{
+	uint32_t edc             = 0;
+	uint32_t edc_table_index = 0;
+	uint8_t bit_iterator     = 0;
+
+	for( edc_table_index = 0;
+	     edc_table_index < 256;
+	     edc_table_index++ )
+	{
+		edc = edc_table_index;
+
+		for( bit_iterator = 0;
+		     bit_iterator < 8;
+		     bit_iterator++ )
+		{
+			if( ( edc & 1 ) != 0 )
+			{
+				edc = ( edc >> 1 ) ^ polynomial;
+			}
+			else
+			{
+				edc = edc >> 1;
+			}
+		}
+		libodraw_checksum_edc_table[ edc_table_index ] = edc;
+	}
+	libodraw_checksum_edc_table_computed = 1;
+}
+
+/* Calculates the EDC of a buffer
+ * This is the reflected CRC-32 (polynomial 0x8001801b) of the CD-ROM sector
+ * error detection code, which is stored little-endian
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_checksum_calculate_edc(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function  = "libodraw_checksum_calculate_edc";
+	size_t buffer_offset   = 0;
+	uint32_t safe_checksum = 0;
+	uint8_t table_index    = 0;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_checksum_edc_table_computed == 0 )
+	{
+		libodraw_checksum_initialize_edc_table(
+		 0xd8018001UL );
+	}
+	safe_checksum = initial_value;
+
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset++ )
+	{
+		table_index = (uint8_t) ( ( safe_checksum ^ buffer[ buffer_offset ] ) & 0xff );
+
+		safe_checksum = ( safe_checksum >> 8 ) ^ libodraw_checksum_edc_table[ table_index ];
+	}
+	*checksum_value = safe_checksum;
+
+	return( 1 );
+}
+
+/* Initializes the internal ECC tables
+ */
+void libodraw_checksum_initialize_ecc_tables(
+      void )
+{
+	uint16_t table_index = 0;
+	uint16_t value       = 0;
+
+	for( table_index = 0;
+	     table_index < 256;
+	     table_index++ )
+	{
+		value = (uint16_t) ( table_index << 1 );
+
+		if( ( table_index & 0x80 ) != 0 )
+		{
+			value ^= 0x011d;
+		}
+		libodraw_checksum_ecc_forward_table[ table_index ] = (uint8_t) value;
+
+		libodraw_checksum_ecc_backward_table[ table_index ^ value ] = (uint8_t) table_index;
+	}
+	libodraw_checksum_ecc_tables_computed = 1;
+}
+
+/* Calculates the P or Q parity of the CD-ROM Reed-Solomon Product Code (RSPC)
+ * The parity is calculated over the data starting at the sector header
+ */
+void libodraw_checksum_calculate_ecc_parity(
+      const uint8_t *data,
+      uint16_t major_count,
+      uint16_t minor_count,
+      uint16_t major_multiplier,
+      uint16_t minor_increment,
+      uint8_t *parity )
+{
+	uint16_t data_index = 0;
+	uint16_t data_size  = 0;
+	uint16_t major      = 0;
+	uint16_t minor      = 0;
+	uint8_t ecc_a       = 0;
+	uint8_t ecc_b       = 0;
+
+	data_size = major_count * minor_count;
+
+	for( major = 0;
+	     major < major_count;
+	     major++ )
+	{
+		data_index = ( ( major >> 1 ) * major_multiplier ) + ( major & 1 );
+		ecc_a      = 0;
+		ecc_b      = 0;
+
+		for( minor = 0;
+		     minor < minor_count;
+		     minor++ )
+		{
+			ecc_a ^= data[ data_index ];
+			ecc_b ^= data[ data_index ];
+			ecc_a  = libodraw_checksum_ecc_forward_table[ ecc_a ];
+
+			data_index += minor_increment;
+
+			if( data_index >= data_size )
+			{
+				data_index -= data_size;
+			}
+		}
+		ecc_a = libodraw_checksum_ecc_backward_table[ libodraw_checksum_ecc_forward_table[ ecc_a ] ^ ecc_b ];
+
+		parity[ major ]               = ecc_a;
+		parity[ major + major_count ] = ecc_a ^ ecc_b;
+	}
+}
+
+/* Calculates the ECC of a 2352 bytes per sector mode 1 sector
+ * The P and Q parity are calculated over the sector header, data and EDC
+ * and are stored in the sector data at offsets 2076 and 2248
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_checksum_calculate_ecc(
+     uint8_t *sector_data,
+     size_t sector_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_checksum_calculate_ecc";
+
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data_size < 2352 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid sector data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_checksum_ecc_tables_computed == 0 )
+	{
+		libodraw_checksum_initialize_ecc_tables();
+	}
+	/* The P parity: 86 columns of 24 bytes
+	 */
+	libodraw_checksum_calculate_ecc_parity(
+	 &( sector_data[ 12 ] ),
+	 86,
+	 24,
+	 2,
+	 86,
+	 &( sector_data[ 2076 ] ) );
+
+	/* The Q parity: 52 diagonals of 43 bytes, which includes the P parity
+	 */
+	libodraw_checksum_calculate_ecc_parity(
+	 &( sector_data[ 12 ] ),
+	 52,
+	 43,
+	 86,
+	 88,
+	 &( sector_data[ 2248 ] ) );
+
+	return( 1 );
+}
+
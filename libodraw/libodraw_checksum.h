@@ -0,0 +1,95 @@
+/*
+ * Checksum functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_CHECKSUM_H )
+#define _LIBODRAW_CHECKSUM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+void libodraw_checksum_initialize_crc16_table(
+      uint16_t polynomial );
+
+int libodraw_checksum_calculate_crc16(
+     uint16_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint16_t initial_value,
+     libcerror_error_t **error );
+
+void libodraw_checksum_initialize_crc8_table(
+      uint8_t polynomial );
+
+int libodraw_checksum_calculate_crc8(
+     uint8_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint8_t initial_value,
+     libcerror_error_t **error );
+
+void libodraw_checksum_initialize_crc16_ibm_table(
+      uint16_t polynomial );
+
+int libodraw_checksum_calculate_crc16_ibm(
+     uint16_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint16_t initial_value,
+     libcerror_error_t **error );
+
+void libodraw_checksum_initialize_edc_table(
+      uint32_t polynomial );
+
+int libodraw_checksum_calculate_edc(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+void libodraw_checksum_initialize_ecc_tables(
+      void );
+
+void libodraw_checksum_calculate_ecc_parity(
+      const uint8_t *data,
+      uint16_t major_count,
+      uint16_t minor_count,
+      uint16_t major_multiplier,
+      uint16_t minor_increment,
+      uint8_t *parity );
+
+int libodraw_checksum_calculate_ecc(
+     uint8_t *sector_data,
+     size_t sector_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_CHECKSUM_H ) */
+
@@ -0,0 +1,344 @@
+/*
+ * Compression functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+#include <zlib.h>
+#endif
+
+#if defined( HAVE_LIBLZMA )
+#include <lzma.h>
+#endif
+
+#if defined( HAVE_LIBZSTD )
+#include <zstd.h>
+#endif
+
+#include "libodraw_compression.h"
+#include "libodraw_definitions.h"
+#include "libodraw_libcerror.h"
+
+/* Decompresses data using the compression method
+ * The uncompressed data must fill the uncompressed data buffer entirely
+ * Returns 1 on success or -1 on error
+ */
+int libodraw_decompress_data(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int compression_method,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+	z_stream zlib_stream;
+#endif
+#if defined( HAVE_LIBLZMA )
+	lzma_filter lzma_filters[ 2 ];
+	lzma_options_lzma lzma_options;
+	lzma_stream lzma_stream_value = LZMA_STREAM_INIT;
+	lzma_ret lzma_result          = LZMA_OK;
+#endif
+#if defined( HAVE_LIBZSTD )
+	size_t zstd_result            = 0;
+#endif
+
+	static char *function         = "libodraw_decompress_data";
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL ) || defined( HAVE_LIBLZMA )
+	int result                    = 0;
+#endif
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_method == LIBODRAW_COMPRESSION_METHOD_DEFLATE )
+	{
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+		if( memory_set(
+		     &zlib_stream,
+		     0,
+		     sizeof( z_stream ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear zlib stream.",
+			 function );
+
+			return( -1 );
+		}
+		zlib_stream.next_in   = (Bytef *) compressed_data;
+		zlib_stream.avail_in  = (uInt) compressed_data_size;
+		zlib_stream.next_out  = (Bytef *) uncompressed_data;
+		zlib_stream.avail_out = (uInt) uncompressed_data_size;
+
+		/* The data is stored as a raw deflate stream without a zlib header
+		 */
+		if( inflateInit2(
+		     &zlib_stream,
+		     -MAX_WBITS ) != Z_OK )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize zlib stream.",
+			 function );
+
+			return( -1 );
+		}
+		result = inflate(
+		          &zlib_stream,
+		          Z_FINISH );
+
+		if( ( result == Z_STREAM_END )
+		 || ( result == Z_OK )
+		 || ( result == Z_BUF_ERROR ) )
+		{
+			result = 1;
+		}
+		else
+		{
+			result = -1;
+		}
+		if( ( result == 1 )
+		 && ( zlib_stream.total_out != (uLong) uncompressed_data_size ) )
+		{
+			result = -1;
+		}
+		inflateEnd(
+		 &zlib_stream );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress deflate compressed data.",
+			 function );
+
+			return( -1 );
+		}
+#else
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: deflate compression not supported.",
+		 function );
+
+		return( -1 );
+#endif /* defined( HAVE_ZLIB ) || defined( ZLIB_DLL ) */
+	}
+	else if( compression_method == LIBODRAW_COMPRESSION_METHOD_LZMA )
+	{
+#if defined( HAVE_LIBLZMA )
+		if( lzma_lzma_preset(
+		     &lzma_options,
+		     9 ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize LZMA options.",
+			 function );
+
+			return( -1 );
+		}
+		/* The data is stored as a raw LZMA stream without properties
+		 * the literal context, literal position and position bits are
+		 * the encoder defaults and the dictionary only needs to cover
+		 * the uncompressed data
+		 */
+		lzma_options.dict_size = (uint32_t) uncompressed_data_size;
+
+		if( lzma_options.dict_size < LZMA_DICT_SIZE_MIN )
+		{
+			lzma_options.dict_size = LZMA_DICT_SIZE_MIN;
+		}
+		lzma_options.lc = 3;
+		lzma_options.lp = 0;
+		lzma_options.pb = 2;
+
+		lzma_filters[ 0 ].id      = LZMA_FILTER_LZMA1;
+		lzma_filters[ 0 ].options = &lzma_options;
+		lzma_filters[ 1 ].id      = LZMA_VLI_UNKNOWN;
+		lzma_filters[ 1 ].options = NULL;
+
+		if( lzma_raw_decoder(
+		     &lzma_stream_value,
+		     lzma_filters ) != LZMA_OK )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize LZMA stream.",
+			 function );
+
+			return( -1 );
+		}
+		lzma_stream_value.next_in   = compressed_data;
+		lzma_stream_value.avail_in  = compressed_data_size;
+		lzma_stream_value.next_out  = uncompressed_data;
+		lzma_stream_value.avail_out = uncompressed_data_size;
+
+		/* The stream has no end of stream marker, decoding stops
+		 * when the uncompressed data buffer is filled
+		 */
+		lzma_result = lzma_code(
+		               &lzma_stream_value,
+		               LZMA_RUN );
+
+		if( ( ( lzma_result == LZMA_OK )
+		  || ( lzma_result == LZMA_STREAM_END ) )
+		 && ( lzma_stream_value.avail_out == 0 ) )
+		{
+			result = 1;
+		}
+		else
+		{
+			result = -1;
+		}
+		lzma_end(
+		 &lzma_stream_value );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress LZMA compressed data.",
+			 function );
+
+			return( -1 );
+		}
+#else
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: LZMA compression not supported.",
+		 function );
+
+		return( -1 );
+#endif /* defined( HAVE_LIBLZMA ) */
+	}
+	else if( compression_method == LIBODRAW_COMPRESSION_METHOD_ZSTD )
+	{
+#if defined( HAVE_LIBZSTD )
+		/* The compressed data is a single zstd frame that must
+		 * decompress to exactly the uncompressed data size
+		 */
+		zstd_result = ZSTD_decompress(
+		               uncompressed_data,
+		               uncompressed_data_size,
+		               compressed_data,
+		               compressed_data_size );
+
+		if( ( ZSTD_isError(
+		       zstd_result ) != 0 )
+		 || ( zstd_result != uncompressed_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress zstd compressed data.",
+			 function );
+
+			return( -1 );
+		}
+#else
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: zstd compression not supported.",
+		 function );
+
+		return( -1 );
+#endif /* defined( HAVE_LIBZSTD ) */
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression method: %d.",
+		 function,
+		 compression_method );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,2256 @@
+/*
+ * Hand-written CUE reader functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libodraw_cue_reader.h"
+#include "libodraw_definitions.h"
+#include "libodraw_handle.h"
+#include "libodraw_libcerror.h"
+
+/* The character classes used by the tokenizer
+ */
+#define LIBODRAW_CUE_READER_CHARACTER_UNQUOTED		0x01
+#define LIBODRAW_CUE_READER_CHARACTER_KEYWORD		0x02
+#define LIBODRAW_CUE_READER_CHARACTER_DIGIT		0x04
+#define LIBODRAW_CUE_READER_CHARACTER_ALPHANUMERIC	0x08
+#define LIBODRAW_CUE_READER_CHARACTER_WHITE_SPACE	0x10
+#define LIBODRAW_CUE_READER_CHARACTER_PRINTABLE		0x20
+
+/* The maximum number of characters in a quoted string
+ */
+#define LIBODRAW_CUE_READER_MAXIMUM_STRING_LENGTH	256
+
+/* The character class of every byte value, these match the definitions in libodraw_cue_scanner.l
+ * Note that flex has no \c and \e escape sequences, hence its white space class also contains 'c' and 'e'
+ */
+static const uint8_t libodraw_cue_reader_character_classes[ 256 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x30, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x30, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x23,
+	0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+	0x21, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+	0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x21, 0x21, 0x21, 0x21, 0x23,
+	0x21, 0x29, 0x29, 0x39, 0x29, 0x39, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+	0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x21, 0x21, 0x21, 0x21, 0x00,
+	0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+	0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+	0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+	0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+	0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+	0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+	0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+	0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21
+};
+
+typedef struct libodraw_cue_reader_keyword libodraw_cue_reader_keyword_t;
+
+struct libodraw_cue_reader_keyword
+{
+	/* The string
+	 */
+	const char *string;
+
+	/* The string length
+	 */
+	size_t length;
+
+	/* The token type
+	 */
+	int token_type;
+};
+
+/* The reserved words that consist of a single word
+ */
+static const libodraw_cue_reader_keyword_t libodraw_cue_reader_keywords[] = {
+	{ "ARRANGER", 8, LIBODRAW_CUE_READER_TOKEN_CDTEXT_ARRANGER },
+	{ "CATALOG", 7, LIBODRAW_CUE_READER_TOKEN_CATALOG },
+	{ "CD_DA", 5, LIBODRAW_CUE_READER_TOKEN_CD_DA },
+	{ "CD_ROM", 6, LIBODRAW_CUE_READER_TOKEN_CD_ROM },
+	{ "CD_ROM_XA", 9, LIBODRAW_CUE_READER_TOKEN_CD_ROM_XA },
+	{ "CD_TEXT", 7, LIBODRAW_CUE_READER_TOKEN_CD_TEXT },
+	{ "CDTEXTFILE", 10, LIBODRAW_CUE_READER_TOKEN_CDTEXTFILE },
+	{ "COMPOSER", 8, LIBODRAW_CUE_READER_TOKEN_CDTEXT_COMPOSER },
+	{ "COPY", 4, LIBODRAW_CUE_READER_TOKEN_COPY },
+	{ "DATAFILE", 8, LIBODRAW_CUE_READER_TOKEN_DATAFILE },
+	{ "DISC_ID", 7, LIBODRAW_CUE_READER_TOKEN_CDTEXT_DISC_ID },
+	{ "FILE", 4, LIBODRAW_CUE_READER_TOKEN_FILE },
+	{ "FLAGS", 5, LIBODRAW_CUE_READER_TOKEN_FLAGS },
+	{ "FOUR_CHANNEL_AUDIO", 18, LIBODRAW_CUE_READER_TOKEN_FOUR_CHANNEL_AUDIO },
+	{ "GENRE", 5, LIBODRAW_CUE_READER_TOKEN_CDTEXT_GENRE },
+	{ "INDEX", 5, LIBODRAW_CUE_READER_TOKEN_INDEX },
+	{ "ISRC", 4, LIBODRAW_CUE_READER_TOKEN_ISRC },
+	{ "MESSAGE", 7, LIBODRAW_CUE_READER_TOKEN_CDTEXT_MESSAGE },
+	{ "PERFORMER", 9, LIBODRAW_CUE_READER_TOKEN_CDTEXT_PERFORMER },
+	{ "POSTGAP", 7, LIBODRAW_CUE_READER_TOKEN_POSTGAP },
+	{ "PRE_EMPHASIS", 12, LIBODRAW_CUE_READER_TOKEN_PRE_EMPHASIS },
+	{ "PREGAP", 6, LIBODRAW_CUE_READER_TOKEN_PREGAP },
+	{ "SIZE_INFO", 9, LIBODRAW_CUE_READER_TOKEN_CDTEXT_SIZE_INFO },
+	{ "SONGWRITER", 10, LIBODRAW_CUE_READER_TOKEN_CDTEXT_SONGWRITER },
+	{ "TITLE", 5, LIBODRAW_CUE_READER_TOKEN_CDTEXT_TITLE },
+	{ "TOC_INFO1", 9, LIBODRAW_CUE_READER_TOKEN_CDTEXT_TOC_INFO1 },
+	{ "TOC_INFO2", 9, LIBODRAW_CUE_READER_TOKEN_CDTEXT_TOC_INFO2 },
+	{ "TRACK", 5, LIBODRAW_CUE_READER_TOKEN_TRACK },
+	{ "TWO_CHANNEL_AUDIO", 17, LIBODRAW_CUE_READER_TOKEN_TWO_CHANNEL_AUDIO },
+	{ "UPC_EAN", 7, LIBODRAW_CUE_READER_TOKEN_CDTEXT_UPC_EAN },
+	{ NULL, 0, LIBODRAW_CUE_READER_TOKEN_UNDEFINED } };
+
+/* The value parsing functions are shared with the bison based CUE parser
+ */
+extern \
+int libodraw_cue_parser_parse_number(
+     const char *token,
+     size_t token_size,
+     int *number,
+     libcerror_error_t **error );
+
+extern \
+int libodraw_cue_parser_parse_msf(
+     const char *token,
+     size_t token_size,
+     uint64_t *lba,
+     libcerror_error_t **error );
+
+extern \
+int libodraw_cue_parser_parse_track_type(
+     const char *token,
+     size_t token_size,
+     uint8_t *track_type,
+     libcerror_error_t **error );
+
+/* Determines the length of a quoted string
+ * The string can contain at most 256 characters, where \" or \' counts as a single character
+ * Returns the length including the quotes or 0 if the data does not start with a valid quoted string
+ */
+size_t libodraw_cue_reader_get_quoted_string_length(
+        const char *data,
+        size_t data_size )
+{
+	size_t data_offset          = 1;
+	size_t number_of_characters = 0;
+	size_t string_length        = 0;
+	char quote                  = 0;
+
+	if( ( data == NULL )
+	 || ( data_size < 2 ) )
+	{
+		return( 0 );
+	}
+	quote = data[ 0 ];
+
+	while( data_offset < data_size )
+	{
+		if( data[ data_offset ] == quote )
+		{
+			string_length = data_offset + 1;
+
+			/* An escaped quote does not need to end the string
+			 */
+			if( data[ data_offset - 1 ] != '\\' )
+			{
+				break;
+			}
+		}
+		else if( ( libodraw_cue_reader_character_classes[ (uint8_t) data[ data_offset ] ] & LIBODRAW_CUE_READER_CHARACTER_PRINTABLE ) == 0 )
+		{
+			break;
+		}
+		else
+		{
+			number_of_characters++;
+
+			if( number_of_characters > LIBODRAW_CUE_READER_MAXIMUM_STRING_LENGTH )
+			{
+				break;
+			}
+		}
+		data_offset++;
+	}
+	return( string_length );
+}
+
+/* Retrieves the next token
+ * The token data points into the buffer, no data is copied
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_cue_reader_get_token(
+     const char *buffer,
+     size_t buffer_size,
+     size_t *buffer_offset,
+     libodraw_cue_reader_token_t *token,
+     libcerror_error_t **error )
+{
+	const libodraw_cue_reader_keyword_t *keyword = NULL;
+	const char *data                             = NULL;
+	static char *function                        = "libodraw_cue_reader_get_token";
+	size_t data_size                             = 0;
+	size_t safe_buffer_offset                    = 0;
+	size_t string_length                         = 0;
+	size_t value_index                           = 0;
+	size_t white_space_length                    = 0;
+	size_t word_length                           = 0;
+	uint8_t character_class                      = 0;
+	uint8_t word_class                           = 0;
+	int token_type                               = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid token.",
+		 function );
+
+		return( -1 );
+	}
+	safe_buffer_offset = *buffer_offset;
+
+	token->type   = LIBODRAW_CUE_READER_TOKEN_END_OF_FILE;
+	token->data   = NULL;
+	token->length = 0;
+
+	/* Like the flex based scanner the longest match determines the token
+	 */
+	while( safe_buffer_offset < buffer_size )
+	{
+		data      = &( buffer[ safe_buffer_offset ] );
+		data_size = buffer_size - safe_buffer_offset;
+
+		/* REM followed by white space starts a remark, LEAD-OUT, ORIGINAL MEDIA-TYPE:, RUN-OUT
+		 * and SESSION are handled as part of the remark
+		 */
+		if( ( data_size > 3 )
+		 && ( data[ 0 ] == 'R' )
+		 && ( data[ 1 ] == 'E' )
+		 && ( data[ 2 ] == 'M' )
+		 && ( ( data[ 3 ] == ' ' )
+		  ||  ( data[ 3 ] == '\t' ) ) )
+		{
+			string_length = 4;
+
+			while( ( string_length < data_size )
+			    && ( ( data[ string_length ] == ' ' )
+			     ||  ( data[ string_length ] == '\t' ) ) )
+			{
+				string_length++;
+			}
+			token_type = LIBODRAW_CUE_READER_TOKEN_REMARK;
+
+			if( ( ( data_size - string_length ) >= 8 )
+			 && ( narrow_string_compare(
+			       &( data[ string_length ] ),
+			       "LEAD-OUT",
+			       8 ) == 0 ) )
+			{
+				token_type     = LIBODRAW_CUE_READER_TOKEN_REMARK_LEAD_OUT;
+				string_length += 8;
+			}
+			else if( ( ( data_size - string_length ) >= 7 )
+			      && ( narrow_string_compare(
+			            &( data[ string_length ] ),
+			            "RUN-OUT",
+			            7 ) == 0 ) )
+			{
+				token_type     = LIBODRAW_CUE_READER_TOKEN_REMARK_RUN_OUT;
+				string_length += 7;
+			}
+			else if( ( ( data_size - string_length ) >= 7 )
+			      && ( narrow_string_compare(
+			            &( data[ string_length ] ),
+			            "SESSION",
+			            7 ) == 0 ) )
+			{
+				token_type     = LIBODRAW_CUE_READER_TOKEN_REMARK_SESSION;
+				string_length += 7;
+			}
+			else if( ( ( data_size - string_length ) >= 9 )
+			      && ( narrow_string_compare(
+			            &( data[ string_length ] ),
+			            "ORIGINAL",
+			            8 ) == 0 )
+			      && ( ( data[ string_length + 8 ] == ' ' )
+			       ||  ( data[ string_length + 8 ] == '\t' ) ) )
+			{
+				value_index = string_length + 9;
+
+				while( ( value_index < data_size )
+				    && ( ( data[ value_index ] == ' ' )
+				     ||  ( data[ value_index ] == '\t' ) ) )
+				{
+					value_index++;
+				}
+				if( ( ( data_size - value_index ) >= 11 )
+				 && ( narrow_string_compare(
+				       &( data[ value_index ] ),
+				       "MEDIA-TYPE:",
+				       11 ) == 0 ) )
+				{
+					token_type    = LIBODRAW_CUE_READER_TOKEN_REMARK_ORIGINAL_MEDIA_TYPE;
+					string_length = value_index + 11;
+				}
+			}
+			token->type    = token_type;
+			*buffer_offset = safe_buffer_offset + string_length;
+
+			return( 1 );
+		}
+		if( ( data_size >= 7 )
+		 && ( data[ 0 ] == 'N' )
+		 && ( data[ 1 ] == 'O' )
+		 && ( data[ 2 ] == ' ' ) )
+		{
+			if( ( data_size >= 15 )
+			 && ( narrow_string_compare(
+			       &( data[ 3 ] ),
+			       "PRE_EMPHASIS",
+			       12 ) == 0 ) )
+			{
+				token->type    = LIBODRAW_CUE_READER_TOKEN_NO_PRE_EMPHASIS;
+				*buffer_offset = safe_buffer_offset + 15;
+
+				return( 1 );
+			}
+			else if( narrow_string_compare(
+			          &( data[ 3 ] ),
+			          "COPY",
+			          4 ) == 0 )
+			{
+				token->type    = LIBODRAW_CUE_READER_TOKEN_NO_COPY;
+				*buffer_offset = safe_buffer_offset + 7;
+
+				return( 1 );
+			}
+		}
+		/* Comments start with "; " or "// " and are ignored
+		 */
+		string_length = 0;
+
+		if( ( data_size >= 2 )
+		 && ( data[ 0 ] == ';' )
+		 && ( data[ 1 ] == ' ' ) )
+		{
+			string_length = 2;
+		}
+		else if( ( data_size >= 3 )
+		      && ( data[ 0 ] == '/' )
+		      && ( data[ 1 ] == '/' )
+		      && ( data[ 2 ] == ' ' ) )
+		{
+			string_length = 3;
+		}
+		if( string_length > 0 )
+		{
+			while( ( string_length < data_size )
+			    && ( ( libodraw_cue_reader_character_classes[ (uint8_t) data[ string_length ] ] & LIBODRAW_CUE_READER_CHARACTER_PRINTABLE ) != 0 ) )
+			{
+				string_length++;
+			}
+			safe_buffer_offset += string_length;
+
+			continue;
+		}
+		word_class  = 0xff;
+		word_length = 0;
+
+		while( word_length < data_size )
+		{
+			character_class = libodraw_cue_reader_character_classes[ (uint8_t) data[ word_length ] ];
+
+			if( ( character_class & LIBODRAW_CUE_READER_CHARACTER_UNQUOTED ) == 0 )
+			{
+				break;
+			}
+			word_class &= character_class;
+
+			word_length++;
+		}
+		if( ( data[ 0 ] == '"' )
+		 || ( data[ 0 ] == '\'' ) )
+		{
+			string_length = libodraw_cue_reader_get_quoted_string_length(
+			                 data,
+			                 data_size );
+
+			if( ( string_length > 0 )
+			 && ( string_length >= word_length ) )
+			{
+				token->type = LIBODRAW_CUE_READER_TOKEN_STRING;
+
+				if( string_length > 2 )
+				{
+					token->data   = &( data[ 1 ] );
+					token->length = string_length - 2;
+				}
+				*buffer_offset = safe_buffer_offset + string_length;
+
+				return( 1 );
+			}
+		}
+		white_space_length = 0;
+
+		while( ( white_space_length < data_size )
+		    && ( ( libodraw_cue_reader_character_classes[ (uint8_t) data[ white_space_length ] ] & LIBODRAW_CUE_READER_CHARACTER_WHITE_SPACE ) != 0 ) )
+		{
+			white_space_length++;
+		}
+		if( white_space_length > word_length )
+		{
+			safe_buffer_offset += white_space_length;
+
+			continue;
+		}
+		if( word_length == 0 )
+		{
+			if( ( data[ 0 ] == '\n' )
+			 || ( data[ 0 ] == '\r' ) )
+			{
+				token->type = LIBODRAW_CUE_READER_TOKEN_END_OF_LINE;
+			}
+			else
+			{
+				token->type   = LIBODRAW_CUE_READER_TOKEN_UNDEFINED;
+				token->data   = data;
+				token->length = 1;
+			}
+			*buffer_offset = safe_buffer_offset + 1;
+
+			return( 1 );
+		}
+		*buffer_offset = safe_buffer_offset + word_length;
+
+		/* The | character is part of the end-of-line character class of the flex based scanner
+		 */
+		if( ( word_length == 1 )
+		 && ( data[ 0 ] == '|' ) )
+		{
+			token->type = LIBODRAW_CUE_READER_TOKEN_END_OF_LINE;
+
+			return( 1 );
+		}
+		token->data   = data;
+		token->length = word_length;
+
+		if( ( word_class & LIBODRAW_CUE_READER_CHARACTER_KEYWORD ) != 0 )
+		{
+			for( keyword = libodraw_cue_reader_keywords;
+			     keyword->string != NULL;
+			     keyword++ )
+			{
+				if( ( keyword->length == word_length )
+				 && ( keyword->string[ 0 ] == data[ 0 ] )
+				 && ( narrow_string_compare(
+				       keyword->string,
+				       data,
+				       word_length ) == 0 ) )
+				{
+					token->type   = keyword->token_type;
+					token->data   = NULL;
+					token->length = 0;
+
+					return( 1 );
+				}
+			}
+		}
+		if( ( word_length == 13 )
+		 && ( ( word_class & LIBODRAW_CUE_READER_CHARACTER_DIGIT ) != 0 ) )
+		{
+			token->type = LIBODRAW_CUE_READER_TOKEN_CATALOG_NUMBER;
+
+			return( 1 );
+		}
+		if( word_length == 12 )
+		{
+			for( value_index = 0;
+			     value_index < 12;
+			     value_index++ )
+			{
+				character_class = libodraw_cue_reader_character_classes[ (uint8_t) data[ value_index ] ];
+
+				if( ( ( value_index < 5 )
+				  &&  ( ( character_class & LIBODRAW_CUE_READER_CHARACTER_ALPHANUMERIC ) == 0 ) )
+				 || ( ( value_index >= 5 )
+				  &&  ( ( character_class & LIBODRAW_CUE_READER_CHARACTER_DIGIT ) == 0 ) ) )
+				{
+					break;
+				}
+			}
+			if( value_index == 12 )
+			{
+				token->type = LIBODRAW_CUE_READER_TOKEN_ISRC_CODE;
+
+				return( 1 );
+			}
+		}
+		if( ( word_length == 8 )
+		 && ( data[ 2 ] == ':' )
+		 && ( data[ 5 ] == ':' ) )
+		{
+			for( value_index = 0;
+			     value_index < 8;
+			     value_index++ )
+			{
+				if( ( value_index != 2 )
+				 && ( value_index != 5 )
+				 && ( ( libodraw_cue_reader_character_classes[ (uint8_t) data[ value_index ] ] & LIBODRAW_CUE_READER_CHARACTER_DIGIT ) == 0 ) )
+				{
+					break;
+				}
+			}
+			if( value_index == 8 )
+			{
+				token->type = LIBODRAW_CUE_READER_TOKEN_MSF;
+
+				return( 1 );
+			}
+		}
+		if( ( word_length == 2 )
+		 && ( ( word_class & LIBODRAW_CUE_READER_CHARACTER_DIGIT ) != 0 ) )
+		{
+			token->type = LIBODRAW_CUE_READER_TOKEN_2DIGIT;
+		}
+		else if( ( word_class & LIBODRAW_CUE_READER_CHARACTER_KEYWORD ) != 0 )
+		{
+			token->type = LIBODRAW_CUE_READER_TOKEN_KEYWORD_STRING;
+		}
+		else
+		{
+			token->type = LIBODRAW_CUE_READER_TOKEN_STRING;
+		}
+		return( 1 );
+	}
+	*buffer_offset = safe_buffer_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the next token and checks if it is of the expected type
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_cue_reader_get_expected_token(
+     libodraw_cue_reader_state_t *state,
+     int token_type,
+     libodraw_cue_reader_token_t *token,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_cue_reader_get_expected_token";
+	size_t token_offset   = 0;
+
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	token_offset = state->buffer_offset;
+
+	if( libodraw_cue_reader_get_token(
+	     state->buffer,
+	     state->buffer_size,
+	     &( state->buffer_offset ),
+	     token,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve token.",
+		 function );
+
+		return( -1 );
+	}
+	if( token->type != token_type )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported token: %d after offset: %" PRIzd ", expected: %d.",
+		 function,
+		 token->type,
+		 token_offset,
+		 token_type );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Processes a FILE command
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_cue_reader_process_file(
+     libodraw_cue_reader_state_t *state,
+     const libodraw_cue_reader_token_t *filename_token,
+     const libodraw_cue_reader_token_t *file_type_token,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_cue_reader_process_file";
+
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename token.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_type_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file type token.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_token->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_type_token->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file type.",
+		 function );
+
+		return( -1 );
+	}
+	state->file_type = LIBODRAW_FILE_TYPE_UNKNOWN;
+
+	if( file_type_token->length == 3 )
+	{
+		if( narrow_string_compare(
+		     file_type_token->data,
+		     "MP3",
+		     3 ) == 0 )
+		{
+			state->file_type = LIBODRAW_FILE_TYPE_AUDIO_MPEG1_LAYER3;
+		}
+	}
+	else if( file_type_token->length == 4 )
+	{
+		if( narrow_string_compare(
+		     file_type_token->data,
+		     "AIFF",
+		     4 ) == 0 )
+		{
+			state->file_type = LIBODRAW_FILE_TYPE_AUDIO_AIFF;
+		}
+		else if( narrow_string_compare(
+		          file_type_token->data,
+		          "WAVE",
+		          4 ) == 0 )
+		{
+			state->file_type = LIBODRAW_FILE_TYPE_AUDIO_WAVE;
+		}
+	}
+	else if( file_type_token->length == 6 )
+	{
+		if( narrow_string_compare(
+		     file_type_token->data,
+		     "BINARY",
+		     6 ) == 0 )
+		{
+			state->file_type = LIBODRAW_FILE_TYPE_BINARY_LITTLE_ENDIAN;
+		}
+	}
+	else if( file_type_token->length == 8 )
+	{
+		if( narrow_string_compare(
+		     file_type_token->data,
+		     "MOTOROLA",
+		     8 ) == 0 )
+		{
+			state->file_type = LIBODRAW_FILE_TYPE_BINARY_BIG_ENDIAN;
+		}
+	}
+	if( libodraw_handle_append_data_file(
+	     state->handle,
+	     filename_token->data,
+	     filename_token->length,
+	     state->file_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append data file.",
+		 function );
+
+		return( -1 );
+	}
+	state->current_file_index += 1;
+
+	return( 1 );
+}
+
+/* Processes an INDEX command
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_cue_reader_process_index(
+     libodraw_cue_reader_state_t *state,
+     const libodraw_cue_reader_token_t *index_token,
+     const libodraw_cue_reader_token_t *msf_token,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_cue_reader_process_index";
+
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index token.",
+		 function );
+
+		return( -1 );
+	}
+	if( msf_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MSF token.",
+		 function );
+
+		return( -1 );
+	}
+	state->previous_index = state->current_index;
+
+	if( libodraw_cue_parser_parse_number(
+	     index_token->data,
+	     index_token->length,
+	     &( state->current_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to parse index number.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( state->current_index != 0 )
+	 && ( state->current_index != ( state->previous_index + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported index number - values are not sequential.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_cue_parser_parse_msf(
+	     msf_token->data,
+	     msf_token->length,
+	     &( state->current_start_sector ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to parse index MSF.",
+		 function );
+
+		return( -1 );
+	}
+	/* The MSF can be relative to the start of the file
+	 */
+	if( state->current_start_sector != 0 )
+	{
+		if( ( state->current_index == 0 )
+		 || ( state->current_index == 1 ) )
+		{
+			if( ( state->session_number_of_sectors == 0 )
+			 || ( state->previous_track_type == LIBODRAW_TRACK_TYPE_AUDIO ) )
+			{
+				if( state->current_start_sector < state->previous_session_start_sector )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid session start sector value precedes previous.",
+					 function );
+
+					return( -1 );
+				}
+				state->session_number_of_sectors = state->current_start_sector
+				                                 - state->previous_session_start_sector;
+			}
+			if( ( state->lead_out_number_of_sectors == 0 )
+			 || ( state->previous_track_type == LIBODRAW_TRACK_TYPE_AUDIO ) )
+			{
+				if( state->current_start_sector < state->previous_lead_out_start_sector )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid lead-out start sector value precedes previous.",
+					 function );
+
+					return( -1 );
+				}
+				state->lead_out_number_of_sectors = state->current_start_sector
+				                                  - state->previous_lead_out_start_sector;
+			}
+		}
+		if( state->current_index == 1 )
+		{
+			if( state->track_number_of_sectors == 0 )
+			{
+				if( state->current_start_sector < state->previous_track_start_sector )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid track start sector value precedes previous.",
+					 function );
+
+					return( -1 );
+				}
+				state->track_number_of_sectors = state->current_start_sector
+				                               - state->previous_track_start_sector;
+			}
+		}
+	}
+	if( state->current_index == 1 )
+	{
+		if( state->current_session > 1 )
+		{
+			if( libodraw_handle_append_session(
+			     state->handle,
+			     state->previous_session_start_sector,
+			     state->session_number_of_sectors,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append session.",
+				 function );
+
+				return( -1 );
+			}
+			state->previous_session_start_sector = state->current_start_sector;
+			state->session_number_of_sectors     = 0;
+		}
+		if( state->current_lead_out > state->previous_lead_out )
+		{
+			if( libodraw_handle_append_lead_out(
+			     state->handle,
+			     state->previous_lead_out_start_sector,
+			     state->lead_out_number_of_sectors,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append lead-out.",
+				 function );
+
+				return( -1 );
+			}
+			state->previous_lead_out          = state->current_lead_out;
+			state->lead_out_number_of_sectors = 0;
+		}
+		if( state->current_track > 1 )
+		{
+			if( state->previous_file_index < 0 )
+			{
+				state->file_sector = state->previous_track_start_sector;
+
+				state->previous_file_index += 1;
+			}
+			state->previous_file_sector = state->previous_track_start_sector
+			                            - state->file_sector;
+
+			if( libodraw_handle_append_track(
+			     state->handle,
+			     state->previous_track_start_sector,
+			     state->track_number_of_sectors,
+			     state->previous_track_type,
+			     state->previous_file_index,
+			     state->previous_file_sector,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append track.",
+				 function );
+
+				return( -1 );
+			}
+			if( state->previous_file_index < state->current_file_index )
+			{
+				state->file_sector = state->current_start_sector;
+
+				state->previous_file_index += 1;
+			}
+			state->previous_track_start_sector = state->current_start_sector;
+			state->track_number_of_sectors     = 0;
+		}
+	}
+	return( 1 );
+}
+
+/* Processes a DATAFILE command
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_cue_reader_process_datafile(
+     libodraw_cue_reader_state_t *state,
+     const libodraw_cue_reader_token_t *filename_token,
+     const libodraw_cue_reader_token_t *msf_token,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_cue_reader_process_datafile";
+
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename token.",
+		 function );
+
+		return( -1 );
+	}
+	if( msf_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MSF token.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_token->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_cue_parser_parse_msf(
+	     msf_token->data,
+	     msf_token->length,
+	     &( state->track_number_of_sectors ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to parse datafile MSF.",
+		 function );
+
+		return( -1 );
+	}
+	state->file_type = LIBODRAW_FILE_TYPE_BINARY_LITTLE_ENDIAN;
+
+	if( libodraw_handle_append_data_file(
+	     state->handle,
+	     filename_token->data,
+	     filename_token->length,
+	     state->file_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append data file.",
+		 function );
+
+		return( -1 );
+	}
+	if( state->previous_file_index < 0 )
+	{
+		state->file_sector = state->previous_track_start_sector;
+
+		state->previous_file_index += 1;
+	}
+	state->previous_file_sector = state->previous_track_start_sector
+	                            - state->file_sector;
+
+	if( libodraw_handle_append_track(
+	     state->handle,
+	     state->previous_track_start_sector,
+	     state->track_number_of_sectors,
+	     state->current_track_type,
+	     state->previous_file_index,
+	     state->previous_file_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append track.",
+		 function );
+
+		return( -1 );
+	}
+	state->current_file_index += 1;
+
+	return( 1 );
+}
+
+/* Processes a REM LEAD-OUT command
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_cue_reader_process_lead_out(
+     libodraw_cue_reader_state_t *state,
+     const libodraw_cue_reader_token_t *msf_token,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_cue_reader_process_lead_out";
+
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( msf_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MSF token.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_cue_parser_parse_msf(
+	     msf_token->data,
+	     msf_token->length,
+	     &( state->previous_lead_out_start_sector ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to parse lead-out MSF.",
+		 function );
+
+		return( -1 );
+	}
+	if( state->track_number_of_sectors == 0 )
+	{
+		if( state->previous_lead_out_start_sector < state->previous_track_start_sector )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid lead-out start sector value precedes previous track start sector.",
+			 function );
+
+			return( -1 );
+		}
+		state->track_number_of_sectors = state->previous_lead_out_start_sector
+		                               - state->previous_track_start_sector;
+	}
+	state->current_lead_out += 1;
+
+	return( 1 );
+}
+
+/* Processes a REM RUN-OUT command
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_cue_reader_process_run_out(
+     libodraw_cue_reader_state_t *state,
+     const libodraw_cue_reader_token_t *msf_token,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_cue_reader_process_run_out";
+
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( msf_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MSF token.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_cue_parser_parse_msf(
+	     msf_token->data,
+	     msf_token->length,
+	     &( state->current_start_sector ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to parse run-out MSF.",
+		 function );
+
+		return( -1 );
+	}
+	if( state->track_number_of_sectors == 0 )
+	{
+		if( state->current_start_sector < state->previous_track_start_sector )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid track start sector value precedes previous.",
+			 function );
+
+			return( -1 );
+		}
+		state->track_number_of_sectors = state->current_start_sector
+		                               - state->previous_track_start_sector;
+	}
+	return( 1 );
+}
+
+/* Processes a REM SESSION command
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_cue_reader_process_session(
+     libodraw_cue_reader_state_t *state,
+     const libodraw_cue_reader_token_t *session_token,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_cue_reader_process_session";
+
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( session_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid session token.",
+		 function );
+
+		return( -1 );
+	}
+	state->previous_session = state->current_session;
+
+	if( libodraw_cue_parser_parse_number(
+	     session_token->data,
+	     session_token->length,
+	     &( state->current_session ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to parse session number.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( state->current_session != 0 )
+	 && ( state->current_session != ( state->previous_session + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported session number - values are not sequential.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Processes a TRACK command
+ * The track token is NULL if the TRACK command has no track number
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_cue_reader_process_track(
+     libodraw_cue_reader_state_t *state,
+     const libodraw_cue_reader_token_t *track_token,
+     const libodraw_cue_reader_token_t *track_type_token,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_cue_reader_process_track";
+
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( track_type_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid track type token.",
+		 function );
+
+		return( -1 );
+	}
+	/* A TRACK command without a track number is used by single track TOC-style CUE files
+	 */
+	if( track_token == NULL )
+	{
+		if( state->current_track != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported track number - only single track supported.",
+			 function );
+
+			return( -1 );
+		}
+		state->previous_track_type = state->current_track_type;
+
+		if( libodraw_cue_parser_parse_track_type(
+		     track_type_token->data,
+		     track_type_token->length,
+		     &( state->current_track_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to parse track type.",
+			 function );
+
+			return( -1 );
+		}
+		state->previous_index = 0;
+		state->current_index  = 0;
+	}
+	else
+	{
+		state->previous_track = state->current_track;
+
+		if( libodraw_cue_parser_parse_number(
+		     track_token->data,
+		     track_token->length,
+		     &( state->current_track ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to parse track number.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( state->current_track != 0 )
+		 && ( state->current_track != ( state->previous_track + 1 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported track number - values are not sequential.",
+			 function );
+
+			return( -1 );
+		}
+		state->previous_track_type = state->current_track_type;
+
+		if( libodraw_cue_parser_parse_track_type(
+		     track_type_token->data,
+		     track_type_token->length,
+		     &( state->current_track_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to parse track type.",
+			 function );
+
+			return( -1 );
+		}
+		state->previous_index = 0;
+		state->current_index  = 0;
+	}
+	return( 1 );
+}
+
+/* Parses the remainder of a command after its first token
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_cue_reader_parse_command(
+     libodraw_cue_reader_state_t *state,
+     const libodraw_cue_reader_token_t *command_token,
+     libcerror_error_t **error )
+{
+	libodraw_cue_reader_token_t first_token;
+	libodraw_cue_reader_token_t second_token;
+	libodraw_cue_reader_token_t token;
+
+	static char *function = "libodraw_cue_reader_parse_command";
+	int result            = 1;
+
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( command_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid command token.",
+		 function );
+
+		return( -1 );
+	}
+	switch( command_token->type )
+	{
+		case LIBODRAW_CUE_READER_TOKEN_END_OF_LINE:
+			return( 1 );
+
+		case LIBODRAW_CUE_READER_TOKEN_CATALOG:
+			result = libodraw_cue_reader_get_expected_token(
+			          state,
+			          LIBODRAW_CUE_READER_TOKEN_CATALOG_NUMBER,
+			          &first_token,
+			          error );
+			break;
+
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_ARRANGER:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_COMPOSER:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_DISC_ID:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_GENRE:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_MESSAGE:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_PERFORMER:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_SIZE_INFO:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_SONGWRITER:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_TITLE:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_TOC_INFO1:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_TOC_INFO2:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_UPC_EAN:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXTFILE:
+			result = libodraw_cue_reader_get_expected_token(
+			          state,
+			          LIBODRAW_CUE_READER_TOKEN_STRING,
+			          &first_token,
+			          error );
+			break;
+
+		case LIBODRAW_CUE_READER_TOKEN_CD_DA:
+		case LIBODRAW_CUE_READER_TOKEN_CD_ROM:
+		case LIBODRAW_CUE_READER_TOKEN_CD_ROM_XA:
+		case LIBODRAW_CUE_READER_TOKEN_COPY:
+		case LIBODRAW_CUE_READER_TOKEN_FOUR_CHANNEL_AUDIO:
+		case LIBODRAW_CUE_READER_TOKEN_NO_COPY:
+		case LIBODRAW_CUE_READER_TOKEN_NO_PRE_EMPHASIS:
+		case LIBODRAW_CUE_READER_TOKEN_PRE_EMPHASIS:
+		case LIBODRAW_CUE_READER_TOKEN_TWO_CHANNEL_AUDIO:
+			break;
+
+		case LIBODRAW_CUE_READER_TOKEN_DATAFILE:
+		case LIBODRAW_CUE_READER_TOKEN_FILE:
+			result = libodraw_cue_reader_get_expected_token(
+			          state,
+			          LIBODRAW_CUE_READER_TOKEN_STRING,
+			          &first_token,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libodraw_cue_reader_get_expected_token(
+				          state,
+				          ( command_token->type == LIBODRAW_CUE_READER_TOKEN_FILE ) ? LIBODRAW_CUE_READER_TOKEN_KEYWORD_STRING : LIBODRAW_CUE_READER_TOKEN_MSF,
+				          &second_token,
+				          error );
+			}
+			break;
+
+		case LIBODRAW_CUE_READER_TOKEN_FLAGS:
+			/* The flags are not used, skip them up to the end-of-line
+			 */
+			do
+			{
+				if( libodraw_cue_reader_get_token(
+				     state->buffer,
+				     state->buffer_size,
+				     &( state->buffer_offset ),
+				     &token,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve token.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			while( token.type == LIBODRAW_CUE_READER_TOKEN_KEYWORD_STRING );
+
+			if( token.type != LIBODRAW_CUE_READER_TOKEN_END_OF_LINE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported flags token: %d.",
+				 function,
+				 token.type );
+
+				return( -1 );
+			}
+			return( 1 );
+
+		case LIBODRAW_CUE_READER_TOKEN_INDEX:
+			result = libodraw_cue_reader_get_expected_token(
+			          state,
+			          LIBODRAW_CUE_READER_TOKEN_2DIGIT,
+			          &first_token,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libodraw_cue_reader_get_expected_token(
+				          state,
+				          LIBODRAW_CUE_READER_TOKEN_MSF,
+				          &second_token,
+				          error );
+			}
+			break;
+
+		case LIBODRAW_CUE_READER_TOKEN_ISRC:
+			result = libodraw_cue_reader_get_expected_token(
+			          state,
+			          LIBODRAW_CUE_READER_TOKEN_ISRC_CODE,
+			          &first_token,
+			          error );
+			break;
+
+		case LIBODRAW_CUE_READER_TOKEN_POSTGAP:
+		case LIBODRAW_CUE_READER_TOKEN_PREGAP:
+		case LIBODRAW_CUE_READER_TOKEN_REMARK_LEAD_OUT:
+		case LIBODRAW_CUE_READER_TOKEN_REMARK_RUN_OUT:
+			result = libodraw_cue_reader_get_expected_token(
+			          state,
+			          LIBODRAW_CUE_READER_TOKEN_MSF,
+			          &first_token,
+			          error );
+			break;
+
+		case LIBODRAW_CUE_READER_TOKEN_REMARK:
+			/* The remainder of a remark is ignored, including any tokens that would otherwise be invalid
+			 */
+			do
+			{
+				if( libodraw_cue_reader_get_token(
+				     state->buffer,
+				     state->buffer_size,
+				     &( state->buffer_offset ),
+				     &token,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve token.",
+					 function );
+
+					return( -1 );
+				}
+				if( token.type == LIBODRAW_CUE_READER_TOKEN_END_OF_FILE )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: missing end-of-line after remark.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			while( token.type != LIBODRAW_CUE_READER_TOKEN_END_OF_LINE );
+
+			return( 1 );
+
+		case LIBODRAW_CUE_READER_TOKEN_REMARK_ORIGINAL_MEDIA_TYPE:
+			result = libodraw_cue_reader_get_expected_token(
+			          state,
+			          LIBODRAW_CUE_READER_TOKEN_KEYWORD_STRING,
+			          &first_token,
+			          error );
+			break;
+
+		case LIBODRAW_CUE_READER_TOKEN_REMARK_SESSION:
+			result = libodraw_cue_reader_get_expected_token(
+			          state,
+			          LIBODRAW_CUE_READER_TOKEN_2DIGIT,
+			          &first_token,
+			          error );
+			break;
+
+		case LIBODRAW_CUE_READER_TOKEN_TRACK:
+			if( libodraw_cue_reader_get_token(
+			     state->buffer,
+			     state->buffer_size,
+			     &( state->buffer_offset ),
+			     &first_token,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve token.",
+				 function );
+
+				return( -1 );
+			}
+			if( first_token.type == LIBODRAW_CUE_READER_TOKEN_2DIGIT )
+			{
+				result = libodraw_cue_reader_get_expected_token(
+				          state,
+				          LIBODRAW_CUE_READER_TOKEN_KEYWORD_STRING,
+				          &second_token,
+				          error );
+			}
+			else if( first_token.type != LIBODRAW_CUE_READER_TOKEN_KEYWORD_STRING )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported track token: %d.",
+				 function,
+				 first_token.type );
+
+				return( -1 );
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported command token: %d.",
+			 function,
+			 command_token->type );
+
+			return( -1 );
+	}
+	if( result == 1 )
+	{
+		result = libodraw_cue_reader_get_expected_token(
+		          state,
+		          LIBODRAW_CUE_READER_TOKEN_END_OF_LINE,
+		          &token,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve command token.",
+		 function );
+
+		return( -1 );
+	}
+	/* Commands that affect the layout are processed after the end-of-line
+	 * like the actions of the bison based CUE parser
+	 */
+	switch( command_token->type )
+	{
+		case LIBODRAW_CUE_READER_TOKEN_DATAFILE:
+			result = libodraw_cue_reader_process_datafile(
+			          state,
+			          &first_token,
+			          &second_token,
+			          error );
+			break;
+
+		case LIBODRAW_CUE_READER_TOKEN_FILE:
+			result = libodraw_cue_reader_process_file(
+			          state,
+			          &first_token,
+			          &second_token,
+			          error );
+			break;
+
+		case LIBODRAW_CUE_READER_TOKEN_INDEX:
+			result = libodraw_cue_reader_process_index(
+			          state,
+			          &first_token,
+			          &second_token,
+			          error );
+			break;
+
+		case LIBODRAW_CUE_READER_TOKEN_REMARK_LEAD_OUT:
+			result = libodraw_cue_reader_process_lead_out(
+			          state,
+			          &first_token,
+			          error );
+			break;
+
+		case LIBODRAW_CUE_READER_TOKEN_REMARK_RUN_OUT:
+			result = libodraw_cue_reader_process_run_out(
+			          state,
+			          &first_token,
+			          error );
+			break;
+
+		case LIBODRAW_CUE_READER_TOKEN_REMARK_SESSION:
+			result = libodraw_cue_reader_process_session(
+			          state,
+			          &first_token,
+			          error );
+			break;
+
+		case LIBODRAW_CUE_READER_TOKEN_TRACK:
+			if( first_token.type == LIBODRAW_CUE_READER_TOKEN_2DIGIT )
+			{
+				result = libodraw_cue_reader_process_track(
+				          state,
+				          &first_token,
+				          &second_token,
+				          error );
+			}
+			else
+			{
+				result = libodraw_cue_reader_process_track(
+				          state,
+				          NULL,
+				          &first_token,
+				          error );
+			}
+			break;
+
+		default:
+			break;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process command.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if a section can contain a command
+ * Returns 1 if the section can contain the command, 0 if not
+ */
+int libodraw_cue_reader_section_has_command(
+     int section,
+     int token_type )
+{
+	switch( token_type )
+	{
+		case LIBODRAW_CUE_READER_TOKEN_END_OF_LINE:
+		case LIBODRAW_CUE_READER_TOKEN_REMARK:
+		case LIBODRAW_CUE_READER_TOKEN_REMARK_LEAD_OUT:
+		case LIBODRAW_CUE_READER_TOKEN_REMARK_ORIGINAL_MEDIA_TYPE:
+		case LIBODRAW_CUE_READER_TOKEN_REMARK_RUN_OUT:
+		case LIBODRAW_CUE_READER_TOKEN_REMARK_SESSION:
+			if( ( section == LIBODRAW_CUE_READER_SECTION_HEADER )
+			 || ( section == LIBODRAW_CUE_READER_SECTION_SESSION_TYPE ) )
+			{
+				return( 0 );
+			}
+			return( 1 );
+
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_ARRANGER:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_COMPOSER:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_DISC_ID:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_GENRE:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_MESSAGE:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_PERFORMER:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_SIZE_INFO:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_SONGWRITER:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_TITLE:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_TOC_INFO1:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_TOC_INFO2:
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXT_UPC_EAN:
+			if( ( section == LIBODRAW_CUE_READER_SECTION_MAIN_ITEMS )
+			 || ( section == LIBODRAW_CUE_READER_SECTION_MAIN_ITEMS_BEFORE_FILE )
+			 || ( section == LIBODRAW_CUE_READER_SECTION_TRACK_LEADING_ITEMS )
+			 || ( section == LIBODRAW_CUE_READER_SECTION_TRACK_TRAILING_ITEMS ) )
+			{
+				return( 1 );
+			}
+			return( 0 );
+
+		case LIBODRAW_CUE_READER_TOKEN_CATALOG:
+			if( section == LIBODRAW_CUE_READER_SECTION_HEADER )
+			{
+				return( 1 );
+			}
+			return( 0 );
+
+		case LIBODRAW_CUE_READER_TOKEN_CD_DA:
+		case LIBODRAW_CUE_READER_TOKEN_CD_ROM:
+		case LIBODRAW_CUE_READER_TOKEN_CD_ROM_XA:
+			if( section == LIBODRAW_CUE_READER_SECTION_SESSION_TYPE )
+			{
+				return( 1 );
+			}
+			return( 0 );
+
+		case LIBODRAW_CUE_READER_TOKEN_CDTEXTFILE:
+			if( ( section == LIBODRAW_CUE_READER_SECTION_MAIN_ITEMS )
+			 || ( section == LIBODRAW_CUE_READER_SECTION_MAIN_ITEMS_BEFORE_FILE ) )
+			{
+				return( 1 );
+			}
+			return( 0 );
+
+		case LIBODRAW_CUE_READER_TOKEN_FILE:
+			if( ( section == LIBODRAW_CUE_READER_SECTION_MAIN_ITEMS_BEFORE_FILE )
+			 || ( section == LIBODRAW_CUE_READER_SECTION_TRACKS )
+			 || ( section == LIBODRAW_CUE_READER_SECTION_TRACK_PRECEDING_ITEMS ) )
+			{
+				return( 1 );
+			}
+			return( 0 );
+
+		case LIBODRAW_CUE_READER_TOKEN_TRACK:
+			if( ( section == LIBODRAW_CUE_READER_SECTION_TRACKS )
+			 || ( section == LIBODRAW_CUE_READER_SECTION_TRACK_PRECEDING_ITEMS ) )
+			{
+				return( 1 );
+			}
+			return( 0 );
+
+		case LIBODRAW_CUE_READER_TOKEN_FLAGS:
+		case LIBODRAW_CUE_READER_TOKEN_ISRC:
+		case LIBODRAW_CUE_READER_TOKEN_PREGAP:
+			if( section == LIBODRAW_CUE_READER_SECTION_TRACK_LEADING_ITEMS )
+			{
+				return( 1 );
+			}
+			return( 0 );
+
+		case LIBODRAW_CUE_READER_TOKEN_INDEX:
+			if( section == LIBODRAW_CUE_READER_SECTION_TRACK_INDEX_ITEMS )
+			{
+				return( 1 );
+			}
+			return( 0 );
+
+		case LIBODRAW_CUE_READER_TOKEN_COPY:
+		case LIBODRAW_CUE_READER_TOKEN_DATAFILE:
+		case LIBODRAW_CUE_READER_TOKEN_FOUR_CHANNEL_AUDIO:
+		case LIBODRAW_CUE_READER_TOKEN_NO_COPY:
+		case LIBODRAW_CUE_READER_TOKEN_NO_PRE_EMPHASIS:
+		case LIBODRAW_CUE_READER_TOKEN_POSTGAP:
+		case LIBODRAW_CUE_READER_TOKEN_PRE_EMPHASIS:
+		case LIBODRAW_CUE_READER_TOKEN_TWO_CHANNEL_AUDIO:
+			if( section == LIBODRAW_CUE_READER_SECTION_TRACK_TRAILING_ITEMS )
+			{
+				return( 1 );
+			}
+			return( 0 );
+
+		default:
+			break;
+	}
+	return( 0 );
+}
+
+/* Parses a CUE file
+ * The buffer must end with 2 zero bytes, like the buffer of the flex based CUE scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_cue_reader_parse_buffer(
+     libodraw_handle_t *handle,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	libodraw_cue_reader_state_t state;
+	libodraw_cue_reader_token_t token;
+
+	static char *function = "libodraw_cue_reader_parse_buffer";
+	size_t buffer_offset  = 0;
+	size_t token_offset   = 0;
+	int result            = 1;
+	int section           = LIBODRAW_CUE_READER_SECTION_HEADER;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size >= 3 )
+	{
+		if( ( buffer[ 0 ] == 0x0ef )
+		 && ( buffer[ 1 ] == 0x0bb )
+		 && ( buffer[ 2 ] == 0x0bf ) )
+		{
+			buffer_offset = 3;
+		}
+	}
+	if( ( ( buffer_size - buffer_offset ) < 2 )
+	 || ( buffer[ buffer_size - 2 ] != 0 )
+	 || ( buffer[ buffer_size - 1 ] != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported buffer - missing 2 zero bytes at end.",
+		 function );
+
+		return( -1 );
+	}
+	state.handle                         = handle;
+	state.buffer                         = (const char *) buffer;
+	state.buffer_size                    = buffer_size - 2;
+	state.buffer_offset                  = buffer_offset;
+	state.previous_file_index            = -1;
+	state.current_file_index             = -1;
+	state.file_type                      = 0;
+	state.previous_file_sector           = 0;
+	state.file_sector                    = 0;
+	state.previous_session_start_sector  = 0;
+	state.previous_lead_out_start_sector = 0;
+	state.previous_track_start_sector    = 0;
+	state.current_start_sector           = 0;
+	state.session_number_of_sectors      = 0;
+	state.lead_out_number_of_sectors     = 0;
+	state.track_number_of_sectors        = 0;
+	state.previous_track_type            = 0;
+	state.current_track_type             = 0;
+	state.previous_session               = 0;
+	state.current_session                = 0;
+	state.previous_lead_out              = 0;
+	state.current_lead_out               = 0;
+	state.previous_track                 = 0;
+	state.current_track                  = 0;
+	state.previous_index                 = 0;
+	state.current_index                  = 0;
+
+	while( result == 1 )
+	{
+		token_offset = state.buffer_offset;
+
+		if( libodraw_cue_reader_get_token(
+		     state.buffer,
+		     state.buffer_size,
+		     &( state.buffer_offset ),
+		     &token,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve token.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		/* Sections are optional and are left when they cannot contain the command,
+		 * this corresponds with the bison based CUE parser that prefers shift over reduce
+		 */
+		if( ( section == LIBODRAW_CUE_READER_SECTION_HEADER )
+		 && ( libodraw_cue_reader_section_has_command(
+		       section,
+		       token.type ) == 0 ) )
+		{
+			section = LIBODRAW_CUE_READER_SECTION_SESSION_TYPE;
+		}
+		if( ( section == LIBODRAW_CUE_READER_SECTION_SESSION_TYPE )
+		 && ( libodraw_cue_reader_section_has_command(
+		       section,
+		       token.type ) == 0 ) )
+		{
+			/* Main items without a preceding session type must be followed by a FILE command
+			 */
+			if( libodraw_cue_reader_section_has_command(
+			     LIBODRAW_CUE_READER_SECTION_MAIN_ITEMS,
+			     token.type ) != 0 )
+			{
+				section = LIBODRAW_CUE_READER_SECTION_MAIN_ITEMS_BEFORE_FILE;
+			}
+			else
+			{
+				section = LIBODRAW_CUE_READER_SECTION_TRACKS;
+			}
+		}
+		if( ( section == LIBODRAW_CUE_READER_SECTION_TRACK_LEADING_ITEMS )
+		 && ( libodraw_cue_reader_section_has_command(
+		       section,
+		       token.type ) == 0 ) )
+		{
+			section = LIBODRAW_CUE_READER_SECTION_TRACK_INDEX_ITEMS;
+		}
+		if( ( section == LIBODRAW_CUE_READER_SECTION_TRACK_INDEX_ITEMS )
+		 && ( libodraw_cue_reader_section_has_command(
+		       section,
+		       token.type ) == 0 ) )
+		{
+			section = LIBODRAW_CUE_READER_SECTION_TRACK_TRAILING_ITEMS;
+		}
+		if( ( ( section == LIBODRAW_CUE_READER_SECTION_MAIN_ITEMS )
+		  ||  ( section == LIBODRAW_CUE_READER_SECTION_TRACK_TRAILING_ITEMS ) )
+		 && ( libodraw_cue_reader_section_has_command(
+		       section,
+		       token.type ) == 0 ) )
+		{
+			section = LIBODRAW_CUE_READER_SECTION_TRACKS;
+		}
+		if( ( section == LIBODRAW_CUE_READER_SECTION_TRACKS )
+		 && ( token.type == LIBODRAW_CUE_READER_TOKEN_END_OF_FILE ) )
+		{
+			break;
+		}
+		if( libodraw_cue_reader_section_has_command(
+		     section,
+		     token.type ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported token: %d after offset: %" PRIzd ".",
+			 function,
+			 token.type,
+			 token_offset );
+
+			result = -1;
+
+			break;
+		}
+		if( libodraw_cue_reader_parse_command(
+		     &state,
+		     &token,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse command after offset: %" PRIzd ".",
+			 function,
+			 token_offset );
+
+			result = -1;
+
+			break;
+		}
+		if( token.type == LIBODRAW_CUE_READER_TOKEN_TRACK )
+		{
+			section = LIBODRAW_CUE_READER_SECTION_TRACK_LEADING_ITEMS;
+		}
+		else if( section == LIBODRAW_CUE_READER_SECTION_HEADER )
+		{
+			section = LIBODRAW_CUE_READER_SECTION_SESSION_TYPE;
+		}
+		else if( section == LIBODRAW_CUE_READER_SECTION_SESSION_TYPE )
+		{
+			section = LIBODRAW_CUE_READER_SECTION_MAIN_ITEMS;
+		}
+		else if( ( section == LIBODRAW_CUE_READER_SECTION_MAIN_ITEMS_BEFORE_FILE )
+		      && ( token.type == LIBODRAW_CUE_READER_TOKEN_FILE ) )
+		{
+			section = LIBODRAW_CUE_READER_SECTION_MAIN_ITEMS;
+		}
+		else if( section == LIBODRAW_CUE_READER_SECTION_TRACKS )
+		{
+			section = LIBODRAW_CUE_READER_SECTION_TRACK_PRECEDING_ITEMS;
+		}
+	}
+	/* The last session, lead-out and track are appended even if the CUE file could not be parsed
+	 * completely, like the bison based CUE parser
+	 */
+	if( state.current_session > 0 )
+	{
+		if( libodraw_handle_append_session(
+		     state.handle,
+		     state.previous_session_start_sector,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append session.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( state.current_lead_out > state.previous_lead_out )
+	{
+		if( libodraw_handle_append_lead_out(
+		     state.handle,
+		     state.previous_lead_out_start_sector,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append lead-out.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( state.current_track > 0 )
+	{
+		if( state.previous_file_index < 0 )
+		{
+			state.file_sector = state.previous_track_start_sector;
+
+			state.previous_file_index += 1;
+		}
+		state.previous_file_sector = state.previous_track_start_sector
+		                           - state.file_sector;
+
+		if( libodraw_handle_append_track(
+		     state.handle,
+		     state.previous_track_start_sector,
+		     0,
+		     state.current_track_type,
+		     state.current_file_index,
+		     state.previous_file_sector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append track.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
@@ -0,0 +1,308 @@
+/*
+ * Hand-written CUE reader functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_CUE_READER_H )
+#define _LIBODRAW_CUE_READER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+#include "libodraw_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The token types, these correspond with the tokens of the flex based CUE scanner
+ */
+enum LIBODRAW_CUE_READER_TOKEN_TYPES
+{
+	LIBODRAW_CUE_READER_TOKEN_END_OF_FILE		= 0,
+	LIBODRAW_CUE_READER_TOKEN_END_OF_LINE,
+	LIBODRAW_CUE_READER_TOKEN_UNDEFINED,
+
+	LIBODRAW_CUE_READER_TOKEN_2DIGIT,
+	LIBODRAW_CUE_READER_TOKEN_CATALOG_NUMBER,
+	LIBODRAW_CUE_READER_TOKEN_ISRC_CODE,
+	LIBODRAW_CUE_READER_TOKEN_KEYWORD_STRING,
+	LIBODRAW_CUE_READER_TOKEN_MSF,
+	LIBODRAW_CUE_READER_TOKEN_STRING,
+
+	LIBODRAW_CUE_READER_TOKEN_CATALOG,
+	LIBODRAW_CUE_READER_TOKEN_CD_DA,
+	LIBODRAW_CUE_READER_TOKEN_CD_ROM,
+	LIBODRAW_CUE_READER_TOKEN_CD_ROM_XA,
+	LIBODRAW_CUE_READER_TOKEN_CD_TEXT,
+	LIBODRAW_CUE_READER_TOKEN_CDTEXTFILE,
+	LIBODRAW_CUE_READER_TOKEN_COPY,
+	LIBODRAW_CUE_READER_TOKEN_DATAFILE,
+	LIBODRAW_CUE_READER_TOKEN_FILE,
+	LIBODRAW_CUE_READER_TOKEN_FLAGS,
+	LIBODRAW_CUE_READER_TOKEN_FOUR_CHANNEL_AUDIO,
+	LIBODRAW_CUE_READER_TOKEN_INDEX,
+	LIBODRAW_CUE_READER_TOKEN_ISRC,
+	LIBODRAW_CUE_READER_TOKEN_NO_COPY,
+	LIBODRAW_CUE_READER_TOKEN_NO_PRE_EMPHASIS,
+	LIBODRAW_CUE_READER_TOKEN_POSTGAP,
+	LIBODRAW_CUE_READER_TOKEN_PRE_EMPHASIS,
+	LIBODRAW_CUE_READER_TOKEN_PREGAP,
+	LIBODRAW_CUE_READER_TOKEN_REMARK,
+	LIBODRAW_CUE_READER_TOKEN_TRACK,
+	LIBODRAW_CUE_READER_TOKEN_TWO_CHANNEL_AUDIO,
+
+	LIBODRAW_CUE_READER_TOKEN_CDTEXT_ARRANGER,
+	LIBODRAW_CUE_READER_TOKEN_CDTEXT_COMPOSER,
+	LIBODRAW_CUE_READER_TOKEN_CDTEXT_DISC_ID,
+	LIBODRAW_CUE_READER_TOKEN_CDTEXT_GENRE,
+	LIBODRAW_CUE_READER_TOKEN_CDTEXT_MESSAGE,
+	LIBODRAW_CUE_READER_TOKEN_CDTEXT_PERFORMER,
+	LIBODRAW_CUE_READER_TOKEN_CDTEXT_SIZE_INFO,
+	LIBODRAW_CUE_READER_TOKEN_CDTEXT_SONGWRITER,
+	LIBODRAW_CUE_READER_TOKEN_CDTEXT_TITLE,
+	LIBODRAW_CUE_READER_TOKEN_CDTEXT_TOC_INFO1,
+	LIBODRAW_CUE_READER_TOKEN_CDTEXT_TOC_INFO2,
+	LIBODRAW_CUE_READER_TOKEN_CDTEXT_UPC_EAN,
+
+	LIBODRAW_CUE_READER_TOKEN_REMARK_LEAD_OUT,
+	LIBODRAW_CUE_READER_TOKEN_REMARK_ORIGINAL_MEDIA_TYPE,
+	LIBODRAW_CUE_READER_TOKEN_REMARK_RUN_OUT,
+	LIBODRAW_CUE_READER_TOKEN_REMARK_SESSION
+};
+
+/* The sections of a CUE file, these correspond with the non-terminals of the bison based CUE parser
+ */
+enum LIBODRAW_CUE_READER_SECTIONS
+{
+	LIBODRAW_CUE_READER_SECTION_HEADER,
+	LIBODRAW_CUE_READER_SECTION_SESSION_TYPE,
+	LIBODRAW_CUE_READER_SECTION_MAIN_ITEMS,
+	LIBODRAW_CUE_READER_SECTION_MAIN_ITEMS_BEFORE_FILE,
+	LIBODRAW_CUE_READER_SECTION_TRACKS,
+	LIBODRAW_CUE_READER_SECTION_TRACK_PRECEDING_ITEMS,
+	LIBODRAW_CUE_READER_SECTION_TRACK_LEADING_ITEMS,
+	LIBODRAW_CUE_READER_SECTION_TRACK_INDEX_ITEMS,
+	LIBODRAW_CUE_READER_SECTION_TRACK_TRAILING_ITEMS
+};
+
+typedef struct libodraw_cue_reader_token libodraw_cue_reader_token_t;
+
+struct libodraw_cue_reader_token
+{
+	/* The type
+	 */
+	int type;
+
+	/* The data, which points into the CUE buffer
+	 */
+	const char *data;
+
+	/* The data length
+	 */
+	size_t length;
+};
+
+typedef struct libodraw_cue_reader_state libodraw_cue_reader_state_t;
+
+struct libodraw_cue_reader_state
+{
+	/* The handle
+	 */
+	libodraw_handle_t *handle;
+
+	/* The buffer
+	 */
+	const char *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The buffer offset
+	 */
+	size_t buffer_offset;
+
+	/* The previous file index
+	 */
+	int previous_file_index;
+
+	/* The current file index
+	 */
+	int current_file_index;
+
+	/* The file type
+	 */
+	uint8_t file_type;
+
+	/* The previous file sector
+	 */
+	uint64_t previous_file_sector;
+
+	/* The file sector
+	 */
+	uint64_t file_sector;
+
+	/* The previous session start sector
+	 */
+	uint64_t previous_session_start_sector;
+
+	/* The previous lead-out start sector
+	 */
+	uint64_t previous_lead_out_start_sector;
+
+	/* The previous track start sector
+	 */
+	uint64_t previous_track_start_sector;
+
+	/* The current start sector
+	 */
+	uint64_t current_start_sector;
+
+	/* The session number of sectors
+	 */
+	uint64_t session_number_of_sectors;
+
+	/* The lead-out number of sectors
+	 */
+	uint64_t lead_out_number_of_sectors;
+
+	/* The track number of sectors
+	 */
+	uint64_t track_number_of_sectors;
+
+	/* The previous track type
+	 */
+	uint8_t previous_track_type;
+
+	/* The current track type
+	 */
+	uint8_t current_track_type;
+
+	/* The previous session
+	 */
+	int previous_session;
+
+	/* The current session
+	 */
+	int current_session;
+
+	/* The previous lead-out
+	 */
+	int previous_lead_out;
+
+	/* The current lead-out
+	 */
+	int current_lead_out;
+
+	/* The previous track
+	 */
+	int previous_track;
+
+	/* The current track
+	 */
+	int current_track;
+
+	/* The previous index
+	 */
+	int previous_index;
+
+	/* The current index
+	 */
+	int current_index;
+};
+
+size_t libodraw_cue_reader_get_quoted_string_length(
+        const char *data,
+        size_t data_size );
+
+int libodraw_cue_reader_get_token(
+     const char *buffer,
+     size_t buffer_size,
+     size_t *buffer_offset,
+     libodraw_cue_reader_token_t *token,
+     libcerror_error_t **error );
+
+int libodraw_cue_reader_get_expected_token(
+     libodraw_cue_reader_state_t *state,
+     int token_type,
+     libodraw_cue_reader_token_t *token,
+     libcerror_error_t **error );
+
+int libodraw_cue_reader_process_file(
+     libodraw_cue_reader_state_t *state,
+     const libodraw_cue_reader_token_t *filename_token,
+     const libodraw_cue_reader_token_t *file_type_token,
+     libcerror_error_t **error );
+
+int libodraw_cue_reader_process_index(
+     libodraw_cue_reader_state_t *state,
+     const libodraw_cue_reader_token_t *index_token,
+     const libodraw_cue_reader_token_t *msf_token,
+     libcerror_error_t **error );
+
+int libodraw_cue_reader_process_datafile(
+     libodraw_cue_reader_state_t *state,
+     const libodraw_cue_reader_token_t *filename_token,
+     const libodraw_cue_reader_token_t *msf_token,
+     libcerror_error_t **error );
+
+int libodraw_cue_reader_process_lead_out(
+     libodraw_cue_reader_state_t *state,
+     const libodraw_cue_reader_token_t *msf_token,
+     libcerror_error_t **error );
+
+int libodraw_cue_reader_process_run_out(
+     libodraw_cue_reader_state_t *state,
+     const libodraw_cue_reader_token_t *msf_token,
+     libcerror_error_t **error );
+
+int libodraw_cue_reader_process_session(
+     libodraw_cue_reader_state_t *state,
+     const libodraw_cue_reader_token_t *session_token,
+     libcerror_error_t **error );
+
+int libodraw_cue_reader_process_track(
+     libodraw_cue_reader_state_t *state,
+     const libodraw_cue_reader_token_t *track_token,
+     const libodraw_cue_reader_token_t *track_type_token,
+     libcerror_error_t **error );
+
+int libodraw_cue_reader_parse_command(
+     libodraw_cue_reader_state_t *state,
+     const libodraw_cue_reader_token_t *command_token,
+     libcerror_error_t **error );
+
+int libodraw_cue_reader_section_has_command(
+     int section,
+     int token_type );
+
+int libodraw_cue_reader_parse_buffer(
+     libodraw_handle_t *handle,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_CUE_READER_H ) */
+
@@ -0,0 +1,714 @@
+/*
+ * CUE writer functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libodraw_cue_writer.h"
+#include "libodraw_data_file_descriptor.h"
+#include "libodraw_definitions.h"
+#include "libodraw_layout_arena.h"
+#include "libodraw_libcdata.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_sector_range.h"
+#include "libodraw_track_value.h"
+
+/* The maximum size of a line excluding the data file name
+ */
+#define LIBODRAW_CUE_WRITER_MAXIMUM_LINE_SIZE	32
+
+/* Retrieves the CUE file type string of a data file type
+ * Returns the file type string
+ */
+const char *libodraw_cue_writer_get_file_type_string(
+             uint8_t file_type )
+{
+	switch( file_type )
+	{
+		case LIBODRAW_FILE_TYPE_BINARY_BIG_ENDIAN:
+			return( "MOTOROLA" );
+
+		case LIBODRAW_FILE_TYPE_AUDIO_AIFF:
+			return( "AIFF" );
+
+		case LIBODRAW_FILE_TYPE_AUDIO_WAVE:
+			return( "WAVE" );
+
+		case LIBODRAW_FILE_TYPE_AUDIO_MPEG1_LAYER3:
+			return( "MP3" );
+
+		default:
+			break;
+	}
+	return( "BINARY" );
+}
+
+/* Retrieves the CUE track type string of a track type
+ * Returns the track type string or NULL if not supported
+ */
+const char *libodraw_cue_writer_get_track_type_string(
+             uint8_t track_type )
+{
+	switch( track_type )
+	{
+		case LIBODRAW_TRACK_TYPE_AUDIO:
+			return( "AUDIO" );
+
+		case LIBODRAW_TRACK_TYPE_CDG:
+			return( "CDG" );
+
+		case LIBODRAW_TRACK_TYPE_MODE1_2048:
+			return( "MODE1/2048" );
+
+		case LIBODRAW_TRACK_TYPE_MODE1_2352:
+			return( "MODE1/2352" );
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2048:
+			return( "MODE2/2048" );
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2324:
+			return( "MODE2/2324" );
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2336:
+			return( "MODE2/2336" );
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2352:
+			return( "MODE2/2352" );
+
+		case LIBODRAW_TRACK_TYPE_CDI_2336:
+			return( "CDI/2336" );
+
+		case LIBODRAW_TRACK_TYPE_CDI_2352:
+			return( "CDI/2352" );
+
+		default:
+			break;
+	}
+	return( NULL );
+}
+
+/* Copies a sector as a minutes:seconds:frames (MSF) string
+ * The string size should be at least 9 characters including the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_cue_writer_copy_msf(
+     char *string,
+     size_t string_size,
+     uint64_t sector,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_cue_writer_copy_msf";
+	uint64_t value        = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size < 9 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The MSF has 2 digits for the minutes
+	 */
+	if( sector >= ( 100 * 60 * 75 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	value       = sector / ( 60 * 75 );
+	string[ 0 ] = (char) ( '0' + ( value / 10 ) );
+	string[ 1 ] = (char) ( '0' + ( value % 10 ) );
+	string[ 2 ] = ':';
+
+	value       = ( sector / 75 ) % 60;
+	string[ 3 ] = (char) ( '0' + ( value / 10 ) );
+	string[ 4 ] = (char) ( '0' + ( value % 10 ) );
+	string[ 5 ] = ':';
+
+	value       = sector % 75;
+	string[ 6 ] = (char) ( '0' + ( value / 10 ) );
+	string[ 7 ] = (char) ( '0' + ( value % 10 ) );
+	string[ 8 ] = 0;
+
+	return( 1 );
+}
+
+/* Writes the data of a CUE file from the data files, sessions, lead-outs and tracks
+ * The INDEX 01 of a track is relative to the start of its data file
+ * The sessions are only written for a multi-session image
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_cue_writer_write_data(
+     libcdata_array_t *data_file_descriptors_array,
+     libodraw_layout_arena_t *layout_arena,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	char msf_string[ 9 ];
+
+	libodraw_data_file_descriptor_t *data_file_descriptor = NULL;
+	libodraw_sector_range_t *sector_range                 = NULL;
+	libodraw_track_value_t *previous_track_value          = NULL;
+	libodraw_track_value_t *track_value                   = NULL;
+	const char *file_type_string                          = NULL;
+	const char *track_type_string                         = NULL;
+	char *name                                            = NULL;
+	uint8_t *safe_data                                    = NULL;
+	static char *function                                 = "libodraw_cue_writer_write_data";
+	size_t data_offset                                    = 0;
+	size_t maximum_name_size                              = 0;
+	size_t name_index                                     = 0;
+	size_t name_size                                      = 0;
+	size_t safe_data_size                                 = 0;
+	uint64_t sector                                       = 0;
+	int lead_out_index                                    = 0;
+	int number_of_data_files                              = 0;
+	int number_of_lead_outs                               = 0;
+	int number_of_sessions                                = 0;
+	int number_of_tracks                                  = 0;
+	int previous_data_file_index                          = -1;
+	int print_count                                       = 0;
+	int session_index                                     = 0;
+	int track_index                                       = 0;
+	int value_index                                       = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( libcdata_array_get_number_of_entries(
+	       data_file_descriptors_array,
+	       &number_of_data_files,
+	       error ) != 1 )
+	 || ( libodraw_layout_arena_get_number_of_sector_ranges(
+	       layout_arena,
+	       LIBODRAW_LAYOUT_ARENA_REGION_SESSIONS,
+	       &number_of_sessions,
+	       error ) != 1 )
+	 || ( libodraw_layout_arena_get_number_of_sector_ranges(
+	       layout_arena,
+	       LIBODRAW_LAYOUT_ARENA_REGION_LEAD_OUTS,
+	       &number_of_lead_outs,
+	       error ) != 1 )
+	 || ( libodraw_layout_arena_get_number_of_tracks(
+	       layout_arena,
+	       &number_of_tracks,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of layout values.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_tracks == 0 )
+	 || ( number_of_tracks > 99 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of tracks value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < number_of_data_files;
+	     value_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     data_file_descriptors_array,
+		     value_index,
+		     (intptr_t **) &data_file_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data file descriptor: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( libodraw_data_file_descriptor_get_name_size(
+		     data_file_descriptor,
+		     &name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve name size of data file descriptor: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( ( name_size == 0 )
+		 || ( name_size > (size_t) UINT16_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data file descriptor: %d - name size value out of bounds.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( name_size > maximum_name_size )
+		{
+			maximum_name_size = name_size;
+		}
+	}
+	/* Every track can be preceded by a FILE line
+	 */
+	safe_data_size = ( (size_t) number_of_tracks * ( ( 3 * LIBODRAW_CUE_WRITER_MAXIMUM_LINE_SIZE ) + maximum_name_size ) )
+	               + ( (size_t) ( number_of_sessions + number_of_lead_outs ) * LIBODRAW_CUE_WRITER_MAXIMUM_LINE_SIZE )
+	               + 1;
+
+	safe_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * safe_data_size );
+
+	if( safe_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( maximum_name_size > 0 )
+	{
+		name = narrow_string_allocate(
+		        maximum_name_size );
+
+		if( name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The last iteration writes the lead-outs that follow the last track
+	 */
+	for( track_index = 0;
+	     track_index <= number_of_tracks;
+	     track_index++ )
+	{
+		track_value = NULL;
+
+		if( track_index < number_of_tracks )
+		{
+			if( libodraw_layout_arena_get_track_by_index(
+			     layout_arena,
+			     track_index,
+			     &track_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve track value: %d.",
+				 function,
+				 track_index );
+
+				goto on_error;
+			}
+			if( track_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing track value: %d.",
+				 function,
+				 track_index );
+
+				goto on_error;
+			}
+		}
+		while( lead_out_index < number_of_lead_outs )
+		{
+			if( libodraw_layout_arena_get_sector_range_by_index(
+			     layout_arena,
+			     LIBODRAW_LAYOUT_ARENA_REGION_LEAD_OUTS,
+			     lead_out_index,
+			     &sector_range,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve lead-out sector range: %d.",
+				 function,
+				 lead_out_index );
+
+				goto on_error;
+			}
+			if( sector_range == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing lead-out sector range: %d.",
+				 function,
+				 lead_out_index );
+
+				goto on_error;
+			}
+			if( ( track_value != NULL )
+			 && ( sector_range->start_sector >= track_value->start_sector ) )
+			{
+				break;
+			}
+			/* The lead-out is written relative to the data file of the track it follows
+			 */
+			if( ( previous_track_value != NULL )
+			 && ( sector_range->start_sector >= previous_track_value->start_sector ) )
+			{
+				sector = previous_track_value->data_file_start_sector
+				       + ( sector_range->start_sector - previous_track_value->start_sector );
+
+				if( libodraw_cue_writer_copy_msf(
+				     msf_string,
+				     9,
+				     sector,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy lead-out: %d MSF string.",
+					 function,
+					 lead_out_index );
+
+					goto on_error;
+				}
+				print_count = narrow_string_snprintf(
+				               (char *) &( safe_data[ data_offset ] ),
+				               safe_data_size - data_offset,
+				               "REM LEAD-OUT %s\n",
+				               msf_string );
+
+				if( ( print_count < 0 )
+				 || ( (size_t) print_count >= ( safe_data_size - data_offset ) ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to write lead-out: %d.",
+					 function,
+					 lead_out_index );
+
+					goto on_error;
+				}
+				data_offset += (size_t) print_count;
+			}
+			lead_out_index++;
+		}
+		if( track_value == NULL )
+		{
+			break;
+		}
+		while( ( number_of_sessions > 1 )
+		    && ( session_index < number_of_sessions ) )
+		{
+			if( libodraw_layout_arena_get_sector_range_by_index(
+			     layout_arena,
+			     LIBODRAW_LAYOUT_ARENA_REGION_SESSIONS,
+			     session_index,
+			     &sector_range,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve session sector range: %d.",
+				 function,
+				 session_index );
+
+				goto on_error;
+			}
+			if( sector_range == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing session sector range: %d.",
+				 function,
+				 session_index );
+
+				goto on_error;
+			}
+			if( sector_range->start_sector > track_value->start_sector )
+			{
+				break;
+			}
+			session_index++;
+
+			print_count = narrow_string_snprintf(
+			               (char *) &( safe_data[ data_offset ] ),
+			               safe_data_size - data_offset,
+			               "REM SESSION %02d\n",
+			               session_index );
+
+			if( ( print_count < 0 )
+			 || ( (size_t) print_count >= ( safe_data_size - data_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to write session: %d.",
+				 function,
+				 session_index );
+
+				goto on_error;
+			}
+			data_offset += (size_t) print_count;
+		}
+		if( track_value->data_file_index != previous_data_file_index )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     data_file_descriptors_array,
+			     track_value->data_file_index,
+			     (intptr_t **) &data_file_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data file descriptor: %d of track: %d.",
+				 function,
+				 track_value->data_file_index,
+				 track_index );
+
+				goto on_error;
+			}
+			if( libodraw_data_file_descriptor_get_name(
+			     data_file_descriptor,
+			     name,
+			     maximum_name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve name of data file descriptor: %d.",
+				 function,
+				 track_value->data_file_index );
+
+				goto on_error;
+			}
+			/* The CUE format has no escape sequence for a quote in the name
+			 */
+			for( name_index = 0;
+			     name[ name_index ] != 0;
+			     name_index++ )
+			{
+				if( name[ name_index ] == '"' )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported data file descriptor: %d - name contains a quote.",
+					 function,
+					 track_value->data_file_index );
+
+					goto on_error;
+				}
+			}
+			file_type_string = libodraw_cue_writer_get_file_type_string(
+			                    data_file_descriptor->type );
+
+			print_count = narrow_string_snprintf(
+			               (char *) &( safe_data[ data_offset ] ),
+			               safe_data_size - data_offset,
+			               "FILE \"%s\" %s\n",
+			               name,
+			               file_type_string );
+
+			if( ( print_count < 0 )
+			 || ( (size_t) print_count >= ( safe_data_size - data_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to write data file: %d.",
+				 function,
+				 track_value->data_file_index );
+
+				goto on_error;
+			}
+			data_offset += (size_t) print_count;
+
+			previous_data_file_index = track_value->data_file_index;
+		}
+		track_type_string = libodraw_cue_writer_get_track_type_string(
+		                     track_value->type );
+
+		if( track_type_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported track: %d type: %" PRIu8 ".",
+			 function,
+			 track_index,
+			 track_value->type );
+
+			goto on_error;
+		}
+		if( libodraw_cue_writer_copy_msf(
+		     msf_string,
+		     9,
+		     track_value->data_file_start_sector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy track: %d MSF string.",
+			 function,
+			 track_index );
+
+			goto on_error;
+		}
+		print_count = narrow_string_snprintf(
+		               (char *) &( safe_data[ data_offset ] ),
+		               safe_data_size - data_offset,
+		               "  TRACK %02d %s\n    INDEX 01 %s\n",
+		               track_index + 1,
+		               track_type_string,
+		               msf_string );
+
+		if( ( print_count < 0 )
+		 || ( (size_t) print_count >= ( safe_data_size - data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write track: %d.",
+			 function,
+			 track_index );
+
+			goto on_error;
+		}
+		data_offset += (size_t) print_count;
+
+		previous_track_value = track_value;
+	}
+	if( name != NULL )
+	{
+		memory_free(
+		 name );
+	}
+	*data      = safe_data;
+	*data_size = data_offset;
+
+	return( 1 );
+
+on_error:
+	if( name != NULL )
+	{
+		memory_free(
+		 name );
+	}
+	if( safe_data != NULL )
+	{
+		memory_free(
+		 safe_data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,60 @@
+/*
+ * CUE writer functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_CUE_WRITER_H )
+#define _LIBODRAW_CUE_WRITER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_layout_arena.h"
+#include "libodraw_libcdata.h"
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+const char *libodraw_cue_writer_get_file_type_string(
+             uint8_t file_type );
+
+const char *libodraw_cue_writer_get_track_type_string(
+             uint8_t track_type );
+
+int libodraw_cue_writer_copy_msf(
+     char *string,
+     size_t string_size,
+     uint64_t sector,
+     libcerror_error_t **error );
+
+int libodraw_cue_writer_write_data(
+     libcdata_array_t *data_file_descriptors_array,
+     libodraw_layout_arena_t *layout_arena,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_CUE_WRITER_H ) */
+
@@ -548,3 +548,58 @@ int libodraw_data_file_get_type(
 	return( 1 );
 }
 
+/* Retrieves the file size
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libodraw_data_file_get_size(
+     libodraw_data_file_t *data_file,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libodraw_internal_data_file_t *internal_data_file = NULL;
+	static char *function                             = "libodraw_data_file_get_size";
+
+	if( data_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_file = (libodraw_internal_data_file_t *) data_file;
+
+	if( internal_data_file->data_file_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data file - missing data file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_data_file->data_file_descriptor->size_set == 0 )
+	{
+		return( 0 );
+	}
+	*size = internal_data_file->data_file_descriptor->size;
+
+	return( 1 );
+}
+
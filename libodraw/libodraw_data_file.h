@@ -107,6 +107,12 @@ int libodraw_data_file_get_type(
      uint8_t *type,
      libcerror_error_t **error );
 
+LIBODRAW_EXTERN \
+int libodraw_data_file_get_size(
+     libodraw_data_file_t *data_file,
+     size64_t *size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -26,6 +26,18 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
 #include "libodraw_data_file_descriptor.h"
 #include "libodraw_libcerror.h"
 #include "libodraw_libclocale.h"
@@ -1125,3 +1137,137 @@ int libodraw_data_file_descriptor_set_name_wide(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+
+/* Determines the size of the data file from the file system metadata
+ * The data file is not opened, only its file attributes are retrieved
+ * Returns 1 if successful, 0 if the size cannot be determined without opening the file or -1 on error
+ */
+int libodraw_data_file_descriptor_set_size_from_file(
+     libodraw_data_file_descriptor_t *data_file_descriptor,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	WIN32_FILE_ATTRIBUTE_DATA file_attribute_data;
+
+#elif defined( HAVE_STATX ) && defined( STATX_SIZE ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	struct statx file_statistics;
+
+#elif defined( HAVE_STAT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	struct stat file_statistics;
+#endif
+
+	static char *function = "libodraw_data_file_descriptor_set_size_from_file";
+	int result            = 0;
+
+	if( data_file_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	data_file_descriptor->size     = 0;
+	data_file_descriptor->size_set = 0;
+
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( GetFileAttributesExW(
+	     (LPCWSTR) filename,
+	     GetFileExInfoStandard,
+	     (LPVOID) &file_attribute_data ) == 0 )
+#else
+	if( GetFileAttributesExA(
+	     (LPCSTR) filename,
+	     GetFileExInfoStandard,
+	     (LPVOID) &file_attribute_data ) == 0 )
+#endif
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 GetLastError(),
+		 "%s: unable to retrieve file attribute data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_attribute_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) == 0 )
+	{
+		data_file_descriptor->size = ( (size64_t) file_attribute_data.nFileSizeHigh << 32 )
+		                           | file_attribute_data.nFileSizeLow;
+
+		result = 1;
+	}
+#elif defined( HAVE_STATX ) && defined( STATX_SIZE ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* Only request the size and type so that file systems can avoid retrieving other attributes
+	 */
+	if( statx(
+	     AT_FDCWD,
+	     filename,
+	     0,
+	     STATX_TYPE | STATX_SIZE,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( file_statistics.stx_mask & ( STATX_TYPE | STATX_SIZE ) ) == ( STATX_TYPE | STATX_SIZE ) )
+	 && S_ISREG( file_statistics.stx_mode ) )
+	{
+		data_file_descriptor->size = (size64_t) file_statistics.stx_size;
+
+		result = 1;
+	}
+#elif defined( HAVE_STAT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( stat(
+	     filename,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( S_ISREG( file_statistics.st_mode ) )
+	{
+		data_file_descriptor->size = (size64_t) file_statistics.st_size;
+
+		result = 1;
+	}
+#endif
+	if( result == 1 )
+	{
+		data_file_descriptor->size_set = 1;
+	}
+	return( result );
+}
+
@@ -50,6 +50,18 @@ struct libodraw_data_file_descriptor
 	/* The type
 	 */
 	uint8_t type;
+
+	/* The size of the data file
+	 */
+	size64_t size;
+
+	/* Value to indicate the size was determined without opening the data file
+	 */
+	uint8_t size_set;
+
+	/* Value to indicate the EDC and ECC of the sectors are regenerated on read, such as for an ECM data file
+	 */
+	uint8_t has_regenerated_checksums;
 };
 
 int libodraw_data_file_descriptor_initialize(
@@ -98,6 +110,11 @@ int libodraw_data_file_descriptor_set_name_wide(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+int libodraw_data_file_descriptor_set_size_from_file(
+     libodraw_data_file_descriptor_t *data_file_descriptor,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
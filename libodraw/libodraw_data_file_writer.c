@@ -0,0 +1,1183 @@
+/*
+ * Data file writer functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libodraw_data_file_writer.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_libcnotify.h"
+#include "libodraw_libcthreads.h"
+
+/* Creates a data file writer
+ * Make sure the value data_file_writer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_data_file_writer_initialize(
+     libodraw_data_file_writer_t **data_file_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_data_file_writer_initialize";
+	int buffer_index      = 0;
+
+	if( data_file_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data file writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_file_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data file writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*data_file_writer = memory_allocate_structure(
+	                     libodraw_data_file_writer_t );
+
+	if( *data_file_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data file writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *data_file_writer,
+	     0,
+	     sizeof( libodraw_data_file_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data file writer.",
+		 function );
+
+		memory_free(
+		 *data_file_writer );
+
+		*data_file_writer = NULL;
+
+		return( -1 );
+	}
+	( *data_file_writer )->file_descriptor = -1;
+
+	for( buffer_index = 0;
+	     buffer_index < LIBODRAW_DATA_FILE_WRITER_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+#if defined( memory_allocate_aligned )
+		if( memory_allocate_aligned(
+		     (void **) &( ( *data_file_writer )->buffers[ buffer_index ].data ),
+		     LIBODRAW_DATA_FILE_WRITER_BUFFER_SIZE,
+		     LIBODRAW_DATA_FILE_WRITER_BUFFER_ALIGNMENT ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create aligned write buffer: %d.",
+			 function,
+			 buffer_index );
+
+			( *data_file_writer )->buffers[ buffer_index ].data = NULL;
+
+			goto on_error;
+		}
+#else
+		( *data_file_writer )->buffers[ buffer_index ].data = (uint8_t *) memory_allocate(
+		                                                                   sizeof( uint8_t ) * LIBODRAW_DATA_FILE_WRITER_BUFFER_SIZE );
+
+		if( ( *data_file_writer )->buffers[ buffer_index ].data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create write buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+#endif /* defined( memory_allocate_aligned ) */
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *data_file_writer )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *data_file_writer )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *data_file_writer != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *data_file_writer )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *data_file_writer )->mutex ),
+			 NULL );
+		}
+#endif
+		for( buffer_index = 0;
+		     buffer_index < LIBODRAW_DATA_FILE_WRITER_NUMBER_OF_BUFFERS;
+		     buffer_index++ )
+		{
+			if( ( *data_file_writer )->buffers[ buffer_index ].data != NULL )
+			{
+				memory_free(
+				 ( *data_file_writer )->buffers[ buffer_index ].data );
+			}
+		}
+		memory_free(
+		 *data_file_writer );
+
+		*data_file_writer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a data file writer
+ * A data file that is still open is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_data_file_writer_free(
+     libodraw_data_file_writer_t **data_file_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_data_file_writer_free";
+	int buffer_index      = 0;
+	int result            = 1;
+
+	if( data_file_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data file writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_file_writer != NULL )
+	{
+		if( ( *data_file_writer )->file_descriptor != -1 )
+		{
+			if( libodraw_data_file_writer_close(
+			     *data_file_writer,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close data file writer.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *data_file_writer )->write_thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *data_file_writer )->write_thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join write thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		for( buffer_index = 0;
+		     buffer_index < LIBODRAW_DATA_FILE_WRITER_NUMBER_OF_BUFFERS;
+		     buffer_index++ )
+		{
+			if( ( *data_file_writer )->buffers[ buffer_index ].data != NULL )
+			{
+				memory_free(
+				 ( *data_file_writer )->buffers[ buffer_index ].data );
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_free(
+		     &( ( *data_file_writer )->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *data_file_writer )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *data_file_writer );
+
+		*data_file_writer = NULL;
+	}
+	return( result );
+}
+
+/* Opens (creates) a data file for writing
+ * The data file is pre-sized to the maximum data size, if supported by the file system,
+ * so that the file system can allocate contiguous blocks and running out of space
+ * is detected before the data is written
+ * Direct IO is used if requested and supported, otherwise the data is written via the page cache
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_data_file_writer_open(
+     libodraw_data_file_writer_t *data_file_writer,
+     const system_character_t *filename,
+     size64_t maximum_data_size,
+     uint8_t use_direct_io,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_data_file_writer_open";
+
+#if defined( HAVE_FCNTL_H ) && defined( HAVE_UNISTD_H ) && defined( HAVE_PWRITE ) && defined( HAVE_FTRUNCATE ) && !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int buffer_index      = 0;
+	int file_descriptor   = -1;
+	int flags             = 0;
+
+#if defined( HAVE_POSIX_FALLOCATE )
+	int result            = 0;
+#endif
+#endif
+
+	if( data_file_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data file writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_file_writer->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data file writer - file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_data_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_FCNTL_H ) && defined( HAVE_UNISTD_H ) && defined( HAVE_PWRITE ) && defined( HAVE_FTRUNCATE ) && !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#if !defined( O_DIRECT ) || !defined( memory_allocate_aligned )
+	/* Direct IO requires aligned buffers
+	 */
+	use_direct_io = 0;
+#endif
+	flags = O_WRONLY | O_CREAT | O_TRUNC;
+
+#if defined( O_CLOEXEC )
+	flags |= O_CLOEXEC;
+#endif
+#if defined( O_DIRECT ) && defined( memory_allocate_aligned )
+	if( use_direct_io != 0 )
+	{
+		file_descriptor = open(
+		                   filename,
+		                   flags | O_DIRECT,
+		                   0644 );
+
+		/* Not all file systems support direct IO
+		 */
+		if( ( file_descriptor == -1 )
+		 && ( errno == EINVAL ) )
+		{
+			use_direct_io = 0;
+		}
+	}
+	if( use_direct_io == 0 )
+#endif
+	{
+		file_descriptor = open(
+		                   filename,
+		                   flags,
+		                   0644 );
+	}
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+#if defined( HAVE_POSIX_FALLOCATE )
+	if( maximum_data_size > 0 )
+	{
+		result = posix_fallocate(
+		          file_descriptor,
+		          0,
+		          (off_t) maximum_data_size );
+
+		/* Pre-sizing is an optimization, except for running out of space
+		 */
+		if( result == ENOSPC )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 result,
+			 "%s: unable to allocate: %" PRIu64 " bytes for file: %" PRIs_SYSTEM ".",
+			 function,
+			 maximum_data_size,
+			 filename );
+
+			close(
+			 file_descriptor );
+
+			return( -1 );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( result != 0 )
+		 && ( libcnotify_verbose != 0 ) )
+		{
+			libcnotify_printf(
+			 "%s: unable to pre-size file: %" PRIs_SYSTEM " with error: %d.\n",
+			 function,
+			 filename,
+			 result );
+		}
+#endif
+	}
+#endif /* defined( HAVE_POSIX_FALLOCATE ) */
+
+	data_file_writer->file_descriptor = file_descriptor;
+	data_file_writer->use_direct_io   = use_direct_io;
+	data_file_writer->buffer_index    = 0;
+	data_file_writer->data_size       = 0;
+	data_file_writer->write_failed    = 0;
+
+	for( buffer_index = 0;
+	     buffer_index < LIBODRAW_DATA_FILE_WRITER_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		data_file_writer->buffers[ buffer_index ].data_size  = 0;
+		data_file_writer->buffers[ buffer_index ].offset     = 0;
+		data_file_writer->buffers[ buffer_index ].is_pending = 0;
+	}
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: writing data files is not supported on this platform.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
+/* Closes a data file
+ * The buffered data is written and the data file is truncated to the size of the data written
+ * Returns 0 if successful or -1 on error
+ */
+int libodraw_data_file_writer_close(
+     libodraw_data_file_writer_t *data_file_writer,
+     libcerror_error_t **error )
+{
+	libodraw_data_file_writer_buffer_t *write_buffer = NULL;
+	static char *function                            = "libodraw_data_file_writer_close";
+	size_t write_size                                = 0;
+	uint32_t error_code                              = 0;
+	int buffer_index                                 = 0;
+	int result                                       = 0;
+
+	if( data_file_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data file writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_file_writer->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data file writer - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < LIBODRAW_DATA_FILE_WRITER_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( libodraw_data_file_writer_wait_for_buffer(
+		     data_file_writer,
+		     &( data_file_writer->buffers[ buffer_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffer: %d.",
+			 function,
+			 buffer_index );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( data_file_writer->write_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( data_file_writer->write_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join write thread pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	write_buffer = &( data_file_writer->buffers[ data_file_writer->buffer_index ] );
+
+	if( ( result == 0 )
+	 && ( write_buffer->data_size > 0 ) )
+	{
+		write_size = write_buffer->data_size;
+
+		/* Direct IO requires the size of the last write to be aligned
+		 * the padding is removed when the data file is truncated
+		 */
+		if( data_file_writer->use_direct_io != 0 )
+		{
+			if( ( write_size % LIBODRAW_DATA_FILE_WRITER_BUFFER_ALIGNMENT ) != 0 )
+			{
+				write_size += LIBODRAW_DATA_FILE_WRITER_BUFFER_ALIGNMENT - ( write_size % LIBODRAW_DATA_FILE_WRITER_BUFFER_ALIGNMENT );
+			}
+			if( memory_set(
+			     &( write_buffer->data[ write_buffer->data_size ] ),
+			     0,
+			     write_size - write_buffer->data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear write buffer padding.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( result == 0 )
+		{
+			if( libodraw_data_file_writer_write_pending_buffer(
+			     data_file_writer,
+			     write_buffer,
+			     write_size,
+			     &error_code ) != 1 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 error_code,
+				 "%s: unable to write last buffer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		write_buffer->data_size = 0;
+	}
+#if defined( HAVE_FTRUNCATE ) && !defined( WINAPI )
+	if( result == 0 )
+	{
+		/* Removes the padding of the last write and the space that was pre-sized but not written
+		 */
+		if( ftruncate(
+		     data_file_writer->file_descriptor,
+		     (off_t) data_file_writer->data_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 errno,
+			 "%s: unable to truncate file.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+#if defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+	if( close(
+	     data_file_writer->file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	data_file_writer->file_descriptor = -1;
+
+	return( result );
+}
+
+/* Writes a buffer to the data file
+ * The data is copied into the write buffer, a full write buffer is written
+ * while the data is copied into the next write buffer
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libodraw_data_file_writer_write_buffer(
+         libodraw_data_file_writer_t *data_file_writer,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	libodraw_data_file_writer_buffer_t *write_buffer = NULL;
+	static char *function                            = "libodraw_data_file_writer_write_buffer";
+	size_t buffer_offset                             = 0;
+	size_t copy_size                                 = 0;
+
+	if( data_file_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data file writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_file_writer->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data file writer - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < size )
+	{
+		write_buffer = &( data_file_writer->buffers[ data_file_writer->buffer_index ] );
+
+		copy_size = LIBODRAW_DATA_FILE_WRITER_BUFFER_SIZE - write_buffer->data_size;
+
+		if( copy_size > ( size - buffer_offset ) )
+		{
+			copy_size = size - buffer_offset;
+		}
+		if( memory_copy(
+		     &( write_buffer->data[ write_buffer->data_size ] ),
+		     &( buffer[ buffer_offset ] ),
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to write buffer.",
+			 function );
+
+			return( -1 );
+		}
+		write_buffer->data_size      += copy_size;
+		data_file_writer->data_size += copy_size;
+		buffer_offset               += copy_size;
+
+		if( write_buffer->data_size == LIBODRAW_DATA_FILE_WRITER_BUFFER_SIZE )
+		{
+			if( libodraw_data_file_writer_queue_buffer(
+			     data_file_writer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( (ssize_t) size );
+}
+
+/* Writes the data of a write buffer to the data file
+ * This function is called by the write thread as well and therefore does not set an error
+ * Returns 1 if successful or -1 on error, in which case the error code is set
+ */
+int libodraw_data_file_writer_write_pending_buffer(
+     libodraw_data_file_writer_t *data_file_writer,
+     libodraw_data_file_writer_buffer_t *write_buffer,
+     size_t write_size,
+     uint32_t *error_code )
+{
+#if defined( HAVE_PWRITE ) && !defined( WINAPI )
+	size_t data_offset  = 0;
+	ssize_t write_count = 0;
+#endif
+
+	if( ( data_file_writer == NULL )
+	 || ( write_buffer == NULL )
+	 || ( error_code == NULL ) )
+	{
+		return( -1 );
+	}
+#if defined( HAVE_PWRITE ) && !defined( WINAPI )
+	while( data_offset < write_size )
+	{
+		write_count = pwrite(
+		               data_file_writer->file_descriptor,
+		               &( write_buffer->data[ data_offset ] ),
+		               write_size - data_offset,
+		               (off_t) ( write_buffer->offset + data_offset ) );
+
+		if( write_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			*error_code = (uint32_t) errno;
+
+			return( -1 );
+		}
+		else if( write_count == 0 )
+		{
+			*error_code = (uint32_t) EIO;
+
+			return( -1 );
+		}
+		data_offset += (size_t) write_count;
+	}
+	return( 1 );
+#else
+	*error_code = 0;
+
+	return( -1 );
+#endif
+}
+
+/* Writes the write buffer that is being filled and continues with the next write buffer
+ * In multi-thread builds the write buffer is written by the write thread
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_data_file_writer_queue_buffer(
+     libodraw_data_file_writer_t *data_file_writer,
+     libcerror_error_t **error )
+{
+	libodraw_data_file_writer_buffer_t *next_write_buffer = NULL;
+	libodraw_data_file_writer_buffer_t *write_buffer      = NULL;
+	static char *function                                 = "libodraw_data_file_writer_queue_buffer";
+
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	uint32_t error_code                                   = 0;
+#endif
+
+	if( data_file_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data file writer.",
+		 function );
+
+		return( -1 );
+	}
+	write_buffer = &( data_file_writer->buffers[ data_file_writer->buffer_index ] );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( data_file_writer->write_thread_pool == NULL )
+	{
+		/* A single thread writes the buffers so that the writes remain sequential
+		 */
+		if( libcthreads_thread_pool_create(
+		     &( data_file_writer->write_thread_pool ),
+		     NULL,
+		     1,
+		     LIBODRAW_DATA_FILE_WRITER_NUMBER_OF_BUFFERS,
+		     (int (*)(intptr_t *, void *)) &libodraw_data_file_writer_write_callback,
+		     (void *) data_file_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create write thread pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_grab(
+	     data_file_writer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	write_buffer->is_pending = 1;
+
+	if( libcthreads_mutex_release(
+	     data_file_writer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_thread_pool_push(
+	     data_file_writer->write_thread_pool,
+	     (intptr_t *) write_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push write buffer onto write queue.",
+		 function );
+
+		write_buffer->is_pending = 0;
+
+		return( -1 );
+	}
+#else
+	if( libodraw_data_file_writer_write_pending_buffer(
+	     data_file_writer,
+	     write_buffer,
+	     write_buffer->data_size,
+	     &error_code ) != 1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 error_code,
+		 "%s: unable to write buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 write_buffer->offset,
+		 write_buffer->offset );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	data_file_writer->buffer_index += 1;
+
+	if( data_file_writer->buffer_index >= LIBODRAW_DATA_FILE_WRITER_NUMBER_OF_BUFFERS )
+	{
+		data_file_writer->buffer_index = 0;
+	}
+	next_write_buffer = &( data_file_writer->buffers[ data_file_writer->buffer_index ] );
+
+	if( libodraw_data_file_writer_wait_for_buffer(
+	     data_file_writer,
+	     next_write_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer: %d.",
+		 function,
+		 data_file_writer->buffer_index );
+
+		return( -1 );
+	}
+	next_write_buffer->data_size = 0;
+	next_write_buffer->offset    = write_buffer->offset + write_buffer->data_size;
+
+	return( 1 );
+}
+
+/* Waits for a pending write buffer to be written
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_data_file_writer_wait_for_buffer(
+     libodraw_data_file_writer_t *data_file_writer,
+     libodraw_data_file_writer_buffer_t *write_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_data_file_writer_wait_for_buffer";
+	uint32_t error_code   = 0;
+	uint8_t write_failed  = 0;
+
+	if( data_file_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data file writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write buffer.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     data_file_writer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( write_buffer->is_pending != 0 )
+	{
+		if( libcthreads_condition_wait(
+		     data_file_writer->condition,
+		     data_file_writer->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 data_file_writer->mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+#endif
+	write_failed = data_file_writer->write_failed;
+	error_code   = data_file_writer->write_error_code;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     data_file_writer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* A failed write is reported by every subsequent write since the data file is incomplete
+	 */
+	if( write_failed != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 error_code,
+		 "%s: unable to write data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Writes a write buffer on the write thread
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_data_file_writer_write_callback(
+     libodraw_data_file_writer_buffer_t *write_buffer,
+     libodraw_data_file_writer_t *data_file_writer )
+{
+	uint32_t error_code = 0;
+	int result          = 0;
+
+	if( write_buffer == NULL )
+	{
+		return( -1 );
+	}
+	if( data_file_writer == NULL )
+	{
+		return( -1 );
+	}
+	result = libodraw_data_file_writer_write_pending_buffer(
+	          data_file_writer,
+	          write_buffer,
+	          write_buffer->data_size,
+	          &error_code );
+
+	if( libcthreads_mutex_grab(
+	     data_file_writer->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		data_file_writer->write_failed     = 1;
+		data_file_writer->write_error_code = error_code;
+	}
+	write_buffer->is_pending = 0;
+
+	result = libcthreads_condition_broadcast(
+	          data_file_writer->condition,
+	          NULL );
+
+	if( libcthreads_mutex_release(
+	     data_file_writer->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Retrieves the size of the data written
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_data_file_writer_get_data_size(
+     libodraw_data_file_writer_t *data_file_writer,
+     size64_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_data_file_writer_get_data_size";
+
+	if( data_file_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data file writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = data_file_writer->data_size;
+
+	return( 1 );
+}
+
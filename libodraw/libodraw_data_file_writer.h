@@ -0,0 +1,177 @@
+/*
+ * Data file writer functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_DATA_FILE_WRITER_H )
+#define _LIBODRAW_DATA_FILE_WRITER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+#include "libodraw_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a write buffer, which is a multiple of the sector sizes of 2048 and 2352 bytes
+ */
+#define LIBODRAW_DATA_FILE_WRITER_BUFFER_SIZE			( 2048 * 2352 )
+
+/* The alignment of the write buffers and of the size of direct writes
+ */
+#define LIBODRAW_DATA_FILE_WRITER_BUFFER_ALIGNMENT		4096
+
+/* The number of write buffers, one is filled while the other is written
+ */
+#define LIBODRAW_DATA_FILE_WRITER_NUMBER_OF_BUFFERS		2
+
+typedef struct libodraw_data_file_writer libodraw_data_file_writer_t;
+
+typedef struct libodraw_data_file_writer_buffer libodraw_data_file_writer_buffer_t;
+
+struct libodraw_data_file_writer_buffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The offset of the data in the data file
+	 */
+	off64_t offset;
+
+	/* Value to indicate the buffer is being written
+	 */
+	uint8_t is_pending;
+};
+
+/* The data file writer writes a data file sequentially using large aligned buffers
+ * where in multi-thread builds a full buffer is written on a separate thread
+ * while the other buffer is being filled
+ */
+struct libodraw_data_file_writer
+{
+	/* The file descriptor
+	 */
+	int file_descriptor;
+
+	/* Value to indicate the file was opened with direct IO
+	 */
+	uint8_t use_direct_io;
+
+	/* The write buffers
+	 */
+	libodraw_data_file_writer_buffer_t buffers[ LIBODRAW_DATA_FILE_WRITER_NUMBER_OF_BUFFERS ];
+
+	/* The index of the buffer that is being filled
+	 */
+	int buffer_index;
+
+	/* The size of the data written
+	 */
+	size64_t data_size;
+
+	/* Value to indicate writing a buffer failed
+	 */
+	uint8_t write_failed;
+
+	/* The (system) error code of the failed write
+	 */
+	uint32_t write_error_code;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the buffer states
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that signals a pending buffer has been written
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The thread pool that writes the full buffers
+	 */
+	libcthreads_thread_pool_t *write_thread_pool;
+#endif
+};
+
+int libodraw_data_file_writer_initialize(
+     libodraw_data_file_writer_t **data_file_writer,
+     libcerror_error_t **error );
+
+int libodraw_data_file_writer_free(
+     libodraw_data_file_writer_t **data_file_writer,
+     libcerror_error_t **error );
+
+int libodraw_data_file_writer_open(
+     libodraw_data_file_writer_t *data_file_writer,
+     const system_character_t *filename,
+     size64_t maximum_data_size,
+     uint8_t use_direct_io,
+     libcerror_error_t **error );
+
+int libodraw_data_file_writer_close(
+     libodraw_data_file_writer_t *data_file_writer,
+     libcerror_error_t **error );
+
+ssize_t libodraw_data_file_writer_write_buffer(
+         libodraw_data_file_writer_t *data_file_writer,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+int libodraw_data_file_writer_write_pending_buffer(
+     libodraw_data_file_writer_t *data_file_writer,
+     libodraw_data_file_writer_buffer_t *write_buffer,
+     size_t write_size,
+     uint32_t *error_code );
+
+int libodraw_data_file_writer_queue_buffer(
+     libodraw_data_file_writer_t *data_file_writer,
+     libcerror_error_t **error );
+
+int libodraw_data_file_writer_wait_for_buffer(
+     libodraw_data_file_writer_t *data_file_writer,
+     libodraw_data_file_writer_buffer_t *write_buffer,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libodraw_data_file_writer_write_callback(
+     libodraw_data_file_writer_buffer_t *write_buffer,
+     libodraw_data_file_writer_t *data_file_writer );
+
+#endif
+
+int libodraw_data_file_writer_get_data_size(
+     libodraw_data_file_writer_t *data_file_writer,
+     size64_t *data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_DATA_FILE_WRITER_H ) */
+
@@ -0,0 +1,973 @@
+/*
+ * Decoded file IO handle functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_decoded_file_io_handle.h"
+#include "libodraw_libbfio.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_unused.h"
+
+/* Creates a Basic File IO (bfio) handle that exposes the decoded data of a container file
+ * The format specific decoding is provided by the decoded file callback functions
+ * The handle takes over management of the file IO handle on success
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_decoded_file_io_handle_initialize_handle(
+     libbfio_handle_t **handle,
+     libbfio_handle_t *file_io_handle,
+     int (*initialize_decoded_file)(
+            intptr_t **decoded_file,
+            libcerror_error_t **error ),
+     int (*free_decoded_file)(
+            intptr_t **decoded_file,
+            libcerror_error_t **error ),
+     int (*open_read_decoded_file)(
+            intptr_t *decoded_file,
+            libbfio_handle_t *file_io_handle,
+            libcerror_error_t **error ),
+     ssize_t (*read_buffer_at_offset)(
+                intptr_t *decoded_file,
+                uint8_t *buffer,
+                size_t buffer_size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     int (*get_data_size)(
+            intptr_t *decoded_file,
+            size64_t *data_size,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libodraw_decoded_file_io_handle_t *io_handle = NULL;
+	static char *function                        = "libodraw_decoded_file_io_handle_initialize_handle";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_decoded_file_io_handle_initialize(
+	     &io_handle,
+	     file_io_handle,
+	     initialize_decoded_file,
+	     free_decoded_file,
+	     open_read_decoded_file,
+	     read_buffer_at_offset,
+	     get_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoded file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libodraw_decoded_file_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libodraw_decoded_file_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libodraw_decoded_file_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libodraw_decoded_file_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libodraw_decoded_file_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libodraw_decoded_file_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libodraw_decoded_file_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libodraw_decoded_file_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libodraw_decoded_file_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libodraw_decoded_file_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( io_handle != NULL )
+	{
+		/* The file IO handle remains managed by the caller
+		 */
+		io_handle->file_io_handle = NULL;
+
+		libodraw_decoded_file_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a decoded file IO handle
+ * Make sure the value io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_decoded_file_io_handle_initialize(
+     libodraw_decoded_file_io_handle_t **io_handle,
+     libbfio_handle_t *file_io_handle,
+     int (*initialize_decoded_file)(
+            intptr_t **decoded_file,
+            libcerror_error_t **error ),
+     int (*free_decoded_file)(
+            intptr_t **decoded_file,
+            libcerror_error_t **error ),
+     int (*open_read_decoded_file)(
+            intptr_t *decoded_file,
+            libbfio_handle_t *file_io_handle,
+            libcerror_error_t **error ),
+     ssize_t (*read_buffer_at_offset)(
+                intptr_t *decoded_file,
+                uint8_t *buffer,
+                size_t buffer_size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     int (*get_data_size)(
+            intptr_t *decoded_file,
+            size64_t *data_size,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_decoded_file_io_handle_initialize";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( initialize_decoded_file == NULL )
+	 || ( free_decoded_file == NULL )
+	 || ( open_read_decoded_file == NULL )
+	 || ( read_buffer_at_offset == NULL )
+	 || ( get_data_size == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded file function.",
+		 function );
+
+		return( -1 );
+	}
+	*io_handle = memory_allocate_structure(
+	              libodraw_decoded_file_io_handle_t );
+
+	if( *io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_handle,
+	     0,
+	     sizeof( libodraw_decoded_file_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *io_handle )->file_io_handle          = file_io_handle;
+	( *io_handle )->initialize_decoded_file = initialize_decoded_file;
+	( *io_handle )->free_decoded_file       = free_decoded_file;
+	( *io_handle )->open_read_decoded_file  = open_read_decoded_file;
+	( *io_handle )->read_buffer_at_offset   = read_buffer_at_offset;
+	( *io_handle )->get_data_size           = get_data_size;
+
+	return( 1 );
+
+on_error:
+	if( *io_handle != NULL )
+	{
+		memory_free(
+		 *io_handle );
+
+		*io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a decoded file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_decoded_file_io_handle_free(
+     libodraw_decoded_file_io_handle_t **io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_decoded_file_io_handle_free";
+	int result            = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_handle != NULL )
+	{
+		if( ( *io_handle )->decoded_file != NULL )
+		{
+			if( libodraw_decoded_file_io_handle_close(
+			     *io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( ( *io_handle )->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *io_handle );
+
+		*io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the decoded file IO handle
+ * The clone is not opened
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_decoded_file_io_handle_clone(
+     libodraw_decoded_file_io_handle_t **destination_io_handle,
+     libodraw_decoded_file_io_handle_t *source_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libodraw_decoded_file_io_handle_clone";
+
+	if( destination_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_io_handle == NULL )
+	{
+		*destination_io_handle = NULL;
+
+		return( 1 );
+	}
+	if( libbfio_handle_clone(
+	     &file_io_handle,
+	     source_io_handle->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_decoded_file_io_handle_initialize(
+	     destination_io_handle,
+	     file_io_handle,
+	     source_io_handle->initialize_decoded_file,
+	     source_io_handle->free_decoded_file,
+	     source_io_handle->open_read_decoded_file,
+	     source_io_handle->read_buffer_at_offset,
+	     source_io_handle->get_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens the decoded file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_decoded_file_io_handle_open(
+     libodraw_decoded_file_io_handle_t *io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_decoded_file_io_handle_open";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->decoded_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - decoded file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access to decoded file not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_open(
+	     io_handle->file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( io_handle->initialize_decoded_file(
+	     &( io_handle->decoded_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoded file.",
+		 function );
+
+		goto on_error;
+	}
+	if( io_handle->open_read_decoded_file(
+	     io_handle->decoded_file,
+	     io_handle->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read decoded file.",
+		 function );
+
+		goto on_error;
+	}
+	io_handle->current_offset = 0;
+	io_handle->access_flags   = access_flags;
+
+	return( 1 );
+
+on_error:
+	if( io_handle->decoded_file != NULL )
+	{
+		io_handle->free_decoded_file(
+		 &( io_handle->decoded_file ),
+		 NULL );
+	}
+	libbfio_handle_close(
+	 io_handle->file_io_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Closes the decoded file IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int libodraw_decoded_file_io_handle_close(
+     libodraw_decoded_file_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_decoded_file_io_handle_close";
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->decoded_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing decoded file.",
+		 function );
+
+		return( -1 );
+	}
+	/* The decoded file is freed before the file IO handle is closed
+	 * since freeing it can wait for read-ahead threads that use the file IO handle
+	 */
+	if( io_handle->free_decoded_file(
+	     &( io_handle->decoded_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free decoded file.",
+		 function );
+
+		result = -1;
+	}
+	if( libbfio_handle_close(
+	     io_handle->file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	io_handle->current_offset = 0;
+	io_handle->access_flags   = 0;
+
+	return( result );
+}
+
+/* Reads a buffer from the decoded file IO handle
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libodraw_decoded_file_io_handle_read(
+         libodraw_decoded_file_io_handle_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libodraw_decoded_file_io_handle_read";
+	ssize_t read_count    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = io_handle->read_buffer_at_offset(
+	              io_handle->decoded_file,
+	              buffer,
+	              size,
+	              io_handle->current_offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from decoded file at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 io_handle->current_offset,
+		 io_handle->current_offset );
+
+		return( -1 );
+	}
+	io_handle->current_offset += (off64_t) read_count;
+
+	return( read_count );
+}
+
+/* Writes a buffer to the decoded file IO handle
+ * Returns -1 since writing is not supported
+ */
+ssize_t libodraw_decoded_file_io_handle_write(
+         libodraw_decoded_file_io_handle_t *io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libodraw_decoded_file_io_handle_write";
+
+	LIBODRAW_UNREFERENCED_PARAMETER( io_handle )
+	LIBODRAW_UNREFERENCED_PARAMETER( buffer )
+	LIBODRAW_UNREFERENCED_PARAMETER( size )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: write to decoded file not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset within the decoded file IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libodraw_decoded_file_io_handle_seek_offset(
+         libodraw_decoded_file_io_handle_t *io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libodraw_decoded_file_io_handle_seek_offset";
+	size64_t data_size    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->get_data_size(
+	     io_handle->decoded_file,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve decoded file data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) data_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if the decoded file exists
+ * Returns 1 if the file exists, 0 if not or -1 on error
+ */
+int libodraw_decoded_file_io_handle_exists(
+     libodraw_decoded_file_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_decoded_file_io_handle_exists";
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_exists(
+	          io_handle->file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file exists.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Check if the decoded file IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libodraw_decoded_file_io_handle_is_open(
+     libodraw_decoded_file_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_decoded_file_io_handle_is_open";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->decoded_file == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the decoded data
+ * The decoded file is opened temporarily if necessary
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_decoded_file_io_handle_get_size(
+     libodraw_decoded_file_io_handle_t *io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_decoded_file_io_handle_get_size";
+	int is_open           = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	is_open = ( io_handle->decoded_file != NULL );
+
+	if( is_open == 0 )
+	{
+		if( libodraw_decoded_file_io_handle_open(
+		     io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open IO handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( io_handle->get_data_size(
+	     io_handle->decoded_file,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve decoded file data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( is_open == 0 )
+	{
+		if( libodraw_decoded_file_io_handle_close(
+		     io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close IO handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( is_open == 0 )
+	{
+		libodraw_decoded_file_io_handle_close(
+		 io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines if a filename has a specific extension
+ * The extension, such as ".chd", is expected to be in lower case and is matched case insensitive
+ * Returns 1 if the filename has the extension or 0 if not
+ */
+int libodraw_decoded_file_io_handle_filename_has_extension(
+     const char *filename,
+     size_t filename_length,
+     const char *extension,
+     size_t extension_length )
+{
+	size_t extension_index = 0;
+	char character         = 0;
+
+	if( ( filename == NULL )
+	 || ( extension == NULL )
+	 || ( extension_length == 0 )
+	 || ( filename_length < extension_length ) )
+	{
+		return( 0 );
+	}
+	filename += filename_length - extension_length;
+
+	for( extension_index = 0;
+	     extension_index < extension_length;
+	     extension_index++ )
+	{
+		character = filename[ extension_index ];
+
+		if( ( character >= 'A' )
+		 && ( character <= 'Z' ) )
+		{
+			character = (char) ( character - 'A' + 'a' );
+		}
+		if( character != extension[ extension_index ] )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Determines if a filename has a specific extension
+ * The extension, such as ".chd", is expected to be in lower case and is matched case insensitive
+ * Returns 1 if the filename has the extension or 0 if not
+ */
+int libodraw_decoded_file_io_handle_filename_has_extension_wide(
+     const wchar_t *filename,
+     size_t filename_length,
+     const char *extension,
+     size_t extension_length )
+{
+	size_t extension_index = 0;
+	wchar_t character      = 0;
+
+	if( ( filename == NULL )
+	 || ( extension == NULL )
+	 || ( extension_length == 0 )
+	 || ( filename_length < extension_length ) )
+	{
+		return( 0 );
+	}
+	filename += filename_length - extension_length;
+
+	for( extension_index = 0;
+	     extension_index < extension_length;
+	     extension_index++ )
+	{
+		character = filename[ extension_index ];
+
+		if( ( character >= (wchar_t) 'A' )
+		 && ( character <= (wchar_t) 'Z' ) )
+		{
+			character = (wchar_t) ( character - (wchar_t) 'A' + (wchar_t) 'a' );
+		}
+		if( character != (wchar_t) extension[ extension_index ] )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
@@ -0,0 +1,214 @@
+/*
+ * Decoded file IO handle functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_DECODED_FILE_IO_HANDLE_H )
+#define _LIBODRAW_DECODED_FILE_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libbfio.h"
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libodraw_decoded_file_io_handle libodraw_decoded_file_io_handle_t;
+
+/* The decoded file IO handle exposes the decoded data of a container file,
+ * such as a CHD, ECM or seekable zstd file, as a Basic File IO (bfio) handle
+ */
+struct libodraw_decoded_file_io_handle
+{
+	/* The file IO handle of the container file
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The decoded file
+	 */
+	intptr_t *decoded_file;
+
+	/* The decoded file initialize function
+	 */
+	int (*initialize_decoded_file)(
+	       intptr_t **decoded_file,
+	       libcerror_error_t **error );
+
+	/* The decoded file free function
+	 */
+	int (*free_decoded_file)(
+	       intptr_t **decoded_file,
+	       libcerror_error_t **error );
+
+	/* The decoded file open read function
+	 */
+	int (*open_read_decoded_file)(
+	       intptr_t *decoded_file,
+	       libbfio_handle_t *file_io_handle,
+	       libcerror_error_t **error );
+
+	/* The decoded file read buffer at offset function
+	 */
+	ssize_t (*read_buffer_at_offset)(
+	           intptr_t *decoded_file,
+	           uint8_t *buffer,
+	           size_t buffer_size,
+	           off64_t offset,
+	           libcerror_error_t **error );
+
+	/* The decoded file get data size function
+	 */
+	int (*get_data_size)(
+	       intptr_t *decoded_file,
+	       size64_t *data_size,
+	       libcerror_error_t **error );
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The access flags
+	 */
+	int access_flags;
+};
+
+int libodraw_decoded_file_io_handle_initialize_handle(
+     libbfio_handle_t **handle,
+     libbfio_handle_t *file_io_handle,
+     int (*initialize_decoded_file)(
+            intptr_t **decoded_file,
+            libcerror_error_t **error ),
+     int (*free_decoded_file)(
+            intptr_t **decoded_file,
+            libcerror_error_t **error ),
+     int (*open_read_decoded_file)(
+            intptr_t *decoded_file,
+            libbfio_handle_t *file_io_handle,
+            libcerror_error_t **error ),
+     ssize_t (*read_buffer_at_offset)(
+                intptr_t *decoded_file,
+                uint8_t *buffer,
+                size_t buffer_size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     int (*get_data_size)(
+            intptr_t *decoded_file,
+            size64_t *data_size,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libodraw_decoded_file_io_handle_initialize(
+     libodraw_decoded_file_io_handle_t **io_handle,
+     libbfio_handle_t *file_io_handle,
+     int (*initialize_decoded_file)(
+            intptr_t **decoded_file,
+            libcerror_error_t **error ),
+     int (*free_decoded_file)(
+            intptr_t **decoded_file,
+            libcerror_error_t **error ),
+     int (*open_read_decoded_file)(
+            intptr_t *decoded_file,
+            libbfio_handle_t *file_io_handle,
+            libcerror_error_t **error ),
+     ssize_t (*read_buffer_at_offset)(
+                intptr_t *decoded_file,
+                uint8_t *buffer,
+                size_t buffer_size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     int (*get_data_size)(
+            intptr_t *decoded_file,
+            size64_t *data_size,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libodraw_decoded_file_io_handle_free(
+     libodraw_decoded_file_io_handle_t **io_handle,
+     libcerror_error_t **error );
+
+int libodraw_decoded_file_io_handle_clone(
+     libodraw_decoded_file_io_handle_t **destination_io_handle,
+     libodraw_decoded_file_io_handle_t *source_io_handle,
+     libcerror_error_t **error );
+
+int libodraw_decoded_file_io_handle_open(
+     libodraw_decoded_file_io_handle_t *io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libodraw_decoded_file_io_handle_close(
+     libodraw_decoded_file_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+ssize_t libodraw_decoded_file_io_handle_read(
+         libodraw_decoded_file_io_handle_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libodraw_decoded_file_io_handle_write(
+         libodraw_decoded_file_io_handle_t *io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libodraw_decoded_file_io_handle_seek_offset(
+         libodraw_decoded_file_io_handle_t *io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libodraw_decoded_file_io_handle_exists(
+     libodraw_decoded_file_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libodraw_decoded_file_io_handle_is_open(
+     libodraw_decoded_file_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libodraw_decoded_file_io_handle_get_size(
+     libodraw_decoded_file_io_handle_t *io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int libodraw_decoded_file_io_handle_filename_has_extension(
+     const char *filename,
+     size_t filename_length,
+     const char *extension,
+     size_t extension_length );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libodraw_decoded_file_io_handle_filename_has_extension_wide(
+     const wchar_t *filename,
+     size_t filename_length,
+     const char *extension,
+     size_t extension_length );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_DECODED_FILE_IO_HANDLE_H ) */
+
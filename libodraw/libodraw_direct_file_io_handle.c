@@ -0,0 +1,1417 @@
+/*
+ * Direct file IO handle functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libodraw_direct_file_io_handle.h"
+#include "libodraw_libbfio.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_unused.h"
+
+/* Creates a Basic File IO (bfio) handle that reads a file bypassing the page cache
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_direct_file_io_handle_initialize_handle(
+     libbfio_handle_t **handle,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	libodraw_direct_file_io_handle_t *io_handle = NULL;
+	static char *function                        = "libodraw_direct_file_io_handle_initialize_handle";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_direct_file_io_handle_initialize(
+	     &io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create direct file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_direct_file_io_handle_set_name(
+	     io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in direct file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libodraw_direct_file_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libodraw_direct_file_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libodraw_direct_file_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libodraw_direct_file_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libodraw_direct_file_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libodraw_direct_file_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libodraw_direct_file_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libodraw_direct_file_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libodraw_direct_file_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libodraw_direct_file_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( io_handle != NULL )
+	{
+		libodraw_direct_file_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a direct file IO handle
+ * Make sure the value io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_direct_file_io_handle_initialize(
+     libodraw_direct_file_io_handle_t **io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_direct_file_io_handle_initialize";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*io_handle = memory_allocate_structure(
+	              libodraw_direct_file_io_handle_t );
+
+	if( *io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_handle,
+	     0,
+	     sizeof( libodraw_direct_file_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *io_handle )->file_descriptor = -1;
+
+	return( 1 );
+
+on_error:
+	if( *io_handle != NULL )
+	{
+		memory_free(
+		 *io_handle );
+
+		*io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a direct file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_direct_file_io_handle_free(
+     libodraw_direct_file_io_handle_t **io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_direct_file_io_handle_free";
+	int result            = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_handle != NULL )
+	{
+		if( ( *io_handle )->file_descriptor != -1 )
+		{
+			if( libodraw_direct_file_io_handle_close(
+			     *io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->block_data != NULL )
+		{
+			memory_free(
+			 ( *io_handle )->block_data );
+		}
+		if( ( *io_handle )->name != NULL )
+		{
+			memory_free(
+			 ( *io_handle )->name );
+		}
+		memory_free(
+		 *io_handle );
+
+		*io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the direct file IO handle
+ * The clone is not opened
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_direct_file_io_handle_clone(
+     libodraw_direct_file_io_handle_t **destination_io_handle,
+     libodraw_direct_file_io_handle_t *source_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_direct_file_io_handle_clone";
+
+	if( destination_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_io_handle == NULL )
+	{
+		*destination_io_handle = NULL;
+
+		return( 1 );
+	}
+	if( libodraw_direct_file_io_handle_initialize(
+	     destination_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_io_handle->name != NULL )
+	{
+		if( libodraw_direct_file_io_handle_set_name(
+		     *destination_io_handle,
+		     source_io_handle->name,
+		     source_io_handle->name_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set name in destination IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_io_handle != NULL )
+	{
+		libodraw_direct_file_io_handle_free(
+		 destination_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the name of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_direct_file_io_handle_set_name(
+     libodraw_direct_file_io_handle_t *io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_direct_file_io_handle_set_name";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length == 0 )
+	 || ( name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->name != NULL )
+	{
+		memory_free(
+		 io_handle->name );
+
+		io_handle->name      = NULL;
+		io_handle->name_size = 0;
+	}
+	io_handle->name = narrow_string_allocate(
+	                   name_length + 1 );
+
+	if( io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		return( -1 );
+	}
+	if( narrow_string_copy(
+	     io_handle->name,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		memory_free(
+		 io_handle->name );
+
+		io_handle->name = NULL;
+
+		return( -1 );
+	}
+	io_handle->name[ name_length ] = 0;
+
+	io_handle->name_size = name_length + 1;
+
+	return( 1 );
+}
+
+/* Opens the direct file IO handle
+ * Direct IO is used if supported by the file system, otherwise the pages that have
+ * been read are released from the page cache
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_direct_file_io_handle_open(
+     libodraw_direct_file_io_handle_t *io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_direct_file_io_handle_open";
+
+#if defined( HAVE_LIBODRAW_DIRECT_FILE_IO_HANDLE )
+	off64_t file_size     = 0;
+	uint8_t use_direct_io = 0;
+	int file_descriptor   = -1;
+	int flags             = 0;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access to direct file not supported.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBODRAW_DIRECT_FILE_IO_HANDLE )
+	flags = O_RDONLY;
+
+#if defined( O_CLOEXEC )
+	flags |= O_CLOEXEC;
+#endif
+#if defined( O_DIRECT ) && defined( memory_allocate_aligned )
+	file_descriptor = open(
+	                   io_handle->name,
+	                   flags | O_DIRECT );
+
+	if( file_descriptor != -1 )
+	{
+		use_direct_io = 1;
+	}
+	/* Not all file systems support direct IO
+	 */
+	else if( errno != EINVAL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 io_handle->name );
+
+		return( -1 );
+	}
+	if( ( use_direct_io != 0 )
+	 && ( io_handle->block_data == NULL ) )
+	{
+		if( memory_allocate_aligned(
+		     (void **) &( io_handle->block_data ),
+		     LIBODRAW_DIRECT_FILE_IO_HANDLE_BLOCK_SIZE,
+		     LIBODRAW_DIRECT_FILE_IO_HANDLE_ALIGNMENT ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create aligned block buffer.",
+			 function );
+
+			io_handle->block_data = NULL;
+
+			goto on_error;
+		}
+	}
+#endif /* defined( O_DIRECT ) && defined( memory_allocate_aligned ) */
+
+	if( use_direct_io == 0 )
+	{
+		file_descriptor = open(
+		                   io_handle->name,
+		                   flags );
+
+		if( file_descriptor == -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to open file: %s.",
+			 function,
+			 io_handle->name );
+
+			return( -1 );
+		}
+#if defined( HAVE_POSIX_FADVISE ) && defined( POSIX_FADV_SEQUENTIAL )
+		/* The advice is an optimization therefore the result is ignored
+		 */
+		posix_fadvise(
+		 file_descriptor,
+		 0,
+		 0,
+		 POSIX_FADV_SEQUENTIAL );
+#endif
+	}
+	file_size = (off64_t) lseek(
+	                       file_descriptor,
+	                       0,
+	                       SEEK_END );
+
+	if( file_size < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to determine size of file: %s.",
+		 function,
+		 io_handle->name );
+
+		goto on_error;
+	}
+	io_handle->file_descriptor = file_descriptor;
+	io_handle->use_direct_io   = use_direct_io;
+	io_handle->size            = (size64_t) file_size;
+	io_handle->current_offset  = 0;
+	io_handle->block_data_size = 0;
+	io_handle->block_offset    = 0;
+	io_handle->released_offset = 0;
+	io_handle->access_flags    = access_flags;
+
+	return( 1 );
+
+on_error:
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: direct IO is not supported on this platform.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBODRAW_DIRECT_FILE_IO_HANDLE ) */
+}
+
+/* Closes the direct file IO handle
+ * The pages of the file are released from the page cache, if the file was not opened for direct IO
+ * Returns 0 if successful or -1 on error
+ */
+int libodraw_direct_file_io_handle_close(
+     libodraw_direct_file_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_direct_file_io_handle_close";
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBODRAW_DIRECT_FILE_IO_HANDLE )
+#if defined( HAVE_POSIX_FADVISE ) && defined( POSIX_FADV_DONTNEED )
+	if( io_handle->use_direct_io == 0 )
+	{
+		/* The advice is an optimization therefore the result is ignored
+		 */
+		posix_fadvise(
+		 io_handle->file_descriptor,
+		 0,
+		 0,
+		 POSIX_FADV_DONTNEED );
+	}
+#endif
+	if( close(
+	     io_handle->file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file: %s.",
+		 function,
+		 io_handle->name );
+
+		result = -1;
+	}
+#endif /* defined( HAVE_LIBODRAW_DIRECT_FILE_IO_HANDLE ) */
+
+	/* The block buffer is freed so that only open files use memory
+	 */
+	if( io_handle->block_data != NULL )
+	{
+		memory_free(
+		 io_handle->block_data );
+
+		io_handle->block_data = NULL;
+	}
+	io_handle->file_descriptor = -1;
+	io_handle->use_direct_io   = 0;
+	io_handle->size            = 0;
+	io_handle->current_offset  = 0;
+	io_handle->block_data_size = 0;
+	io_handle->block_offset    = 0;
+	io_handle->released_offset = 0;
+	io_handle->access_flags    = 0;
+
+	return( result );
+}
+
+/* Reads a buffer at a specific offset from the file
+ * The offset, size and buffer must be aligned if the file was opened for direct IO
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libodraw_direct_file_io_handle_read_at_offset(
+         libodraw_direct_file_io_handle_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libodraw_direct_file_io_handle_read_at_offset";
+
+#if defined( HAVE_LIBODRAW_DIRECT_FILE_IO_HANDLE )
+	ssize_t read_count    = 0;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBODRAW_DIRECT_FILE_IO_HANDLE )
+	do
+	{
+		read_count = pread(
+		              io_handle->file_descriptor,
+		              buffer,
+		              size,
+		              (off_t) offset );
+	}
+	while( ( read_count == -1 )
+	    && ( errno == EINTR ) );
+
+	if( read_count < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 errno,
+		 "%s: unable to read from file: %s at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 io_handle->name,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: direct IO is not supported on this platform.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBODRAW_DIRECT_FILE_IO_HANDLE ) */
+}
+
+/* Releases the pages behind the current offset from the page cache
+ * The pages are released in chunks of the release size and only
+ * if the file was not opened for direct IO
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_direct_file_io_handle_release_page_cache(
+     libodraw_direct_file_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function  = "libodraw_direct_file_io_handle_release_page_cache";
+	off64_t release_offset = 0;
+
+#if defined( HAVE_LIBODRAW_DIRECT_FILE_IO_HANDLE ) && defined( HAVE_POSIX_FADVISE ) && defined( POSIX_FADV_DONTNEED )
+	int result             = 0;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->file_descriptor == -1 )
+	 || ( io_handle->use_direct_io != 0 ) )
+	{
+		return( 1 );
+	}
+	release_offset = io_handle->current_offset
+	               - ( io_handle->current_offset % LIBODRAW_DIRECT_FILE_IO_HANDLE_ALIGNMENT );
+
+	/* Pages that are read again after a backwards seek are released again
+	 */
+	if( release_offset < io_handle->released_offset )
+	{
+		io_handle->released_offset = release_offset;
+	}
+	if( ( release_offset - io_handle->released_offset ) < LIBODRAW_DIRECT_FILE_IO_HANDLE_RELEASE_SIZE )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBODRAW_DIRECT_FILE_IO_HANDLE ) && defined( HAVE_POSIX_FADVISE ) && defined( POSIX_FADV_DONTNEED )
+	result = posix_fadvise(
+	          io_handle->file_descriptor,
+	          (off_t) io_handle->released_offset,
+	          (off_t) ( release_offset - io_handle->released_offset ),
+	          POSIX_FADV_DONTNEED );
+
+	if( result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 result,
+		 "%s: unable to release pages of file: %s from page cache.",
+		 function,
+		 io_handle->name );
+
+		return( -1 );
+	}
+#endif
+	io_handle->released_offset = release_offset;
+
+	return( 1 );
+}
+
+/* Reads a buffer from the direct file IO handle
+ * If the file was opened for direct IO, aligned parts of the read are read directly
+ * into the buffer and the other parts are read via the aligned block buffer
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libodraw_direct_file_io_handle_read(
+         libodraw_direct_file_io_handle_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function    = "libodraw_direct_file_io_handle_read";
+	size_t block_data_offset = 0;
+	size_t buffer_offset     = 0;
+	size_t read_size         = 0;
+	ssize_t read_count       = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->use_direct_io != 0 )
+	 && ( io_handle->block_data == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing block data.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) io_handle->current_offset >= io_handle->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( io_handle->size - (size64_t) io_handle->current_offset ) )
+	{
+		size = (size_t) ( io_handle->size - (size64_t) io_handle->current_offset );
+	}
+	while( buffer_offset < size )
+	{
+		read_size = size - buffer_offset;
+
+		if( io_handle->use_direct_io == 0 )
+		{
+			read_count = libodraw_direct_file_io_handle_read_at_offset(
+			              io_handle,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              io_handle->current_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				goto on_error;
+			}
+			else if( read_count == 0 )
+			{
+				break;
+			}
+			buffer_offset             += (size_t) read_count;
+			io_handle->current_offset += (off64_t) read_count;
+		}
+		else if( ( io_handle->block_data_size > 0 )
+		      && ( io_handle->current_offset >= io_handle->block_offset )
+		      && ( io_handle->current_offset < (off64_t) ( io_handle->block_offset + io_handle->block_data_size ) ) )
+		{
+			block_data_offset = (size_t) ( io_handle->current_offset - io_handle->block_offset );
+
+			if( read_size > ( io_handle->block_data_size - block_data_offset ) )
+			{
+				read_size = io_handle->block_data_size - block_data_offset;
+			}
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( io_handle->block_data[ block_data_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy block data.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset             += read_size;
+			io_handle->current_offset += (off64_t) read_size;
+		}
+		else if( ( ( (intptr_t) &( buffer[ buffer_offset ] ) % LIBODRAW_DIRECT_FILE_IO_HANDLE_ALIGNMENT ) == 0 )
+		      && ( ( io_handle->current_offset % LIBODRAW_DIRECT_FILE_IO_HANDLE_ALIGNMENT ) == 0 )
+		      && ( read_size >= LIBODRAW_DIRECT_FILE_IO_HANDLE_ALIGNMENT ) )
+		{
+			/* Aligned parts are read directly into the buffer
+			 */
+			read_size -= read_size % LIBODRAW_DIRECT_FILE_IO_HANDLE_ALIGNMENT;
+
+			read_count = libodraw_direct_file_io_handle_read_at_offset(
+			              io_handle,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              io_handle->current_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				goto on_error;
+			}
+			buffer_offset             += (size_t) read_count;
+			io_handle->current_offset += (off64_t) read_count;
+
+			/* A short read is only returned at the end of the file
+			 */
+			if( (size_t) read_count < read_size )
+			{
+				break;
+			}
+		}
+		else
+		{
+			io_handle->block_offset    = io_handle->current_offset
+			                           - ( io_handle->current_offset % LIBODRAW_DIRECT_FILE_IO_HANDLE_ALIGNMENT );
+			io_handle->block_data_size = 0;
+
+			read_count = libodraw_direct_file_io_handle_read_at_offset(
+			              io_handle,
+			              io_handle->block_data,
+			              LIBODRAW_DIRECT_FILE_IO_HANDLE_BLOCK_SIZE,
+			              io_handle->block_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				goto on_error;
+			}
+			io_handle->block_data_size = (size_t) read_count;
+
+			if( (off64_t) read_count <= ( io_handle->current_offset - io_handle->block_offset ) )
+			{
+				break;
+			}
+		}
+	}
+	if( libodraw_direct_file_io_handle_release_page_cache(
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to release page cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( (ssize_t) buffer_offset );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_READ_FAILED,
+	 "%s: unable to read buffer from file at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+	 function,
+	 io_handle->current_offset,
+	 io_handle->current_offset );
+
+	return( -1 );
+}
+
+/* Writes a buffer to the direct file IO handle
+ * Returns -1 since writing is not supported
+ */
+ssize_t libodraw_direct_file_io_handle_write(
+         libodraw_direct_file_io_handle_t *io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libodraw_direct_file_io_handle_write";
+
+	LIBODRAW_UNREFERENCED_PARAMETER( io_handle )
+	LIBODRAW_UNREFERENCED_PARAMETER( buffer )
+	LIBODRAW_UNREFERENCED_PARAMETER( size )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: write to direct file not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset within the direct file IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libodraw_direct_file_io_handle_seek_offset(
+         libodraw_direct_file_io_handle_t *io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libodraw_direct_file_io_handle_seek_offset";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) io_handle->size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if the file exists
+ * Returns 1 if the file exists, 0 if not or -1 on error
+ */
+int libodraw_direct_file_io_handle_exists(
+     libodraw_direct_file_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_direct_file_io_handle_exists";
+
+#if defined( HAVE_LIBODRAW_DIRECT_FILE_IO_HANDLE )
+	int file_descriptor   = -1;
+	int flags             = 0;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor != -1 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBODRAW_DIRECT_FILE_IO_HANDLE )
+	flags = O_RDONLY;
+
+#if defined( O_CLOEXEC )
+	flags |= O_CLOEXEC;
+#endif
+	file_descriptor = open(
+	                   io_handle->name,
+	                   flags );
+
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+
+		return( 1 );
+	}
+	if( errno == EACCES )
+	{
+		return( 1 );
+	}
+	else if( ( errno == ENOENT )
+	      || ( errno == ENOTDIR ) )
+	{
+		return( 0 );
+	}
+	libcerror_system_set_error(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_OPEN_FAILED,
+	 errno,
+	 "%s: unable to open file: %s.",
+	 function,
+	 io_handle->name );
+
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: direct IO is not supported on this platform.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBODRAW_DIRECT_FILE_IO_HANDLE ) */
+}
+
+/* Check if the direct file IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libodraw_direct_file_io_handle_is_open(
+     libodraw_direct_file_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_direct_file_io_handle_is_open";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the file
+ * The file is opened temporarily if necessary
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_direct_file_io_handle_get_size(
+     libodraw_direct_file_io_handle_t *io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_direct_file_io_handle_get_size";
+	int is_open           = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	is_open = ( io_handle->file_descriptor != -1 );
+
+	if( is_open == 0 )
+	{
+		if( libodraw_direct_file_io_handle_open(
+		     io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open IO handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*size = io_handle->size;
+
+	if( is_open == 0 )
+	{
+		if( libodraw_direct_file_io_handle_close(
+		     io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close IO handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,188 @@
+/*
+ * Direct file IO handle functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBODRAW_DIRECT_FILE_IO_HANDLE_H )
+#define _LIBODRAW_DIRECT_FILE_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libbfio.h"
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The direct file IO handle requires POSIX file descriptor based IO
+ */
+#if defined( HAVE_FCNTL_H ) && defined( HAVE_UNISTD_H ) && defined( HAVE_PREAD ) && !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define HAVE_LIBODRAW_DIRECT_FILE_IO_HANDLE			1
+#endif
+
+/* The alignment of the offset, size and buffer of direct reads
+ */
+#define LIBODRAW_DIRECT_FILE_IO_HANDLE_ALIGNMENT		4096
+
+/* The size of the block buffer, which is large enough to sustain the throughput of NVMe storage
+ */
+#define LIBODRAW_DIRECT_FILE_IO_HANDLE_BLOCK_SIZE		( 1024 * 1024 )
+
+/* The size of the data that is read before the pages behind the read cursor are released
+ * from the page cache, when the file could not be opened for direct IO
+ */
+#define LIBODRAW_DIRECT_FILE_IO_HANDLE_RELEASE_SIZE		( 8 * 1024 * 1024 )
+
+typedef struct libodraw_direct_file_io_handle libodraw_direct_file_io_handle_t;
+
+/* The direct file IO handle reads a file bypassing the page cache
+ * as a Basic File IO (bfio) handle
+ */
+struct libodraw_direct_file_io_handle
+{
+	/* The name
+	 */
+	char *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The file descriptor
+	 */
+	int file_descriptor;
+
+	/* Value to indicate the file was opened with direct IO
+	 */
+	uint8_t use_direct_io;
+
+	/* The size of the file
+	 */
+	size64_t size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The aligned block buffer
+	 */
+	uint8_t *block_data;
+
+	/* The size of the data in the block buffer
+	 */
+	size_t block_data_size;
+
+	/* The offset of the data in the block buffer
+	 */
+	off64_t block_offset;
+
+	/* The offset up to which the pages have been released from the page cache
+	 */
+	off64_t released_offset;
+
+	/* The access flags
+	 */
+	int access_flags;
+};
+
+int libodraw_direct_file_io_handle_initialize_handle(
+     libbfio_handle_t **handle,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int libodraw_direct_file_io_handle_initialize(
+     libodraw_direct_file_io_handle_t **io_handle,
+     libcerror_error_t **error );
+
+int libodraw_direct_file_io_handle_free(
+     libodraw_direct_file_io_handle_t **io_handle,
+     libcerror_error_t **error );
+
+int libodraw_direct_file_io_handle_clone(
+     libodraw_direct_file_io_handle_t **destination_io_handle,
+     libodraw_direct_file_io_handle_t *source_io_handle,
+     libcerror_error_t **error );
+
+int libodraw_direct_file_io_handle_set_name(
+     libodraw_direct_file_io_handle_t *io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libodraw_direct_file_io_handle_open(
+     libodraw_direct_file_io_handle_t *io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libodraw_direct_file_io_handle_close(
+     libodraw_direct_file_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+ssize_t libodraw_direct_file_io_handle_read_at_offset(
+         libodraw_direct_file_io_handle_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libodraw_direct_file_io_handle_release_page_cache(
+     libodraw_direct_file_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+ssize_t libodraw_direct_file_io_handle_read(
+         libodraw_direct_file_io_handle_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libodraw_direct_file_io_handle_write(
+         libodraw_direct_file_io_handle_t *io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libodraw_direct_file_io_handle_seek_offset(
+         libodraw_direct_file_io_handle_t *io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libodraw_direct_file_io_handle_exists(
+     libodraw_direct_file_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libodraw_direct_file_io_handle_is_open(
+     libodraw_direct_file_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libodraw_direct_file_io_handle_get_size(
+     libodraw_direct_file_io_handle_t *io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_DIRECT_FILE_IO_HANDLE_H ) */
+
@@ -0,0 +1,1282 @@
+/*
+ * Error Code Modeler (ECM) file functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_checksum.h"
+#include "libodraw_ecm_file.h"
+#include "libodraw_libbfio.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_libcnotify.h"
+#include "libodraw_libcthreads.h"
+
+#include "ecm_file.h"
+
+/* The size of the buffer used to read the record headers
+ */
+#define LIBODRAW_ECM_FILE_RECORDS_BUFFER_SIZE		65536
+
+const uint8_t ecm_file_signature[ 4 ] = { 'E', 'C', 'M', 0x00 };
+
+static uint8_t libodraw_ecm_file_sector_synchronisation_data[ 12 ] = \
+	{ 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00 };
+
+/* The size of an item of the encoded record data per record type
+ */
+static size_t libodraw_ecm_file_encoded_item_sizes[ 4 ] = {
+	1,
+	sizeof( ecm_mode1_sector_t ),
+	sizeof( ecm_mode2_form1_sector_t ),
+	sizeof( ecm_mode2_form2_sector_t ) };
+
+/* The size of an item of the decoded record data per record type
+ * a MODE2 record contains the sector without synchronisation and header
+ */
+static size_t libodraw_ecm_file_decoded_item_sizes[ 4 ] = {
+	1,
+	2352,
+	2336,
+	2336 };
+
+/* Creates an ECM file
+ * Make sure the value ecm_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_ecm_file_initialize(
+     libodraw_ecm_file_t **ecm_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_ecm_file_initialize";
+
+	if( ecm_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ECM file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *ecm_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid ECM file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*ecm_file = memory_allocate_structure(
+	             libodraw_ecm_file_t );
+
+	if( *ecm_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create ECM file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *ecm_file,
+	     0,
+	     sizeof( libodraw_ecm_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear ECM file.",
+		 function );
+
+		memory_free(
+		 *ecm_file );
+
+		*ecm_file = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *ecm_file )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *ecm_file != NULL )
+	{
+		memory_free(
+		 *ecm_file );
+
+		*ecm_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an ECM file
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_ecm_file_free(
+     libodraw_ecm_file_t **ecm_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_ecm_file_free";
+	int result            = 1;
+
+	if( ecm_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ECM file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *ecm_file != NULL )
+	{
+		if( ( *ecm_file )->encoded_data != NULL )
+		{
+			memory_free(
+			 ( *ecm_file )->encoded_data );
+		}
+		if( ( *ecm_file )->record_descriptors != NULL )
+		{
+			memory_free(
+			 ( *ecm_file )->record_descriptors );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *ecm_file )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *ecm_file );
+
+		*ecm_file = NULL;
+	}
+	return( result );
+}
+
+/* Opens an ECM file for reading
+ * The file IO handle must remain open until the ECM file is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_ecm_file_open_read(
+     libodraw_ecm_file_t *ecm_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_ecm_file_open_read";
+
+	if( ecm_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ECM file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ecm_file->record_descriptors != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid ECM file - record descriptors value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_ecm_file_read_records(
+	     ecm_file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read records.",
+		 function );
+
+		return( -1 );
+	}
+	ecm_file->encoded_data = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * LIBODRAW_ECM_FILE_MAXIMUM_NUMBER_OF_READ_SECTORS * sizeof( ecm_mode2_form2_sector_t ) );
+
+	if( ecm_file->encoded_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create encoded data.",
+		 function );
+
+		return( -1 );
+	}
+	ecm_file->file_io_handle = file_io_handle;
+
+	return( 1 );
+}
+
+/* Reads the records
+ * Only the record headers are read, which builds an index of the records
+ * that allows random access to the decoded data
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_ecm_file_read_records(
+     libodraw_ecm_file_t *ecm_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	ecm_file_header_t file_header;
+
+	libodraw_ecm_record_descriptor_t *record_descriptor  = NULL;
+	libodraw_ecm_record_descriptor_t *record_descriptors = NULL;
+	uint8_t *records_data                                = NULL;
+	static char *function                                = "libodraw_ecm_file_read_records";
+	size64_t file_size                                   = 0;
+	size_t records_data_offset                           = 0;
+	size_t records_data_size                             = 0;
+	ssize_t read_count                                   = 0;
+	off64_t file_offset                                  = 0;
+	off64_t records_data_file_offset                     = 0;
+	uint64_t data_offset                                 = 0;
+	uint64_t encoded_data_size                           = 0;
+	uint32_t maximum_number_of_records                   = 0;
+	uint32_t number_of_items                             = 0;
+	uint8_t bit_shift                                    = 0;
+	uint8_t byte_value                                   = 0;
+	uint8_t record_type                                  = 0;
+
+	if( ecm_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ECM file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &file_header,
+	              sizeof( ecm_file_header_t ),
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( ecm_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     file_header.signature,
+	     ecm_file_signature,
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file signature.",
+		 function );
+
+		goto on_error;
+	}
+	records_data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * LIBODRAW_ECM_FILE_RECORDS_BUFFER_SIZE );
+
+	if( records_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create records data.",
+		 function );
+
+		goto on_error;
+	}
+	maximum_number_of_records = 1024;
+
+	ecm_file->record_descriptors = (libodraw_ecm_record_descriptor_t *) memory_allocate(
+	                                                                     sizeof( libodraw_ecm_record_descriptor_t ) * maximum_number_of_records );
+
+	if( ecm_file->record_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	file_offset = (off64_t) sizeof( ecm_file_header_t );
+
+	/* A record header is stored in 1 to 5 bytes, the records data is refilled
+	 * when a record header could cross the end of the buffer
+	 */
+	while( (size64_t) file_offset < file_size )
+	{
+		if( ( file_offset < records_data_file_offset )
+		 || ( file_offset > ( records_data_file_offset + (off64_t) records_data_size ) )
+		 || ( ( ( records_data_file_offset + (off64_t) records_data_size - file_offset ) < 5 )
+		  &&  ( (size64_t) ( records_data_file_offset + (off64_t) records_data_size ) < file_size ) ) )
+		{
+			records_data_size = LIBODRAW_ECM_FILE_RECORDS_BUFFER_SIZE;
+
+			if( (size64_t) records_data_size > ( file_size - (size64_t) file_offset ) )
+			{
+				records_data_size = (size_t) ( file_size - (size64_t) file_offset );
+			}
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              records_data,
+			              records_data_size,
+			              file_offset,
+			              error );
+
+			if( read_count != (ssize_t) records_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read records data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+			records_data_file_offset = file_offset;
+		}
+		records_data_offset = (size_t) ( file_offset - records_data_file_offset );
+
+		byte_value = records_data[ records_data_offset++ ];
+
+		record_type     = byte_value & 0x03;
+		number_of_items = ( byte_value >> 2 ) & 0x1f;
+		bit_shift       = 5;
+
+		while( ( byte_value & 0x80 ) != 0 )
+		{
+			if( ( bit_shift > 31 )
+			 || ( records_data_offset >= records_data_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid record header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+			byte_value = records_data[ records_data_offset++ ];
+
+			number_of_items |= (uint32_t) ( byte_value & 0x7f ) << bit_shift;
+			bit_shift       += 7;
+		}
+		file_offset = records_data_file_offset + (off64_t) records_data_offset;
+
+		/* The end of records is followed by the EDC of the decoded data
+		 */
+		if( number_of_items == 0xffffffffUL )
+		{
+			break;
+		}
+		number_of_items += 1;
+
+		if( number_of_items >= 0x80000000UL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record number of items value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		encoded_data_size = (uint64_t) number_of_items * libodraw_ecm_file_encoded_item_sizes[ record_type ];
+
+		if( encoded_data_size > ( file_size - (size64_t) file_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record: %" PRIu32 " data size value out of bounds.",
+			 function,
+			 ecm_file->number_of_records );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: record: %" PRIu32 " type: %" PRIu8 ", number of items: %" PRIu32 ", data offset: %" PRIu64 "\n",
+			 function,
+			 ecm_file->number_of_records,
+			 record_type,
+			 number_of_items,
+			 data_offset );
+		}
+#endif
+		if( ecm_file->number_of_records >= maximum_number_of_records )
+		{
+			if( (size_t) maximum_number_of_records > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libodraw_ecm_record_descriptor_t ) ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of records value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			maximum_number_of_records *= 2;
+
+			record_descriptors = (libodraw_ecm_record_descriptor_t *) memory_reallocate(
+			                                                           ecm_file->record_descriptors,
+			                                                           sizeof( libodraw_ecm_record_descriptor_t ) * maximum_number_of_records );
+
+			if( record_descriptors == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize record descriptors.",
+				 function );
+
+				goto on_error;
+			}
+			ecm_file->record_descriptors = record_descriptors;
+		}
+		record_descriptor = &( ecm_file->record_descriptors[ ecm_file->number_of_records ] );
+
+		record_descriptor->offset          = (uint64_t) file_offset;
+		record_descriptor->data_offset     = data_offset;
+		record_descriptor->number_of_items = number_of_items;
+		record_descriptor->type            = record_type;
+
+		ecm_file->number_of_records += 1;
+
+		data_offset += (uint64_t) number_of_items * libodraw_ecm_file_decoded_item_sizes[ record_type ];
+		file_offset += (off64_t) encoded_data_size;
+	}
+	if( number_of_items != 0xffffffffUL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing end of records.",
+		 function );
+
+		goto on_error;
+	}
+	ecm_file->data_size = (size64_t) data_offset;
+
+	memory_free(
+	 records_data );
+
+	return( 1 );
+
+on_error:
+	if( ecm_file->record_descriptors != NULL )
+	{
+		memory_free(
+		 ecm_file->record_descriptors );
+
+		ecm_file->record_descriptors = NULL;
+	}
+	if( records_data != NULL )
+	{
+		memory_free(
+		 records_data );
+	}
+	ecm_file->number_of_records = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the index of the record that contains a specific offset of the decoded data
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libodraw_ecm_file_get_record_index_at_offset(
+     libodraw_ecm_file_t *ecm_file,
+     off64_t offset,
+     uint32_t *record_index,
+     libcerror_error_t **error )
+{
+	libodraw_ecm_record_descriptor_t *record_descriptor = NULL;
+	static char *function                               = "libodraw_ecm_file_get_record_index_at_offset";
+	uint64_t record_data_size                           = 0;
+	uint32_t first_record_index                         = 0;
+	uint32_t last_record_index                          = 0;
+	uint32_t middle_record_index                        = 0;
+
+	if( ecm_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ECM file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ecm_file->record_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid ECM file - missing record descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	/* The records are sorted by data offset
+	 */
+	last_record_index = ecm_file->number_of_records;
+
+	while( first_record_index < last_record_index )
+	{
+		middle_record_index = first_record_index + ( ( last_record_index - first_record_index ) / 2 );
+		record_descriptor   = &( ecm_file->record_descriptors[ middle_record_index ] );
+		record_data_size    = (uint64_t) record_descriptor->number_of_items * libodraw_ecm_file_decoded_item_sizes[ record_descriptor->type ];
+
+		if( (uint64_t) offset < record_descriptor->data_offset )
+		{
+			last_record_index = middle_record_index;
+		}
+		else if( (uint64_t) offset >= ( record_descriptor->data_offset + record_data_size ) )
+		{
+			first_record_index = middle_record_index + 1;
+		}
+		else
+		{
+			*record_index = middle_record_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Decodes a sector of a MODE1, MODE2 form 1 or MODE2 form 2 record
+ * The sector data is filled in sector coordinates, a MODE2 sector starts at offset 16
+ * The EDC and ECC are only calculated when the range to read, which ends at range end offset,
+ * contains them
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_ecm_file_decode_sector(
+     uint8_t record_type,
+     const uint8_t *encoded_data,
+     uint8_t *sector_data,
+     size_t sector_data_size,
+     size_t range_end_offset,
+     libcerror_error_t **error )
+{
+	static char *function   = "libodraw_ecm_file_decode_sector";
+	size_t edc_offset       = 0;
+	size_t edc_start_offset = 0;
+	uint32_t edc            = 0;
+
+	if( ( record_type != LIBODRAW_ECM_RECORD_TYPE_MODE1 )
+	 && ( record_type != LIBODRAW_ECM_RECORD_TYPE_MODE2_FORM1 )
+	 && ( record_type != LIBODRAW_ECM_RECORD_TYPE_MODE2_FORM2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported record type.",
+		 function );
+
+		return( -1 );
+	}
+	if( encoded_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encoded data.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data_size < 2352 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid sector data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_end_offset > 2352 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range end offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_type == LIBODRAW_ECM_RECORD_TYPE_MODE1 )
+	{
+		if( memory_copy(
+		     sector_data,
+		     libodraw_ecm_file_sector_synchronisation_data,
+		     12 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy synchronisation data.",
+			 function );
+
+			return( -1 );
+		}
+		sector_data[ 12 ] = ( (ecm_mode1_sector_t *) encoded_data )->address[ 0 ];
+		sector_data[ 13 ] = ( (ecm_mode1_sector_t *) encoded_data )->address[ 1 ];
+		sector_data[ 14 ] = ( (ecm_mode1_sector_t *) encoded_data )->address[ 2 ];
+		sector_data[ 15 ] = 1;
+
+		if( memory_copy(
+		     &( sector_data[ 16 ] ),
+		     ( (ecm_mode1_sector_t *) encoded_data )->data,
+		     2048 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sector data.",
+			 function );
+
+			return( -1 );
+		}
+		edc_start_offset = 0;
+		edc_offset       = 2064;
+	}
+	else
+	{
+		edc_start_offset = 16;
+
+		/* The sub-header is stored twice
+		 */
+		sector_data[ 16 ] = ( (ecm_mode2_form1_sector_t *) encoded_data )->sub_header[ 0 ];
+		sector_data[ 17 ] = ( (ecm_mode2_form1_sector_t *) encoded_data )->sub_header[ 1 ];
+		sector_data[ 18 ] = ( (ecm_mode2_form1_sector_t *) encoded_data )->sub_header[ 2 ];
+		sector_data[ 19 ] = ( (ecm_mode2_form1_sector_t *) encoded_data )->sub_header[ 3 ];
+		sector_data[ 20 ] = sector_data[ 16 ];
+		sector_data[ 21 ] = sector_data[ 17 ];
+		sector_data[ 22 ] = sector_data[ 18 ];
+		sector_data[ 23 ] = sector_data[ 19 ];
+
+		if( record_type == LIBODRAW_ECM_RECORD_TYPE_MODE2_FORM1 )
+		{
+			if( memory_copy(
+			     &( sector_data[ 24 ] ),
+			     ( (ecm_mode2_form1_sector_t *) encoded_data )->data,
+			     2048 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy sector data.",
+				 function );
+
+				return( -1 );
+			}
+			edc_offset = 2072;
+		}
+		else
+		{
+			if( memory_copy(
+			     &( sector_data[ 24 ] ),
+			     ( (ecm_mode2_form2_sector_t *) encoded_data )->data,
+			     2324 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy sector data.",
+				 function );
+
+				return( -1 );
+			}
+			edc_offset = 2348;
+		}
+	}
+	/* The ECC is calculated over the EDC hence the EDC is needed for both
+	 */
+	if( range_end_offset <= edc_offset )
+	{
+		return( 1 );
+	}
+	if( libodraw_checksum_calculate_edc(
+	     &edc,
+	     &( sector_data[ edc_start_offset ] ),
+	     edc_offset - edc_start_offset,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate EDC.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( sector_data[ edc_offset ] ),
+	 edc );
+
+	if( record_type == LIBODRAW_ECM_RECORD_TYPE_MODE1 )
+	{
+		if( memory_set(
+		     &( sector_data[ 2068 ] ),
+		     0,
+		     8 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear padding.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* A MODE2 form 2 sector has no ECC
+	 */
+	if( ( record_type == LIBODRAW_ECM_RECORD_TYPE_MODE2_FORM2 )
+	 || ( range_end_offset <= 2076 ) )
+	{
+		return( 1 );
+	}
+	if( record_type == LIBODRAW_ECM_RECORD_TYPE_MODE2_FORM1 )
+	{
+		/* The ECC of a MODE2 form 1 sector is calculated with a header of 0-byte values
+		 */
+		if( memory_set(
+		     &( sector_data[ 12 ] ),
+		     0,
+		     4 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear header.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libodraw_checksum_calculate_ecc(
+	     sector_data,
+	     sector_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate ECC.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads data at a specific offset of the decoded data
+ * Only the records that contain the requested range are read
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_ecm_file_read_buffer_at_offset(
+         libodraw_ecm_file_t *ecm_file,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	uint8_t sector_data[ 2352 ];
+
+	libodraw_ecm_record_descriptor_t *record_descriptor = NULL;
+	static char *function                               = "libodraw_ecm_file_read_buffer_at_offset";
+	size_t buffer_offset                                = 0;
+	size_t decoded_item_size                            = 0;
+	size_t encoded_data_offset                          = 0;
+	size_t encoded_data_size                            = 0;
+	size_t encoded_item_size                            = 0;
+	size_t read_size                                    = 0;
+	size_t sector_data_offset                           = 0;
+	size_t sector_offset                                = 0;
+	ssize_t read_count                                  = 0;
+	uint64_t item_index                                 = 0;
+	uint64_t number_of_sectors                          = 0;
+	uint64_t relative_offset                            = 0;
+	uint32_t record_index                               = 0;
+	int result                                          = 0;
+
+	if( ecm_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ECM file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ecm_file->encoded_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid ECM file - missing encoded data.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= ecm_file->data_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( ecm_file->data_size - (size64_t) offset ) )
+	{
+		buffer_size = (size_t) ( ecm_file->data_size - (size64_t) offset );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     ecm_file->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Sequential reads continue in the record that was last read
+	 */
+	record_index      = ecm_file->last_record_index;
+	record_descriptor = &( ecm_file->record_descriptors[ record_index ] );
+
+	if( ( (uint64_t) offset < record_descriptor->data_offset )
+	 || ( (uint64_t) offset >= ( record_descriptor->data_offset + ( (uint64_t) record_descriptor->number_of_items * libodraw_ecm_file_decoded_item_sizes[ record_descriptor->type ] ) ) ) )
+	{
+		result = libodraw_ecm_file_get_record_index_at_offset(
+		          ecm_file,
+		          offset,
+		          &record_index,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record index at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			goto on_error;
+		}
+	}
+	while( buffer_offset < buffer_size )
+	{
+		if( record_index >= ecm_file->number_of_records )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record index value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		record_descriptor = &( ecm_file->record_descriptors[ record_index ] );
+
+		decoded_item_size = libodraw_ecm_file_decoded_item_sizes[ record_descriptor->type ];
+		encoded_item_size = libodraw_ecm_file_encoded_item_sizes[ record_descriptor->type ];
+
+		relative_offset = (uint64_t) offset - record_descriptor->data_offset;
+		item_index      = relative_offset / decoded_item_size;
+		sector_offset   = (size_t) ( relative_offset % decoded_item_size );
+
+		if( record_descriptor->type == LIBODRAW_ECM_RECORD_TYPE_LITERAL )
+		{
+			read_size = buffer_size - buffer_offset;
+
+			if( (uint64_t) read_size > ( record_descriptor->number_of_items - relative_offset ) )
+			{
+				read_size = (size_t) ( record_descriptor->number_of_items - relative_offset );
+			}
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              ecm_file->file_io_handle,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              (off64_t) ( record_descriptor->offset + relative_offset ),
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record: %" PRIu32 " data.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			buffer_offset += read_size;
+			offset        += (off64_t) read_size;
+		}
+		else
+		{
+			/* Read the encoded data of the sectors that cover the remainder of the buffer
+			 */
+			number_of_sectors = ( (uint64_t) sector_offset + ( buffer_size - buffer_offset ) + decoded_item_size - 1 ) / decoded_item_size;
+
+			if( number_of_sectors > ( record_descriptor->number_of_items - item_index ) )
+			{
+				number_of_sectors = record_descriptor->number_of_items - item_index;
+			}
+			if( number_of_sectors > LIBODRAW_ECM_FILE_MAXIMUM_NUMBER_OF_READ_SECTORS )
+			{
+				number_of_sectors = LIBODRAW_ECM_FILE_MAXIMUM_NUMBER_OF_READ_SECTORS;
+			}
+			encoded_data_size = (size_t) number_of_sectors * encoded_item_size;
+
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              ecm_file->file_io_handle,
+			              ecm_file->encoded_data,
+			              encoded_data_size,
+			              (off64_t) ( record_descriptor->offset + ( item_index * encoded_item_size ) ),
+			              error );
+
+			if( read_count != (ssize_t) encoded_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record: %" PRIu32 " data.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			/* A MODE2 record contains the sector from offset 16
+			 */
+			sector_data_offset = 2352 - decoded_item_size;
+
+			for( encoded_data_offset = 0;
+			     encoded_data_offset < encoded_data_size;
+			     encoded_data_offset += encoded_item_size )
+			{
+				read_size = decoded_item_size - sector_offset;
+
+				if( read_size > ( buffer_size - buffer_offset ) )
+				{
+					read_size = buffer_size - buffer_offset;
+				}
+				if( libodraw_ecm_file_decode_sector(
+				     record_descriptor->type,
+				     &( ecm_file->encoded_data[ encoded_data_offset ] ),
+				     sector_data,
+				     2352,
+				     sector_data_offset + sector_offset + read_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to decode record: %" PRIu32 " sector.",
+					 function,
+					 record_index );
+
+					goto on_error;
+				}
+				if( memory_copy(
+				     &( buffer[ buffer_offset ] ),
+				     &( sector_data[ sector_data_offset + sector_offset ] ),
+				     read_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy sector data.",
+					 function );
+
+					goto on_error;
+				}
+				buffer_offset += read_size;
+				offset        += (off64_t) read_size;
+				sector_offset  = 0;
+
+				if( buffer_offset >= buffer_size )
+				{
+					break;
+				}
+			}
+		}
+		if( (uint64_t) offset >= ( record_descriptor->data_offset + ( (uint64_t) record_descriptor->number_of_items * decoded_item_size ) ) )
+		{
+			record_index++;
+		}
+	}
+	/* Do not retain a record index beyond the last record
+	 */
+	if( record_index < ecm_file->number_of_records )
+	{
+		ecm_file->last_record_index = record_index;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     ecm_file->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( (ssize_t) buffer_offset );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 ecm_file->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the size of the decoded data
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_ecm_file_get_data_size(
+     libodraw_ecm_file_t *ecm_file,
+     size64_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_ecm_file_get_data_size";
+
+	if( ecm_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ECM file.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = ecm_file->data_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,155 @@
+/*
+ * Error Code Modeler (ECM) file functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_ECM_FILE_H )
+#define _LIBODRAW_ECM_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libbfio.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of sectors that are read from the ECM file at once
+ */
+#define LIBODRAW_ECM_FILE_MAXIMUM_NUMBER_OF_READ_SECTORS	32
+
+/* The record types
+ */
+enum LIBODRAW_ECM_RECORD_TYPES
+{
+	LIBODRAW_ECM_RECORD_TYPE_LITERAL			= 0,
+	LIBODRAW_ECM_RECORD_TYPE_MODE1				= 1,
+	LIBODRAW_ECM_RECORD_TYPE_MODE2_FORM1			= 2,
+	LIBODRAW_ECM_RECORD_TYPE_MODE2_FORM2			= 3
+};
+
+typedef struct libodraw_ecm_record_descriptor libodraw_ecm_record_descriptor_t;
+
+struct libodraw_ecm_record_descriptor
+{
+	/* The offset of the encoded record data in the file
+	 */
+	uint64_t offset;
+
+	/* The offset of the record data in the decoded data
+	 */
+	uint64_t data_offset;
+
+	/* The number of bytes of a literal record or the number of sectors otherwise
+	 */
+	uint32_t number_of_items;
+
+	/* The type
+	 */
+	uint8_t type;
+};
+
+typedef struct libodraw_ecm_file libodraw_ecm_file_t;
+
+struct libodraw_ecm_file
+{
+	/* The number of records
+	 */
+	uint32_t number_of_records;
+
+	/* The record descriptors
+	 */
+	libodraw_ecm_record_descriptor_t *record_descriptors;
+
+	/* The size of the decoded data
+	 */
+	size64_t data_size;
+
+	/* The file IO handle of the ECM file
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The encoded sector data
+	 */
+	uint8_t *encoded_data;
+
+	/* The index of the record that was last read
+	 */
+	uint32_t last_record_index;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the file IO handle and the encoded sector data
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libodraw_ecm_file_initialize(
+     libodraw_ecm_file_t **ecm_file,
+     libcerror_error_t **error );
+
+int libodraw_ecm_file_free(
+     libodraw_ecm_file_t **ecm_file,
+     libcerror_error_t **error );
+
+int libodraw_ecm_file_open_read(
+     libodraw_ecm_file_t *ecm_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libodraw_ecm_file_read_records(
+     libodraw_ecm_file_t *ecm_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libodraw_ecm_file_get_record_index_at_offset(
+     libodraw_ecm_file_t *ecm_file,
+     off64_t offset,
+     uint32_t *record_index,
+     libcerror_error_t **error );
+
+int libodraw_ecm_file_decode_sector(
+     uint8_t record_type,
+     const uint8_t *encoded_data,
+     uint8_t *sector_data,
+     size_t sector_data_size,
+     size_t range_end_offset,
+     libcerror_error_t **error );
+
+ssize_t libodraw_ecm_file_read_buffer_at_offset(
+         libodraw_ecm_file_t *ecm_file,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libodraw_ecm_file_get_data_size(
+     libodraw_ecm_file_t *ecm_file,
+     size64_t *data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_ECM_FILE_H ) */
+
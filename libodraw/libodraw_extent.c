@@ -0,0 +1,332 @@
+/*
+ * Extent functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_definitions.h"
+#include "libodraw_extent.h"
+#include "libodraw_libcerror.h"
+
+/* Creates an extent
+ * Make sure the value extent is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_extent_initialize(
+     libodraw_extent_t **extent,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_extent_initialize";
+
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extent value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*extent = memory_allocate_structure(
+	                 libodraw_extent_t );
+
+	if( *extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create extent.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *extent,
+	     0,
+	     sizeof( libodraw_extent_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear extent.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *extent != NULL )
+	{
+		memory_free(
+		 *extent );
+
+		*extent = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an extent
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_extent_free(
+     libodraw_extent_t **extent,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_extent_free";
+
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent != NULL )
+	{
+		memory_free(
+		 *extent );
+
+		*extent = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves an extent
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_extent_get(
+     libodraw_extent_t *extent,
+     uint64_t *start_sector,
+     uint64_t *number_of_sectors,
+     int *data_file_index,
+     off64_t *data_file_offset,
+     uint32_t *bytes_per_sector,
+     uint8_t *track_type,
+     uint32_t *flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_extent_get";
+
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_sector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid start sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sectors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sectors.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_file_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data file index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( bytes_per_sector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( track_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid track type.",
+		 function );
+
+		return( -1 );
+	}
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	*start_sector      = extent->start_sector;
+	*number_of_sectors = extent->number_of_sectors;
+	*data_file_index   = extent->data_file_index;
+	*data_file_offset  = extent->data_file_offset;
+	*bytes_per_sector  = extent->bytes_per_sector;
+	*track_type        = extent->track_type;
+	*flags             = extent->flags;
+
+	return( 1 );
+}
+
+/* Sets an extent
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_extent_set(
+     libodraw_extent_t *extent,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     int data_file_index,
+     off64_t data_file_offset,
+     uint32_t bytes_per_sector,
+     uint8_t track_type,
+     uint32_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_extent_set";
+
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_sector > (uint64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid start sector value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sectors > (uint64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of sectors value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid data file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( flags & LIBODRAW_EXTENT_FLAG_IS_SPARSE ) == 0 )
+	 && ( ( data_file_index < 0 )
+	  || ( bytes_per_sector == 0 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported non-sparse extent without data file.",
+		 function );
+
+		return( -1 );
+	}
+	extent->start_sector      = start_sector;
+	extent->end_sector        = start_sector + number_of_sectors;
+	extent->number_of_sectors = number_of_sectors;
+	extent->data_file_index   = data_file_index;
+	extent->data_file_offset  = data_file_offset;
+	extent->bytes_per_sector  = bytes_per_sector;
+	extent->track_type        = track_type;
+	extent->flags             = flags;
+
+	return( 1 );
+}
+
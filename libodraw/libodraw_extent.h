@@ -0,0 +1,106 @@
+/*
+ * Extent functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_EXTENT_H )
+#define _LIBODRAW_EXTENT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libodraw_extent libodraw_extent_t;
+
+struct libodraw_extent
+{
+	/* The start sector
+	 */
+	uint64_t start_sector;
+
+	/* The end sector
+	 */
+	uint64_t end_sector;
+
+	/* The number of sectors
+	 */
+	uint64_t number_of_sectors;
+
+	/* The data file index
+	 */
+	int data_file_index;
+
+	/* The data file offset
+	 */
+	off64_t data_file_offset;
+
+	/* The bytes per sector in the data file
+	 */
+	uint32_t bytes_per_sector;
+
+	/* The track type
+	 */
+	uint8_t track_type;
+
+	/* The flags
+	 */
+	uint32_t flags;
+};
+
+int libodraw_extent_initialize(
+     libodraw_extent_t **extent,
+     libcerror_error_t **error );
+
+int libodraw_extent_free(
+     libodraw_extent_t **extent,
+     libcerror_error_t **error );
+
+int libodraw_extent_get(
+     libodraw_extent_t *extent,
+     uint64_t *start_sector,
+     uint64_t *number_of_sectors,
+     int *data_file_index,
+     off64_t *data_file_offset,
+     uint32_t *bytes_per_sector,
+     uint8_t *track_type,
+     uint32_t *flags,
+     libcerror_error_t **error );
+
+int libodraw_extent_set(
+     libodraw_extent_t *extent,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     int data_file_index,
+     off64_t data_file_offset,
+     uint32_t bytes_per_sector,
+     uint8_t track_type,
+     uint32_t flags,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_EXTENT_H ) */
+
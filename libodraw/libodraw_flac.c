@@ -0,0 +1,1477 @@
+/*
+ * FLAC decoding functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_bit_stream.h"
+#include "libodraw_checksum.h"
+#include "libodraw_flac.h"
+#include "libodraw_libcerror.h"
+
+/* Reads a frame header
+ * The bit stream must be at the start of the frame, which is byte aligned
+ * Returns 1 on success or -1 on error
+ */
+int libodraw_flac_read_frame_header(
+     libodraw_flac_frame_header_t *frame_header,
+     libodraw_bit_stream_t *bit_stream,
+     libcerror_error_t **error )
+{
+	static char *function          = "libodraw_flac_read_frame_header";
+	size_t frame_header_end_offset = 0;
+	size_t frame_start_offset      = 0;
+	uint32_t value_32bit           = 0;
+	uint8_t block_size_code        = 0;
+	uint8_t calculated_checksum    = 0;
+	uint8_t number_of_utf8_bytes   = 0;
+	uint8_t sample_rate_code       = 0;
+	uint8_t sample_size_code       = 0;
+	uint8_t stored_checksum        = 0;
+
+	if( frame_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frame header.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bit_stream->bit_buffer_size % 8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid bit stream - not byte aligned.",
+		 function );
+
+		return( -1 );
+	}
+	frame_start_offset = bit_stream->byte_stream_offset - ( bit_stream->bit_buffer_size / 8 );
+
+	/* The sync code (14 bits), a reserved bit and the blocking strategy (1 bit)
+	 */
+	if( libodraw_bit_stream_get_value(
+	     bit_stream,
+	     16,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ( value_32bit & 0xfffe ) != 0xfff8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+		 "%s: invalid frame sync code.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_bit_stream_get_value(
+	     bit_stream,
+	     8,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	block_size_code  = (uint8_t) ( value_32bit >> 4 );
+	sample_rate_code = (uint8_t) ( value_32bit & 0x0f );
+
+	if( libodraw_bit_stream_get_value(
+	     bit_stream,
+	     8,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	frame_header->channel_assignment = (uint8_t) ( value_32bit >> 4 );
+	sample_size_code                 = (uint8_t) ( ( value_32bit >> 1 ) & 0x07 );
+
+	if( ( value_32bit & 0x01 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported frame header reserved bit.",
+		 function );
+
+		return( -1 );
+	}
+	/* The frame or sample number is stored UTF-8 encoded
+	 */
+	if( libodraw_bit_stream_get_value(
+	     bit_stream,
+	     8,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ( value_32bit & 0x80 ) == 0 )
+	{
+		number_of_utf8_bytes = 0;
+	}
+	else if( ( value_32bit & 0xe0 ) == 0xc0 )
+	{
+		number_of_utf8_bytes = 1;
+	}
+	else if( ( value_32bit & 0xf0 ) == 0xe0 )
+	{
+		number_of_utf8_bytes = 2;
+	}
+	else if( ( value_32bit & 0xf8 ) == 0xf0 )
+	{
+		number_of_utf8_bytes = 3;
+	}
+	else if( ( value_32bit & 0xfc ) == 0xf8 )
+	{
+		number_of_utf8_bytes = 4;
+	}
+	else if( ( value_32bit & 0xfe ) == 0xfc )
+	{
+		number_of_utf8_bytes = 5;
+	}
+	else if( value_32bit == 0xfe )
+	{
+		number_of_utf8_bytes = 6;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+		 "%s: invalid frame number.",
+		 function );
+
+		return( -1 );
+	}
+	while( number_of_utf8_bytes > 0 )
+	{
+		if( libodraw_bit_stream_get_value(
+		     bit_stream,
+		     8,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( ( value_32bit & 0xc0 ) != 0x80 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+			 "%s: invalid frame number.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_utf8_bytes--;
+	}
+	switch( block_size_code )
+	{
+		case 0:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported block size code: 0.",
+			 function );
+
+			return( -1 );
+
+		case 1:
+			frame_header->block_size = 192;
+			break;
+
+		case 2:
+		case 3:
+		case 4:
+		case 5:
+			frame_header->block_size = (uint32_t) 576 << ( block_size_code - 2 );
+			break;
+
+		case 6:
+		case 7:
+			if( libodraw_bit_stream_get_value(
+			     bit_stream,
+			     ( block_size_code == 6 ) ? 8 : 16,
+			     &value_32bit,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			frame_header->block_size = value_32bit + 1;
+
+			break;
+
+		default:
+			frame_header->block_size = (uint32_t) 256 << ( block_size_code - 8 );
+			break;
+	}
+	/* The sample rate is not needed to decode the samples
+	 */
+	if( sample_rate_code == 15 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported sample rate code: 15.",
+		 function );
+
+		return( -1 );
+	}
+	else if( sample_rate_code >= 12 )
+	{
+		if( libodraw_bit_stream_get_value(
+		     bit_stream,
+		     ( sample_rate_code == 12 ) ? 8 : 16,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( frame_header->channel_assignment < 8 )
+	{
+		frame_header->number_of_channels = frame_header->channel_assignment + 1;
+	}
+	else if( frame_header->channel_assignment <= LIBODRAW_FLAC_CHANNEL_ASSIGNMENT_MID_SIDE )
+	{
+		frame_header->number_of_channels = 2;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported channel assignment: %" PRIu8 ".",
+		 function,
+		 frame_header->channel_assignment );
+
+		return( -1 );
+	}
+	switch( sample_size_code )
+	{
+		/* The sample size of the stream, which is 16 bits for CHD
+		 */
+		case 0:
+		case 4:
+			frame_header->bits_per_sample = 16;
+			break;
+
+		case 1:
+			frame_header->bits_per_sample = 8;
+			break;
+
+		case 2:
+			frame_header->bits_per_sample = 12;
+			break;
+
+		case 5:
+			frame_header->bits_per_sample = 20;
+			break;
+
+		case 6:
+			frame_header->bits_per_sample = 24;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported sample size code: %" PRIu8 ".",
+			 function,
+			 sample_size_code );
+
+			return( -1 );
+	}
+	if( libodraw_bit_stream_get_value(
+	     bit_stream,
+	     8,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	stored_checksum = (uint8_t) value_32bit;
+
+	if( libodraw_bit_stream_is_overflow(
+	     bit_stream,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: invalid frame header data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	frame_header_end_offset = bit_stream->byte_stream_offset - ( bit_stream->bit_buffer_size / 8 );
+
+	if( libodraw_checksum_calculate_crc8(
+	     &calculated_checksum,
+	     &( bit_stream->byte_stream[ frame_start_offset ] ),
+	     frame_header_end_offset - frame_start_offset - 1,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate frame header checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in frame header checksum ( 0x%02" PRIx8 " != 0x%02" PRIx8 " ).",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+	 "%s: unable to retrieve value from bit stream.",
+	 function );
+
+	return( -1 );
+}
+
+/* Reads a two's complement signed value
+ * Returns 1 on success or -1 on error
+ */
+int libodraw_flac_read_signed_value(
+     libodraw_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     int32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_flac_read_signed_value";
+	uint32_t safe_value   = 0;
+
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 32-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_bit_stream_get_value(
+	     bit_stream,
+	     number_of_bits,
+	     &safe_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_bits > 0 )
+	 && ( number_of_bits < 32 )
+	 && ( ( safe_value & ( (uint32_t) 1UL << ( number_of_bits - 1 ) ) ) != 0 ) )
+	{
+		safe_value |= ~( ( (uint32_t) 1UL << number_of_bits ) - 1 );
+	}
+	*value_32bit = (int32_t) safe_value;
+
+	return( 1 );
+}
+
+/* Reads a Rice coded value
+ * The value consists of a unary coded quotient and a remainder of rice parameter bits
+ * and is stored with the sign in the least significant bit
+ * Returns 1 on success or -1 on error
+ */
+int libodraw_flac_read_rice_value(
+     libodraw_bit_stream_t *bit_stream,
+     uint8_t rice_parameter,
+     int32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function  = "libodraw_flac_read_rice_value";
+	uint32_t quotient      = 0;
+	uint32_t remainder     = 0;
+	uint32_t safe_value    = 0;
+	uint8_t number_of_bits = 0;
+
+	if( rice_parameter > 30 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid rice parameter value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid 32-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	/* The quotient is the number of 0-bits before the next 1-bit
+	 */
+	do
+	{
+		if( libodraw_bit_stream_peek_value(
+		     bit_stream,
+		     32,
+		     &safe_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from bit stream.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_bits = 0;
+
+		while( ( number_of_bits < 32 )
+		    && ( ( safe_value & 0x80000000UL ) == 0 ) )
+		{
+			safe_value <<= 1;
+
+			number_of_bits++;
+		}
+		quotient += number_of_bits;
+
+		if( libodraw_bit_stream_skip_bits(
+		     bit_stream,
+		     ( number_of_bits < 32 ) ? number_of_bits + 1 : 32,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to skip bits in bit stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( quotient > ( (uint32_t) UINT32_MAX >> rice_parameter ) )
+		 || ( libodraw_bit_stream_is_overflow(
+		       bit_stream,
+		       error ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid quotient value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( number_of_bits == 32 );
+
+	if( libodraw_bit_stream_get_value(
+	     bit_stream,
+	     rice_parameter,
+	     &remainder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve remainder from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	safe_value = ( quotient << rice_parameter ) | remainder;
+
+	*value_32bit = (int32_t) ( safe_value >> 1 ) ^ -( (int32_t) ( safe_value & 1 ) );
+
+	return( 1 );
+}
+
+/* Reads the residual of a predicted subframe
+ * The residual values are stored in samples from the predictor order onwards
+ * Returns 1 on success or -1 on error
+ */
+int libodraw_flac_read_residual(
+     libodraw_bit_stream_t *bit_stream,
+     uint32_t block_size,
+     uint8_t predictor_order,
+     int32_t *samples,
+     libcerror_error_t **error )
+{
+	static char *function          = "libodraw_flac_read_residual";
+	uint32_t number_of_partitions  = 0;
+	uint32_t number_of_samples     = 0;
+	uint32_t partition_index       = 0;
+	uint32_t partition_size        = 0;
+	uint32_t sample_index          = 0;
+	uint32_t value_32bit           = 0;
+	uint8_t escape_code            = 0;
+	uint8_t number_of_escaped_bits = 0;
+	uint8_t partition_order        = 0;
+	uint8_t rice_parameter         = 0;
+	uint8_t rice_parameter_size    = 0;
+	int result                     = 0;
+
+	if( samples == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid samples.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_bit_stream_get_value(
+	     bit_stream,
+	     6,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve residual coding method from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	/* The residual coding method (2 bits) and partition order (4 bits)
+	 */
+	switch( value_32bit >> 4 )
+	{
+		case 0:
+			rice_parameter_size = 4;
+			escape_code         = 0x0f;
+			break;
+
+		case 1:
+			rice_parameter_size = 5;
+			escape_code         = 0x1f;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported residual coding method: %" PRIu32 ".",
+			 function,
+			 value_32bit >> 4 );
+
+			return( -1 );
+	}
+	partition_order      = (uint8_t) ( value_32bit & 0x0f );
+	number_of_partitions = (uint32_t) 1 << partition_order;
+	partition_size       = block_size >> partition_order;
+
+	if( ( ( partition_size << partition_order ) != block_size )
+	 || ( partition_size < (uint32_t) predictor_order ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition order value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sample_index = (uint32_t) predictor_order;
+
+	for( partition_index = 0;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		number_of_samples = partition_size;
+
+		if( partition_index == 0 )
+		{
+			number_of_samples -= (uint32_t) predictor_order;
+		}
+		if( libodraw_bit_stream_get_value(
+		     bit_stream,
+		     rice_parameter_size,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve rice parameter from bit stream.",
+			 function );
+
+			return( -1 );
+		}
+		rice_parameter = (uint8_t) value_32bit;
+
+		/* The escape code indicates the residual is stored unencoded
+		 */
+		if( rice_parameter == escape_code )
+		{
+			if( libodraw_bit_stream_get_value(
+			     bit_stream,
+			     5,
+			     &value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of escaped bits from bit stream.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_escaped_bits = (uint8_t) value_32bit;
+		}
+		while( number_of_samples > 0 )
+		{
+			if( rice_parameter == escape_code )
+			{
+				result = libodraw_flac_read_signed_value(
+				          bit_stream,
+				          number_of_escaped_bits,
+				          &( samples[ sample_index ] ),
+				          error );
+			}
+			else
+			{
+				result = libodraw_flac_read_rice_value(
+				          bit_stream,
+				          rice_parameter,
+				          &( samples[ sample_index ] ),
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve residual: %" PRIu32 ".",
+				 function,
+				 sample_index );
+
+				return( -1 );
+			}
+			sample_index++;
+			number_of_samples--;
+		}
+	}
+	return( 1 );
+}
+
+/* Reads a subframe, which contains the samples of a single channel
+ * Returns 1 on success or -1 on error
+ */
+int libodraw_flac_read_subframe(
+     libodraw_bit_stream_t *bit_stream,
+     uint32_t block_size,
+     uint8_t bits_per_sample,
+     int32_t *samples,
+     libcerror_error_t **error )
+{
+	int32_t coefficients[ LIBODRAW_FLAC_MAXIMUM_LPC_ORDER ];
+
+	static char *function         = "libodraw_flac_read_subframe";
+	int64_t prediction            = 0;
+	uint32_t sample_index         = 0;
+	uint32_t value_32bit          = 0;
+	int32_t shift                 = 0;
+	uint8_t coefficient_index     = 0;
+	uint8_t coefficient_precision = 0;
+	uint8_t predictor_order       = 0;
+	uint8_t subframe_type         = 0;
+	uint8_t wasted_bits           = 0;
+
+	if( block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bits_per_sample == 0 )
+	 || ( bits_per_sample > 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bits per sample value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( samples == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid samples.",
+		 function );
+
+		return( -1 );
+	}
+	/* A zero padding bit, the subframe type (6 bits) and the wasted bits flag
+	 */
+	if( libodraw_bit_stream_get_value(
+	     bit_stream,
+	     8,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ( value_32bit & 0x80 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+		 "%s: invalid subframe padding bit.",
+		 function );
+
+		return( -1 );
+	}
+	subframe_type = (uint8_t) ( ( value_32bit >> 1 ) & 0x3f );
+
+	/* The number of wasted bits is stored unary coded
+	 */
+	if( ( value_32bit & 0x01 ) != 0 )
+	{
+		do
+		{
+			wasted_bits++;
+
+			if( wasted_bits >= bits_per_sample )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of wasted bits value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( libodraw_bit_stream_get_value(
+			     bit_stream,
+			     1,
+			     &value_32bit,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		while( value_32bit == 0 );
+
+		bits_per_sample -= wasted_bits;
+	}
+	if( subframe_type == 0 )
+	{
+		/* A constant subframe contains a single sample value
+		 */
+		if( libodraw_flac_read_signed_value(
+		     bit_stream,
+		     bits_per_sample,
+		     &( samples[ 0 ] ),
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		for( sample_index = 1;
+		     sample_index < block_size;
+		     sample_index++ )
+		{
+			samples[ sample_index ] = samples[ 0 ];
+		}
+	}
+	else if( subframe_type == 1 )
+	{
+		/* A verbatim subframe contains unencoded sample values
+		 */
+		for( sample_index = 0;
+		     sample_index < block_size;
+		     sample_index++ )
+		{
+			if( libodraw_flac_read_signed_value(
+			     bit_stream,
+			     bits_per_sample,
+			     &( samples[ sample_index ] ),
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+	}
+	else if( ( ( subframe_type >= 8 )
+	       && ( subframe_type <= 12 ) )
+	      || ( subframe_type >= 32 ) )
+	{
+		if( subframe_type >= 32 )
+		{
+			predictor_order = subframe_type - 31;
+		}
+		else
+		{
+			predictor_order = subframe_type - 8;
+		}
+		if( (uint32_t) predictor_order > block_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid predictor order value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* The warm-up samples are stored unencoded
+		 */
+		for( sample_index = 0;
+		     sample_index < (uint32_t) predictor_order;
+		     sample_index++ )
+		{
+			if( libodraw_flac_read_signed_value(
+			     bit_stream,
+			     bits_per_sample,
+			     &( samples[ sample_index ] ),
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		if( subframe_type >= 32 )
+		{
+			/* The coefficient precision (4 bits) and the prediction shift (5 bits)
+			 */
+			if( libodraw_bit_stream_get_value(
+			     bit_stream,
+			     4,
+			     &value_32bit,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( value_32bit == 0x0f )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_INPUT,
+				 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+				 "%s: invalid coefficient precision.",
+				 function );
+
+				return( -1 );
+			}
+			coefficient_precision = (uint8_t) value_32bit + 1;
+
+			if( libodraw_flac_read_signed_value(
+			     bit_stream,
+			     5,
+			     &shift,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( shift < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported negative prediction shift.",
+				 function );
+
+				return( -1 );
+			}
+			for( coefficient_index = 0;
+			     coefficient_index < predictor_order;
+			     coefficient_index++ )
+			{
+				if( libodraw_flac_read_signed_value(
+				     bit_stream,
+				     coefficient_precision,
+				     &( coefficients[ coefficient_index ] ),
+				     error ) != 1 )
+				{
+					goto on_error;
+				}
+			}
+		}
+		if( libodraw_flac_read_residual(
+		     bit_stream,
+		     block_size,
+		     predictor_order,
+		     samples,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read residual.",
+			 function );
+
+			return( -1 );
+		}
+		/* The samples are restored by adding the prediction to the residual
+		 */
+		for( sample_index = (uint32_t) predictor_order;
+		     sample_index < block_size;
+		     sample_index++ )
+		{
+			if( subframe_type >= 32 )
+			{
+				prediction = 0;
+
+				for( coefficient_index = 0;
+				     coefficient_index < predictor_order;
+				     coefficient_index++ )
+				{
+					prediction += (int64_t) coefficients[ coefficient_index ] * samples[ sample_index - coefficient_index - 1 ];
+				}
+				prediction >>= shift;
+			}
+			else switch( predictor_order )
+			{
+				case 1:
+					prediction = samples[ sample_index - 1 ];
+					break;
+
+				case 2:
+					prediction = ( 2 * (int64_t) samples[ sample_index - 1 ] )
+					           - samples[ sample_index - 2 ];
+					break;
+
+				case 3:
+					prediction = ( 3 * ( (int64_t) samples[ sample_index - 1 ] - samples[ sample_index - 2 ] ) )
+					           + samples[ sample_index - 3 ];
+					break;
+
+				case 4:
+					prediction = ( 4 * ( (int64_t) samples[ sample_index - 1 ] + samples[ sample_index - 3 ] ) )
+					           - ( 6 * (int64_t) samples[ sample_index - 2 ] )
+					           - samples[ sample_index - 4 ];
+					break;
+
+				default:
+					prediction = 0;
+					break;
+			}
+			samples[ sample_index ] = (int32_t) ( samples[ sample_index ] + prediction );
+		}
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported subframe type: %" PRIu8 ".",
+		 function,
+		 subframe_type );
+
+		return( -1 );
+	}
+	if( wasted_bits > 0 )
+	{
+		for( sample_index = 0;
+		     sample_index < block_size;
+		     sample_index++ )
+		{
+			samples[ sample_index ] = (int32_t) ( (uint32_t) samples[ sample_index ] << wasted_bits );
+		}
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+	 "%s: unable to retrieve value from bit stream.",
+	 function );
+
+	return( -1 );
+}
+
+/* Decompresses FLAC frames of 16-bit stereo samples
+ * The frames are stored without the FLAC stream marker and metadata blocks
+ * The samples are stored interleaved in the byte order, the uncompressed data
+ * buffer must be filled entirely
+ * On return compressed data offset contains the offset of the first byte after the last frame
+ * Returns 1 on success or -1 on error
+ */
+int libodraw_flac_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t byte_order,
+     libcerror_error_t **error )
+{
+	libodraw_flac_frame_header_t frame_header;
+
+	libodraw_bit_stream_t *bit_stream = NULL;
+	int32_t *samples                  = NULL;
+	static char *function             = "libodraw_flac_decompress";
+	size_t frame_data_size            = 0;
+	size_t frame_end_offset           = 0;
+	size_t frame_start_offset         = 0;
+	size_t uncompressed_data_offset   = 0;
+	uint32_t maximum_block_size       = 0;
+	uint32_t sample_index             = 0;
+	uint32_t value_32bit              = 0;
+	uint16_t calculated_checksum      = 0;
+	int32_t left_sample               = 0;
+	int32_t mid_sample                = 0;
+	int32_t right_sample              = 0;
+	int32_t side_sample               = 0;
+	void *reallocation                = NULL;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size > (size_t) SSIZE_MAX )
+	 || ( ( uncompressed_data_size % 4 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_order != _BYTE_STREAM_ENDIAN_BIG )
+	 && ( byte_order != _BYTE_STREAM_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_bit_stream_initialize(
+	     &bit_stream,
+	     compressed_data,
+	     compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	while( uncompressed_data_offset < uncompressed_data_size )
+	{
+		frame_start_offset = bit_stream->byte_stream_offset - ( bit_stream->bit_buffer_size / 8 );
+
+		if( libodraw_flac_read_frame_header(
+		     &frame_header,
+		     bit_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read frame header at offset: %" PRIzd ".",
+			 function,
+			 frame_start_offset );
+
+			goto on_error;
+		}
+		if( ( frame_header.number_of_channels != 2 )
+		 || ( frame_header.bits_per_sample != 16 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported frame with %" PRIu8 " channels of %" PRIu8 "-bit samples.",
+			 function,
+			 frame_header.number_of_channels,
+			 frame_header.bits_per_sample );
+
+			goto on_error;
+		}
+		frame_data_size = (size_t) frame_header.block_size * 4;
+
+		if( frame_data_size > ( uncompressed_data_size - uncompressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid block size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		/* The samples buffer is reused by frames of the same or a smaller block size
+		 */
+		if( frame_header.block_size > maximum_block_size )
+		{
+			reallocation = memory_reallocate(
+			                samples,
+			                sizeof( int32_t ) * 2 * frame_header.block_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize samples.",
+				 function );
+
+				goto on_error;
+			}
+			samples            = (int32_t *) reallocation;
+			maximum_block_size = frame_header.block_size;
+		}
+		/* The side channel has an additional bit per sample
+		 */
+		if( libodraw_flac_read_subframe(
+		     bit_stream,
+		     frame_header.block_size,
+		     ( frame_header.channel_assignment == LIBODRAW_FLAC_CHANNEL_ASSIGNMENT_RIGHT_SIDE ) ? 17 : 16,
+		     samples,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read first subframe.",
+			 function );
+
+			goto on_error;
+		}
+		if( libodraw_flac_read_subframe(
+		     bit_stream,
+		     frame_header.block_size,
+		     ( ( frame_header.channel_assignment == LIBODRAW_FLAC_CHANNEL_ASSIGNMENT_LEFT_SIDE )
+		    || ( frame_header.channel_assignment == LIBODRAW_FLAC_CHANNEL_ASSIGNMENT_MID_SIDE ) ) ? 17 : 16,
+		     &( samples[ frame_header.block_size ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read second subframe.",
+			 function );
+
+			goto on_error;
+		}
+		/* The frame is padded to a byte boundary and ends with a CRC-16
+		 */
+		if( libodraw_bit_stream_skip_bits(
+		     bit_stream,
+		     bit_stream->bit_buffer_size % 8,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to skip padding bits in bit stream.",
+			 function );
+
+			goto on_error;
+		}
+		frame_end_offset = bit_stream->byte_stream_offset - ( bit_stream->bit_buffer_size / 8 );
+
+		if( libodraw_bit_stream_get_value(
+		     bit_stream,
+		     16,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve frame checksum from bit stream.",
+			 function );
+
+			goto on_error;
+		}
+		if( libodraw_bit_stream_is_overflow(
+		     bit_stream,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data size value too small.",
+			 function );
+
+			goto on_error;
+		}
+		if( libodraw_checksum_calculate_crc16_ibm(
+		     &calculated_checksum,
+		     &( compressed_data[ frame_start_offset ] ),
+		     frame_end_offset - frame_start_offset,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate frame checksum.",
+			 function );
+
+			goto on_error;
+		}
+		if( (uint16_t) value_32bit != calculated_checksum )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: mismatch in frame checksum ( 0x%04" PRIx32 " != 0x%04" PRIx16 " ).",
+			 function,
+			 value_32bit,
+			 calculated_checksum );
+
+			goto on_error;
+		}
+		for( sample_index = 0;
+		     sample_index < frame_header.block_size;
+		     sample_index++ )
+		{
+			left_sample  = samples[ sample_index ];
+			right_sample = samples[ frame_header.block_size + sample_index ];
+
+			switch( frame_header.channel_assignment )
+			{
+				case LIBODRAW_FLAC_CHANNEL_ASSIGNMENT_LEFT_SIDE:
+					side_sample  = right_sample;
+					right_sample = left_sample - side_sample;
+					break;
+
+				case LIBODRAW_FLAC_CHANNEL_ASSIGNMENT_RIGHT_SIDE:
+					side_sample = left_sample;
+					left_sample = side_sample + right_sample;
+					break;
+
+				case LIBODRAW_FLAC_CHANNEL_ASSIGNMENT_MID_SIDE:
+					side_sample  = right_sample;
+					mid_sample   = ( left_sample * 2 ) | ( side_sample & 1 );
+					left_sample  = ( mid_sample + side_sample ) >> 1;
+					right_sample = ( mid_sample - side_sample ) >> 1;
+					break;
+
+				default:
+					break;
+			}
+			if( byte_order == _BYTE_STREAM_ENDIAN_BIG )
+			{
+				byte_stream_copy_from_uint16_big_endian(
+				 &( uncompressed_data[ uncompressed_data_offset ] ),
+				 (uint16_t) left_sample );
+
+				byte_stream_copy_from_uint16_big_endian(
+				 &( uncompressed_data[ uncompressed_data_offset + 2 ] ),
+				 (uint16_t) right_sample );
+			}
+			else
+			{
+				byte_stream_copy_from_uint16_little_endian(
+				 &( uncompressed_data[ uncompressed_data_offset ] ),
+				 (uint16_t) left_sample );
+
+				byte_stream_copy_from_uint16_little_endian(
+				 &( uncompressed_data[ uncompressed_data_offset + 2 ] ),
+				 (uint16_t) right_sample );
+			}
+			uncompressed_data_offset += 4;
+		}
+	}
+	*compressed_data_offset = bit_stream->byte_stream_offset - ( bit_stream->bit_buffer_size / 8 );
+
+	if( samples != NULL )
+	{
+		memory_free(
+		 samples );
+	}
+	if( libodraw_bit_stream_free(
+	     &bit_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( samples != NULL )
+	{
+		memory_free(
+		 samples );
+	}
+	if( bit_stream != NULL )
+	{
+		libodraw_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,114 @@
+/*
+ * FLAC decoding functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_FLAC_H )
+#define _LIBODRAW_FLAC_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_bit_stream.h"
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum order of a linear predictor
+ */
+#define LIBODRAW_FLAC_MAXIMUM_LPC_ORDER				32
+
+/* The channel assignments
+ */
+enum LIBODRAW_FLAC_CHANNEL_ASSIGNMENTS
+{
+	LIBODRAW_FLAC_CHANNEL_ASSIGNMENT_LEFT_SIDE		= 8,
+	LIBODRAW_FLAC_CHANNEL_ASSIGNMENT_RIGHT_SIDE		= 9,
+	LIBODRAW_FLAC_CHANNEL_ASSIGNMENT_MID_SIDE		= 10
+};
+
+typedef struct libodraw_flac_frame_header libodraw_flac_frame_header_t;
+
+struct libodraw_flac_frame_header
+{
+	/* The block size, which is the number of samples per channel
+	 */
+	uint32_t block_size;
+
+	/* The channel assignment
+	 */
+	uint8_t channel_assignment;
+
+	/* The number of channels
+	 */
+	uint8_t number_of_channels;
+
+	/* The number of bits per sample
+	 */
+	uint8_t bits_per_sample;
+};
+
+int libodraw_flac_read_frame_header(
+     libodraw_flac_frame_header_t *frame_header,
+     libodraw_bit_stream_t *bit_stream,
+     libcerror_error_t **error );
+
+int libodraw_flac_read_signed_value(
+     libodraw_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     int32_t *value_32bit,
+     libcerror_error_t **error );
+
+int libodraw_flac_read_rice_value(
+     libodraw_bit_stream_t *bit_stream,
+     uint8_t rice_parameter,
+     int32_t *value_32bit,
+     libcerror_error_t **error );
+
+int libodraw_flac_read_residual(
+     libodraw_bit_stream_t *bit_stream,
+     uint32_t block_size,
+     uint8_t predictor_order,
+     int32_t *samples,
+     libcerror_error_t **error );
+
+int libodraw_flac_read_subframe(
+     libodraw_bit_stream_t *bit_stream,
+     uint32_t block_size,
+     uint8_t bits_per_sample,
+     int32_t *samples,
+     libcerror_error_t **error );
+
+int libodraw_flac_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t byte_order,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_FLAC_H ) */
+
@@ -26,14 +26,24 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libodraw_chd_file.h"
 #include "libodraw_codepage.h"
 #include "libodraw_cue_parser.h"
+#include "libodraw_cue_reader.h"
+#include "libodraw_cue_writer.h"
 #include "libodraw_data_file.h"
 #include "libodraw_data_file_descriptor.h"
+#include "libodraw_data_file_writer.h"
 #include "libodraw_debug.h"
+#include "libodraw_decoded_file_io_handle.h"
 #include "libodraw_definitions.h"
+#include "libodraw_direct_file_io_handle.h"
+#include "libodraw_ecm_file.h"
+#include "libodraw_extent.h"
 #include "libodraw_io_handle.h"
 #include "libodraw_handle.h"
+#include "libodraw_layout_arena.h"
+#include "libodraw_layout_cache.h"
 #include "libodraw_libbfio.h"
 #include "libodraw_libcdata.h"
 #include "libodraw_libcerror.h"
@@ -42,8 +52,12 @@
 #include "libodraw_libcpath.h"
 #include "libodraw_libuna.h"
 #include "libodraw_sector_range.h"
+#include "libodraw_sector_scan.h"
+#include "libodraw_shared_layout.h"
+#include "libodraw_statistics.h"
 #include "libodraw_track_value.h"
 #include "libodraw_types.h"
+#include "libodraw_zstd_file.h"
 
 extern \
 int libodraw_cue_parser_parse_buffer(
@@ -130,22 +144,21 @@ int libodraw_handle_initialize(
 
 		goto on_error;
 	}
-	if( libcdata_array_initialize(
-	     &( internal_handle->sessions_array ),
-	     0,
+	if( libodraw_layout_arena_initialize(
+	     &( internal_handle->layout_arena ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create sessions array.",
+		 "%s: unable to create layout arena.",
 		 function );
 
 		goto on_error;
 	}
 	if( libcdata_array_initialize(
-	     &( internal_handle->run_outs_array ),
+	     &( internal_handle->extents_array ),
 	     0,
 	     error ) != 1 )
 	{
@@ -153,13 +166,13 @@ int libodraw_handle_initialize(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create run-outs array.",
+		 "%s: unable to create extents array.",
 		 function );
 
 		goto on_error;
 	}
 	if( libcdata_array_initialize(
-	     &( internal_handle->lead_outs_array ),
+	     &( internal_handle->data_file_writers_array ),
 	     0,
 	     error ) != 1 )
 	{
@@ -167,21 +180,34 @@ int libodraw_handle_initialize(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create lead-outs array.",
+		 "%s: unable to create data file writers array.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcdata_array_initialize(
-	     &( internal_handle->tracks_array ),
-	     0,
+	if( libodraw_statistics_initialize(
+	     &( internal_handle->statistics ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_read_ahead_initialize(
+	     &( internal_handle->read_ahead ),
+	     LIBODRAW_READ_AHEAD_DEFAULT_WINDOW_SIZE,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create tracks array.",
+		 "%s: unable to create read-ahead.",
 		 function );
 
 		goto on_error;
@@ -199,7 +225,7 @@ int libodraw_handle_initialize(
 
 		goto on_error;
 	}
-	internal_handle->maximum_number_of_open_handles = LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES;
+	internal_handle->use_read_ahead = 1;
 
 	*handle = (libodraw_handle_t *) internal_handle;
 
@@ -208,34 +234,38 @@ int libodraw_handle_initialize(
 on_error:
 	if( internal_handle != NULL )
 	{
-		if( internal_handle->tracks_array != NULL )
+		if( internal_handle->read_ahead != NULL )
 		{
-			libcdata_array_free(
-			 &( internal_handle->tracks_array ),
-			 NULL,
+			libodraw_read_ahead_free(
+			 &( internal_handle->read_ahead ),
 			 NULL );
 		}
-		if( internal_handle->lead_outs_array != NULL )
+		if( internal_handle->statistics != NULL )
 		{
-			libcdata_array_free(
-			 &( internal_handle->lead_outs_array ),
-			 NULL,
+			libodraw_statistics_free(
+			 &( internal_handle->statistics ),
 			 NULL );
 		}
-		if( internal_handle->run_outs_array != NULL )
+		if( internal_handle->data_file_writers_array != NULL )
 		{
 			libcdata_array_free(
-			 &( internal_handle->run_outs_array ),
+			 &( internal_handle->data_file_writers_array ),
 			 NULL,
 			 NULL );
 		}
-		if( internal_handle->sessions_array != NULL )
+		if( internal_handle->extents_array != NULL )
 		{
 			libcdata_array_free(
-			 &( internal_handle->sessions_array ),
+			 &( internal_handle->extents_array ),
 			 NULL,
 			 NULL );
 		}
+		if( internal_handle->layout_arena != NULL )
+		{
+			libodraw_layout_arena_free(
+			 &( internal_handle->layout_arena ),
+			 NULL );
+		}
 		if( internal_handle->data_file_descriptors_array != NULL )
 		{
 			libcdata_array_free(
@@ -276,7 +306,8 @@ int libodraw_handle_free(
 		internal_handle = (libodraw_internal_handle_t *) *handle;
 
 		if( ( internal_handle->toc_file_io_handle != NULL )
-		 || ( internal_handle->data_file_io_pool != NULL ) )
+		 || ( internal_handle->data_file_io_pool != NULL )
+		 || ( internal_handle->shared_layout != NULL ) )
 		{
 			if( libodraw_handle_close(
 			     *handle,
@@ -308,390 +339,552 @@ int libodraw_handle_free(
 
 			result = -1;
 		}
-		if( libcdata_array_free(
-		     &( internal_handle->sessions_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_range_free,
+		if( libodraw_layout_arena_free(
+		     &( internal_handle->layout_arena ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sessions array.",
+			 "%s: unable to free layout arena.",
 			 function );
 
 			result = -1;
 		}
 		if( libcdata_array_free(
-		     &( internal_handle->run_outs_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_range_free,
+		     &( internal_handle->extents_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_extent_free,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free run-outs array.",
+			 "%s: unable to free extents array.",
 			 function );
 
 			result = -1;
 		}
 		if( libcdata_array_free(
-		     &( internal_handle->lead_outs_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_range_free,
+		     &( internal_handle->data_file_writers_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_data_file_writer_free,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free lead-outs array.",
+			 "%s: unable to free data file writers array.",
 			 function );
 
 			result = -1;
 		}
-		if( libcdata_array_free(
-		     &( internal_handle->tracks_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_track_value_free,
+		if( libodraw_io_handle_free(
+		     &( internal_handle->io_handle ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free tracks array.",
+			 "%s: unable to free IO handle.",
 			 function );
 
 			result = -1;
 		}
-		if( libodraw_io_handle_free(
-		     &( internal_handle->io_handle ),
+		if( libodraw_statistics_free(
+		     &( internal_handle->statistics ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free IO handle.",
+			 "%s: unable to free statistics.",
+			 function );
+
+			result = -1;
+		}
+		if( libodraw_read_ahead_free(
+		     &( internal_handle->read_ahead ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read-ahead.",
 			 function );
 
 			result = -1;
 		}
+		if( internal_handle->open_file_budget != NULL )
+		{
+			if( libodraw_open_file_budget_free(
+			     &( internal_handle->open_file_budget ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free open file budget.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_handle->data_file_access_counts != NULL )
+		{
+			memory_free(
+			 internal_handle->data_file_access_counts );
+		}
 		memory_free(
 		 internal_handle );
 	}
 	return( result );
 }
 
-/* Signals the handle to abort its current activity
+/* Clones an open handle for reading
+ * The clone shares the layout of the source handle, which is read-only and reference counted,
+ * and has its own current offset, read-ahead and statistics
+ * Unless LIBODRAW_CLONE_FLAG_WITHOUT_DATA_FILES is set the clone has its own data file IO handles,
+ * which are opened on first access, otherwise they can be provided with
+ * libodraw_handle_open_data_files_file_io_pool
+ * The source handle must not be used by another thread while it is cloned
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_signal_abort(
-     libodraw_handle_t *handle,
+int libodraw_handle_clone(
+     libodraw_handle_t **destination_handle,
+     libodraw_handle_t *source_handle,
+     uint8_t clone_flags,
      libcerror_error_t **error )
 {
-	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_signal_abort";
+	libbfio_pool_t *data_file_io_pool                       = NULL;
+	libodraw_internal_handle_t *internal_destination_handle = NULL;
+	libodraw_internal_handle_t *internal_source_handle      = NULL;
+	libodraw_shared_layout_t *shared_layout                 = NULL;
+	static char *function                                   = "libodraw_handle_clone";
 
-	if( handle == NULL )
+	if( destination_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid destination handle.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libodraw_internal_handle_t *) handle;
-
-	if( internal_handle->io_handle == NULL )
+	if( *destination_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination handle value already set.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle->io_handle->abort = 1;
-
-	return( 1 );
-}
-
-/* Opens a handle using a table of contents (TOC) file
- * Returns 1 if successful or -1 on error
- */
-int libodraw_handle_open(
-     libodraw_handle_t *handle,
-     const char *filename,
-     int access_flags,
-     libcerror_error_t **error )
-{
-	libbfio_handle_t *file_io_handle            = NULL;
-	libodraw_internal_handle_t *internal_handle = NULL;
-	char *basename_end                          = NULL;
-	static char *function                       = "libodraw_handle_open";
-	size_t basename_length                      = 0;
-	size_t filename_length                      = 0;
-
-	if( handle == NULL )
+	if( source_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid source handle.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libodraw_internal_handle_t *) handle;
+	internal_source_handle = (libodraw_internal_handle_t *) source_handle;
 
-	if( internal_handle->basename != NULL )
+	if( ( internal_source_handle->access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid handle - basename already set.",
-		 function );
-
-		return( -1 );
-	}
-	if( filename == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid source handle - write access currently not supported.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBODRAW_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) == 0 ) )
+	/* The layout is complete once the media values are set, which is when the data files are opened
+	 */
+	if( internal_source_handle->data_file_io_pool == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid source handle - missing data file IO pool.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) != 0 )
+	if( ( clone_flags & ~( LIBODRAW_CLONE_FLAG_WITHOUT_DATA_FILES ) ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
-		 function );
+		 "%s: unsupported clone flags: 0x%02" PRIx8 ".",
+		 function,
+		 clone_flags );
 
 		return( -1 );
 	}
-	filename_length = narrow_string_length(
-	                   filename );
-
-	basename_end = narrow_string_search_character_reverse(
-	                filename,
-	                (int) LIBCPATH_SEPARATOR,
-	                filename_length + 1 );
-
-	if( basename_end != NULL )
-	{
-		basename_length = (size_t) ( basename_end - filename ) + 1;
-	}
-	if( basename_length > 0 )
+	/* The first clone moves the layout of the source handle into a shared layout
+	 */
+	if( internal_source_handle->shared_layout == NULL )
 	{
-		if( libodraw_internal_handle_set_basename(
-		     internal_handle,
-		     filename,
-		     basename_length,
+		if( libodraw_shared_layout_initialize(
+		     &shared_layout,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set basename.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create shared layout.",
 			 function );
 
 			goto on_error;
 		}
+		shared_layout->data_file_descriptors_array = internal_source_handle->data_file_descriptors_array;
+		shared_layout->layout_arena                = internal_source_handle->layout_arena;
+		shared_layout->extents_array               = internal_source_handle->extents_array;
+
+		internal_source_handle->shared_layout = shared_layout;
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
+	if( libodraw_handle_initialize(
+	     destination_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 "%s: unable to create destination handle.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
+	internal_destination_handle = (libodraw_internal_handle_t *) *destination_handle;
+
+	/* Replace the empty layout of the destination handle by that of the shared layout
+	 */
+	if( libcdata_array_free(
+	     &( internal_destination_handle->data_file_descriptors_array ),
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_data_file_descriptor_free,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set track offsets read in file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free destination data file descriptors array.",
 		 function );
 
 		goto on_error;
 	}
-#endif
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
+	if( libodraw_layout_arena_free(
+	     &( internal_destination_handle->layout_arena ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set filename in file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free destination layout arena.",
 		 function );
 
 		goto on_error;
 	}
-	if( libodraw_handle_open_file_io_handle(
-	     handle,
-	     file_io_handle,
-	     access_flags,
+	if( libcdata_array_free(
+	     &( internal_destination_handle->extents_array ),
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_extent_free,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %s.",
-		 function,
-		 filename );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free destination extents array.",
+		 function );
 
 		goto on_error;
 	}
-	internal_handle->toc_file_io_handle_created_in_library = 1;
-
-	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	if( internal_handle->basename != NULL )
-	{
-		memory_free(
-		 internal_handle->basename );
-
-		internal_handle->basename = NULL;
-	}
-	internal_handle->basename_size = 0;
-
-	return( -1 );
-}
-
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Opens a handle using a table of contents (TOC) file
- * Returns 1 if successful or -1 on error
- */
-int libodraw_handle_open_wide(
-     libodraw_handle_t *handle,
-     const wchar_t *filename,
-     int access_flags,
-     libcerror_error_t **error )
-{
-	libbfio_handle_t *file_io_handle            = NULL;
-	libodraw_internal_handle_t *internal_handle = NULL;
-	wchar_t *basename_end                       = NULL;
-	static char *function                       = "libodraw_handle_open_wide";
-	size_t basename_length                      = 0;
-	size_t filename_length                      = 0;
-
-	if( handle == NULL )
+	if( libodraw_shared_layout_add_reference(
+	     internal_source_handle->shared_layout,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add reference to shared layout.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_handle = (libodraw_internal_handle_t *) handle;
-
-	if( internal_handle->basename != NULL )
+	internal_destination_handle->shared_layout               = internal_source_handle->shared_layout;
+	internal_destination_handle->data_file_descriptors_array = internal_source_handle->data_file_descriptors_array;
+	internal_destination_handle->layout_arena                = internal_source_handle->layout_arena;
+	internal_destination_handle->extents_array               = internal_source_handle->extents_array;
+	internal_destination_handle->media_size                  = internal_source_handle->media_size;
+	internal_destination_handle->number_of_sectors           = internal_source_handle->number_of_sectors;
+	internal_destination_handle->access_flags                = internal_source_handle->access_flags;
+	internal_destination_handle->use_direct_io               = internal_source_handle->use_direct_io;
+	internal_destination_handle->use_read_ahead              = internal_source_handle->use_read_ahead;
+
+	internal_destination_handle->io_handle->bytes_per_sector = internal_source_handle->io_handle->bytes_per_sector;
+	internal_destination_handle->io_handle->mode             = internal_source_handle->io_handle->mode;
+	internal_destination_handle->io_handle->ascii_codepage   = internal_source_handle->io_handle->ascii_codepage;
+
+	internal_destination_handle->statistics->collect_timing = internal_source_handle->statistics->collect_timing;
+
+	if( libodraw_read_ahead_set_window_size(
+	     internal_destination_handle->read_ahead,
+	     internal_source_handle->read_ahead->window_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid handle - basename already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read-ahead window size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( filename == NULL )
+	if( internal_source_handle->basename != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
-		 function );
+		internal_destination_handle->basename = system_string_allocate(
+		                                         internal_source_handle->basename_size );
 
-		return( -1 );
-	}
-	if( ( ( access_flags & LIBODRAW_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) == 0 ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
-		 function );
+		if( internal_destination_handle->basename == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create basename.",
+			 function );
 
-		return( -1 );
-	}
-	if( ( access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) != 0 )
+			goto on_error;
+		}
+		if( system_string_copy(
+		     internal_destination_handle->basename,
+		     internal_source_handle->basename,
+		     internal_source_handle->basename_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy basename.",
+			 function );
+
+			goto on_error;
+		}
+		internal_destination_handle->basename_size = internal_source_handle->basename_size;
+	}
+	if( internal_source_handle->open_file_budget != NULL )
+	{
+		if( libodraw_handle_share_maximum_number_of_open_handles(
+		     *destination_handle,
+		     source_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to share maximum number of open handles.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( clone_flags & LIBODRAW_CLONE_FLAG_WITHOUT_DATA_FILES ) == 0 )
+	{
+		/* The cloned data file IO handles are not open and are opened by the pool on first access
+		 */
+		if( libbfio_pool_clone(
+		     &data_file_io_pool,
+		     internal_source_handle->data_file_io_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone data file IO pool.",
+			 function );
+
+			goto on_error;
+		}
+		if( libodraw_handle_open_data_files_file_io_pool(
+		     *destination_handle,
+		     data_file_io_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open data files of destination handle.",
+			 function );
+
+			goto on_error;
+		}
+		internal_destination_handle->data_file_io_pool_created_in_library = 1;
+
+		data_file_io_pool = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( data_file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &data_file_io_pool,
+		 NULL );
+	}
+	if( *destination_handle != NULL )
+	{
+		libodraw_handle_free(
+		 destination_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Signals the handle to abort its current activity
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_signal_abort(
+     libodraw_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_signal_abort";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->io_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Opens a handle using a table of contents (TOC) file
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_open(
+     libodraw_handle_t *handle,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle            = NULL;
+	libodraw_internal_handle_t *internal_handle = NULL;
+	char *basename_end                          = NULL;
+	static char *function                       = "libodraw_handle_open";
+	size_t basename_length                      = 0;
+	size_t filename_length                      = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->basename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - basename already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBODRAW_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 "%s: unsupported access flags.",
 		 function );
 
 		return( -1 );
 	}
-	filename_length = wide_string_length(
+	if( ( ( access_flags & LIBODRAW_ACCESS_FLAG_READ ) != 0 )
+	 && ( ( access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: read and write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = narrow_string_length(
 	                   filename );
 
-/* TODO does this work for UTF-16 ? */
-	basename_end = wide_string_search_character_reverse(
+	basename_end = narrow_string_search_character_reverse(
 	                filename,
-	                (wint_t) LIBCPATH_SEPARATOR,
+	                (int) LIBCPATH_SEPARATOR,
 	                filename_length + 1 );
 
 	if( basename_end != NULL )
@@ -700,7 +893,7 @@ int libodraw_handle_open_wide(
 	}
 	if( basename_length > 0 )
 	{
-		if( libodraw_internal_handle_set_basename_wide(
+		if( libodraw_internal_handle_set_basename(
 		     internal_handle,
 		     filename,
 		     basename_length,
@@ -745,11 +938,10 @@ int libodraw_handle_open_wide(
 		goto on_error;
 	}
 #endif
-	if( libbfio_file_set_name_wide(
+	if( libbfio_file_set_name(
 	     file_io_handle,
 	     filename,
-	     wide_string_length(
-	      filename ) + 1,
+	     filename_length + 1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -761,6 +953,27 @@ int libodraw_handle_open_wide(
 
 		goto on_error;
 	}
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( ( internal_handle->use_layout_cache != 0 )
+	 && ( ( access_flags & LIBODRAW_ACCESS_FLAG_READ ) != 0 ) )
+	{
+		if( libodraw_internal_handle_create_layout_cache(
+		     internal_handle,
+		     filename,
+		     filename_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create layout cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
 	if( libodraw_handle_open_file_io_handle(
 	     handle,
 	     file_io_handle,
@@ -771,7 +984,7 @@ int libodraw_handle_open_wide(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %ls.",
+		 "%s: unable to open file: %s.",
 		 function,
 		 filename );
 
@@ -779,9 +992,31 @@ int libodraw_handle_open_wide(
 	}
 	internal_handle->toc_file_io_handle_created_in_library = 1;
 
+	if( internal_handle->layout_cache != NULL )
+	{
+		if( libodraw_layout_cache_free(
+		     &( internal_handle->layout_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free layout cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 
 on_error:
+	if( internal_handle->layout_cache != NULL )
+	{
+		libodraw_layout_cache_free(
+		 &( internal_handle->layout_cache ),
+		 NULL );
+	}
 	if( file_io_handle != NULL )
 	{
 		libbfio_handle_free(
@@ -800,22 +1035,23 @@ on_error:
 	return( -1 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
 
-/* Opens a handle using a Basic File IO (bfio) handle of a table of contents (TOC) file
+/* Opens a handle using a table of contents (TOC) file
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_open_file_io_handle(
+int libodraw_handle_open_wide(
      libodraw_handle_t *handle,
-     libbfio_handle_t *file_io_handle,
+     const wchar_t *filename,
      int access_flags,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle            = NULL;
 	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_open_file_io_handle";
-	uint8_t file_io_handle_opened_in_library    = 0;
-	int bfio_access_flags                       = 0;
-	int file_io_handle_is_open                  = 0;
+	wchar_t *basename_end                       = NULL;
+	static char *function                       = "libodraw_handle_open_wide";
+	size_t basename_length                      = 0;
+	size_t filename_length                      = 0;
 
 	if( handle == NULL )
 	{
@@ -830,24 +1066,24 @@ int libodraw_handle_open_file_io_handle(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( internal_handle->toc_file_io_handle != NULL )
+	if( internal_handle->basename != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid handle - file IO handle already set.",
+		 "%s: invalid handle - basename already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_io_handle == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file IO handle.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
@@ -864,104 +1100,192 @@ int libodraw_handle_open_file_io_handle(
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) != 0 )
+	if( ( ( access_flags & LIBODRAW_ACCESS_FLAG_READ ) != 0 )
+	 && ( ( access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 "%s: read and write access currently not supported.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBODRAW_ACCESS_FLAG_READ ) != 0 )
+	filename_length = wide_string_length(
+	                   filename );
+
+/* TODO does this work for UTF-16 ? */
+	basename_end = wide_string_search_character_reverse(
+	                filename,
+	                (wint_t) LIBCPATH_SEPARATOR,
+	                filename_length + 1 );
+
+	if( basename_end != NULL )
 	{
-		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+		basename_length = (size_t) ( basename_end - filename ) + 1;
 	}
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          file_io_handle,
-	                          error );
-
-	if( file_io_handle_is_open == -1 )
+	if( basename_length > 0 )
 	{
-		libcerror_error_set(
+		if( libodraw_internal_handle_set_basename_wide(
+		     internal_handle,
+		     filename,
+		     basename_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set basename.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	else if( file_io_handle_is_open == 0 )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
 	{
-		if( libbfio_handle_open(
-		     file_io_handle,
-		     bfio_access_flags,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set track offsets read in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     wide_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( ( internal_handle->use_layout_cache != 0 )
+	 && ( ( access_flags & LIBODRAW_ACCESS_FLAG_READ ) != 0 ) )
+	{
+		if( libodraw_internal_handle_create_layout_cache(
+		     internal_handle,
+		     filename,
+		     filename_length,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create layout cache.",
 			 function );
 
 			goto on_error;
 		}
-		file_io_handle_opened_in_library = 1;
 	}
-	if( libodraw_handle_open_read(
-	     internal_handle,
+#endif
+	if( libodraw_handle_open_file_io_handle(
+	     handle,
 	     file_io_handle,
+	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from handle.",
-		 function );
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %ls.",
+		 function,
+		 filename );
 
 		goto on_error;
 	}
-	internal_handle->access_flags                         = access_flags;
-	internal_handle->toc_file_io_handle                   = file_io_handle;
-	internal_handle->toc_file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+	internal_handle->toc_file_io_handle_created_in_library = 1;
+
+	if( internal_handle->layout_cache != NULL )
+	{
+		if( libodraw_layout_cache_free(
+		     &( internal_handle->layout_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free layout cache.",
+			 function );
 
+			return( -1 );
+		}
+	}
 	return( 1 );
 
 on_error:
-	if( ( file_io_handle_is_open == 0 )
-	 && ( file_io_handle_opened_in_library != 0 ) )
+	if( internal_handle->layout_cache != NULL )
 	{
-		libbfio_handle_close(
-		 file_io_handle,
-		 error );
+		libodraw_layout_cache_free(
+		 &( internal_handle->layout_cache ),
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( internal_handle->basename != NULL )
+	{
+		memory_free(
+		 internal_handle->basename );
+
+		internal_handle->basename = NULL;
 	}
+	internal_handle->basename_size = 0;
+
 	return( -1 );
 }
 
-/* Opens the data files
- * If the data filenames were not set explicitly this function assumes the data files
- * are in the same location as the table of contents (TOC) file
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Opens a handle using a Basic File IO (bfio) handle of a table of contents (TOC) file
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_open_data_files(
+int libodraw_handle_open_file_io_handle(
      libodraw_handle_t *handle,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
      libcerror_error_t **error )
 {
-	libodraw_data_file_descriptor_t *data_file_descriptor = NULL;
-	libodraw_internal_handle_t *internal_handle           = NULL;
-	system_character_t *data_file_location                = NULL;
-	system_character_t *data_file_name_start              = NULL;
-	static char *function                                 = "libodraw_handle_open_data_files";
-	size_t data_file_location_size                        = 0;
-	size_t data_file_name_size                            = 0;
-	int data_file_descriptor_index                        = 0;
-	int number_of_data_file_descriptors                   = 0;
-	int result                                            = 0;
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_open_file_io_handle";
+	uint8_t file_io_handle_opened_in_library    = 0;
+	int bfio_access_flags                       = 0;
+	int file_io_handle_is_open                  = 0;
 
 	if( handle == NULL )
 	{
@@ -976,72 +1300,254 @@ int libodraw_handle_open_data_files(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( internal_handle->toc_file_io_handle == NULL )
+	if( internal_handle->toc_file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing TOC file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_handle->data_file_descriptors_array,
-	     &number_of_data_file_descriptors,
-	     error ) != 1 )
+	if( internal_handle->shared_layout != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of data file descriptors.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - shared layout already set.",
 		 function );
 
 		return( -1 );
 	}
-	for( data_file_descriptor_index = 0;
-	     data_file_descriptor_index < number_of_data_file_descriptors;
-	     data_file_descriptor_index++ )
+	if( file_io_handle == NULL )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_handle->data_file_descriptors_array,
-		     data_file_descriptor_index,
-		     (intptr_t **) &data_file_descriptor,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBODRAW_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBODRAW_ACCESS_FLAG_READ ) != 0 )
+	 && ( ( access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: read and write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBODRAW_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	else
+	{
+		bfio_access_flags = LIBBFIO_OPEN_WRITE_TRUNCATE;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     bfio_access_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data file descriptor: %d.",
-			 function,
-			 data_file_descriptor_index );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
 
 			goto on_error;
 		}
-		if( data_file_descriptor == NULL )
+		file_io_handle_opened_in_library = 1;
+	}
+	/* When writing the TOC file is written on close from the appended data files, sessions and tracks
+	 */
+	if( ( access_flags & LIBODRAW_ACCESS_FLAG_READ ) != 0 )
+	{
+		if( libodraw_handle_open_read(
+		     internal_handle,
+		     file_io_handle,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing data file descriptor: %d.",
-			 function,
-			 data_file_descriptor_index );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from handle.",
+			 function );
 
 			goto on_error;
 		}
-		if( ( data_file_descriptor->name == NULL )
-		 || ( data_file_descriptor->name_size == 0 ) )
+		/* The layout is complete once the TOC file is read
+		 */
+		if( libodraw_layout_arena_compact(
+		     internal_handle->layout_arena,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid data file descriptor: %d - missing name.",
-			 function,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to compact layout arena.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_handle->access_flags                         = access_flags;
+	internal_handle->toc_file_io_handle                   = file_io_handle;
+	internal_handle->toc_file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+
+	return( 1 );
+
+on_error:
+	if( ( file_io_handle_is_open == 0 )
+	 && ( file_io_handle_opened_in_library != 0 ) )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
+	}
+	return( -1 );
+}
+
+/* Opens the data files
+ * If the data filenames were not set explicitly this function assumes the data files
+ * are in the same location as the table of contents (TOC) file
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_open_data_files(
+     libodraw_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libodraw_data_file_descriptor_t *data_file_descriptor = NULL;
+	libodraw_internal_handle_t *internal_handle           = NULL;
+	system_character_t *data_file_location                = NULL;
+	system_character_t *data_file_name_start              = NULL;
+	static char *function                                 = "libodraw_handle_open_data_files";
+	size_t data_file_location_size                        = 0;
+	size_t data_file_name_size                            = 0;
+	int data_file_descriptor_index                        = 0;
+	int number_of_data_file_descriptors                   = 0;
+	int result                                            = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->toc_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing TOC file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->data_file_descriptors_array,
+	     &number_of_data_file_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data file descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_file_descriptor_index = 0;
+	     data_file_descriptor_index < number_of_data_file_descriptors;
+	     data_file_descriptor_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_handle->data_file_descriptors_array,
+		     data_file_descriptor_index,
+		     (intptr_t **) &data_file_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data file descriptor: %d.",
+			 function,
+			 data_file_descriptor_index );
+
+			goto on_error;
+		}
+		if( data_file_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing data file descriptor: %d.",
+			 function,
+			 data_file_descriptor_index );
+
+			goto on_error;
+		}
+		if( ( data_file_descriptor->name == NULL )
+		 || ( data_file_descriptor->name_size == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid data file descriptor: %d - missing name.",
+			 function,
 			 data_file_descriptor_index );
 
 			goto on_error;
@@ -1112,30 +1618,122 @@ int libodraw_handle_open_data_files(
 			data_file_location      = data_file_name_start;
 			data_file_location_size = data_file_name_size;
 		}
+		/* When writing the data files are created and pre-sized from the tracks
+		 */
+		if( ( internal_handle->access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) != 0 )
+		{
+			if( libodraw_handle_create_data_file(
+			     internal_handle,
+			     data_file_descriptor_index,
+			     data_file_location,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to create data file: %" PRIs_SYSTEM ".",
+				 function,
+				 data_file_location );
+
+				goto on_error;
+			}
+		}
+		else
+		{
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libodraw_handle_open_data_file_wide(
-			  internal_handle,
-			  data_file_descriptor_index,
-			  data_file_location,
-			  error );
+			data_file_descriptor->has_regenerated_checksums = (uint8_t) libodraw_decoded_file_io_handle_filename_has_extension_wide(
+			                                                             data_file_location,
+			                                                             data_file_location_size - 1,
+			                                                             ".ecm",
+			                                                             4 );
+
+			result = libodraw_decoded_file_io_handle_filename_has_extension_wide(
+			          data_file_location,
+			          data_file_location_size - 1,
+			          ".chd",
+			          4 );
+
+			if( result == 0 )
+			{
+				result = libodraw_decoded_file_io_handle_filename_has_extension_wide(
+				          data_file_location,
+				          data_file_location_size - 1,
+				          ".zst",
+				          4 );
+			}
 #else
-		result = libodraw_handle_open_data_file(
-			  internal_handle,
-			  data_file_descriptor_index,
-			  data_file_location,
-			  error );
+			data_file_descriptor->has_regenerated_checksums = (uint8_t) libodraw_decoded_file_io_handle_filename_has_extension(
+			                                                             data_file_location,
+			                                                             data_file_location_size - 1,
+			                                                             ".ecm",
+			                                                             4 );
+
+			result = libodraw_decoded_file_io_handle_filename_has_extension(
+			          data_file_location,
+			          data_file_location_size - 1,
+			          ".chd",
+			          4 );
+
+			if( result == 0 )
+			{
+				result = libodraw_decoded_file_io_handle_filename_has_extension(
+				          data_file_location,
+				          data_file_location_size - 1,
+				          ".zst",
+				          4 );
+			}
 #endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open data file: %" PRIs_SYSTEM ".",
-			 function,
-			 data_file_location );
+			if( data_file_descriptor->has_regenerated_checksums != 0 )
+			{
+				result = 1;
+			}
+			/* The size of a CHD, zstd or ECM data file is the size of its decompressed
+			 * or decoded data which is retrieved from the data file IO pool
+			 */
+			if( result == 0 )
+			{
+				if( libodraw_data_file_descriptor_set_size_from_file(
+				     data_file_descriptor,
+				     data_file_location,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_OPEN_FAILED,
+					 "%s: unable to determine size of data file: %" PRIs_SYSTEM ".",
+					 function,
+					 data_file_location );
 
-			goto on_error;
+					goto on_error;
+				}
+			}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libodraw_handle_open_data_file_wide(
+				  internal_handle,
+				  data_file_descriptor_index,
+				  data_file_location,
+				  error );
+#else
+			result = libodraw_handle_open_data_file(
+				  internal_handle,
+				  data_file_descriptor_index,
+				  data_file_location,
+				  error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open data file: %" PRIs_SYSTEM ".",
+				 function,
+				 data_file_location );
+
+				goto on_error;
+			}
 		}
 		if( ( data_file_location != NULL )
 		 && ( data_file_location != data_file_name_start ) )
@@ -1146,6 +1744,10 @@ int libodraw_handle_open_data_files(
 		data_file_name_start = NULL;
 		data_file_location   = NULL;
 	}
+	if( ( internal_handle->access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		return( 1 );
+	}
 	if( libodraw_handle_set_media_values(
 	     internal_handle,
 	     error ) != 1 )
@@ -1182,6 +1784,7 @@ int libodraw_handle_open_data_files_file_io_pool(
 {
 	libodraw_internal_handle_t *internal_handle = NULL;
 	static char *function                       = "libodraw_handle_open_data_files_file_io_pool";
+	int number_of_file_io_handles               = 0;
 
 	if( handle == NULL )
 	{
@@ -1196,7 +1799,8 @@ int libodraw_handle_open_data_files_file_io_pool(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( internal_handle->toc_file_io_handle == NULL )
+	if( ( internal_handle->toc_file_io_handle == NULL )
+	 && ( internal_handle->shared_layout == NULL ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1207,6 +1811,17 @@ int libodraw_handle_open_data_files_file_io_pool(
 
 		return( -1 );
 	}
+	if( ( internal_handle->access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_handle->data_file_io_pool != NULL )
 	{
 		libcerror_error_set(
@@ -1229,8 +1844,56 @@ int libodraw_handle_open_data_files_file_io_pool(
 
 		return( -1 );
 	}
+	if( libbfio_pool_get_number_of_handles(
+	     file_io_pool,
+	     &number_of_file_io_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file IO handles in pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_statistics_resize(
+	     internal_handle->statistics,
+	     number_of_file_io_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize data file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_internal_handle_resize_data_file_access_counts(
+	     internal_handle,
+	     number_of_file_io_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize data file access counts.",
+		 function );
+
+		return( -1 );
+	}
 	internal_handle->data_file_io_pool = file_io_pool;
 
+	/* A shared layout already contains the media values and is read-only
+	 */
+	if( internal_handle->shared_layout != NULL )
+	{
+		return( 1 );
+	}
 	if( libodraw_handle_set_media_values(
 	     internal_handle,
 	     error ) != 1 )
@@ -1256,8 +1919,11 @@ int libodraw_handle_open_data_file(
      const char *filename,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libodraw_handle_open_data_file";
+	libbfio_handle_t *chd_file_io_handle  = NULL;
+	libbfio_handle_t *ecm_file_io_handle  = NULL;
+	libbfio_handle_t *file_io_handle      = NULL;
+	libbfio_handle_t *zstd_file_io_handle = NULL;
+	static char *function                 = "libodraw_handle_open_data_file";
 
 	if( internal_handle == NULL )
 	{
@@ -1292,51 +1958,162 @@ int libodraw_handle_open_data_file(
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+#if defined( HAVE_LIBODRAW_DIRECT_FILE_IO_HANDLE )
+	if( internal_handle->use_direct_io != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
-		 function );
+		if( libodraw_direct_file_io_handle_initialize_handle(
+		     &file_io_handle,
+		     filename,
+		     narrow_string_length(
+		      filename ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create direct file IO handle.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
+	else
+#endif /* defined( HAVE_LIBODRAW_DIRECT_FILE_IO_HANDLE ) */
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set track offsets read in file IO handle.",
-		 function );
-
-		goto on_error;
-	}
-#endif
-	if( libbfio_file_set_name(
+		if( libbfio_file_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_file_set_name(
+		     file_io_handle,
+		     filename,
+		     narrow_string_length(
+		      filename ) + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
 	     file_io_handle,
-	     filename,
-	     narrow_string_length(
-	      filename ) + 1,
+	     1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set filename in file IO handle.",
+		 "%s: unable to set track offsets read in file IO handle.",
 		 function );
 
 		goto on_error;
 	}
+#endif
+	if( libodraw_decoded_file_io_handle_filename_has_extension(
+	     filename,
+	     narrow_string_length(
+	      filename ),
+	     ".chd",
+	     4 ) != 0 )
+	{
+		if( libodraw_decoded_file_io_handle_initialize_handle(
+		     &chd_file_io_handle,
+		     file_io_handle,
+		     (int (*)(intptr_t **, libcerror_error_t **)) libodraw_chd_file_initialize,
+		     (int (*)(intptr_t **, libcerror_error_t **)) libodraw_chd_file_free,
+		     (int (*)(intptr_t *, libbfio_handle_t *, libcerror_error_t **)) libodraw_chd_file_open_read,
+		     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libodraw_chd_file_read_buffer_at_offset,
+		     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libodraw_chd_file_get_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create CHD file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle     = chd_file_io_handle;
+		chd_file_io_handle = NULL;
+	}
+	else if( libodraw_decoded_file_io_handle_filename_has_extension(
+	          filename,
+	          narrow_string_length(
+	           filename ),
+	          ".zst",
+	          4 ) != 0 )
+	{
+		if( libodraw_decoded_file_io_handle_initialize_handle(
+		     &zstd_file_io_handle,
+		     file_io_handle,
+		     (int (*)(intptr_t **, libcerror_error_t **)) libodraw_zstd_file_initialize,
+		     (int (*)(intptr_t **, libcerror_error_t **)) libodraw_zstd_file_free,
+		     (int (*)(intptr_t *, libbfio_handle_t *, libcerror_error_t **)) libodraw_zstd_file_open_read,
+		     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libodraw_zstd_file_read_buffer_at_offset,
+		     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libodraw_zstd_file_get_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create zstd file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle      = zstd_file_io_handle;
+		zstd_file_io_handle = NULL;
+	}
+	else if( libodraw_decoded_file_io_handle_filename_has_extension(
+	          filename,
+	          narrow_string_length(
+	           filename ),
+	          ".ecm",
+	          4 ) != 0 )
+	{
+		if( libodraw_decoded_file_io_handle_initialize_handle(
+		     &ecm_file_io_handle,
+		     file_io_handle,
+		     (int (*)(intptr_t **, libcerror_error_t **)) libodraw_ecm_file_initialize,
+		     (int (*)(intptr_t **, libcerror_error_t **)) libodraw_ecm_file_free,
+		     (int (*)(intptr_t *, libbfio_handle_t *, libcerror_error_t **)) libodraw_ecm_file_open_read,
+		     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libodraw_ecm_file_read_buffer_at_offset,
+		     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libodraw_ecm_file_get_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create ECM file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle     = ecm_file_io_handle;
+		ecm_file_io_handle = NULL;
+	}
 	if( libodraw_handle_open_data_file_io_handle(
 	     internal_handle,
 	     data_file_index,
@@ -1376,8 +2153,11 @@ int libodraw_handle_open_data_file_wide(
      const wchar_t *filename,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libodraw_handle_open_data_file_wide";
+	libbfio_handle_t *chd_file_io_handle  = NULL;
+	libbfio_handle_t *ecm_file_io_handle  = NULL;
+	libbfio_handle_t *file_io_handle      = NULL;
+	libbfio_handle_t *zstd_file_io_handle = NULL;
+	static char *function                 = "libodraw_handle_open_data_file_wide";
 
 	if( internal_handle == NULL )
 	{
@@ -1457,6 +2237,93 @@ int libodraw_handle_open_data_file_wide(
 
 		goto on_error;
 	}
+	if( libodraw_decoded_file_io_handle_filename_has_extension_wide(
+	     filename,
+	     wide_string_length(
+	      filename ),
+	     ".chd",
+	     4 ) != 0 )
+	{
+		if( libodraw_decoded_file_io_handle_initialize_handle(
+		     &chd_file_io_handle,
+		     file_io_handle,
+		     (int (*)(intptr_t **, libcerror_error_t **)) libodraw_chd_file_initialize,
+		     (int (*)(intptr_t **, libcerror_error_t **)) libodraw_chd_file_free,
+		     (int (*)(intptr_t *, libbfio_handle_t *, libcerror_error_t **)) libodraw_chd_file_open_read,
+		     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libodraw_chd_file_read_buffer_at_offset,
+		     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libodraw_chd_file_get_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create CHD file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle     = chd_file_io_handle;
+		chd_file_io_handle = NULL;
+	}
+	else if( libodraw_decoded_file_io_handle_filename_has_extension_wide(
+	          filename,
+	          wide_string_length(
+	           filename ),
+	          ".zst",
+	          4 ) != 0 )
+	{
+		if( libodraw_decoded_file_io_handle_initialize_handle(
+		     &zstd_file_io_handle,
+		     file_io_handle,
+		     (int (*)(intptr_t **, libcerror_error_t **)) libodraw_zstd_file_initialize,
+		     (int (*)(intptr_t **, libcerror_error_t **)) libodraw_zstd_file_free,
+		     (int (*)(intptr_t *, libbfio_handle_t *, libcerror_error_t **)) libodraw_zstd_file_open_read,
+		     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libodraw_zstd_file_read_buffer_at_offset,
+		     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libodraw_zstd_file_get_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create zstd file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle      = zstd_file_io_handle;
+		zstd_file_io_handle = NULL;
+	}
+	else if( libodraw_decoded_file_io_handle_filename_has_extension_wide(
+	          filename,
+	          wide_string_length(
+	           filename ),
+	          ".ecm",
+	          4 ) != 0 )
+	{
+		if( libodraw_decoded_file_io_handle_initialize_handle(
+		     &ecm_file_io_handle,
+		     file_io_handle,
+		     (int (*)(intptr_t **, libcerror_error_t **)) libodraw_ecm_file_initialize,
+		     (int (*)(intptr_t **, libcerror_error_t **)) libodraw_ecm_file_free,
+		     (int (*)(intptr_t *, libbfio_handle_t *, libcerror_error_t **)) libodraw_ecm_file_open_read,
+		     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libodraw_ecm_file_read_buffer_at_offset,
+		     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libodraw_ecm_file_get_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create ECM file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle     = ecm_file_io_handle;
+		ecm_file_io_handle = NULL;
+	}
 	if( libodraw_handle_open_data_file_io_handle(
 	     internal_handle,
 	     data_file_index,
@@ -1572,10 +2439,14 @@ int libodraw_handle_open_data_file_io_handle(
 
 			return( -1 );
 		}
+		/* The number of open data files is limited by the open file budget
+		 * instead of the pool, so that the data files of the current and next track
+		 * are not closed by the pool
+		 */
 		if( libbfio_pool_initialize(
 		     &( internal_handle->data_file_io_pool ),
 		     number_of_data_file_descriptors,
-		     internal_handle->maximum_number_of_open_handles,
+		     LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1588,26 +2459,44 @@ int libodraw_handle_open_data_file_io_handle(
 			return( -1 );
 		}
 		internal_handle->data_file_io_pool_created_in_library = 1;
+
+		if( libodraw_statistics_resize(
+		     internal_handle->statistics,
+		     number_of_data_file_descriptors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize data file statistics.",
+			 function );
+
+			return( -1 );
+		}
+		if( libodraw_internal_handle_resize_data_file_access_counts(
+		     internal_handle,
+		     number_of_data_file_descriptors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize data file access counts.",
+			 function );
+
+			return( -1 );
+		}
 	}
 	if( ( internal_handle->access_flags & LIBODRAW_ACCESS_FLAG_READ ) != 0 )
 	{
 		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
 	}
-	if( libbfio_handle_open(
-	     file_io_handle,
-	     bfio_access_flags,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file IO handle.",
-		 function );
-
-		return( -1 );
-	}
-	/* This function currently does not allow the file_io_handle to be set more than once
+	/* The file IO handle is not opened here, the pool opens it with
+	 * the access flags on first access, so that only the data files
+	 * that are actually read from are opened
+	 * This function currently does not allow the file_io_handle to be set more than once
 	 */
 	if( libbfio_pool_set_handle(
 	     internal_handle->data_file_io_pool,
@@ -1629,18 +2518,27 @@ int libodraw_handle_open_data_file_io_handle(
 	return( 1 );
 }
 
-/* Closes a handle
- * Returns 0 if successful or -1 on error
+/* Creates a data file for writing
+ * The data file is pre-sized to the end of the last track that is stored in the data file
+ * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_close(
-     libodraw_handle_t *handle,
+int libodraw_handle_create_data_file(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     const system_character_t *filename,
      libcerror_error_t **error )
 {
-	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_close";
-	int result                                  = 0;
+	libodraw_data_file_writer_t *data_file_writer = NULL;
+	libodraw_track_value_t *track_value           = NULL;
+	static char *function                         = "libodraw_handle_create_data_file";
+	size64_t maximum_data_size                    = 0;
+	size64_t track_end_offset                     = 0;
+	int entry_index                               = 0;
+	int number_of_data_file_writers               = 0;
+	int number_of_tracks                          = 0;
+	int track_index                               = 0;
 
-	if( handle == NULL )
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1651,227 +2549,177 @@ int libodraw_handle_close(
 
 		return( -1 );
 	}
-	internal_handle = (libodraw_internal_handle_t *) handle;
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->data_file_writers_array,
+	     &number_of_data_file_writers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data file writers.",
+		 function );
 
-	if( internal_handle->toc_file_io_handle == NULL )
+		return( -1 );
+	}
+	/* The data files are created in order
+	 */
+	if( data_file_index != number_of_data_file_writers )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data file index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_layout_arena_get_number_of_tracks(
+	     internal_handle->layout_arena,
+	     &number_of_tracks,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing TOC file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tracks.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	for( track_index = 0;
+	     track_index < number_of_tracks;
+	     track_index++ )
 	{
-		if( internal_handle->toc_file_io_handle_created_in_library != 0 )
+		if( libodraw_layout_arena_get_track_by_index(
+		     internal_handle->layout_arena,
+		     track_index,
+		     &track_value,
+		     error ) != 1 )
 		{
-			if( libodraw_debug_print_read_offsets(
-			     internal_handle->toc_file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve track value: %d.",
+			 function,
+			 track_index );
 
-				result = -1;
-			}
+			return( -1 );
 		}
-	}
-#endif
-	if( internal_handle->toc_file_io_handle_opened_in_library != 0 )
-	{
-		if( libbfio_handle_close(
-		     internal_handle->toc_file_io_handle,
-		     error ) != 0 )
+		if( track_value == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close TOC file IO handle.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing track value: %d.",
+			 function,
+			 track_index );
 
-			result = -1;
+			return( -1 );
 		}
-		internal_handle->toc_file_io_handle_opened_in_library = 0;
-	}
-	if( internal_handle->toc_file_io_handle_created_in_library != 0 )
-	{
-		if( libbfio_handle_free(
-		     &( internal_handle->toc_file_io_handle ),
-		     error ) != 1 )
+		if( track_value->data_file_index != data_file_index )
+		{
+			continue;
+		}
+		/* The number of sectors of a track cannot be determined from the data file when writing
+		 */
+		if( track_value->number_of_sectors == 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free TOC file IO handle.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid track value: %d - missing number of sectors.",
+			 function,
+			 track_index );
 
-			result = -1;
+			return( -1 );
+		}
+		track_end_offset = (size64_t) track_value->data_file_offset
+		                 + ( track_value->number_of_sectors * track_value->bytes_per_sector );
+
+		if( track_end_offset > maximum_data_size )
+		{
+			maximum_data_size = track_end_offset;
 		}
-		internal_handle->toc_file_io_handle_created_in_library = 0;
 	}
-	internal_handle->toc_file_io_handle = NULL;
+	if( libodraw_data_file_writer_initialize(
+	     &data_file_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data file writer.",
+		 function );
 
-	if( internal_handle->data_file_io_pool != 0 )
-	{
-		if( internal_handle->data_file_io_pool != NULL )
-		{
-			if( libbfio_pool_close_all(
-			     internal_handle->data_file_io_pool,
-			     error ) != 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_GENERIC,
-				 "%s: unable close data files IO pool.",
-				 function );
-
-				result = -1;
-			}
-			if( libbfio_pool_free(
-			     &( internal_handle->data_file_io_pool ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free data files IO pool.",
-				 function );
-
-				result = -1;
-			}
-		}
-		internal_handle->data_file_io_pool_created_in_library = 0;
-	}
-	internal_handle->data_file_io_pool = NULL;
-
-	internal_handle->current_offset    = 0;
-	internal_handle->current_run_out   = 0;
-	internal_handle->current_lead_out  = 0;
-	internal_handle->current_track     = 0;
-	internal_handle->media_size        = 0;
-	internal_handle->number_of_sectors = 0;
-
-	if( libodraw_io_handle_clear(
-	     internal_handle->io_handle,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
-		 function );
-
-		result = -1;
-	}
-	if( libcdata_array_empty(
-	     internal_handle->data_file_descriptors_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_data_file_descriptor_free,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty data file descriptors array.",
-		 function );
-
-		result = -1;
-	}
-	if( libcdata_array_empty(
-	     internal_handle->sessions_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_range_free,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty sessions array.",
-		 function );
-
-		result = -1;
-	}
-	if( libcdata_array_empty(
-	     internal_handle->run_outs_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_range_free,
-	     error ) != 1 )
+		goto on_error;
+	}
+	if( libodraw_data_file_writer_open(
+	     data_file_writer,
+	     filename,
+	     maximum_data_size,
+	     internal_handle->use_direct_io,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty run-outs array.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open data file writer.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	if( libcdata_array_empty(
-	     internal_handle->lead_outs_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_range_free,
+	if( libcdata_array_append_entry(
+	     internal_handle->data_file_writers_array,
+	     &entry_index,
+	     (intptr_t *) data_file_writer,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty lead-outs array.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append data file writer.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	if( libcdata_array_empty(
-	     internal_handle->tracks_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_track_value_free,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty tracks array.",
-		 function );
+	return( 1 );
 
-		result = -1;
-	}
-	if( internal_handle->basename != NULL )
+on_error:
+	if( data_file_writer != NULL )
 	{
-		memory_free(
-		 internal_handle->basename );
-
-		internal_handle->basename = NULL;
+		libodraw_data_file_writer_free(
+		 &data_file_writer,
+		 NULL );
 	}
-	internal_handle->basename_size = 0;
-
-	return( result );
+	return( -1 );
 }
 
-/* Opens a handle for reading
- * Returns 1 if successful or -1 on error
+/* Closes the data files and writes the table of contents (TOC) file when writing
+ * Returns 0 if successful or -1 on error
  */
-int libodraw_handle_open_read(
+int libodraw_internal_handle_close_write(
      libodraw_internal_handle_t *internal_handle,
-     libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	uint8_t *buffer       = NULL;
-	static char *function = "libodraw_handle_open_read";
-	size64_t file_size    = 0;
-	size_t buffer_size    = 0;
-	ssize_t read_count    = 0;
-	int result            = 1;
+	libodraw_data_file_writer_t *data_file_writer = NULL;
+	uint8_t *data                                 = NULL;
+	static char *function                         = "libodraw_internal_handle_close_write";
+	size_t data_size                              = 0;
+	ssize_t write_count                           = 0;
+	int data_file_index                           = 0;
+	int number_of_data_file_writers               = 0;
+	int number_of_tracks                          = 0;
+	int result                                    = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -1884,669 +2732,4413 @@ int libodraw_handle_open_read(
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle == NULL )
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->data_file_writers_array,
+	     &number_of_data_file_writers,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data file writers.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_empty(
-	     internal_handle->data_file_descriptors_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_track_value_free,
-	     error ) != 1 )
+	for( data_file_index = 0;
+	     data_file_index < number_of_data_file_writers;
+	     data_file_index++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty data file descriptors array.",
-		 function );
+		if( libcdata_array_get_entry_by_index(
+		     internal_handle->data_file_writers_array,
+		     data_file_index,
+		     (intptr_t **) &data_file_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data file writer: %d.",
+			 function,
+			 data_file_index );
 
-		goto on_error;
+			result = -1;
+		}
+		else if( libodraw_data_file_writer_close(
+		          data_file_writer,
+		          error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close data file writer: %d.",
+			 function,
+			 data_file_index );
+
+			result = -1;
+		}
 	}
 	if( libcdata_array_empty(
-	     internal_handle->sessions_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_range_free,
+	     internal_handle->data_file_writers_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_data_file_writer_free,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty sessions array.",
+		 "%s: unable to empty data file writers array.",
 		 function );
 
-		goto on_error;
+		result = -1;
 	}
-	if( libcdata_array_empty(
-	     internal_handle->run_outs_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_range_free,
+	if( libodraw_layout_arena_get_number_of_tracks(
+	     internal_handle->layout_arena,
+	     &number_of_tracks,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty run-outs array.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tracks.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdata_array_empty(
-	     internal_handle->lead_outs_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_sector_range_free,
-	     error ) != 1 )
+	if( number_of_tracks == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty lead-outs array.",
-		 function );
-
-		goto on_error;
+		return( result );
 	}
-	if( libcdata_array_empty(
-	     internal_handle->tracks_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_track_value_free,
+	if( libodraw_cue_writer_write_data(
+	     internal_handle->data_file_descriptors_array,
+	     internal_handle->layout_arena,
+	     &data,
+	     &data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty tracks array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write CUE data.",
 		 function );
 
-		goto on_error;
-	}
-	if( internal_handle->io_handle->abort != 0 )
-	{
-		internal_handle->io_handle->abort = 0;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "Reading file:\n" );
+		return( -1 );
 	}
-#endif
-	if( libbfio_handle_get_size(
-	     file_io_handle,
-	     &file_size,
-	     error ) != 1 )
+	write_count = libbfio_handle_write_buffer(
+	               internal_handle->toc_file_io_handle,
+	               data,
+	               data_size,
+	               error );
+
+	memory_free(
+	 data );
+
+	if( write_count != (ssize_t) data_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve TOC file size.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write TOC file data.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( file_size > (size64_t) SSIZE_MAX )
+	/* The TOC file is written regardless so that the data that was written can be accessed
+	 */
+	if( internal_handle->current_track < number_of_tracks )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid file size value exceeds maximum.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing data of track: %d.",
+		 function,
+		 internal_handle->current_track );
 
-		goto on_error;
+		result = -1;
 	}
-	/* Lex wants 2 zero bytes at the end of the buffer
-	 */
-	buffer_size = (size_t) file_size + 2;
+	return( result );
+}
 
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * buffer_size );
+/* Closes a handle
+ * Returns 0 if successful or -1 on error
+ */
+int libodraw_handle_close(
+     libodraw_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_close";
+	int result                                  = 0;
 
-	if( buffer == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create buffer.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading TOC file header at offset: 0 (0x00000000)\n",
-		 function );
+		return( -1 );
 	}
-#endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              buffer,
-	              (size_t) file_size,
-	              0,
-	              error );
+	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( read_count != (ssize_t) file_size )
+	if( ( internal_handle->toc_file_io_handle == NULL )
+	 && ( internal_handle->shared_layout == NULL ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read TOC file data at offset: 0 (0x00000000).",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing TOC file IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+	if( ( internal_handle->access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		if( libodraw_internal_handle_close_write(
+		     internal_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to close handle for writing.",
+			 function );
+
+			result = -1;
+		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		libcnotify_printf(
-		 "%s: file data:\n",
-		 function );
-		libcnotify_print_data(
-		 buffer,
-		 (size_t) file_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		if( internal_handle->toc_file_io_handle_created_in_library != 0 )
+		{
+			if( libodraw_debug_print_read_offsets(
+			     internal_handle->toc_file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+
+				result = -1;
+			}
+		}
 	}
 #endif
-	/* Lex wants 2 zero bytes at the end of the buffer
-	 */
-	buffer[ buffer_size - 2 ] = 0;
-	buffer[ buffer_size - 1 ] = 0;
-
-	result = libodraw_cue_parser_parse_buffer(
-	          (libodraw_handle_t *) internal_handle,
-	          buffer,
-	          buffer_size,
-	          error );
-
-	if( result == -1 )
+	if( internal_handle->toc_file_io_handle_opened_in_library != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to parse file data.",
-		 function );
+		if( libbfio_handle_close(
+		     internal_handle->toc_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close TOC file IO handle.",
+			 function );
 
-		goto on_error;
+			result = -1;
+		}
+		internal_handle->toc_file_io_handle_opened_in_library = 0;
 	}
-	memory_free(
-	 buffer );
-
-	buffer = NULL;
-
-	if( internal_handle->io_handle->abort != 0 )
+	if( internal_handle->toc_file_io_handle_created_in_library != 0 )
 	{
-		internal_handle->io_handle->abort = 0;
-	}
-	return( result );
+		if( libbfio_handle_free(
+		     &( internal_handle->toc_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free TOC file IO handle.",
+			 function );
 
-on_error:
-	if( buffer != NULL )
-	{
-		memory_free(
-		 buffer );
+			result = -1;
+		}
+		internal_handle->toc_file_io_handle_created_in_library = 0;
 	}
-	return( -1 );
-}
-
-/* Reads a buffer
- * Returns the number of bytes read or -1 on error
- */
-ssize_t libodraw_handle_read_buffer(
-         libodraw_handle_t *handle,
-         void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
-{
-	libodraw_internal_handle_t *internal_handle = NULL;
-	libodraw_sector_range_t *sector_range       = NULL;
-	libodraw_track_value_t *track_value         = NULL;
-	static char *function                       = "libodraw_handle_read_buffer";
-	size_t buffer_offset                        = 0;
-	ssize_t read_count                          = 0;
-	uint64_t current_sector                     = 0;
-	int in_known_range                          = 0;
-	int number_of_lead_outs                     = 0;
-	int number_of_run_outs                      = 0;
+	internal_handle->toc_file_io_handle = NULL;
 
-	if( handle == NULL )
+	if( internal_handle->data_file_io_pool != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
-		 function );
+		if( internal_handle->data_file_io_pool != NULL )
+		{
+			if( libodraw_internal_handle_release_data_files(
+			     internal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release data files.",
+				 function );
 
-		return( -1 );
-	}
-	internal_handle = (libodraw_internal_handle_t *) handle;
+				result = -1;
+			}
+			if( libbfio_pool_close_all(
+			     internal_handle->data_file_io_pool,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_GENERIC,
+				 "%s: unable close data files IO pool.",
+				 function );
 
-	if( internal_handle->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
-		 function );
+				result = -1;
+			}
+			if( libbfio_pool_free(
+			     &( internal_handle->data_file_io_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data files IO pool.",
+				 function );
 
-		return( -1 );
+				result = -1;
+			}
+		}
+		internal_handle->data_file_io_pool_created_in_library = 0;
 	}
-	if( internal_handle->io_handle->bytes_per_sector == 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
-		 function );
+	internal_handle->data_file_io_pool = NULL;
 
-		return( -1 );
-	}
-	if( internal_handle->current_offset < 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid handle - invalid IO handle - current offset value out of bounds.",
-		 function );
+	internal_handle->current_offset       = 0;
+	internal_handle->current_run_out      = 0;
+	internal_handle->current_lead_out     = 0;
+	internal_handle->current_track        = 0;
+	internal_handle->current_track_offset = 0;
+	internal_handle->media_size           = 0;
+	internal_handle->number_of_sectors    = 0;
 
-		return( -1 );
-	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_handle->run_outs_array,
-	     &number_of_run_outs,
+	if( libodraw_io_handle_clear(
+	     internal_handle->io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements in run-outs array.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_handle->lead_outs_array,
-	     &number_of_lead_outs,
+	if( libodraw_read_ahead_clear(
+	     internal_handle->read_ahead,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements in lead-outs array.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear read-ahead.",
 		 function );
 
-		return( -1 );
-	}
-	if( (size64_t) internal_handle->current_offset >= internal_handle->media_size )
-	{
-		return( 0 );
+		result = -1;
 	}
-	current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
-
-	if( current_sector > (uint64_t) UINT32_MAX )
+	if( internal_handle->shared_layout != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: current sector value out of bounds.",
-		 function );
+		if( libodraw_internal_handle_release_shared_layout(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release shared layout.",
+			 function );
 
-		return( -1 );
+			result = -1;
+		}
 	}
-	while( buffer_offset < buffer_size )
+	else
 	{
-		in_known_range = 0;
-
-		if( libcdata_array_get_entry_by_index(
-		     internal_handle->tracks_array,
-		     internal_handle->current_track,
-		     (intptr_t **) &track_value,
+		if( libcdata_array_empty(
+		     internal_handle->data_file_descriptors_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_data_file_descriptor_free,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve track value: %d from array.",
-			 function,
-			 internal_handle->current_track );
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty data file descriptors array.",
+			 function );
 
-			return( -1 );
+			result = -1;
 		}
-		if( track_value == NULL )
+		if( libodraw_layout_arena_empty(
+		     internal_handle->layout_arena,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing track value: %d.",
-			 function,
-			 internal_handle->current_track );
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty layout arena.",
+			 function );
 
-			return( -1 );
+			result = -1;
 		}
-		/* TODO currently assumes that current track start sector is always relative to the start of the media */
-		if( ( current_sector >= track_value->start_sector )
-		 && ( current_sector < track_value->end_sector ) )
+		if( libcdata_array_empty(
+		     internal_handle->extents_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_extent_free,
+		     error ) != 1 )
 		{
-			in_known_range = 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty extents array.",
+			 function );
 
-			read_count = libodraw_handle_read_buffer_from_track(
-			              internal_handle,
-			              (uint8_t *) &( ( (uint8_t *) buffer )[ buffer_offset ] ),
-			              buffer_size - buffer_offset,
-			              error );
+			result = -1;
+		}
+	}
+	if( internal_handle->sector_scan != NULL )
+	{
+		if( libodraw_sector_scan_free(
+		     &( internal_handle->sector_scan ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sector scan.",
+			 function );
 
-			if( read_count == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read buffer from track: %d.",
-				 function,
-				 internal_handle->current_track );
+			result = -1;
+		}
+	}
+	if( internal_handle->basename != NULL )
+	{
+		memory_free(
+		 internal_handle->basename );
 
-				return( -1 );
-			}
-			buffer_offset += read_count;
+		internal_handle->basename = NULL;
+	}
+	internal_handle->basename_size = 0;
 
-			internal_handle->current_offset += (off64_t) read_count;
+	return( result );
+}
 
-			current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+/* Releases the shared layout of a handle
+ * The layout is freed when the last handle that shares it releases the shared layout
+ * The handle gets a new empty layout so that it can be opened again
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_internal_handle_release_shared_layout(
+     libodraw_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_internal_handle_release_shared_layout";
+	int result            = 1;
 
-			if( current_sector > (uint64_t) UINT32_MAX )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: current sector value out of bounds.",
-				 function );
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
 
-				return( -1 );
-			}
-			if( current_sector >= track_value->end_sector )
-			{
-				internal_handle->current_track += 1;
-			}
-		}
-		if( buffer_offset >= buffer_size )
-		{
-			break;
-		}
-		if( (size64_t) internal_handle->current_offset >= internal_handle->media_size )
-		{
-			break;
-		}
-		if( internal_handle->current_run_out < number_of_run_outs )
-		{
-			if( libcdata_array_get_entry_by_index(
-			     internal_handle->run_outs_array,
-			     internal_handle->current_run_out,
-			     (intptr_t **) &sector_range,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve run-out sector range: %d from array.",
-				 function,
-				 internal_handle->current_run_out );
+		return( -1 );
+	}
+	if( internal_handle->shared_layout == NULL )
+	{
+		return( 1 );
+	}
+	internal_handle->data_file_descriptors_array = NULL;
+	internal_handle->layout_arena                = NULL;
+	internal_handle->extents_array               = NULL;
 
-				return( -1 );
-			}
-			if( sector_range == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing run-out sector range: %d.",
-				 function,
-				 internal_handle->current_run_out );
+	if( libodraw_shared_layout_free(
+	     &( internal_handle->shared_layout ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free shared layout.",
+		 function );
 
-				return( -1 );
-			}
-			/* TODO currently assumes that current run-out start sector is always relative to the start of the media */
-			if( ( current_sector >= sector_range->start_sector )
-			 && ( current_sector < sector_range->end_sector ) )
-			{
-				in_known_range = 1;
+		result = -1;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_handle->data_file_descriptors_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data file descriptors array.",
+		 function );
 
-				read_count = libodraw_handle_read_buffer_from_run_out(
-					      internal_handle,
-					      (uint8_t *) &( ( (uint8_t *) buffer )[ buffer_offset ] ),
-					      buffer_size - buffer_offset,
-					      error );
+		return( -1 );
+	}
+	if( libodraw_layout_arena_initialize(
+	     &( internal_handle->layout_arena ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create layout arena.",
+		 function );
 
-				if( read_count == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read buffer from run-out: %d.",
-					 function,
-					 internal_handle->current_run_out );
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_handle->extents_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extents array.",
+		 function );
 
-					return( -1 );
-				}
-				buffer_offset += read_count;
+		return( -1 );
+	}
+	return( result );
+}
 
-				internal_handle->current_offset += (off64_t) read_count;
+/* Opens a handle for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_open_read(
+     libodraw_internal_handle_t *internal_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer       = NULL;
+	static char *function = "libodraw_handle_open_read";
+	size64_t file_size    = 0;
+	size_t buffer_size    = 0;
+	ssize_t read_count    = 0;
+	int result            = 1;
 
-				current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
 
-				if( current_sector > (uint64_t) UINT32_MAX )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: current sector value out of bounds.",
-					 function );
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
 
-					return( -1 );
-				}
-				if( current_sector >= sector_range->end_sector )
-				{
-					internal_handle->current_run_out += 1;
-				}
-			}
-			if( buffer_offset >= buffer_size )
-			{
-				break;
-			}
-			if( (size64_t) internal_handle->current_offset >= internal_handle->media_size )
-			{
-				break;
-			}
-		}
-		if( internal_handle->current_lead_out < number_of_lead_outs )
+		return( -1 );
+	}
+	if( libcdata_array_empty(
+	     internal_handle->data_file_descriptors_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_data_file_descriptor_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty data file descriptors array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_layout_arena_empty(
+	     internal_handle->layout_arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty layout arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_handle->io_handle->abort != 0 )
+	{
+		internal_handle->io_handle->abort = 0;
+	}
+	if( internal_handle->layout_cache != NULL )
+	{
+		/* A layout cache that cannot be read is ignored and the TOC file is parsed instead
+		 */
+		result = libodraw_layout_cache_read_file(
+		          internal_handle->layout_cache,
+		          internal_handle->data_file_descriptors_array,
+		          internal_handle->layout_arena,
+		          error );
+
+		if( result == -1 )
 		{
-			if( libcdata_array_get_entry_by_index(
-			     internal_handle->lead_outs_array,
-			     internal_handle->current_lead_out,
-			     (intptr_t **) &sector_range,
-			     error ) != 1 )
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL )
+			 && ( *error != NULL ) )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve lead-out sector range: %d from array.",
-				 function,
-				 internal_handle->current_lead_out );
-
-				return( -1 );
+				libcnotify_print_error_backtrace(
+				 *error );
 			}
-			if( sector_range == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing lead-out sector range: %d.",
-				 function,
-				 internal_handle->current_lead_out );
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		if( result == 1 )
+		{
+			LIBODRAW_STATISTICS_ADD( internal_handle->statistics->number_of_cache_hits, 1 );
 
-				return( -1 );
-			}
-			/* TODO currently assumes that current lead-out start sector is always relative to the start of the media */
-			if( ( current_sector >= sector_range->start_sector )
-			 && ( current_sector < sector_range->end_sector ) )
-			{
-				in_known_range = 1;
+			return( 1 );
+		}
+		LIBODRAW_STATISTICS_ADD( internal_handle->statistics->number_of_cache_misses, 1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading file:\n" );
+	}
+#endif
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve TOC file size.",
+		 function );
 
-				read_count = libodraw_handle_read_buffer_from_lead_out(
-					      internal_handle,
-					      (uint8_t *) &( ( (uint8_t *) buffer )[ buffer_offset ] ),
-					      buffer_size - buffer_offset,
-					      error );
+		goto on_error;
+	}
+	if( file_size > (size64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid file size value exceeds maximum.",
+		 function );
 
-				if( read_count == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read buffer from lead-out: %d.",
-					 function,
-					 internal_handle->current_lead_out );
+		goto on_error;
+	}
+	/* Lex wants 2 zero bytes at the end of the buffer
+	 */
+	buffer_size = (size_t) file_size + 2;
 
-					return( -1 );
-				}
-				buffer_offset += read_count;
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
 
-				internal_handle->current_offset += (off64_t) read_count;
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
 
-				current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading TOC file header at offset: 0 (0x00000000)\n",
+		 function );
+	}
+#endif
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              (size_t) file_size,
+	              0,
+	              error );
 
-				if( current_sector > (uint64_t) UINT32_MAX )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: current sector value out of bounds.",
-					 function );
+	if( read_count != (ssize_t) file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read TOC file data at offset: 0 (0x00000000).",
+		 function );
 
-					return( -1 );
-				}
-				if( current_sector >= sector_range->end_sector )
-				{
-					internal_handle->current_lead_out += 1;
-				}
-			}
-			if( buffer_offset >= buffer_size )
-			{
-				break;
-			}
-			if( (size64_t) internal_handle->current_offset >= internal_handle->media_size )
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: file data:\n",
+		 function );
+		libcnotify_print_data(
+		 buffer,
+		 (size_t) file_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	/* Lex wants 2 zero bytes at the end of the buffer
+	 */
+	buffer[ buffer_size - 2 ] = 0;
+	buffer[ buffer_size - 1 ] = 0;
+
+#if defined( HAVE_LIBODRAW_CUE_READER )
+	result = libodraw_cue_reader_parse_buffer(
+	          (libodraw_handle_t *) internal_handle,
+	          buffer,
+	          buffer_size,
+	          error );
+#else
+	result = libodraw_cue_parser_parse_buffer(
+	          (libodraw_handle_t *) internal_handle,
+	          buffer,
+	          buffer_size,
+	          error );
+#endif
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to parse file data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	if( ( result == 1 )
+	 && ( internal_handle->layout_cache != NULL ) )
+	{
+		/* Failing to write the layout cache, for example in a read-only directory,
+		 * does not prevent the handle from being opened
+		 */
+		if( libodraw_layout_cache_write_file(
+		     internal_handle->layout_cache,
+		     internal_handle->data_file_descriptors_array,
+		     internal_handle->layout_arena,
+		     error ) == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL )
+			 && ( *error != NULL ) )
 			{
-				break;
+				libcnotify_print_error_backtrace(
+				 *error );
 			}
+#endif
+			libcerror_error_free(
+			 error );
 		}
-		if( in_known_range == 0 )
-		{
-			read_count = libodraw_handle_read_buffer_from_unspecified_sector(
-			              internal_handle,
-			              (uint8_t *) &( ( (uint8_t *) buffer )[ buffer_offset ] ),
-			              buffer_size - buffer_offset,
-			              error );
-
-			if( read_count == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read buffer from unspecified.",
-				 function );
+	}
 
-				return( -1 );
-			}
-			buffer_offset += read_count;
+	if( internal_handle->io_handle->abort != 0 )
+	{
+		internal_handle->io_handle->abort = 0;
+	}
+	return( result );
 
-			internal_handle->current_offset += (off64_t) read_count;
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* Reads a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_handle_read_buffer(
+         libodraw_handle_t *handle,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	libodraw_sector_range_t *sector_range       = NULL;
+	libodraw_track_value_t *track_value         = NULL;
+	static char *function                       = "libodraw_handle_read_buffer";
+	size_t buffer_offset                        = 0;
+	ssize_t read_count                          = 0;
+	uint64_t current_sector                     = 0;
+	int in_known_range                          = 0;
+	int number_of_lead_outs                     = 0;
+	int number_of_run_outs                      = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid handle - invalid IO handle - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_layout_arena_get_number_of_sector_ranges(
+	     internal_handle->layout_arena,
+	     LIBODRAW_LAYOUT_ARENA_REGION_RUN_OUTS,
+	     &number_of_run_outs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of run-outs.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_layout_arena_get_number_of_sector_ranges(
+	     internal_handle->layout_arena,
+	     LIBODRAW_LAYOUT_ARENA_REGION_LEAD_OUTS,
+	     &number_of_lead_outs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of lead-outs.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) internal_handle->current_offset >= internal_handle->media_size )
+	{
+		return( 0 );
+	}
+	current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+
+	if( current_sector > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: current sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		in_known_range = 0;
+
+		if( libodraw_layout_arena_get_track_by_index(
+		     internal_handle->layout_arena,
+		     internal_handle->current_track,
+		     &track_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve track value: %d.",
+			 function,
+			 internal_handle->current_track );
+
+			return( -1 );
+		}
+		if( track_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing track value: %d.",
+			 function,
+			 internal_handle->current_track );
+
+			return( -1 );
+		}
+		/* TODO currently assumes that current track start sector is always relative to the start of the media */
+		if( ( current_sector >= track_value->start_sector )
+		 && ( current_sector < track_value->end_sector ) )
+		{
+			in_known_range = 1;
+
+			read_count = libodraw_handle_read_buffer_from_track(
+			              internal_handle,
+			              (uint8_t *) &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+			              buffer_size - buffer_offset,
+			              error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer from track: %d.",
+				 function,
+				 internal_handle->current_track );
+
+				return( -1 );
+			}
+			buffer_offset += read_count;
+
+			internal_handle->current_offset += (off64_t) read_count;
+
+			current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+
+			if( current_sector > (uint64_t) UINT32_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: current sector value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( current_sector >= track_value->end_sector )
+			{
+				internal_handle->current_track += 1;
+			}
+		}
+		if( buffer_offset >= buffer_size )
+		{
+			break;
+		}
+		if( (size64_t) internal_handle->current_offset >= internal_handle->media_size )
+		{
+			break;
+		}
+		if( internal_handle->current_run_out < number_of_run_outs )
+		{
+			if( libodraw_layout_arena_get_sector_range_by_index(
+			     internal_handle->layout_arena,
+			     LIBODRAW_LAYOUT_ARENA_REGION_RUN_OUTS,
+			     internal_handle->current_run_out,
+			     &sector_range,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve run-out sector range: %d.",
+				 function,
+				 internal_handle->current_run_out );
+
+				return( -1 );
+			}
+			if( sector_range == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing run-out sector range: %d.",
+				 function,
+				 internal_handle->current_run_out );
+
+				return( -1 );
+			}
+			/* TODO currently assumes that current run-out start sector is always relative to the start of the media */
+			if( ( current_sector >= sector_range->start_sector )
+			 && ( current_sector < sector_range->end_sector ) )
+			{
+				in_known_range = 1;
+
+				read_count = libodraw_handle_read_buffer_from_run_out(
+					      internal_handle,
+					      (uint8_t *) &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+					      buffer_size - buffer_offset,
+					      error );
+
+				if( read_count == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read buffer from run-out: %d.",
+					 function,
+					 internal_handle->current_run_out );
+
+					return( -1 );
+				}
+				buffer_offset += read_count;
+
+				internal_handle->current_offset += (off64_t) read_count;
+
+				current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+
+				if( current_sector > (uint64_t) UINT32_MAX )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: current sector value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				if( current_sector >= sector_range->end_sector )
+				{
+					internal_handle->current_run_out += 1;
+				}
+			}
+			if( buffer_offset >= buffer_size )
+			{
+				break;
+			}
+			if( (size64_t) internal_handle->current_offset >= internal_handle->media_size )
+			{
+				break;
+			}
+		}
+		if( internal_handle->current_lead_out < number_of_lead_outs )
+		{
+			if( libodraw_layout_arena_get_sector_range_by_index(
+			     internal_handle->layout_arena,
+			     LIBODRAW_LAYOUT_ARENA_REGION_LEAD_OUTS,
+			     internal_handle->current_lead_out,
+			     &sector_range,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve lead-out sector range: %d.",
+				 function,
+				 internal_handle->current_lead_out );
+
+				return( -1 );
+			}
+			if( sector_range == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing lead-out sector range: %d.",
+				 function,
+				 internal_handle->current_lead_out );
+
+				return( -1 );
+			}
+			/* TODO currently assumes that current lead-out start sector is always relative to the start of the media */
+			if( ( current_sector >= sector_range->start_sector )
+			 && ( current_sector < sector_range->end_sector ) )
+			{
+				in_known_range = 1;
+
+				read_count = libodraw_handle_read_buffer_from_lead_out(
+					      internal_handle,
+					      (uint8_t *) &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+					      buffer_size - buffer_offset,
+					      error );
+
+				if( read_count == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read buffer from lead-out: %d.",
+					 function,
+					 internal_handle->current_lead_out );
+
+					return( -1 );
+				}
+				buffer_offset += read_count;
+
+				internal_handle->current_offset += (off64_t) read_count;
+
+				current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+
+				if( current_sector > (uint64_t) UINT32_MAX )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: current sector value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				if( current_sector >= sector_range->end_sector )
+				{
+					internal_handle->current_lead_out += 1;
+				}
+			}
+			if( buffer_offset >= buffer_size )
+			{
+				break;
+			}
+			if( (size64_t) internal_handle->current_offset >= internal_handle->media_size )
+			{
+				break;
+			}
+		}
+		if( in_known_range == 0 )
+		{
+			read_count = libodraw_handle_read_buffer_from_unspecified_sector(
+			              internal_handle,
+			              (uint8_t *) &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+			              buffer_size - buffer_offset,
+			              error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer from unspecified.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset += read_count;
+
+			internal_handle->current_offset += (off64_t) read_count;
+
+			current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+
+			if( current_sector > (uint64_t) UINT32_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: current sector value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( current_sector >= track_value->end_sector )
+			{
+				internal_handle->current_track += 1;
+			}
+			if( buffer_offset >= buffer_size )
+			{
+				break;
+			}
+			if( (size64_t) internal_handle->current_offset >= internal_handle->media_size )
+			{
+				break;
+			}
+		}
+		if( internal_handle->io_handle->abort != 0 )
+		{
+			break;
+		}
+	}
+	return( (size_t) buffer_offset );
+}
+
+/* Reads a buffer from run-out
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_handle_read_buffer_from_run_out(
+         libodraw_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libodraw_track_value_t *track_value   = NULL;
+	libodraw_sector_range_t *sector_range = NULL;
+	uint8_t *read_buffer                  = NULL;
+	uint8_t *sector_data                  = NULL;
+	static char *function                 = "libodraw_handle_read_buffer_from_run_out";
+	off64_t current_sector_offset         = 0;
+	off64_t run_out_data_offset           = 0;
+	size64_t data_file_number_of_sectors  = 0;
+	size64_t data_file_size               = 0;
+	size64_t required_number_of_sectors   = 0;
+	uint64_t current_sector               = 0;
+	uint64_t run_out_data_start_sector    = 0;
+	size_t read_number_of_sectors         = 0;
+	size_t read_size                      = 0;
+	ssize_t read_count                    = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_layout_arena_get_sector_range_by_index(
+	     internal_handle->layout_arena,
+	     LIBODRAW_LAYOUT_ARENA_REGION_RUN_OUTS,
+	     internal_handle->current_run_out,
+	     &sector_range,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve run-out sector range: %d.",
+		 function,
+		 internal_handle->current_run_out );
+
+		goto on_error;
+	}
+	if( sector_range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing run-out sector range: %d.",
+		 function,
+		 internal_handle->current_run_out );
+
+		goto on_error;
+	}
+	current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+
+	if( current_sector > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: current sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* TODO currently assumes that current run-out start sector is always relative to the start of the media */
+	if( ( current_sector < sector_range->start_sector )
+	 || ( current_sector >= sector_range->end_sector ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: current sector value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading data from run-out: %d at sector(s): %" PRIu64 " - %" PRIu64 "\n",
+		 function,
+		 internal_handle->current_run_out,
+		 sector_range->start_sector,
+		 sector_range->end_sector );
+	}
+#endif
+	/* Retrieves the track that corresponds to the run-out
+	 */
+	if( libodraw_layout_arena_get_track_by_index(
+	     internal_handle->layout_arena,
+	     internal_handle->current_track - 1,
+	     &track_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve track value: %d.",
+		 function,
+		 internal_handle->current_track - 1 );
+
+		goto on_error;
+	}
+	if( track_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing track value: %d.",
+		 function,
+		 internal_handle->current_track - 1 );
+
+		goto on_error;
+	}
+	if( track_value->end_sector != sector_range->start_sector )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: sector range start sector value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	current_sector_offset = internal_handle->current_offset
+	                      - (off64_t) ( current_sector * internal_handle->io_handle->bytes_per_sector );
+
+	if( ( current_sector_offset < 0 )
+	 || ( current_sector_offset >= internal_handle->io_handle->bytes_per_sector ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current sector offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	read_number_of_sectors = buffer_size / internal_handle->io_handle->bytes_per_sector;
+
+	if( ( buffer_size % internal_handle->io_handle->bytes_per_sector ) != 0 )
+	{
+		read_number_of_sectors += 1;
+	}
+	if( ( (uint64_t) read_number_of_sectors + current_sector ) > sector_range->end_sector )
+	{
+		read_number_of_sectors = (size_t) ( sector_range->end_sector - current_sector );
+	}
+	if( libodraw_handle_get_data_file_size(
+	     internal_handle,
+	     track_value->data_file_index,
+	     &data_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data file: %d size.",
+		 function,
+		 track_value->data_file_index );
+
+		goto on_error;
+	}
+	data_file_number_of_sectors = data_file_size / track_value->bytes_per_sector;
+
+	/* Determine if the required number of sectors are available in the data file
+	 */
+	required_number_of_sectors = track_value->data_file_start_sector
+	                           + track_value->number_of_sectors
+	                           + sector_range->number_of_sectors;
+
+	if( required_number_of_sectors > data_file_number_of_sectors )
+	{
+		read_size = ( read_number_of_sectors * internal_handle->io_handle->bytes_per_sector )
+		          - (size_t) current_sector_offset;
+
+		if( read_size > buffer_size )
+		{
+			read_size = buffer_size;
+		}
+		/* Fill the buffer with 0 byte values if the run-out data is
+		 * not available in the data file
+		 */
+		if( memory_set(
+		     buffer,
+		     0,
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy run-out data to buffer.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = (ssize_t) read_size;
+	}
+	else
+	{
+		run_out_data_start_sector = current_sector
+		                          - sector_range->start_sector
+		                          + track_value->number_of_sectors;
+
+		run_out_data_offset = track_value->data_file_offset
+		                    + ( run_out_data_start_sector * track_value->bytes_per_sector );
+
+		read_size = read_number_of_sectors * track_value->bytes_per_sector;
+
+		if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
+		{
+/* TODO use sector data cache ? */
+			sector_data = (uint8_t *) memory_allocate(
+			                           sizeof( uint8_t ) * read_size );
+
+			if( sector_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create sector data.",
+				 function );
+
+				goto on_error;
+			}
+			read_buffer = sector_data;
+		}
+		else
+		{
+			read_buffer          = buffer;
+			read_size           -= (size_t) current_sector_offset;
+			run_out_data_offset += current_sector_offset;
+
+			if( read_size > buffer_size )
+			{
+				read_size = buffer_size;
+			}
+		}
+		read_count = libodraw_internal_handle_read_data_file_buffer_at_offset(
+		              internal_handle,
+		              track_value->data_file_index,
+		              read_buffer,
+		              read_size,
+		              run_out_data_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from data file: %d.",
+			 function,
+			 track_value->data_file_index );
+
+			goto on_error;
+		}
+		if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
+		{
+			read_count = libodraw_internal_handle_copy_sector_data_to_buffer(
+			              internal_handle,
+			              sector_data,
+			              read_size,
+			              track_value->bytes_per_sector,
+			              LIBODRAW_TRACK_TYPE_UNKNOWN,
+			              buffer,
+			              buffer_size,
+			              (uint32_t) current_sector,
+			              (uint32_t) current_sector_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy sector data to buffer.",
+				 function );
+
+				goto on_error;
+			}
+			memory_free(
+			 sector_data );
+
+			sector_data = NULL;
+		}
+	}
+	return( read_count );
+
+on_error:
+	if( sector_data != NULL )
+	{
+		memory_free(
+		 sector_data );
+	}
+	return( -1 );
+}
+
+/* Reads a buffer from lead-out
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_handle_read_buffer_from_lead_out(
+         libodraw_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libodraw_track_value_t *track_value   = NULL;
+	libodraw_sector_range_t *sector_range = NULL;
+	uint8_t *read_buffer                  = NULL;
+	uint8_t *sector_data                  = NULL;
+	static char *function                 = "libodraw_handle_read_buffer_from_lead_out";
+	off64_t current_sector_offset         = 0;
+	off64_t lead_out_data_offset          = 0;
+	size64_t data_file_number_of_sectors  = 0;
+	size64_t data_file_size               = 0;
+	size64_t required_number_of_sectors   = 0;
+	uint64_t current_sector               = 0;
+	uint64_t lead_out_data_start_sector   = 0;
+	size_t read_number_of_sectors         = 0;
+	size_t read_size                      = 0;
+	ssize_t read_count                    = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_layout_arena_get_sector_range_by_index(
+	     internal_handle->layout_arena,
+	     LIBODRAW_LAYOUT_ARENA_REGION_LEAD_OUTS,
+	     internal_handle->current_lead_out,
+	     &sector_range,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve lead-out sector range: %d.",
+		 function,
+		 internal_handle->current_lead_out );
+
+		goto on_error;
+	}
+	if( sector_range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing lead-out sector range: %d.",
+		 function,
+		 internal_handle->current_lead_out );
+
+		goto on_error;
+	}
+	current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+
+	if( current_sector > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: current sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* TODO currently assumes that current lead-out start sector is always relative to the start of the media */
+	if( ( current_sector < sector_range->start_sector )
+	 || ( current_sector >= sector_range->end_sector ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: current sector value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading data from lead-out: %d at sector(s): %" PRIu64 " - %" PRIu64 "\n",
+		 function,
+		 internal_handle->current_lead_out,
+		 sector_range->start_sector,
+		 sector_range->end_sector );
+	}
+#endif
+	/* Retrieves the track that corresponds to the lead-out
+	 */
+	if( libodraw_layout_arena_get_track_by_index(
+	     internal_handle->layout_arena,
+	     internal_handle->current_track - 1,
+	     &track_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve track value: %d.",
+		 function,
+		 internal_handle->current_track - 1 );
+
+		goto on_error;
+	}
+	if( track_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing track value: %d.",
+		 function,
+		 internal_handle->current_track - 1 );
+
+		goto on_error;
+	}
+	if( track_value->end_sector != sector_range->start_sector )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: sector range start sector value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	current_sector_offset = internal_handle->current_offset
+	                      - (off64_t) ( current_sector * internal_handle->io_handle->bytes_per_sector );
+
+	if( ( current_sector_offset < 0 )
+	 || ( current_sector_offset >= internal_handle->io_handle->bytes_per_sector ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current sector offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	read_number_of_sectors = buffer_size / internal_handle->io_handle->bytes_per_sector;
+
+	if( ( buffer_size % internal_handle->io_handle->bytes_per_sector ) != 0 )
+	{
+		read_number_of_sectors += 1;
+	}
+	if( ( (uint64_t) read_number_of_sectors + current_sector ) > sector_range->end_sector )
+	{
+		read_number_of_sectors = (size_t) ( sector_range->end_sector - current_sector );
+	}
+	if( libodraw_handle_get_data_file_size(
+	     internal_handle,
+	     track_value->data_file_index,
+	     &data_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data file: %d size.",
+		 function,
+		 track_value->data_file_index );
+
+		goto on_error;
+	}
+	data_file_number_of_sectors = data_file_size / track_value->bytes_per_sector;
+
+	/* Determine if the required number of sectors are available in the data file
+	 */
+	required_number_of_sectors = track_value->data_file_start_sector
+	                           + track_value->number_of_sectors
+	                           + sector_range->number_of_sectors;
+
+	if( required_number_of_sectors > data_file_number_of_sectors )
+	{
+		read_size = ( read_number_of_sectors * internal_handle->io_handle->bytes_per_sector )
+		          - (size_t) current_sector_offset;
+
+		if( read_size > buffer_size )
+		{
+			read_size = buffer_size;
+		}
+		/* Fill the buffer with 0 byte values if the lead-out data is
+		 * not available in the data file
+		 */
+		if( memory_set(
+		     buffer,
+		     0,
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy lead-out data to buffer.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = (ssize_t) read_size;
+	}
+	else
+	{
+		lead_out_data_start_sector = current_sector
+		                           - sector_range->start_sector
+		                           + track_value->number_of_sectors;
+
+		lead_out_data_offset = track_value->data_file_offset
+		                     + ( lead_out_data_start_sector * track_value->bytes_per_sector );
+
+		read_size = read_number_of_sectors * track_value->bytes_per_sector;
+
+		if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
+		{
+/* TODO use sector data cache ? */
+			sector_data = (uint8_t *) memory_allocate(
+			                           sizeof( uint8_t ) * read_size );
+
+			if( sector_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create sector data.",
+				 function );
+
+				goto on_error;
+			}
+			read_buffer = sector_data;
+		}
+		else
+		{
+			read_buffer           = buffer;
+			read_size            -= (size_t) current_sector_offset;
+			lead_out_data_offset += current_sector_offset;
+
+			if( read_size > buffer_size )
+			{
+				read_size = buffer_size;
+			}
+		}
+		read_count = libodraw_internal_handle_read_data_file_buffer_at_offset(
+		              internal_handle,
+		              track_value->data_file_index,
+		              read_buffer,
+		              read_size,
+		              lead_out_data_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from data file: %d.",
+			 function,
+			 track_value->data_file_index );
+
+			goto on_error;
+		}
+		if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
+		{
+			read_count = libodraw_internal_handle_copy_sector_data_to_buffer(
+			              internal_handle,
+			              sector_data,
+			              read_size,
+			              track_value->bytes_per_sector,
+			              LIBODRAW_TRACK_TYPE_UNKNOWN,
+			              buffer,
+			              buffer_size,
+			              (uint32_t) current_sector,
+			              (uint32_t) current_sector_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy sector data to buffer.",
+				 function );
+
+				goto on_error;
+			}
+			memory_free(
+			 sector_data );
+
+			sector_data = NULL;
+		}
+	}
+	return( read_count );
+
+on_error:
+	if( sector_data != NULL )
+	{
+		memory_free(
+		 sector_data );
+	}
+	return( -1 );
+}
+
+/* Reads a buffer from a sector in an unspecified range
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_handle_read_buffer_from_unspecified_sector(
+         libodraw_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libodraw_track_value_t *track_value    = NULL;
+	uint8_t *read_buffer                   = NULL;
+	uint8_t *sector_data                   = NULL;
+	static char *function                  = "libodraw_handle_read_buffer_from_unspecified_sector";
+	off64_t current_sector_offset          = 0;
+	off64_t unspecified_data_offset        = 0;
+	size64_t data_file_number_of_sectors   = 0;
+	size64_t data_file_size                = 0;
+	size64_t required_number_of_sectors    = 0;
+	uint64_t current_sector                = 0;
+	uint64_t unspecified_data_start_sector = 0;
+	size_t read_size                       = 0;
+	ssize_t read_count                     = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+
+	if( current_sector > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: current sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading data from unspecified range.\n",
+		 function );
+	}
+#endif
+	/* Retrieves the track that corresponds to the unspecified range
+	 */
+	if( libodraw_layout_arena_get_track_by_index(
+	     internal_handle->layout_arena,
+	     internal_handle->current_track - 1,
+	     &track_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve track value: %d.",
+		 function,
+		 internal_handle->current_track - 1 );
+
+		goto on_error;
+	}
+	if( track_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing track value: %d.",
+		 function,
+		 internal_handle->current_track - 1 );
+
+		goto on_error;
+	}
+	current_sector_offset = internal_handle->current_offset
+	                      - (off64_t) ( current_sector * internal_handle->io_handle->bytes_per_sector );
+
+	if( ( current_sector_offset < 0 )
+	 || ( current_sector_offset >= internal_handle->io_handle->bytes_per_sector ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current sector offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_handle_get_data_file_size(
+	     internal_handle,
+	     track_value->data_file_index,
+	     &data_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data file: %d size.",
+		 function,
+		 track_value->data_file_index );
+
+		goto on_error;
+	}
+	data_file_number_of_sectors = data_file_size / track_value->bytes_per_sector;
+
+	unspecified_data_start_sector = current_sector
+	                              - track_value->end_sector;
+
+	/* Determine if the required number of sectors are available in the data file
+	 */
+	required_number_of_sectors = track_value->data_file_start_sector
+	                           + track_value->number_of_sectors
+	                           + unspecified_data_start_sector
+	                           + 1;
+
+	if( required_number_of_sectors > data_file_number_of_sectors )
+	{
+		read_size = internal_handle->io_handle->bytes_per_sector
+		          - (size_t) current_sector_offset;
+
+		if( read_size > buffer_size )
+		{
+			read_size = buffer_size;
+		}
+		/* Fill the buffer with 0 byte values if the unspecified data is
+		 * not available in the data file
+		 */
+		if( memory_set(
+		     buffer,
+		     0,
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy unspecified data to buffer.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = (ssize_t) read_size;
+	}
+	else
+	{
+		unspecified_data_offset = track_value->data_file_offset
+		                        + ( unspecified_data_start_sector * track_value->bytes_per_sector );
+
+		read_size = track_value->bytes_per_sector;
+
+		if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
+		{
+/* TODO use sector data cache ? */
+			sector_data = (uint8_t *) memory_allocate(
+			                           sizeof( uint8_t ) * read_size );
+
+			if( sector_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create sector data.",
+				 function );
+
+				goto on_error;
+			}
+			read_buffer = sector_data;
+		}
+		else
+		{
+			read_buffer              = buffer;
+			read_size               -= (size_t) current_sector_offset;
+			unspecified_data_offset += current_sector_offset;
+
+			if( read_size > buffer_size )
+			{
+				read_size = buffer_size;
+			}
+		}
+		read_count = libodraw_internal_handle_read_data_file_buffer_at_offset(
+		              internal_handle,
+		              track_value->data_file_index,
+		              read_buffer,
+		              read_size,
+		              unspecified_data_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from data file: %d.",
+			 function,
+			 track_value->data_file_index );
+
+			goto on_error;
+		}
+		if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
+		{
+			read_count = libodraw_internal_handle_copy_sector_data_to_buffer(
+			              internal_handle,
+			              sector_data,
+			              read_size,
+			              track_value->bytes_per_sector,
+			              LIBODRAW_TRACK_TYPE_UNKNOWN,
+			              buffer,
+			              buffer_size,
+			              (uint32_t) current_sector,
+			              (uint32_t) current_sector_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy sector data to buffer.",
+				 function );
+
+				goto on_error;
+			}
+			memory_free(
+			 sector_data );
+
+			sector_data = NULL;
+		}
+	}
+	return( read_count );
+
+on_error:
+	if( sector_data != NULL )
+	{
+		memory_free(
+		 sector_data );
+	}
+	return( -1 );
+}
+
+/* Reads a buffer from track
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_handle_read_buffer_from_track(
+         libodraw_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libodraw_data_file_descriptor_t *data_file_descriptor = NULL;
+	libodraw_track_value_t *track_value                   = NULL;
+	uint8_t *read_buffer                                  = NULL;
+	uint8_t *sector_data                                  = NULL;
+	static char *function                                 = "libodraw_handle_read_buffer_from_track";
+	off64_t current_sector_offset                         = 0;
+	off64_t track_data_offset                             = 0;
+	uint64_t current_sector                               = 0;
+	uint64_t track_data_start_sector                      = 0;
+	size_t read_number_of_sectors                         = 0;
+	size_t read_size                                      = 0;
+	size_t sector_data_offset                             = 0;
+	size_t sector_read_size                               = 0;
+	ssize_t read_count                                    = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_layout_arena_get_track_by_index(
+	     internal_handle->layout_arena,
+	     internal_handle->current_track,
+	     &track_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve track value: %d.",
+		 function,
+		 internal_handle->current_track );
+
+		goto on_error;
+	}
+	if( track_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing track value: %d.",
+		 function,
+		 internal_handle->current_track );
+
+		goto on_error;
+	}
+	current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+
+	if( current_sector > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: current sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* TODO currently assumes that current track start sector is always relative to the start of the media */
+	if( ( current_sector < track_value->start_sector )
+	 || ( current_sector >= track_value->end_sector ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: current sector value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading data from track: %d at sector(s): %" PRIu64 " - %" PRIu64 "\n",
+		 function,
+		 internal_handle->current_track,
+		 track_value->start_sector,
+		 track_value->end_sector );
+	}
+#endif
+	current_sector_offset = internal_handle->current_offset
+	                      - (off64_t) ( current_sector * internal_handle->io_handle->bytes_per_sector );
+
+	if( ( current_sector_offset < 0 )
+	 || ( current_sector_offset >= internal_handle->io_handle->bytes_per_sector ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current sector offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	track_data_start_sector = current_sector - track_value->start_sector;
+
+	track_data_offset = track_value->data_file_offset
+	                  + ( track_data_start_sector * track_value->bytes_per_sector );
+
+	read_number_of_sectors = buffer_size / internal_handle->io_handle->bytes_per_sector;
+
+	if( ( buffer_size % internal_handle->io_handle->bytes_per_sector ) != 0 )
+	{
+		read_number_of_sectors += 1;
+	}
+	if( ( (uint64_t) read_number_of_sectors + current_sector ) > track_value->end_sector )
+	{
+		read_number_of_sectors = (size_t) ( track_value->end_sector - current_sector );
+	}
+	read_size = read_number_of_sectors * track_value->bytes_per_sector;
+
+	if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
+	{
+/* TODO handle more track types */
+		if( ( track_value->type != LIBODRAW_TRACK_TYPE_AUDIO )
+		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE1_2048 )
+		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE1_2352 )
+		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE2_2048 )
+		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE2_2336 )
+		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE2_2352 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported track type.",
+			 function );
+
+			goto on_error;
+		}
+/* TODO use sector data cache ? */
+		sector_data = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * read_size );
+
+		if( sector_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sector data.",
+			 function );
+
+			goto on_error;
+		}
+		read_buffer = sector_data;
+
+		if( internal_handle->io_handle->bytes_per_sector == 2048 )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_handle->data_file_descriptors_array,
+			     track_value->data_file_index,
+			     (intptr_t **) &data_file_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data file descriptor: %d from array.",
+				 function,
+				 track_value->data_file_index );
+
+				goto on_error;
+			}
+			/* Only read the sector data up to the EDC if the data file regenerates
+			 * the EDC and ECC on read, since these are not needed for 2048 bytes per sector
+			 */
+			if( ( data_file_descriptor != NULL )
+			 && ( data_file_descriptor->has_regenerated_checksums != 0 ) )
+			{
+				if( track_value->type == LIBODRAW_TRACK_TYPE_MODE1_2352 )
+				{
+					sector_read_size = 2064;
+				}
+				else if( track_value->type == LIBODRAW_TRACK_TYPE_MODE2_2336 )
+				{
+					sector_read_size = 2056;
+				}
+				else if( track_value->type == LIBODRAW_TRACK_TYPE_MODE2_2352 )
+				{
+					sector_read_size = 2072;
+				}
+			}
+		}
+	}
+	else
+	{
+		read_buffer        = buffer;
+		read_size         -= (size_t) current_sector_offset;
+		track_data_offset += current_sector_offset;
+
+		if( read_size > buffer_size )
+		{
+			read_size = buffer_size;
+		}
+	}
+	if( sector_read_size != 0 )
+	{
+		for( sector_data_offset = 0;
+		     sector_data_offset < read_size;
+		     sector_data_offset += track_value->bytes_per_sector )
+		{
+			read_count = libodraw_internal_handle_read_data_file_buffer_at_offset(
+			              internal_handle,
+			              track_value->data_file_index,
+			              &( read_buffer[ sector_data_offset ] ),
+			              sector_read_size,
+			              track_data_offset + (off64_t) sector_data_offset,
+			              error );
+
+			if( read_count != (ssize_t) sector_read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer from data file: %d.",
+				 function,
+				 track_value->data_file_index );
+
+				goto on_error;
+			}
+		}
+	}
+	else
+	{
+		read_count = libodraw_internal_handle_read_data_file_buffer_at_offset(
+		              internal_handle,
+		              track_value->data_file_index,
+		              read_buffer,
+		              read_size,
+		              track_data_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from data file: %d.",
+			 function,
+			 track_value->data_file_index );
+
+			goto on_error;
+		}
+	}
+	/* Open the data file of the next track ahead when the read approaches the end
+	 * of the track, so that reading on into the next track does not wait for the open
+	 */
+	if( ( track_value->end_sector - current_sector - (uint64_t) read_number_of_sectors ) <= LIBODRAW_HANDLE_PRE_OPEN_NUMBER_OF_SECTORS )
+	{
+		if( libodraw_internal_handle_pre_open_next_track_data_file(
+		     internal_handle,
+		     track_value->data_file_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to pre-open data file of next track.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
+	{
+		read_count = libodraw_internal_handle_copy_sector_data_to_buffer(
+		              internal_handle,
+		              sector_data,
+		              read_size,
+		              track_value->bytes_per_sector,
+		              track_value->type,
+		              buffer,
+		              buffer_size,
+		              (uint32_t) current_sector,
+		              (uint32_t) current_sector_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy sector data to buffer.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 sector_data );
+
+		sector_data = NULL;
+	}
+	return( read_count );
+
+on_error:
+	if( sector_data != NULL )
+	{
+		memory_free(
+		 sector_data );
+	}
+	return( -1 );
+}
+
+/* Resizes the data file access counts
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_internal_handle_resize_data_file_access_counts(
+     libodraw_internal_handle_t *internal_handle,
+     int number_of_data_files,
+     libcerror_error_t **error )
+{
+	uint64_t *data_file_access_counts   = NULL;
+	static char *function               = "libodraw_internal_handle_resize_data_file_access_counts";
+	size_t data_file_access_counts_size = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_data_files < 0 )
+	 || ( (size_t) number_of_data_files > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of data files value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_data_files <= internal_handle->number_of_data_file_access_counts )
+	{
+		return( 1 );
+	}
+	data_file_access_counts_size = sizeof( uint64_t ) * number_of_data_files;
+
+	data_file_access_counts = (uint64_t *) memory_reallocate(
+	                                        internal_handle->data_file_access_counts,
+	                                        data_file_access_counts_size );
+
+	if( data_file_access_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize data file access counts.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->data_file_access_counts = data_file_access_counts;
+
+	if( memory_set(
+	     &( internal_handle->data_file_access_counts[ internal_handle->number_of_data_file_access_counts ] ),
+	     0,
+	     sizeof( uint64_t ) * ( number_of_data_files - internal_handle->number_of_data_file_access_counts ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data file access counts.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->number_of_data_file_access_counts = number_of_data_files;
+
+	return( 1 );
+}
+
+/* Acquires a data file, which opens the data file if needed
+ * When the open file budget is exhausted the least recently used data file of the handle
+ * is closed, other than the acquired and the pinned data file. A handle only closes its own
+ * data files, if it has none to close the data file is opened beyond the budget
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_internal_handle_acquire_data_file(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     int pinned_data_file_index,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle   = NULL;
+	static char *function              = "libodraw_internal_handle_acquire_data_file";
+	uint64_t least_recent_access_count = 0;
+	int close_data_file_index          = 0;
+	int index                          = 0;
+	int result                         = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->data_file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing data file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_file_index < 0 )
+	 || ( data_file_index >= internal_handle->number_of_data_file_access_counts ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data file index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_handle->open_file_budget != NULL )
+	 && ( internal_handle->data_file_access_counts[ data_file_index ] == 0 ) )
+	{
+		result = libodraw_open_file_budget_acquire(
+		          internal_handle->open_file_budget,
+		          0,
+		          error );
+
+		while( result == 0 )
+		{
+			close_data_file_index     = -1;
+			least_recent_access_count = 0;
+
+			for( index = 0;
+			     index < internal_handle->number_of_data_file_access_counts;
+			     index++ )
+			{
+				if( ( index == data_file_index )
+				 || ( index == pinned_data_file_index )
+				 || ( internal_handle->data_file_access_counts[ index ] == 0 ) )
+				{
+					continue;
+				}
+				if( ( close_data_file_index == -1 )
+				 || ( internal_handle->data_file_access_counts[ index ] < least_recent_access_count ) )
+				{
+					close_data_file_index     = index;
+					least_recent_access_count = internal_handle->data_file_access_counts[ index ];
+				}
+			}
+			if( close_data_file_index == -1 )
+			{
+				result = libodraw_open_file_budget_acquire(
+				          internal_handle->open_file_budget,
+				          1,
+				          error );
+
+				break;
+			}
+			if( libbfio_pool_close(
+			     internal_handle->data_file_io_pool,
+			     close_data_file_index,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close data file: %d.",
+				 function,
+				 close_data_file_index );
+
+				return( -1 );
+			}
+			internal_handle->data_file_access_counts[ close_data_file_index ] = 0;
+
+			LIBODRAW_STATISTICS_ADD( internal_handle->statistics->number_of_pool_closes, 1 );
+
+			if( libodraw_open_file_budget_release(
+			     internal_handle->open_file_budget,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release data file: %d.",
+				 function,
+				 close_data_file_index );
+
+				return( -1 );
+			}
+			result = libodraw_open_file_budget_acquire(
+			          internal_handle->open_file_budget,
+			          0,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to acquire data file: %d from open file budget.",
+			 function,
+			 data_file_index );
+
+			return( -1 );
+		}
+	}
+	if( internal_handle->open_file_budget != NULL )
+	{
+		internal_handle->data_file_access_counter += 1;
+
+		internal_handle->data_file_access_counts[ data_file_index ] = internal_handle->data_file_access_counter;
+	}
+	if( libbfio_pool_get_handle(
+	     internal_handle->data_file_io_pool,
+	     data_file_index,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle: %d from data file IO pool.",
+		 function,
+		 data_file_index );
+
+		return( -1 );
+	}
+	result = libbfio_handle_is_open(
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file IO handle: %d is open.",
+		 function,
+		 data_file_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( libbfio_pool_open(
+		     internal_handle->data_file_io_pool,
+		     data_file_index,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open data file: %d.",
+			 function,
+			 data_file_index );
+
+			return( -1 );
+		}
+		LIBODRAW_STATISTICS_ADD( internal_handle->statistics->number_of_pool_opens, 1 );
+	}
+	return( 1 );
+}
+
+/* Releases the data files of the handle from the open file budget
+ * The data files are not closed
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_internal_handle_release_data_files(
+     libodraw_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_internal_handle_release_data_files";
+	int data_file_index   = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_file_index = 0;
+	     data_file_index < internal_handle->number_of_data_file_access_counts;
+	     data_file_index++ )
+	{
+		if( internal_handle->data_file_access_counts[ data_file_index ] == 0 )
+		{
+			continue;
+		}
+		internal_handle->data_file_access_counts[ data_file_index ] = 0;
+
+		if( internal_handle->open_file_budget != NULL )
+		{
+			if( libodraw_open_file_budget_release(
+			     internal_handle->open_file_budget,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release data file: %d.",
+				 function,
+				 data_file_index );
+
+				return( -1 );
+			}
+		}
+	}
+	internal_handle->data_file_access_counter = 0;
+
+	return( 1 );
+}
+
+/* Opens the data file of the track that follows the current track
+ * The data file of the current track is pinned so that it is not closed
+ * If the reads are sequential the start of the next track is read ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_internal_handle_pre_open_next_track_data_file(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     libcerror_error_t **error )
+{
+	libodraw_read_ahead_buffer_t *read_ahead_buffer = NULL;
+	libodraw_track_value_t *track_value             = NULL;
+	static char *function                           = "libodraw_internal_handle_pre_open_next_track_data_file";
+	int number_of_tracks                            = 0;
+	int result                                      = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_layout_arena_get_number_of_tracks(
+	     internal_handle->layout_arena,
+	     &number_of_tracks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tracks.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_handle->current_track + 1 ) >= number_of_tracks )
+	{
+		return( 1 );
+	}
+	if( libodraw_layout_arena_get_track_by_index(
+	     internal_handle->layout_arena,
+	     internal_handle->current_track + 1,
+	     &track_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve track value: %d.",
+		 function,
+		 internal_handle->current_track + 1 );
+
+		return( -1 );
+	}
+	if( track_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing track value: %d.",
+		 function,
+		 internal_handle->current_track + 1 );
+
+		return( -1 );
+	}
+	if( ( track_value->data_file_index == data_file_index )
+	 || ( track_value->data_file_index < 0 )
+	 || ( track_value->data_file_index >= internal_handle->number_of_data_file_access_counts ) )
+	{
+		return( 1 );
+	}
+	/* The data file only needs to be acquired once
+	 */
+	if( ( internal_handle->open_file_budget == NULL )
+	 || ( internal_handle->data_file_access_counts[ track_value->data_file_index ] == 0 ) )
+	{
+		if( libodraw_internal_handle_acquire_data_file(
+		     internal_handle,
+		     track_value->data_file_index,
+		     data_file_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to acquire data file: %d.",
+			 function,
+			 track_value->data_file_index );
+
+			return( -1 );
+		}
+	}
+	if( ( internal_handle->use_read_ahead == 0 )
+	 || ( internal_handle->read_ahead == NULL ) )
+	{
+		return( 1 );
+	}
+	/* Read ahead the start of the next track when the current track is read sequentially
+	 */
+	result = libodraw_read_ahead_is_sequential(
+	          internal_handle->read_ahead,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libodraw_read_ahead_has_data(
+		          internal_handle->read_ahead,
+		          track_value->data_file_index,
+		          track_value->data_file_offset,
+		          error );
+
+		if( result == 0 )
+		{
+			if( libodraw_read_ahead_set_continuation(
+			     internal_handle->read_ahead,
+			     track_value->data_file_index,
+			     track_value->data_file_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set read-ahead continuation.",
+				 function );
+
+				return( -1 );
+			}
+			if( libodraw_internal_handle_fill_read_ahead_buffer(
+			     internal_handle,
+			     track_value->data_file_index,
+			     track_value->data_file_offset,
+			     &read_ahead_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to fill read-ahead buffer from data file: %d.",
+				 function,
+				 track_value->data_file_index );
+
+				return( -1 );
+			}
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine read-ahead state.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a buffer from a data file at a specific offset
+ * Sequential reads are served from the read-ahead buffers if enabled
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_internal_handle_read_data_file_buffer_at_offset(
+         libodraw_internal_handle_t *internal_handle,
+         int data_file_index,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t data_file_offset,
+         libcerror_error_t **error )
+{
+	libodraw_read_ahead_buffer_t *read_ahead_buffer = NULL;
+	static char *function                           = "libodraw_internal_handle_read_data_file_buffer_at_offset";
+	size_t buffer_offset                            = 0;
+	size_t read_size                                = 0;
+	ssize_t read_count                              = 0;
+	int is_sequential                               = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_internal_handle_acquire_data_file(
+	     internal_handle,
+	     data_file_index,
+	     -1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to acquire data file: %d.",
+		 function,
+		 data_file_index );
+
+		return( -1 );
+	}
+	if( ( internal_handle->use_read_ahead == 0 )
+	 || ( internal_handle->read_ahead == NULL )
+	 || ( data_file_offset < 0 ) )
+	{
+		read_count = libodraw_internal_handle_read_data_file_buffer_from_pool(
+		              internal_handle,
+		              data_file_index,
+		              buffer,
+		              buffer_size,
+		              data_file_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from data file: %d.",
+			 function,
+			 data_file_index );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+	if( libodraw_read_ahead_update_access(
+	     internal_handle->read_ahead,
+	     data_file_index,
+	     data_file_offset,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update read-ahead access.",
+		 function );
+
+		return( -1 );
+	}
+	is_sequential = libodraw_read_ahead_is_sequential(
+	                 internal_handle->read_ahead,
+	                 error );
+
+	if( is_sequential == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if reads are sequential.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		read_size = buffer_size - buffer_offset;
+
+		read_count = libodraw_read_ahead_copy_data(
+		              internal_handle->read_ahead,
+		              data_file_index,
+		              data_file_offset + (off64_t) buffer_offset,
+		              &( buffer[ buffer_offset ] ),
+		              read_size,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy read-ahead data.",
+			 function );
+
+			return( -1 );
+		}
+		else if( read_count > 0 )
+		{
+			buffer_offset += (size_t) read_count;
+
+			continue;
+		}
+		/* Large and non-sequential reads bypass the read-ahead buffers
+		 */
+		if( ( is_sequential == 0 )
+		 || ( read_size >= internal_handle->read_ahead->window_size ) )
+		{
+			read_count = libodraw_internal_handle_read_data_file_buffer_from_pool(
+			              internal_handle,
+			              data_file_index,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              data_file_offset + (off64_t) buffer_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer from data file: %d.",
+				 function,
+				 data_file_index );
+
+				return( -1 );
+			}
+			buffer_offset += (size_t) read_count;
+
+			break;
+		}
+		if( libodraw_internal_handle_fill_read_ahead_buffer(
+		     internal_handle,
+		     data_file_index,
+		     data_file_offset + (off64_t) buffer_offset,
+		     &read_ahead_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to fill read-ahead buffer from data file: %d.",
+			 function,
+			 data_file_index );
+
+			return( -1 );
+		}
+		/* The end of the data file was reached
+		 */
+		if( read_ahead_buffer->data_size == 0 )
+		{
+			break;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Fills a read-ahead buffer with the data at a specific offset of a data file
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_internal_handle_fill_read_ahead_buffer(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     off64_t data_file_offset,
+     libodraw_read_ahead_buffer_t **read_ahead_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_internal_handle_fill_read_ahead_buffer";
+	ssize_t read_count    = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_ahead_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_read_ahead_get_fill_buffer(
+	     internal_handle->read_ahead,
+	     data_file_index,
+	     data_file_offset,
+	     read_ahead_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve read-ahead buffer.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libodraw_internal_handle_read_data_file_buffer_from_pool(
+	              internal_handle,
+	              data_file_index,
+	              ( *read_ahead_buffer )->data,
+	              internal_handle->read_ahead->window_size,
+	              data_file_offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from data file: %d.",
+		 function,
+		 data_file_index );
+
+		( *read_ahead_buffer )->data_file_index = -1;
+
+		return( -1 );
+	}
+	( *read_ahead_buffer )->data_size = (size_t) read_count;
+
+	return( 1 );
+}
+
+/* Reads a buffer from a data file in the data file IO pool at a specific offset
+ * This function maintains the read statistics of the handle
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_internal_handle_read_data_file_buffer_from_pool(
+         libodraw_internal_handle_t *internal_handle,
+         int data_file_index,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t data_file_offset,
+         libcerror_error_t **error )
+{
+	libodraw_data_file_statistics_t *data_file_statistics = NULL;
+	static char *function                                 = "libodraw_internal_handle_read_data_file_buffer_from_pool";
+	uint64_t end_time                                     = 0;
+	uint64_t start_time                                   = 0;
+	ssize_t read_count                                    = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->statistics->collect_timing != 0 )
+	{
+		if( libodraw_statistics_get_current_time(
+		     &start_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve start time.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libbfio_pool_seek_offset(
+	     internal_handle->data_file_io_pool,
+	     data_file_index,
+	     data_file_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek data file: %d offset: %" PRIi64 ".",
+		 function,
+		 data_file_index,
+		 data_file_offset );
+
+		return( -1 );
+	}
+	read_count = libbfio_pool_read_buffer(
+		      internal_handle->data_file_io_pool,
+		      data_file_index,
+		      buffer,
+		      buffer_size,
+		      error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from data file: %d.",
+		 function,
+		 data_file_index );
+
+		return( -1 );
+	}
+	if( internal_handle->statistics->collect_timing != 0 )
+	{
+		if( libodraw_statistics_get_current_time(
+		     &end_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve end time.",
+			 function );
+
+			return( -1 );
+		}
+		if( end_time > start_time )
+		{
+			LIBODRAW_STATISTICS_ADD( internal_handle->statistics->read_time, end_time - start_time );
+		}
+	}
+	LIBODRAW_STATISTICS_ADD( internal_handle->statistics->number_of_reads, 1 );
+	LIBODRAW_STATISTICS_ADD( internal_handle->statistics->number_of_bytes_read, (uint64_t) read_count );
+
+	if( ( data_file_index >= 0 )
+	 && ( data_file_index < internal_handle->statistics->number_of_data_files ) )
+	{
+		data_file_statistics = &( internal_handle->statistics->data_files[ data_file_index ] );
+
+		/* A read that does not continue where the previous read of the same data file ended requires a seek
+		 */
+		if( data_file_offset != data_file_statistics->last_read_end_offset )
+		{
+			LIBODRAW_STATISTICS_ADD( internal_handle->statistics->number_of_seeks, 1 );
+			LIBODRAW_STATISTICS_ADD( data_file_statistics->number_of_seeks, 1 );
+		}
+		LIBODRAW_STATISTICS_ADD( data_file_statistics->number_of_reads, 1 );
+		LIBODRAW_STATISTICS_ADD( data_file_statistics->number_of_bytes_read, (uint64_t) read_count );
+
+		data_file_statistics->last_read_end_offset = data_file_offset + (off64_t) read_count;
+	}
+	else
+	{
+		LIBODRAW_STATISTICS_ADD( internal_handle->statistics->number_of_seeks, 1 );
+	}
+	return( read_count );
+}
+
+/* Copies (raw) sector data to a buffer
+ * This function maintains the conversion statistics of the handle
+ * Returns the number of bytes copied or -1 on error
+ */
+ssize_t libodraw_internal_handle_copy_sector_data_to_buffer(
+         libodraw_internal_handle_t *internal_handle,
+         const uint8_t *sector_data,
+         size_t sector_data_size,
+         uint32_t bytes_per_sector,
+         uint8_t track_type,
+         uint8_t *buffer,
+         size_t buffer_size,
+         uint32_t sector_index,
+         uint32_t sector_offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libodraw_internal_handle_copy_sector_data_to_buffer";
+	uint64_t end_time     = 0;
+	uint64_t start_time   = 0;
+	ssize_t copy_count    = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid bytes per sector value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->statistics->collect_timing != 0 )
+	{
+		if( libodraw_statistics_get_current_time(
+		     &start_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve start time.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	copy_count = libodraw_io_handle_copy_sector_data_to_buffer(
+	              internal_handle->io_handle,
+	              sector_data,
+	              sector_data_size,
+	              bytes_per_sector,
+	              track_type,
+	              buffer,
+	              buffer_size,
+	              sector_index,
+	              sector_offset,
+	              error );
+
+	if( copy_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy sector data to buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->statistics->collect_timing != 0 )
+	{
+		if( libodraw_statistics_get_current_time(
+		     &end_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve end time.",
+			 function );
+
+			return( -1 );
+		}
+		if( end_time > start_time )
+		{
+			LIBODRAW_STATISTICS_ADD( internal_handle->statistics->copy_time, end_time - start_time );
+		}
+	}
+	LIBODRAW_STATISTICS_ADD( internal_handle->statistics->number_of_converted_sectors, (uint64_t) ( sector_data_size / bytes_per_sector ) );
+
+	return( copy_count );
+}
+
+/* Reads (media) data at a specific offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_handle_read_buffer_at_offset(
+         libodraw_handle_t *handle,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libodraw_handle_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( libodraw_handle_seek_offset(
+	     handle,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libodraw_handle_read_buffer(
+	              handle,
+	              buffer,
+	              buffer_size,
+	              error );
+
+	if( read_count <= -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads data from a data file at a specific offset
+ * The data is returned as stored in the data file, e.g. raw 2352 bytes per sector
+ * sectors are not converted to the media bytes per sector
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_handle_read_data_file_buffer_at_offset(
+         libodraw_handle_t *handle,
+         int data_file_index,
+         void *buffer,
+         size_t buffer_size,
+         off64_t data_file_offset,
+         libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_read_data_file_buffer_at_offset";
+	ssize_t read_count                          = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->data_file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing data file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid data file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libodraw_internal_handle_read_data_file_buffer_at_offset(
+	              internal_handle,
+	              data_file_index,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              data_file_offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from data file: %d.",
+		 function,
+		 data_file_index );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Writes a buffer to the handle
+ * The data is written as stored in the data files, track after track, where the size of
+ * a track is its number of sectors times its bytes per sector
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libodraw_handle_write_buffer(
+         libodraw_handle_t *handle,
+         const void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libodraw_data_file_writer_t *data_file_writer = NULL;
+	libodraw_internal_handle_t *internal_handle   = NULL;
+	libodraw_track_value_t *track_value           = NULL;
+	static char *function                         = "libodraw_handle_write_buffer";
+	size64_t data_file_size                       = 0;
+	size64_t track_data_size                      = 0;
+	size_t buffer_offset                          = 0;
+	size_t write_size                             = 0;
+	ssize_t write_count                           = 0;
+	int number_of_data_file_writers               = 0;
+	int number_of_tracks                          = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( ( internal_handle->access_flags & LIBODRAW_ACCESS_FLAG_WRITE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid handle - not opened for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->data_file_writers_array,
+	     &number_of_data_file_writers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data file writers.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_data_file_writers == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing data file writers.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_layout_arena_get_number_of_tracks(
+	     internal_handle->layout_arena,
+	     &number_of_tracks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tracks.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		if( internal_handle->current_track >= number_of_tracks )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: unable to write beyond the end of the last track.",
+			 function );
+
+			return( -1 );
+		}
+		if( libodraw_layout_arena_get_track_by_index(
+		     internal_handle->layout_arena,
+		     internal_handle->current_track,
+		     &track_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve track value: %d.",
+			 function,
+			 internal_handle->current_track );
+
+			return( -1 );
+		}
+		if( track_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing track value: %d.",
+			 function,
+			 internal_handle->current_track );
+
+			return( -1 );
+		}
+		if( libcdata_array_get_entry_by_index(
+		     internal_handle->data_file_writers_array,
+		     track_value->data_file_index,
+		     (intptr_t **) &data_file_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data file writer: %d.",
+			 function,
+			 track_value->data_file_index );
+
+			return( -1 );
+		}
+		/* The data files are written sequentially, hence the track must start
+		 * where the data written to its data file ends
+		 */
+		if( internal_handle->current_track_offset == 0 )
+		{
+			if( libodraw_data_file_writer_get_data_size(
+			     data_file_writer,
+			     &data_file_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve size of data file: %d.",
+				 function,
+				 track_value->data_file_index );
+
+				return( -1 );
+			}
+			if( data_file_size != (size64_t) track_value->data_file_offset )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported track: %d - data does not follow the data written to data file: %d.",
+				 function,
+				 internal_handle->current_track,
+				 track_value->data_file_index );
+
+				return( -1 );
+			}
+		}
+		track_data_size = track_value->number_of_sectors * track_value->bytes_per_sector;
+
+		write_size = buffer_size - buffer_offset;
+
+		if( (size64_t) write_size > ( track_data_size - internal_handle->current_track_offset ) )
+		{
+			write_size = (size_t) ( track_data_size - internal_handle->current_track_offset );
+		}
+		write_count = libodraw_data_file_writer_write_buffer(
+		               data_file_writer,
+		               &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+		               write_size,
+		               error );
+
+		if( write_count != (ssize_t) write_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data of track: %d.",
+			 function,
+			 internal_handle->current_track );
+
+			return( -1 );
+		}
+		buffer_offset                         += write_size;
+		internal_handle->current_offset       += (off64_t) write_size;
+		internal_handle->current_track_offset += (off64_t) write_size;
+
+		if( (size64_t) internal_handle->current_track_offset >= track_data_size )
+		{
+			internal_handle->current_track       += 1;
+			internal_handle->current_track_offset = 0;
+		}
+	}
+	return( (ssize_t) buffer_size );
+}
+
+/* Seeks a certain offset of the (media) data
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libodraw_internal_handle_seek_offset(
+         libodraw_internal_handle_t *internal_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libodraw_sector_range_t *lead_out_sector_range = NULL;
+	libodraw_sector_range_t *run_out_sector_range  = NULL;
+	libodraw_track_value_t *track_value            = NULL;
+	static char *function                          = "libodraw_internal_handle_seek_offset";
+	off64_t lead_out_offset                        = 0;
+	off64_t run_out_offset                         = 0;
+	off64_t track_offset                           = 0;
+	int current_lead_out                           = 0;
+	int current_run_out                            = 0;
+	int current_track                              = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += internal_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) internal_handle->media_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < (off64_t) internal_handle->media_size )
+	{
+		if( libodraw_handle_get_run_out_at_offset(
+		     internal_handle,
+		     offset,
+		     &current_run_out,
+		     &run_out_sector_range,
+		     &run_out_offset,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve run-out at offset: %" PRIi64 ".",
+			 function,
+			 offset );
+
+			return( -1 );
+		}
+		if( libodraw_handle_get_lead_out_at_offset(
+		     internal_handle,
+		     offset,
+		     &current_lead_out,
+		     &lead_out_sector_range,
+		     &lead_out_offset,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve lead-out at offset: %" PRIi64 ".",
+			 function,
+			 offset );
+
+			return( -1 );
+		}
+		if( libodraw_handle_get_track_at_offset(
+		     internal_handle,
+		     offset,
+		     &current_track,
+		     &track_value,
+		     &track_offset,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve track at offset: %" PRIi64 ".",
+			 function,
+			 offset );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libodraw_layout_arena_get_number_of_sector_ranges(
+		     internal_handle->layout_arena,
+		     LIBODRAW_LAYOUT_ARENA_REGION_RUN_OUTS,
+		     &current_run_out,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of run-outs.",
+			 function );
+
+			return( -1 );
+		}
+		if( libodraw_layout_arena_get_number_of_sector_ranges(
+		     internal_handle->layout_arena,
+		     LIBODRAW_LAYOUT_ARENA_REGION_LEAD_OUTS,
+		     &current_lead_out,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of lead-outs.",
+			 function );
+
+			return( -1 );
+		}
+		if( libodraw_layout_arena_get_number_of_tracks(
+		     internal_handle->layout_arena,
+		     &current_track,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of tracks.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_handle->current_offset   = offset;
+	internal_handle->current_run_out  = current_run_out;
+	internal_handle->current_lead_out = current_lead_out;
+	internal_handle->current_track    = current_track;
+
+	return( offset );
+}
+
+/* Seeks a certain offset of the (media) data
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libodraw_handle_seek_offset(
+         libodraw_handle_t *handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_seek_offset";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->data_file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing data file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	offset = libodraw_internal_handle_seek_offset(
+	          internal_handle,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		offset = -1;
+	}
+#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( offset );
+}
+
+/* Retrieves a run-out sector range for the specified offset
+ * When no matching run-out was found the run_out_index value contains the next run-out index on return
+ * Returns 1 if successful, 0 if no matching run-out was found or -1 on error
+ */
+int libodraw_handle_get_run_out_at_offset(
+     libodraw_internal_handle_t *internal_handle,
+     off64_t offset,
+     int *run_out_index,
+     libodraw_sector_range_t **run_out_sector_range,
+     off64_t *run_out_offset,
+     libcerror_error_t **error )
+{
+	static char *function   = "libodraw_handle_get_run_out_at_offset";
+	uint64_t current_sector = 0;
+	int number_of_run_outs  = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_out_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run-out index.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_out_sector_range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run-out sector range.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_out_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run-out offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_layout_arena_get_number_of_sector_ranges(
+	     internal_handle->layout_arena,
+	     LIBODRAW_LAYOUT_ARENA_REGION_RUN_OUTS,
+	     &number_of_run_outs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of run-outs.",
+		 function );
+
+		return( -1 );
+	}
+	current_sector = offset / internal_handle->io_handle->bytes_per_sector;
+
+	if( current_sector > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: current sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( *run_out_index = 0;
+	     *run_out_index < number_of_run_outs;
+	     *run_out_index += 1 )
+	{
+		if( libodraw_layout_arena_get_sector_range_by_index(
+		     internal_handle->layout_arena,
+		     LIBODRAW_LAYOUT_ARENA_REGION_RUN_OUTS,
+		     *run_out_index,
+		     run_out_sector_range,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve run-out sector range: %d.",
+			 function,
+			 number_of_run_outs - 1 );
 
-			current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+			return( -1 );
+		}
+		if( *run_out_sector_range == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing run-out sector range: %d.",
+			 function,
+			 *run_out_index );
 
-			if( current_sector > (uint64_t) UINT32_MAX )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: current sector value out of bounds.",
-				 function );
+			return( -1 );
+		}
+		if( ( current_sector >= ( *run_out_sector_range )->start_sector )
+		 && ( current_sector < ( *run_out_sector_range )->end_sector ) )
+		{
+			*run_out_offset = offset - ( ( *run_out_sector_range )->start_sector * internal_handle->io_handle->bytes_per_sector );
 
-				return( -1 );
-			}
-			if( current_sector >= track_value->end_sector )
-			{
-				internal_handle->current_track += 1;
-			}
-			if( buffer_offset >= buffer_size )
-			{
-				break;
-			}
-			if( (size64_t) internal_handle->current_offset >= internal_handle->media_size )
-			{
-				break;
-			}
+			return( 1 );
 		}
-		if( internal_handle->io_handle->abort != 0 )
+		if( current_sector < ( *run_out_sector_range )->start_sector )
 		{
 			break;
 		}
 	}
-	return( (size_t) buffer_offset );
+	*run_out_sector_range = NULL;
+	*run_out_offset       = 0;
+
+	return( 0 );
 }
 
-/* Reads a buffer from run-out
- * Returns the number of bytes read or -1 on error
+/* Retrieves a lead-out sector range for the specified offset
+ * When no matching lead-out was found the lead_out_index value contains the next lead-out index on return
+ * Returns 1 if successful, 0 if no matching lead-out was found or -1 on error
  */
-ssize_t libodraw_handle_read_buffer_from_run_out(
-         libodraw_internal_handle_t *internal_handle,
-         uint8_t *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libodraw_handle_get_lead_out_at_offset(
+     libodraw_internal_handle_t *internal_handle,
+     off64_t offset,
+     int *lead_out_index,
+     libodraw_sector_range_t **lead_out_sector_range,
+     off64_t *lead_out_offset,
+     libcerror_error_t **error )
 {
-	libodraw_track_value_t *track_value   = NULL;
-	libodraw_sector_range_t *sector_range = NULL;
-	uint8_t *read_buffer                  = NULL;
-	uint8_t *sector_data                  = NULL;
-	static char *function                 = "libodraw_handle_read_buffer_from_run_out";
-	off64_t current_sector_offset         = 0;
-	off64_t run_out_data_offset           = 0;
-	size64_t data_file_number_of_sectors  = 0;
-	size64_t data_file_size               = 0;
-	size64_t required_number_of_sectors   = 0;
-	uint64_t current_sector               = 0;
-	uint64_t run_out_data_start_sector    = 0;
-	size_t read_number_of_sectors         = 0;
-	size_t read_size                      = 0;
-	ssize_t read_count                    = 0;
+	static char *function   = "libodraw_handle_get_lead_out_at_offset";
+	uint64_t current_sector = 0;
+	int number_of_lead_outs = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -2581,50 +7173,57 @@ ssize_t libodraw_handle_read_buffer_from_run_out(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_handle->run_outs_array,
-	     internal_handle->current_run_out,
-	     (intptr_t **) &sector_range,
-	     error ) != 1 )
+	if( lead_out_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve run-out sector range: %d from array.",
-		 function,
-		 internal_handle->current_run_out );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lead-out index.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( sector_range == NULL )
+	if( lead_out_sector_range == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing run-out sector range: %d.",
-		 function,
-		 internal_handle->current_run_out );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lead-out sector range.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+	if( lead_out_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lead-out offset.",
+		 function );
 
-	if( current_sector > (uint64_t) UINT32_MAX )
+		return( -1 );
+	}
+	if( libodraw_layout_arena_get_number_of_sector_ranges(
+	     internal_handle->layout_arena,
+	     LIBODRAW_LAYOUT_ARENA_REGION_LEAD_OUTS,
+	     &number_of_lead_outs,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: current sector value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of lead-outs.",
 		 function );
 
 		return( -1 );
 	}
-	/* TODO currently assumes that current run-out start sector is always relative to the start of the media */
-	if( ( current_sector < sector_range->start_sector )
-	 || ( current_sector >= sector_range->end_sector ) )
+	current_sector = offset / internal_handle->io_handle->bytes_per_sector;
+
+	if( current_sector > (uint64_t) UINT32_MAX )
 	{
 		libcerror_error_set(
 		 error,
@@ -2633,283 +7232,230 @@ ssize_t libodraw_handle_read_buffer_from_run_out(
 		 "%s: current sector value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	for( *lead_out_index = 0;
+	     *lead_out_index < number_of_lead_outs;
+	     *lead_out_index += 1 )
 	{
-		libcnotify_printf(
-		 "%s: reading data from run-out: %d at sector(s): %" PRIu64 " - %" PRIu64 "\n",
-		 function,
-		 internal_handle->current_run_out,
-		 sector_range->start_sector,
-		 sector_range->end_sector );
+		if( libodraw_layout_arena_get_sector_range_by_index(
+		     internal_handle->layout_arena,
+		     LIBODRAW_LAYOUT_ARENA_REGION_LEAD_OUTS,
+		     *lead_out_index,
+		     lead_out_sector_range,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve lead-out sector range: %d.",
+			 function,
+			 number_of_lead_outs - 1 );
+
+			return( -1 );
+		}
+		if( *lead_out_sector_range == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing lead-out sector range: %d.",
+			 function,
+			 *lead_out_index );
+
+			return( -1 );
+		}
+		if( ( current_sector >= ( *lead_out_sector_range )->start_sector )
+		 && ( current_sector < ( *lead_out_sector_range )->end_sector ) )
+		{
+			*lead_out_offset = offset - ( ( *lead_out_sector_range )->start_sector * internal_handle->io_handle->bytes_per_sector );
+
+			return( 1 );
+		}
+		if( current_sector < ( *lead_out_sector_range )->start_sector )
+		{
+			break;
+		}
 	}
-#endif
-	/* Retrieves the track that corresponds to the run-out
-	 */
-	if( libcdata_array_get_entry_by_index(
-	     internal_handle->tracks_array,
-	     internal_handle->current_track - 1,
-	     (intptr_t **) &track_value,
-	     error ) != 1 )
+	*lead_out_sector_range = NULL;
+	*lead_out_offset       = 0;
+
+	return( 0 );
+}
+
+/* Retrieves a track value for the specified offset
+ * When no matching track was found the track_index value contains the next track index on return
+ * Returns 1 if successful, 0 if no matching track was found or -1 on error
+ */
+int libodraw_handle_get_track_at_offset(
+     libodraw_internal_handle_t *internal_handle,
+     off64_t offset,
+     int *track_index,
+     libodraw_track_value_t **track_value,
+     off64_t *track_offset,
+     libcerror_error_t **error )
+{
+	static char *function   = "libodraw_handle_get_track_at_offset";
+	uint64_t current_sector = 0;
+	int number_of_tracks    = 0;
+
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve track value: %d from array.",
-		 function,
-		 internal_handle->current_track - 1 );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( track_value == NULL )
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing track value: %d.",
-		 function,
-		 internal_handle->current_track - 1 );
+		 "%s: invalid handle - missing IO handle.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( track_value->end_sector != sector_range->start_sector )
+	if( internal_handle->io_handle->bytes_per_sector == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: sector range start sector value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( track_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid track index.",
+		 function );
+
+		return( -1 );
+	}
+	if( track_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid track value.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	current_sector_offset = internal_handle->current_offset
-	                      - (off64_t) ( current_sector * internal_handle->io_handle->bytes_per_sector );
-
-	if( ( current_sector_offset < 0 )
-	 || ( current_sector_offset >= internal_handle->io_handle->bytes_per_sector ) )
+	if( track_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid current sector offset value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid track offset.",
 		 function );
 
-		goto on_error;
-	}
-	read_number_of_sectors = buffer_size / internal_handle->io_handle->bytes_per_sector;
-
-	if( ( buffer_size % internal_handle->io_handle->bytes_per_sector ) != 0 )
-	{
-		read_number_of_sectors += 1;
-	}
-	if( ( (uint64_t) read_number_of_sectors + current_sector ) > sector_range->end_sector )
-	{
-		read_number_of_sectors = (size_t) ( sector_range->end_sector - current_sector );
+		return( -1 );
 	}
-	if( libbfio_pool_get_size(
-	     internal_handle->data_file_io_pool,
-	     track_value->data_file_index,
-	     &data_file_size,
+	if( libodraw_layout_arena_get_number_of_tracks(
+	     internal_handle->layout_arena,
+	     &number_of_tracks,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve data file: %d size.",
-		 function,
-		 track_value->data_file_index );
+		 "%s: unable to retrieve number of tracks.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	data_file_number_of_sectors = data_file_size / track_value->bytes_per_sector;
-
-	/* Determine if the required number of sectors are available in the data file
-	 */
-	required_number_of_sectors = track_value->data_file_start_sector
-	                           + track_value->number_of_sectors
-	                           + sector_range->number_of_sectors;
+	current_sector = offset / internal_handle->io_handle->bytes_per_sector;
 
-	if( required_number_of_sectors > data_file_number_of_sectors )
+	if( current_sector > (uint64_t) UINT32_MAX )
 	{
-		read_size = ( read_number_of_sectors * internal_handle->io_handle->bytes_per_sector )
-		          - (size_t) current_sector_offset;
-
-		if( read_size > buffer_size )
-		{
-			read_size = buffer_size;
-		}
-		/* Fill the buffer with 0 byte values if the run-out data is
-		 * not available in the data file
-		 */
-		if( memory_set(
-		     buffer,
-		     0,
-		     read_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy run-out data to buffer.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: current sector value out of bounds.",
+		 function );
 
-			goto on_error;
-		}
-		read_count = (ssize_t) read_size;
+		return( -1 );
 	}
-	else
+	for( *track_index = 0;
+	     *track_index < number_of_tracks;
+	     *track_index += 1 )
 	{
-		run_out_data_start_sector = current_sector
-		                          - sector_range->start_sector
-		                          + track_value->number_of_sectors;
-
-		run_out_data_offset = track_value->data_file_offset
-		                    + ( run_out_data_start_sector * track_value->bytes_per_sector );
-
-		read_size = read_number_of_sectors * track_value->bytes_per_sector;
-
-		if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
-		{
-/* TODO use sector data cache ? */
-			sector_data = (uint8_t *) memory_allocate(
-			                           sizeof( uint8_t ) * read_size );
-
-			if( sector_data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create sector data.",
-				 function );
-
-				goto on_error;
-			}
-			read_buffer = sector_data;
-		}
-		else
-		{
-			read_buffer          = buffer;
-			read_size           -= (size_t) current_sector_offset;
-			run_out_data_offset += current_sector_offset;
-
-			if( read_size > buffer_size )
-			{
-				read_size = buffer_size;
-			}
-		}
-		if( libbfio_pool_seek_offset(
-		     internal_handle->data_file_io_pool,
-		     track_value->data_file_index,
-		     run_out_data_offset,
-		     SEEK_SET,
-		     error ) == -1 )
+		if( libodraw_layout_arena_get_track_by_index(
+		     internal_handle->layout_arena,
+		     *track_index,
+		     track_value,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: unable to seek data file: %d offset: %" PRIi64 ".",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve track value: %d.",
 			 function,
-			 track_value->data_file_index,
-			 run_out_data_offset );
+			 number_of_tracks - 1 );
 
-			goto on_error;
+			return( -1 );
 		}
-		read_count = libbfio_pool_read_buffer(
-			      internal_handle->data_file_io_pool,
-			      track_value->data_file_index,
-			      read_buffer,
-			      read_size,
-			      error );
-
-		if( read_count != (ssize_t) read_size )
+		if( *track_value == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read buffer from data file: %d.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing track value: %d.",
 			 function,
-			 track_value->data_file_index );
+			 *track_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
+		if( ( current_sector >= ( *track_value )->start_sector )
+		 && ( current_sector < ( *track_value )->end_sector ) )
 		{
-			read_count = libodraw_io_handle_copy_sector_data_to_buffer(
-				      internal_handle->io_handle,
-				      sector_data,
-				      read_size,
-			              track_value->bytes_per_sector,
-				      LIBODRAW_TRACK_TYPE_UNKNOWN,
-				      buffer,
-				      buffer_size,
-				      (uint32_t) current_sector,
-				      (uint32_t) current_sector_offset,
-				      error );
-
-			if( read_count < 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy sector data to buffer.",
-				 function );
-
-				goto on_error;
-			}
-			memory_free(
-			 sector_data );
+			*track_offset = offset - ( ( *track_value )->start_sector * internal_handle->io_handle->bytes_per_sector );
 
-			sector_data = NULL;
+			return( 1 );
+		}
+		if( current_sector < ( *track_value )->start_sector )
+		{
+			break;
 		}
 	}
-	return( read_count );
+	*track_value  = NULL;
+	*track_offset = 0;
 
-on_error:
-	if( sector_data != NULL )
-	{
-		memory_free(
-		 sector_data );
-	}
-	return( -1 );
+	return( 0 );
 }
 
-/* Reads a buffer from lead-out
- * Returns the number of bytes read or -1 on error
+/* Retrieves the current offset of the (media) data
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libodraw_handle_read_buffer_from_lead_out(
-         libodraw_internal_handle_t *internal_handle,
-         uint8_t *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libodraw_handle_get_offset(
+     libodraw_handle_t *handle,
+     off64_t *offset,
+     libcerror_error_t **error )
 {
-	libodraw_track_value_t *track_value   = NULL;
-	libodraw_sector_range_t *sector_range = NULL;
-	uint8_t *read_buffer                  = NULL;
-	uint8_t *sector_data                  = NULL;
-	static char *function                 = "libodraw_handle_read_buffer_from_lead_out";
-	off64_t current_sector_offset         = 0;
-	off64_t lead_out_data_offset          = 0;
-	size64_t data_file_number_of_sectors  = 0;
-	size64_t data_file_size               = 0;
-	size64_t required_number_of_sectors   = 0;
-	uint64_t current_sector               = 0;
-	uint64_t lead_out_data_start_sector   = 0;
-	size_t read_number_of_sectors         = 0;
-	size_t read_size                      = 0;
-	ssize_t read_count                    = 0;
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_get_offset";
 
-	if( internal_handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2920,353 +7466,328 @@ ssize_t libodraw_handle_read_buffer_from_lead_out(
 
 		return( -1 );
 	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
 	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = internal_handle->current_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the basename
+ * Returns 1 if successful, 0 if value not present or -1 on error
+ */
+int libodraw_internal_handle_get_basename_size(
+     libodraw_internal_handle_t *internal_handle,
+     size_t *basename_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_internal_handle_get_basename_size";
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result            = 0;
+#endif
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle->bytes_per_sector == 0 )
+	if( basename_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid basename size.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_handle->lead_outs_array,
-	     internal_handle->current_lead_out,
-	     (intptr_t **) &sector_range,
-	     error ) != 1 )
+	if( internal_handle->basename == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve lead-out sector range: %d from array.",
-		 function,
-		 internal_handle->current_lead_out );
-
-		goto on_error;
+		return( 0 );
 	}
-	if( sector_range == NULL )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_size_from_utf32(
+		          (libuna_utf32_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_size_from_utf16(
+		          (libuna_utf16_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_size_from_utf32(
+		          (libuna_utf32_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_size_from_utf16(
+		          (libuna_utf16_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing lead-out sector range: %d.",
-		 function,
-		 internal_handle->current_lead_out );
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine basename size.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+#else
+	*basename_size = internal_handle->basename_size;
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
 
-	if( current_sector > (uint64_t) UINT32_MAX )
+	return( 1 );
+}
+
+/* Retrieves the basename
+ * Returns 1 if successful, 0 if value not present or -1 on error
+ */
+int libodraw_internal_handle_get_basename(
+     libodraw_internal_handle_t *internal_handle,
+     char *basename,
+     size_t basename_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "libodraw_internal_handle_get_basename";
+	size_t narrow_basename_size = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result                  = 0;
+#endif
+
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: current sector value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	/* TODO currently assumes that current lead-out start sector is always relative to the start of the media */
-	if( ( current_sector < sector_range->start_sector )
-	 || ( current_sector >= sector_range->end_sector ) )
+	if( basename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: current sector value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid basename.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( internal_handle->basename == NULL )
 	{
-		libcnotify_printf(
-		 "%s: reading data from lead-out: %d at sector(s): %" PRIu64 " - %" PRIu64 "\n",
-		 function,
-		 internal_handle->current_lead_out,
-		 sector_range->start_sector,
-		 sector_range->end_sector );
+		return( 0 );
 	}
-#endif
-	/* Retrieves the track that corresponds to the lead-out
-	 */
-	if( libcdata_array_get_entry_by_index(
-	     internal_handle->tracks_array,
-	     internal_handle->current_track - 1,
-	     (intptr_t **) &track_value,
-	     error ) != 1 )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve track value: %d from array.",
-		 function,
-		 internal_handle->current_track - 1 );
-
-		goto on_error;
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_size_from_utf32(
+		          (libuna_utf32_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          &narrow_basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_size_from_utf16(
+		          (libuna_utf16_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          &narrow_basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
 	}
-	if( track_value == NULL )
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_size_from_utf32(
+		          (libuna_utf32_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          &narrow_basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_size_from_utf16(
+		          (libuna_utf16_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          &narrow_basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing track value: %d.",
-		 function,
-		 internal_handle->current_track - 1 );
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine narrow basename size.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( track_value->end_sector != sector_range->start_sector )
+#else
+	narrow_basename_size = internal_handle->basename_size;
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	if( basename_size < narrow_basename_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: sector range start sector value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: basename too small.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	current_sector_offset = internal_handle->current_offset
-	                      - (off64_t) ( current_sector * internal_handle->io_handle->bytes_per_sector );
-
-	if( ( current_sector_offset < 0 )
-	 || ( current_sector_offset >= internal_handle->io_handle->bytes_per_sector ) )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_copy_from_utf32(
+		          (libuna_utf8_character_t *) basename,
+		          basename_size,
+		          (libuna_utf32_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_copy_from_utf16(
+		          (libuna_utf8_character_t *) basename,
+		          basename_size,
+		          (libuna_utf16_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_copy_from_utf32(
+		          (uint8_t *) basename,
+		          basename_size,
+		          libclocale_codepage,
+		          (libuna_utf32_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_copy_from_utf16(
+		          (uint8_t *) basename,
+		          basename_size,
+		          libclocale_codepage,
+		          (libuna_utf16_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid current sector offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set basename.",
 		 function );
 
-		goto on_error;
-	}
-	read_number_of_sectors = buffer_size / internal_handle->io_handle->bytes_per_sector;
-
-	if( ( buffer_size % internal_handle->io_handle->bytes_per_sector ) != 0 )
-	{
-		read_number_of_sectors += 1;
-	}
-	if( ( (uint64_t) read_number_of_sectors + current_sector ) > sector_range->end_sector )
-	{
-		read_number_of_sectors = (size_t) ( sector_range->end_sector - current_sector );
+		return( -1 );
 	}
-	if( libbfio_pool_get_size(
-	     internal_handle->data_file_io_pool,
-	     track_value->data_file_index,
-	     &data_file_size,
-	     error ) != 1 )
+#else
+	if( system_string_copy(
+	     basename,
+	     internal_handle->basename,
+	     internal_handle->basename_size ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve data file: %d size.",
-		 function,
-		 track_value->data_file_index );
-
-		goto on_error;
-	}
-	data_file_number_of_sectors = data_file_size / track_value->bytes_per_sector;
-
-	/* Determine if the required number of sectors are available in the data file
-	 */
-	required_number_of_sectors = track_value->data_file_start_sector
-	                           + track_value->number_of_sectors
-	                           + sector_range->number_of_sectors;
-
-	if( required_number_of_sectors > data_file_number_of_sectors )
-	{
-		read_size = ( read_number_of_sectors * internal_handle->io_handle->bytes_per_sector )
-		          - (size_t) current_sector_offset;
-
-		if( read_size > buffer_size )
-		{
-			read_size = buffer_size;
-		}
-		/* Fill the buffer with 0 byte values if the lead-out data is
-		 * not available in the data file
-		 */
-		if( memory_set(
-		     buffer,
-		     0,
-		     read_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy lead-out data to buffer.",
-			 function );
-
-			goto on_error;
-		}
-		read_count = (ssize_t) read_size;
-	}
-	else
-	{
-		lead_out_data_start_sector = current_sector
-		                           - sector_range->start_sector
-		                           + track_value->number_of_sectors;
-
-		lead_out_data_offset = track_value->data_file_offset
-		                     + ( lead_out_data_start_sector * track_value->bytes_per_sector );
-
-		read_size = read_number_of_sectors * track_value->bytes_per_sector;
-
-		if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
-		{
-/* TODO use sector data cache ? */
-			sector_data = (uint8_t *) memory_allocate(
-			                           sizeof( uint8_t ) * read_size );
-
-			if( sector_data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create sector data.",
-				 function );
-
-				goto on_error;
-			}
-			read_buffer = sector_data;
-		}
-		else
-		{
-			read_buffer           = buffer;
-			read_size            -= (size_t) current_sector_offset;
-			lead_out_data_offset += current_sector_offset;
-
-			if( read_size > buffer_size )
-			{
-				read_size = buffer_size;
-			}
-		}
-		if( libbfio_pool_seek_offset(
-		     internal_handle->data_file_io_pool,
-		     track_value->data_file_index,
-		     lead_out_data_offset,
-		     SEEK_SET,
-		     error ) == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: unable to seek data file: %d offset: %" PRIi64 ".",
-			 function,
-			 track_value->data_file_index,
-			 lead_out_data_offset );
-
-			goto on_error;
-		}
-		read_count = libbfio_pool_read_buffer(
-			      internal_handle->data_file_io_pool,
-			      track_value->data_file_index,
-			      read_buffer,
-			      read_size,
-			      error );
-
-		if( read_count != (ssize_t) read_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read buffer from data file: %d.",
-			 function,
-			 track_value->data_file_index );
-
-			goto on_error;
-		}
-		if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
-		{
-			read_count = libodraw_io_handle_copy_sector_data_to_buffer(
-				      internal_handle->io_handle,
-				      sector_data,
-				      read_size,
-			              track_value->bytes_per_sector,
-				      LIBODRAW_TRACK_TYPE_UNKNOWN,
-				      buffer,
-				      buffer_size,
-				      (uint32_t) current_sector,
-				      (uint32_t) current_sector_offset,
-				      error );
-
-			if( read_count < 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy sector data to buffer.",
-				 function );
-
-				goto on_error;
-			}
-			memory_free(
-			 sector_data );
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set basename.",
+		 function );
 
-			sector_data = NULL;
-		}
+		return( -1 );
 	}
-	return( read_count );
+	basename[ internal_handle->basename_size - 1 ] = 0;
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
 
-on_error:
-	if( sector_data != NULL )
-	{
-		memory_free(
-		 sector_data );
-	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Reads a buffer from a sector in an unspecified range
- * Returns the number of bytes read or -1 on error
+/* Sets the basename
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libodraw_handle_read_buffer_from_unspecified_sector(
-         libodraw_internal_handle_t *internal_handle,
-         uint8_t *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libodraw_internal_handle_set_basename(
+     libodraw_internal_handle_t *internal_handle,
+     const char *basename,
+     size_t basename_length,
+     libcerror_error_t **error )
 {
-	libodraw_track_value_t *track_value    = NULL;
-	uint8_t *read_buffer                   = NULL;
-	uint8_t *sector_data                   = NULL;
-	static char *function                  = "libodraw_handle_read_buffer_from_unspecified_sector";
-	off64_t current_sector_offset          = 0;
-	off64_t unspecified_data_offset        = 0;
-	size64_t data_file_number_of_sectors   = 0;
-	size64_t data_file_size                = 0;
-	size64_t required_number_of_sectors    = 0;
-	uint64_t current_sector                = 0;
-	uint64_t unspecified_data_start_sector = 0;
-	size_t read_size                       = 0;
-	ssize_t read_count                     = 0;
+	static char *function = "libodraw_internal_handle_set_basename";
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result            = 0;
+#endif
 
 	if( internal_handle == NULL )
 	{
@@ -3279,286 +7800,294 @@ ssize_t libodraw_handle_read_buffer_from_unspecified_sector(
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle == NULL )
+	if( basename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid basename.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle->bytes_per_sector == 0 )
+	if( internal_handle->basename != NULL )
+	{
+		memory_free(
+		 internal_handle->basename );
+
+		internal_handle->basename      = NULL;
+		internal_handle->basename_size = 0;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_utf8(
+		          (libuna_utf8_character_t *) basename,
+		          basename_length + 1,
+		          &( internal_handle->basename_size ),
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_utf8(
+		          (libuna_utf8_character_t *) basename,
+		          basename_length + 1,
+		          &( internal_handle->basename_size ),
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_byte_stream(
+		          (uint8_t *) basename,
+		          basename_length + 1,
+		          libclocale_codepage,
+		          &( internal_handle->basename_size ),
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_byte_stream(
+		          (uint8_t *) basename,
+		          basename_length + 1,
+		          libclocale_codepage,
+		          &( internal_handle->basename_size ),
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine basename size.",
 		 function );
 
 		return( -1 );
 	}
-	current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
+#else
+	internal_handle->basename_size = basename_length + 1;
+#endif
+	internal_handle->basename = system_string_allocate(
+	                             internal_handle->basename_size );
 
-	if( current_sector > (uint64_t) UINT32_MAX )
+	if( internal_handle->basename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: current sector value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create basename.",
 		 function );
 
+		internal_handle->basename_size = 0;
+
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
 	{
-		libcnotify_printf(
-		 "%s: reading data from unspecified range.\n",
-		 function );
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_copy_from_utf8(
+		          (libuna_utf32_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          (libuna_utf8_character_t *) basename,
+		          basename_length + 1,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_copy_from_utf8(
+		          (libuna_utf16_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          (libuna_utf8_character_t *) basename,
+		          basename_length + 1,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
 	}
-#endif
-	/* Retrieves the track that corresponds to the unspecified range
-	 */
-	if( libcdata_array_get_entry_by_index(
-	     internal_handle->tracks_array,
-	     internal_handle->current_track - 1,
-	     (intptr_t **) &track_value,
-	     error ) != 1 )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve track value: %d from array.",
-		 function,
-		 internal_handle->current_track - 1 );
-
-		goto on_error;
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_copy_from_byte_stream(
+		          (libuna_utf32_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          (uint8_t *) basename,
+		          basename_length + 1,
+		          libclocale_codepage,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_copy_from_byte_stream(
+		          (libuna_utf16_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          (uint8_t *) basename,
+		          basename_length + 1,
+		          libclocale_codepage,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
 	}
-	if( track_value == NULL )
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing track value: %d.",
-		 function,
-		 internal_handle->current_track - 1 );
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set basename.",
+		 function );
 
-		goto on_error;
-	}
-	current_sector_offset = internal_handle->current_offset
-	                      - (off64_t) ( current_sector * internal_handle->io_handle->bytes_per_sector );
+		memory_free(
+		 internal_handle->basename );
 
-	if( ( current_sector_offset < 0 )
-	 || ( current_sector_offset >= internal_handle->io_handle->bytes_per_sector ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid current sector offset value out of bounds.",
-		 function );
+		internal_handle->basename      = NULL;
+		internal_handle->basename_size = 0;
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libbfio_pool_get_size(
-	     internal_handle->data_file_io_pool,
-	     track_value->data_file_index,
-	     &data_file_size,
-	     error ) != 1 )
+#else
+	if( system_string_copy(
+	     internal_handle->basename,
+	     basename,
+	     basename_length ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve data file: %d size.",
-		 function,
-		 track_value->data_file_index );
-
-		goto on_error;
-	}
-	data_file_number_of_sectors = data_file_size / track_value->bytes_per_sector;
-
-	unspecified_data_start_sector = current_sector
-	                              - track_value->end_sector;
-
-	/* Determine if the required number of sectors are available in the data file
-	 */
-	required_number_of_sectors = track_value->data_file_start_sector
-	                           + track_value->number_of_sectors
-	                           + unspecified_data_start_sector
-	                           + 1;
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set basename.",
+		 function );
 
-	if( required_number_of_sectors > data_file_number_of_sectors )
-	{
-		read_size = internal_handle->io_handle->bytes_per_sector
-		          - (size_t) current_sector_offset;
+		memory_free(
+		 internal_handle->basename );
 
-		if( read_size > buffer_size )
-		{
-			read_size = buffer_size;
-		}
-		/* Fill the buffer with 0 byte values if the unspecified data is
-		 * not available in the data file
-		 */
-		if( memory_set(
-		     buffer,
-		     0,
-		     read_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy unspecified data to buffer.",
-			 function );
+		internal_handle->basename      = NULL;
+		internal_handle->basename_size = 0;
 
-			goto on_error;
-		}
-		read_count = (ssize_t) read_size;
+		return( -1 );
 	}
-	else
-	{
-		unspecified_data_offset = track_value->data_file_offset
-		                        + ( unspecified_data_start_sector * track_value->bytes_per_sector );
-
-		read_size = track_value->bytes_per_sector;
-
-		if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
-		{
-/* TODO use sector data cache ? */
-			sector_data = (uint8_t *) memory_allocate(
-			                           sizeof( uint8_t ) * read_size );
-
-			if( sector_data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create sector data.",
-				 function );
-
-				goto on_error;
-			}
-			read_buffer = sector_data;
-		}
-		else
-		{
-			read_buffer              = buffer;
-			read_size               -= (size_t) current_sector_offset;
-			unspecified_data_offset += current_sector_offset;
-
-			if( read_size > buffer_size )
-			{
-				read_size = buffer_size;
-			}
-		}
-		if( libbfio_pool_seek_offset(
-		     internal_handle->data_file_io_pool,
-		     track_value->data_file_index,
-		     unspecified_data_offset,
-		     SEEK_SET,
-		     error ) == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: unable to seek data file: %d offset: %" PRIi64 ".",
-			 function,
-			 track_value->data_file_index,
-			 unspecified_data_offset );
+	internal_handle->basename[ basename_length ] = 0;
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
 
-			goto on_error;
-		}
-		read_count = libbfio_pool_read_buffer(
-			      internal_handle->data_file_io_pool,
-			      track_value->data_file_index,
-			      read_buffer,
-			      read_size,
-			      error );
+	return( 1 );
+}
 
-		if( read_count != (ssize_t) read_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read buffer from data file: %d.",
-			 function,
-			 track_value->data_file_index );
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
 
-			goto on_error;
-		}
-		if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
-		{
-			read_count = libodraw_io_handle_copy_sector_data_to_buffer(
-				      internal_handle->io_handle,
-				      sector_data,
-				      read_size,
-			              track_value->bytes_per_sector,
-				      LIBODRAW_TRACK_TYPE_UNKNOWN,
-				      buffer,
-				      buffer_size,
-				      (uint32_t) current_sector,
-				      (uint32_t) current_sector_offset,
-				      error );
+/* Retrieves the size of the basename
+ * Returns 1 if successful, 0 if value not present or -1 on error
+ */
+int libodraw_internal_handle_get_basename_size_wide(
+     libodraw_internal_handle_t *internal_handle,
+     size_t *basename_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_internal_handle_get_basename_size_wide";
 
-			if( read_count < 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy sector data to buffer.",
-				 function );
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result            = 0;
+#endif
 
-				goto on_error;
-			}
-			memory_free(
-			 sector_data );
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
 
-			sector_data = NULL;
-		}
+		return( -1 );
 	}
-	return( read_count );
+	if( basename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid basename size.",
+		 function );
 
-on_error:
-	if( sector_data != NULL )
+		return( -1 );
+	}
+	if( internal_handle->basename == NULL )
 	{
-		memory_free(
-		 sector_data );
+		return( 0 );
 	}
-	return( -1 );
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	*basename_size = internal_handle->basename_size;
+#else
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_utf8(
+		          (libuna_utf8_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_utf8(
+		          (libuna_utf8_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_byte_stream(
+		          (uint8_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_byte_stream(
+		          (uint8_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine basename size.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	return( 1 );
 }
 
-/* Reads a buffer from track
- * Returns the number of bytes read or -1 on error
+/* Retrieves the basename
+ * Returns 1 if successful, 0 if value not present or -1 on error
  */
-ssize_t libodraw_handle_read_buffer_from_track(
-         libodraw_internal_handle_t *internal_handle,
-         uint8_t *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libodraw_internal_handle_get_basename_wide(
+     libodraw_internal_handle_t *internal_handle,
+     wchar_t *basename,
+     size_t basename_size,
+     libcerror_error_t **error )
 {
-	libodraw_track_value_t *track_value = NULL;
-	uint8_t *read_buffer                = NULL;
-	uint8_t *sector_data                = NULL;
-	static char *function               = "libodraw_handle_read_buffer_from_track";
-	off64_t current_sector_offset       = 0;
-	off64_t track_data_offset           = 0;
-	uint64_t current_sector             = 0;
-	uint64_t track_data_start_sector    = 0;
-	size_t read_number_of_sectors       = 0;
-	size_t read_size                    = 0;
-	ssize_t read_count                  = 0;
+	static char *function     = "libodraw_internal_handle_get_basename_wide";
+	size_t wide_basename_size = 0;
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result                = 0;
+#endif
 
 	if( internal_handle == NULL )
 	{
@@ -3571,320 +8100,373 @@ ssize_t libodraw_handle_read_buffer_from_track(
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle == NULL )
+	if( basename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid basename.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle->bytes_per_sector == 0 )
+	if( internal_handle->basename == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	wide_basename_size = internal_handle->basename_size;
+#else
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_utf8(
+		          (libuna_utf8_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          &wide_basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_utf8(
+		          (libuna_utf8_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          &wide_basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_byte_stream(
+		          (uint8_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          &wide_basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_byte_stream(
+		          (uint8_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          &wide_basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine basename size.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_handle->tracks_array,
-	     internal_handle->current_track,
-	     (intptr_t **) &track_value,
-	     error ) != 1 )
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	if( basename_size < wide_basename_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve track value: %d from array.",
-		 function,
-		 internal_handle->current_track );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: basename too small.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( track_value == NULL )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( system_string_copy(
+	     basename,
+	     internal_handle->basename,
+	     internal_handle->basename_size ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing track value: %d.",
-		 function,
-		 internal_handle->current_track );
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set basename.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	current_sector = (uint64_t) ( internal_handle->current_offset / internal_handle->io_handle->bytes_per_sector );
-
-	if( current_sector > (uint64_t) UINT32_MAX )
+	basename[ internal_handle->basename_size - 1 ] = 0;
+#else
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_copy_from_utf8(
+		          (libuna_utf32_character_t *) basename,
+		          basename_size,
+		          (libuna_utf8_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_copy_from_utf8(
+		          (libuna_utf16_character_t *) basename,
+		          basename_size,
+		          (libuna_utf8_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_copy_from_byte_stream(
+		          (libuna_utf32_character_t *) basename,
+		          basename_size,
+		          (uint8_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_copy_from_byte_stream(
+		          (libuna_utf16_character_t *) basename,
+		          basename_size,
+		          (uint8_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: current sector value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set basename.",
 		 function );
 
 		return( -1 );
 	}
-	/* TODO currently assumes that current track start sector is always relative to the start of the media */
-	if( ( current_sector < track_value->start_sector )
-	 || ( current_sector >= track_value->end_sector ) )
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	return( 1 );
+}
+
+/* Sets the basename
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_internal_handle_set_basename_wide(
+     libodraw_internal_handle_t *internal_handle,
+     const wchar_t *basename,
+     size_t basename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_internal_handle_set_basename_wide";
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result            = 0;
+#endif
+
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: current sector value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading data from track: %d at sector(s): %" PRIu64 " - %" PRIu64 "\n",
-		 function,
-		 internal_handle->current_track,
-		 track_value->start_sector,
-		 track_value->end_sector );
+		return( -1 );
 	}
-#endif
-	current_sector_offset = internal_handle->current_offset
-	                      - (off64_t) ( current_sector * internal_handle->io_handle->bytes_per_sector );
-
-	if( ( current_sector_offset < 0 )
-	 || ( current_sector_offset >= internal_handle->io_handle->bytes_per_sector ) )
+	if( basename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid current sector offset value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid basename.",
 		 function );
 
-		goto on_error;
-	}
-	track_data_start_sector = current_sector - track_value->start_sector;
-
-	track_data_offset = track_value->data_file_offset
-	                  + ( track_data_start_sector * track_value->bytes_per_sector );
-
-	read_number_of_sectors = buffer_size / internal_handle->io_handle->bytes_per_sector;
-
-	if( ( buffer_size % internal_handle->io_handle->bytes_per_sector ) != 0 )
-	{
-		read_number_of_sectors += 1;
+		return( -1 );
 	}
-	if( ( (uint64_t) read_number_of_sectors + current_sector ) > track_value->end_sector )
+	if( internal_handle->basename != NULL )
 	{
-		read_number_of_sectors = (size_t) ( track_value->end_sector - current_sector );
-	}
-	read_size = read_number_of_sectors * track_value->bytes_per_sector;
+		memory_free(
+		 internal_handle->basename );
 
-	if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
+		internal_handle->basename      = NULL;
+		internal_handle->basename_size = 0;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	internal_handle->basename_size = basename_length + 1;
+#else
+	if( libclocale_codepage == 0 )
 	{
-/* TODO handle more track types */
-		if( ( track_value->type != LIBODRAW_TRACK_TYPE_AUDIO )
-		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE1_2048 )
-		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE1_2352 )
-		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE2_2048 )
-		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE2_2336 )
-		 && ( track_value->type != LIBODRAW_TRACK_TYPE_MODE2_2352 ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported track type.",
-			 function );
-
-			goto on_error;
-		}
-/* TODO use sector data cache ? */
-		sector_data = (uint8_t *) memory_allocate(
-		                           sizeof( uint8_t ) * read_size );
-
-		if( sector_data == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create sector data.",
-			 function );
-
-			goto on_error;
-		}
-		read_buffer = sector_data;
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_size_from_utf32(
+		          (libuna_utf32_character_t *) basename,
+		          basename_length + 1,
+		          &( internal_handle->basename_size ),
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_size_from_utf16(
+		          (libuna_utf16_character_t *) basename,
+		          basename_length + 1,
+		          &( internal_handle->basename_size ),
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
 	}
 	else
 	{
-		read_buffer        = buffer;
-		read_size         -= (size_t) current_sector_offset;
-		track_data_offset += current_sector_offset;
-
-		if( read_size > buffer_size )
-		{
-			read_size = buffer_size;
-		}
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_size_from_utf32(
+		          (libuna_utf32_character_t *) basename,
+		          basename_length + 1,
+		          libclocale_codepage,
+		          &( internal_handle->basename_size ),
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_size_from_utf16(
+		          (libuna_utf16_character_t *) basename,
+		          basename_length + 1,
+		          libclocale_codepage,
+		          &( internal_handle->basename_size ),
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
 	}
-	if( libbfio_pool_seek_offset(
-	     internal_handle->data_file_io_pool,
-	     track_value->data_file_index,
-	     track_data_offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek data file: %d offset: %" PRIi64 ".",
-		 function,
-		 track_value->data_file_index,
-		 track_data_offset );
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine basename size.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	read_count = libbfio_pool_read_buffer(
-		      internal_handle->data_file_io_pool,
-		      track_value->data_file_index,
-		      read_buffer,
-		      read_size,
-		      error );
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	internal_handle->basename = system_string_allocate(
+	                             internal_handle->basename_size );
 
-	if( read_count != (ssize_t) read_size )
+	if( internal_handle->basename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer from data file: %d.",
-		 function,
-		 track_value->data_file_index );
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create basename.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( track_value->bytes_per_sector != internal_handle->io_handle->bytes_per_sector )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( system_string_copy(
+	     internal_handle->basename,
+	     basename,
+	     basename_length ) == NULL )
 	{
-		read_count = libodraw_io_handle_copy_sector_data_to_buffer(
-		              internal_handle->io_handle,
-		              sector_data,
-		              read_size,
-		              track_value->bytes_per_sector,
-		              track_value->type,
-		              buffer,
-		              buffer_size,
-			      (uint32_t) current_sector,
-		              (uint32_t) current_sector_offset,
-		              error );
-
-		if( read_count < 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy sector data to buffer.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set basename.",
+		 function );
 
-			goto on_error;
-		}
 		memory_free(
-		 sector_data );
+		 internal_handle->basename );
 
-		sector_data = NULL;
+		internal_handle->basename      = NULL;
+		internal_handle->basename_size = 0;
+
+		return( -1 );
+	}
+	internal_handle->basename[ basename_length ] = 0;
+#else
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_copy_from_utf32(
+		          (libuna_utf8_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          (libuna_utf32_character_t *) basename,
+		          basename_length + 1,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_copy_from_utf16(
+		          (libuna_utf8_character_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          (libuna_utf16_character_t *) basename,
+		          basename_length + 1,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
 	}
-	return( read_count );
-
-on_error:
-	if( sector_data != NULL )
+	else
 	{
-		memory_free(
-		 sector_data );
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_copy_from_utf32(
+		          (uint8_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          (libuna_utf32_character_t *) basename,
+		          basename_length + 1,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_copy_from_utf16(
+		          (uint8_t *) internal_handle->basename,
+		          internal_handle->basename_size,
+		          libclocale_codepage,
+		          (libuna_utf16_character_t *) basename,
+		          basename_length + 1,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
 	}
-	return( -1 );
-}
-
-/* Reads (media) data at a specific offset
- * Returns the number of bytes read or -1 on error
- */
-ssize_t libodraw_handle_read_buffer_at_offset(
-         libodraw_handle_t *handle,
-         void *buffer,
-         size_t buffer_size,
-         off64_t offset,
-         libcerror_error_t **error )
-{
-	static char *function = "libodraw_handle_read_buffer_at_offset";
-	ssize_t read_count    = 0;
-
-	if( libodraw_handle_seek_offset(
-	     handle,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set basename.",
 		 function );
 
-		return( -1 );
-	}
-	read_count = libodraw_handle_read_buffer(
-	              handle,
-	              buffer,
-	              buffer_size,
-	              error );
+		memory_free(
+		 internal_handle->basename );
 
-	if( read_count <= -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer.",
-		 function );
+		internal_handle->basename      = NULL;
+		internal_handle->basename_size = 0;
 
 		return( -1 );
 	}
-	return( read_count );
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	return( 1 );
 }
 
-/* Seeks a certain offset of the (media) data
- * This function is not multi-thread safe acquire write lock before call
- * Returns the offset if seek is successful or -1 on error
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Sets the maximum number of (concurrent) open file handles
+ * The data file of the track that is read is kept open, if the handle shares
+ * the maximum with other handles it applies to all of them
+ * Returns 1 if successful or -1 on error
  */
-off64_t libodraw_internal_handle_seek_offset(
-         libodraw_internal_handle_t *internal_handle,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libodraw_handle_set_maximum_number_of_open_handles(
+     libodraw_handle_t *handle,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
 {
-	libodraw_sector_range_t *lead_out_sector_range = NULL;
-	libodraw_sector_range_t *run_out_sector_range  = NULL;
-	libodraw_track_value_t *track_value            = NULL;
-	static char *function                          = "libodraw_internal_handle_seek_offset";
-	off64_t lead_out_offset                        = 0;
-	off64_t run_out_offset                         = 0;
-	off64_t track_offset                           = 0;
-	int current_lead_out                           = 0;
-	int current_run_out                            = 0;
-	int current_track                              = 0;
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_set_maximum_number_of_open_handles";
 
-	if( internal_handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -3895,170 +8477,101 @@ off64_t libodraw_internal_handle_seek_offset(
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( whence != SEEK_CUR )
-	 && ( whence != SEEK_END )
-	 && ( whence != SEEK_SET ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported whence.",
-		 function );
+	internal_handle = (libodraw_internal_handle_t *) handle;
 
-		return( -1 );
-	}
-	if( whence == SEEK_CUR )
-	{
-		offset += internal_handle->current_offset;
-	}
-	else if( whence == SEEK_END )
-	{
-		offset += (off64_t) internal_handle->media_size;
-	}
-	if( offset < 0 )
+	if( maximum_number_of_open_handles < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid offset value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of open handles value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( offset < (off64_t) internal_handle->media_size )
+	if( maximum_number_of_open_handles == LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
 	{
-		if( libodraw_handle_get_run_out_at_offset(
-		     internal_handle,
-		     offset,
-		     &current_run_out,
-		     &run_out_sector_range,
-		     &run_out_offset,
-		     error ) == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve run-out at offset: %" PRIi64 ".",
-			 function,
-			 offset );
-
-			return( -1 );
-		}
-		if( libodraw_handle_get_lead_out_at_offset(
-		     internal_handle,
-		     offset,
-		     &current_lead_out,
-		     &lead_out_sector_range,
-		     &lead_out_offset,
-		     error ) == -1 )
+		if( internal_handle->open_file_budget != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve lead-out at offset: %" PRIi64 ".",
-			 function,
-			 offset );
+			if( libodraw_internal_handle_release_data_files(
+			     internal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release data files.",
+				 function );
 
-			return( -1 );
-		}
-		if( libodraw_handle_get_track_at_offset(
-		     internal_handle,
-		     offset,
-		     &current_track,
-		     &track_value,
-		     &track_offset,
-		     error ) == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve track at offset: %" PRIi64 ".",
-			 function,
-			 offset );
+				return( -1 );
+			}
+			if( libodraw_open_file_budget_free(
+			     &( internal_handle->open_file_budget ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free open file budget.",
+				 function );
 
-			return( -1 );
+				return( -1 );
+			}
 		}
 	}
-	else
+	else if( internal_handle->open_file_budget != NULL )
 	{
-		if( libcdata_array_get_number_of_entries(
-		     internal_handle->run_outs_array,
-		     &current_run_out,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of elements in run-outs array.",
-			 function );
-
-			return( -1 );
-		}
-		if( libcdata_array_get_number_of_entries(
-		     internal_handle->lead_outs_array,
-		     &current_lead_out,
+		if( libodraw_open_file_budget_set_maximum_number_of_open_files(
+		     internal_handle->open_file_budget,
+		     maximum_number_of_open_handles,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of elements in lead-outs array.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum number of open files in open file budget.",
 			 function );
 
 			return( -1 );
 		}
-		if( libcdata_array_get_number_of_entries(
-		     internal_handle->tracks_array,
-		     &current_track,
+	}
+	else
+	{
+		if( libodraw_open_file_budget_initialize(
+		     &( internal_handle->open_file_budget ),
+		     maximum_number_of_open_handles,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of elements in tracks array.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create open file budget.",
 			 function );
 
 			return( -1 );
 		}
 	}
-	internal_handle->current_offset   = offset;
-	internal_handle->current_run_out  = current_run_out;
-	internal_handle->current_lead_out = current_lead_out;
-	internal_handle->current_track    = current_track;
-
-	return( offset );
+	return( 1 );
 }
 
-/* Seeks a certain offset of the (media) data
- * Returns the offset if seek is successful or -1 on error
+/* Shares the maximum number of (concurrent) open file handles of the source handle
+ * The handles then draw their open data files from the same budget, where every
+ * handle only closes its own data files. The handle cannot have its data files opened
+ * Returns 1 if successful or -1 on error
  */
-off64_t libodraw_handle_seek_offset(
-         libodraw_handle_t *handle,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libodraw_handle_share_maximum_number_of_open_handles(
+     libodraw_handle_t *handle,
+     libodraw_handle_t *source_handle,
+     libcerror_error_t **error )
 {
-	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_seek_offset";
+	libodraw_internal_handle_t *internal_handle        = NULL;
+	libodraw_internal_handle_t *internal_source_handle = NULL;
+	static char *function                              = "libodraw_handle_share_maximum_number_of_open_handles";
 
 	if( handle == NULL )
 	{
@@ -4073,84 +8586,92 @@ off64_t libodraw_handle_seek_offset(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( internal_handle->data_file_io_pool == NULL )
+	if( internal_handle->data_file_io_pool != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing data file IO pool.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - data file IO pool already exists.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( source_handle == NULL )
+	 || ( source_handle == handle ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	offset = libodraw_internal_handle_seek_offset(
-	          internal_handle,
-	          offset,
-	          whence,
-	          error );
+	internal_source_handle = (libodraw_internal_handle_t *) source_handle;
 
-	if( offset == -1 )
+	if( internal_source_handle->open_file_budget == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid source handle - missing maximum number of open handles.",
 		 function );
 
-		offset = -1;
+		return( -1 );
 	}
-#if defined( HAVE_LIBODRAW_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
+	if( internal_handle->open_file_budget == internal_source_handle->open_file_budget )
+	{
+		return( 1 );
+	}
+	if( internal_handle->open_file_budget != NULL )
+	{
+		if( libodraw_open_file_budget_free(
+		     &( internal_handle->open_file_budget ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free open file budget.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libodraw_open_file_budget_add_reference(
+	     internal_source_handle->open_file_budget,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to add reference to open file budget.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( offset );
+	internal_handle->open_file_budget = internal_source_handle->open_file_budget;
+
+	return( 1 );
 }
 
-/* Retrieves a run-out sector range for the specified offset
- * When no matching run-out was found the run_out_index value contains the next run-out index on return
- * Returns 1 if successful, 0 if no matching run-out was found or -1 on error
+/* Sets if the layout cache should be used
+ * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_get_run_out_at_offset(
-     libodraw_internal_handle_t *internal_handle,
-     off64_t offset,
-     int *run_out_index,
-     libodraw_sector_range_t **run_out_sector_range,
-     off64_t *run_out_offset,
+int libodraw_handle_set_use_layout_cache(
+     libodraw_handle_t *handle,
+     uint8_t use_layout_cache,
      libcerror_error_t **error )
 {
-	static char *function   = "libodraw_handle_get_run_out_at_offset";
-	uint64_t current_sector = 0;
-	int number_of_run_outs  = 0;
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_set_use_layout_cache";
 
-	if( internal_handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -4161,155 +8682,264 @@ int libodraw_handle_get_run_out_at_offset(
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle == NULL )
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( use_layout_cache != 0 )
+	{
+		internal_handle->use_layout_cache = 1;
+	}
+	else
+	{
+		internal_handle->use_layout_cache = 0;
+	}
+	return( 1 );
+}
+
+/* Sets if direct IO should be used to read and write the data files
+ * The value must be set before the data files are opened
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_set_use_direct_io(
+     libodraw_handle_t *handle,
+     uint8_t use_direct_io,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_set_use_direct_io";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle->bytes_per_sector == 0 )
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( use_direct_io != 0 )
+	{
+		internal_handle->use_direct_io = 1;
+	}
+	else
+	{
+		internal_handle->use_direct_io = 0;
+	}
+	return( 1 );
+}
+
+/* Sets if sequential reads of the data files should be read ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_set_use_read_ahead(
+     libodraw_handle_t *handle,
+     uint8_t use_read_ahead,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_set_use_read_ahead";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( run_out_index == NULL )
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->read_ahead == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid run-out index.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing read-ahead.",
 		 function );
 
 		return( -1 );
 	}
-	if( run_out_sector_range == NULL )
+	if( use_read_ahead != 0 )
+	{
+		internal_handle->use_read_ahead = 1;
+	}
+	else
+	{
+		internal_handle->use_read_ahead = 0;
+	}
+	/* Discard the buffered data since it is not kept up to date while disabled
+	 */
+	if( libodraw_read_ahead_clear(
+	     internal_handle->read_ahead,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid run-out sector range.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear read-ahead.",
 		 function );
 
 		return( -1 );
 	}
-	if( run_out_offset == NULL )
+	return( 1 );
+}
+
+/* Sets the read-ahead window size
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_set_read_ahead_window_size(
+     libodraw_handle_t *handle,
+     size_t window_size,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_set_read_ahead_window_size";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid run-out offset.",
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_handle->run_outs_array,
-	     &number_of_run_outs,
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( libodraw_read_ahead_set_window_size(
+	     internal_handle->read_ahead,
+	     window_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements in run-outs array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read-ahead window size.",
 		 function );
 
 		return( -1 );
 	}
-	current_sector = offset / internal_handle->io_handle->bytes_per_sector;
+	return( 1 );
+}
 
-	if( current_sector > (uint64_t) UINT32_MAX )
+/* Sets if the time spent reading the data files and converting sector data should be measured
+ * Measuring the time is disabled by default since it requires reading a clock for every read
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_set_collect_timing_statistics(
+     libodraw_handle_t *handle,
+     uint8_t collect_timing_statistics,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_set_collect_timing_statistics";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->statistics == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: current sector value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing statistics.",
 		 function );
 
 		return( -1 );
 	}
-	for( *run_out_index = 0;
-	     *run_out_index < number_of_run_outs;
-	     *run_out_index += 1 )
+	if( collect_timing_statistics != 0 )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_handle->run_outs_array,
-		     *run_out_index,
-		     (intptr_t **) run_out_sector_range,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve run-out sector range: %d from array.",
-			 function,
-			 number_of_run_outs - 1 );
+		internal_handle->statistics->collect_timing = 1;
+	}
+	else
+	{
+		internal_handle->statistics->collect_timing = 0;
+	}
+	return( 1 );
+}
 
-			return( -1 );
-		}
-		if( *run_out_sector_range == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing run-out sector range: %d.",
-			 function,
-			 *run_out_index );
+/* Retrieves a statistics value
+ * The statistics are maintained by the read functions, the times are in nanoseconds
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_get_statistics(
+     libodraw_handle_t *handle,
+     int value_type,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_get_statistics";
 
-			return( -1 );
-		}
-		if( ( current_sector >= ( *run_out_sector_range )->start_sector )
-		 && ( current_sector < ( *run_out_sector_range )->end_sector ) )
-		{
-			*run_out_offset = offset - ( ( *run_out_sector_range )->start_sector * internal_handle->io_handle->bytes_per_sector );
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
 
-			return( 1 );
-		}
-		if( current_sector < ( *run_out_sector_range )->start_sector )
-		{
-			break;
-		}
+		return( -1 );
 	}
-	*run_out_sector_range = NULL;
-	*run_out_offset       = 0;
+	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	return( 0 );
+	if( libodraw_statistics_get_value(
+	     internal_handle->statistics,
+	     value_type,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics value: %d.",
+		 function,
+		 value_type );
+
+		return( -1 );
+	}
+	return( 1 );
 }
 
-/* Retrieves a lead-out sector range for the specified offset
- * When no matching lead-out was found the lead_out_index value contains the next lead-out index on return
- * Returns 1 if successful, 0 if no matching lead-out was found or -1 on error
+/* Retrieves a statistics value of a specific data file
+ * Only the number of reads, bytes read and seeks are maintained per data file
+ * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_get_lead_out_at_offset(
-     libodraw_internal_handle_t *internal_handle,
-     off64_t offset,
-     int *lead_out_index,
-     libodraw_sector_range_t **lead_out_sector_range,
-     off64_t *lead_out_offset,
+int libodraw_handle_get_data_file_statistics(
+     libodraw_handle_t *handle,
+     int data_file_index,
+     int value_type,
+     uint64_t *value,
      libcerror_error_t **error )
 {
-	static char *function   = "libodraw_handle_get_lead_out_at_offset";
-	uint64_t current_sector = 0;
-	int number_of_lead_outs = 0;
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_get_data_file_statistics";
 
-	if( internal_handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -4320,153 +8950,276 @@ int libodraw_handle_get_lead_out_at_offset(
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle == NULL )
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( libodraw_statistics_get_data_file_value(
+	     internal_handle->statistics,
+	     data_file_index,
+	     value_type,
+	     value,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data file: %d statistics value: %d.",
+		 function,
+		 data_file_index,
+		 value_type );
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle->bytes_per_sector == 0 )
+	return( 1 );
+}
+
+/* Resets the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_reset_statistics(
+     libodraw_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_reset_statistics";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( lead_out_index == NULL )
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( libodraw_statistics_reset(
+	     internal_handle->statistics,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid lead-out index.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset statistics.",
 		 function );
 
 		return( -1 );
 	}
-	if( lead_out_sector_range == NULL )
+	return( 1 );
+}
+
+/* Creates the layout cache for a specific table of contents (TOC) file
+ * The layout cache is not created if the size and modification time of the TOC file cannot be determined
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_internal_handle_create_layout_cache(
+     libodraw_internal_handle_t *internal_handle,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_internal_handle_create_layout_cache";
+	int result            = 0;
+
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid lead-out sector range.",
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( lead_out_offset == NULL )
+	if( internal_handle->layout_cache != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid lead-out offset.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - layout cache value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_handle->lead_outs_array,
-	     &number_of_lead_outs,
+	if( libodraw_layout_cache_initialize(
+	     &( internal_handle->layout_cache ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements in lead-outs array.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create layout cache.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	current_sector = offset / internal_handle->io_handle->bytes_per_sector;
+	result = libodraw_layout_cache_set_toc_filename(
+	          internal_handle->layout_cache,
+	          filename,
+	          filename_length,
+	          error );
 
-	if( current_sector > (uint64_t) UINT32_MAX )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: current sector value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set TOC filename in layout cache.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	for( *lead_out_index = 0;
-	     *lead_out_index < number_of_lead_outs;
-	     *lead_out_index += 1 )
+	else if( result == 0 )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_handle->lead_outs_array,
-		     *lead_out_index,
-		     (intptr_t **) lead_out_sector_range,
+		if( libodraw_layout_cache_free(
+		     &( internal_handle->layout_cache ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve lead-out sector range: %d from array.",
-			 function,
-			 number_of_lead_outs - 1 );
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free layout cache.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( *lead_out_sector_range == NULL )
+	}
+	return( 1 );
+
+on_error:
+	if( internal_handle->layout_cache != NULL )
+	{
+		libodraw_layout_cache_free(
+		 &( internal_handle->layout_cache ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the size of a specific data file
+ * The size determined when the data files were opened is used if available,
+ * otherwise the size is retrieved from the data file IO pool, which opens the data file
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_get_data_file_size(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     size64_t *data_file_size,
+     libcerror_error_t **error )
+{
+	libodraw_data_file_descriptor_t *data_file_descriptor = NULL;
+	static char *function                                 = "libodraw_handle_get_data_file_size";
+	int number_of_data_file_descriptors                   = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_file_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->data_file_io_pool_created_in_library != 0 )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     internal_handle->data_file_descriptors_array,
+		     &number_of_data_file_descriptors,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing lead-out sector range: %d.",
-			 function,
-			 *lead_out_index );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of data file descriptors.",
+			 function );
 
 			return( -1 );
 		}
-		if( ( current_sector >= ( *lead_out_sector_range )->start_sector )
-		 && ( current_sector < ( *lead_out_sector_range )->end_sector ) )
+		if( ( data_file_index >= 0 )
+		 && ( data_file_index < number_of_data_file_descriptors ) )
 		{
-			*lead_out_offset = offset - ( ( *lead_out_sector_range )->start_sector * internal_handle->io_handle->bytes_per_sector );
+			if( libcdata_array_get_entry_by_index(
+			     internal_handle->data_file_descriptors_array,
+			     data_file_index,
+			     (intptr_t **) &data_file_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data file descriptor: %d.",
+				 function,
+				 data_file_index );
 
-			return( 1 );
-		}
-		if( current_sector < ( *lead_out_sector_range )->start_sector )
-		{
-			break;
+				return( -1 );
+			}
+			if( ( data_file_descriptor != NULL )
+			 && ( data_file_descriptor->size_set != 0 ) )
+			{
+				*data_file_size = data_file_descriptor->size;
+
+				return( 1 );
+			}
 		}
 	}
-	*lead_out_sector_range = NULL;
-	*lead_out_offset       = 0;
+	if( libbfio_pool_get_size(
+	     internal_handle->data_file_io_pool,
+	     data_file_index,
+	     data_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data file: %d size from pool.",
+		 function,
+		 data_file_index );
 
-	return( 0 );
+		return( -1 );
+	}
+	return( 1 );
 }
 
-/* Retrieves a track value for the specified offset
- * When no matching track was found the track_index value contains the next track index on return
- * Returns 1 if successful, 0 if no matching track was found or -1 on error
+/* Sets the media values
+ * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_get_track_at_offset(
+int libodraw_handle_set_media_values(
      libodraw_internal_handle_t *internal_handle,
-     off64_t offset,
-     int *track_index,
-     libodraw_track_value_t **track_value,
-     off64_t *track_offset,
      libcerror_error_t **error )
 {
-	static char *function   = "libodraw_handle_get_track_at_offset";
-	uint64_t current_sector = 0;
-	int number_of_tracks    = 0;
+	static char *function                 = "libodraw_handle_set_media_values";
+	libodraw_sector_range_t *sector_range = NULL;
+	libodraw_track_value_t *track_value   = NULL;
+	size64_t data_file_size               = 0;
+	uint64_t number_of_sectors            = 0;
+	int number_of_file_io_handles         = 0;
+	int number_of_sessions                = 0;
+	int number_of_tracks                  = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -4501,279 +9254,273 @@ int libodraw_handle_get_track_at_offset(
 
 		return( -1 );
 	}
-	if( track_index == NULL )
+	if( internal_handle->data_file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing data file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_number_of_handles(
+	     internal_handle->data_file_io_pool,
+	     &number_of_file_io_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file IO handles in pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_handle_get_data_file_size(
+	     internal_handle,
+	     number_of_file_io_handles - 1,
+	     &data_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data file: %d size.",
+		 function,
+		 number_of_file_io_handles - 1 );
+
+		return( -1 );
+	}
+	if( libodraw_layout_arena_get_number_of_tracks(
+	     internal_handle->layout_arena,
+	     &number_of_tracks,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid track index.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tracks.",
 		 function );
 
 		return( -1 );
 	}
-	if( track_value == NULL )
+	if( number_of_tracks == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid track value.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing track values.",
 		 function );
 
 		return( -1 );
 	}
-	if( track_offset == NULL )
+	if( libodraw_layout_arena_get_track_by_index(
+	     internal_handle->layout_arena,
+	     number_of_tracks - 1,
+	     &track_value,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid track offset.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve track value: %d.",
+		 function,
+		 number_of_tracks - 1 );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_handle->tracks_array,
-	     &number_of_tracks,
-	     error ) != 1 )
+	if( track_value == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements in tracks array.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing track value: %d.",
+		 function,
+		 number_of_tracks - 1 );
 
 		return( -1 );
 	}
-	current_sector = offset / internal_handle->io_handle->bytes_per_sector;
-
-	if( current_sector > (uint64_t) UINT32_MAX )
+	if( track_value->bytes_per_sector == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: current sector value out of bounds.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid track value: %d - missing bytes per sector.",
+		 function,
+		 number_of_tracks - 1 );
 
 		return( -1 );
 	}
-	for( *track_index = 0;
-	     *track_index < number_of_tracks;
-	     *track_index += 1 )
+	if( internal_handle->media_size == 0 )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_handle->tracks_array,
-		     *track_index,
-		     (intptr_t **) track_value,
-		     error ) != 1 )
+/* TODO currently assumes that last track start sector is always relative to the start of the media */
+		if( number_of_file_io_handles > 1 )
+		{
+			internal_handle->media_size = track_value->start_sector * track_value->bytes_per_sector;
+		}
+		internal_handle->media_size += data_file_size;
+
+		internal_handle->number_of_sectors = internal_handle->media_size / track_value->bytes_per_sector;
+
+		internal_handle->media_size = internal_handle->number_of_sectors * internal_handle->io_handle->bytes_per_sector;
+	}
+	if( track_value->number_of_sectors == 0 )
+	{
+		number_of_sectors = internal_handle->number_of_sectors - track_value->start_sector;
+
+		if( number_of_sectors > (uint64_t) UINT32_MAX )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve track value: %d from array.",
-			 function,
-			 number_of_tracks - 1 );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: number of sectors value out of bounds.",
+			 function );
 
 			return( -1 );
 		}
-		if( *track_value == NULL )
+		if( libodraw_track_value_set(
+		     track_value,
+		     track_value->start_sector,
+		     number_of_sectors,
+		     track_value->type,
+		     track_value->data_file_index,
+		     track_value->data_file_start_sector,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing track value: %d.",
-			 function,
-			 *track_index );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set last track value.",
+			 function );
 
 			return( -1 );
 		}
-		if( ( current_sector >= ( *track_value )->start_sector )
-		 && ( current_sector < ( *track_value )->end_sector ) )
-		{
-			*track_offset = offset - ( ( *track_value )->start_sector * internal_handle->io_handle->bytes_per_sector );
-
-			return( 1 );
-		}
-		if( current_sector < ( *track_value )->start_sector )
-		{
-			break;
-		}
-	}
-	*track_value  = NULL;
-	*track_offset = 0;
-
-	return( 0 );
-}
-
-/* Retrieves the current offset of the (media) data
- * Returns 1 if successful or -1 on error
- */
-int libodraw_handle_get_offset(
-     libodraw_handle_t *handle,
-     off64_t *offset,
-     libcerror_error_t **error )
-{
-	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_get_offset";
-
-	if( handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
-		 function );
-
-		return( -1 );
 	}
-	internal_handle = (libodraw_internal_handle_t *) handle;
-
-	if( internal_handle->io_handle == NULL )
+	if( libodraw_layout_arena_get_number_of_sector_ranges(
+	     internal_handle->layout_arena,
+	     LIBODRAW_LAYOUT_ARENA_REGION_SESSIONS,
+	     &number_of_sessions,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
-		 function );
-
-		return( -1 );
-	}
-	if( offset == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sessions.",
 		 function );
 
 		return( -1 );
 	}
-	*offset = internal_handle->current_offset;
-
-	return( 1 );
-}
-
-/* Retrieves the size of the basename
- * Returns 1 if successful, 0 if value not present or -1 on error
- */
-int libodraw_internal_handle_get_basename_size(
-     libodraw_internal_handle_t *internal_handle,
-     size_t *basename_size,
-     libcerror_error_t **error )
-{
-	static char *function = "libodraw_internal_handle_get_basename_size";
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
-#endif
-
-	if( internal_handle == NULL )
+	if( number_of_sessions > 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
-		 function );
+		if( libodraw_layout_arena_get_sector_range_by_index(
+		     internal_handle->layout_arena,
+		     LIBODRAW_LAYOUT_ARENA_REGION_SESSIONS,
+		     number_of_sessions - 1,
+		     &sector_range,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve session sector range: %d.",
+			 function,
+			 number_of_sessions - 1 );
 
-		return( -1 );
-	}
-	if( basename_size == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid basename size.",
-		 function );
+			return( -1 );
+		}
+		if( sector_range == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sessions sector range: %d.",
+			 function,
+			 number_of_sessions - 1 );
 
-		return( -1 );
-	}
-	if( internal_handle->basename == NULL )
-	{
-		return( 0 );
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_size_from_utf32(
-		          (libuna_utf32_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_size_from_utf16(
-		          (libuna_utf16_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_size_from_utf32(
-		          (libuna_utf32_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_size_from_utf16(
-		          (libuna_utf16_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+			return( -1 );
+		}
+		if( sector_range->number_of_sectors == 0 )
+		{
+/* TODO currently assumes that last session is not followed by a lead-out */
+			number_of_sectors = internal_handle->number_of_sectors - sector_range->start_sector;
+
+			if( number_of_sectors > (uint64_t) UINT32_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: number of sectors value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( libodraw_sector_range_set(
+			     sector_range,
+			     sector_range->start_sector,
+			     number_of_sectors,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set last session sector range.",
+				 function );
+
+				return( -1 );
+			}
+		}
 	}
-	if( result != 1 )
+	if( libodraw_handle_set_extents(
+	     internal_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine basename size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set extents.",
 		 function );
 
 		return( -1 );
 	}
-#else
-	*basename_size = internal_handle->basename_size;
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-
 	return( 1 );
 }
 
-/* Retrieves the basename
- * Returns 1 if successful, 0 if value not present or -1 on error
+/* Appends an extent
+ * Consecutive sparse extents are merged into a single extent
+ * Returns 1 if successful or -1 on error
  */
-int libodraw_internal_handle_get_basename(
+int libodraw_handle_append_extent(
      libodraw_internal_handle_t *internal_handle,
-     char *basename,
-     size_t basename_size,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     int data_file_index,
+     off64_t data_file_offset,
+     uint32_t bytes_per_sector,
+     uint8_t track_type,
+     uint32_t flags,
      libcerror_error_t **error )
 {
-	static char *function       = "libodraw_internal_handle_get_basename";
-	size_t narrow_basename_size = 0;
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result                  = 0;
-#endif
+	libodraw_extent_t *extent = NULL;
+	static char *function     = "libodraw_handle_append_extent";
+	int entry_index           = 0;
+	int number_of_extents     = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -4786,379 +9533,632 @@ int libodraw_internal_handle_get_basename(
 
 		return( -1 );
 	}
-	if( basename == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid basename.",
-		 function );
-
-		return( -1 );
-	}
-	if( internal_handle->basename == NULL )
-	{
-		return( 0 );
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_size_from_utf32(
-		          (libuna_utf32_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          &narrow_basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_size_from_utf16(
-		          (libuna_utf16_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          &narrow_basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
+	if( number_of_sectors == 0 )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_size_from_utf32(
-		          (libuna_utf32_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          &narrow_basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_size_from_utf16(
-		          (libuna_utf16_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          &narrow_basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		return( 1 );
 	}
-	if( result != 1 )
+	if( ( flags & LIBODRAW_EXTENT_FLAG_IS_SPARSE ) != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine narrow basename size.",
-		 function );
+		if( libcdata_array_get_number_of_entries(
+		     internal_handle->extents_array,
+		     &number_of_extents,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of elements in extents array.",
+			 function );
 
-		return( -1 );
-	}
-#else
-	narrow_basename_size = internal_handle->basename_size;
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+			return( -1 );
+		}
+		if( number_of_extents > 0 )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_handle->extents_array,
+			     number_of_extents - 1,
+			     (intptr_t **) &extent,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve extent: %d from array.",
+				 function,
+				 number_of_extents - 1 );
 
-	if( basename_size < narrow_basename_size )
+				return( -1 );
+			}
+			if( ( extent != NULL )
+			 && ( ( extent->flags & LIBODRAW_EXTENT_FLAG_IS_SPARSE ) != 0 )
+			 && ( extent->end_sector == start_sector ) )
+			{
+				if( libodraw_extent_set(
+				     extent,
+				     extent->start_sector,
+				     extent->number_of_sectors + number_of_sectors,
+				     -1,
+				     0,
+				     0,
+				     LIBODRAW_TRACK_TYPE_UNKNOWN,
+				     LIBODRAW_EXTENT_FLAG_IS_SPARSE,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set extent: %d.",
+					 function,
+					 number_of_extents - 1 );
+
+					return( -1 );
+				}
+				return( 1 );
+			}
+			extent = NULL;
+		}
+		data_file_index  = -1;
+		data_file_offset = 0;
+		bytes_per_sector = 0;
+		track_type       = LIBODRAW_TRACK_TYPE_UNKNOWN;
+	}
+	if( libodraw_extent_initialize(
+	     &extent,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: basename too small.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extent.",
 		 function );
 
-		return( -1 );
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_copy_from_utf32(
-		          (libuna_utf8_character_t *) basename,
-		          basename_size,
-		          (libuna_utf32_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_copy_from_utf16(
-		          (libuna_utf8_character_t *) basename,
-		          basename_size,
-		          (libuna_utf16_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_copy_from_utf32(
-		          (uint8_t *) basename,
-		          basename_size,
-		          libclocale_codepage,
-		          (libuna_utf32_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_copy_from_utf16(
-		          (uint8_t *) basename,
-		          basename_size,
-		          libclocale_codepage,
-		          (libuna_utf16_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		goto on_error;
 	}
-	if( result != 1 )
+	if( libodraw_extent_set(
+	     extent,
+	     start_sector,
+	     number_of_sectors,
+	     data_file_index,
+	     data_file_offset,
+	     bytes_per_sector,
+	     track_type,
+	     flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set extent.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#else
-	if( system_string_copy(
-	     basename,
-	     internal_handle->basename,
-	     internal_handle->basename_size ) == NULL )
+	if( libcdata_array_append_entry(
+	     internal_handle->extents_array,
+	     &entry_index,
+	     (intptr_t *) extent,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append extent to array.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	basename[ internal_handle->basename_size - 1 ] = 0;
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-
 	return( 1 );
+
+on_error:
+	if( extent != NULL )
+	{
+		libodraw_extent_free(
+		 &extent,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Sets the basename
- * Returns 1 if successful or -1 on error
+/* Retrieves the sector range in the run-outs or lead-outs region that contains a specific sector
+ * Returns 1 if successful, 0 if no such sector range or -1 on error
  */
-int libodraw_internal_handle_set_basename(
-     libodraw_internal_handle_t *internal_handle,
-     const char *basename,
-     size_t basename_length,
+int libodraw_handle_get_sector_range_at_sector(
+     libodraw_layout_arena_t *layout_arena,
+     int region,
+     uint64_t sector,
+     libodraw_sector_range_t **sector_range,
+     uint64_t *next_start_sector,
      libcerror_error_t **error )
-{
-	static char *function = "libodraw_internal_handle_set_basename";
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
-#endif
+{
+	libodraw_sector_range_t *safe_sector_range = NULL;
+	static char *function                      = "libodraw_handle_get_sector_range_at_sector";
+	int number_of_sector_ranges                = 0;
+	int sector_range_index                     = 0;
 
-	if( internal_handle == NULL )
+	if( sector_range == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid sector range.",
 		 function );
 
 		return( -1 );
 	}
-	if( basename == NULL )
+	if( next_start_sector == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid basename.",
+		 "%s: invalid next start sector.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->basename != NULL )
+	if( libodraw_layout_arena_get_number_of_sector_ranges(
+	     layout_arena,
+	     region,
+	     &number_of_sector_ranges,
+	     error ) != 1 )
 	{
-		memory_free(
-		 internal_handle->basename );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sector ranges.",
+		 function );
 
-		internal_handle->basename      = NULL;
-		internal_handle->basename_size = 0;
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_utf8(
-		          (libuna_utf8_character_t *) basename,
-		          basename_length + 1,
-		          &( internal_handle->basename_size ),
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_utf8(
-		          (libuna_utf8_character_t *) basename,
-		          basename_length + 1,
-		          &( internal_handle->basename_size ),
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		return( -1 );
 	}
-	else
+	for( sector_range_index = 0;
+	     sector_range_index < number_of_sector_ranges;
+	     sector_range_index++ )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_byte_stream(
-		          (uint8_t *) basename,
-		          basename_length + 1,
-		          libclocale_codepage,
-		          &( internal_handle->basename_size ),
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_byte_stream(
-		          (uint8_t *) basename,
-		          basename_length + 1,
-		          libclocale_codepage,
-		          &( internal_handle->basename_size ),
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		if( libodraw_layout_arena_get_sector_range_by_index(
+		     layout_arena,
+		     region,
+		     sector_range_index,
+		     &safe_sector_range,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sector range: %d.",
+			 function,
+			 sector_range_index );
+
+			return( -1 );
+		}
+		if( safe_sector_range == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sector range: %d.",
+			 function,
+			 sector_range_index );
+
+			return( -1 );
+		}
+		if( ( sector >= safe_sector_range->start_sector )
+		 && ( sector < safe_sector_range->end_sector ) )
+		{
+			*sector_range = safe_sector_range;
+
+			return( 1 );
+		}
+		if( ( safe_sector_range->start_sector > sector )
+		 && ( safe_sector_range->start_sector < *next_start_sector ) )
+		{
+			*next_start_sector = safe_sector_range->start_sector;
+		}
 	}
-	if( result != 1 )
+	return( 0 );
+}
+
+/* Sets the extents of the sectors between the end of a track and the start of the next
+ * The run-out, lead-out and unspecified sectors in this range are stored in the data file
+ * directly after the track, if the data file is large enough, otherwise they are sparse
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_set_extents_from_gap(
+     libodraw_internal_handle_t *internal_handle,
+     libodraw_track_value_t *track_value,
+     uint64_t start_sector,
+     uint64_t end_sector,
+     libcerror_error_t **error )
+{
+	libodraw_sector_range_t *sector_range = NULL;
+	static char *function                 = "libodraw_handle_set_extents_from_gap";
+	size64_t data_file_number_of_sectors  = 0;
+	size64_t data_file_size               = 0;
+	uint64_t available_number_of_sectors  = 0;
+	uint64_t backed_end_sector            = 0;
+	uint64_t next_start_sector            = 0;
+	uint64_t range_end_sector             = 0;
+	uint64_t track_data_end_sector        = 0;
+	off64_t data_file_offset              = 0;
+	int result                            = 0;
+
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine basename size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-#else
-	internal_handle->basename_size = basename_length + 1;
-#endif
-	internal_handle->basename = system_string_allocate(
-	                             internal_handle->basename_size );
-
-	if( internal_handle->basename == NULL )
+	if( track_value != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create basename.",
-		 function );
+		if( track_value->bytes_per_sector == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid track value - missing bytes per sector.",
+			 function );
 
-		internal_handle->basename_size = 0;
+			return( -1 );
+		}
+		if( libodraw_handle_get_data_file_size(
+		     internal_handle,
+		     track_value->data_file_index,
+		     &data_file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data file: %d size.",
+			 function,
+			 track_value->data_file_index );
 
-		return( -1 );
+			return( -1 );
+		}
+		data_file_number_of_sectors = data_file_size / track_value->bytes_per_sector;
+
+		track_data_end_sector = track_value->data_file_start_sector
+		                      + track_value->number_of_sectors;
+
+		if( data_file_number_of_sectors > track_data_end_sector )
+		{
+			available_number_of_sectors = data_file_number_of_sectors - track_data_end_sector;
+		}
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
+	while( start_sector < end_sector )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_utf8(
-		          (libuna_utf32_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          (libuna_utf8_character_t *) basename,
-		          basename_length + 1,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_utf8(
-		          (libuna_utf16_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          (libuna_utf8_character_t *) basename,
-		          basename_length + 1,
+		sector_range      = NULL;
+		next_start_sector = end_sector;
+
+		result = libodraw_handle_get_sector_range_at_sector(
+		          internal_handle->layout_arena,
+		          LIBODRAW_LAYOUT_ARENA_REGION_RUN_OUTS,
+		          start_sector,
+		          &sector_range,
+		          &next_start_sector,
 		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+
+		if( result == 0 )
+		{
+			result = libodraw_handle_get_sector_range_at_sector(
+			          internal_handle->layout_arena,
+			          LIBODRAW_LAYOUT_ARENA_REGION_LEAD_OUTS,
+			          start_sector,
+			          &sector_range,
+			          &next_start_sector,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sector range at sector: %" PRIu64 ".",
+			 function,
+			 start_sector );
+
+			return( -1 );
+		}
+		if( result != 0 )
+		{
+			range_end_sector = sector_range->end_sector;
+
+			if( range_end_sector > end_sector )
+			{
+				range_end_sector = end_sector;
+			}
+			/* A run-out or lead-out is only read from the data file when all its sectors are available
+			 */
+			if( ( track_value == NULL )
+			 || ( sector_range->start_sector != track_value->end_sector )
+			 || ( sector_range->number_of_sectors > available_number_of_sectors ) )
+			{
+				backed_end_sector = start_sector;
+			}
+			else
+			{
+				backed_end_sector = range_end_sector;
+			}
+		}
+		else
+		{
+			range_end_sector = next_start_sector;
+
+			if( ( track_value == NULL )
+			 || ( start_sector < track_value->end_sector ) )
+			{
+				backed_end_sector = start_sector;
+			}
+			else
+			{
+				backed_end_sector = track_value->end_sector + available_number_of_sectors;
+
+				if( backed_end_sector < start_sector )
+				{
+					backed_end_sector = start_sector;
+				}
+				else if( backed_end_sector > range_end_sector )
+				{
+					backed_end_sector = range_end_sector;
+				}
+			}
+		}
+		if( start_sector < backed_end_sector )
+		{
+			data_file_offset = track_value->data_file_offset
+			                 + (off64_t) ( ( track_value->number_of_sectors + start_sector - track_value->end_sector ) * track_value->bytes_per_sector );
+
+			if( libodraw_handle_append_extent(
+			     internal_handle,
+			     start_sector,
+			     backed_end_sector - start_sector,
+			     track_value->data_file_index,
+			     data_file_offset,
+			     track_value->bytes_per_sector,
+			     LIBODRAW_TRACK_TYPE_UNKNOWN,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append extent.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( backed_end_sector < range_end_sector )
+		{
+			if( libodraw_handle_append_extent(
+			     internal_handle,
+			     backed_end_sector,
+			     range_end_sector - backed_end_sector,
+			     -1,
+			     0,
+			     0,
+			     LIBODRAW_TRACK_TYPE_UNKNOWN,
+			     LIBODRAW_EXTENT_FLAG_IS_SPARSE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append sparse extent.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		start_sector = range_end_sector;
 	}
-	else
+	return( 1 );
+}
+
+/* Sets the extents
+ * Maps the media sectors onto the data files using the tracks, run-outs and lead-outs
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_set_extents(
+     libodraw_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	libodraw_track_value_t *previous_track_value = NULL;
+	libodraw_track_value_t *track_value          = NULL;
+	static char *function                        = "libodraw_handle_set_extents";
+	off64_t data_file_offset                     = 0;
+	uint64_t current_sector                      = 0;
+	uint64_t end_sector                          = 0;
+	uint64_t start_sector                        = 0;
+	int number_of_tracks                         = 0;
+	int track_index                              = 0;
+
+	if( internal_handle == NULL )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_byte_stream(
-		          (libuna_utf32_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          (uint8_t *) basename,
-		          basename_length + 1,
-		          libclocale_codepage,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_byte_stream(
-		          (libuna_utf16_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          (uint8_t *) basename,
-		          basename_length + 1,
-		          libclocale_codepage,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
 	}
-	if( result != 1 )
+	if( libcdata_array_empty(
+	     internal_handle->extents_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_extent_free,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty extents array.",
 		 function );
 
-		memory_free(
-		 internal_handle->basename );
-
-		internal_handle->basename      = NULL;
-		internal_handle->basename_size = 0;
-
 		return( -1 );
 	}
-#else
-	if( system_string_copy(
-	     internal_handle->basename,
-	     basename,
-	     basename_length ) == NULL )
+	if( libodraw_layout_arena_get_number_of_tracks(
+	     internal_handle->layout_arena,
+	     &number_of_tracks,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tracks.",
 		 function );
 
-		memory_free(
-		 internal_handle->basename );
-
-		internal_handle->basename      = NULL;
-		internal_handle->basename_size = 0;
-
 		return( -1 );
 	}
-	internal_handle->basename[ basename_length ] = 0;
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	for( track_index = 0;
+	     track_index <= number_of_tracks;
+	     track_index++ )
+	{
+		if( track_index < number_of_tracks )
+		{
+			if( libodraw_layout_arena_get_track_by_index(
+			     internal_handle->layout_arena,
+			     track_index,
+			     &track_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve track value: %d.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+			if( track_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing track value: %d.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+			end_sector = track_value->start_sector;
+		}
+		else
+		{
+			track_value = NULL;
+			end_sector  = internal_handle->number_of_sectors;
+		}
+		if( end_sector > internal_handle->number_of_sectors )
+		{
+			end_sector = internal_handle->number_of_sectors;
+		}
+		if( current_sector < end_sector )
+		{
+			if( libodraw_handle_set_extents_from_gap(
+			     internal_handle,
+			     previous_track_value,
+			     current_sector,
+			     end_sector,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set extents in range: %" PRIu64 " - %" PRIu64 ".",
+				 function,
+				 current_sector,
+				 end_sector );
+
+				return( -1 );
+			}
+			current_sector = end_sector;
+		}
+		if( track_value == NULL )
+		{
+			break;
+		}
+		start_sector = track_value->start_sector;
+
+		if( start_sector < current_sector )
+		{
+			start_sector = current_sector;
+		}
+		end_sector = track_value->end_sector;
+
+		if( end_sector > internal_handle->number_of_sectors )
+		{
+			end_sector = internal_handle->number_of_sectors;
+		}
+		if( start_sector < end_sector )
+		{
+			data_file_offset = track_value->data_file_offset
+			                 + (off64_t) ( ( start_sector - track_value->start_sector ) * track_value->bytes_per_sector );
+
+			if( libodraw_handle_append_extent(
+			     internal_handle,
+			     start_sector,
+			     end_sector - start_sector,
+			     track_value->data_file_index,
+			     data_file_offset,
+			     track_value->bytes_per_sector,
+			     track_value->type,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append extent of track: %d.",
+				 function,
+				 track_index );
 
+				return( -1 );
+			}
+			current_sector = end_sector;
+		}
+		previous_track_value = track_value;
+	}
 	return( 1 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Retrieves the size of the basename
- * Returns 1 if successful, 0 if value not present or -1 on error
+/* Retrieves the handle ASCII codepage
+ * Returns 1 if successful or -1 on error
  */
-int libodraw_internal_handle_get_basename_size_wide(
-     libodraw_internal_handle_t *internal_handle,
-     size_t *basename_size,
+int libodraw_handle_get_ascii_codepage(
+     libodraw_handle_t *handle,
+     int *ascii_codepage,
      libcerror_error_t **error )
 {
-	static char *function = "libodraw_internal_handle_get_basename_size_wide";
-
-#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
-#endif
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_get_ascii_codepage";
 
-	if( internal_handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -5169,94 +10169,47 @@ int libodraw_internal_handle_get_basename_size_wide(
 
 		return( -1 );
 	}
-	if( basename_size == NULL )
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid basename size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->basename == NULL )
-	{
-		return( 0 );
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	*basename_size = internal_handle->basename_size;
-#else
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_utf8(
-		          (libuna_utf8_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_utf8(
-		          (libuna_utf8_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_byte_stream(
-		          (uint8_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_byte_stream(
-		          (uint8_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	if( result != 1 )
+	if( ascii_codepage == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine basename size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII codepage.",
 		 function );
 
 		return( -1 );
 	}
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	*ascii_codepage = internal_handle->io_handle->ascii_codepage;
+
 	return( 1 );
 }
 
-/* Retrieves the basename
- * Returns 1 if successful, 0 if value not present or -1 on error
+/* Sets the handle ASCII codepage
+ * Returns 1 if successful or -1 on error
  */
-int libodraw_internal_handle_get_basename_wide(
-     libodraw_internal_handle_t *internal_handle,
-     wchar_t *basename,
-     size_t basename_size,
+int libodraw_handle_set_ascii_codepage(
+     libodraw_handle_t *handle,
+     int ascii_codepage,
      libcerror_error_t **error )
 {
-	static char *function     = "libodraw_internal_handle_get_basename_wide";
-	size_t wide_basename_size = 0;
-
-#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result                = 0;
-#endif
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_set_ascii_codepage";
 
-	if( internal_handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -5267,175 +10220,166 @@ int libodraw_internal_handle_get_basename_wide(
 
 		return( -1 );
 	}
-	if( basename == NULL )
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBODRAW_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->io_handle->ascii_codepage = ascii_codepage;
+
+	return( 1 );
+}
+
+/* Retrieves the number of data files
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_get_number_of_data_files(
+     libodraw_handle_t *handle,
+     int *number_of_data_files,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_get_number_of_data_files";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid basename.",
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->basename == NULL )
-	{
-		return( 0 );
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	wide_basename_size = internal_handle->basename_size;
-#else
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_utf8(
-		          (libuna_utf8_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          &wide_basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_utf8(
-		          (libuna_utf8_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          &wide_basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_byte_stream(
-		          (uint8_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          &wide_basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_byte_stream(
-		          (uint8_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          &wide_basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	if( result != 1 )
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->data_file_descriptors_array,
+	     number_of_data_files,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine basename size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries in data file descriptors array.",
 		 function );
 
 		return( -1 );
 	}
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-	if( basename_size < wide_basename_size )
+	return( 1 );
+}
+
+/* Retrieves a data file
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_get_data_file(
+     libodraw_handle_t *handle,
+     int index,
+     libodraw_data_file_t **data_file,
+     libcerror_error_t **error )
+{
+	libodraw_data_file_descriptor_t *data_file_descriptor = NULL;
+	libodraw_internal_handle_t *internal_handle           = NULL;
+	static char *function                                 = "libodraw_handle_get_data_file";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: basename too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( system_string_copy(
-	     basename,
-	     internal_handle->basename,
-	     internal_handle->basename_size ) == NULL )
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( libcdata_array_get_entry_by_index(
+	     internal_handle->data_file_descriptors_array,
+	     index,
+	     (intptr_t **) &data_file_descriptor,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set basename.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data file descriptor: %d from array.",
+		 function,
+		 index );
 
 		return( -1 );
 	}
-	basename[ internal_handle->basename_size - 1 ] = 0;
-#else
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_utf8(
-		          (libuna_utf32_character_t *) basename,
-		          basename_size,
-		          (libuna_utf8_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_utf8(
-		          (libuna_utf16_character_t *) basename,
-		          basename_size,
-		          (libuna_utf8_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_byte_stream(
-		          (libuna_utf32_character_t *) basename,
-		          basename_size,
-		          (uint8_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_byte_stream(
-		          (libuna_utf16_character_t *) basename,
-		          basename_size,
-		          (uint8_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	if( result != 1 )
+	if( libodraw_data_file_initialize(
+	     data_file,
+	     internal_handle,
+	     data_file_descriptor,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data file.",
 		 function );
 
 		return( -1 );
 	}
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
 	return( 1 );
 }
 
-/* Sets the basename
+/* Appends a data file
  * Returns 1 if successful or -1 on error
  */
-int libodraw_internal_handle_set_basename_wide(
-     libodraw_internal_handle_t *internal_handle,
-     const wchar_t *basename,
-     size_t basename_length,
+int libodraw_handle_append_data_file(
+     libodraw_handle_t *handle,
+     const char *name,
+     size_t name_length,
+     uint8_t type,
      libcerror_error_t **error )
 {
-	static char *function = "libodraw_internal_handle_set_basename_wide";
-
-#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
-#endif
+	libodraw_data_file_descriptor_t *data_file_descriptor = NULL;
+	libodraw_internal_handle_t *internal_handle           = NULL;
+	static char *function                                 = "libodraw_handle_append_data_file";
+	int entry_index                                       = 0;
 
-	if( internal_handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -5446,190 +10390,119 @@ int libodraw_internal_handle_set_basename_wide(
 
 		return( -1 );
 	}
-	if( basename == NULL )
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->shared_layout != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid handle - layout is shared with cloned handles.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->basename != NULL )
+	if( name == NULL )
 	{
-		memory_free(
-		 internal_handle->basename );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
 
-		internal_handle->basename      = NULL;
-		internal_handle->basename_size = 0;
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	internal_handle->basename_size = basename_length + 1;
-#else
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_size_from_utf32(
-		          (libuna_utf32_character_t *) basename,
-		          basename_length + 1,
-		          &( internal_handle->basename_size ),
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_size_from_utf16(
-		          (libuna_utf16_character_t *) basename,
-		          basename_length + 1,
-		          &( internal_handle->basename_size ),
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_size_from_utf32(
-		          (libuna_utf32_character_t *) basename,
-		          basename_length + 1,
-		          libclocale_codepage,
-		          &( internal_handle->basename_size ),
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_size_from_utf16(
-		          (libuna_utf16_character_t *) basename,
-		          basename_length + 1,
-		          libclocale_codepage,
-		          &( internal_handle->basename_size ),
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		return( -1 );
 	}
-	if( result != 1 )
+	if( ( type != LIBODRAW_FILE_TYPE_UNKNOWN )
+	 && ( type != LIBODRAW_FILE_TYPE_BINARY_LITTLE_ENDIAN )
+	 && ( type != LIBODRAW_FILE_TYPE_BINARY_BIG_ENDIAN )
+	 && ( type != LIBODRAW_FILE_TYPE_AUDIO_AIFF )
+	 && ( type != LIBODRAW_FILE_TYPE_AUDIO_WAVE )
+	 && ( type != LIBODRAW_FILE_TYPE_AUDIO_MPEG1_LAYER3 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine basename size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported type codepage.",
 		 function );
 
 		return( -1 );
 	}
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-	internal_handle->basename = system_string_allocate(
-	                             internal_handle->basename_size );
-
-	if( internal_handle->basename == NULL )
+	if( libodraw_data_file_descriptor_initialize(
+	     &data_file_descriptor,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data file descriptor.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( system_string_copy(
-	     internal_handle->basename,
-	     basename,
-	     basename_length ) == NULL )
+	if( libodraw_data_file_descriptor_set_name(
+	     data_file_descriptor,
+	     name,
+	     name_length,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in data file descriptor.",
 		 function );
 
-		memory_free(
-		 internal_handle->basename );
-
-		internal_handle->basename      = NULL;
-		internal_handle->basename_size = 0;
-
-		return( -1 );
-	}
-	internal_handle->basename[ basename_length ] = 0;
-#else
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_copy_from_utf32(
-		          (libuna_utf8_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          (libuna_utf32_character_t *) basename,
-		          basename_length + 1,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_copy_from_utf16(
-		          (libuna_utf8_character_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          (libuna_utf16_character_t *) basename,
-		          basename_length + 1,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_copy_from_utf32(
-		          (uint8_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          (libuna_utf32_character_t *) basename,
-		          basename_length + 1,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_copy_from_utf16(
-		          (uint8_t *) internal_handle->basename,
-		          internal_handle->basename_size,
-		          libclocale_codepage,
-		          (libuna_utf16_character_t *) basename,
-		          basename_length + 1,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		goto on_error;
 	}
-	if( result != 1 )
+	data_file_descriptor->type = type;
+
+	if( libcdata_array_append_entry(
+	     internal_handle->data_file_descriptors_array,
+	     &entry_index,
+	     (intptr_t *) data_file_descriptor,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set basename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append data file descriptor.",
 		 function );
 
-		memory_free(
-		 internal_handle->basename );
-
-		internal_handle->basename      = NULL;
-		internal_handle->basename_size = 0;
-
-		return( -1 );
+		goto on_error;
 	}
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
 	return( 1 );
+
+on_error:
+	if( data_file_descriptor != NULL )
+	{
+		libodraw_data_file_descriptor_free(
+		 &data_file_descriptor,
+		 NULL );
+	}
+	return( -1 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
 
-/* Sets the maximum number of (concurrent) open file handles
+/* Appends a data file
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_set_maximum_number_of_open_handles(
+int libodraw_handle_append_data_file_wide(
      libodraw_handle_t *handle,
-     int maximum_number_of_open_handles,
+     const wchar_t *name,
+     size_t name_length,
+     uint8_t type,
      libcerror_error_t **error )
 {
-	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_set_maximum_number_of_open_handles";
+	libodraw_data_file_descriptor_t *data_file_descriptor = NULL;
+	libodraw_internal_handle_t *internal_handle           = NULL;
+	static char *function                                 = "libodraw_handle_append_data_file_wide";
+	int entry_index                                       = 0;
 
 	if( handle == NULL )
 	{
@@ -5644,320 +10517,256 @@ int libodraw_handle_set_maximum_number_of_open_handles(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( internal_handle->data_file_io_pool != NULL )
+	if( internal_handle->shared_layout != NULL )
 	{
-		if( libbfio_pool_set_maximum_number_of_open_handles(
-		     internal_handle->data_file_io_pool,
-		     maximum_number_of_open_handles,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set maximum number of open handles in data files IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid handle - layout is shared with cloned handles.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	internal_handle->maximum_number_of_open_handles = maximum_number_of_open_handles;
-
-	return( 1 );
-}
-
-/* Sets the media values
- * Returns 1 if successful or -1 on error
- */
-int libodraw_handle_set_media_values(
-     libodraw_internal_handle_t *internal_handle,
-     libcerror_error_t **error )
-{
-	static char *function                 = "libodraw_handle_set_media_values";
-	libodraw_sector_range_t *sector_range = NULL;
-	libodraw_track_value_t *track_value   = NULL;
-	size64_t data_file_size               = 0;
-	uint64_t number_of_sectors            = 0;
-	int number_of_file_io_handles         = 0;
-	int number_of_sessions                = 0;
-	int number_of_tracks                  = 0;
-
-	if( internal_handle == NULL )
+	if( name == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid name.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle == NULL )
+	if( ( type != LIBODRAW_FILE_TYPE_UNKNOWN )
+	 && ( type != LIBODRAW_FILE_TYPE_BINARY_LITTLE_ENDIAN )
+	 && ( type != LIBODRAW_FILE_TYPE_BINARY_BIG_ENDIAN )
+	 && ( type != LIBODRAW_FILE_TYPE_AUDIO_AIFF )
+	 && ( type != LIBODRAW_FILE_TYPE_AUDIO_WAVE )
+	 && ( type != LIBODRAW_FILE_TYPE_AUDIO_MPEG1_LAYER3 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported type codepage.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle->bytes_per_sector == 0 )
+	if( libodraw_data_file_descriptor_initialize(
+	     &data_file_descriptor,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - invalid IO handle - missing bytes per sector.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data file descriptor.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_handle->data_file_io_pool == NULL )
+	if( libodraw_data_file_descriptor_set_name_wide(
+	     data_file_descriptor,
+	     name,
+	     name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in data file descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	data_file_descriptor->type = type;
+
+	if( libcdata_array_append_entry(
+	     internal_handle->data_file_descriptors_array,
+	     &entry_index,
+	     (intptr_t *) data_file_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append data file descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( data_file_descriptor != NULL )
+	{
+		libodraw_data_file_descriptor_free(
+		 &data_file_descriptor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Retrieves the number of media size
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_get_media_size(
+     libodraw_handle_t *handle,
+     size64_t *media_size,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_get_media_size";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing data file IO pool.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_pool_get_number_of_handles(
-	     internal_handle->data_file_io_pool,
-	     &number_of_file_io_handles,
-	     error ) != 1 )
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( media_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of file IO handles in pool.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media size.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_pool_get_size(
-	     internal_handle->data_file_io_pool,
-	     number_of_file_io_handles - 1,
-	     &data_file_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve data file: %d size.",
-		 function,
-		 number_of_file_io_handles - 1 );
+	*media_size = internal_handle->media_size;
 
-		return( -1 );
-	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_handle->tracks_array,
-	     &number_of_tracks,
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Retrieves the number of bytes per sector
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_get_bytes_per_sector(
+     libodraw_handle_t *handle,
+     uint32_t *bytes_per_sector,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_get_bytes_per_sector";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements in tracks array.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( number_of_tracks == 0 )
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing track values.",
+		 "%s: invalid handle - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_handle->tracks_array,
-	     number_of_tracks - 1,
-	     (intptr_t **) &track_value,
-	     error ) != 1 )
+	if( bytes_per_sector == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve track value: %d from array.",
-		 function,
-		 number_of_tracks - 1 );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bytes per sector.",
+		 function );
 
 		return( -1 );
 	}
-	if( track_value == NULL )
+	*bytes_per_sector = internal_handle->io_handle->bytes_per_sector;
+
+	return( 1 );
+}
+
+/* Sets the number of bytes per sector
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_set_bytes_per_sector(
+     libodraw_handle_t *handle,
+     uint32_t bytes_per_sector,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_set_bytes_per_sector";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing track value: %d.",
-		 function,
-		 number_of_tracks - 1 );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
 
 		return( -1 );
 	}
-	if( track_value->bytes_per_sector == 0 )
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid track value: %d - missing bytes per sector.",
-		 function,
-		 number_of_tracks - 1 );
+		 "%s: invalid handle - missing IO handle.",
+		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->media_size == 0 )
-	{
-/* TODO currently assumes that last track start sector is always relative to the start of the media */
-		if( number_of_file_io_handles > 1 )
-		{
-			internal_handle->media_size = track_value->start_sector * track_value->bytes_per_sector;
-		}
-		internal_handle->media_size += data_file_size;
-
-		internal_handle->number_of_sectors = internal_handle->media_size / track_value->bytes_per_sector;
-
-		internal_handle->media_size = internal_handle->number_of_sectors * internal_handle->io_handle->bytes_per_sector;
-	}
-	if( track_value->number_of_sectors == 0 )
-	{
-		number_of_sectors = internal_handle->number_of_sectors - track_value->start_sector;
-
-		if( number_of_sectors > (uint64_t) UINT32_MAX )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: number of sectors value out of bounds.",
-			 function );
-
-			return( -1 );
-		}
-		if( libodraw_track_value_set(
-		     track_value,
-		     track_value->start_sector,
-		     number_of_sectors,
-		     track_value->type,
-		     track_value->data_file_index,
-		     track_value->data_file_start_sector,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set last track value.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_handle->sessions_array,
-	     &number_of_sessions,
-	     error ) != 1 )
+/* TODO add support for 2352 */
+	if( bytes_per_sector != 2048 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements in sessions array.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bytes per sector.",
 		 function );
 
 		return( -1 );
 	}
-	if( number_of_sessions > 0 )
-	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_handle->sessions_array,
-		     number_of_sessions - 1,
-		     (intptr_t **) &sector_range,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve session sector range: %d from array.",
-			 function,
-			 number_of_sessions - 1 );
-
-			return( -1 );
-		}
-		if( sector_range == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing sessions sector range: %d.",
-			 function,
-			 number_of_sessions - 1 );
-
-			return( -1 );
-		}
-		if( sector_range->number_of_sectors == 0 )
-		{
-/* TODO currently assumes that last session is not followed by a lead-out */
-			number_of_sectors = internal_handle->number_of_sectors - sector_range->start_sector;
-
-			if( number_of_sectors > (uint64_t) UINT32_MAX )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: number of sectors value out of bounds.",
-				 function );
-
-				return( -1 );
-			}
-			if( libodraw_sector_range_set(
-			     sector_range,
-			     sector_range->start_sector,
-			     number_of_sectors,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set last session sector range.",
-				 function );
+	internal_handle->io_handle->bytes_per_sector = bytes_per_sector;
 
-				return( -1 );
-			}
-		}
-	}
 	return( 1 );
 }
 
-/* Retrieves the handle ASCII codepage
+/* Retrieves the number of sectors
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_get_ascii_codepage(
+int libodraw_handle_get_number_of_sectors(
      libodraw_handle_t *handle,
-     int *ascii_codepage,
+     uint64_t *number_of_sectors,
      libcerror_error_t **error )
 {
 	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_get_ascii_codepage";
+	static char *function                       = "libodraw_handle_get_number_of_sectors";
 
 	if( handle == NULL )
 	{
@@ -5972,43 +10781,35 @@ int libodraw_handle_get_ascii_codepage(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
-		 function );
-
-		return( -1 );
-	}
-	if( ascii_codepage == NULL )
+	if( number_of_sectors == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid ASCII codepage.",
+		 "%s: invalid number of sectors.",
 		 function );
 
 		return( -1 );
 	}
-	*ascii_codepage = internal_handle->io_handle->ascii_codepage;
+	*number_of_sectors = internal_handle->number_of_sectors;
 
 	return( 1 );
 }
 
-/* Sets the handle ASCII codepage
+/* Retrieves the layout memory size
+ * The layout memory size is the number of bytes used to store the tracks,
+ * sessions, run-outs and lead-outs, which cloned handles share
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_set_ascii_codepage(
+int libodraw_handle_get_layout_memory_size(
      libodraw_handle_t *handle,
-     int ascii_codepage,
+     size64_t *memory_size,
      libcerror_error_t **error )
 {
 	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_set_ascii_codepage";
+	static char *function                       = "libodraw_handle_get_layout_memory_size";
+	size_t safe_memory_size                     = 0;
 
 	if( handle == NULL )
 	{
@@ -6023,57 +10824,46 @@ int libodraw_handle_set_ascii_codepage(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
+	if( memory_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory size.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ascii_codepage != LIBODRAW_CODEPAGE_ASCII )
-	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_874 )
-	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_932 )
-	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_936 )
-	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_949 )
-	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_950 )
-	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_1250 )
-	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_1251 )
-	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_1252 )
-	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_1253 )
-	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_1254 )
-	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_1255 )
-	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_1256 )
-	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_1257 )
-	 && ( ascii_codepage != LIBODRAW_CODEPAGE_WINDOWS_1258 ) )
+	if( libodraw_layout_arena_get_memory_size(
+	     internal_handle->layout_arena,
+	     &safe_memory_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported ASCII codepage.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve layout arena memory size.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle->io_handle->ascii_codepage = ascii_codepage;
+	*memory_size = (size64_t) safe_memory_size;
 
 	return( 1 );
 }
 
-/* Retrieves the number of data files
+/* Retrieves the number of sessions
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_get_number_of_data_files(
+int libodraw_handle_get_number_of_sessions(
      libodraw_handle_t *handle,
-     int *number_of_data_files,
+     int *number_of_sessions,
      libcerror_error_t **error )
 {
 	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_get_number_of_data_files";
+	static char *function                       = "libodraw_handle_get_number_of_sessions";
 
 	if( handle == NULL )
 	{
@@ -6088,16 +10878,17 @@ int libodraw_handle_get_number_of_data_files(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_handle->data_file_descriptors_array,
-	     number_of_data_files,
+	if( libodraw_layout_arena_get_number_of_sector_ranges(
+	     internal_handle->layout_arena,
+	     LIBODRAW_LAYOUT_ARENA_REGION_SESSIONS,
+	     number_of_sessions,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries in data file descriptors array.",
+		 "%s: unable to retrieve number of sessions.",
 		 function );
 
 		return( -1 );
@@ -6105,18 +10896,19 @@ int libodraw_handle_get_number_of_data_files(
 	return( 1 );
 }
 
-/* Retrieves a data file
+/* Retrieves a session
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_get_data_file(
+int libodraw_handle_get_session(
      libodraw_handle_t *handle,
      int index,
-     libodraw_data_file_t **data_file,
+     uint64_t *start_sector,
+     uint64_t *number_of_sectors,
      libcerror_error_t **error )
 {
-	libodraw_data_file_descriptor_t *data_file_descriptor = NULL;
-	libodraw_internal_handle_t *internal_handle           = NULL;
-	static char *function                                 = "libodraw_handle_get_data_file";
+	libodraw_internal_handle_t *internal_handle = NULL;
+	libodraw_sector_range_t *sector_range       = NULL;
+	static char *function                       = "libodraw_handle_get_session";
 
 	if( handle == NULL )
 	{
@@ -6131,33 +10923,34 @@ int libodraw_handle_get_data_file(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_handle->data_file_descriptors_array,
+	if( libodraw_layout_arena_get_sector_range_by_index(
+	     internal_handle->layout_arena,
+	     LIBODRAW_LAYOUT_ARENA_REGION_SESSIONS,
 	     index,
-	     (intptr_t **) &data_file_descriptor,
+	     &sector_range,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve data file descriptor: %d from array.",
+		 "%s: unable to retrieve session sector range: %d.",
 		 function,
 		 index );
 
 		return( -1 );
 	}
-	if( libodraw_data_file_initialize(
-	     data_file,
-	     internal_handle,
-	     data_file_descriptor,
+	if( libodraw_sector_range_get(
+	     sector_range,
+	     start_sector,
+	     number_of_sectors,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data file.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sector range.",
 		 function );
 
 		return( -1 );
@@ -6165,20 +10958,21 @@ int libodraw_handle_get_data_file(
 	return( 1 );
 }
 
-/* Appends a data file
+/* Appends a session
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_append_data_file(
+int libodraw_handle_append_session(
      libodraw_handle_t *handle,
-     const char *name,
-     size_t name_length,
-     uint8_t type,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
      libcerror_error_t **error )
 {
-	libodraw_data_file_descriptor_t *data_file_descriptor = NULL;
-	libodraw_internal_handle_t *internal_handle           = NULL;
-	static char *function                                 = "libodraw_handle_append_data_file";
-	int entry_index                                       = 0;
+	libodraw_sector_range_t sector_range_data;
+
+	libodraw_internal_handle_t *internal_handle = NULL;
+	libodraw_sector_range_t *sector_range       = NULL;
+	static char *function                       = "libodraw_handle_append_session";
+	int entry_index                             = 0;
 
 	if( handle == NULL )
 	{
@@ -6193,106 +10987,198 @@ int libodraw_handle_append_data_file(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( name == NULL )
+	if( internal_handle->shared_layout != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid name.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid handle - layout is shared with cloned handles.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( type != LIBODRAW_FILE_TYPE_UNKNOWN )
-	 && ( type != LIBODRAW_FILE_TYPE_BINARY_LITTLE_ENDIAN )
-	 && ( type != LIBODRAW_FILE_TYPE_BINARY_BIG_ENDIAN )
-	 && ( type != LIBODRAW_FILE_TYPE_AUDIO_AIFF )
-	 && ( type != LIBODRAW_FILE_TYPE_AUDIO_WAVE )
-	 && ( type != LIBODRAW_FILE_TYPE_AUDIO_MPEG1_LAYER3 ) )
+	if( memory_set(
+	     &sector_range_data,
+	     0,
+	     sizeof( libodraw_sector_range_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported type codepage.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sector range.",
 		 function );
 
 		return( -1 );
 	}
-	if( libodraw_data_file_descriptor_initialize(
-	     &data_file_descriptor,
+	if( libodraw_sector_range_set(
+	     &sector_range_data,
+	     start_sector,
+	     number_of_sectors,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data file descriptor.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sector range.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libodraw_data_file_descriptor_set_name(
-	     data_file_descriptor,
-	     name,
-	     name_length,
+	if( libodraw_layout_arena_append_sector_range(
+	     internal_handle->layout_arena,
+	     LIBODRAW_LAYOUT_ARENA_REGION_SESSIONS,
+	     &entry_index,
+	     &sector_range,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set name in data file descriptor.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append session sector range.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	data_file_descriptor->type = type;
+	if( memory_copy(
+	     sector_range,
+	     &sector_range_data,
+	     sizeof( libodraw_sector_range_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy session sector range.",
+		 function );
 
-	if( libcdata_array_append_entry(
-	     internal_handle->data_file_descriptors_array,
-	     &entry_index,
-	     (intptr_t *) data_file_descriptor,
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of lead-outs
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_get_number_of_lead_outs(
+     libodraw_handle_t *handle,
+     int *number_of_lead_outs,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libodraw_handle_get_number_of_lead_outs";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libodraw_internal_handle_t *) handle;
+
+	if( libodraw_layout_arena_get_number_of_sector_ranges(
+	     internal_handle->layout_arena,
+	     LIBODRAW_LAYOUT_ARENA_REGION_LEAD_OUTS,
+	     number_of_lead_outs,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append data file descriptor.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of lead-outs.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	return( 1 );
+}
 
-on_error:
-	if( data_file_descriptor != NULL )
+/* Retrieves a lead-out
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_handle_get_lead_out(
+     libodraw_handle_t *handle,
+     int index,
+     uint64_t *start_sector,
+     uint64_t *number_of_sectors,
+     libcerror_error_t **error )
+{
+	libodraw_internal_handle_t *internal_handle = NULL;
+	libodraw_sector_range_t *sector_range       = NULL;
+	static char *function                       = "libodraw_handle_get_lead_out";
+
+	if( handle == NULL )
 	{
-		libodraw_data_file_descriptor_free(
-		 &data_file_descriptor,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
-}
+	internal_handle = (libodraw_internal_handle_t *) handle;
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	if( libodraw_layout_arena_get_sector_range_by_index(
+	     internal_handle->layout_arena,
+	     LIBODRAW_LAYOUT_ARENA_REGION_LEAD_OUTS,
+	     index,
+	     &sector_range,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve lead-out sector range: %d.",
+		 function,
+		 index );
 
-/* Appends a data file
+		return( -1 );
+	}
+	if( libodraw_sector_range_get(
+	     sector_range,
+	     start_sector,
+	     number_of_sectors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sector range.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a lead-out
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_append_data_file_wide(
+int libodraw_handle_append_lead_out(
      libodraw_handle_t *handle,
-     const wchar_t *name,
-     size_t name_length,
-     uint8_t type,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
      libcerror_error_t **error )
-{
-	libodraw_data_file_descriptor_t *data_file_descriptor = NULL;
-	libodraw_internal_handle_t *internal_handle           = NULL;
-	static char *function                                 = "libodraw_handle_append_data_file_wide";
-	int entry_index                                       = 0;
+{
+	libodraw_sector_range_t sector_range_data;
+
+	libodraw_internal_handle_t *internal_handle = NULL;
+	libodraw_sector_range_t *sector_range       = NULL;
+	static char *function                       = "libodraw_handle_append_lead_out";
+	int entry_index                             = 0;
 
 	if( handle == NULL )
 	{
@@ -6307,102 +11193,89 @@ int libodraw_handle_append_data_file_wide(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( name == NULL )
+	if( internal_handle->shared_layout != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid name.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid handle - layout is shared with cloned handles.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( type != LIBODRAW_FILE_TYPE_UNKNOWN )
-	 && ( type != LIBODRAW_FILE_TYPE_BINARY_LITTLE_ENDIAN )
-	 && ( type != LIBODRAW_FILE_TYPE_BINARY_BIG_ENDIAN )
-	 && ( type != LIBODRAW_FILE_TYPE_AUDIO_AIFF )
-	 && ( type != LIBODRAW_FILE_TYPE_AUDIO_WAVE )
-	 && ( type != LIBODRAW_FILE_TYPE_AUDIO_MPEG1_LAYER3 ) )
+	if( memory_set(
+	     &sector_range_data,
+	     0,
+	     sizeof( libodraw_sector_range_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported type codepage.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sector range.",
 		 function );
 
 		return( -1 );
 	}
-	if( libodraw_data_file_descriptor_initialize(
-	     &data_file_descriptor,
+	if( libodraw_sector_range_set(
+	     &sector_range_data,
+	     start_sector,
+	     number_of_sectors,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data file descriptor.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sector range.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libodraw_data_file_descriptor_set_name_wide(
-	     data_file_descriptor,
-	     name,
-	     name_length,
+	if( libodraw_layout_arena_append_sector_range(
+	     internal_handle->layout_arena,
+	     LIBODRAW_LAYOUT_ARENA_REGION_LEAD_OUTS,
+	     &entry_index,
+	     &sector_range,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set name in data file descriptor.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append lead-out sector range.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	data_file_descriptor->type = type;
-
-	if( libcdata_array_append_entry(
-	     internal_handle->data_file_descriptors_array,
-	     &entry_index,
-	     (intptr_t *) data_file_descriptor,
-	     error ) != 1 )
+	if( memory_copy(
+	     sector_range,
+	     &sector_range_data,
+	     sizeof( libodraw_sector_range_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append data file descriptor.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy lead-out sector range.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	return( 1 );
-
-on_error:
-	if( data_file_descriptor != NULL )
-	{
-		libodraw_data_file_descriptor_free(
-		 &data_file_descriptor,
-		 NULL );
-	}
-	return( -1 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Retrieves the number of media size
+/* Retrieves the number of tracks
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_get_media_size(
+int libodraw_handle_get_number_of_tracks(
      libodraw_handle_t *handle,
-     size64_t *media_size,
+     int *number_of_tracks,
      libcerror_error_t **error )
 {
 	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_get_media_size";
+	static char *function                       = "libodraw_handle_get_number_of_tracks";
 
 	if( handle == NULL )
 	{
@@ -6417,32 +11290,39 @@ int libodraw_handle_get_media_size(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( media_size == NULL )
+	if( libodraw_layout_arena_get_number_of_tracks(
+	     internal_handle->layout_arena,
+	     number_of_tracks,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid media size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tracks.",
 		 function );
 
 		return( -1 );
 	}
-	*media_size = internal_handle->media_size;
-
 	return( 1 );
 }
 
-/* Retrieves the number of bytes per sector
+/* Retrieves a track
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_get_bytes_per_sector(
+int libodraw_handle_get_track(
      libodraw_handle_t *handle,
-     uint32_t *bytes_per_sector,
+     int index,
+     uint64_t *start_sector,
+     uint64_t *number_of_sectors,
+     uint8_t *type,
+     int *data_file_index,
+     uint64_t *data_file_start_sector,
      libcerror_error_t **error )
 {
 	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_get_bytes_per_sector";
+	libodraw_track_value_t *track_value         = NULL;
+	static char *function                       = "libodraw_handle_get_track";
 
 	if( handle == NULL )
 	{
@@ -6457,43 +11337,61 @@ int libodraw_handle_get_bytes_per_sector(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
+	if( libodraw_layout_arena_get_track_by_index(
+	     internal_handle->layout_arena,
+	     index,
+	     &track_value,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve track value: %d.",
+		 function,
+		 index );
 
 		return( -1 );
 	}
-	if( bytes_per_sector == NULL )
+	if( libodraw_track_value_get(
+	     track_value,
+	     start_sector,
+	     number_of_sectors,
+	     type,
+	     data_file_index,
+	     data_file_start_sector,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid bytes per sector.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve track value.",
 		 function );
 
 		return( -1 );
 	}
-	*bytes_per_sector = internal_handle->io_handle->bytes_per_sector;
-
 	return( 1 );
 }
 
-/* Sets the number of bytes per sector
+/* Appends a track
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_set_bytes_per_sector(
+int libodraw_handle_append_track(
      libodraw_handle_t *handle,
-     uint32_t bytes_per_sector,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     uint8_t type,
+     int data_file_index,
+     uint64_t data_file_start_sector,
      libcerror_error_t **error )
 {
+	libodraw_track_value_t track_value_data;
+
 	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_set_bytes_per_sector";
+	libodraw_track_value_t *track_value         = NULL;
+	static char *function                       = "libodraw_handle_append_track";
+	int entry_index                             = 0;
 
 	if( handle == NULL )
 	{
@@ -6508,44 +11406,93 @@ int libodraw_handle_set_bytes_per_sector(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
+	if( internal_handle->shared_layout != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid handle - layout is shared with cloned handles.",
 		 function );
 
 		return( -1 );
 	}
-/* TODO add support for 2352 */
-	if( bytes_per_sector != 2048 )
+	if( memory_set(
+	     &track_value_data,
+	     0,
+	     sizeof( libodraw_track_value_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported bytes per sector.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear track value.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle->io_handle->bytes_per_sector = bytes_per_sector;
+	if( libodraw_track_value_set(
+	     &track_value_data,
+	     start_sector,
+	     number_of_sectors,
+	     type,
+	     data_file_index,
+	     data_file_start_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set track value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_layout_arena_append_track(
+	     internal_handle->layout_arena,
+	     &entry_index,
+	     &track_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append track.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     track_value,
+	     &track_value_data,
+	     sizeof( libodraw_track_value_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy track value.",
+		 function );
 
+		return( -1 );
+	}
 	return( 1 );
 }
 
-/* Retrieves the number of sectors
+
+
+/* Retrieves the number of extents
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_get_number_of_sectors(
+int libodraw_handle_get_number_of_extents(
      libodraw_handle_t *handle,
-     uint64_t *number_of_sectors,
+     int *number_of_extents,
      libcerror_error_t **error )
 {
 	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_get_number_of_sectors";
+	static char *function                       = "libodraw_handle_get_number_of_extents";
 
 	if( handle == NULL )
 	{
@@ -6560,32 +11507,47 @@ int libodraw_handle_get_number_of_sectors(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( number_of_sectors == NULL )
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->extents_array,
+	     number_of_extents,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of sectors.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements in extents array.",
 		 function );
 
 		return( -1 );
 	}
-	*number_of_sectors = internal_handle->number_of_sectors;
-
 	return( 1 );
 }
 
-/* Retrieves the number of sessions
+/* Retrieves an extent
+ * The offset and size are relative to the start of the media, the data file offset
+ * is relative to the start of the data file and the bytes per sector contains the
+ * sector size used in the data file. Sparse extents are not stored in a data file
+ * and have a data file index of -1
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_get_number_of_sessions(
+int libodraw_handle_get_extent(
      libodraw_handle_t *handle,
-     int *number_of_sessions,
+     int index,
+     off64_t *offset,
+     size64_t *size,
+     int *data_file_index,
+     off64_t *data_file_offset,
+     uint32_t *bytes_per_sector,
+     uint8_t *track_type,
+     uint32_t *flags,
      libcerror_error_t **error )
 {
+	libodraw_extent_t *extent                   = NULL;
 	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_get_number_of_sessions";
+	static char *function                       = "libodraw_handle_get_extent";
+	uint64_t number_of_sectors                  = 0;
+	uint64_t start_sector                       = 0;
 
 	if( handle == NULL )
 	{
@@ -6600,97 +11562,111 @@ int libodraw_handle_get_number_of_sessions(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_handle->sessions_array,
-	     number_of_sessions,
-	     error ) != 1 )
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements in sessions array.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves a session
- * Returns 1 if successful or -1 on error
- */
-int libodraw_handle_get_session(
-     libodraw_handle_t *handle,
-     int index,
-     uint64_t *start_sector,
-     uint64_t *number_of_sectors,
-     libcerror_error_t **error )
-{
-	libodraw_internal_handle_t *internal_handle = NULL;
-	libodraw_sector_range_t *sector_range       = NULL;
-	static char *function                       = "libodraw_handle_get_session";
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
 
-	if( handle == NULL )
+		return( -1 );
+	}
+	if( size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid size.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libodraw_internal_handle_t *) handle;
-
 	if( libcdata_array_get_entry_by_index(
-	     internal_handle->sessions_array,
+	     internal_handle->extents_array,
 	     index,
-	     (intptr_t **) &sector_range,
+	     (intptr_t **) &extent,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve session sector range: %d from array.",
+		 "%s: unable to retrieve extent: %d from array.",
 		 function,
 		 index );
 
 		return( -1 );
 	}
-	if( libodraw_sector_range_get(
-	     sector_range,
-	     start_sector,
-	     number_of_sectors,
+	if( libodraw_extent_get(
+	     extent,
+	     &start_sector,
+	     &number_of_sectors,
+	     data_file_index,
+	     data_file_offset,
+	     bytes_per_sector,
+	     track_type,
+	     flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve sector range.",
-		 function );
+		 "%s: unable to retrieve extent: %d.",
+		 function,
+		 index );
 
 		return( -1 );
 	}
+	*offset = (off64_t) ( start_sector * internal_handle->io_handle->bytes_per_sector );
+	*size   = (size64_t) ( number_of_sectors * internal_handle->io_handle->bytes_per_sector );
+
 	return( 1 );
 }
 
-/* Appends a session
- * Returns 1 if successful or -1 on error
+/* Reads the payloads of sectors of a track
+ * The sector index is relative to the start of the track, sectors beyond the end of
+ * the track or the data file are not read
+ * Returns the number of bytes read or -1 on error
  */
-int libodraw_handle_append_session(
-     libodraw_handle_t *handle,
-     uint64_t start_sector,
-     uint64_t number_of_sectors,
-     libcerror_error_t **error )
+ssize_t libodraw_handle_read_track_sector_payloads(
+         libodraw_handle_t *handle,
+         int track_index,
+         uint64_t sector_index,
+         uint32_t number_of_sectors,
+         uint8_t payload_mode,
+         void *buffer,
+         size_t buffer_size,
+         uint8_t *form_map,
+         size_t form_map_size,
+         libcerror_error_t **error )
 {
 	libodraw_internal_handle_t *internal_handle = NULL;
-	libodraw_sector_range_t *sector_range       = NULL;
-	static char *function                       = "libodraw_handle_append_session";
-	int entry_index                             = 0;
+	libodraw_track_value_t *track_value         = NULL;
+	uint8_t *sector_data                        = NULL;
+	static char *function                       = "libodraw_handle_read_track_sector_payloads";
+	size_t buffer_offset                        = 0;
+	size_t read_size                            = 0;
+	size_t sector_data_size                     = 0;
+	ssize_t copy_count                          = 0;
+	ssize_t read_count                          = 0;
+	uint64_t number_of_sectors_read             = 0;
+	uint64_t read_number_of_sectors             = 0;
+	uint64_t sector_offset                      = 0;
 
 	if( handle == NULL )
 	{
@@ -6705,115 +11681,280 @@ int libodraw_handle_append_session(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( libodraw_sector_range_initialize(
-	     &sector_range,
-	     error ) != 1 )
+	if( internal_handle->data_file_io_pool == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create sector range.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing data file IO pool.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libodraw_sector_range_set(
-	     sector_range,
-	     start_sector,
-	     number_of_sectors,
-	     error ) != 1 )
+	if( internal_handle->statistics == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set sector range.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing statistics.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdata_array_append_entry(
-	     internal_handle->sessions_array,
-	     &entry_index,
-	     (intptr_t *) sector_range,
-	     error ) != 1 )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append session sector range to array.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
-
-on_error:
-	if( sector_range != NULL )
+	if( buffer_size > (size_t) SSIZE_MAX )
 	{
-		libodraw_sector_range_free(
-		 &sector_range,
-		 NULL );
-	}
-	return( -1 );
-}
-
-/* Retrieves the number of lead-outs
- * Returns 1 if successful or -1 on error
- */
-int libodraw_handle_get_number_of_lead_outs(
-     libodraw_handle_t *handle,
-     int *number_of_lead_outs,
-     libcerror_error_t **error )
-{
-	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_get_number_of_lead_outs";
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
 
-	if( handle == NULL )
+		return( -1 );
+	}
+	/* Without a form map the payloads read in mixed mode cannot be separated
+	 */
+	if( ( payload_mode == LIBODRAW_SECTOR_PAYLOAD_MODE_MIXED )
+	 && ( form_map == NULL ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid form map.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libodraw_internal_handle_t *) handle;
-
-	if( libcdata_array_get_number_of_entries(
-	     internal_handle->lead_outs_array,
-	     number_of_lead_outs,
+	if( libodraw_layout_arena_get_track_by_index(
+	     internal_handle->layout_arena,
+	     track_index,
+	     &track_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements in lead-outs array.",
+		 "%s: unable to retrieve track value: %d.",
+		 function,
+		 track_index );
+
+		return( -1 );
+	}
+	if( track_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing track value: %d.",
+		 function,
+		 track_index );
+
+		return( -1 );
+	}
+	if( ( track_value->bytes_per_sector == 0 )
+	 || ( track_value->bytes_per_sector > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / LIBODRAW_SECTOR_SCAN_NUMBER_OF_SECTORS_PER_READ ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid track value: %d - bytes per sector value out of bounds.",
+		 function,
+		 track_index );
+
+		return( -1 );
+	}
+	if( sector_index >= track_value->number_of_sectors )
+	{
+		return( 0 );
+	}
+	if( (uint64_t) number_of_sectors > ( track_value->number_of_sectors - sector_index ) )
+	{
+		number_of_sectors = (uint32_t) ( track_value->number_of_sectors - sector_index );
+	}
+	if( ( form_map != NULL )
+	 && ( (size_t) number_of_sectors > form_map_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid form map size value too small.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	sector_data_size = (size_t) track_value->bytes_per_sector * LIBODRAW_SECTOR_SCAN_NUMBER_OF_SECTORS_PER_READ;
+
+	sector_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * sector_data_size );
+
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sector data.",
+		 function );
+
+		goto on_error;
+	}
+	while( sector_offset < (uint64_t) number_of_sectors )
+	{
+		read_number_of_sectors = (uint64_t) number_of_sectors - sector_offset;
+
+		if( read_number_of_sectors > LIBODRAW_SECTOR_SCAN_NUMBER_OF_SECTORS_PER_READ )
+		{
+			read_number_of_sectors = LIBODRAW_SECTOR_SCAN_NUMBER_OF_SECTORS_PER_READ;
+		}
+		read_size = (size_t) read_number_of_sectors * track_value->bytes_per_sector;
+
+		/* A track that is not stored in a data file is read as 0-byte values
+		 */
+		if( track_value->data_file_index < 0 )
+		{
+			if( memory_set(
+			     sector_data,
+			     0,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear sector data.",
+				 function );
+
+				goto on_error;
+			}
+			read_count = (ssize_t) read_size;
+		}
+		else
+		{
+			read_count = libodraw_internal_handle_read_data_file_buffer_at_offset(
+			              internal_handle,
+			              track_value->data_file_index,
+			              sector_data,
+			              read_size,
+			              track_value->data_file_offset + (off64_t) ( ( sector_index + sector_offset ) * track_value->bytes_per_sector ),
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read sectors of track: %d from data file: %d.",
+				 function,
+				 track_index,
+				 track_value->data_file_index );
+
+				goto on_error;
+			}
+		}
+		number_of_sectors_read = (uint64_t) read_count / track_value->bytes_per_sector;
+
+		if( number_of_sectors_read == 0 )
+		{
+			break;
+		}
+		copy_count = libodraw_io_handle_copy_sector_payloads_to_buffer(
+		              internal_handle->io_handle,
+		              sector_data,
+		              (size_t) number_of_sectors_read * track_value->bytes_per_sector,
+		              track_value->bytes_per_sector,
+		              track_value->type,
+		              payload_mode,
+		              &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+		              buffer_size - buffer_offset,
+		              ( form_map != NULL ) ? &( form_map[ sector_offset ] ) : NULL,
+		              ( form_map != NULL ) ? form_map_size - (size_t) sector_offset : 0,
+		              error );
+
+		if( copy_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy sector payloads of track: %d to buffer.",
+			 function,
+			 track_index );
+
+			goto on_error;
+		}
+		LIBODRAW_STATISTICS_ADD( internal_handle->statistics->number_of_converted_sectors, number_of_sectors_read );
+
+		buffer_offset += (size_t) copy_count;
+		sector_offset += number_of_sectors_read;
+
+		/* The sectors beyond the end of a truncated data file are not read
+		 */
+		if( number_of_sectors_read < read_number_of_sectors )
+		{
+			break;
+		}
+		if( internal_handle->io_handle->abort != 0 )
+		{
+			break;
+		}
+	}
+	memory_free(
+	 sector_data );
+
+	return( (ssize_t) buffer_offset );
+
+on_error:
+	if( sector_data != NULL )
+	{
+		memory_free(
+		 sector_data );
+	}
+	return( -1 );
 }
 
-/* Retrieves a lead-out
+/* Scans the sectors of a track
+ * Every sector of the track is read from the data file and classified by its
+ * synchronisation data, header and sub-header. The number of sectors per sector class
+ * and the runs of sectors of which the sector class does not match the track type
+ * can be retrieved after the scan
+ * A track that was already scanned is not scanned again
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_get_lead_out(
+int libodraw_handle_scan_track(
      libodraw_handle_t *handle,
-     int index,
-     uint64_t *start_sector,
-     uint64_t *number_of_sectors,
+     int track_index,
      libcerror_error_t **error )
 {
 	libodraw_internal_handle_t *internal_handle = NULL;
-	libodraw_sector_range_t *sector_range       = NULL;
-	static char *function                       = "libodraw_handle_get_lead_out";
+	libodraw_track_value_t *track_value         = NULL;
+	uint8_t *buffer                             = NULL;
+	static char *function                       = "libodraw_handle_scan_track";
+	size_t buffer_size                          = 0;
+	size_t read_size                            = 0;
+	ssize_t read_count                          = 0;
+	uint64_t number_of_sectors_read             = 0;
+	uint64_t read_number_of_sectors             = 0;
+	uint64_t sector_index                       = 0;
+	int number_of_tracks                        = 0;
 
 	if( handle == NULL )
 	{
@@ -6828,132 +11969,264 @@ int libodraw_handle_get_lead_out(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_handle->lead_outs_array,
-	     index,
-	     (intptr_t **) &sector_range,
-	     error ) != 1 )
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve lead-out sector range: %d from array.",
-		 function,
-		 index );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
 
 		return( -1 );
 	}
-	if( libodraw_sector_range_get(
-	     sector_range,
-	     start_sector,
-	     number_of_sectors,
-	     error ) != 1 )
+	if( internal_handle->data_file_io_pool == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve sector range.",
-		 function );
-
-		return( -1 );
-	}
-	return( 1 );
-}
-
-/* Appends a lead-out
- * Returns 1 if successful or -1 on error
- */
-int libodraw_handle_append_lead_out(
-     libodraw_handle_t *handle,
-     uint64_t start_sector,
-     uint64_t number_of_sectors,
-     libcerror_error_t **error )
-{
-	libodraw_internal_handle_t *internal_handle = NULL;
-	libodraw_sector_range_t *sector_range       = NULL;
-	static char *function                       = "libodraw_handle_append_lead_out";
-	int entry_index                             = 0;
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing data file IO pool.",
+		 function );
 
-	if( handle == NULL )
+		return( -1 );
+	}
+	if( libodraw_layout_arena_get_number_of_tracks(
+	     internal_handle->layout_arena,
+	     &number_of_tracks,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tracks.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libodraw_internal_handle_t *) handle;
-
-	if( libodraw_sector_range_initialize(
-	     &sector_range,
+	if( libodraw_layout_arena_get_track_by_index(
+	     internal_handle->layout_arena,
+	     track_index,
+	     &track_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create sector range.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve track value: %d.",
+		 function,
+		 track_index );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libodraw_sector_range_set(
-	     sector_range,
-	     start_sector,
-	     number_of_sectors,
-	     error ) != 1 )
+	if( track_value == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set sector range.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing track value: %d.",
+		 function,
+		 track_index );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdata_array_append_entry(
-	     internal_handle->lead_outs_array,
-	     &entry_index,
-	     (intptr_t *) sector_range,
-	     error ) != 1 )
+	if( ( track_value->bytes_per_sector == 0 )
+	 || ( track_value->bytes_per_sector > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / LIBODRAW_SECTOR_SCAN_NUMBER_OF_SECTORS_PER_READ ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append lead-out sector range to array.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid track value: %d - bytes per sector value out of bounds.",
+		 function,
+		 track_index );
+
+		return( -1 );
+	}
+	if( internal_handle->sector_scan == NULL )
+	{
+		if( libodraw_sector_scan_initialize(
+		     &( internal_handle->sector_scan ),
+		     number_of_tracks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sector scan.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_handle->sector_scan->track_is_scanned[ track_index ] != 0 )
+	{
+		return( 1 );
+	}
+	/* A track that is not stored in a data file is read as 0-byte values
+	 */
+	if( track_value->data_file_index < 0 )
+	{
+		if( libodraw_sector_scan_append_sectors(
+		     internal_handle->sector_scan,
+		     track_index,
+		     track_value->start_sector,
+		     track_value->number_of_sectors,
+		     LIBODRAW_SECTOR_CLASS_ZERO,
+		     track_value->type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append sectors of track: %d.",
+			 function,
+			 track_index );
+
+			goto on_error;
+		}
+		internal_handle->sector_scan->track_is_scanned[ track_index ] = 1;
+
+		return( 1 );
+	}
+	buffer_size = (size_t) track_value->bytes_per_sector * LIBODRAW_SECTOR_SCAN_NUMBER_OF_SECTORS_PER_READ;
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
 		 function );
 
 		goto on_error;
 	}
+	while( sector_index < track_value->number_of_sectors )
+	{
+		read_number_of_sectors = track_value->number_of_sectors - sector_index;
+
+		if( read_number_of_sectors > LIBODRAW_SECTOR_SCAN_NUMBER_OF_SECTORS_PER_READ )
+		{
+			read_number_of_sectors = LIBODRAW_SECTOR_SCAN_NUMBER_OF_SECTORS_PER_READ;
+		}
+		read_size = (size_t) read_number_of_sectors * track_value->bytes_per_sector;
+
+		read_count = libodraw_internal_handle_read_data_file_buffer_at_offset(
+		              internal_handle,
+		              track_value->data_file_index,
+		              buffer,
+		              read_size,
+		              track_value->data_file_offset + (off64_t) ( sector_index * track_value->bytes_per_sector ),
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sectors of track: %d from data file: %d.",
+			 function,
+			 track_index,
+			 track_value->data_file_index );
+
+			goto on_error;
+		}
+		number_of_sectors_read = (uint64_t) read_count / track_value->bytes_per_sector;
+
+		if( libodraw_sector_scan_classify_sectors(
+		     internal_handle->sector_scan,
+		     track_index,
+		     track_value->start_sector + sector_index,
+		     buffer,
+		     (size_t) number_of_sectors_read * track_value->bytes_per_sector,
+		     track_value->bytes_per_sector,
+		     track_value->type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to classify sectors of track: %d.",
+			 function,
+			 track_index );
+
+			goto on_error;
+		}
+		sector_index += number_of_sectors_read;
+
+		/* The sectors beyond the end of a truncated data file are missing
+		 */
+		if( number_of_sectors_read < read_number_of_sectors )
+		{
+			if( libodraw_sector_scan_append_sectors(
+			     internal_handle->sector_scan,
+			     track_index,
+			     track_value->start_sector + sector_index,
+			     track_value->number_of_sectors - sector_index,
+			     LIBODRAW_SECTOR_CLASS_MISSING,
+			     track_value->type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append missing sectors of track: %d.",
+				 function,
+				 track_index );
+
+				goto on_error;
+			}
+			sector_index = track_value->number_of_sectors;
+		}
+		if( internal_handle->io_handle->abort != 0 )
+		{
+			break;
+		}
+	}
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	if( sector_index >= track_value->number_of_sectors )
+	{
+		internal_handle->sector_scan->track_is_scanned[ track_index ] = 1;
+	}
 	return( 1 );
 
 on_error:
-	if( sector_range != NULL )
+	if( buffer != NULL )
 	{
-		libodraw_sector_range_free(
-		 &sector_range,
-		 NULL );
+		memory_free(
+		 buffer );
 	}
 	return( -1 );
 }
 
-/* Retrieves the number of tracks
- * Returns 1 if successful or -1 on error
+/* Retrieves the number of sectors of a specific sector class of a scanned track
+ * Returns 1 if successful, 0 if the track was not scanned or -1 on error
  */
-int libodraw_handle_get_number_of_tracks(
+int libodraw_handle_get_number_of_scanned_sectors(
      libodraw_handle_t *handle,
-     int *number_of_tracks,
+     int track_index,
+     uint8_t sector_class,
+     uint64_t *number_of_sectors,
      libcerror_error_t **error )
 {
 	libodraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libodraw_handle_get_number_of_tracks";
+	static char *function                       = "libodraw_handle_get_number_of_scanned_sectors";
 
 	if( handle == NULL )
 	{
@@ -6968,39 +12241,58 @@ int libodraw_handle_get_number_of_tracks(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_handle->tracks_array,
-	     number_of_tracks,
+	if( internal_handle->sector_scan == NULL )
+	{
+		return( 0 );
+	}
+	if( ( track_index < 0 )
+	 || ( track_index >= internal_handle->sector_scan->number_of_tracks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid track index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->sector_scan->track_is_scanned[ track_index ] == 0 )
+	{
+		return( 0 );
+	}
+	if( libodraw_sector_scan_get_number_of_sectors(
+	     internal_handle->sector_scan,
+	     track_index,
+	     sector_class,
+	     number_of_sectors,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements in tracks array.",
-		 function );
+		 "%s: unable to retrieve number of sectors of track: %d.",
+		 function,
+		 track_index );
 
 		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Retrieves a track
+/* Retrieves the number of sector anomalies
+ * A sector anomaly is a run of sectors of which the sector class does not match
+ * the track type, or that have bad synchronisation data or a bad header
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_get_track(
+int libodraw_handle_get_number_of_sector_anomalies(
      libodraw_handle_t *handle,
-     int index,
-     uint64_t *start_sector,
-     uint64_t *number_of_sectors,
-     uint8_t *type,
-     int *data_file_index,
-     uint64_t *data_file_start_sector,
+     int *number_of_anomalies,
      libcerror_error_t **error )
 {
 	libodraw_internal_handle_t *internal_handle = NULL;
-	libodraw_track_value_t *track_value         = NULL;
-	static char *function                       = "libodraw_handle_get_track";
+	static char *function                       = "libodraw_handle_get_number_of_sector_anomalies";
 
 	if( handle == NULL )
 	{
@@ -7015,36 +12307,33 @@ int libodraw_handle_get_track(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_handle->tracks_array,
-	     index,
-	     (intptr_t **) &track_value,
-	     error ) != 1 )
+	if( number_of_anomalies == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve track value: %d from array.",
-		 function,
-		 index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of anomalies.",
+		 function );
 
 		return( -1 );
 	}
-	if( libodraw_track_value_get(
-	     track_value,
-	     start_sector,
-	     number_of_sectors,
-	     type,
-	     data_file_index,
-	     data_file_start_sector,
+	if( internal_handle->sector_scan == NULL )
+	{
+		*number_of_anomalies = 0;
+
+		return( 1 );
+	}
+	if( libodraw_sector_scan_get_number_of_anomalies(
+	     internal_handle->sector_scan,
+	     number_of_anomalies,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve track value.",
+		 "%s: unable to retrieve number of anomalies.",
 		 function );
 
 		return( -1 );
@@ -7052,22 +12341,20 @@ int libodraw_handle_get_track(
 	return( 1 );
 }
 
-/* Appends a track
+/* Retrieves a specific sector anomaly
+ * The anomalies are stored in the order the tracks were scanned
  * Returns 1 if successful or -1 on error
  */
-int libodraw_handle_append_track(
+int libodraw_handle_get_sector_anomaly(
      libodraw_handle_t *handle,
-     uint64_t start_sector,
-     uint64_t number_of_sectors,
-     uint8_t type,
-     int data_file_index,
-     uint64_t data_file_start_sector,
+     int index,
+     uint64_t *start_sector,
+     uint64_t *number_of_sectors,
+     uint8_t *sector_class,
      libcerror_error_t **error )
 {
 	libodraw_internal_handle_t *internal_handle = NULL;
-	libodraw_track_value_t *track_value         = NULL;
-	static char *function                       = "libodraw_handle_append_track";
-	int entry_index                             = 0;
+	static char *function                       = "libodraw_handle_get_sector_anomaly";
 
 	if( handle == NULL )
 	{
@@ -7082,62 +12369,35 @@ int libodraw_handle_append_track(
 	}
 	internal_handle = (libodraw_internal_handle_t *) handle;
 
-	if( libodraw_track_value_initialize(
-	     &track_value,
-	     error ) != 1 )
+	if( internal_handle->sector_scan == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create track value.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing sector scan.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libodraw_track_value_set(
-	     track_value,
+	if( libodraw_sector_scan_get_anomaly(
+	     internal_handle->sector_scan,
+	     index,
 	     start_sector,
 	     number_of_sectors,
-	     type,
-	     data_file_index,
-	     data_file_start_sector,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set track value.",
-		 function );
-
-		goto on_error;
-	}
-	if( libcdata_array_append_entry(
-	     internal_handle->tracks_array,
-	     &entry_index,
-	     (intptr_t *) track_value,
+	     sector_class,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append track to array.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve anomaly: %d.",
+		 function,
+		 index );
 
-		goto on_error;
+		return( -1 );
 	}
 	return( 1 );
-
-on_error:
-	if( track_value != NULL )
-	{
-		libodraw_track_value_free(
-		 &track_value,
-		 NULL );
-	}
-	return( -1 );
 }
 
-
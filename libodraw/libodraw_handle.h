@@ -25,12 +25,20 @@
 #include <common.h>
 #include <types.h>
 
+#include "libodraw_extent.h"
 #include "libodraw_extern.h"
 #include "libodraw_io_handle.h"
+#include "libodraw_layout_arena.h"
+#include "libodraw_layout_cache.h"
 #include "libodraw_libbfio.h"
 #include "libodraw_libcdata.h"
 #include "libodraw_libcerror.h"
+#include "libodraw_open_file_budget.h"
+#include "libodraw_read_ahead.h"
 #include "libodraw_sector_range.h"
+#include "libodraw_sector_scan.h"
+#include "libodraw_shared_layout.h"
+#include "libodraw_statistics.h"
 #include "libodraw_track_value.h"
 #include "libodraw_types.h"
 
@@ -38,6 +46,11 @@
 extern "C" {
 #endif
 
+/* The number of sectors before the end of a track at which the data file
+ * of the next track is opened, which corresponds to 2 seconds of audio
+ */
+#define LIBODRAW_HANDLE_PRE_OPEN_NUMBER_OF_SECTORS	150
+
 typedef struct libodraw_internal_handle libodraw_internal_handle_t;
 
 struct libodraw_internal_handle
@@ -70,21 +83,17 @@ struct libodraw_internal_handle
 	 */
 	libcdata_array_t *data_file_descriptors_array;
 
-	/* The sessions array
-	 */
-	libcdata_array_t *sessions_array;
-
-	/* The run-outs array
+	/* The layout arena, which contains the tracks, sessions, run-outs and lead-outs
 	 */
-	libcdata_array_t *run_outs_array;
+	libodraw_layout_arena_t *layout_arena;
 
-	/* The lead-outs array
+	/* The extents array
 	 */
-	libcdata_array_t *lead_outs_array;
+	libcdata_array_t *extents_array;
 
-	/* The tracks array
+	/* The shared layout, which owns the layout once it is shared with cloned handles
 	 */
-	libcdata_array_t *tracks_array;
+	libodraw_shared_layout_t *shared_layout;
 
 	/* The basename
 	 */
@@ -98,9 +107,31 @@ struct libodraw_internal_handle
 	 */
 	int access_flags;
 
-	/* The maximum number of open handles in the pool
+	/* The open file budget, which limits the number of open data files
+	 * and can be shared with other handles
+	 */
+	libodraw_open_file_budget_t *open_file_budget;
+
+	/* The data file access counts, where 0 indicates that the data file
+	 * does not hold an open file of the budget
+	 */
+	uint64_t *data_file_access_counts;
+
+	/* The number of data file access counts
+	 */
+	int number_of_data_file_access_counts;
+
+	/* The data file access counter
+	 */
+	uint64_t data_file_access_counter;
+
+	/* Value to indicate if the layout cache should be used
 	 */
-	int maximum_number_of_open_handles;
+	uint8_t use_layout_cache;
+
+	/* The layout cache, which is only set while opening
+	 */
+	libodraw_layout_cache_t *layout_cache;
 
 	/* The IO handle
 	 */
@@ -125,6 +156,34 @@ struct libodraw_internal_handle
 	/* Value to indicate if the data file IO pool was created inside the library
 	 */
 	uint8_t data_file_io_pool_created_in_library;
+
+	/* The data file writers array, which is only used when opened for writing
+	 */
+	libcdata_array_t *data_file_writers_array;
+
+	/* Value to indicate if direct IO should be used to read and write the data files
+	 */
+	uint8_t use_direct_io;
+
+	/* The offset relative to the start of the current track, which is only used when opened for writing
+	 */
+	off64_t current_track_offset;
+
+	/* The statistics
+	 */
+	libodraw_statistics_t *statistics;
+
+	/* Value to indicate if sequential reads should be read ahead
+	 */
+	uint8_t use_read_ahead;
+
+	/* The read-ahead
+	 */
+	libodraw_read_ahead_t *read_ahead;
+
+	/* The sector scan, which is created when the first track is scanned
+	 */
+	libodraw_sector_scan_t *sector_scan;
 };
 
 LIBODRAW_EXTERN \
@@ -137,6 +196,13 @@ int libodraw_handle_free(
      libodraw_handle_t **handle,
      libcerror_error_t **error );
 
+LIBODRAW_EXTERN \
+int libodraw_handle_clone(
+     libodraw_handle_t **destination_handle,
+     libodraw_handle_t *source_handle,
+     uint8_t clone_flags,
+     libcerror_error_t **error );
+
 LIBODRAW_EXTERN \
 int libodraw_handle_signal_abort(
      libodraw_handle_t *handle,
@@ -198,6 +264,16 @@ int libodraw_handle_open_data_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libodraw_handle_create_data_file(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int libodraw_internal_handle_close_write(
+     libodraw_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
 LIBODRAW_EXTERN \
 int libodraw_handle_close(
      libodraw_handle_t *handle,
@@ -239,6 +315,65 @@ ssize_t libodraw_handle_read_buffer_from_track(
          size_t buffer_size,
          libcerror_error_t **error );
 
+int libodraw_internal_handle_resize_data_file_access_counts(
+     libodraw_internal_handle_t *internal_handle,
+     int number_of_data_files,
+     libcerror_error_t **error );
+
+int libodraw_internal_handle_acquire_data_file(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     int pinned_data_file_index,
+     libcerror_error_t **error );
+
+int libodraw_internal_handle_release_shared_layout(
+     libodraw_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libodraw_internal_handle_release_data_files(
+     libodraw_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libodraw_internal_handle_pre_open_next_track_data_file(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     libcerror_error_t **error );
+
+ssize_t libodraw_internal_handle_read_data_file_buffer_at_offset(
+         libodraw_internal_handle_t *internal_handle,
+         int data_file_index,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t data_file_offset,
+         libcerror_error_t **error );
+
+int libodraw_internal_handle_fill_read_ahead_buffer(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     off64_t data_file_offset,
+     libodraw_read_ahead_buffer_t **read_ahead_buffer,
+     libcerror_error_t **error );
+
+ssize_t libodraw_internal_handle_read_data_file_buffer_from_pool(
+         libodraw_internal_handle_t *internal_handle,
+         int data_file_index,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t data_file_offset,
+         libcerror_error_t **error );
+
+ssize_t libodraw_internal_handle_copy_sector_data_to_buffer(
+         libodraw_internal_handle_t *internal_handle,
+         const uint8_t *sector_data,
+         size_t sector_data_size,
+         uint32_t bytes_per_sector,
+         uint8_t track_type,
+         uint8_t *buffer,
+         size_t buffer_size,
+         uint32_t sector_index,
+         uint32_t sector_offset,
+         libcerror_error_t **error );
+
 LIBODRAW_EXTERN \
 ssize_t libodraw_handle_read_buffer_at_offset(
          libodraw_handle_t *handle,
@@ -247,6 +382,22 @@ ssize_t libodraw_handle_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+LIBODRAW_EXTERN \
+ssize_t libodraw_handle_read_data_file_buffer_at_offset(
+         libodraw_handle_t *handle,
+         int data_file_index,
+         void *buffer,
+         size_t buffer_size,
+         off64_t data_file_offset,
+         libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+ssize_t libodraw_handle_write_buffer(
+         libodraw_handle_t *handle,
+         const void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
 off64_t libodraw_internal_handle_seek_offset(
          libodraw_internal_handle_t *internal_handle,
          off64_t offset,
@@ -334,10 +485,108 @@ int libodraw_handle_set_maximum_number_of_open_handles(
      int maximum_number_of_open_handles,
      libcerror_error_t **error );
 
+LIBODRAW_EXTERN \
+int libodraw_handle_share_maximum_number_of_open_handles(
+     libodraw_handle_t *handle,
+     libodraw_handle_t *source_handle,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_set_use_layout_cache(
+     libodraw_handle_t *handle,
+     uint8_t use_layout_cache,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_set_use_direct_io(
+     libodraw_handle_t *handle,
+     uint8_t use_direct_io,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_set_use_read_ahead(
+     libodraw_handle_t *handle,
+     uint8_t use_read_ahead,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_set_read_ahead_window_size(
+     libodraw_handle_t *handle,
+     size_t window_size,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_set_collect_timing_statistics(
+     libodraw_handle_t *handle,
+     uint8_t collect_timing_statistics,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_get_statistics(
+     libodraw_handle_t *handle,
+     int value_type,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_get_data_file_statistics(
+     libodraw_handle_t *handle,
+     int data_file_index,
+     int value_type,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_reset_statistics(
+     libodraw_handle_t *handle,
+     libcerror_error_t **error );
+
+int libodraw_internal_handle_create_layout_cache(
+     libodraw_internal_handle_t *internal_handle,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int libodraw_handle_get_data_file_size(
+     libodraw_internal_handle_t *internal_handle,
+     int data_file_index,
+     size64_t *data_file_size,
+     libcerror_error_t **error );
+
 int libodraw_handle_set_media_values(
      libodraw_internal_handle_t *internal_handle,
      libcerror_error_t **error );
 
+int libodraw_handle_append_extent(
+     libodraw_internal_handle_t *internal_handle,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     int data_file_index,
+     off64_t data_file_offset,
+     uint32_t bytes_per_sector,
+     uint8_t track_type,
+     uint32_t flags,
+     libcerror_error_t **error );
+
+int libodraw_handle_get_sector_range_at_sector(
+     libodraw_layout_arena_t *layout_arena,
+     int region,
+     uint64_t sector,
+     libodraw_sector_range_t **sector_range,
+     uint64_t *next_start_sector,
+     libcerror_error_t **error );
+
+int libodraw_handle_set_extents_from_gap(
+     libodraw_internal_handle_t *internal_handle,
+     libodraw_track_value_t *track_value,
+     uint64_t start_sector,
+     uint64_t end_sector,
+     libcerror_error_t **error );
+
+int libodraw_handle_set_extents(
+     libodraw_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
 LIBODRAW_EXTERN \
 int libodraw_handle_get_ascii_codepage(
      libodraw_handle_t *handle,
@@ -407,6 +656,12 @@ int libodraw_handle_get_number_of_sectors(
      uint64_t *number_of_sectors,
      libcerror_error_t **error );
 
+LIBODRAW_EXTERN \
+int libodraw_handle_get_layout_memory_size(
+     libodraw_handle_t *handle,
+     size64_t *memory_size,
+     libcerror_error_t **error );
+
 LIBODRAW_EXTERN \
 int libodraw_handle_get_number_of_sessions(
      libodraw_handle_t *handle,
@@ -476,6 +731,67 @@ int libodraw_handle_append_track(
      uint64_t data_file_start_sector,
      libcerror_error_t **error );
 
+LIBODRAW_EXTERN \
+int libodraw_handle_get_number_of_extents(
+     libodraw_handle_t *handle,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_get_extent(
+     libodraw_handle_t *handle,
+     int index,
+     off64_t *offset,
+     size64_t *size,
+     int *data_file_index,
+     off64_t *data_file_offset,
+     uint32_t *bytes_per_sector,
+     uint8_t *track_type,
+     uint32_t *flags,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+ssize_t libodraw_handle_read_track_sector_payloads(
+         libodraw_handle_t *handle,
+         int track_index,
+         uint64_t sector_index,
+         uint32_t number_of_sectors,
+         uint8_t payload_mode,
+         void *buffer,
+         size_t buffer_size,
+         uint8_t *form_map,
+         size_t form_map_size,
+         libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_scan_track(
+     libodraw_handle_t *handle,
+     int track_index,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_get_number_of_scanned_sectors(
+     libodraw_handle_t *handle,
+     int track_index,
+     uint8_t sector_class,
+     uint64_t *number_of_sectors,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_get_number_of_sector_anomalies(
+     libodraw_handle_t *handle,
+     int *number_of_anomalies,
+     libcerror_error_t **error );
+
+LIBODRAW_EXTERN \
+int libodraw_handle_get_sector_anomaly(
+     libodraw_handle_t *handle,
+     int index,
+     uint64_t *start_sector,
+     uint64_t *number_of_sectors,
+     uint8_t *sector_class,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
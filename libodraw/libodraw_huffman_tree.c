@@ -0,0 +1,599 @@
+/*
+ * Huffman tree functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_bit_stream.h"
+#include "libodraw_huffman_tree.h"
+#include "libodraw_libcerror.h"
+
+/* Creates a Huffman tree
+ * Make sure the value huffman_tree is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_huffman_tree_initialize(
+     libodraw_huffman_tree_t **huffman_tree,
+     int number_of_symbols,
+     uint8_t maximum_code_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libodraw_huffman_tree_initialize";
+	size_t lookup_table_size = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *huffman_tree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Huffman tree value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The symbol is stored in the upper 11 bits of a lookup table entry
+	 */
+	if( ( number_of_symbols <= 0 )
+	 || ( number_of_symbols > 2048 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of symbols value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_code_size == 0 )
+	 || ( maximum_code_size > 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum code size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*huffman_tree = memory_allocate_structure(
+	                 libodraw_huffman_tree_t );
+
+	if( *huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *huffman_tree,
+	     0,
+	     sizeof( libodraw_huffman_tree_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Huffman tree.",
+		 function );
+
+		memory_free(
+		 *huffman_tree );
+
+		*huffman_tree = NULL;
+
+		return( -1 );
+	}
+	( *huffman_tree )->code_sizes = (uint8_t *) memory_allocate(
+	                                             sizeof( uint8_t ) * number_of_symbols );
+
+	if( ( *huffman_tree )->code_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create code sizes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *huffman_tree )->code_sizes,
+	     0,
+	     sizeof( uint8_t ) * number_of_symbols ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear code sizes.",
+		 function );
+
+		goto on_error;
+	}
+	lookup_table_size = (size_t) 1 << maximum_code_size;
+
+	( *huffman_tree )->lookup_table = (uint16_t *) memory_allocate(
+	                                                sizeof( uint16_t ) * lookup_table_size );
+
+	if( ( *huffman_tree )->lookup_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create lookup table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *huffman_tree )->lookup_table,
+	     0,
+	     sizeof( uint16_t ) * lookup_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup table.",
+		 function );
+
+		goto on_error;
+	}
+	( *huffman_tree )->number_of_symbols = number_of_symbols;
+	( *huffman_tree )->maximum_code_size = maximum_code_size;
+
+	return( 1 );
+
+on_error:
+	if( *huffman_tree != NULL )
+	{
+		if( ( *huffman_tree )->lookup_table != NULL )
+		{
+			memory_free(
+			 ( *huffman_tree )->lookup_table );
+		}
+		if( ( *huffman_tree )->code_sizes != NULL )
+		{
+			memory_free(
+			 ( *huffman_tree )->code_sizes );
+		}
+		memory_free(
+		 *huffman_tree );
+
+		*huffman_tree = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a Huffman tree
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_huffman_tree_free(
+     libodraw_huffman_tree_t **huffman_tree,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_huffman_tree_free";
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *huffman_tree != NULL )
+	{
+		memory_free(
+		 ( *huffman_tree )->lookup_table );
+
+		memory_free(
+		 ( *huffman_tree )->code_sizes );
+
+		memory_free(
+		 *huffman_tree );
+
+		*huffman_tree = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the run-length encoded code sizes from the bit stream
+ * A code size of 1 is an escape: it is followed by either another 1,
+ * which is a literal code size of 1, or a code size and a repeat count minus 3
+ * Returns 1 on success or -1 on error
+ */
+int libodraw_huffman_tree_read_code_sizes(
+     libodraw_huffman_tree_t *huffman_tree,
+     libodraw_bit_stream_t *bit_stream,
+     libcerror_error_t **error )
+{
+	static char *function  = "libodraw_huffman_tree_read_code_sizes";
+	uint32_t code_size     = 0;
+	uint32_t repeat_count  = 0;
+	int symbol             = 0;
+	uint8_t number_of_bits = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of bits per code size depends on the maximum code size
+	 */
+	if( huffman_tree->maximum_code_size >= 16 )
+	{
+		number_of_bits = 5;
+	}
+	else if( huffman_tree->maximum_code_size >= 8 )
+	{
+		number_of_bits = 4;
+	}
+	else
+	{
+		number_of_bits = 3;
+	}
+	while( symbol < huffman_tree->number_of_symbols )
+	{
+		if( libodraw_bit_stream_get_value(
+		     bit_stream,
+		     number_of_bits,
+		     &code_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve code size from bit stream.",
+			 function );
+
+			return( -1 );
+		}
+		repeat_count = 1;
+
+		if( code_size == 1 )
+		{
+			if( libodraw_bit_stream_get_value(
+			     bit_stream,
+			     number_of_bits,
+			     &code_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve code size from bit stream.",
+				 function );
+
+				return( -1 );
+			}
+			if( code_size != 1 )
+			{
+				if( libodraw_bit_stream_get_value(
+				     bit_stream,
+				     number_of_bits,
+				     &repeat_count,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve repeat count from bit stream.",
+					 function );
+
+					return( -1 );
+				}
+				repeat_count += 3;
+			}
+		}
+		if( code_size > huffman_tree->maximum_code_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid code size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( repeat_count > (uint32_t) ( huffman_tree->number_of_symbols - symbol ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid repeat count value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		while( repeat_count > 0 )
+		{
+			huffman_tree->code_sizes[ symbol++ ] = (uint8_t) code_size;
+
+			repeat_count--;
+		}
+	}
+	return( 1 );
+}
+
+/* Builds the Huffman tree from the code sizes
+ * The codes are assigned canonically, where longer codes get the lower code values
+ * Returns 1 on success or -1 on error
+ */
+int libodraw_huffman_tree_build(
+     libodraw_huffman_tree_t *huffman_tree,
+     libcerror_error_t **error )
+{
+	uint32_t code_size_counts[ 17 ];
+
+	static char *function = "libodraw_huffman_tree_build";
+	uint32_t code         = 0;
+	uint32_t lookup_end   = 0;
+	uint32_t lookup_index = 0;
+	uint32_t next_code    = 0;
+	uint16_t lookup_value = 0;
+	uint8_t code_size     = 0;
+	uint8_t shift         = 0;
+	int symbol            = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     code_size_counts,
+	     0,
+	     sizeof( uint32_t ) * 17 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear code size counts.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < huffman_tree->number_of_symbols;
+	     symbol++ )
+	{
+		code_size = huffman_tree->code_sizes[ symbol ];
+
+		if( code_size > huffman_tree->maximum_code_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid symbol: %d code size value out of bounds.",
+			 function,
+			 symbol );
+
+			return( -1 );
+		}
+		code_size_counts[ code_size ] += 1;
+	}
+	/* Determine the first code of every code size, starting with the longest codes
+	 */
+	code = 0;
+
+	for( code_size = 16;
+	     code_size > 0;
+	     code_size-- )
+	{
+		next_code = ( code + code_size_counts[ code_size ] ) >> 1;
+
+		if( ( code_size != 1 )
+		 && ( ( next_code * 2 ) != ( code + code_size_counts[ code_size ] ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid code sizes - inconsistent number of codes of size: %" PRIu8 ".",
+			 function,
+			 code_size );
+
+			return( -1 );
+		}
+		code_size_counts[ code_size ] = code;
+
+		code = next_code;
+	}
+	if( memory_set(
+	     huffman_tree->lookup_table,
+	     0,
+	     sizeof( uint16_t ) * ( (size_t) 1 << huffman_tree->maximum_code_size ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup table.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < huffman_tree->number_of_symbols;
+	     symbol++ )
+	{
+		code_size = huffman_tree->code_sizes[ symbol ];
+
+		if( code_size == 0 )
+		{
+			continue;
+		}
+		code = code_size_counts[ code_size ];
+
+		code_size_counts[ code_size ] += 1;
+
+		shift        = huffman_tree->maximum_code_size - code_size;
+		lookup_index = code << shift;
+		lookup_end   = ( code + 1 ) << shift;
+		lookup_value = (uint16_t) ( ( symbol << 5 ) | code_size );
+
+		if( lookup_end > ( (uint32_t) 1UL << huffman_tree->maximum_code_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid symbol: %d code value out of bounds.",
+			 function,
+			 symbol );
+
+			return( -1 );
+		}
+		while( lookup_index < lookup_end )
+		{
+			huffman_tree->lookup_table[ lookup_index++ ] = lookup_value;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves a symbol based on the Huffman code read from the bit stream
+ * Returns 1 on success or -1 on error
+ */
+int libodraw_huffman_tree_get_symbol_from_bit_stream(
+     libodraw_huffman_tree_t *huffman_tree,
+     libodraw_bit_stream_t *bit_stream,
+     uint16_t *symbol,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_huffman_tree_get_symbol_from_bit_stream";
+	uint32_t value_32bit  = 0;
+	uint16_t lookup_value = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( symbol == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_bit_stream_peek_value(
+	     bit_stream,
+	     huffman_tree->maximum_code_size,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	lookup_value = huffman_tree->lookup_table[ value_32bit ];
+
+	if( ( lookup_value & 0x1f ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid Huffman code.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_bit_stream_skip_bits(
+	     bit_stream,
+	     (uint8_t) ( lookup_value & 0x1f ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to skip bits in bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	*symbol = lookup_value >> 5;
+
+	return( 1 );
+}
+
@@ -0,0 +1,87 @@
+/*
+ * Huffman tree functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_HUFFMAN_TREE_H )
+#define _LIBODRAW_HUFFMAN_TREE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_bit_stream.h"
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libodraw_huffman_tree libodraw_huffman_tree_t;
+
+struct libodraw_huffman_tree
+{
+	/* The number of symbols
+	 */
+	int number_of_symbols;
+
+	/* The maximum code size
+	 */
+	uint8_t maximum_code_size;
+
+	/* The code sizes per symbol
+	 */
+	uint8_t *code_sizes;
+
+	/* The lookup table, which maps the next maximum code size bits
+	 * of the bit stream to the symbol and its code size
+	 */
+	uint16_t *lookup_table;
+};
+
+int libodraw_huffman_tree_initialize(
+     libodraw_huffman_tree_t **huffman_tree,
+     int number_of_symbols,
+     uint8_t maximum_code_size,
+     libcerror_error_t **error );
+
+int libodraw_huffman_tree_free(
+     libodraw_huffman_tree_t **huffman_tree,
+     libcerror_error_t **error );
+
+int libodraw_huffman_tree_read_code_sizes(
+     libodraw_huffman_tree_t *huffman_tree,
+     libodraw_bit_stream_t *bit_stream,
+     libcerror_error_t **error );
+
+int libodraw_huffman_tree_build(
+     libodraw_huffman_tree_t *huffman_tree,
+     libcerror_error_t **error );
+
+int libodraw_huffman_tree_get_symbol_from_bit_stream(
+     libodraw_huffman_tree_t *huffman_tree,
+     libodraw_bit_stream_t *bit_stream,
+     uint16_t *symbol,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_HUFFMAN_TREE_H ) */
+
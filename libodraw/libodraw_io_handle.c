@@ -759,3 +759,295 @@ ssize_t libodraw_io_handle_copy_sector_data_to_buffer(
 	return( (ssize_t) buffer_offset );
 }
 
+/* Copies the payloads of (raw) sectors to the buffer
+ * The payload mode determines the payload copied per sector:
+ * LIBODRAW_SECTOR_PAYLOAD_MODE_FORM1 copies 2048 bytes, LIBODRAW_SECTOR_PAYLOAD_MODE_FORM2
+ * copies 2324 bytes and LIBODRAW_SECTOR_PAYLOAD_MODE_MIXED copies 2048 or 2324 bytes
+ * depending on the form indicated by the XA sub-header of the sector
+ * If provided the form map receives the sector class of every sector
+ * Returns the number of bytes copied or -1 on error
+ */
+ssize_t libodraw_io_handle_copy_sector_payloads_to_buffer(
+         libodraw_io_handle_t *io_handle,
+         const uint8_t *sector_data,
+         size_t sector_data_size,
+         uint32_t bytes_per_sector,
+         uint8_t track_type,
+         uint8_t payload_mode,
+         uint8_t *buffer,
+         size_t buffer_size,
+         uint8_t *form_map,
+         size_t form_map_size,
+         libcerror_error_t **error )
+{
+	static char *function           = "libodraw_io_handle_copy_sector_payloads_to_buffer";
+	size_t buffer_offset            = 0;
+	size_t maximum_payload_size     = 0;
+	size_t number_of_sectors        = 0;
+	size_t payload_offset           = 0;
+	size_t payload_size             = 0;
+	size_t sector_data_offset       = 0;
+	size_t sector_index             = 0;
+	size_t sub_header_offset        = 0;
+	uint32_t track_bytes_per_sector = 0;
+	uint8_t has_sub_header          = 0;
+	uint8_t sector_class            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	switch( track_type )
+	{
+		case LIBODRAW_TRACK_TYPE_MODE1_2048:
+		case LIBODRAW_TRACK_TYPE_MODE2_2048:
+			track_bytes_per_sector = 2048;
+			payload_offset         = 0;
+			break;
+
+		case LIBODRAW_TRACK_TYPE_MODE1_2352:
+			track_bytes_per_sector = 2352;
+			payload_offset         = 16;
+			break;
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2324:
+			track_bytes_per_sector = 2324;
+			payload_offset         = 0;
+			break;
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2336:
+		case LIBODRAW_TRACK_TYPE_CDI_2336:
+			track_bytes_per_sector = 2336;
+			sub_header_offset      = 0;
+			payload_offset         = 8;
+			has_sub_header         = 1;
+			break;
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2352:
+		case LIBODRAW_TRACK_TYPE_CDI_2352:
+			track_bytes_per_sector = 2352;
+			sub_header_offset      = 16;
+			payload_offset         = 24;
+			has_sub_header         = 1;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported track type: %" PRIu8 ".",
+			 function,
+			 track_type );
+
+			return( -1 );
+	}
+	if( bytes_per_sector != track_bytes_per_sector )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bytes per sector: %" PRIu32 " for track type.",
+		 function,
+		 bytes_per_sector );
+
+		return( -1 );
+	}
+	if( ( sector_data_size % bytes_per_sector ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Form 1 payloads cannot be read from sectors stored without their form 1
+	 * user data area and form 2 payloads require the 2324 bytes of a mode 2 sector
+	 */
+	switch( payload_mode )
+	{
+		case LIBODRAW_SECTOR_PAYLOAD_MODE_FORM1:
+			if( track_type == LIBODRAW_TRACK_TYPE_MODE2_2324 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported payload mode for track type.",
+				 function );
+
+				return( -1 );
+			}
+			maximum_payload_size = 2048;
+			break;
+
+		case LIBODRAW_SECTOR_PAYLOAD_MODE_FORM2:
+			if( ( has_sub_header == 0 )
+			 && ( track_type != LIBODRAW_TRACK_TYPE_MODE2_2324 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported payload mode for track type.",
+				 function );
+
+				return( -1 );
+			}
+			maximum_payload_size = 2324;
+			break;
+
+		case LIBODRAW_SECTOR_PAYLOAD_MODE_MIXED:
+			maximum_payload_size = 2324;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported payload mode: %" PRIu8 ".",
+			 function,
+			 payload_mode );
+
+			return( -1 );
+	}
+	number_of_sectors = sector_data_size / bytes_per_sector;
+
+	if( number_of_sectors > ( buffer_size / maximum_payload_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid buffer size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( form_map != NULL )
+	 && ( number_of_sectors > form_map_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid form map size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( sector_index = 0;
+	     sector_index < number_of_sectors;
+	     sector_index++ )
+	{
+		if( has_sub_header != 0 )
+		{
+			/* The sub-mode of the XA sub-header indicates form 2 with 0x20
+			 */
+			if( ( sector_data[ sector_data_offset + sub_header_offset + 2 ] & 0x20 ) != 0 )
+			{
+				sector_class = LIBODRAW_SECTOR_CLASS_MODE2_FORM2;
+			}
+			else
+			{
+				sector_class = LIBODRAW_SECTOR_CLASS_MODE2_FORM1;
+			}
+		}
+		else if( track_type == LIBODRAW_TRACK_TYPE_MODE2_2324 )
+		{
+			sector_class = LIBODRAW_SECTOR_CLASS_MODE2_FORM2;
+		}
+		else if( track_type == LIBODRAW_TRACK_TYPE_MODE2_2048 )
+		{
+			sector_class = LIBODRAW_SECTOR_CLASS_MODE2_FORM1;
+		}
+		else
+		{
+			sector_class = LIBODRAW_SECTOR_CLASS_MODE1;
+		}
+		if( payload_mode == LIBODRAW_SECTOR_PAYLOAD_MODE_FORM1 )
+		{
+			payload_size = 2048;
+		}
+		else if( payload_mode == LIBODRAW_SECTOR_PAYLOAD_MODE_FORM2 )
+		{
+			payload_size = 2324;
+		}
+		else if( sector_class == LIBODRAW_SECTOR_CLASS_MODE2_FORM2 )
+		{
+			payload_size = 2324;
+		}
+		else
+		{
+			payload_size = 2048;
+		}
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     &( sector_data[ sector_data_offset + payload_offset ] ),
+		     payload_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sector: %" PRIzd " payload to buffer.",
+			 function,
+			 sector_index );
+
+			return( -1 );
+		}
+		if( form_map != NULL )
+		{
+			form_map[ sector_index ] = sector_class;
+		}
+		buffer_offset      += payload_size;
+		sector_data_offset += bytes_per_sector;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
@@ -76,6 +76,19 @@ ssize_t libodraw_io_handle_copy_sector_data_to_buffer(
          uint32_t sector_offset,
          libcerror_error_t **error );
 
+ssize_t libodraw_io_handle_copy_sector_payloads_to_buffer(
+         libodraw_io_handle_t *io_handle,
+         const uint8_t *sector_data,
+         size_t sector_data_size,
+         uint32_t bytes_per_sector,
+         uint8_t track_type,
+         uint8_t payload_mode,
+         uint8_t *buffer,
+         size_t buffer_size,
+         uint8_t *form_map,
+         size_t form_map_size,
+         libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,877 @@
+/*
+ * Layout arena functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_layout_arena.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_sector_range.h"
+#include "libodraw_track_value.h"
+
+/* The size of the records per region
+ */
+static const size_t libodraw_layout_arena_record_sizes[ LIBODRAW_LAYOUT_ARENA_NUMBER_OF_REGIONS ] = {
+	sizeof( libodraw_track_value_t ),
+	sizeof( libodraw_sector_range_t ),
+	sizeof( libodraw_sector_range_t ),
+	sizeof( libodraw_sector_range_t ) };
+
+/* Creates a layout arena
+ * Make sure the value layout_arena is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_layout_arena_initialize(
+     libodraw_layout_arena_t **layout_arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_layout_arena_initialize";
+
+	if( layout_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *layout_arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid layout arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*layout_arena = memory_allocate_structure(
+	                 libodraw_layout_arena_t );
+
+	if( *layout_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create layout arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *layout_arena,
+	     0,
+	     sizeof( libodraw_layout_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear layout arena.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *layout_arena != NULL )
+	{
+		memory_free(
+		 *layout_arena );
+
+		*layout_arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a layout arena
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_layout_arena_free(
+     libodraw_layout_arena_t **layout_arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_layout_arena_free";
+
+	if( layout_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *layout_arena != NULL )
+	{
+		if( ( *layout_arena )->data != NULL )
+		{
+			memory_free(
+			 ( *layout_arena )->data );
+		}
+		memory_free(
+		 *layout_arena );
+
+		*layout_arena = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties a layout arena
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_layout_arena_empty(
+     libodraw_layout_arena_t *layout_arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_layout_arena_empty";
+
+	if( layout_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( layout_arena->data != NULL )
+	{
+		memory_free(
+		 layout_arena->data );
+	}
+	if( memory_set(
+	     layout_arena,
+	     0,
+	     sizeof( libodraw_layout_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear layout arena.",
+		 function );
+
+		layout_arena->data = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Resizes a region of the layout arena
+ * The records are copied into a new allocation that holds all the regions
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_layout_arena_resize_region(
+     libodraw_layout_arena_t *layout_arena,
+     int region,
+     int maximum_number_of_records,
+     libcerror_error_t **error )
+{
+	int maximum_number_of_region_records[ LIBODRAW_LAYOUT_ARENA_NUMBER_OF_REGIONS ];
+
+	uint8_t *data             = NULL;
+	static char *function     = "libodraw_layout_arena_resize_region";
+	size_t data_offset        = 0;
+	size_t data_size          = 0;
+	size_t region_data_offset = 0;
+	size_t region_data_size   = 0;
+	int region_index          = 0;
+
+	if( layout_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( region < 0 )
+	 || ( region >= LIBODRAW_LAYOUT_ARENA_NUMBER_OF_REGIONS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported region.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_records < layout_arena->number_of_records[ region ] )
+	 || ( (size_t) maximum_number_of_records > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / LIBODRAW_LAYOUT_ARENA_NUMBER_OF_REGIONS / libodraw_layout_arena_record_sizes[ region ] ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( region_index = 0;
+	     region_index < LIBODRAW_LAYOUT_ARENA_NUMBER_OF_REGIONS;
+	     region_index++ )
+	{
+		if( region_index == region )
+		{
+			maximum_number_of_region_records[ region_index ] = maximum_number_of_records;
+		}
+		else
+		{
+			maximum_number_of_region_records[ region_index ] = layout_arena->maximum_number_of_records[ region_index ];
+		}
+		data_size += (size_t) maximum_number_of_region_records[ region_index ] * libodraw_layout_arena_record_sizes[ region_index ];
+	}
+	if( data_size > 0 )
+	{
+		data = (uint8_t *) memory_allocate(
+		                    sizeof( uint8_t ) * data_size );
+
+		if( data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data.",
+			 function );
+
+			return( -1 );
+		}
+		for( region_index = 0;
+		     region_index < LIBODRAW_LAYOUT_ARENA_NUMBER_OF_REGIONS;
+		     region_index++ )
+		{
+			region_data_size = (size_t) layout_arena->number_of_records[ region_index ] * libodraw_layout_arena_record_sizes[ region_index ];
+
+			if( region_data_size > 0 )
+			{
+				if( memory_copy(
+				     &( data[ data_offset ] ),
+				     &( layout_arena->data[ region_data_offset ] ),
+				     region_data_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy region: %d data.",
+					 function,
+					 region_index );
+
+					memory_free(
+					 data );
+
+					return( -1 );
+				}
+			}
+			data_offset        += (size_t) maximum_number_of_region_records[ region_index ] * libodraw_layout_arena_record_sizes[ region_index ];
+			region_data_offset += (size_t) layout_arena->maximum_number_of_records[ region_index ] * libodraw_layout_arena_record_sizes[ region_index ];
+		}
+	}
+	if( layout_arena->data != NULL )
+	{
+		memory_free(
+		 layout_arena->data );
+	}
+	layout_arena->data                                = data;
+	layout_arena->data_size                           = data_size;
+	layout_arena->maximum_number_of_records[ region ] = maximum_number_of_records;
+
+	return( 1 );
+}
+
+/* Compacts the layout arena so that its allocation only contains the records
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_layout_arena_compact(
+     libodraw_layout_arena_t *layout_arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_layout_arena_compact";
+	int region            = 0;
+
+	if( layout_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout arena.",
+		 function );
+
+		return( -1 );
+	}
+	for( region = 0;
+	     region < LIBODRAW_LAYOUT_ARENA_NUMBER_OF_REGIONS;
+	     region++ )
+	{
+		if( layout_arena->maximum_number_of_records[ region ] == layout_arena->number_of_records[ region ] )
+		{
+			continue;
+		}
+		if( libodraw_layout_arena_resize_region(
+		     layout_arena,
+		     region,
+		     layout_arena->number_of_records[ region ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize region: %d.",
+			 function,
+			 region );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the memory size of the layout arena
+ * The memory size includes the layout arena itself and its allocated data
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_layout_arena_get_memory_size(
+     libodraw_layout_arena_t *layout_arena,
+     size_t *memory_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_layout_arena_get_memory_size";
+
+	if( layout_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory size.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_size = sizeof( libodraw_layout_arena_t ) + layout_arena->data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of records in a region
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_layout_arena_get_number_of_records(
+     libodraw_layout_arena_t *layout_arena,
+     int region,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_layout_arena_get_number_of_records";
+
+	if( layout_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( region < 0 )
+	 || ( region >= LIBODRAW_LAYOUT_ARENA_NUMBER_OF_REGIONS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported region.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_records = layout_arena->number_of_records[ region ];
+
+	return( 1 );
+}
+
+/* Retrieves a specific record of a region
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_layout_arena_get_record_by_index(
+     libodraw_layout_arena_t *layout_arena,
+     int region,
+     int record_index,
+     uint8_t **record,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_layout_arena_get_record_by_index";
+	size_t data_offset    = 0;
+	int region_index      = 0;
+
+	if( layout_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( region < 0 )
+	 || ( region >= LIBODRAW_LAYOUT_ARENA_NUMBER_OF_REGIONS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported region.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_index < 0 )
+	 || ( record_index >= layout_arena->number_of_records[ region ] ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	for( region_index = 0;
+	     region_index < region;
+	     region_index++ )
+	{
+		data_offset += (size_t) layout_arena->maximum_number_of_records[ region_index ] * libodraw_layout_arena_record_sizes[ region_index ];
+	}
+	data_offset += (size_t) record_index * libodraw_layout_arena_record_sizes[ region ];
+
+	*record = &( layout_arena->data[ data_offset ] );
+
+	return( 1 );
+}
+
+/* Appends a record to a region
+ * The record is cleared and its pointer remains valid until the next append, compact or empty
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_layout_arena_append_record(
+     libodraw_layout_arena_t *layout_arena,
+     int region,
+     int *record_index,
+     uint8_t **record,
+     libcerror_error_t **error )
+{
+	uint8_t *safe_record          = NULL;
+	static char *function         = "libodraw_layout_arena_append_record";
+	int maximum_number_of_records = 0;
+	int safe_record_index         = 0;
+
+	if( layout_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( region < 0 )
+	 || ( region >= LIBODRAW_LAYOUT_ARENA_NUMBER_OF_REGIONS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported region.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( layout_arena->number_of_records[ region ] >= layout_arena->maximum_number_of_records[ region ] )
+	{
+		if( layout_arena->maximum_number_of_records[ region ] == 0 )
+		{
+			maximum_number_of_records = 4;
+		}
+		else
+		{
+			maximum_number_of_records = layout_arena->maximum_number_of_records[ region ] * 2;
+		}
+		if( libodraw_layout_arena_resize_region(
+		     layout_arena,
+		     region,
+		     maximum_number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize region: %d.",
+			 function,
+			 region );
+
+			return( -1 );
+		}
+	}
+	safe_record_index = layout_arena->number_of_records[ region ];
+
+	layout_arena->number_of_records[ region ] += 1;
+
+	if( libodraw_layout_arena_get_record_by_index(
+	     layout_arena,
+	     region,
+	     safe_record_index,
+	     &safe_record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve region: %d record: %d.",
+		 function,
+		 region,
+		 safe_record_index );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_record,
+	     0,
+	     libodraw_layout_arena_record_sizes[ region ] ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record.",
+		 function );
+
+		goto on_error;
+	}
+	*record_index = safe_record_index;
+	*record       = safe_record;
+
+	return( 1 );
+
+on_error:
+	layout_arena->number_of_records[ region ] -= 1;
+
+	return( -1 );
+}
+
+/* Retrieves the number of tracks
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_layout_arena_get_number_of_tracks(
+     libodraw_layout_arena_t *layout_arena,
+     int *number_of_tracks,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_layout_arena_get_number_of_tracks";
+
+	if( libodraw_layout_arena_get_number_of_records(
+	     layout_arena,
+	     LIBODRAW_LAYOUT_ARENA_REGION_TRACKS,
+	     number_of_tracks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tracks.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific track
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_layout_arena_get_track_by_index(
+     libodraw_layout_arena_t *layout_arena,
+     int track_index,
+     libodraw_track_value_t **track_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_layout_arena_get_track_by_index";
+
+	if( libodraw_layout_arena_get_record_by_index(
+	     layout_arena,
+	     LIBODRAW_LAYOUT_ARENA_REGION_TRACKS,
+	     track_index,
+	     (uint8_t **) track_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve track: %d.",
+		 function,
+		 track_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a track
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_layout_arena_append_track(
+     libodraw_layout_arena_t *layout_arena,
+     int *track_index,
+     libodraw_track_value_t **track_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_layout_arena_append_track";
+
+	if( libodraw_layout_arena_append_record(
+	     layout_arena,
+	     LIBODRAW_LAYOUT_ARENA_REGION_TRACKS,
+	     track_index,
+	     (uint8_t **) track_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append track.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of sector ranges in a region
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_layout_arena_get_number_of_sector_ranges(
+     libodraw_layout_arena_t *layout_arena,
+     int region,
+     int *number_of_sector_ranges,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_layout_arena_get_number_of_sector_ranges";
+
+	if( region == LIBODRAW_LAYOUT_ARENA_REGION_TRACKS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported region.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_layout_arena_get_number_of_records(
+	     layout_arena,
+	     region,
+	     number_of_sector_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sector ranges.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific sector range of a region
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_layout_arena_get_sector_range_by_index(
+     libodraw_layout_arena_t *layout_arena,
+     int region,
+     int sector_range_index,
+     libodraw_sector_range_t **sector_range,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_layout_arena_get_sector_range_by_index";
+
+	if( region == LIBODRAW_LAYOUT_ARENA_REGION_TRACKS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported region.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_layout_arena_get_record_by_index(
+	     layout_arena,
+	     region,
+	     sector_range_index,
+	     (uint8_t **) sector_range,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sector range: %d.",
+		 function,
+		 sector_range_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a sector range to a region
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_layout_arena_append_sector_range(
+     libodraw_layout_arena_t *layout_arena,
+     int region,
+     int *sector_range_index,
+     libodraw_sector_range_t **sector_range,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_layout_arena_append_sector_range";
+
+	if( region == LIBODRAW_LAYOUT_ARENA_REGION_TRACKS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported region.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_layout_arena_append_record(
+	     layout_arena,
+	     region,
+	     sector_range_index,
+	     (uint8_t **) sector_range,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append sector range.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
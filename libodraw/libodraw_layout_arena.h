@@ -0,0 +1,162 @@
+/*
+ * Layout arena functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_LAYOUT_ARENA_H )
+#define _LIBODRAW_LAYOUT_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+#include "libodraw_sector_range.h"
+#include "libodraw_track_value.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The layout arena regions
+ */
+enum LIBODRAW_LAYOUT_ARENA_REGIONS
+{
+	LIBODRAW_LAYOUT_ARENA_REGION_TRACKS		= 0,
+	LIBODRAW_LAYOUT_ARENA_REGION_SESSIONS		= 1,
+	LIBODRAW_LAYOUT_ARENA_REGION_RUN_OUTS		= 2,
+	LIBODRAW_LAYOUT_ARENA_REGION_LEAD_OUTS		= 3
+};
+
+#define LIBODRAW_LAYOUT_ARENA_NUMBER_OF_REGIONS		4
+
+typedef struct libodraw_layout_arena libodraw_layout_arena_t;
+
+/* The layout arena stores the tracks and the session, run-out and lead-out
+ * sector ranges as consecutive regions of records in a single allocation
+ * Record pointers remain valid until the next append, compact or empty
+ */
+struct libodraw_layout_arena
+{
+	/* The data, which contains the regions in the order of their type
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The number of records per region
+	 */
+	int number_of_records[ LIBODRAW_LAYOUT_ARENA_NUMBER_OF_REGIONS ];
+
+	/* The maximum number of records per region
+	 */
+	int maximum_number_of_records[ LIBODRAW_LAYOUT_ARENA_NUMBER_OF_REGIONS ];
+};
+
+int libodraw_layout_arena_initialize(
+     libodraw_layout_arena_t **layout_arena,
+     libcerror_error_t **error );
+
+int libodraw_layout_arena_free(
+     libodraw_layout_arena_t **layout_arena,
+     libcerror_error_t **error );
+
+int libodraw_layout_arena_empty(
+     libodraw_layout_arena_t *layout_arena,
+     libcerror_error_t **error );
+
+int libodraw_layout_arena_resize_region(
+     libodraw_layout_arena_t *layout_arena,
+     int region,
+     int maximum_number_of_records,
+     libcerror_error_t **error );
+
+int libodraw_layout_arena_compact(
+     libodraw_layout_arena_t *layout_arena,
+     libcerror_error_t **error );
+
+int libodraw_layout_arena_get_memory_size(
+     libodraw_layout_arena_t *layout_arena,
+     size_t *memory_size,
+     libcerror_error_t **error );
+
+int libodraw_layout_arena_get_number_of_records(
+     libodraw_layout_arena_t *layout_arena,
+     int region,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+int libodraw_layout_arena_get_record_by_index(
+     libodraw_layout_arena_t *layout_arena,
+     int region,
+     int record_index,
+     uint8_t **record,
+     libcerror_error_t **error );
+
+int libodraw_layout_arena_append_record(
+     libodraw_layout_arena_t *layout_arena,
+     int region,
+     int *record_index,
+     uint8_t **record,
+     libcerror_error_t **error );
+
+int libodraw_layout_arena_get_number_of_tracks(
+     libodraw_layout_arena_t *layout_arena,
+     int *number_of_tracks,
+     libcerror_error_t **error );
+
+int libodraw_layout_arena_get_track_by_index(
+     libodraw_layout_arena_t *layout_arena,
+     int track_index,
+     libodraw_track_value_t **track_value,
+     libcerror_error_t **error );
+
+int libodraw_layout_arena_append_track(
+     libodraw_layout_arena_t *layout_arena,
+     int *track_index,
+     libodraw_track_value_t **track_value,
+     libcerror_error_t **error );
+
+int libodraw_layout_arena_get_number_of_sector_ranges(
+     libodraw_layout_arena_t *layout_arena,
+     int region,
+     int *number_of_sector_ranges,
+     libcerror_error_t **error );
+
+int libodraw_layout_arena_get_sector_range_by_index(
+     libodraw_layout_arena_t *layout_arena,
+     int region,
+     int sector_range_index,
+     libodraw_sector_range_t **sector_range,
+     libcerror_error_t **error );
+
+int libodraw_layout_arena_append_sector_range(
+     libodraw_layout_arena_t *layout_arena,
+     int region,
+     int *sector_range_index,
+     libodraw_sector_range_t **sector_range,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_LAYOUT_ARENA_H ) */
+
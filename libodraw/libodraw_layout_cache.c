@@ -0,0 +1,1686 @@
+/*
+ * Layout cache functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#include "libodraw_data_file_descriptor.h"
+#include "libodraw_layout_arena.h"
+#include "libodraw_layout_cache.h"
+#include "libodraw_libbfio.h"
+#include "libodraw_libcdata.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_libcnotify.h"
+#include "libodraw_sector_range.h"
+#include "libodraw_track_value.h"
+
+#include "odraw_layout_cache.h"
+
+const uint8_t odraw_layout_cache_signature[ 8 ] = {
+	'O', 'D', 'R', 'A', 'W', 'L', 'C', 0 };
+
+/* Creates a layout cache
+ * Make sure the value layout_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_layout_cache_initialize(
+     libodraw_layout_cache_t **layout_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_layout_cache_initialize";
+
+	if( layout_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *layout_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid layout cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*layout_cache = memory_allocate_structure(
+	                 libodraw_layout_cache_t );
+
+	if( *layout_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create layout cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *layout_cache,
+	     0,
+	     sizeof( libodraw_layout_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear layout cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *layout_cache != NULL )
+	{
+		memory_free(
+		 *layout_cache );
+
+		*layout_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a layout cache
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_layout_cache_free(
+     libodraw_layout_cache_t **layout_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_layout_cache_free";
+
+	if( layout_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *layout_cache != NULL )
+	{
+		if( ( *layout_cache )->filename != NULL )
+		{
+			memory_free(
+			 ( *layout_cache )->filename );
+		}
+		memory_free(
+		 *layout_cache );
+
+		*layout_cache = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the table of contents (TOC) filename
+ * This determines the size and modification time of the TOC file and
+ * derives the layout cache filename by appending ".odrawcache"
+ * Returns 1 if successful, 0 if the size and modification time are not available or -1 on error
+ */
+int libodraw_layout_cache_set_toc_filename(
+     libodraw_layout_cache_t *layout_cache,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	WIN32_FILE_ATTRIBUTE_DATA file_attribute_data;
+
+#elif defined( HAVE_STATX ) && defined( STATX_MTIME ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	struct statx file_statistics;
+
+#elif defined( HAVE_STAT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	struct stat file_statistics;
+#endif
+
+	const system_character_t *extension = _SYSTEM_STRING( ".odrawcache" );
+	static char *function               = "libodraw_layout_cache_set_toc_filename";
+	size_t extension_length             = 11;
+	int result                          = 0;
+
+	if( layout_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( layout_cache->filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid layout cache - filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - ( extension_length + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( GetFileAttributesExW(
+	     (LPCWSTR) filename,
+	     GetFileExInfoStandard,
+	     (LPVOID) &file_attribute_data ) != 0 )
+#else
+	if( GetFileAttributesExA(
+	     (LPCSTR) filename,
+	     GetFileExInfoStandard,
+	     (LPVOID) &file_attribute_data ) != 0 )
+#endif
+	{
+		if( ( file_attribute_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) == 0 )
+		{
+			layout_cache->toc_file_size = ( (size64_t) file_attribute_data.nFileSizeHigh << 32 )
+			                            | file_attribute_data.nFileSizeLow;
+
+			layout_cache->toc_file_modification_time = ( (uint64_t) file_attribute_data.ftLastWriteTime.dwHighDateTime << 32 )
+			                                         | file_attribute_data.ftLastWriteTime.dwLowDateTime;
+
+			result = 1;
+		}
+	}
+#elif defined( HAVE_STATX ) && defined( STATX_MTIME ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( statx(
+	     AT_FDCWD,
+	     filename,
+	     0,
+	     STATX_TYPE | STATX_SIZE | STATX_MTIME,
+	     &file_statistics ) == 0 )
+	{
+		if( ( ( file_statistics.stx_mask & ( STATX_TYPE | STATX_SIZE | STATX_MTIME ) ) == ( STATX_TYPE | STATX_SIZE | STATX_MTIME ) )
+		 && S_ISREG( file_statistics.stx_mode ) )
+		{
+			layout_cache->toc_file_size = (size64_t) file_statistics.stx_size;
+
+			layout_cache->toc_file_modification_time = ( (uint64_t) file_statistics.stx_mtime.tv_sec * 1000000000 )
+			                                         + file_statistics.stx_mtime.tv_nsec;
+
+			result = 1;
+		}
+	}
+#elif defined( HAVE_STAT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( stat(
+	     filename,
+	     &file_statistics ) == 0 )
+	{
+		if( S_ISREG( file_statistics.st_mode ) )
+		{
+			layout_cache->toc_file_size              = (size64_t) file_statistics.st_size;
+			layout_cache->toc_file_modification_time = (uint64_t) file_statistics.st_mtime;
+
+			result = 1;
+		}
+	}
+#endif
+	if( result != 1 )
+	{
+		return( 0 );
+	}
+	layout_cache->filename_size = filename_length + extension_length + 1;
+
+	layout_cache->filename = system_string_allocate(
+	                          layout_cache->filename_size );
+
+	if( layout_cache->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     layout_cache->filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     &( layout_cache->filename[ filename_length ] ),
+	     extension,
+	     extension_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy extension.",
+		 function );
+
+		goto on_error;
+	}
+	layout_cache->filename[ layout_cache->filename_size - 1 ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( layout_cache->filename != NULL )
+	{
+		memory_free(
+		 layout_cache->filename );
+
+		layout_cache->filename = NULL;
+	}
+	layout_cache->filename_size = 0;
+
+	return( -1 );
+}
+
+/* Reads the layout cache data
+ * The array and layout arena are expected to be empty and are emptied again if the data cannot be loaded
+ * Returns 1 if successful, 0 if the data is stale or not a supported layout cache or -1 on error
+ */
+int libodraw_layout_cache_read_data(
+     libodraw_layout_cache_t *layout_cache,
+     const uint8_t *data,
+     size_t data_size,
+     libcdata_array_t *data_file_descriptors_array,
+     libodraw_layout_arena_t *layout_arena,
+     libcerror_error_t **error )
+{
+	libodraw_data_file_descriptor_t *data_file_descriptor = NULL;
+	libodraw_sector_range_t *sector_range                 = NULL;
+	libodraw_track_value_t *track_value                   = NULL;
+	static char *function                                 = "libodraw_layout_cache_read_data";
+	size_t data_offset                                    = 0;
+	size_t sector_ranges_data_offset                      = 0;
+	uint64_t data_file_start_sector                       = 0;
+	uint64_t number_of_sectors                            = 0;
+	uint64_t start_sector                                 = 0;
+	uint64_t toc_file_modification_time                   = 0;
+	uint64_t toc_file_size                                = 0;
+	uint32_t data_file_index                              = 0;
+	uint32_t format_version                               = 0;
+	uint32_t number_of_data_files                         = 0;
+	uint32_t number_of_lead_outs                          = 0;
+	uint32_t number_of_records                            = 0;
+	uint32_t number_of_run_outs                           = 0;
+	uint32_t number_of_sector_ranges                      = 0;
+	uint32_t number_of_sessions                           = 0;
+	uint32_t number_of_tracks                             = 0;
+	uint32_t stored_data_size                             = 0;
+	uint32_t value_index                                  = 0;
+	uint16_t name_size                                    = 0;
+	int entry_index                                       = 0;
+	int region                                            = 0;
+
+	if( layout_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) LIBODRAW_LAYOUT_CACHE_MAXIMUM_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < sizeof( odraw_layout_cache_header_t ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     ( (odraw_layout_cache_header_t *) data )->signature,
+	     odraw_layout_cache_signature,
+	     8 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (odraw_layout_cache_header_t *) data )->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (odraw_layout_cache_header_t *) data )->data_size,
+	 stored_data_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (odraw_layout_cache_header_t *) data )->toc_file_size,
+	 toc_file_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (odraw_layout_cache_header_t *) data )->toc_file_modification_time,
+	 toc_file_modification_time );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (odraw_layout_cache_header_t *) data )->number_of_data_files,
+	 number_of_data_files );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (odraw_layout_cache_header_t *) data )->number_of_sessions,
+	 number_of_sessions );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (odraw_layout_cache_header_t *) data )->number_of_run_outs,
+	 number_of_run_outs );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (odraw_layout_cache_header_t *) data )->number_of_lead_outs,
+	 number_of_lead_outs );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (odraw_layout_cache_header_t *) data )->number_of_tracks,
+	 number_of_tracks );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format version\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 format_version );
+
+		libcnotify_printf(
+		 "%s: data size\t\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 stored_data_size );
+
+		libcnotify_printf(
+		 "%s: TOC file size\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 toc_file_size );
+
+		libcnotify_printf(
+		 "%s: TOC file modification time\t\t: %" PRIu64 "\n",
+		 function,
+		 toc_file_modification_time );
+
+		libcnotify_printf(
+		 "%s: number of data files\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_data_files );
+
+		libcnotify_printf(
+		 "%s: number of sessions\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_sessions );
+
+		libcnotify_printf(
+		 "%s: number of run-outs\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_run_outs );
+
+		libcnotify_printf(
+		 "%s: number of lead-outs\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_lead_outs );
+
+		libcnotify_printf(
+		 "%s: number of tracks\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_tracks );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( ( format_version != LIBODRAW_LAYOUT_CACHE_FORMAT_VERSION )
+	 || ( (size_t) stored_data_size != data_size )
+	 || ( toc_file_size != (uint64_t) layout_cache->toc_file_size )
+	 || ( toc_file_modification_time != layout_cache->toc_file_modification_time ) )
+	{
+		return( 0 );
+	}
+	/* The number of values are bounded by the data size, which makes the size
+	 * calculations below safe from overflow
+	 */
+	if( ( number_of_data_files > data_size )
+	 || ( number_of_sessions > data_size )
+	 || ( number_of_run_outs > data_size )
+	 || ( number_of_lead_outs > data_size )
+	 || ( number_of_tracks > data_size ) )
+	{
+		return( 0 );
+	}
+	/* Validate the structure of the data before any value is loaded
+	 */
+	data_offset = sizeof( odraw_layout_cache_header_t );
+
+	for( value_index = 0;
+	     value_index < number_of_data_files;
+	     value_index++ )
+	{
+		if( sizeof( odraw_layout_cache_data_file_t ) > ( data_size - data_offset ) )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (odraw_layout_cache_data_file_t *) &( data[ data_offset ] ) )->name_size,
+		 name_size );
+
+		data_offset += sizeof( odraw_layout_cache_data_file_t );
+
+		if( ( name_size == 0 )
+		 || ( (size_t) name_size > ( data_size - data_offset ) )
+		 || ( data[ data_offset + name_size - 1 ] != 0 ) )
+		{
+			return( 0 );
+		}
+		data_offset += name_size;
+	}
+	sector_ranges_data_offset = data_offset;
+
+	if( ( ( number_of_sessions + number_of_run_outs + number_of_lead_outs ) * sizeof( odraw_layout_cache_sector_range_t ) )
+	  + ( number_of_tracks * sizeof( odraw_layout_cache_track_t ) ) != ( data_size - data_offset ) )
+	{
+		return( 0 );
+	}
+	data_offset += ( number_of_sessions + number_of_run_outs + number_of_lead_outs ) * sizeof( odraw_layout_cache_sector_range_t );
+
+	for( value_index = 0;
+	     value_index < number_of_tracks;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (odraw_layout_cache_track_t *) &( data[ data_offset ] ) )->data_file_index,
+		 data_file_index );
+
+		if( data_file_index >= number_of_data_files )
+		{
+			return( 0 );
+		}
+		data_offset += sizeof( odraw_layout_cache_track_t );
+	}
+	/* Load the values
+	 */
+	data_offset = sizeof( odraw_layout_cache_header_t );
+
+	for( value_index = 0;
+	     value_index < number_of_data_files;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (odraw_layout_cache_data_file_t *) &( data[ data_offset ] ) )->name_size,
+		 name_size );
+
+		if( libodraw_data_file_descriptor_initialize(
+		     &data_file_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data file descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		data_file_descriptor->type = ( (odraw_layout_cache_data_file_t *) &( data[ data_offset ] ) )->type;
+
+		data_offset += sizeof( odraw_layout_cache_data_file_t );
+
+		if( libodraw_data_file_descriptor_set_name(
+		     data_file_descriptor,
+		     (char *) &( data[ data_offset ] ),
+		     (size_t) name_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set name in data file descriptor: %" PRIu32 ".",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		data_offset += name_size;
+
+		if( libcdata_array_append_entry(
+		     data_file_descriptors_array,
+		     &entry_index,
+		     (intptr_t *) data_file_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append data file descriptor: %" PRIu32 ".",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		data_file_descriptor = NULL;
+	}
+	/* The number of records is known in advance so that each region is sized once
+	 */
+	for( region = 0;
+	     region < LIBODRAW_LAYOUT_ARENA_NUMBER_OF_REGIONS;
+	     region++ )
+	{
+		switch( region )
+		{
+			case LIBODRAW_LAYOUT_ARENA_REGION_TRACKS:
+				number_of_records = number_of_tracks;
+				break;
+
+			case LIBODRAW_LAYOUT_ARENA_REGION_SESSIONS:
+				number_of_records = number_of_sessions;
+				break;
+
+			case LIBODRAW_LAYOUT_ARENA_REGION_RUN_OUTS:
+				number_of_records = number_of_run_outs;
+				break;
+
+			default:
+				number_of_records = number_of_lead_outs;
+				break;
+		}
+		if( number_of_records == 0 )
+		{
+			continue;
+		}
+		if( libodraw_layout_arena_resize_region(
+		     layout_arena,
+		     region,
+		     (int) number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize layout arena region: %d.",
+			 function,
+			 region );
+
+			goto on_error;
+		}
+	}
+	data_offset = sector_ranges_data_offset;
+
+	for( region = LIBODRAW_LAYOUT_ARENA_REGION_SESSIONS;
+	     region <= LIBODRAW_LAYOUT_ARENA_REGION_LEAD_OUTS;
+	     region++ )
+	{
+		switch( region )
+		{
+			case LIBODRAW_LAYOUT_ARENA_REGION_SESSIONS:
+				number_of_sector_ranges = number_of_sessions;
+				break;
+
+			case LIBODRAW_LAYOUT_ARENA_REGION_RUN_OUTS:
+				number_of_sector_ranges = number_of_run_outs;
+				break;
+
+			default:
+				number_of_sector_ranges = number_of_lead_outs;
+				break;
+		}		for( value_index = 0;
+		     value_index < number_of_sector_ranges;
+		     value_index++ )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (odraw_layout_cache_sector_range_t *) &( data[ data_offset ] ) )->start_sector,
+			 start_sector );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (odraw_layout_cache_sector_range_t *) &( data[ data_offset ] ) )->number_of_sectors,
+			 number_of_sectors );
+
+			data_offset += sizeof( odraw_layout_cache_sector_range_t );
+
+			if( libodraw_layout_arena_append_sector_range(
+			     layout_arena,
+			     region,
+			     &entry_index,
+			     &sector_range,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append sector range: %" PRIu32 ".",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+			if( libodraw_sector_range_set(
+			     sector_range,
+			     start_sector,
+			     number_of_sectors,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set sector range: %" PRIu32 ".",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+		}
+	}
+	for( value_index = 0;
+	     value_index < number_of_tracks;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (odraw_layout_cache_track_t *) &( data[ data_offset ] ) )->start_sector,
+		 start_sector );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (odraw_layout_cache_track_t *) &( data[ data_offset ] ) )->number_of_sectors,
+		 number_of_sectors );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (odraw_layout_cache_track_t *) &( data[ data_offset ] ) )->data_file_start_sector,
+		 data_file_start_sector );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (odraw_layout_cache_track_t *) &( data[ data_offset ] ) )->data_file_index,
+		 data_file_index );
+
+		if( libodraw_layout_arena_append_track(
+		     layout_arena,
+		     &entry_index,
+		     &track_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append track value: %" PRIu32 ".",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( libodraw_track_value_set(
+		     track_value,
+		     start_sector,
+		     number_of_sectors,
+		     ( (odraw_layout_cache_track_t *) &( data[ data_offset ] ) )->type,
+		     (int) data_file_index,
+		     data_file_start_sector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set track value: %" PRIu32 ".",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		data_offset += sizeof( odraw_layout_cache_track_t );
+	}
+	return( 1 );
+
+on_error:
+	if( data_file_descriptor != NULL )
+	{
+		libodraw_data_file_descriptor_free(
+		 &data_file_descriptor,
+		 NULL );
+	}
+	libodraw_layout_arena_empty(
+	 layout_arena,
+	 NULL );
+	libcdata_array_empty(
+	 data_file_descriptors_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_data_file_descriptor_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Writes the sector ranges of a layout arena region to the layout cache data
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_layout_cache_write_sector_ranges(
+     libodraw_layout_arena_t *layout_arena,
+     int region,
+     int number_of_sector_ranges,
+     uint8_t *data,
+     size_t *data_offset,
+     libcerror_error_t **error )
+{
+	libodraw_sector_range_t *sector_range = NULL;
+	static char *function                 = "libodraw_layout_cache_write_sector_ranges";
+	int sector_range_index                = 0;
+
+	for( sector_range_index = 0;
+	     sector_range_index < number_of_sector_ranges;
+	     sector_range_index++ )
+	{
+		if( libodraw_layout_arena_get_sector_range_by_index(
+		     layout_arena,
+		     region,
+		     sector_range_index,
+		     &sector_range,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sector range: %d.",
+			 function,
+			 sector_range_index );
+
+			return( -1 );
+		}
+		if( sector_range == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sector range: %d.",
+			 function,
+			 sector_range_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (odraw_layout_cache_sector_range_t *) &( data[ *data_offset ] ) )->start_sector,
+		 sector_range->start_sector );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (odraw_layout_cache_sector_range_t *) &( data[ *data_offset ] ) )->number_of_sectors,
+		 sector_range->number_of_sectors );
+
+		*data_offset += sizeof( odraw_layout_cache_sector_range_t );
+	}
+	return( 1 );
+}
+
+/* Writes the layout cache data
+ * Creates a buffer that must be freed with memory_free
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_layout_cache_write_data(
+     libodraw_layout_cache_t *layout_cache,
+     libcdata_array_t *data_file_descriptors_array,
+     libodraw_layout_arena_t *layout_arena,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libodraw_data_file_descriptor_t *data_file_descriptor = NULL;
+	libodraw_track_value_t *track_value                   = NULL;
+	uint8_t *safe_data                                    = NULL;
+	static char *function                                 = "libodraw_layout_cache_write_data";
+	size_t data_offset                                    = 0;
+	size_t name_size                                      = 0;
+	size_t safe_data_size                                 = 0;
+	int number_of_data_files                              = 0;
+	int number_of_lead_outs                               = 0;
+	int number_of_run_outs                                = 0;
+	int number_of_sessions                                = 0;
+	int number_of_tracks                                  = 0;
+	int value_index                                       = 0;
+
+	if( layout_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( libcdata_array_get_number_of_entries(
+	       data_file_descriptors_array,
+	       &number_of_data_files,
+	       error ) != 1 )
+	 || ( libodraw_layout_arena_get_number_of_sector_ranges(
+	       layout_arena,
+	       LIBODRAW_LAYOUT_ARENA_REGION_SESSIONS,
+	       &number_of_sessions,
+	       error ) != 1 )
+	 || ( libodraw_layout_arena_get_number_of_sector_ranges(
+	       layout_arena,
+	       LIBODRAW_LAYOUT_ARENA_REGION_RUN_OUTS,
+	       &number_of_run_outs,
+	       error ) != 1 )
+	 || ( libodraw_layout_arena_get_number_of_sector_ranges(
+	       layout_arena,
+	       LIBODRAW_LAYOUT_ARENA_REGION_LEAD_OUTS,
+	       &number_of_lead_outs,
+	       error ) != 1 )
+	 || ( libodraw_layout_arena_get_number_of_tracks(
+	       layout_arena,
+	       &number_of_tracks,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of layout values.",
+		 function );
+
+		goto on_error;
+	}
+	safe_data_size = sizeof( odraw_layout_cache_header_t )
+	               + ( (size_t) ( number_of_sessions + number_of_run_outs + number_of_lead_outs ) * sizeof( odraw_layout_cache_sector_range_t ) )
+	               + ( (size_t) number_of_tracks * sizeof( odraw_layout_cache_track_t ) );
+
+	for( value_index = 0;
+	     value_index < number_of_data_files;
+	     value_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     data_file_descriptors_array,
+		     value_index,
+		     (intptr_t **) &data_file_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data file descriptor: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( libodraw_data_file_descriptor_get_name_size(
+		     data_file_descriptor,
+		     &name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve name size of data file descriptor: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( ( name_size == 0 )
+		 || ( name_size > (size_t) UINT16_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data file descriptor: %d - name size value out of bounds.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		safe_data_size += sizeof( odraw_layout_cache_data_file_t ) + name_size;
+	}
+	if( safe_data_size > (size_t) LIBODRAW_LAYOUT_CACHE_MAXIMUM_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	safe_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * safe_data_size );
+
+	if( safe_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_data,
+	     0,
+	     sizeof( odraw_layout_cache_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     ( (odraw_layout_cache_header_t *) safe_data )->signature,
+	     odraw_layout_cache_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (odraw_layout_cache_header_t *) safe_data )->format_version,
+	 LIBODRAW_LAYOUT_CACHE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (odraw_layout_cache_header_t *) safe_data )->data_size,
+	 (uint32_t) safe_data_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (odraw_layout_cache_header_t *) safe_data )->toc_file_size,
+	 (uint64_t) layout_cache->toc_file_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (odraw_layout_cache_header_t *) safe_data )->toc_file_modification_time,
+	 layout_cache->toc_file_modification_time );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (odraw_layout_cache_header_t *) safe_data )->number_of_data_files,
+	 (uint32_t) number_of_data_files );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (odraw_layout_cache_header_t *) safe_data )->number_of_sessions,
+	 (uint32_t) number_of_sessions );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (odraw_layout_cache_header_t *) safe_data )->number_of_run_outs,
+	 (uint32_t) number_of_run_outs );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (odraw_layout_cache_header_t *) safe_data )->number_of_lead_outs,
+	 (uint32_t) number_of_lead_outs );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (odraw_layout_cache_header_t *) safe_data )->number_of_tracks,
+	 (uint32_t) number_of_tracks );
+
+	data_offset = sizeof( odraw_layout_cache_header_t );
+
+	for( value_index = 0;
+	     value_index < number_of_data_files;
+	     value_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     data_file_descriptors_array,
+		     value_index,
+		     (intptr_t **) &data_file_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data file descriptor: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( libodraw_data_file_descriptor_get_name_size(
+		     data_file_descriptor,
+		     &name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve name size of data file descriptor: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		( (odraw_layout_cache_data_file_t *) &( safe_data[ data_offset ] ) )->type = data_file_descriptor->type;
+
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (odraw_layout_cache_data_file_t *) &( safe_data[ data_offset ] ) )->name_size,
+		 (uint16_t) name_size );
+
+		data_offset += sizeof( odraw_layout_cache_data_file_t );
+
+		if( libodraw_data_file_descriptor_get_name(
+		     data_file_descriptor,
+		     (char *) &( safe_data[ data_offset ] ),
+		     name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve name of data file descriptor: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		safe_data[ data_offset + name_size - 1 ] = 0;
+
+		data_offset += name_size;
+	}
+	if( libodraw_layout_cache_write_sector_ranges(
+	     layout_arena,
+	     LIBODRAW_LAYOUT_ARENA_REGION_SESSIONS,
+	     number_of_sessions,
+	     safe_data,
+	     &data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write sessions.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_layout_cache_write_sector_ranges(
+	     layout_arena,
+	     LIBODRAW_LAYOUT_ARENA_REGION_RUN_OUTS,
+	     number_of_run_outs,
+	     safe_data,
+	     &data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write run-outs.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_layout_cache_write_sector_ranges(
+	     layout_arena,
+	     LIBODRAW_LAYOUT_ARENA_REGION_LEAD_OUTS,
+	     number_of_lead_outs,
+	     safe_data,
+	     &data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write lead-outs.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < number_of_tracks;
+	     value_index++ )
+	{
+		if( libodraw_layout_arena_get_track_by_index(
+		     layout_arena,
+		     value_index,
+		     &track_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve track value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( track_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing track value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (odraw_layout_cache_track_t *) &( safe_data[ data_offset ] ) )->start_sector,
+		 track_value->start_sector );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (odraw_layout_cache_track_t *) &( safe_data[ data_offset ] ) )->number_of_sectors,
+		 track_value->number_of_sectors );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (odraw_layout_cache_track_t *) &( safe_data[ data_offset ] ) )->data_file_start_sector,
+		 track_value->data_file_start_sector );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (odraw_layout_cache_track_t *) &( safe_data[ data_offset ] ) )->data_file_index,
+		 (uint32_t) track_value->data_file_index );
+
+		( (odraw_layout_cache_track_t *) &( safe_data[ data_offset ] ) )->type = track_value->type;
+
+		data_offset += sizeof( odraw_layout_cache_track_t );
+	}
+	*data      = safe_data;
+	*data_size = safe_data_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_data != NULL )
+	{
+		memory_free(
+		 safe_data );
+	}
+	return( -1 );
+}
+
+/* Reads the layout cache file
+ * Returns 1 if successful, 0 if there is no usable layout cache file or -1 on error
+ */
+int libodraw_layout_cache_read_file(
+     libodraw_layout_cache_t *layout_cache,
+     libcdata_array_t *data_file_descriptors_array,
+     libodraw_layout_arena_t *layout_arena,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	uint8_t *data                    = NULL;
+	static char *function            = "libodraw_layout_cache_read_file";
+	size64_t file_size               = 0;
+	ssize_t read_count               = 0;
+	int result                       = 0;
+
+	if( layout_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( layout_cache->filename == NULL )
+	{
+		return( 0 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     layout_cache->filename,
+	     layout_cache->filename_size - 1,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     layout_cache->filename,
+	     layout_cache->filename_size - 1,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* A layout cache file that does not exist or cannot be opened
+	 * is not an error, the TOC file is parsed instead
+	 */
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     NULL ) != 1 )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+
+		return( 0 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve layout cache file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size >= (size64_t) sizeof( odraw_layout_cache_header_t ) )
+	 && ( file_size <= (size64_t) LIBODRAW_LAYOUT_CACHE_MAXIMUM_DATA_SIZE ) )
+	{
+		data = (uint8_t *) memory_allocate(
+		                    sizeof( uint8_t ) * (size_t) file_size );
+
+		if( data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              data,
+		              (size_t) file_size,
+		              0,
+		              error );
+
+		if( read_count != (ssize_t) file_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read layout cache file data.",
+			 function );
+
+			goto on_error;
+		}
+		result = libodraw_layout_cache_read_data(
+		          layout_cache,
+		          data,
+		          (size_t) file_size,
+		          data_file_descriptors_array,
+		          layout_arena,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read layout cache data.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 data );
+
+		data = NULL;
+	}
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the layout cache file
+ * Returns 1 if successful, 0 if no layout cache filename was set or -1 on error
+ */
+int libodraw_layout_cache_write_file(
+     libodraw_layout_cache_t *layout_cache,
+     libcdata_array_t *data_file_descriptors_array,
+     libodraw_layout_arena_t *layout_arena,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	uint8_t *data                    = NULL;
+	static char *function            = "libodraw_layout_cache_write_file";
+	size_t data_size                 = 0;
+	ssize_t write_count              = 0;
+
+	if( layout_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( layout_cache->filename == NULL )
+	{
+		return( 0 );
+	}
+	if( libodraw_layout_cache_write_data(
+	     layout_cache,
+	     data_file_descriptors_array,
+	     layout_arena,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write layout cache data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     layout_cache->filename,
+	     layout_cache->filename_size - 1,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     layout_cache->filename,
+	     layout_cache->filename_size - 1,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open layout cache file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The data is written with a single write so that a reader
+	 * either sees the complete data or a data size mismatch
+	 */
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               data,
+	               data_size,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write layout cache file data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,121 @@
+/*
+ * Layout cache functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_LAYOUT_CACHE_H )
+#define _LIBODRAW_LAYOUT_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_layout_arena.h"
+#include "libodraw_libcdata.h"
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define LIBODRAW_LAYOUT_CACHE_FORMAT_VERSION		1
+
+/* The maximum size of a layout cache file, which is far larger than
+ * any layout a CUE file can describe
+ */
+#define LIBODRAW_LAYOUT_CACHE_MAXIMUM_DATA_SIZE	( 16 * 1024 * 1024 )
+
+extern const uint8_t odraw_layout_cache_signature[ 8 ];
+
+typedef struct libodraw_layout_cache libodraw_layout_cache_t;
+
+struct libodraw_layout_cache
+{
+	/* The (layout cache) filename
+	 */
+	system_character_t *filename;
+
+	/* The filename size
+	 */
+	size_t filename_size;
+
+	/* The size of the table of contents (TOC) file
+	 */
+	size64_t toc_file_size;
+
+	/* The modification time of the table of contents (TOC) file
+	 */
+	uint64_t toc_file_modification_time;
+};
+
+int libodraw_layout_cache_initialize(
+     libodraw_layout_cache_t **layout_cache,
+     libcerror_error_t **error );
+
+int libodraw_layout_cache_free(
+     libodraw_layout_cache_t **layout_cache,
+     libcerror_error_t **error );
+
+int libodraw_layout_cache_set_toc_filename(
+     libodraw_layout_cache_t *layout_cache,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int libodraw_layout_cache_read_data(
+     libodraw_layout_cache_t *layout_cache,
+     const uint8_t *data,
+     size_t data_size,
+     libcdata_array_t *data_file_descriptors_array,
+     libodraw_layout_arena_t *layout_arena,
+     libcerror_error_t **error );
+
+int libodraw_layout_cache_write_sector_ranges(
+     libodraw_layout_arena_t *layout_arena,
+     int region,
+     int number_of_sector_ranges,
+     uint8_t *data,
+     size_t *data_offset,
+     libcerror_error_t **error );
+
+int libodraw_layout_cache_write_data(
+     libodraw_layout_cache_t *layout_cache,
+     libcdata_array_t *data_file_descriptors_array,
+     libodraw_layout_arena_t *layout_arena,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libodraw_layout_cache_read_file(
+     libodraw_layout_cache_t *layout_cache,
+     libcdata_array_t *data_file_descriptors_array,
+     libodraw_layout_arena_t *layout_arena,
+     libcerror_error_t **error );
+
+int libodraw_layout_cache_write_file(
+     libodraw_layout_cache_t *layout_cache,
+     libcdata_array_t *data_file_descriptors_array,
+     libodraw_layout_arena_t *layout_arena,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_LAYOUT_CACHE_H ) */
+
@@ -0,0 +1,465 @@
+/*
+ * Open file budget functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+#include "libodraw_libcthreads.h"
+#include "libodraw_open_file_budget.h"
+
+/* Creates an open file budget
+ * Make sure the value open_file_budget is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_open_file_budget_initialize(
+     libodraw_open_file_budget_t **open_file_budget,
+     int maximum_number_of_open_files,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_open_file_budget_initialize";
+
+	if( open_file_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open file budget.",
+		 function );
+
+		return( -1 );
+	}
+	if( *open_file_budget != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid open file budget value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_files <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of open files value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*open_file_budget = memory_allocate_structure(
+	                     libodraw_open_file_budget_t );
+
+	if( *open_file_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create open file budget.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *open_file_budget,
+	     0,
+	     sizeof( libodraw_open_file_budget_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear open file budget.",
+		 function );
+
+		memory_free(
+		 *open_file_budget );
+
+		*open_file_budget = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *open_file_budget )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *open_file_budget )->maximum_number_of_open_files = maximum_number_of_open_files;
+	( *open_file_budget )->number_of_references         = 1;
+
+	return( 1 );
+
+on_error:
+	if( *open_file_budget != NULL )
+	{
+		memory_free(
+		 *open_file_budget );
+
+		*open_file_budget = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an open file budget
+ * The open file budget is only freed when its last reference is removed
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_open_file_budget_free(
+     libodraw_open_file_budget_t **open_file_budget,
+     libcerror_error_t **error )
+{
+	static char *function    = "libodraw_open_file_budget_free";
+	int number_of_references = 0;
+	int result               = 1;
+
+	if( open_file_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open file budget.",
+		 function );
+
+		return( -1 );
+	}
+	if( *open_file_budget != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     ( *open_file_budget )->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		( *open_file_budget )->number_of_references -= 1;
+
+		number_of_references = ( *open_file_budget )->number_of_references;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     ( *open_file_budget )->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( number_of_references <= 0 )
+		{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( libcthreads_mutex_free(
+			     &( ( *open_file_budget )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+#endif
+			memory_free(
+			 *open_file_budget );
+		}
+		*open_file_budget = NULL;
+	}
+	return( result );
+}
+
+/* Adds a reference to the open file budget
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_open_file_budget_add_reference(
+     libodraw_open_file_budget_t *open_file_budget,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_open_file_budget_add_reference";
+
+	if( open_file_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open file budget.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     open_file_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	open_file_budget->number_of_references += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     open_file_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum number of open files
+ * Files that are open beyond the new maximum are closed when the handles open other files
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_open_file_budget_set_maximum_number_of_open_files(
+     libodraw_open_file_budget_t *open_file_budget,
+     int maximum_number_of_open_files,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_open_file_budget_set_maximum_number_of_open_files";
+
+	if( open_file_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open file budget.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_files <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of open files value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     open_file_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	open_file_budget->maximum_number_of_open_files = maximum_number_of_open_files;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     open_file_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Acquires an open file from the budget
+ * If ignore_maximum is set the open file is acquired even if the budget is exhausted,
+ * which allows a handle that has no other open files to close to continue
+ * Returns 1 if successful, 0 if the budget is exhausted or -1 on error
+ */
+int libodraw_open_file_budget_acquire(
+     libodraw_open_file_budget_t *open_file_budget,
+     uint8_t ignore_maximum,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_open_file_budget_acquire";
+	int result            = 0;
+
+	if( open_file_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open file budget.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     open_file_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( ignore_maximum != 0 )
+	 || ( open_file_budget->number_of_open_files < open_file_budget->maximum_number_of_open_files ) )
+	{
+		open_file_budget->number_of_open_files += 1;
+
+		result = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     open_file_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Releases an open file to the budget
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_open_file_budget_release(
+     libodraw_open_file_budget_t *open_file_budget,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_open_file_budget_release";
+
+	if( open_file_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open file budget.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     open_file_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( open_file_budget->number_of_open_files > 0 )
+	{
+		open_file_budget->number_of_open_files -= 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     open_file_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,94 @@
+/*
+ * Open file budget functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_OPEN_FILE_BUDGET_H )
+#define _LIBODRAW_OPEN_FILE_BUDGET_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+#include "libodraw_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libodraw_open_file_budget libodraw_open_file_budget_t;
+
+/* The open file budget limits the number of data files that are open at the same time
+ * and can be shared by multiple handles, where every handle closes its own data files
+ */
+struct libodraw_open_file_budget
+{
+	/* The maximum number of open files
+	 */
+	int maximum_number_of_open_files;
+
+	/* The number of open files
+	 */
+	int number_of_open_files;
+
+	/* The number of references
+	 */
+	int number_of_references;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the budget, since the handles that share it
+	 * can be used by different threads
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libodraw_open_file_budget_initialize(
+     libodraw_open_file_budget_t **open_file_budget,
+     int maximum_number_of_open_files,
+     libcerror_error_t **error );
+
+int libodraw_open_file_budget_free(
+     libodraw_open_file_budget_t **open_file_budget,
+     libcerror_error_t **error );
+
+int libodraw_open_file_budget_add_reference(
+     libodraw_open_file_budget_t *open_file_budget,
+     libcerror_error_t **error );
+
+int libodraw_open_file_budget_set_maximum_number_of_open_files(
+     libodraw_open_file_budget_t *open_file_budget,
+     int maximum_number_of_open_files,
+     libcerror_error_t **error );
+
+int libodraw_open_file_budget_acquire(
+     libodraw_open_file_budget_t *open_file_budget,
+     uint8_t ignore_maximum,
+     libcerror_error_t **error );
+
+int libodraw_open_file_budget_release(
+     libodraw_open_file_budget_t *open_file_budget,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_OPEN_FILE_BUDGET_H ) */
+
@@ -0,0 +1,632 @@
+/*
+ * Read-ahead functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+#include "libodraw_read_ahead.h"
+
+/* Creates a read-ahead
+ * Make sure the value read_ahead is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_read_ahead_initialize(
+     libodraw_read_ahead_t **read_ahead,
+     size_t window_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_read_ahead_initialize";
+	int buffer_index      = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read-ahead value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( window_size == 0 )
+	 || ( window_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid window size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*read_ahead = memory_allocate_structure(
+	               libodraw_read_ahead_t );
+
+	if( *read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_ahead,
+	     0,
+	     sizeof( libodraw_read_ahead_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	for( buffer_index = 0;
+	     buffer_index < LIBODRAW_READ_AHEAD_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		( *read_ahead )->buffers[ buffer_index ].data_file_index = -1;
+	}
+	( *read_ahead )->window_size                  = window_size;
+	( *read_ahead )->last_data_file_index         = -1;
+	( *read_ahead )->continuation_data_file_index = -1;
+
+	return( 1 );
+
+on_error:
+	if( *read_ahead != NULL )
+	{
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read-ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_read_ahead_free(
+     libodraw_read_ahead_t **read_ahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_read_ahead_free";
+	int buffer_index      = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead != NULL )
+	{
+		for( buffer_index = 0;
+		     buffer_index < LIBODRAW_READ_AHEAD_NUMBER_OF_BUFFERS;
+		     buffer_index++ )
+		{
+			if( ( *read_ahead )->buffers[ buffer_index ].data != NULL )
+			{
+				memory_free(
+				 ( *read_ahead )->buffers[ buffer_index ].data );
+			}
+		}
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears a read-ahead
+ * The buffers are retained but their data is no longer used
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_read_ahead_clear(
+     libodraw_read_ahead_t *read_ahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_read_ahead_clear";
+	int buffer_index      = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < LIBODRAW_READ_AHEAD_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		read_ahead->buffers[ buffer_index ].data_file_index = -1;
+		read_ahead->buffers[ buffer_index ].offset          = 0;
+		read_ahead->buffers[ buffer_index ].data_size       = 0;
+		read_ahead->buffers[ buffer_index ].access_count    = 0;
+	}
+	read_ahead->access_count                 = 0;
+	read_ahead->last_data_file_index         = -1;
+	read_ahead->last_end_offset              = 0;
+	read_ahead->continuation_data_file_index = -1;
+	read_ahead->continuation_offset          = 0;
+	read_ahead->number_of_sequential_reads   = 0;
+
+	return( 1 );
+}
+
+/* Sets the window size
+ * The buffers are freed and allocated with the new window size on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_read_ahead_set_window_size(
+     libodraw_read_ahead_t *read_ahead,
+     size_t window_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_read_ahead_set_window_size";
+	int buffer_index      = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( window_size == 0 )
+	 || ( window_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid window size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( window_size == read_ahead->window_size )
+	{
+		return( 1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < LIBODRAW_READ_AHEAD_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( read_ahead->buffers[ buffer_index ].data != NULL )
+		{
+			memory_free(
+			 read_ahead->buffers[ buffer_index ].data );
+
+			read_ahead->buffers[ buffer_index ].data = NULL;
+		}
+	}
+	read_ahead->window_size = window_size;
+
+	if( libodraw_read_ahead_clear(
+	     read_ahead,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Updates the access pattern with a read
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_read_ahead_update_access(
+     libodraw_read_ahead_t *read_ahead,
+     int data_file_index,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_read_ahead_update_access";
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( data_file_index == read_ahead->last_data_file_index )
+	  &&  ( offset == read_ahead->last_end_offset ) )
+	 || ( ( data_file_index == read_ahead->continuation_data_file_index )
+	  &&  ( offset == read_ahead->continuation_offset ) ) )
+	{
+		if( read_ahead->number_of_sequential_reads < LIBODRAW_READ_AHEAD_SEQUENTIAL_THRESHOLD )
+		{
+			read_ahead->number_of_sequential_reads += 1;
+		}
+	}
+	else
+	{
+		read_ahead->number_of_sequential_reads = 0;
+	}
+	if( data_file_index != read_ahead->last_data_file_index )
+	{
+		read_ahead->continuation_data_file_index = -1;
+		read_ahead->continuation_offset          = 0;
+	}
+	read_ahead->last_data_file_index = data_file_index;
+	read_ahead->last_end_offset      = offset + (off64_t) size;
+
+	return( 1 );
+}
+
+/* Determines if the reads are sequential
+ * Returns 1 if sequential, 0 if not or -1 on error
+ */
+int libodraw_read_ahead_is_sequential(
+     libodraw_read_ahead_t *read_ahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_read_ahead_is_sequential";
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_ahead->number_of_sequential_reads >= LIBODRAW_READ_AHEAD_SEQUENTIAL_THRESHOLD )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sets the data file offset at which a sequential read continues in another data file
+ * such as the start of the data of the next track
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_read_ahead_set_continuation(
+     libodraw_read_ahead_t *read_ahead,
+     int data_file_index,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_read_ahead_set_continuation";
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	read_ahead->continuation_data_file_index = data_file_index;
+	read_ahead->continuation_offset          = offset;
+
+	return( 1 );
+}
+
+/* Determines if a buffer contains the data at a specific data file offset
+ * Returns 1 if the data is available, 0 if not or -1 on error
+ */
+int libodraw_read_ahead_has_data(
+     libodraw_read_ahead_t *read_ahead,
+     int data_file_index,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	libodraw_read_ahead_buffer_t *read_ahead_buffer = NULL;
+	static char *function                           = "libodraw_read_ahead_has_data";
+	int buffer_index                                = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < LIBODRAW_READ_AHEAD_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		read_ahead_buffer = &( read_ahead->buffers[ buffer_index ] );
+
+		if( ( read_ahead_buffer->data_file_index == data_file_index )
+		 && ( offset >= read_ahead_buffer->offset )
+		 && ( offset < ( read_ahead_buffer->offset + (off64_t) read_ahead_buffer->data_size ) ) )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Copies the data at a specific data file offset from the buffers
+ * Returns the number of bytes copied, 0 if the data is not available or -1 on error
+ */
+ssize_t libodraw_read_ahead_copy_data(
+         libodraw_read_ahead_t *read_ahead,
+         int data_file_index,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libodraw_read_ahead_buffer_t *read_ahead_buffer = NULL;
+	static char *function                           = "libodraw_read_ahead_copy_data";
+	size_t data_offset                              = 0;
+	size_t read_size                                = 0;
+	int buffer_index                                = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < LIBODRAW_READ_AHEAD_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		read_ahead_buffer = &( read_ahead->buffers[ buffer_index ] );
+
+		if( ( read_ahead_buffer->data_file_index == data_file_index )
+		 && ( offset >= read_ahead_buffer->offset )
+		 && ( offset < ( read_ahead_buffer->offset + (off64_t) read_ahead_buffer->data_size ) ) )
+		{
+			break;
+		}
+	}
+	if( buffer_index >= LIBODRAW_READ_AHEAD_NUMBER_OF_BUFFERS )
+	{
+		return( 0 );
+	}
+	data_offset = (size_t) ( offset - read_ahead_buffer->offset );
+	read_size   = read_ahead_buffer->data_size - data_offset;
+
+	if( read_size > buffer_size )
+	{
+		read_size = buffer_size;
+	}
+	if( memory_copy(
+	     buffer,
+	     &( read_ahead_buffer->data[ data_offset ] ),
+	     read_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy read-ahead data.",
+		 function );
+
+		return( -1 );
+	}
+	read_ahead->access_count += 1;
+
+	read_ahead_buffer->access_count = read_ahead->access_count;
+
+	return( (ssize_t) read_size );
+}
+
+/* Retrieves the buffer to fill with the data at a specific data file offset
+ * The buffer that holds data of the same data file is reused, otherwise the least
+ * recently used buffer. The data size of the buffer is set to 0, the caller reads
+ * up to the window size of data into the buffer and sets the data size
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_read_ahead_get_fill_buffer(
+     libodraw_read_ahead_t *read_ahead,
+     int data_file_index,
+     off64_t offset,
+     libodraw_read_ahead_buffer_t **read_ahead_buffer,
+     libcerror_error_t **error )
+{
+	libodraw_read_ahead_buffer_t *fill_buffer = NULL;
+	static char *function                     = "libodraw_read_ahead_get_fill_buffer";
+	int buffer_index                          = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_ahead_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead buffer.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < LIBODRAW_READ_AHEAD_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( read_ahead->buffers[ buffer_index ].data_file_index == data_file_index )
+		{
+			fill_buffer = &( read_ahead->buffers[ buffer_index ] );
+
+			break;
+		}
+		if( ( fill_buffer == NULL )
+		 || ( read_ahead->buffers[ buffer_index ].access_count < fill_buffer->access_count ) )
+		{
+			fill_buffer = &( read_ahead->buffers[ buffer_index ] );
+		}
+	}
+	if( fill_buffer->data == NULL )
+	{
+		fill_buffer->data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * read_ahead->window_size );
+
+		if( fill_buffer->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create read-ahead buffer data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	read_ahead->access_count += 1;
+
+	fill_buffer->data_file_index = data_file_index;
+	fill_buffer->offset          = offset;
+	fill_buffer->data_size       = 0;
+	fill_buffer->access_count    = read_ahead->access_count;
+
+	*read_ahead_buffer = fill_buffer;
+
+	return( 1 );
+}
+
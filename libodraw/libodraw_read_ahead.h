@@ -0,0 +1,173 @@
+/*
+ * Read-ahead functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_READ_AHEAD_H )
+#define _LIBODRAW_READ_AHEAD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default read-ahead window size
+ */
+#define LIBODRAW_READ_AHEAD_DEFAULT_WINDOW_SIZE			262144
+
+/* The number of read-ahead buffers, one for the data file that is read
+ * and one for the data file of the next track
+ */
+#define LIBODRAW_READ_AHEAD_NUMBER_OF_BUFFERS			2
+
+/* The number of consecutive sequential reads after which the reads are considered sequential
+ */
+#define LIBODRAW_READ_AHEAD_SEQUENTIAL_THRESHOLD		2
+
+typedef struct libodraw_read_ahead_buffer libodraw_read_ahead_buffer_t;
+
+struct libodraw_read_ahead_buffer
+{
+	/* The data file index, where -1 indicates the buffer is not used
+	 */
+	int data_file_index;
+
+	/* The data file offset of the data
+	 */
+	off64_t offset;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The last access count
+	 */
+	uint64_t access_count;
+};
+
+typedef struct libodraw_read_ahead libodraw_read_ahead_t;
+
+/* The read-ahead detects sequential reads of the data files and keeps
+ * a window of the data that follows, so that small reads are served from memory
+ */
+struct libodraw_read_ahead
+{
+	/* The window size
+	 */
+	size_t window_size;
+
+	/* The buffers
+	 */
+	libodraw_read_ahead_buffer_t buffers[ LIBODRAW_READ_AHEAD_NUMBER_OF_BUFFERS ];
+
+	/* The access count
+	 */
+	uint64_t access_count;
+
+	/* The data file index of the last read
+	 */
+	int last_data_file_index;
+
+	/* The data file offset at which the last read ended
+	 */
+	off64_t last_end_offset;
+
+	/* The data file index at which a sequential read continues in another data file
+	 */
+	int continuation_data_file_index;
+
+	/* The data file offset at which a sequential read continues in another data file
+	 */
+	off64_t continuation_offset;
+
+	/* The number of consecutive sequential reads
+	 */
+	int number_of_sequential_reads;
+};
+
+int libodraw_read_ahead_initialize(
+     libodraw_read_ahead_t **read_ahead,
+     size_t window_size,
+     libcerror_error_t **error );
+
+int libodraw_read_ahead_free(
+     libodraw_read_ahead_t **read_ahead,
+     libcerror_error_t **error );
+
+int libodraw_read_ahead_clear(
+     libodraw_read_ahead_t *read_ahead,
+     libcerror_error_t **error );
+
+int libodraw_read_ahead_set_window_size(
+     libodraw_read_ahead_t *read_ahead,
+     size_t window_size,
+     libcerror_error_t **error );
+
+int libodraw_read_ahead_update_access(
+     libodraw_read_ahead_t *read_ahead,
+     int data_file_index,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error );
+
+int libodraw_read_ahead_is_sequential(
+     libodraw_read_ahead_t *read_ahead,
+     libcerror_error_t **error );
+
+int libodraw_read_ahead_set_continuation(
+     libodraw_read_ahead_t *read_ahead,
+     int data_file_index,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libodraw_read_ahead_has_data(
+     libodraw_read_ahead_t *read_ahead,
+     int data_file_index,
+     off64_t offset,
+     libcerror_error_t **error );
+
+ssize_t libodraw_read_ahead_copy_data(
+     libodraw_read_ahead_t *read_ahead,
+     int data_file_index,
+     off64_t offset,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libodraw_read_ahead_get_fill_buffer(
+     libodraw_read_ahead_t *read_ahead,
+     int data_file_index,
+     off64_t offset,
+     libodraw_read_ahead_buffer_t **read_ahead_buffer,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_READ_AHEAD_H ) */
+
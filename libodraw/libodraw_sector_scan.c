@@ -0,0 +1,908 @@
+/*
+ * Sector scan functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_definitions.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_sector_scan.h"
+
+static uint8_t libodraw_sector_scan_synchronisation_data[ 12 ] = \
+	{ 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00 };
+
+/* Checks if a binary-coded decimal (BCD) value is valid and less than the maximum
+ */
+#define libodraw_sector_scan_bcd_is_valid( value, maximum ) \
+	( ( ( ( value ) & 0x0f ) <= 9 ) && ( ( ( value ) >> 4 ) <= 9 ) && ( ( value ) < ( maximum ) ) )
+
+/* Creates a sector scan
+ * Make sure the value sector_scan is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_scan_initialize(
+     libodraw_sector_scan_t **sector_scan,
+     int number_of_tracks,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_sector_scan_initialize";
+
+	if( sector_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sector_scan != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sector scan value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_tracks <= 0 )
+	 || ( (size_t) number_of_tracks > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( sizeof( uint64_t ) * LIBODRAW_NUMBER_OF_SECTOR_CLASSES ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of tracks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*sector_scan = memory_allocate_structure(
+	                libodraw_sector_scan_t );
+
+	if( *sector_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sector scan.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *sector_scan,
+	     0,
+	     sizeof( libodraw_sector_scan_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sector scan.",
+		 function );
+
+		memory_free(
+		 *sector_scan );
+
+		*sector_scan = NULL;
+
+		return( -1 );
+	}
+	( *sector_scan )->number_of_sectors_per_class = (uint64_t *) memory_allocate(
+	                                                              sizeof( uint64_t ) * LIBODRAW_NUMBER_OF_SECTOR_CLASSES * number_of_tracks );
+
+	if( ( *sector_scan )->number_of_sectors_per_class == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create number of sectors per class.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *sector_scan )->number_of_sectors_per_class,
+	     0,
+	     sizeof( uint64_t ) * LIBODRAW_NUMBER_OF_SECTOR_CLASSES * number_of_tracks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear number of sectors per class.",
+		 function );
+
+		goto on_error;
+	}
+	( *sector_scan )->track_is_scanned = (uint8_t *) memory_allocate(
+	                                                   sizeof( uint8_t ) * number_of_tracks );
+
+	if( ( *sector_scan )->track_is_scanned == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create track is scanned values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *sector_scan )->track_is_scanned,
+	     0,
+	     sizeof( uint8_t ) * number_of_tracks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear track is scanned values.",
+		 function );
+
+		goto on_error;
+	}
+	( *sector_scan )->number_of_tracks = number_of_tracks;
+
+	return( 1 );
+
+on_error:
+	if( *sector_scan != NULL )
+	{
+		if( ( *sector_scan )->track_is_scanned != NULL )
+		{
+			memory_free(
+			 ( *sector_scan )->track_is_scanned );
+		}
+		if( ( *sector_scan )->number_of_sectors_per_class != NULL )
+		{
+			memory_free(
+			 ( *sector_scan )->number_of_sectors_per_class );
+		}
+		memory_free(
+		 *sector_scan );
+
+		*sector_scan = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a sector scan
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_scan_free(
+     libodraw_sector_scan_t **sector_scan,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_sector_scan_free";
+
+	if( sector_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sector_scan != NULL )
+	{
+		if( ( *sector_scan )->anomalies != NULL )
+		{
+			memory_free(
+			 ( *sector_scan )->anomalies );
+		}
+		memory_free(
+		 ( *sector_scan )->track_is_scanned );
+
+		memory_free(
+		 ( *sector_scan )->number_of_sectors_per_class );
+
+		memory_free(
+		 *sector_scan );
+
+		*sector_scan = NULL;
+	}
+	return( 1 );
+}
+
+/* Determines if data only contains 0-byte values
+ * The data is compared a 64-bit word at a time, where 4 words are combined
+ * per iteration so that the compiler can vectorize the loop
+ * Returns 1 if the data only contains 0-byte values or 0 if not
+ */
+int libodraw_sector_scan_data_is_zero(
+     const uint8_t *data,
+     size_t data_size )
+{
+	const uint64_t *aligned_data = NULL;
+	uint64_t aligned_value       = 0;
+
+	if( data == NULL )
+	{
+		return( 0 );
+	}
+	while( ( data_size > 0 )
+	    && ( ( (intptr_t) data % sizeof( uint64_t ) ) != 0 ) )
+	{
+		if( *data != 0 )
+		{
+			return( 0 );
+		}
+		data      += 1;
+		data_size -= 1;
+	}
+	aligned_data = (const uint64_t *) data;
+
+	while( data_size >= ( 4 * sizeof( uint64_t ) ) )
+	{
+		aligned_value = aligned_data[ 0 ]
+		              | aligned_data[ 1 ]
+		              | aligned_data[ 2 ]
+		              | aligned_data[ 3 ];
+
+		if( aligned_value != 0 )
+		{
+			return( 0 );
+		}
+		aligned_data += 4;
+		data_size    -= 4 * sizeof( uint64_t );
+	}
+	while( data_size >= sizeof( uint64_t ) )
+	{
+		if( *aligned_data != 0 )
+		{
+			return( 0 );
+		}
+		aligned_data += 1;
+		data_size    -= sizeof( uint64_t );
+	}
+	data = (const uint8_t *) aligned_data;
+
+	while( data_size > 0 )
+	{
+		if( *data != 0 )
+		{
+			return( 0 );
+		}
+		data      += 1;
+		data_size -= 1;
+	}
+	return( 1 );
+}
+
+/* Classifies a mode 2 sector by its XA sub-header
+ * Returns the sector class
+ */
+uint8_t libodraw_sector_scan_classify_sub_header(
+         const uint8_t *sub_header )
+{
+	/* A mode 2 sector without a duplicated sub-header is a formless mode 2 sector
+	 */
+	if( ( sub_header[ 0 ] != sub_header[ 4 ] )
+	 || ( sub_header[ 1 ] != sub_header[ 5 ] )
+	 || ( sub_header[ 2 ] != sub_header[ 6 ] )
+	 || ( sub_header[ 3 ] != sub_header[ 7 ] ) )
+	{
+		return( LIBODRAW_SECTOR_CLASS_MODE2_FORMLESS );
+	}
+	if( sub_header[ 1 ] >= 32 )
+	{
+		return( LIBODRAW_SECTOR_CLASS_BAD_HEADER );
+	}
+	/* The form 2 flag of the sub-mode
+	 */
+	if( ( sub_header[ 2 ] & 0x20 ) != 0 )
+	{
+		return( LIBODRAW_SECTOR_CLASS_MODE2_FORM2 );
+	}
+	return( LIBODRAW_SECTOR_CLASS_MODE2_FORM1 );
+}
+
+/* Classifies a sector
+ * The sector data must contain bytes per sector bytes
+ * Sectors without synchronisation data and header are classified by their track type
+ * Returns the sector class
+ */
+uint8_t libodraw_sector_scan_classify_sector(
+         const uint8_t *sector_data,
+         uint32_t bytes_per_sector,
+         uint8_t track_type )
+{
+	if( sector_data == NULL )
+	{
+		return( LIBODRAW_SECTOR_CLASS_UNKNOWN );
+	}
+	if( libodraw_sector_scan_data_is_zero(
+	     sector_data,
+	     (size_t) bytes_per_sector ) != 0 )
+	{
+		return( LIBODRAW_SECTOR_CLASS_ZERO );
+	}
+	switch( bytes_per_sector )
+	{
+		case 2048:
+			if( ( track_type == LIBODRAW_TRACK_TYPE_MODE1_2048 )
+			 || ( track_type == LIBODRAW_TRACK_TYPE_MODE1_2352 ) )
+			{
+				return( LIBODRAW_SECTOR_CLASS_MODE1 );
+			}
+			if( ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2048 )
+			 || ( track_type == LIBODRAW_TRACK_TYPE_MODE2_2352 ) )
+			{
+				return( LIBODRAW_SECTOR_CLASS_MODE2_FORM1 );
+			}
+			break;
+
+		case 2324:
+			return( LIBODRAW_SECTOR_CLASS_MODE2_FORM2 );
+
+		case 2336:
+			return( libodraw_sector_scan_classify_sub_header(
+			         sector_data ) );
+
+		/* The 96 bytes of sub-channel data of a CD+G sector are not classified
+		 */
+		case 2352:
+		case 2448:
+			if( memory_compare(
+			     sector_data,
+			     libodraw_sector_scan_synchronisation_data,
+			     12 ) != 0 )
+			{
+				if( ( track_type == LIBODRAW_TRACK_TYPE_AUDIO )
+				 || ( track_type == LIBODRAW_TRACK_TYPE_CDG ) )
+				{
+					return( LIBODRAW_SECTOR_CLASS_AUDIO );
+				}
+				return( LIBODRAW_SECTOR_CLASS_BAD_SYNC );
+			}
+			/* The address in the header is stored as BCD minutes, seconds and frames
+			 */
+			if( ( libodraw_sector_scan_bcd_is_valid( sector_data[ 12 ], 0xa0 ) == 0 )
+			 || ( libodraw_sector_scan_bcd_is_valid( sector_data[ 13 ], 0x60 ) == 0 )
+			 || ( libodraw_sector_scan_bcd_is_valid( sector_data[ 14 ], 0x75 ) == 0 ) )
+			{
+				return( LIBODRAW_SECTOR_CLASS_BAD_HEADER );
+			}
+			switch( sector_data[ 15 ] )
+			{
+				/* A mode 0 sector contains only 0-byte values after the header
+				 */
+				case 0:
+					if( libodraw_sector_scan_data_is_zero(
+					     &( sector_data[ 16 ] ),
+					     2336 ) != 0 )
+					{
+						return( LIBODRAW_SECTOR_CLASS_ZERO );
+					}
+					break;
+
+				case 1:
+					return( LIBODRAW_SECTOR_CLASS_MODE1 );
+
+				case 2:
+					return( libodraw_sector_scan_classify_sub_header(
+					         &( sector_data[ 16 ] ) ) );
+
+				default:
+					break;
+			}
+			return( LIBODRAW_SECTOR_CLASS_BAD_HEADER );
+
+		default:
+			break;
+	}
+	return( LIBODRAW_SECTOR_CLASS_UNKNOWN );
+}
+
+/* Determines if a sector class is an anomaly for the track type
+ * All-zero sectors are not considered an anomaly since they are common in pre-gaps
+ * Returns 1 if the sector class is an anomaly or 0 if not
+ */
+int libodraw_sector_scan_is_anomaly(
+     uint8_t sector_class,
+     uint8_t track_type )
+{
+	switch( sector_class )
+	{
+		case LIBODRAW_SECTOR_CLASS_UNKNOWN:
+		case LIBODRAW_SECTOR_CLASS_ZERO:
+			return( 0 );
+
+		case LIBODRAW_SECTOR_CLASS_BAD_SYNC:
+		case LIBODRAW_SECTOR_CLASS_BAD_HEADER:
+		case LIBODRAW_SECTOR_CLASS_MISSING:
+			return( 1 );
+
+		default:
+			break;
+	}
+	switch( track_type )
+	{
+		case LIBODRAW_TRACK_TYPE_AUDIO:
+		case LIBODRAW_TRACK_TYPE_CDG:
+			return( sector_class != LIBODRAW_SECTOR_CLASS_AUDIO );
+
+		case LIBODRAW_TRACK_TYPE_MODE1_2048:
+		case LIBODRAW_TRACK_TYPE_MODE1_2352:
+			return( sector_class != LIBODRAW_SECTOR_CLASS_MODE1 );
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2048:
+			return( sector_class != LIBODRAW_SECTOR_CLASS_MODE2_FORM1 );
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2324:
+			return( sector_class != LIBODRAW_SECTOR_CLASS_MODE2_FORM2 );
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2336:
+		case LIBODRAW_TRACK_TYPE_MODE2_2352:
+		case LIBODRAW_TRACK_TYPE_CDI_2336:
+		case LIBODRAW_TRACK_TYPE_CDI_2352:
+			return( ( sector_class != LIBODRAW_SECTOR_CLASS_MODE2_FORM1 )
+			     && ( sector_class != LIBODRAW_SECTOR_CLASS_MODE2_FORM2 )
+			     && ( sector_class != LIBODRAW_SECTOR_CLASS_MODE2_FORMLESS ) );
+
+		default:
+			break;
+	}
+	return( 0 );
+}
+
+/* Appends a run of sectors of the same sector class of a track
+ * A run that is an anomaly is merged with the previous anomaly if it directly
+ * follows it and has the same sector class
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_scan_append_sectors(
+     libodraw_sector_scan_t *sector_scan,
+     int track_index,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     uint8_t sector_class,
+     uint8_t track_type,
+     libcerror_error_t **error )
+{
+	libodraw_sector_anomaly_t *anomalies = NULL;
+	libodraw_sector_anomaly_t *anomaly   = NULL;
+	static char *function                = "libodraw_sector_scan_append_sectors";
+	int maximum_number_of_anomalies      = 0;
+
+	if( sector_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( track_index < 0 )
+	 || ( track_index >= sector_scan->number_of_tracks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid track index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_class >= LIBODRAW_NUMBER_OF_SECTOR_CLASSES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported sector class.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sectors == 0 )
+	{
+		return( 1 );
+	}
+	sector_scan->number_of_sectors_per_class[ ( track_index * LIBODRAW_NUMBER_OF_SECTOR_CLASSES ) + sector_class ] += number_of_sectors;
+
+	if( libodraw_sector_scan_is_anomaly(
+	     sector_class,
+	     track_type ) == 0 )
+	{
+		return( 1 );
+	}
+	if( sector_scan->number_of_anomalies > 0 )
+	{
+		anomaly = &( sector_scan->anomalies[ sector_scan->number_of_anomalies - 1 ] );
+
+		if( ( anomaly->sector_class == sector_class )
+		 && ( ( anomaly->start_sector + anomaly->number_of_sectors ) == start_sector ) )
+		{
+			anomaly->number_of_sectors += number_of_sectors;
+
+			return( 1 );
+		}
+	}
+	if( sector_scan->number_of_anomalies >= sector_scan->maximum_number_of_anomalies )
+	{
+		if( sector_scan->maximum_number_of_anomalies == 0 )
+		{
+			maximum_number_of_anomalies = 16;
+		}
+		else if( sector_scan->maximum_number_of_anomalies < ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 / (int) sizeof( libodraw_sector_anomaly_t ) ) )
+		{
+			maximum_number_of_anomalies = sector_scan->maximum_number_of_anomalies * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of anomalies value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		anomalies = (libodraw_sector_anomaly_t *) memory_reallocate(
+		                                           sector_scan->anomalies,
+		                                           sizeof( libodraw_sector_anomaly_t ) * maximum_number_of_anomalies );
+
+		if( anomalies == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize anomalies.",
+			 function );
+
+			return( -1 );
+		}
+		sector_scan->anomalies                   = anomalies;
+		sector_scan->maximum_number_of_anomalies = maximum_number_of_anomalies;
+	}
+	anomaly = &( sector_scan->anomalies[ sector_scan->number_of_anomalies ] );
+
+	anomaly->start_sector      = start_sector;
+	anomaly->number_of_sectors = number_of_sectors;
+	anomaly->sector_class      = sector_class;
+
+	sector_scan->number_of_anomalies += 1;
+
+	return( 1 );
+}
+
+/* Classifies the sectors in the data of a track
+ * The data must contain a multitude of bytes per sector bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_scan_classify_sectors(
+     libodraw_sector_scan_t *sector_scan,
+     int track_index,
+     uint64_t start_sector,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t bytes_per_sector,
+     uint8_t track_type,
+     libcerror_error_t **error )
+{
+	static char *function    = "libodraw_sector_scan_classify_sectors";
+	size_t data_offset       = 0;
+	uint64_t run_sector      = 0;
+	uint64_t run_length      = 0;
+	uint8_t run_sector_class = 0;
+	uint8_t sector_class     = 0;
+
+	if( sector_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bytes_per_sector == 0 )
+	 || ( ( data_size % bytes_per_sector ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	run_sector = start_sector;
+
+	while( data_offset < data_size )
+	{
+		sector_class = libodraw_sector_scan_classify_sector(
+		                &( data[ data_offset ] ),
+		                bytes_per_sector,
+		                track_type );
+
+		if( ( run_length > 0 )
+		 && ( sector_class != run_sector_class ) )
+		{
+			if( libodraw_sector_scan_append_sectors(
+			     sector_scan,
+			     track_index,
+			     run_sector,
+			     run_length,
+			     run_sector_class,
+			     track_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append sectors.",
+				 function );
+
+				return( -1 );
+			}
+			run_sector += run_length;
+			run_length  = 0;
+		}
+		run_sector_class = sector_class;
+		run_length      += 1;
+		data_offset     += bytes_per_sector;
+	}
+	if( libodraw_sector_scan_append_sectors(
+	     sector_scan,
+	     track_index,
+	     run_sector,
+	     run_length,
+	     run_sector_class,
+	     track_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append sectors.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of sectors of a specific sector class of a track
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_scan_get_number_of_sectors(
+     libodraw_sector_scan_t *sector_scan,
+     int track_index,
+     uint8_t sector_class,
+     uint64_t *number_of_sectors,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_sector_scan_get_number_of_sectors";
+
+	if( sector_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( track_index < 0 )
+	 || ( track_index >= sector_scan->number_of_tracks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid track index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_class >= LIBODRAW_NUMBER_OF_SECTOR_CLASSES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported sector class.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sectors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sectors.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_sectors = sector_scan->number_of_sectors_per_class[ ( track_index * LIBODRAW_NUMBER_OF_SECTOR_CLASSES ) + sector_class ];
+
+	return( 1 );
+}
+
+/* Retrieves the number of anomalies
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_scan_get_number_of_anomalies(
+     libodraw_sector_scan_t *sector_scan,
+     int *number_of_anomalies,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_sector_scan_get_number_of_anomalies";
+
+	if( sector_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_anomalies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of anomalies.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_anomalies = sector_scan->number_of_anomalies;
+
+	return( 1 );
+}
+
+/* Retrieves a specific anomaly
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_sector_scan_get_anomaly(
+     libodraw_sector_scan_t *sector_scan,
+     int anomaly_index,
+     uint64_t *start_sector,
+     uint64_t *number_of_sectors,
+     uint8_t *sector_class,
+     libcerror_error_t **error )
+{
+	libodraw_sector_anomaly_t *anomaly = NULL;
+	static char *function              = "libodraw_sector_scan_get_anomaly";
+
+	if( sector_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( anomaly_index < 0 )
+	 || ( anomaly_index >= sector_scan->number_of_anomalies ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid anomaly index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_sector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid start sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sectors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sectors.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_class == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector class.",
+		 function );
+
+		return( -1 );
+	}
+	anomaly = &( sector_scan->anomalies[ anomaly_index ] );
+
+	*start_sector      = anomaly->start_sector;
+	*number_of_sectors = anomaly->number_of_sectors;
+	*sector_class      = anomaly->sector_class;
+
+	return( 1 );
+}
+
@@ -0,0 +1,159 @@
+/*
+ * Sector scan functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_SECTOR_SCAN_H )
+#define _LIBODRAW_SECTOR_SCAN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_definitions.h"
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define LIBODRAW_NUMBER_OF_SECTOR_CLASSES			( LIBODRAW_SECTOR_CLASS_MISSING + 1 )
+
+/* The number of sectors read from a data file at once when scanning a track
+ */
+#define LIBODRAW_SECTOR_SCAN_NUMBER_OF_SECTORS_PER_READ		64
+
+typedef struct libodraw_sector_anomaly libodraw_sector_anomaly_t;
+
+struct libodraw_sector_anomaly
+{
+	/* The start sector
+	 */
+	uint64_t start_sector;
+
+	/* The number of sectors
+	 */
+	uint64_t number_of_sectors;
+
+	/* The sector class
+	 */
+	uint8_t sector_class;
+};
+
+typedef struct libodraw_sector_scan libodraw_sector_scan_t;
+
+/* The sector scan contains the number of sectors per sector class of every track
+ * and the runs of sectors of which the sector class does not match the track type
+ */
+struct libodraw_sector_scan
+{
+	/* The number of sectors per track and sector class
+	 */
+	uint64_t *number_of_sectors_per_class;
+
+	/* Value per track to indicate the track was scanned
+	 */
+	uint8_t *track_is_scanned;
+
+	/* The number of tracks
+	 */
+	int number_of_tracks;
+
+	/* The anomalies
+	 */
+	libodraw_sector_anomaly_t *anomalies;
+
+	/* The number of anomalies
+	 */
+	int number_of_anomalies;
+
+	/* The number of allocated anomalies
+	 */
+	int maximum_number_of_anomalies;
+};
+
+int libodraw_sector_scan_initialize(
+     libodraw_sector_scan_t **sector_scan,
+     int number_of_tracks,
+     libcerror_error_t **error );
+
+int libodraw_sector_scan_free(
+     libodraw_sector_scan_t **sector_scan,
+     libcerror_error_t **error );
+
+int libodraw_sector_scan_data_is_zero(
+     const uint8_t *data,
+     size_t data_size );
+
+uint8_t libodraw_sector_scan_classify_sub_header(
+         const uint8_t *sub_header );
+
+uint8_t libodraw_sector_scan_classify_sector(
+         const uint8_t *sector_data,
+         uint32_t bytes_per_sector,
+         uint8_t track_type );
+
+int libodraw_sector_scan_is_anomaly(
+     uint8_t sector_class,
+     uint8_t track_type );
+
+int libodraw_sector_scan_append_sectors(
+     libodraw_sector_scan_t *sector_scan,
+     int track_index,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     uint8_t sector_class,
+     uint8_t track_type,
+     libcerror_error_t **error );
+
+int libodraw_sector_scan_classify_sectors(
+     libodraw_sector_scan_t *sector_scan,
+     int track_index,
+     uint64_t start_sector,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t bytes_per_sector,
+     uint8_t track_type,
+     libcerror_error_t **error );
+
+int libodraw_sector_scan_get_number_of_sectors(
+     libodraw_sector_scan_t *sector_scan,
+     int track_index,
+     uint8_t sector_class,
+     uint64_t *number_of_sectors,
+     libcerror_error_t **error );
+
+int libodraw_sector_scan_get_number_of_anomalies(
+     libodraw_sector_scan_t *sector_scan,
+     int *number_of_anomalies,
+     libcerror_error_t **error );
+
+int libodraw_sector_scan_get_anomaly(
+     libodraw_sector_scan_t *sector_scan,
+     int anomaly_index,
+     uint64_t *start_sector,
+     uint64_t *number_of_sectors,
+     uint8_t *sector_class,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_SECTOR_SCAN_H ) */
+
@@ -0,0 +1,376 @@
+/*
+ * Shared layout functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_data_file_descriptor.h"
+#include "libodraw_extent.h"
+#include "libodraw_layout_arena.h"
+#include "libodraw_libcdata.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_libcthreads.h"
+#include "libodraw_shared_layout.h"
+
+/* Creates a shared layout
+ * Make sure the value shared_layout is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_shared_layout_initialize(
+     libodraw_shared_layout_t **shared_layout,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_shared_layout_initialize";
+
+	if( shared_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( *shared_layout != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid shared layout value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*shared_layout = memory_allocate_structure(
+	                  libodraw_shared_layout_t );
+
+	if( *shared_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create shared layout.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *shared_layout,
+	     0,
+	     sizeof( libodraw_shared_layout_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear shared layout.",
+		 function );
+
+		memory_free(
+		 *shared_layout );
+
+		*shared_layout = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *shared_layout )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *shared_layout )->number_of_references = 1;
+
+	return( 1 );
+
+on_error:
+	if( *shared_layout != NULL )
+	{
+		memory_free(
+		 *shared_layout );
+
+		*shared_layout = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a shared layout
+ * The shared layout and the layout it owns are only freed when its last reference is removed
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_shared_layout_free(
+     libodraw_shared_layout_t **shared_layout,
+     libcerror_error_t **error )
+{
+	static char *function    = "libodraw_shared_layout_free";
+	int number_of_references = 0;
+	int result               = 1;
+
+	if( shared_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( *shared_layout != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     ( *shared_layout )->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		( *shared_layout )->number_of_references -= 1;
+
+		number_of_references = ( *shared_layout )->number_of_references;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     ( *shared_layout )->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( number_of_references <= 0 )
+		{
+			if( libcdata_array_free(
+			     &( ( *shared_layout )->data_file_descriptors_array ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_data_file_descriptor_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data file descriptors array.",
+				 function );
+
+				result = -1;
+			}
+			if( libodraw_layout_arena_free(
+			     &( ( *shared_layout )->layout_arena ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free layout arena.",
+				 function );
+
+				result = -1;
+			}
+			if( libcdata_array_free(
+			     &( ( *shared_layout )->extents_array ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libodraw_extent_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free extents array.",
+				 function );
+
+				result = -1;
+			}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( libcthreads_mutex_free(
+			     &( ( *shared_layout )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+#endif
+			memory_free(
+			 *shared_layout );
+		}
+		*shared_layout = NULL;
+	}
+	return( result );
+}
+
+/* Adds a reference to the shared layout
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_shared_layout_add_reference(
+     libodraw_shared_layout_t *shared_layout,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_shared_layout_add_reference";
+
+	if( shared_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared layout.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     shared_layout->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	shared_layout->number_of_references += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     shared_layout->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of references
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_shared_layout_get_number_of_references(
+     libodraw_shared_layout_t *shared_layout,
+     int *number_of_references,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_shared_layout_get_number_of_references";
+
+	if( shared_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_references == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of references.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     shared_layout->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_references = shared_layout->number_of_references;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     shared_layout->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
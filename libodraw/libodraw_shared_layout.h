@@ -0,0 +1,91 @@
+/*
+ * Shared layout functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBODRAW_SHARED_LAYOUT_H )
+#define _LIBODRAW_SHARED_LAYOUT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_layout_arena.h"
+#include "libodraw_libcdata.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libodraw_shared_layout libodraw_shared_layout_t;
+
+/* The shared layout owns the parsed layout of a handle once it is shared with cloned handles
+ * The layout is read-only while shared and freed when its last reference is removed
+ */
+struct libodraw_shared_layout
+{
+	/* The data file descriptors array
+	 */
+	libcdata_array_t *data_file_descriptors_array;
+
+	/* The layout arena
+	 */
+	libodraw_layout_arena_t *layout_arena;
+
+	/* The extents array
+	 */
+	libcdata_array_t *extents_array;
+
+	/* The number of references
+	 */
+	int number_of_references;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the number of references, since the handles
+	 * that share the layout can be freed by different threads
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libodraw_shared_layout_initialize(
+     libodraw_shared_layout_t **shared_layout,
+     libcerror_error_t **error );
+
+int libodraw_shared_layout_free(
+     libodraw_shared_layout_t **shared_layout,
+     libcerror_error_t **error );
+
+int libodraw_shared_layout_add_reference(
+     libodraw_shared_layout_t *shared_layout,
+     libcerror_error_t **error );
+
+int libodraw_shared_layout_get_number_of_references(
+     libodraw_shared_layout_t *shared_layout,
+     int *number_of_references,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_SHARED_LAYOUT_H ) */
+
@@ -0,0 +1,495 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_TIME_H ) && !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "libodraw_definitions.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_statistics.h"
+
+/* Creates statistics
+ * Make sure the value statistics is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_statistics_initialize(
+     libodraw_statistics_t **statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_statistics_initialize";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *statistics != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid statistics value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*statistics = memory_allocate_structure(
+	               libodraw_statistics_t );
+
+	if( *statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *statistics,
+	     0,
+	     sizeof( libodraw_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *statistics != NULL )
+	{
+		memory_free(
+		 *statistics );
+
+		*statistics = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_statistics_free(
+     libodraw_statistics_t **statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_statistics_free";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *statistics != NULL )
+	{
+		if( ( *statistics )->data_files != NULL )
+		{
+			memory_free(
+			 ( *statistics )->data_files );
+		}
+		memory_free(
+		 *statistics );
+
+		*statistics = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the data file statistics
+ * The statistics of data files that remain are retained
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_statistics_resize(
+     libodraw_statistics_t *statistics,
+     int number_of_data_files,
+     libcerror_error_t **error )
+{
+	libodraw_data_file_statistics_t *data_files = NULL;
+	static char *function                       = "libodraw_statistics_resize";
+	size_t data_files_size                      = 0;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_data_files < 0 )
+	 || ( (size_t) number_of_data_files > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libodraw_data_file_statistics_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of data files value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_data_files == statistics->number_of_data_files )
+	{
+		return( 1 );
+	}
+	if( number_of_data_files == 0 )
+	{
+		if( statistics->data_files != NULL )
+		{
+			memory_free(
+			 statistics->data_files );
+
+			statistics->data_files = NULL;
+		}
+		statistics->number_of_data_files = 0;
+
+		return( 1 );
+	}
+	data_files_size = sizeof( libodraw_data_file_statistics_t ) * number_of_data_files;
+
+	data_files = (libodraw_data_file_statistics_t *) memory_reallocate(
+	                                                  statistics->data_files,
+	                                                  data_files_size );
+
+	if( data_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize data file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	statistics->data_files = data_files;
+
+	if( number_of_data_files > statistics->number_of_data_files )
+	{
+		if( memory_set(
+		     &( data_files[ statistics->number_of_data_files ] ),
+		     0,
+		     sizeof( libodraw_data_file_statistics_t ) * ( number_of_data_files - statistics->number_of_data_files ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear data file statistics.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	statistics->number_of_data_files = number_of_data_files;
+
+	return( 1 );
+}
+
+/* Resets the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_statistics_reset(
+     libodraw_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_statistics_reset";
+	int data_file_index   = 0;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	LIBODRAW_STATISTICS_SET( statistics->number_of_reads, 0 );
+	LIBODRAW_STATISTICS_SET( statistics->number_of_bytes_read, 0 );
+	LIBODRAW_STATISTICS_SET( statistics->number_of_seeks, 0 );
+	LIBODRAW_STATISTICS_SET( statistics->number_of_pool_opens, 0 );
+	LIBODRAW_STATISTICS_SET( statistics->number_of_pool_closes, 0 );
+	LIBODRAW_STATISTICS_SET( statistics->number_of_converted_sectors, 0 );
+	LIBODRAW_STATISTICS_SET( statistics->read_time, 0 );
+	LIBODRAW_STATISTICS_SET( statistics->copy_time, 0 );
+	LIBODRAW_STATISTICS_SET( statistics->number_of_cache_hits, 0 );
+	LIBODRAW_STATISTICS_SET( statistics->number_of_cache_misses, 0 );
+
+	for( data_file_index = 0;
+	     data_file_index < statistics->number_of_data_files;
+	     data_file_index++ )
+	{
+		LIBODRAW_STATISTICS_SET( statistics->data_files[ data_file_index ].number_of_reads, 0 );
+		LIBODRAW_STATISTICS_SET( statistics->data_files[ data_file_index ].number_of_bytes_read, 0 );
+		LIBODRAW_STATISTICS_SET( statistics->data_files[ data_file_index ].number_of_seeks, 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a statistics value
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_statistics_get_value(
+     libodraw_statistics_t *statistics,
+     int value_type,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_statistics_get_value";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	switch( value_type )
+	{
+		case LIBODRAW_STATISTICS_VALUE_TYPE_NUMBER_OF_READS:
+			*value = LIBODRAW_STATISTICS_GET( statistics->number_of_reads );
+			break;
+
+		case LIBODRAW_STATISTICS_VALUE_TYPE_NUMBER_OF_BYTES_READ:
+			*value = LIBODRAW_STATISTICS_GET( statistics->number_of_bytes_read );
+			break;
+
+		case LIBODRAW_STATISTICS_VALUE_TYPE_NUMBER_OF_SEEKS:
+			*value = LIBODRAW_STATISTICS_GET( statistics->number_of_seeks );
+			break;
+
+		case LIBODRAW_STATISTICS_VALUE_TYPE_NUMBER_OF_POOL_OPENS:
+			*value = LIBODRAW_STATISTICS_GET( statistics->number_of_pool_opens );
+			break;
+
+		case LIBODRAW_STATISTICS_VALUE_TYPE_NUMBER_OF_POOL_CLOSES:
+			*value = LIBODRAW_STATISTICS_GET( statistics->number_of_pool_closes );
+			break;
+
+		case LIBODRAW_STATISTICS_VALUE_TYPE_NUMBER_OF_CONVERTED_SECTORS:
+			*value = LIBODRAW_STATISTICS_GET( statistics->number_of_converted_sectors );
+			break;
+
+		case LIBODRAW_STATISTICS_VALUE_TYPE_READ_TIME:
+			*value = LIBODRAW_STATISTICS_GET( statistics->read_time );
+			break;
+
+		case LIBODRAW_STATISTICS_VALUE_TYPE_COPY_TIME:
+			*value = LIBODRAW_STATISTICS_GET( statistics->copy_time );
+			break;
+
+		case LIBODRAW_STATISTICS_VALUE_TYPE_NUMBER_OF_CACHE_HITS:
+			*value = LIBODRAW_STATISTICS_GET( statistics->number_of_cache_hits );
+			break;
+
+		case LIBODRAW_STATISTICS_VALUE_TYPE_NUMBER_OF_CACHE_MISSES:
+			*value = LIBODRAW_STATISTICS_GET( statistics->number_of_cache_misses );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value type: %d.",
+			 function,
+			 value_type );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a statistics value of a specific data file
+ * Only the number of reads, bytes read and seeks are maintained per data file
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_statistics_get_data_file_value(
+     libodraw_statistics_t *statistics,
+     int data_file_index,
+     int value_type,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_statistics_get_data_file_value";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_file_index < 0 )
+	 || ( data_file_index >= statistics->number_of_data_files ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data file index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	switch( value_type )
+	{
+		case LIBODRAW_STATISTICS_VALUE_TYPE_NUMBER_OF_READS:
+			*value = LIBODRAW_STATISTICS_GET( statistics->data_files[ data_file_index ].number_of_reads );
+			break;
+
+		case LIBODRAW_STATISTICS_VALUE_TYPE_NUMBER_OF_BYTES_READ:
+			*value = LIBODRAW_STATISTICS_GET( statistics->data_files[ data_file_index ].number_of_bytes_read );
+			break;
+
+		case LIBODRAW_STATISTICS_VALUE_TYPE_NUMBER_OF_SEEKS:
+			*value = LIBODRAW_STATISTICS_GET( statistics->data_files[ data_file_index ].number_of_seeks );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value type: %d.",
+			 function,
+			 value_type );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the current time of a monotonic clock in nanoseconds
+ * The current time is 0 if no monotonic clock is available
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_statistics_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+#endif
+
+	static char *function = "libodraw_statistics_get_current_time";
+
+	if( current_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current time.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = 0;
+
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) != 0 )
+	 && ( QueryPerformanceCounter(
+	       &counter ) != 0 )
+	 && ( frequency.QuadPart > 0 ) )
+	{
+		*current_time = ( (uint64_t) ( counter.QuadPart / frequency.QuadPart ) * 1000000000UL )
+		              + ( ( (uint64_t) ( counter.QuadPart % frequency.QuadPart ) * 1000000000UL ) / (uint64_t) frequency.QuadPart );
+	}
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) == 0 )
+	{
+		*current_time = ( (uint64_t) time_value.tv_sec * 1000000000UL )
+		              + (uint64_t) time_value.tv_nsec;
+	}
+#endif
+	return( 1 );
+}
+
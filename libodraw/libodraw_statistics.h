@@ -0,0 +1,191 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_STATISTICS_H )
+#define _LIBODRAW_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The statistics counters are updated with relaxed atomic operations where
+ * the compiler supports them, so that they can be retrieved by another thread
+ * while the handle is being read. Otherwise the statistics should only be
+ * retrieved by the thread that reads from the handle.
+ */
+#if defined( __GNUC__ ) && defined( __ATOMIC_RELAXED ) && ( __GCC_ATOMIC_LLONG_LOCK_FREE == 2 )
+#define LIBODRAW_STATISTICS_ADD( counter, value ) \
+	__atomic_fetch_add( &( counter ), (uint64_t) ( value ), __ATOMIC_RELAXED )
+
+#define LIBODRAW_STATISTICS_GET( counter ) \
+	__atomic_load_n( &( counter ), __ATOMIC_RELAXED )
+
+#define LIBODRAW_STATISTICS_SET( counter, value ) \
+	__atomic_store_n( &( counter ), (uint64_t) ( value ), __ATOMIC_RELAXED )
+
+#elif defined( _MSC_VER ) && defined( _WIN64 )
+#define LIBODRAW_STATISTICS_ADD( counter, value ) \
+	InterlockedExchangeAdd64( (volatile LONG64 *) &( counter ), (LONG64) ( value ) )
+
+#define LIBODRAW_STATISTICS_GET( counter ) \
+	(uint64_t) InterlockedOr64( (volatile LONG64 *) &( counter ), 0 )
+
+#define LIBODRAW_STATISTICS_SET( counter, value ) \
+	InterlockedExchange64( (volatile LONG64 *) &( counter ), (LONG64) ( value ) )
+
+#else
+#define LIBODRAW_STATISTICS_ADD( counter, value ) \
+	( counter ) += (uint64_t) ( value )
+
+#define LIBODRAW_STATISTICS_GET( counter ) \
+	( counter )
+
+#define LIBODRAW_STATISTICS_SET( counter, value ) \
+	( counter ) = (uint64_t) ( value )
+
+#endif
+
+typedef struct libodraw_data_file_statistics libodraw_data_file_statistics_t;
+
+struct libodraw_data_file_statistics
+{
+	/* The number of reads
+	 */
+	uint64_t number_of_reads;
+
+	/* The number of bytes read
+	 */
+	uint64_t number_of_bytes_read;
+
+	/* The number of seeks
+	 */
+	uint64_t number_of_seeks;
+
+	/* The offset directly after the last read, used to detect seeks
+	 */
+	off64_t last_read_end_offset;
+};
+
+typedef struct libodraw_statistics libodraw_statistics_t;
+
+/* The statistics counters are updated by the read functions of the handle
+ * using LIBODRAW_STATISTICS_ADD and retrieved using LIBODRAW_STATISTICS_GET
+ */
+struct libodraw_statistics
+{
+	/* The number of reads
+	 */
+	uint64_t number_of_reads;
+
+	/* The number of bytes read
+	 */
+	uint64_t number_of_bytes_read;
+
+	/* The number of seeks
+	 */
+	uint64_t number_of_seeks;
+
+	/* The number of data files opened by the pool when a maximum number of open handles is set
+	 */
+	uint64_t number_of_pool_opens;
+
+	/* The number of data files closed by the pool to respect the maximum number of open handles
+	 */
+	uint64_t number_of_pool_closes;
+
+	/* The number of raw sectors converted into cooked sectors
+	 */
+	uint64_t number_of_converted_sectors;
+
+	/* The time spent reading the data files in nanoseconds
+	 */
+	uint64_t read_time;
+
+	/* The time spent converting sector data in nanoseconds
+	 */
+	uint64_t copy_time;
+
+	/* The number of layout cache hits
+	 */
+	uint64_t number_of_cache_hits;
+
+	/* The number of layout cache misses
+	 */
+	uint64_t number_of_cache_misses;
+
+	/* The data file statistics
+	 */
+	libodraw_data_file_statistics_t *data_files;
+
+	/* The number of data files
+	 */
+	int number_of_data_files;
+
+	/* Value to indicate the time spent should be measured
+	 */
+	uint8_t collect_timing;
+};
+
+int libodraw_statistics_initialize(
+     libodraw_statistics_t **statistics,
+     libcerror_error_t **error );
+
+int libodraw_statistics_free(
+     libodraw_statistics_t **statistics,
+     libcerror_error_t **error );
+
+int libodraw_statistics_resize(
+     libodraw_statistics_t *statistics,
+     int number_of_data_files,
+     libcerror_error_t **error );
+
+int libodraw_statistics_reset(
+     libodraw_statistics_t *statistics,
+     libcerror_error_t **error );
+
+int libodraw_statistics_get_value(
+     libodraw_statistics_t *statistics,
+     int value_type,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int libodraw_statistics_get_data_file_value(
+     libodraw_statistics_t *statistics,
+     int data_file_index,
+     int value_type,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int libodraw_statistics_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_STATISTICS_H ) */
+
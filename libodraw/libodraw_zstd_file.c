@@ -0,0 +1,1105 @@
+/*
+ * Seekable zstd file functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libodraw_block_cache.h"
+#include "libodraw_compression.h"
+#include "libodraw_definitions.h"
+#include "libodraw_libbfio.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_libcnotify.h"
+#include "libodraw_libcthreads.h"
+#include "libodraw_zstd_file.h"
+
+#include "zstd_file.h"
+
+/* The signatures are stored little-endian
+ */
+#define ZSTD_SEEK_TABLE_HEADER_SIGNATURE		0x184d2a5eUL
+#define ZSTD_SEEK_TABLE_FOOTER_SIGNATURE		0x8f92eab1UL
+
+/* The seek table descriptor flags
+ */
+#define ZSTD_SEEK_TABLE_FLAG_HAS_CHECKSUMS		0x80
+#define ZSTD_SEEK_TABLE_FLAGS_RESERVED			0x7c
+
+/* Creates a zstd file
+ * Make sure the value zstd_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_zstd_file_initialize(
+     libodraw_zstd_file_t **zstd_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_zstd_file_initialize";
+
+	if( zstd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zstd file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *zstd_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid zstd file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*zstd_file = memory_allocate_structure(
+	              libodraw_zstd_file_t );
+
+	if( *zstd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create zstd file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *zstd_file,
+	     0,
+	     sizeof( libodraw_zstd_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear zstd file.",
+		 function );
+
+		memory_free(
+		 *zstd_file );
+
+		*zstd_file = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *zstd_file )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *zstd_file != NULL )
+	{
+		memory_free(
+		 *zstd_file );
+
+		*zstd_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a zstd file
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_zstd_file_free(
+     libodraw_zstd_file_t **zstd_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_zstd_file_free";
+	int result            = 1;
+
+	if( zstd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zstd file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *zstd_file != NULL )
+	{
+		if( ( *zstd_file )->block_cache != NULL )
+		{
+			if( libodraw_block_cache_free(
+			     &( ( *zstd_file )->block_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free block cache.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *zstd_file )->frame_descriptors != NULL )
+		{
+			memory_free(
+			 ( *zstd_file )->frame_descriptors );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *zstd_file )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *zstd_file );
+
+		*zstd_file = NULL;
+	}
+	return( result );
+}
+
+/* Opens a zstd file for reading
+ * The file IO handle must remain open until the zstd file is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_zstd_file_open_read(
+     libodraw_zstd_file_t *zstd_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_zstd_file_open_read";
+
+	if( zstd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zstd file.",
+		 function );
+
+		return( -1 );
+	}
+	if( zstd_file->frame_descriptors != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid zstd file - frame descriptors value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_zstd_file_read_seek_table(
+	     zstd_file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read seek table.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every cache entry holds a frame of the largest decompressed size
+	 */
+	if( libodraw_block_cache_initialize(
+	     &( zstd_file->block_cache ),
+	     zstd_file->number_of_frames,
+	     (size_t) zstd_file->maximum_frame_size,
+	     (intptr_t *) zstd_file,
+	     (int (*)(intptr_t *, uint32_t, uint8_t *, size_t, libcerror_error_t **)) &libodraw_zstd_file_read_frame,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block cache.",
+		 function );
+
+		return( -1 );
+	}
+	zstd_file->file_io_handle = file_io_handle;
+
+	return( 1 );
+}
+
+/* Reads the seek table
+ * The seek table is stored in a skippable frame at the end of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_zstd_file_read_seek_table(
+     libodraw_zstd_file_t *zstd_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	zstd_seek_table_footer_t seek_table_footer;
+	zstd_seek_table_header_t seek_table_header;
+
+	libodraw_zstd_frame_descriptor_t *frame_descriptor = NULL;
+	uint8_t *seek_table_data                           = NULL;
+	static char *function                              = "libodraw_zstd_file_read_seek_table";
+	size64_t file_size                                 = 0;
+	size64_t seek_table_size                           = 0;
+	size_t entries_data_offset                         = 0;
+	size_t entries_data_size                           = 0;
+	size_t entry_size                                  = 0;
+	ssize_t read_count                                 = 0;
+	uint64_t compressed_offset                         = 0;
+	uint64_t data_offset                               = 0;
+	uint32_t frame_index                               = 0;
+	uint32_t frame_size                                = 0;
+	uint32_t signature                                 = 0;
+
+	if( zstd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zstd file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_size < (size64_t) ( sizeof( zstd_seek_table_header_t ) + sizeof( zstd_seek_table_footer_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &seek_table_footer,
+	              sizeof( zstd_seek_table_footer_t ),
+	              (off64_t) ( file_size - sizeof( zstd_seek_table_footer_t ) ),
+	              error );
+
+	if( read_count != (ssize_t) sizeof( zstd_seek_table_footer_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read seek table footer.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: seek table footer data:\n",
+		 function );
+		libcnotify_print_data(
+		 (uint8_t *) &seek_table_footer,
+		 sizeof( zstd_seek_table_footer_t ),
+		 0 );
+	}
+#endif
+	byte_stream_copy_to_uint32_little_endian(
+	 seek_table_footer.signature,
+	 signature );
+
+	if( signature != ZSTD_SEEK_TABLE_FOOTER_SIGNATURE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid seek table footer signature.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( seek_table_footer.descriptor & ZSTD_SEEK_TABLE_FLAGS_RESERVED ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported seek table descriptor: 0x%02" PRIx8 ".",
+		 function,
+		 seek_table_footer.descriptor );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 seek_table_footer.number_of_frames,
+	 zstd_file->number_of_frames );
+
+	/* The frame checksums are not used since zstd validates the frame content checksum if present
+	 */
+	entry_size = sizeof( zstd_seek_table_entry_t );
+
+	if( ( seek_table_footer.descriptor & ZSTD_SEEK_TABLE_FLAG_HAS_CHECKSUMS ) != 0 )
+	{
+		entry_size += 4;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of frames\t\t\t: %" PRIu32 "\n",
+		 function,
+		 zstd_file->number_of_frames );
+
+		libcnotify_printf(
+		 "%s: descriptor\t\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 seek_table_footer.descriptor );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( ( zstd_file->number_of_frames == 0 )
+	 || ( (size_t) zstd_file->number_of_frames > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / entry_size ) )
+	 || ( (size_t) zstd_file->number_of_frames > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libodraw_zstd_frame_descriptor_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of frames value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	entries_data_size = (size_t) zstd_file->number_of_frames * entry_size;
+	seek_table_size   = (size64_t) sizeof( zstd_seek_table_header_t ) + entries_data_size + sizeof( zstd_seek_table_footer_t );
+
+	if( ( seek_table_size > file_size )
+	 || ( seek_table_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid seek table size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The header, entries and footer are read at once
+	 */
+	seek_table_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * (size_t) seek_table_size );
+
+	if( seek_table_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create seek table data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              seek_table_data,
+	              (size_t) seek_table_size,
+	              (off64_t) ( file_size - seek_table_size ),
+	              error );
+
+	if( read_count != (ssize_t) seek_table_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read seek table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     &seek_table_header,
+	     seek_table_data,
+	     sizeof( zstd_seek_table_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy seek table header.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 seek_table_header.signature,
+	 signature );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 seek_table_header.frame_size,
+	 frame_size );
+
+	if( signature != ZSTD_SEEK_TABLE_HEADER_SIGNATURE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid seek table header signature.",
+		 function );
+
+		goto on_error;
+	}
+	if( (size64_t) frame_size != ( seek_table_size - sizeof( zstd_seek_table_header_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid seek table frame size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	zstd_file->frame_descriptors = (libodraw_zstd_frame_descriptor_t *) memory_allocate(
+	                                                                     sizeof( libodraw_zstd_frame_descriptor_t ) * zstd_file->number_of_frames );
+
+	if( zstd_file->frame_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create frame descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	entries_data_offset = sizeof( zstd_seek_table_header_t );
+
+	for( frame_index = 0;
+	     frame_index < zstd_file->number_of_frames;
+	     frame_index++ )
+	{
+		frame_descriptor = &( zstd_file->frame_descriptors[ frame_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (zstd_seek_table_entry_t *) &( seek_table_data[ entries_data_offset ] ) )->compressed_size,
+		 frame_descriptor->size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (zstd_seek_table_entry_t *) &( seek_table_data[ entries_data_offset ] ) )->decompressed_size,
+		 frame_descriptor->data_size );
+
+		entries_data_offset += entry_size;
+
+		if( frame_descriptor->data_size > (uint32_t) LIBODRAW_ZSTD_FILE_MAXIMUM_FRAME_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported frame: %" PRIu32 " decompressed size: %" PRIu32 ".",
+			 function,
+			 frame_index,
+			 frame_descriptor->data_size );
+
+			goto on_error;
+		}
+		frame_descriptor->offset      = compressed_offset;
+		frame_descriptor->data_offset = data_offset;
+
+		compressed_offset += frame_descriptor->size;
+		data_offset       += frame_descriptor->data_size;
+
+		if( frame_descriptor->data_size > zstd_file->maximum_frame_size )
+		{
+			zstd_file->maximum_frame_size = frame_descriptor->data_size;
+		}
+	}
+	/* The frames are stored consecutively before the seek table
+	 */
+	if( compressed_offset > ( file_size - seek_table_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed frame sizes value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( zstd_file->maximum_frame_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum frame size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	zstd_file->data_size = (size64_t) data_offset;
+
+	memory_free(
+	 seek_table_data );
+
+	return( 1 );
+
+on_error:
+	if( zstd_file->frame_descriptors != NULL )
+	{
+		memory_free(
+		 zstd_file->frame_descriptors );
+
+		zstd_file->frame_descriptors = NULL;
+	}
+	if( seek_table_data != NULL )
+	{
+		memory_free(
+		 seek_table_data );
+	}
+	zstd_file->number_of_frames   = 0;
+	zstd_file->maximum_frame_size = 0;
+
+	return( -1 );
+}
+
+/* Reads and decompresses a frame
+ * This function can be called by the read-ahead threads, the zstd file mutex is
+ * only held while the file IO handle is used
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_zstd_file_read_frame(
+     libodraw_zstd_file_t *zstd_file,
+     uint32_t frame_index,
+     uint8_t *frame_data,
+     size_t frame_data_size,
+     libcerror_error_t **error )
+{
+	libodraw_zstd_frame_descriptor_t *frame_descriptor = NULL;
+	uint8_t *compressed_data                           = NULL;
+	static char *function                              = "libodraw_zstd_file_read_frame";
+	ssize_t read_count                                 = 0;
+
+	if( zstd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zstd file.",
+		 function );
+
+		return( -1 );
+	}
+	if( zstd_file->frame_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid zstd file - missing frame descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( frame_index >= zstd_file->number_of_frames )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid frame index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( frame_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frame data.",
+		 function );
+
+		return( -1 );
+	}
+	frame_descriptor = &( zstd_file->frame_descriptors[ frame_index ] );
+
+	if( frame_data_size < (size_t) frame_descriptor->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid frame data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( frame_descriptor->size == 0 )
+	 || ( frame_descriptor->size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid frame: %" PRIu32 " compressed size value out of bounds.",
+		 function,
+		 frame_index );
+
+		return( -1 );
+	}
+	compressed_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * frame_descriptor->size );
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     zstd_file->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              zstd_file->file_io_handle,
+	              compressed_data,
+	              (size_t) frame_descriptor->size,
+	              (off64_t) frame_descriptor->offset,
+	              error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     zstd_file->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( read_count != (ssize_t) frame_descriptor->size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read frame: %" PRIu32 " data at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+		 function,
+		 frame_index,
+		 frame_descriptor->offset,
+		 frame_descriptor->offset );
+
+		goto on_error;
+	}
+	if( libodraw_decompress_data(
+	     compressed_data,
+	     (size_t) frame_descriptor->size,
+	     LIBODRAW_COMPRESSION_METHOD_ZSTD,
+	     frame_data,
+	     (size_t) frame_descriptor->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress frame: %" PRIu32 ".",
+		 function,
+		 frame_index );
+
+		goto on_error;
+	}
+	memory_free(
+	 compressed_data );
+
+	return( 1 );
+
+on_error:
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the index of the frame that contains a specific offset of the decompressed data
+ * Returns 1 if successful, 0 if no such frame or -1 on error
+ */
+int libodraw_zstd_file_get_frame_index_at_offset(
+     libodraw_zstd_file_t *zstd_file,
+     off64_t offset,
+     uint32_t *frame_index,
+     libcerror_error_t **error )
+{
+	libodraw_zstd_frame_descriptor_t *frame_descriptor = NULL;
+	static char *function                              = "libodraw_zstd_file_get_frame_index_at_offset";
+	uint32_t first_frame_index                         = 0;
+	uint32_t last_frame_index                          = 0;
+	uint32_t middle_frame_index                        = 0;
+
+	if( zstd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zstd file.",
+		 function );
+
+		return( -1 );
+	}
+	if( zstd_file->frame_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid zstd file - missing frame descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( frame_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frame index.",
+		 function );
+
+		return( -1 );
+	}
+	/* The frames are sorted by data offset, frames without data never contain the offset
+	 */
+	last_frame_index = zstd_file->number_of_frames;
+
+	while( first_frame_index < last_frame_index )
+	{
+		middle_frame_index = first_frame_index + ( ( last_frame_index - first_frame_index ) / 2 );
+		frame_descriptor   = &( zstd_file->frame_descriptors[ middle_frame_index ] );
+
+		if( (uint64_t) offset < frame_descriptor->data_offset )
+		{
+			last_frame_index = middle_frame_index;
+		}
+		else if( (uint64_t) offset >= ( frame_descriptor->data_offset + frame_descriptor->data_size ) )
+		{
+			first_frame_index = middle_frame_index + 1;
+		}
+		else
+		{
+			*frame_index = middle_frame_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Reads data at a specific offset of the decompressed data
+ * Only the frames that contain the requested range are decompressed
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libodraw_zstd_file_read_buffer_at_offset(
+         libodraw_zstd_file_t *zstd_file,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libodraw_zstd_frame_descriptor_t *frame_descriptor = NULL;
+	const uint8_t *frame_data                          = NULL;
+	static char *function                              = "libodraw_zstd_file_read_buffer_at_offset";
+	size_t buffer_offset                               = 0;
+	size_t data_offset                                 = 0;
+	size_t read_size                                   = 0;
+	uint32_t frame_index                               = 0;
+	int result                                         = 0;
+
+	if( zstd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zstd file.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= zstd_file->data_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( zstd_file->data_size - (size64_t) offset ) )
+	{
+		buffer_size = (size_t) ( zstd_file->data_size - (size64_t) offset );
+	}
+	result = libodraw_zstd_file_get_frame_index_at_offset(
+	          zstd_file,
+	          offset,
+	          &frame_index,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve frame index at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		if( frame_index >= zstd_file->number_of_frames )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid frame index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		frame_descriptor = &( zstd_file->frame_descriptors[ frame_index ] );
+
+		/* Frames without data are skipped
+		 */
+		if( frame_descriptor->data_size == 0 )
+		{
+			frame_index++;
+
+			continue;
+		}
+		data_offset = (size_t) ( (uint64_t) offset - frame_descriptor->data_offset );
+		read_size   = (size_t) frame_descriptor->data_size - data_offset;
+
+		if( read_size > ( buffer_size - buffer_offset ) )
+		{
+			read_size = buffer_size - buffer_offset;
+		}
+		if( libodraw_block_cache_get_block_data(
+		     zstd_file->block_cache,
+		     frame_index,
+		     &frame_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve frame: %" PRIu32 " data.",
+			 function,
+			 frame_index );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     &( frame_data[ data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy frame data.",
+			 function );
+
+			return( -1 );
+		}
+		buffer_offset += read_size;
+		offset        += (off64_t) read_size;
+
+		frame_index++;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Retrieves the size of the decompressed data
+ * Returns 1 if successful or -1 on error
+ */
+int libodraw_zstd_file_get_data_size(
+     libodraw_zstd_file_t *zstd_file,
+     size64_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libodraw_zstd_file_get_data_size";
+
+	if( zstd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zstd file.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = zstd_file->data_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,145 @@
+/*
+ * Seekable zstd file functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBODRAW_ZSTD_FILE_H )
+#define _LIBODRAW_ZSTD_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libodraw_block_cache.h"
+#include "libodraw_libbfio.h"
+#include "libodraw_libcerror.h"
+#include "libodraw_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum decompressed size of a frame, which bounds the size of the frame cache
+ */
+#define LIBODRAW_ZSTD_FILE_MAXIMUM_FRAME_SIZE			( 16 * 1024 * 1024 )
+
+typedef struct libodraw_zstd_frame_descriptor libodraw_zstd_frame_descriptor_t;
+
+struct libodraw_zstd_frame_descriptor
+{
+	/* The offset of the compressed frame in the file
+	 */
+	uint64_t offset;
+
+	/* The offset of the frame data in the decompressed data
+	 */
+	uint64_t data_offset;
+
+	/* The compressed size
+	 */
+	uint32_t size;
+
+	/* The decompressed size
+	 */
+	uint32_t data_size;
+};
+
+typedef struct libodraw_zstd_file libodraw_zstd_file_t;
+
+struct libodraw_zstd_file
+{
+	/* The number of frames
+	 */
+	uint32_t number_of_frames;
+
+	/* The frame descriptors
+	 */
+	libodraw_zstd_frame_descriptor_t *frame_descriptors;
+
+	/* The largest decompressed size of a frame
+	 */
+	uint32_t maximum_frame_size;
+
+	/* The size of the decompressed data
+	 */
+	size64_t data_size;
+
+	/* The file IO handle of the zstd file
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The block cache of decompressed frames
+	 */
+	libodraw_block_cache_t *block_cache;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the file IO handle
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libodraw_zstd_file_initialize(
+     libodraw_zstd_file_t **zstd_file,
+     libcerror_error_t **error );
+
+int libodraw_zstd_file_free(
+     libodraw_zstd_file_t **zstd_file,
+     libcerror_error_t **error );
+
+int libodraw_zstd_file_open_read(
+     libodraw_zstd_file_t *zstd_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libodraw_zstd_file_read_seek_table(
+     libodraw_zstd_file_t *zstd_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libodraw_zstd_file_read_frame(
+     libodraw_zstd_file_t *zstd_file,
+     uint32_t frame_index,
+     uint8_t *frame_data,
+     size_t frame_data_size,
+     libcerror_error_t **error );
+
+int libodraw_zstd_file_get_frame_index_at_offset(
+     libodraw_zstd_file_t *zstd_file,
+     off64_t offset,
+     uint32_t *frame_index,
+     libcerror_error_t **error );
+
+ssize_t libodraw_zstd_file_read_buffer_at_offset(
+         libodraw_zstd_file_t *zstd_file,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libodraw_zstd_file_get_data_size(
+     libodraw_zstd_file_t *zstd_file,
+     size64_t *data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBODRAW_ZSTD_FILE_H ) */
+
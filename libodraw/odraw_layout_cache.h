@@ -0,0 +1,157 @@
+/*
+ * The layout cache file format definitions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ODRAW_LAYOUT_CACHE_H )
+#define _ODRAW_LAYOUT_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct odraw_layout_cache_header odraw_layout_cache_header_t;
+
+struct odraw_layout_cache_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * "ODRAWLC\x00"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The data size, including the header
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_size[ 4 ];
+
+	/* The table of contents (TOC) file size
+	 * Consists of 8 bytes
+	 */
+	uint8_t toc_file_size[ 8 ];
+
+	/* The table of contents (TOC) file modification time
+	 * Consists of 8 bytes
+	 */
+	uint8_t toc_file_modification_time[ 8 ];
+
+	/* The number of data files
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_data_files[ 4 ];
+
+	/* The number of sessions
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_sessions[ 4 ];
+
+	/* The number of run-outs
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_run_outs[ 4 ];
+
+	/* The number of lead-outs
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_lead_outs[ 4 ];
+
+	/* The number of tracks
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_tracks[ 4 ];
+};
+
+typedef struct odraw_layout_cache_data_file odraw_layout_cache_data_file_t;
+
+struct odraw_layout_cache_data_file
+{
+	/* The type
+	 * Consists of 1 byte
+	 */
+	uint8_t type;
+
+	/* The name size, including the end-of-string character
+	 * Consists of 2 bytes
+	 */
+	uint8_t name_size[ 2 ];
+
+	/* The name
+	 * Consists of name size bytes
+	 */
+};
+
+typedef struct odraw_layout_cache_sector_range odraw_layout_cache_sector_range_t;
+
+struct odraw_layout_cache_sector_range
+{
+	/* The start sector
+	 * Consists of 8 bytes
+	 */
+	uint8_t start_sector[ 8 ];
+
+	/* The number of sectors
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_sectors[ 8 ];
+};
+
+typedef struct odraw_layout_cache_track odraw_layout_cache_track_t;
+
+struct odraw_layout_cache_track
+{
+	/* The start sector
+	 * Consists of 8 bytes
+	 */
+	uint8_t start_sector[ 8 ];
+
+	/* The number of sectors
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_sectors[ 8 ];
+
+	/* The start sector relative to the start of the data file
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_file_start_sector[ 8 ];
+
+	/* The data file index
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_file_index[ 4 ];
+
+	/* The type
+	 * Consists of 1 byte
+	 */
+	uint8_t type;
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ODRAW_LAYOUT_CACHE_H ) */
+
@@ -0,0 +1,99 @@
+/*
+ * Seekable zstd file format definitions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ZSTD_FILE_H )
+#define _ZSTD_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The seek table is stored in a skippable frame at the end of the file
+ * the header is followed by the entries and the footer
+ */
+typedef struct zstd_seek_table_header zstd_seek_table_header_t;
+
+struct zstd_seek_table_header
+{
+	/* The skippable frame signature
+	 * Consists of 4 bytes
+	 * 0x184d2a5e
+	 */
+	uint8_t signature[ 4 ];
+
+	/* The frame size
+	 * Consists of 4 bytes
+	 * Contains the size of the entries and footer
+	 */
+	uint8_t frame_size[ 4 ];
+};
+
+typedef struct zstd_seek_table_entry zstd_seek_table_entry_t;
+
+struct zstd_seek_table_entry
+{
+	/* The compressed size
+	 * Consists of 4 bytes
+	 */
+	uint8_t compressed_size[ 4 ];
+
+	/* The decompressed size
+	 * Consists of 4 bytes
+	 */
+	uint8_t decompressed_size[ 4 ];
+
+	/* The checksum
+	 * Consists of 4 bytes
+	 * Contains the lower 32-bit of the XXH64 of the decompressed data
+	 * Only present if the checksum flag is set in the descriptor
+	 */
+};
+
+typedef struct zstd_seek_table_footer zstd_seek_table_footer_t;
+
+struct zstd_seek_table_footer
+{
+	/* The number of frames
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_frames[ 4 ];
+
+	/* The descriptor
+	 * Consists of 1 byte
+	 */
+	uint8_t descriptor;
+
+	/* The signature
+	 * Consists of 4 bytes
+	 * 0x8f92eab1
+	 */
+	uint8_t signature[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ZSTD_FILE_H ) */
+
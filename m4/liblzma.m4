@@ -0,0 +1,133 @@
+dnl Functions for liblzma
+dnl
+dnl Version: 20241018
+
+dnl Function to detect if liblzma is available
+AC_DEFUN([AX_LIBLZMA_CHECK_LIB],
+  [dnl Check if parameters were provided
+  AS_IF(
+    [test "x$ac_cv_with_liblzma" != x && test "x$ac_cv_with_liblzma" != xno && test "x$ac_cv_with_liblzma" != xauto-detect],
+    [AS_IF(
+      [test -d "$ac_cv_with_liblzma"],
+      [CFLAGS="$CFLAGS -I${ac_cv_with_liblzma}/include"
+      LDFLAGS="$LDFLAGS -L${ac_cv_with_liblzma}/lib"],
+      [AC_MSG_WARN([no such directory: $ac_cv_with_liblzma])
+      ])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_with_liblzma" = xno],
+    [ac_cv_liblzma=no],
+    [dnl Check for a pkg-config file
+    AS_IF(
+      [test "x$cross_compiling" != "xyes" && test "x$PKGCONFIG" != "x"],
+      [PKG_CHECK_MODULES(
+        [liblzma],
+        [liblzma >= 5.0.0],
+        [ac_cv_liblzma=liblzma],
+        [ac_cv_liblzma=no])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_liblzma" = xliblzma],
+      [ac_cv_liblzma_CPPFLAGS="$pkg_cv_liblzma_CFLAGS"
+      ac_cv_liblzma_LIBADD="$pkg_cv_liblzma_LIBS"],
+      [dnl Check for headers
+      AC_CHECK_HEADERS([lzma.h])
+
+      AS_IF(
+        [test "x$ac_cv_header_lzma_h" = xno],
+        [ac_cv_liblzma=no],
+        [dnl Check for the individual functions
+        ac_cv_liblzma=liblzma
+
+        AC_CHECK_LIB(
+          lzma,
+          lzma_raw_decoder,
+          [ac_liblzma_dummy=yes],
+          [ac_cv_liblzma=no])
+        AC_CHECK_LIB(
+          lzma,
+          lzma_code,
+          [ac_liblzma_dummy=yes],
+          [ac_cv_liblzma=no])
+        AC_CHECK_LIB(
+          lzma,
+          lzma_end,
+          [ac_liblzma_dummy=yes],
+          [ac_cv_liblzma=no])
+
+        ac_cv_liblzma_LIBADD="-llzma";
+        ])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_with_liblzma" != xauto-detect && test "x$ac_cv_liblzma" != xliblzma],
+      [AC_MSG_FAILURE(
+        [unable to find supported liblzma in directory: $ac_cv_with_liblzma],
+        [1])
+      ])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_liblzma" = xliblzma],
+    [AC_DEFINE(
+      [HAVE_LIBLZMA],
+      [1],
+      [Define to 1 if you have the 'liblzma' library (-llzma).])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_liblzma" != xno],
+    [AC_SUBST(
+      [HAVE_LIBLZMA],
+      [1]) ],
+    [AC_SUBST(
+      [HAVE_LIBLZMA],
+      [0])
+    ])
+  ])
+
+dnl Function to detect how to enable liblzma
+AC_DEFUN([AX_LIBLZMA_CHECK_ENABLE],
+  [AX_COMMON_ARG_WITH(
+    [liblzma],
+    [liblzma],
+    [search for liblzma in includedir and libdir or in the specified DIR, or no if not to use liblzma],
+    [auto-detect],
+    [DIR])
+
+  dnl Check for a shared library version
+  AX_LIBLZMA_CHECK_LIB
+
+  AS_IF(
+    [test "x$ac_cv_liblzma_CPPFLAGS" != "x"],
+    [AC_SUBST(
+      [LIBLZMA_CPPFLAGS],
+      [$ac_cv_liblzma_CPPFLAGS])
+    ])
+  AS_IF(
+    [test "x$ac_cv_liblzma_LIBADD" != "x"],
+    [AC_SUBST(
+      [LIBLZMA_LIBADD],
+      [$ac_cv_liblzma_LIBADD])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_liblzma" = xliblzma],
+    [AC_SUBST(
+      [ax_liblzma_pc_libs_private],
+      [-llzma])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_liblzma" = xliblzma],
+    [AC_SUBST(
+      [ax_liblzma_spec_requires],
+      [xz-libs])
+    AC_SUBST(
+      [ax_liblzma_spec_build_requires],
+      [xz-devel])
+    ])
+  ])
+
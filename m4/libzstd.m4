@@ -0,0 +1,128 @@
+dnl Functions for libzstd
+dnl
+dnl Version: 20241018
+
+dnl Function to detect if libzstd is available
+AC_DEFUN([AX_LIBZSTD_CHECK_LIB],
+  [dnl Check if parameters were provided
+  AS_IF(
+    [test "x$ac_cv_with_libzstd" != x && test "x$ac_cv_with_libzstd" != xno && test "x$ac_cv_with_libzstd" != xauto-detect],
+    [AS_IF(
+      [test -d "$ac_cv_with_libzstd"],
+      [CFLAGS="$CFLAGS -I${ac_cv_with_libzstd}/include"
+      LDFLAGS="$LDFLAGS -L${ac_cv_with_libzstd}/lib"],
+      [AC_MSG_WARN([no such directory: $ac_cv_with_libzstd])
+      ])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_with_libzstd" = xno],
+    [ac_cv_libzstd=no],
+    [dnl Check for a pkg-config file
+    AS_IF(
+      [test "x$cross_compiling" != "xyes" && test "x$PKGCONFIG" != "x"],
+      [PKG_CHECK_MODULES(
+        [libzstd],
+        [libzstd >= 1.4.0],
+        [ac_cv_libzstd=libzstd],
+        [ac_cv_libzstd=no])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_libzstd" = xlibzstd],
+      [ac_cv_libzstd_CPPFLAGS="$pkg_cv_libzstd_CFLAGS"
+      ac_cv_libzstd_LIBADD="$pkg_cv_libzstd_LIBS"],
+      [dnl Check for headers
+      AC_CHECK_HEADERS([zstd.h])
+
+      AS_IF(
+        [test "x$ac_cv_header_zstd_h" = xno],
+        [ac_cv_libzstd=no],
+        [dnl Check for the individual functions
+        ac_cv_libzstd=libzstd
+
+        AC_CHECK_LIB(
+          zstd,
+          ZSTD_decompress,
+          [ac_libzstd_dummy=yes],
+          [ac_cv_libzstd=no])
+        AC_CHECK_LIB(
+          zstd,
+          ZSTD_isError,
+          [ac_libzstd_dummy=yes],
+          [ac_cv_libzstd=no])
+
+        ac_cv_libzstd_LIBADD="-lzstd";
+        ])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_with_libzstd" != xauto-detect && test "x$ac_cv_libzstd" != xlibzstd],
+      [AC_MSG_FAILURE(
+        [unable to find supported libzstd in directory: $ac_cv_with_libzstd],
+        [1])
+      ])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libzstd" = xlibzstd],
+    [AC_DEFINE(
+      [HAVE_LIBZSTD],
+      [1],
+      [Define to 1 if you have the 'libzstd' library (-lzstd).])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libzstd" != xno],
+    [AC_SUBST(
+      [HAVE_LIBZSTD],
+      [1]) ],
+    [AC_SUBST(
+      [HAVE_LIBZSTD],
+      [0])
+    ])
+  ])
+
+dnl Function to detect how to enable libzstd
+AC_DEFUN([AX_LIBZSTD_CHECK_ENABLE],
+  [AX_COMMON_ARG_WITH(
+    [libzstd],
+    [libzstd],
+    [search for libzstd in includedir and libdir or in the specified DIR, or no if not to use libzstd],
+    [auto-detect],
+    [DIR])
+
+  dnl Check for a shared library version
+  AX_LIBZSTD_CHECK_LIB
+
+  AS_IF(
+    [test "x$ac_cv_libzstd_CPPFLAGS" != "x"],
+    [AC_SUBST(
+      [LIBZSTD_CPPFLAGS],
+      [$ac_cv_libzstd_CPPFLAGS])
+    ])
+  AS_IF(
+    [test "x$ac_cv_libzstd_LIBADD" != "x"],
+    [AC_SUBST(
+      [LIBZSTD_LIBADD],
+      [$ac_cv_libzstd_LIBADD])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libzstd" = xlibzstd],
+    [AC_SUBST(
+      [ax_libzstd_pc_libs_private],
+      [-lzstd])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libzstd" = xlibzstd],
+    [AC_SUBST(
+      [ax_libzstd_spec_requires],
+      [libzstd])
+    AC_SUBST(
+      [ax_libzstd_spec_build_requires],
+      [libzstd-devel])
+    ])
+  ])
+
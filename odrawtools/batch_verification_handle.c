@@ -0,0 +1,1572 @@
+/*
+ * Batch verification handle
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "batch_verification_handle.h"
+#include "device_scheduler.h"
+#include "log_handle.h"
+#include "odrawtools_libcerror.h"
+#include "odrawtools_libcnotify.h"
+#include "odrawtools_libcthreads.h"
+#include "odrawtools_libodraw.h"
+#include "odrawtools_unused.h"
+#include "verification_handle.h"
+
+#define BATCH_VERIFICATION_HANDLE_NOTIFY_STREAM			stdout
+
+#define BATCH_VERIFICATION_HANDLE_DEFAULT_NUMBER_OF_THREADS	4
+#define BATCH_VERIFICATION_HANDLE_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The number of sources verified before their results are printed
+ * The results are printed in order of the sources, the verification handles
+ * of a batch are retained until then
+ */
+#define BATCH_VERIFICATION_HANDLE_BATCH_SIZE			64
+
+#define BATCH_VERIFICATION_HANDLE_MAXIMUM_LINE_SIZE		4096
+
+/* Creates a batch verification handle
+ * Make sure the value batch_verification_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int batch_verification_handle_initialize(
+     batch_verification_handle_t **batch_verification_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_verification_handle_initialize";
+
+	if( batch_verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_verification_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch verification handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*batch_verification_handle = memory_allocate_structure(
+	                              batch_verification_handle_t );
+
+	if( *batch_verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch verification handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *batch_verification_handle,
+	     0,
+	     sizeof( batch_verification_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch verification handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *batch_verification_handle )->number_of_threads = BATCH_VERIFICATION_HANDLE_DEFAULT_NUMBER_OF_THREADS;
+	( *batch_verification_handle )->notify_stream     = BATCH_VERIFICATION_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *batch_verification_handle != NULL )
+	{
+		memory_free(
+		 *batch_verification_handle );
+
+		*batch_verification_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a batch verification handle
+ * Returns 1 if successful or -1 on error
+ */
+int batch_verification_handle_free(
+     batch_verification_handle_t **batch_verification_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_verification_handle_free";
+	int filename_index    = 0;
+	int result            = 1;
+
+	if( batch_verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_verification_handle != NULL )
+	{
+		if( ( *batch_verification_handle )->device_scheduler != NULL )
+		{
+			if( device_scheduler_free(
+			     &( ( *batch_verification_handle )->device_scheduler ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free device scheduler.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *batch_verification_handle )->filenames != NULL )
+		{
+			for( filename_index = 0;
+			     filename_index < ( *batch_verification_handle )->number_of_filenames;
+			     filename_index++ )
+			{
+				memory_free(
+				 ( *batch_verification_handle )->filenames[ filename_index ] );
+			}
+			memory_free(
+			 ( *batch_verification_handle )->filenames );
+		}
+		memory_free(
+		 *batch_verification_handle );
+
+		*batch_verification_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the batch verification handle to abort
+ * The sources of the batch that is being verified are signalled to abort as well
+ * Returns 1 if successful or -1 on error
+ */
+int batch_verification_handle_signal_abort(
+     batch_verification_handle_t *batch_verification_handle,
+     libcerror_error_t **error )
+{
+	batch_verification_entry_t *entry = NULL;
+	static char *function             = "batch_verification_handle_signal_abort";
+	int entry_index                   = 0;
+	int result                        = 1;
+
+	if( batch_verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	batch_verification_handle->abort = 1;
+
+	if( batch_verification_handle->entries != NULL )
+	{
+		for( entry_index = 0;
+		     entry_index < batch_verification_handle->number_of_entries;
+		     entry_index++ )
+		{
+			entry = batch_verification_handle->entries[ entry_index ];
+
+			if( ( entry == NULL )
+			 || ( entry->verification_handle == NULL ) )
+			{
+				continue;
+			}
+			if( verification_handle_signal_abort(
+			     entry->verification_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to signal verification handle: %d to abort.",
+				 function,
+				 entry_index );
+
+				result = -1;
+			}
+		}
+	}
+	return( result );
+}
+
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int batch_verification_handle_set_number_of_threads(
+     batch_verification_handle_t *batch_verification_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_verification_handle_set_number_of_threads";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int number_of_threads = 0;
+
+	if( batch_verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 2 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		number_of_threads *= 10;
+		number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( number_of_threads > BATCH_VERIFICATION_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		return( 0 );
+	}
+	batch_verification_handle->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Appends a source filename
+ * Returns 1 if successful or -1 on error
+ */
+int batch_verification_handle_append_filename(
+     batch_verification_handle_t *batch_verification_handle,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	system_character_t **filenames    = NULL;
+	system_character_t *filename_copy = NULL;
+	static char *function             = "batch_verification_handle_append_filename";
+	int maximum_number_of_filenames   = 0;
+
+	if( batch_verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_verification_handle->number_of_filenames >= batch_verification_handle->maximum_number_of_filenames )
+	{
+		if( batch_verification_handle->maximum_number_of_filenames == 0 )
+		{
+			maximum_number_of_filenames = 1024;
+		}
+		else if( batch_verification_handle->maximum_number_of_filenames < ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 / (int) sizeof( system_character_t * ) ) )
+		{
+			maximum_number_of_filenames = batch_verification_handle->maximum_number_of_filenames * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of filenames value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		filenames = (system_character_t **) memory_reallocate(
+		                                     batch_verification_handle->filenames,
+		                                     sizeof( system_character_t * ) * maximum_number_of_filenames );
+
+		if( filenames == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize filenames.",
+			 function );
+
+			return( -1 );
+		}
+		batch_verification_handle->filenames                   = filenames;
+		batch_verification_handle->maximum_number_of_filenames = maximum_number_of_filenames;
+	}
+	filename_copy = system_string_allocate(
+	                 filename_length + 1 );
+
+	if( filename_copy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     filename_copy,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		memory_free(
+		 filename_copy );
+
+		return( -1 );
+	}
+	filename_copy[ filename_length ] = 0;
+
+	batch_verification_handle->filenames[ batch_verification_handle->number_of_filenames ] = filename_copy;
+
+	batch_verification_handle->number_of_filenames += 1;
+
+	return( 1 );
+}
+
+/* Appends the sources listed in a list file, one source filename per line
+ * Empty lines are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int batch_verification_handle_append_sources_from_list_file(
+     batch_verification_handle_t *batch_verification_handle,
+     const system_character_t *list_filename,
+     libcerror_error_t **error )
+{
+	system_character_t line[ BATCH_VERIFICATION_HANDLE_MAXIMUM_LINE_SIZE ];
+
+	FILE *list_file_stream = NULL;
+	static char *function  = "batch_verification_handle_append_sources_from_list_file";
+	size_t line_length     = 0;
+	int line_number        = 0;
+
+	if( batch_verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( list_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid list filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	list_file_stream = file_stream_open_wide(
+	                    list_filename,
+	                    _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	list_file_stream = file_stream_open(
+	                    list_filename,
+	                    FILE_STREAM_OPEN_READ );
+#endif
+	if( list_file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open list file.",
+		 function );
+
+		return( -1 );
+	}
+	while( file_stream_at_end(
+	        list_file_stream ) == 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( file_stream_get_string_wide(
+		     list_file_stream,
+		     line,
+		     BATCH_VERIFICATION_HANDLE_MAXIMUM_LINE_SIZE ) == NULL )
+#else
+		if( file_stream_get_string(
+		     list_file_stream,
+		     line,
+		     BATCH_VERIFICATION_HANDLE_MAXIMUM_LINE_SIZE ) == NULL )
+#endif
+		{
+			if( file_stream_at_end(
+			     list_file_stream ) != 0 )
+			{
+				break;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read line: %d from list file.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		line_length = system_string_length(
+		               line );
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (system_character_t) '\n' ) )
+		{
+			line_length -= 1;
+		}
+		else if( file_stream_at_end(
+		          list_file_stream ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid line: %d in list file value exceeds maximum.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (system_character_t) '\r' ) )
+		{
+			line_length -= 1;
+		}
+		if( line_length > 0 )
+		{
+			if( batch_verification_handle_append_filename(
+			     batch_verification_handle,
+			     line,
+			     line_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append filename of line: %d in list file.",
+				 function,
+				 line_number );
+
+				goto on_error;
+			}
+		}
+		line_number++;
+	}
+	if( file_stream_close(
+	     list_file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close list file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	file_stream_close(
+	 list_file_stream );
+
+	return( -1 );
+}
+
+/* Creates a batch verification entry
+ * Make sure the value entry is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int batch_verification_handle_initialize_entry(
+     batch_verification_handle_t *batch_verification_handle,
+     batch_verification_entry_t **entry,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_verification_handle_initialize_entry";
+
+	if( batch_verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = memory_allocate_structure(
+	          batch_verification_entry_t );
+
+	if( *entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *entry,
+	     0,
+	     sizeof( batch_verification_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		memory_free(
+		 *entry );
+
+		*entry = NULL;
+
+		return( -1 );
+	}
+	( *entry )->filename = filename;
+
+	if( verification_handle_initialize(
+	     &( ( *entry )->verification_handle ),
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create verification handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The results are printed by the batch verification handle
+	 */
+	( *entry )->verification_handle->notify_stream       = NULL;
+	( *entry )->verification_handle->process_buffer_size = batch_verification_handle->process_buffer_size;
+
+	if( batch_verification_handle->additional_digest_types != NULL )
+	{
+		if( verification_handle_set_additional_digest_types(
+		     ( *entry )->verification_handle,
+		     batch_verification_handle->additional_digest_types,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set additional digest types.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle_set_use_direct_io(
+	     ( *entry )->verification_handle,
+	     batch_verification_handle->use_direct_io,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set use direct IO.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle_set_zero_on_read_error(
+	     ( *entry )->verification_handle,
+	     batch_verification_handle->zero_on_read_error,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set zero on read error.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *entry != NULL )
+	{
+		batch_verification_handle_free_entry(
+		 entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a batch verification entry
+ * Returns 1 if successful or -1 on error
+ */
+int batch_verification_handle_free_entry(
+     batch_verification_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_verification_handle_free_entry";
+	int result            = 1;
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry != NULL )
+	{
+		if( ( *entry )->verification_handle != NULL )
+		{
+			if( verification_handle_free(
+			     &( ( *entry )->verification_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free verification handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *entry );
+
+		*entry = NULL;
+	}
+	return( result );
+}
+
+/* Verifies the source of a batch verification entry
+ * The input is closed after verification so that only the sources being verified are open
+ * Returns 1 if successful or -1 on error
+ */
+int batch_verification_handle_verify_entry(
+     batch_verification_handle_t *batch_verification_handle,
+     batch_verification_entry_t *entry,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_verification_handle_verify_entry";
+	int result            = 0;
+
+	if( batch_verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry->verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid entry - missing verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	entry->result = -1;
+
+	if( verification_handle_open_input(
+	     entry->verification_handle,
+	     entry->filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open source: %" PRIs_SYSTEM ".",
+		 function,
+		 entry->filename );
+
+		return( -1 );
+	}
+	result = verification_handle_verify_input(
+	          entry->verification_handle,
+	          0,
+	          NULL,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify source: %" PRIs_SYSTEM ".",
+		 function,
+		 entry->filename );
+
+		result = -1;
+	}
+	else if( libodraw_handle_get_media_size(
+	          entry->verification_handle->input_handle,
+	          &( entry->media_size ),
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size of source: %" PRIs_SYSTEM ".",
+		 function,
+		 entry->filename );
+
+		result = -1;
+	}
+	if( verification_handle_close(
+	     entry->verification_handle,
+	     ( result == 1 ) ? error : NULL ) != 0 )
+	{
+		if( result == 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close source: %" PRIs_SYSTEM ".",
+			 function,
+			 entry->filename );
+		}
+		result = -1;
+	}
+	if( entry->verification_handle->abort != 0 )
+	{
+		/* Sources that were aborted are not verified
+		 */
+		entry->result = 0;
+	}
+	else
+	{
+		entry->result = result;
+	}
+	return( result );
+}
+
+/* Verifies the next source selected by the device scheduler in a worker thread
+ * Every pushed entry represents a source to verify, which source is verified is
+ * determined by the device scheduler and is not necessarily the pushed entry
+ * A source that fails verification is recorded in its entry and does not fail the thread
+ * Returns 1 if successful or -1 on error
+ */
+int batch_verification_handle_verify_entry_callback(
+     batch_verification_entry_t *entry ODRAWTOOLS_ATTRIBUTE_UNUSED,
+     batch_verification_handle_t *batch_verification_handle )
+{
+	batch_verification_entry_t *scheduled_entry = NULL;
+	libcerror_error_t *error                    = NULL;
+	static char *function                       = "batch_verification_handle_verify_entry_callback";
+	size64_t number_of_bytes                    = 0;
+	int result                                  = 0;
+	int source_index                            = 0;
+
+	ODRAWTOOLS_UNREFERENCED_PARAMETER( entry )
+
+	if( batch_verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch verification handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = device_scheduler_get_next_source(
+	          batch_verification_handle->device_scheduler,
+	          &source_index,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next source from device scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	if( ( source_index < 0 )
+	 || ( source_index >= batch_verification_handle->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	scheduled_entry = batch_verification_handle->entries[ source_index ];
+
+	if( batch_verification_handle->abort == 0 )
+	{
+		if( batch_verification_handle_verify_entry(
+		     batch_verification_handle,
+		     scheduled_entry,
+		     &error ) != 1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		else
+		{
+			number_of_bytes = scheduled_entry->media_size;
+		}
+	}
+	if( device_scheduler_release_source(
+	     batch_verification_handle->device_scheduler,
+	     source_index,
+	     number_of_bytes,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release source: %d in device scheduler.",
+		 function,
+		 source_index );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( batch_verification_handle != NULL )
+	{
+		batch_verification_handle->thread_failed = 1;
+	}
+#endif
+	return( -1 );
+}
+
+/* Prints the result of a batch verification entry to a stream
+ * Returns 1 if successful or -1 on error
+ */
+int batch_verification_handle_entry_fprint(
+     batch_verification_entry_t *entry,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_verification_handle_entry_fprint";
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "Source:\t\t\t\t\t%" PRIs_SYSTEM "\n",
+	 entry->filename );
+
+	if( entry->result == 1 )
+	{
+		if( verification_handle_hash_values_fprint(
+		     entry->verification_handle,
+		     stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print hash values.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( entry->result == 1 )
+	 && ( entry->verification_handle->number_of_read_errors > 0 ) )
+	{
+		if( verification_handle_read_errors_fprint(
+		     entry->verification_handle,
+		     stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print read errors.",
+			 function );
+
+			return( -1 );
+		}
+		fprintf(
+		 stream,
+		 "Verification:\t\t\t\tFAILURE\n\n" );
+	}
+	else if( entry->result == 1 )
+	{
+		fprintf(
+		 stream,
+		 "Verification:\t\t\t\tSUCCESS\n\n" );
+	}
+	else
+	{
+		fprintf(
+		 stream,
+		 "Verification:\t\t\t\tFAILURE\n\n" );
+	}
+	return( 1 );
+}
+
+/* Verifies the sources and prints the result per source
+ * The sources are verified in batches by the worker threads, the results
+ * of a batch are printed, and logged, in order after the batch completes.
+ * The device scheduler determines the order in which the sources of a batch
+ * are verified, so that the sources on a rotational device are verified one
+ * at a time while the sources on other devices are verified concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int batch_verification_handle_verify_sources(
+     batch_verification_handle_t *batch_verification_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	batch_verification_entry_t **entries = NULL;
+	static char *function                = "batch_verification_handle_verify_sources";
+	size_t entries_size                  = 0;
+	int batch_index                      = 0;
+	int batch_size                       = 0;
+	int device_index                     = 0;
+	int filename_index                   = 0;
+	int source_index                     = 0;
+
+	if( batch_verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_verification_handle->entries != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch verification handle - entries value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( batch_verification_handle->thread_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch verification handle - thread pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( batch_verification_handle->number_of_filenames == 0 )
+	{
+		return( 1 );
+	}
+	entries_size = sizeof( batch_verification_entry_t * ) * BATCH_VERIFICATION_HANDLE_BATCH_SIZE;
+
+	entries = (batch_verification_entry_t **) memory_allocate(
+	                                           entries_size );
+
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( batch_verification_handle->device_scheduler == NULL )
+	{
+		if( device_scheduler_initialize(
+		     &( batch_verification_handle->device_scheduler ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create device scheduler.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( filename_index = 0;
+	     filename_index < batch_verification_handle->number_of_filenames;
+	     filename_index += batch_size )
+	{
+		if( batch_verification_handle->abort != 0 )
+		{
+			break;
+		}
+		batch_size = batch_verification_handle->number_of_filenames - filename_index;
+
+		if( batch_size > BATCH_VERIFICATION_HANDLE_BATCH_SIZE )
+		{
+			batch_size = BATCH_VERIFICATION_HANDLE_BATCH_SIZE;
+		}
+		for( batch_index = 0;
+		     batch_index < batch_size;
+		     batch_index++ )
+		{
+			if( batch_verification_handle_initialize_entry(
+			     batch_verification_handle,
+			     &( entries[ batch_index ] ),
+			     batch_verification_handle->filenames[ filename_index + batch_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create entry: %d.",
+				 function,
+				 filename_index + batch_index );
+
+				goto on_error;
+			}
+			if( device_scheduler_get_device_index_by_source(
+			     batch_verification_handle->device_scheduler,
+			     entries[ batch_index ]->filename,
+			     &device_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve device index of entry: %d.",
+				 function,
+				 filename_index + batch_index );
+
+				goto on_error;
+			}
+			if( device_scheduler_append_source(
+			     batch_verification_handle->device_scheduler,
+			     device_index,
+			     &source_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append entry: %d to device scheduler.",
+				 function,
+				 filename_index + batch_index );
+
+				goto on_error;
+			}
+		}
+		/* The entries are made available to signal an abort
+		 */
+		batch_verification_handle->entries           = entries;
+		batch_verification_handle->number_of_entries = batch_size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( batch_verification_handle->number_of_threads > 0 )
+		{
+			batch_verification_handle->thread_failed = 0;
+
+			if( libcthreads_thread_pool_create(
+			     &( batch_verification_handle->thread_pool ),
+			     NULL,
+			     batch_verification_handle->number_of_threads,
+			     batch_size,
+			     (int (*)(intptr_t *, void *)) &batch_verification_handle_verify_entry_callback,
+			     (void *) batch_verification_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread pool.",
+				 function );
+
+				goto on_error;
+			}
+			for( batch_index = 0;
+			     batch_index < batch_size;
+			     batch_index++ )
+			{
+				if( libcthreads_thread_pool_push(
+				     batch_verification_handle->thread_pool,
+				     (intptr_t *) entries[ batch_index ],
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push entry: %d onto thread pool.",
+					 function,
+					 filename_index + batch_index );
+
+					goto on_error;
+				}
+			}
+			if( libcthreads_thread_pool_join(
+			     &( batch_verification_handle->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				goto on_error;
+			}
+			if( batch_verification_handle->thread_failed != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to verify entries.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+		{
+			for( batch_index = 0;
+			     batch_index < batch_size;
+			     batch_index++ )
+			{
+				if( batch_verification_handle->abort != 0 )
+				{
+					break;
+				}
+				if( batch_verification_handle_verify_entry_callback(
+				     entries[ batch_index ],
+				     batch_verification_handle ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to verify entry: %d.",
+					 function,
+					 filename_index + batch_index );
+
+					goto on_error;
+				}
+			}
+		}
+		if( device_scheduler_empty_sources(
+		     batch_verification_handle->device_scheduler,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty sources of device scheduler.",
+			 function );
+
+			goto on_error;
+		}
+		batch_verification_handle->number_of_entries = 0;
+		batch_verification_handle->entries           = NULL;
+
+		for( batch_index = 0;
+		     batch_index < batch_size;
+		     batch_index++ )
+		{
+			/* Entries that were not verified due to an abort are not printed
+			 */
+			if( ( entries[ batch_index ]->result == -1 )
+			 || ( ( entries[ batch_index ]->result == 1 )
+			  &&  ( entries[ batch_index ]->verification_handle->number_of_read_errors > 0 ) ) )
+			{
+				batch_verification_handle->number_of_failed_sources += 1;
+			}
+			if( entries[ batch_index ]->result != 0 )
+			{
+				if( batch_verification_handle_entry_fprint(
+				     entries[ batch_index ],
+				     batch_verification_handle->notify_stream,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+					 "%s: unable to print entry: %d.",
+					 function,
+					 filename_index + batch_index );
+
+					goto on_error;
+				}
+				if( ( log_handle != NULL )
+				 && ( log_handle->log_stream != NULL ) )
+				{
+					if( batch_verification_handle_entry_fprint(
+					     entries[ batch_index ],
+					     log_handle->log_stream,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+						 "%s: unable to print entry: %d in log handle.",
+						 function,
+						 filename_index + batch_index );
+
+						goto on_error;
+					}
+				}
+			}
+			if( batch_verification_handle_free_entry(
+			     &( entries[ batch_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free entry: %d.",
+				 function,
+				 filename_index + batch_index );
+
+				goto on_error;
+			}
+		}
+	}
+	memory_free(
+	 entries );
+
+	entries = NULL;
+
+	if( batch_verification_handle->notify_stream != NULL )
+	{
+		fprintf(
+		 batch_verification_handle->notify_stream,
+		 "Device statistics:\n" );
+
+		if( device_scheduler_fprint(
+		     batch_verification_handle->device_scheduler,
+		     batch_verification_handle->notify_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print device statistics.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( log_handle != NULL )
+	 && ( log_handle->log_stream != NULL ) )
+	{
+		fprintf(
+		 log_handle->log_stream,
+		 "Device statistics:\n" );
+
+		if( device_scheduler_fprint(
+		     batch_verification_handle->device_scheduler,
+		     log_handle->log_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print device statistics in log handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( batch_verification_handle->thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( batch_verification_handle->thread_pool ),
+		 NULL );
+	}
+#endif
+	batch_verification_handle->number_of_entries = 0;
+	batch_verification_handle->entries           = NULL;
+
+	if( entries != NULL )
+	{
+		for( batch_index = 0;
+		     batch_index < BATCH_VERIFICATION_HANDLE_BATCH_SIZE;
+		     batch_index++ )
+		{
+			if( entries[ batch_index ] != NULL )
+			{
+				batch_verification_handle_free_entry(
+				 &( entries[ batch_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 entries );
+	}
+	return( -1 );
+}
+
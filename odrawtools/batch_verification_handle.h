@@ -0,0 +1,195 @@
+/*
+ * Batch verification handle
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _BATCH_VERIFICATION_HANDLE_H )
+#define _BATCH_VERIFICATION_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "device_scheduler.h"
+#include "log_handle.h"
+#include "odrawtools_libcerror.h"
+#include "odrawtools_libcthreads.h"
+#include "verification_handle.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct batch_verification_entry batch_verification_entry_t;
+
+struct batch_verification_entry
+{
+	/* The source filename, which is referenced from the batch verification handle
+	 */
+	const system_character_t *filename;
+
+	/* The verification handle
+	 */
+	verification_handle_t *verification_handle;
+
+	/* The result, 1 if verified, -1 if the verification failed or 0 if not verified
+	 */
+	int result;
+
+	/* The media size of the source, which is set when verified
+	 */
+	size64_t media_size;
+};
+
+typedef struct batch_verification_handle batch_verification_handle_t;
+
+struct batch_verification_handle
+{
+	/* The source filenames
+	 */
+	system_character_t **filenames;
+
+	/* The number of source filenames
+	 */
+	int number_of_filenames;
+
+	/* The number of allocated source filenames
+	 */
+	int maximum_number_of_filenames;
+
+	/* The process buffer size
+	 */
+	size_t process_buffer_size;
+
+	/* The additional digest types string
+	 */
+	const system_character_t *additional_digest_types;
+
+	/* Value to indicate if direct IO should be used to read the data files
+	 */
+	uint8_t use_direct_io;
+
+	/* Value to indicate if data that cannot be read should be zero-filled
+	 */
+	uint8_t zero_on_read_error;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The number of sources that failed verification
+	 */
+	int number_of_failed_sources;
+
+	/* The entries of the batch that is being verified
+	 */
+	batch_verification_entry_t **entries;
+
+	/* The number of entries of the batch that is being verified
+	 */
+	int number_of_entries;
+
+	/* The device scheduler that limits the number of sources that are verified
+	 * concurrently per device
+	 */
+	device_scheduler_t *device_scheduler;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread pool
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* Value to indicate a thread failed
+	 */
+	int thread_failed;
+#endif
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int batch_verification_handle_initialize(
+     batch_verification_handle_t **batch_verification_handle,
+     libcerror_error_t **error );
+
+int batch_verification_handle_free(
+     batch_verification_handle_t **batch_verification_handle,
+     libcerror_error_t **error );
+
+int batch_verification_handle_signal_abort(
+     batch_verification_handle_t *batch_verification_handle,
+     libcerror_error_t **error );
+
+int batch_verification_handle_set_number_of_threads(
+     batch_verification_handle_t *batch_verification_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int batch_verification_handle_append_filename(
+     batch_verification_handle_t *batch_verification_handle,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int batch_verification_handle_append_sources_from_list_file(
+     batch_verification_handle_t *batch_verification_handle,
+     const system_character_t *list_filename,
+     libcerror_error_t **error );
+
+int batch_verification_handle_initialize_entry(
+     batch_verification_handle_t *batch_verification_handle,
+     batch_verification_entry_t **entry,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int batch_verification_handle_free_entry(
+     batch_verification_entry_t **entry,
+     libcerror_error_t **error );
+
+int batch_verification_handle_verify_entry(
+     batch_verification_handle_t *batch_verification_handle,
+     batch_verification_entry_t *entry,
+     libcerror_error_t **error );
+
+int batch_verification_handle_verify_entry_callback(
+     batch_verification_entry_t *entry,
+     batch_verification_handle_t *batch_verification_handle );
+
+int batch_verification_handle_entry_fprint(
+     batch_verification_entry_t *entry,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int batch_verification_handle_verify_sources(
+     batch_verification_handle_t *batch_verification_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BATCH_VERIFICATION_HANDLE_H ) */
+
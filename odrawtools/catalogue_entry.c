@@ -0,0 +1,1165 @@
+/*
+ * Catalogue entry
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "catalogue_entry.h"
+#include "odrawtools_libcerror.h"
+#include "odrawtools_libodraw.h"
+
+/* Retrieves the data file type
+ * Returns a string represenation of the data file type as used in a CUE file
+ */
+const char *catalogue_entry_get_data_file_type(
+             uint8_t data_file_type )
+{
+	switch( data_file_type )
+	{
+		case LIBODRAW_FILE_TYPE_BINARY_LITTLE_ENDIAN:
+			return( "BINARY" );
+
+		case LIBODRAW_FILE_TYPE_BINARY_BIG_ENDIAN:
+			return( "MOTOROLA" );
+
+		case LIBODRAW_FILE_TYPE_AUDIO_AIFF:
+			return( "AIFF" );
+
+		case LIBODRAW_FILE_TYPE_AUDIO_WAVE:
+			return( "WAVE" );
+
+		case LIBODRAW_FILE_TYPE_AUDIO_MPEG1_LAYER3:
+			return( "MP3" );
+
+		default:
+			break;
+	}
+	return( "UNKNOWN" );
+}
+
+/* Retrieves the track type
+ * Returns a string represenation of the track type as used in a CUE file
+ */
+const char *catalogue_entry_get_track_type(
+             uint8_t track_type )
+{
+	switch( track_type )
+	{
+		case LIBODRAW_TRACK_TYPE_AUDIO:
+			return( "AUDIO" );
+
+		case LIBODRAW_TRACK_TYPE_CDG:
+			return( "CDG" );
+
+		case LIBODRAW_TRACK_TYPE_MODE1_2048:
+			return( "MODE1/2048" );
+
+		case LIBODRAW_TRACK_TYPE_MODE1_2352:
+			return( "MODE1/2352" );
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2048:
+			return( "MODE2/2048" );
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2324:
+			return( "MODE2/2324" );
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2336:
+			return( "MODE2/2336" );
+
+		case LIBODRAW_TRACK_TYPE_MODE2_2352:
+			return( "MODE2/2352" );
+
+		case LIBODRAW_TRACK_TYPE_CDI_2336:
+			return( "CDI/2336" );
+
+		case LIBODRAW_TRACK_TYPE_CDI_2352:
+			return( "CDI/2352" );
+
+		default:
+			break;
+	}
+	return( "UNKNOWN" );
+}
+
+/* Creates a catalogue entry
+ * Make sure the value catalogue_entry is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int catalogue_entry_initialize(
+     catalogue_entry_t **catalogue_entry,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "catalogue_entry_initialize";
+	size_t filename_size  = 0;
+
+	if( catalogue_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalogue entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *catalogue_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid catalogue entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_size = system_string_length(
+	                 filename ) + 1;
+
+	*catalogue_entry = memory_allocate_structure(
+	                    catalogue_entry_t );
+
+	if( *catalogue_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create catalogue entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *catalogue_entry,
+	     0,
+	     sizeof( catalogue_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear catalogue entry.",
+		 function );
+
+		memory_free(
+		 *catalogue_entry );
+
+		*catalogue_entry = NULL;
+
+		return( -1 );
+	}
+	( *catalogue_entry )->filename = system_string_allocate(
+	                                  filename_size );
+
+	if( ( *catalogue_entry )->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     ( *catalogue_entry )->filename,
+	     filename,
+	     filename_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *catalogue_entry != NULL )
+	{
+		if( ( *catalogue_entry )->filename != NULL )
+		{
+			memory_free(
+			 ( *catalogue_entry )->filename );
+		}
+		memory_free(
+		 *catalogue_entry );
+
+		*catalogue_entry = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees the values read from the source
+ */
+void catalogue_entry_free_values(
+      catalogue_entry_t *catalogue_entry )
+{
+	int data_file_index = 0;
+
+	if( catalogue_entry->data_files != NULL )
+	{
+		for( data_file_index = 0;
+		     data_file_index < catalogue_entry->number_of_data_files;
+		     data_file_index++ )
+		{
+			if( catalogue_entry->data_files[ data_file_index ].filename != NULL )
+			{
+				memory_free(
+				 catalogue_entry->data_files[ data_file_index ].filename );
+			}
+		}
+		memory_free(
+		 catalogue_entry->data_files );
+
+		catalogue_entry->data_files = NULL;
+	}
+	if( catalogue_entry->sessions != NULL )
+	{
+		memory_free(
+		 catalogue_entry->sessions );
+
+		catalogue_entry->sessions = NULL;
+	}
+	if( catalogue_entry->lead_outs != NULL )
+	{
+		memory_free(
+		 catalogue_entry->lead_outs );
+
+		catalogue_entry->lead_outs = NULL;
+	}
+	if( catalogue_entry->tracks != NULL )
+	{
+		memory_free(
+		 catalogue_entry->tracks );
+
+		catalogue_entry->tracks = NULL;
+	}
+	catalogue_entry->number_of_data_files = 0;
+	catalogue_entry->number_of_sessions   = 0;
+	catalogue_entry->number_of_lead_outs  = 0;
+	catalogue_entry->number_of_tracks     = 0;
+}
+
+/* Frees a catalogue entry
+ * Returns 1 if successful or -1 on error
+ */
+int catalogue_entry_free(
+     catalogue_entry_t **catalogue_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "catalogue_entry_free";
+
+	if( catalogue_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalogue entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *catalogue_entry != NULL )
+	{
+		catalogue_entry_free_values(
+		 *catalogue_entry );
+
+		if( ( *catalogue_entry )->filename != NULL )
+		{
+			memory_free(
+			 ( *catalogue_entry )->filename );
+		}
+		memory_free(
+		 *catalogue_entry );
+
+		*catalogue_entry = NULL;
+	}
+	return( 1 );
+}
+
+/* Allocates an array of values that is cleared
+ * Returns a pointer to the array if successful or NULL on error
+ */
+void *catalogue_entry_allocate_array(
+       int number_of_values,
+       size_t value_size )
+{
+	void *array = NULL;
+
+	if( ( number_of_values <= 0 )
+	 || ( (size_t) number_of_values > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / value_size ) ) )
+	{
+		return( NULL );
+	}
+	array = memory_allocate(
+	         value_size * number_of_values );
+
+	if( array == NULL )
+	{
+		return( NULL );
+	}
+	if( memory_set(
+	     array,
+	     0,
+	     value_size * number_of_values ) == NULL )
+	{
+		memory_free(
+		 array );
+
+		return( NULL );
+	}
+	return( array );
+}
+
+/* Reads the catalogue entry from the source
+ * A failure to open the source is stored in the catalogue entry
+ * Returns 1 if successful or -1 on error
+ */
+int catalogue_entry_read(
+     catalogue_entry_t *catalogue_entry,
+     uint8_t ignore_data_files,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error = NULL;
+	libodraw_handle_t *handle     = NULL;
+	static char *function         = "catalogue_entry_read";
+	int result                    = 0;
+
+	if( catalogue_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalogue entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_handle_initialize(
+	     &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libodraw_handle_open_wide(
+	          handle,
+	          catalogue_entry->filename,
+	          LIBODRAW_OPEN_READ,
+	          &read_error );
+#else
+	result = libodraw_handle_open(
+	          handle,
+	          catalogue_entry->filename,
+	          LIBODRAW_OPEN_READ,
+	          &read_error );
+#endif
+	if( ( result == 1 )
+	 && ( ignore_data_files == 0 ) )
+	{
+		result = libodraw_handle_open_data_files(
+		          handle,
+		          &read_error );
+
+		if( result != 1 )
+		{
+			libodraw_handle_close(
+			 handle,
+			 NULL );
+		}
+	}
+	if( result == 1 )
+	{
+		result = catalogue_entry_read_handle(
+		          catalogue_entry,
+		          handle,
+		          &read_error );
+
+		if( libodraw_handle_close(
+		     handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 1 )
+	{
+		catalogue_entry_free_values(
+		 catalogue_entry );
+
+		catalogue_entry->result = -1;
+
+		if( read_error != NULL )
+		{
+			libcerror_error_sprint(
+			 read_error,
+			 catalogue_entry->error_string,
+			 256 );
+
+			libcerror_error_free(
+			 &read_error );
+		}
+	}
+	else
+	{
+		catalogue_entry->result = 1;
+	}
+	if( libodraw_handle_free(
+	     &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( read_error != NULL )
+	{
+		libcerror_error_free(
+		 &read_error );
+	}
+	if( handle != NULL )
+	{
+		libodraw_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the catalogue entry values from an opened handle
+ * Returns 1 if successful or -1 on error
+ */
+int catalogue_entry_read_handle(
+     catalogue_entry_t *catalogue_entry,
+     libodraw_handle_t *handle,
+     libcerror_error_t **error )
+{
+	catalogue_data_file_t *catalogue_data_file = NULL;
+	catalogue_sector_range_t *sector_range     = NULL;
+	catalogue_track_t *catalogue_track         = NULL;
+	libodraw_data_file_t *data_file            = NULL;
+	static char *function                      = "catalogue_entry_read_handle";
+	size_t filename_size                       = 0;
+	int index                                  = 0;
+	int number_of_values                       = 0;
+	int result                                 = 0;
+
+	if( catalogue_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalogue entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_handle_get_media_size(
+	     handle,
+	     &( catalogue_entry->media_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_handle_get_layout_memory_size(
+	     handle,
+	     &( catalogue_entry->layout_memory_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve layout memory size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_handle_get_number_of_data_files(
+	     handle,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data files.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_values > 0 )
+	{
+		catalogue_entry->data_files = (catalogue_data_file_t *) catalogue_entry_allocate_array(
+		                                                         number_of_values,
+		                                                         sizeof( catalogue_data_file_t ) );
+
+		if( catalogue_entry->data_files == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data files.",
+			 function );
+
+			goto on_error;
+		}
+		catalogue_entry->number_of_data_files = number_of_values;
+
+		for( index = 0;
+		     index < number_of_values;
+		     index++ )
+		{
+			catalogue_data_file = &( catalogue_entry->data_files[ index ] );
+
+			if( libodraw_handle_get_data_file(
+			     handle,
+			     index,
+			     &data_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve the data file: %d.",
+				 function,
+				 index );
+
+				goto on_error;
+			}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libodraw_data_file_get_filename_size_wide(
+			          data_file,
+			          &filename_size,
+			          error );
+#else
+			result = libodraw_data_file_get_filename_size(
+			          data_file,
+			          &filename_size,
+			          error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve the data file: %d filename size.",
+				 function,
+				 index );
+
+				goto on_error;
+			}
+			if( filename_size > 0 )
+			{
+				catalogue_data_file->filename = system_string_allocate(
+				                                 filename_size );
+
+				if( catalogue_data_file->filename == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create data file: %d filename.",
+					 function,
+					 index );
+
+					goto on_error;
+				}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				result = libodraw_data_file_get_filename_wide(
+				          data_file,
+				          catalogue_data_file->filename,
+				          filename_size,
+				          error );
+#else
+				result = libodraw_data_file_get_filename(
+				          data_file,
+				          catalogue_data_file->filename,
+				          filename_size,
+				          error );
+#endif
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve the data file: %d filename.",
+					 function,
+					 index );
+
+					goto on_error;
+				}
+			}
+			if( libodraw_data_file_get_type(
+			     data_file,
+			     &( catalogue_data_file->type ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve the data file: %d type.",
+				 function,
+				 index );
+
+				goto on_error;
+			}
+			result = libodraw_data_file_get_size(
+			          data_file,
+			          &( catalogue_data_file->size ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve the data file: %d size.",
+				 function,
+				 index );
+
+				goto on_error;
+			}
+			catalogue_data_file->size_set = (uint8_t) result;
+
+			if( libodraw_data_file_free(
+			     &data_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data file: %d.",
+				 function,
+				 index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libodraw_handle_get_number_of_sessions(
+	     handle,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sessions.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_values > 0 )
+	{
+		catalogue_entry->sessions = (catalogue_sector_range_t *) catalogue_entry_allocate_array(
+		                                                          number_of_values,
+		                                                          sizeof( catalogue_sector_range_t ) );
+
+		if( catalogue_entry->sessions == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sessions.",
+			 function );
+
+			goto on_error;
+		}
+		catalogue_entry->number_of_sessions = number_of_values;
+
+		for( index = 0;
+		     index < number_of_values;
+		     index++ )
+		{
+			sector_range = &( catalogue_entry->sessions[ index ] );
+
+			if( libodraw_handle_get_session(
+			     handle,
+			     index,
+			     &( sector_range->start_sector ),
+			     &( sector_range->number_of_sectors ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve the session: %d.",
+				 function,
+				 index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libodraw_handle_get_number_of_lead_outs(
+	     handle,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of lead-outs.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_values > 0 )
+	{
+		catalogue_entry->lead_outs = (catalogue_sector_range_t *) catalogue_entry_allocate_array(
+		                                                           number_of_values,
+		                                                           sizeof( catalogue_sector_range_t ) );
+
+		if( catalogue_entry->lead_outs == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create lead-outs.",
+			 function );
+
+			goto on_error;
+		}
+		catalogue_entry->number_of_lead_outs = number_of_values;
+
+		for( index = 0;
+		     index < number_of_values;
+		     index++ )
+		{
+			sector_range = &( catalogue_entry->lead_outs[ index ] );
+
+			if( libodraw_handle_get_lead_out(
+			     handle,
+			     index,
+			     &( sector_range->start_sector ),
+			     &( sector_range->number_of_sectors ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve the lead-out: %d.",
+				 function,
+				 index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libodraw_handle_get_number_of_tracks(
+	     handle,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tracks.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_values > 0 )
+	{
+		catalogue_entry->tracks = (catalogue_track_t *) catalogue_entry_allocate_array(
+		                                                 number_of_values,
+		                                                 sizeof( catalogue_track_t ) );
+
+		if( catalogue_entry->tracks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create tracks.",
+			 function );
+
+			goto on_error;
+		}
+		catalogue_entry->number_of_tracks = number_of_values;
+
+		for( index = 0;
+		     index < number_of_values;
+		     index++ )
+		{
+			catalogue_track = &( catalogue_entry->tracks[ index ] );
+
+			if( libodraw_handle_get_track(
+			     handle,
+			     index,
+			     &( catalogue_track->start_sector ),
+			     &( catalogue_track->number_of_sectors ),
+			     &( catalogue_track->type ),
+			     &( catalogue_track->data_file_index ),
+			     &( catalogue_track->data_file_start_sector ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve the track: %d.",
+				 function,
+				 index );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( data_file != NULL )
+	{
+		libodraw_data_file_free(
+		 &data_file,
+		 NULL );
+	}
+	catalogue_entry_free_values(
+	 catalogue_entry );
+
+	return( -1 );
+}
+
+/* Prints a string as a JSON string value
+ */
+void catalogue_entry_string_fprint(
+      FILE *stream,
+      const system_character_t *string )
+{
+	system_character_t character = 0;
+
+	if( ( stream == NULL )
+	 || ( string == NULL ) )
+	{
+		return;
+	}
+	fprintf(
+	 stream,
+	 "\"" );
+
+	for( character = *string;
+	     character != 0;
+	     character = *( ++string ) )
+	{
+		if( ( character == (system_character_t) '"' )
+		 || ( character == (system_character_t) '\\' ) )
+		{
+			fprintf(
+			 stream,
+			 "\\%" PRIc_SYSTEM "",
+			 character );
+		}
+		else if( (unsigned int) character < 0x20 )
+		{
+			fprintf(
+			 stream,
+			 "\\u%04x",
+			 (unsigned int) character );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "%" PRIc_SYSTEM "",
+			 character );
+		}
+	}
+	fprintf(
+	 stream,
+	 "\"" );
+}
+
+/* Prints the catalogue entry as a single line JSON object
+ * Returns 1 if successful or -1 on error
+ */
+int catalogue_entry_fprint(
+     catalogue_entry_t *catalogue_entry,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	catalogue_data_file_t *catalogue_data_file = NULL;
+	catalogue_sector_range_t *sector_range     = NULL;
+	catalogue_track_t *catalogue_track         = NULL;
+	static char *function                      = "catalogue_entry_fprint";
+	int index                                  = 0;
+
+	if( catalogue_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalogue entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "{\"source\":" );
+
+	catalogue_entry_string_fprint(
+	 stream,
+	 catalogue_entry->filename );
+
+	if( catalogue_entry->result != 1 )
+	{
+		fprintf(
+		 stream,
+		 ",\"status\":\"error\",\"error\":\"" );
+
+		for( index = 0;
+		     index < 256;
+		     index++ )
+		{
+			if( catalogue_entry->error_string[ index ] == 0 )
+			{
+				break;
+			}
+			if( ( catalogue_entry->error_string[ index ] == '"' )
+			 || ( catalogue_entry->error_string[ index ] == '\\' ) )
+			{
+				fputc(
+				 '\\',
+				 stream );
+			}
+			if( ( (unsigned char) catalogue_entry->error_string[ index ] ) < 0x20 )
+			{
+				fputc(
+				 ' ',
+				 stream );
+			}
+			else
+			{
+				fputc(
+				 catalogue_entry->error_string[ index ],
+				 stream );
+			}
+		}
+		fprintf(
+		 stream,
+		 "\"}\n" );
+
+		return( 1 );
+	}
+	fprintf(
+	 stream,
+	 ",\"status\":\"ok\",\"media_size\":%" PRIu64 ",\"layout_memory_size\":%" PRIu64 "",
+	 catalogue_entry->media_size,
+	 catalogue_entry->layout_memory_size );
+
+	fprintf(
+	 stream,
+	 ",\"data_files\":[" );
+
+	for( index = 0;
+	     index < catalogue_entry->number_of_data_files;
+	     index++ )
+	{
+		catalogue_data_file = &( catalogue_entry->data_files[ index ] );
+
+		if( index > 0 )
+		{
+			fprintf(
+			 stream,
+			 "," );
+		}
+		fprintf(
+		 stream,
+		 "{\"filename\":" );
+
+		if( catalogue_data_file->filename != NULL )
+		{
+			catalogue_entry_string_fprint(
+			 stream,
+			 catalogue_data_file->filename );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "null" );
+		}
+		fprintf(
+		 stream,
+		 ",\"type\":\"%s\"",
+		 catalogue_entry_get_data_file_type(
+		  catalogue_data_file->type ) );
+
+		if( catalogue_data_file->size_set != 0 )
+		{
+			fprintf(
+			 stream,
+			 ",\"size\":%" PRIu64 "}",
+			 catalogue_data_file->size );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 ",\"size\":null}" );
+		}
+	}
+	fprintf(
+	 stream,
+	 "],\"sessions\":[" );
+
+	for( index = 0;
+	     index < catalogue_entry->number_of_sessions;
+	     index++ )
+	{
+		sector_range = &( catalogue_entry->sessions[ index ] );
+
+		fprintf(
+		 stream,
+		 "%s{\"start_sector\":%" PRIu64 ",\"number_of_sectors\":%" PRIu64 "}",
+		 ( index > 0 ) ? "," : "",
+		 sector_range->start_sector,
+		 sector_range->number_of_sectors );
+	}
+	fprintf(
+	 stream,
+	 "],\"lead_outs\":[" );
+
+	for( index = 0;
+	     index < catalogue_entry->number_of_lead_outs;
+	     index++ )
+	{
+		sector_range = &( catalogue_entry->lead_outs[ index ] );
+
+		fprintf(
+		 stream,
+		 "%s{\"start_sector\":%" PRIu64 ",\"number_of_sectors\":%" PRIu64 "}",
+		 ( index > 0 ) ? "," : "",
+		 sector_range->start_sector,
+		 sector_range->number_of_sectors );
+	}
+	fprintf(
+	 stream,
+	 "],\"tracks\":[" );
+
+	for( index = 0;
+	     index < catalogue_entry->number_of_tracks;
+	     index++ )
+	{
+		catalogue_track = &( catalogue_entry->tracks[ index ] );
+
+		fprintf(
+		 stream,
+		 "%s{\"type\":\"%s\",\"start_sector\":%" PRIu64 ",\"number_of_sectors\":%" PRIu64 ",\"data_file_index\":%d,\"data_file_start_sector\":%" PRIu64 "}",
+		 ( index > 0 ) ? "," : "",
+		 catalogue_entry_get_track_type(
+		  catalogue_track->type ),
+		 catalogue_track->start_sector,
+		 catalogue_track->number_of_sectors,
+		 catalogue_track->data_file_index,
+		 catalogue_track->data_file_start_sector );
+	}
+	fprintf(
+	 stream,
+	 "]}\n" );
+
+	return( 1 );
+}
+
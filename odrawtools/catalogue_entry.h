@@ -0,0 +1,199 @@
+/*
+ * Catalogue entry
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CATALOGUE_ENTRY_H )
+#define _CATALOGUE_ENTRY_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "odrawtools_libcerror.h"
+#include "odrawtools_libodraw.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct catalogue_data_file catalogue_data_file_t;
+
+struct catalogue_data_file
+{
+	/* The filename
+	 */
+	system_character_t *filename;
+
+	/* The type
+	 */
+	uint8_t type;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* Value to indicate the size is set
+	 */
+	uint8_t size_set;
+};
+
+typedef struct catalogue_sector_range catalogue_sector_range_t;
+
+struct catalogue_sector_range
+{
+	/* The start sector
+	 */
+	uint64_t start_sector;
+
+	/* The number of sectors
+	 */
+	uint64_t number_of_sectors;
+};
+
+typedef struct catalogue_track catalogue_track_t;
+
+struct catalogue_track
+{
+	/* The start sector
+	 */
+	uint64_t start_sector;
+
+	/* The number of sectors
+	 */
+	uint64_t number_of_sectors;
+
+	/* The type
+	 */
+	uint8_t type;
+
+	/* The data file index
+	 */
+	int data_file_index;
+
+	/* The data file start sector
+	 */
+	uint64_t data_file_start_sector;
+};
+
+typedef struct catalogue_entry catalogue_entry_t;
+
+struct catalogue_entry
+{
+	/* The source filename
+	 */
+	system_character_t *filename;
+
+	/* The result of reading the source
+	 * 1 if successful, 0 if not read or -1 on error
+	 */
+	int result;
+
+	/* The error message if the source could not be read
+	 */
+	char error_string[ 256 ];
+
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The number of bytes used by the handle to store the layout
+	 */
+	size64_t layout_memory_size;
+
+	/* The data files
+	 */
+	catalogue_data_file_t *data_files;
+
+	/* The number of data files
+	 */
+	int number_of_data_files;
+
+	/* The sessions
+	 */
+	catalogue_sector_range_t *sessions;
+
+	/* The number of sessions
+	 */
+	int number_of_sessions;
+
+	/* The lead-outs
+	 */
+	catalogue_sector_range_t *lead_outs;
+
+	/* The number of lead-outs
+	 */
+	int number_of_lead_outs;
+
+	/* The tracks
+	 */
+	catalogue_track_t *tracks;
+
+	/* The number of tracks
+	 */
+	int number_of_tracks;
+};
+
+const char *catalogue_entry_get_data_file_type(
+             uint8_t data_file_type );
+
+const char *catalogue_entry_get_track_type(
+             uint8_t track_type );
+
+int catalogue_entry_initialize(
+     catalogue_entry_t **catalogue_entry,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int catalogue_entry_free(
+     catalogue_entry_t **catalogue_entry,
+     libcerror_error_t **error );
+
+void catalogue_entry_free_values(
+      catalogue_entry_t *catalogue_entry );
+
+void *catalogue_entry_allocate_array(
+       int number_of_values,
+       size_t value_size );
+
+int catalogue_entry_read(
+     catalogue_entry_t *catalogue_entry,
+     uint8_t ignore_data_files,
+     libcerror_error_t **error );
+
+int catalogue_entry_read_handle(
+     catalogue_entry_t *catalogue_entry,
+     libodraw_handle_t *handle,
+     libcerror_error_t **error );
+
+void catalogue_entry_string_fprint(
+      FILE *stream,
+      const system_character_t *string );
+
+int catalogue_entry_fprint(
+     catalogue_entry_t *catalogue_entry,
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CATALOGUE_ENTRY_H ) */
+
@@ -0,0 +1,1342 @@
+/*
+ * Catalogue handle
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_DIRENT_H )
+#include <dirent.h>
+#endif
+
+#include "catalogue_entry.h"
+#include "catalogue_handle.h"
+#include "odrawtools_libcerror.h"
+#include "odrawtools_libcnotify.h"
+#include "odrawtools_libcthreads.h"
+
+#define CATALOGUE_HANDLE_NOTIFY_STREAM				stdout
+
+#define CATALOGUE_HANDLE_DEFAULT_NUMBER_OF_THREADS		4
+#define CATALOGUE_HANDLE_MAXIMUM_NUMBER_OF_THREADS		64
+
+/* The number of sources read before their records are printed
+ * The records are printed in order of the sorted source filenames
+ */
+#define CATALOGUE_HANDLE_BATCH_SIZE				1024
+
+#define CATALOGUE_HANDLE_MAXIMUM_RECURSION_DEPTH		64
+
+#if defined( WINAPI )
+#define CATALOGUE_HANDLE_PATH_SEPARATOR				(system_character_t) '\\'
+#else
+#define CATALOGUE_HANDLE_PATH_SEPARATOR				(system_character_t) '/'
+#endif
+
+/* Creates a catalogue handle
+ * Make sure the value catalogue_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int catalogue_handle_initialize(
+     catalogue_handle_t **catalogue_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "catalogue_handle_initialize";
+
+	if( catalogue_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalogue handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *catalogue_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid catalogue handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*catalogue_handle = memory_allocate_structure(
+	                     catalogue_handle_t );
+
+	if( *catalogue_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create catalogue handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *catalogue_handle,
+	     0,
+	     sizeof( catalogue_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear catalogue handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *catalogue_handle )->number_of_threads = CATALOGUE_HANDLE_DEFAULT_NUMBER_OF_THREADS;
+	( *catalogue_handle )->notify_stream     = CATALOGUE_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *catalogue_handle != NULL )
+	{
+		memory_free(
+		 *catalogue_handle );
+
+		*catalogue_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a catalogue handle
+ * Returns 1 if successful or -1 on error
+ */
+int catalogue_handle_free(
+     catalogue_handle_t **catalogue_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "catalogue_handle_free";
+	int filename_index    = 0;
+
+	if( catalogue_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalogue handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *catalogue_handle != NULL )
+	{
+		if( ( *catalogue_handle )->filenames != NULL )
+		{
+			for( filename_index = 0;
+			     filename_index < ( *catalogue_handle )->number_of_filenames;
+			     filename_index++ )
+			{
+				memory_free(
+				 ( *catalogue_handle )->filenames[ filename_index ] );
+			}
+			memory_free(
+			 ( *catalogue_handle )->filenames );
+		}
+		memory_free(
+		 *catalogue_handle );
+
+		*catalogue_handle = NULL;
+	}
+	return( 1 );
+}
+
+/* Signals the catalogue handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int catalogue_handle_signal_abort(
+     catalogue_handle_t *catalogue_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "catalogue_handle_signal_abort";
+
+	if( catalogue_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalogue handle.",
+		 function );
+
+		return( -1 );
+	}
+	catalogue_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int catalogue_handle_set_number_of_threads(
+     catalogue_handle_t *catalogue_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "catalogue_handle_set_number_of_threads";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int number_of_threads = 0;
+
+	if( catalogue_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalogue handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 2 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		number_of_threads *= 10;
+		number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( number_of_threads > CATALOGUE_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		return( 0 );
+	}
+	catalogue_handle->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Appends a source filename
+ * Returns 1 if successful or -1 on error
+ */
+int catalogue_handle_append_filename(
+     catalogue_handle_t *catalogue_handle,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	system_character_t **filenames    = NULL;
+	system_character_t *filename_copy = NULL;
+	static char *function             = "catalogue_handle_append_filename";
+	int maximum_number_of_filenames   = 0;
+
+	if( catalogue_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalogue handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalogue_handle->number_of_filenames >= catalogue_handle->maximum_number_of_filenames )
+	{
+		if( catalogue_handle->maximum_number_of_filenames == 0 )
+		{
+			maximum_number_of_filenames = 1024;
+		}
+		else if( catalogue_handle->maximum_number_of_filenames < ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 / (int) sizeof( system_character_t * ) ) )
+		{
+			maximum_number_of_filenames = catalogue_handle->maximum_number_of_filenames * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of filenames value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		filenames = (system_character_t **) memory_reallocate(
+		                                     catalogue_handle->filenames,
+		                                     sizeof( system_character_t * ) * maximum_number_of_filenames );
+
+		if( filenames == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize filenames.",
+			 function );
+
+			return( -1 );
+		}
+		catalogue_handle->filenames                   = filenames;
+		catalogue_handle->maximum_number_of_filenames = maximum_number_of_filenames;
+	}
+	filename_copy = system_string_allocate(
+	                 filename_length + 1 );
+
+	if( filename_copy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     filename_copy,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		memory_free(
+		 filename_copy );
+
+		return( -1 );
+	}
+	filename_copy[ filename_length ] = 0;
+
+	catalogue_handle->filenames[ catalogue_handle->number_of_filenames ] = filename_copy;
+
+	catalogue_handle->number_of_filenames += 1;
+
+	return( 1 );
+}
+
+/* Determines if a filename has a CUE file extension
+ * Returns 1 if the filename has a CUE file extension or 0 if not
+ */
+int catalogue_handle_filename_is_toc_file(
+     const system_character_t *filename,
+     size_t filename_length )
+{
+	if( filename_length < 4 )
+	{
+		return( 0 );
+	}
+	if( system_string_compare_no_case(
+	     &( filename[ filename_length - 4 ] ),
+	     _SYSTEM_STRING( ".cue" ),
+	     4 ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Appends a source, directories are scanned recursively for CUE files
+ * Returns 1 if successful or -1 on error
+ */
+int catalogue_handle_append_source(
+     catalogue_handle_t *catalogue_handle,
+     const system_character_t *source,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	DWORD file_attributes = 0;
+
+#elif defined( HAVE_STAT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	struct stat file_statistics;
+#endif
+
+	static char *function = "catalogue_handle_append_source";
+	size_t source_length  = 0;
+	int is_directory      = 0;
+
+	if( catalogue_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalogue handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	source_length = system_string_length(
+	                 source );
+
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_attributes = GetFileAttributesW(
+	                   (LPCWSTR) source );
+#else
+	file_attributes = GetFileAttributesA(
+	                   (LPCSTR) source );
+#endif
+	if( file_attributes == INVALID_FILE_ATTRIBUTES )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 GetLastError(),
+		 "%s: unable to retrieve file attributes of: %" PRIs_SYSTEM ".",
+		 function,
+		 source );
+
+		return( -1 );
+	}
+	if( ( file_attributes & FILE_ATTRIBUTE_DIRECTORY ) != 0 )
+	{
+		is_directory = 1;
+	}
+#elif defined( HAVE_STAT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( stat(
+	     source,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to retrieve file statistics of: %" PRIs_SYSTEM ".",
+		 function,
+		 source );
+
+		return( -1 );
+	}
+	if( S_ISDIR( file_statistics.st_mode ) )
+	{
+		is_directory = 1;
+	}
+#endif
+	if( is_directory != 0 )
+	{
+		if( catalogue_handle_scan_directory(
+		     catalogue_handle,
+		     source,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to scan directory: %" PRIs_SYSTEM ".",
+			 function,
+			 source );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		/* A source that is explicitly specified is catalogued regardless of its extension
+		 */
+		if( catalogue_handle_append_filename(
+		     catalogue_handle,
+		     source,
+		     source_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append filename.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Scans a directory recursively for CUE files
+ * Symbolic links to directories are not followed to prevent cycles
+ * Returns 1 if successful or -1 on error
+ */
+int catalogue_handle_scan_directory(
+     catalogue_handle_t *catalogue_handle,
+     const system_character_t *directory_name,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	WIN32_FIND_DATAW find_data;
+#else
+	WIN32_FIND_DATAA find_data;
+#endif
+	HANDLE find_handle                  = INVALID_HANDLE_VALUE;
+	DWORD error_code                    = 0;
+
+#elif defined( HAVE_OPENDIR ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	struct stat file_statistics;
+
+	struct dirent *directory_entry      = NULL;
+	DIR *directory                      = NULL;
+#endif
+
+	const system_character_t *entry_name = NULL;
+	libcerror_error_t *scan_error        = NULL;
+	system_character_t *path             = NULL;
+	static char *function                = "catalogue_handle_scan_directory";
+	size_t directory_name_length         = 0;
+	size_t entry_name_length             = 0;
+	size_t maximum_path_size             = 0;
+	size_t path_length                   = 0;
+	size_t path_size                     = 0;
+	int is_directory                     = 0;
+	int is_file                          = 0;
+	int result                           = 1;
+
+	if( catalogue_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalogue handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > CATALOGUE_HANDLE_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	directory_name_length = system_string_length(
+	                         directory_name );
+
+	while( ( directory_name_length > 1 )
+	    && ( directory_name[ directory_name_length - 1 ] == CATALOGUE_HANDLE_PATH_SEPARATOR ) )
+	{
+		directory_name_length--;
+	}
+	/* Reserve space for the directory name, a path separator, the entry name and the end-of-string character
+	 */
+	maximum_path_size = directory_name_length + 262;
+
+	path = system_string_allocate(
+	        maximum_path_size );
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     path,
+	     directory_name,
+	     directory_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory name.",
+		 function );
+
+		goto on_error;
+	}
+	path[ directory_name_length++ ] = CATALOGUE_HANDLE_PATH_SEPARATOR;
+
+#if defined( WINAPI )
+	path[ directory_name_length ]     = (system_character_t) '*';
+	path[ directory_name_length + 1 ] = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	find_handle = FindFirstFileW(
+	               (LPCWSTR) path,
+	               &find_data );
+#else
+	find_handle = FindFirstFileA(
+	               (LPCSTR) path,
+	               &find_data );
+#endif
+	if( find_handle == INVALID_HANDLE_VALUE )
+	{
+		error_code = GetLastError();
+
+		if( error_code == ERROR_FILE_NOT_FOUND )
+		{
+			memory_free(
+			 path );
+
+			return( 1 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 error_code,
+		 "%s: unable to open directory.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		entry_name   = (const system_character_t *) find_data.cFileName;
+		is_directory = 0;
+		is_file      = 0;
+
+		if( ( find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) != 0 )
+		{
+			if( ( find_data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT ) == 0 )
+			{
+				is_directory = 1;
+			}
+		}
+		else
+		{
+			is_file = 1;
+		}
+#elif defined( HAVE_OPENDIR ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	path[ directory_name_length ] = 0;
+
+	directory = opendir(
+	             path );
+
+	if( directory == NULL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open directory.",
+		 function );
+
+		goto on_error;
+	}
+	while( ( directory_entry = readdir( directory ) ) != NULL )
+	{
+		entry_name   = (const system_character_t *) directory_entry->d_name;
+		is_directory = 0;
+		is_file      = 0;
+
+#if defined( DT_DIR ) && defined( DT_LNK ) && defined( DT_REG ) && defined( DT_UNKNOWN )
+		/* Use the type stored in the directory entry when available to prevent a stat per entry
+		 */
+		if( directory_entry->d_type == DT_DIR )
+		{
+			is_directory = 1;
+		}
+		else if( directory_entry->d_type == DT_REG )
+		{
+			is_file = 1;
+		}
+		else if( directory_entry->d_type == DT_UNKNOWN )
+		{
+			is_file = -1;
+		}
+		else if( directory_entry->d_type == DT_LNK )
+		{
+			is_file = -2;
+		}
+#else
+		is_file = -1;
+#endif
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: scanning directories is not supported.",
+	 function );
+
+	goto on_error;
+#endif
+
+#if defined( WINAPI ) || ( defined( HAVE_OPENDIR ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) )
+		if( catalogue_handle->abort != 0 )
+		{
+			break;
+		}
+		entry_name_length = system_string_length(
+		                     entry_name );
+
+		if( ( entry_name_length == 0 )
+		 || ( ( entry_name_length == 1 )
+		  &&  ( entry_name[ 0 ] == (system_character_t) '.' ) )
+		 || ( ( entry_name_length == 2 )
+		  &&  ( entry_name[ 0 ] == (system_character_t) '.' )
+		  &&  ( entry_name[ 1 ] == (system_character_t) '.' ) ) )
+		{
+			continue;
+		}
+		if( ( is_directory == 0 )
+		 && ( is_file > 0 )
+		 && ( catalogue_handle_filename_is_toc_file(
+		       entry_name,
+		       entry_name_length ) == 0 ) )
+		{
+			continue;
+		}
+		path_length = directory_name_length + entry_name_length;
+		path_size   = path_length + 1;
+
+		if( path_size > maximum_path_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry name length value out of bounds.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		if( system_string_copy(
+		     &( path[ directory_name_length ] ),
+		     entry_name,
+		     entry_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy entry name.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		path[ path_length ] = 0;
+
+#if !defined( WINAPI )
+		if( is_file == -1 )
+		{
+			/* The type is unknown, lstat is used so that symbolic links to directories are not followed
+			 */
+			is_file = 0;
+
+			if( lstat(
+			     path,
+			     &file_statistics ) == 0 )
+			{
+				if( S_ISDIR( file_statistics.st_mode ) )
+				{
+					is_directory = 1;
+				}
+				else if( S_ISLNK( file_statistics.st_mode ) )
+				{
+					is_file = -2;
+				}
+				else if( S_ISREG( file_statistics.st_mode ) )
+				{
+					is_file = catalogue_handle_filename_is_toc_file(
+					           entry_name,
+					           entry_name_length );
+				}
+			}
+		}
+		if( is_file == -2 )
+		{
+			/* Symbolic links are only catalogued when they refer to a regular file
+			 */
+			is_file = 0;
+
+			if( ( stat(
+			       path,
+			       &file_statistics ) == 0 )
+			 && S_ISREG( file_statistics.st_mode ) )
+			{
+				is_file = catalogue_handle_filename_is_toc_file(
+				           entry_name,
+				           entry_name_length );
+			}
+		}
+#endif
+		if( is_directory != 0 )
+		{
+			/* A sub directory that cannot be scanned, for example due to
+			 * insufficient permissions, does not stop the catalogue
+			 */
+			if( catalogue_handle_scan_directory(
+			     catalogue_handle,
+			     path,
+			     recursion_depth + 1,
+			     &scan_error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to scan directory: %" PRIs_SYSTEM ".\n",
+				 path );
+
+				libcnotify_print_error_backtrace(
+				 scan_error );
+				libcerror_error_free(
+				 &scan_error );
+			}
+		}
+		else if( is_file != 0 )
+		{
+			if( catalogue_handle_append_filename(
+			     catalogue_handle,
+			     path,
+			     path_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append filename.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+	}
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	while( FindNextFileW(
+	        find_handle,
+	        &find_data ) != 0 );
+#else
+	while( FindNextFileA(
+	        find_handle,
+	        &find_data ) != 0 );
+#endif
+	if( FindClose(
+	     find_handle ) == 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 GetLastError(),
+		 "%s: unable to close directory.",
+		 function );
+
+		result = -1;
+	}
+#else
+	if( closedir(
+	     directory ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close directory.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	memory_free(
+	 path );
+
+	return( result );
+#endif /* defined( WINAPI ) || ( defined( HAVE_OPENDIR ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) ) */
+
+on_error:
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( -1 );
+}
+
+/* Compares two source filenames, used to sort the sources
+ * Returns a negative value if the first filename sorts before the second,
+ * 0 if both are equal or a positive value otherwise
+ */
+int catalogue_handle_compare_filenames(
+     const void *first_filename,
+     const void *second_filename )
+{
+	const system_character_t *first_string  = *( (const system_character_t * const *) first_filename );
+	const system_character_t *second_string = *( (const system_character_t * const *) second_filename );
+	size_t first_string_length              = 0;
+	size_t second_string_length             = 0;
+
+	first_string_length = system_string_length(
+	                       first_string );
+
+	second_string_length = system_string_length(
+	                        second_string );
+
+	/* Include the end-of-string character so that a prefix sorts first
+	 */
+	if( first_string_length < second_string_length )
+	{
+		return( system_string_compare(
+		         first_string,
+		         second_string,
+		         first_string_length + 1 ) );
+	}
+	return( system_string_compare(
+	         first_string,
+	         second_string,
+	         second_string_length + 1 ) );
+}
+
+/* Reads a catalogue entry from the source in a worker thread
+ * Returns 1 if successful or -1 on error
+ */
+int catalogue_handle_process_entry_callback(
+     catalogue_entry_t *catalogue_entry,
+     catalogue_handle_t *catalogue_handle )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "catalogue_handle_process_entry_callback";
+
+	if( catalogue_handle == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalogue handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( catalogue_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	if( catalogue_entry_read(
+	     catalogue_entry,
+	     catalogue_handle->ignore_data_files,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read catalogue entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( catalogue_handle != NULL )
+	{
+		catalogue_handle->thread_failed = 1;
+	}
+#endif
+	return( -1 );
+}
+
+/* Reads the sources and prints a record per source
+ * The sources are sorted and read in batches by the worker threads,
+ * the records of a batch are printed in order after the batch completes
+ * Returns 1 if successful or -1 on error
+ */
+int catalogue_handle_process_sources(
+     catalogue_handle_t *catalogue_handle,
+     libcerror_error_t **error )
+{
+	catalogue_entry_t **catalogue_entries = NULL;
+	static char *function                 = "catalogue_handle_process_sources";
+	int batch_index                       = 0;
+	int batch_size                        = 0;
+	int filename_index                    = 0;
+
+	if( catalogue_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalogue handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( catalogue_handle->thread_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid catalogue handle - thread pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( catalogue_handle->number_of_filenames == 0 )
+	{
+		return( 1 );
+	}
+	/* Sort the sources so that the output does not depend on the directory order of the file system
+	 */
+	qsort(
+	 catalogue_handle->filenames,
+	 (size_t) catalogue_handle->number_of_filenames,
+	 sizeof( system_character_t * ),
+	 &catalogue_handle_compare_filenames );
+
+	catalogue_entries = (catalogue_entry_t **) catalogue_entry_allocate_array(
+	                                            CATALOGUE_HANDLE_BATCH_SIZE,
+	                                            sizeof( catalogue_entry_t * ) );
+
+	if( catalogue_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create catalogue entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( filename_index = 0;
+	     filename_index < catalogue_handle->number_of_filenames;
+	     filename_index += batch_size )
+	{
+		if( catalogue_handle->abort != 0 )
+		{
+			break;
+		}
+		batch_size = catalogue_handle->number_of_filenames - filename_index;
+
+		if( batch_size > CATALOGUE_HANDLE_BATCH_SIZE )
+		{
+			batch_size = CATALOGUE_HANDLE_BATCH_SIZE;
+		}
+		for( batch_index = 0;
+		     batch_index < batch_size;
+		     batch_index++ )
+		{
+			if( catalogue_entry_initialize(
+			     &( catalogue_entries[ batch_index ] ),
+			     catalogue_handle->filenames[ filename_index + batch_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create catalogue entry: %d.",
+				 function,
+				 filename_index + batch_index );
+
+				goto on_error;
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( catalogue_handle->number_of_threads > 0 )
+		{
+			catalogue_handle->thread_failed = 0;
+
+			if( libcthreads_thread_pool_create(
+			     &( catalogue_handle->thread_pool ),
+			     NULL,
+			     catalogue_handle->number_of_threads,
+			     batch_size,
+			     (int (*)(intptr_t *, void *)) &catalogue_handle_process_entry_callback,
+			     (void *) catalogue_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread pool.",
+				 function );
+
+				goto on_error;
+			}
+			for( batch_index = 0;
+			     batch_index < batch_size;
+			     batch_index++ )
+			{
+				if( libcthreads_thread_pool_push(
+				     catalogue_handle->thread_pool,
+				     (intptr_t *) catalogue_entries[ batch_index ],
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push catalogue entry: %d onto thread pool.",
+					 function,
+					 filename_index + batch_index );
+
+					goto on_error;
+				}
+			}
+			if( libcthreads_thread_pool_join(
+			     &( catalogue_handle->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				goto on_error;
+			}
+			if( catalogue_handle->thread_failed != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read catalogue entries.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+		{
+			for( batch_index = 0;
+			     batch_index < batch_size;
+			     batch_index++ )
+			{
+				if( catalogue_handle->abort != 0 )
+				{
+					break;
+				}
+				if( catalogue_entry_read(
+				     catalogue_entries[ batch_index ],
+				     catalogue_handle->ignore_data_files,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read catalogue entry: %d.",
+					 function,
+					 filename_index + batch_index );
+
+					goto on_error;
+				}
+			}
+		}
+		for( batch_index = 0;
+		     batch_index < batch_size;
+		     batch_index++ )
+		{
+			/* Entries that were not read due to an abort are not printed
+			 */
+			if( catalogue_entries[ batch_index ]->result == -1 )
+			{
+				catalogue_handle->number_of_failed_sources += 1;
+			}
+			if( catalogue_entries[ batch_index ]->result != 0 )
+			{
+				if( catalogue_entry_fprint(
+				     catalogue_entries[ batch_index ],
+				     catalogue_handle->notify_stream,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+					 "%s: unable to print catalogue entry: %d.",
+					 function,
+					 filename_index + batch_index );
+
+					goto on_error;
+				}
+			}
+			if( catalogue_entry_free(
+			     &( catalogue_entries[ batch_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free catalogue entry: %d.",
+				 function,
+				 filename_index + batch_index );
+
+				goto on_error;
+			}
+		}
+	}
+	memory_free(
+	 catalogue_entries );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( catalogue_handle->thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( catalogue_handle->thread_pool ),
+		 NULL );
+	}
+#endif
+	if( catalogue_entries != NULL )
+	{
+		for( batch_index = 0;
+		     batch_index < CATALOGUE_HANDLE_BATCH_SIZE;
+		     batch_index++ )
+		{
+			if( catalogue_entries[ batch_index ] != NULL )
+			{
+				catalogue_entry_free(
+				 &( catalogue_entries[ batch_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 catalogue_entries );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,139 @@
+/*
+ * Catalogue handle
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CATALOGUE_HANDLE_H )
+#define _CATALOGUE_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "catalogue_entry.h"
+#include "odrawtools_libcerror.h"
+#include "odrawtools_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct catalogue_handle catalogue_handle_t;
+
+struct catalogue_handle
+{
+	/* The source filenames
+	 */
+	system_character_t **filenames;
+
+	/* The number of source filenames
+	 */
+	int number_of_filenames;
+
+	/* The number of allocated source filenames
+	 */
+	int maximum_number_of_filenames;
+
+	/* Value to indicate to ignore the data files
+	 */
+	uint8_t ignore_data_files;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The number of sources that could not be read
+	 */
+	int number_of_failed_sources;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread pool
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* Value to indicate a thread failed
+	 */
+	int thread_failed;
+#endif
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int catalogue_handle_initialize(
+     catalogue_handle_t **catalogue_handle,
+     libcerror_error_t **error );
+
+int catalogue_handle_free(
+     catalogue_handle_t **catalogue_handle,
+     libcerror_error_t **error );
+
+int catalogue_handle_signal_abort(
+     catalogue_handle_t *catalogue_handle,
+     libcerror_error_t **error );
+
+int catalogue_handle_set_number_of_threads(
+     catalogue_handle_t *catalogue_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int catalogue_handle_append_filename(
+     catalogue_handle_t *catalogue_handle,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int catalogue_handle_filename_is_toc_file(
+     const system_character_t *filename,
+     size_t filename_length );
+
+int catalogue_handle_append_source(
+     catalogue_handle_t *catalogue_handle,
+     const system_character_t *source,
+     libcerror_error_t **error );
+
+int catalogue_handle_scan_directory(
+     catalogue_handle_t *catalogue_handle,
+     const system_character_t *directory_name,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int catalogue_handle_compare_filenames(
+     const void *first_filename,
+     const void *second_filename );
+
+int catalogue_handle_process_entry_callback(
+     catalogue_entry_t *catalogue_entry,
+     catalogue_handle_t *catalogue_handle );
+
+int catalogue_handle_process_sources(
+     catalogue_handle_t *catalogue_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CATALOGUE_HANDLE_H ) */
+
@@ -0,0 +1,1352 @@
+/*
+ * Device scheduler
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_SYS_SYSMACROS_H )
+#include <sys/sysmacros.h>
+#endif
+
+#include <time.h>
+
+#include "device_scheduler.h"
+#include "odrawtools_libcerror.h"
+#include "odrawtools_libcthreads.h"
+#include "odrawtools_libodraw.h"
+#include "process_status.h"
+
+#if defined( WINAPI )
+#define DEVICE_SCHEDULER_PATH_SEPARATOR		(system_character_t) '\\'
+#else
+#define DEVICE_SCHEDULER_PATH_SEPARATOR		(system_character_t) '/'
+#endif
+
+/* Creates a device scheduler
+ * Make sure the value device_scheduler is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int device_scheduler_initialize(
+     device_scheduler_t **device_scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "device_scheduler_initialize";
+
+	if( device_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *device_scheduler != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid device scheduler value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*device_scheduler = memory_allocate_structure(
+	                     device_scheduler_t );
+
+	if( *device_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create device scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *device_scheduler,
+	     0,
+	     sizeof( device_scheduler_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear device scheduler.",
+		 function );
+
+		memory_free(
+		 *device_scheduler );
+
+		*device_scheduler = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *device_scheduler )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *device_scheduler )->source_released_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create source released condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *device_scheduler != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *device_scheduler )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *device_scheduler )->mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *device_scheduler );
+
+		*device_scheduler = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a device scheduler
+ * Returns 1 if successful or -1 on error
+ */
+int device_scheduler_free(
+     device_scheduler_t **device_scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "device_scheduler_free";
+	int result            = 1;
+
+	if( device_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *device_scheduler != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_free(
+		     &( ( *device_scheduler )->source_released_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free source released condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *device_scheduler )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *device_scheduler )->source_states != NULL )
+		{
+			memory_free(
+			 ( *device_scheduler )->source_states );
+		}
+		if( ( *device_scheduler )->source_device_indexes != NULL )
+		{
+			memory_free(
+			 ( *device_scheduler )->source_device_indexes );
+		}
+		if( ( *device_scheduler )->devices != NULL )
+		{
+			memory_free(
+			 ( *device_scheduler )->devices );
+		}
+		memory_free(
+		 *device_scheduler );
+
+		*device_scheduler = NULL;
+	}
+	return( result );
+}
+
+/* Determines if a device is rotational
+ * On Linux this is read from the block device queue attributes in sysfs,
+ * where a partition uses the queue attributes of its parent device
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int device_scheduler_determine_is_rotational(
+     uint64_t device_identifier,
+     int *is_rotational,
+     libcerror_error_t **error )
+{
+#if defined( __linux__ ) && defined( HAVE_SYS_SYSMACROS_H )
+	char path[ 64 ];
+	char value_string[ 4 ];
+
+	FILE *file_stream     = NULL;
+	int path_index        = 0;
+	int print_count       = 0;
+#endif
+	static char *function = "device_scheduler_determine_is_rotational";
+
+	if( is_rotational == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is rotational.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( __linux__ ) && defined( HAVE_SYS_SYSMACROS_H )
+	for( path_index = 0;
+	     path_index < 2;
+	     path_index++ )
+	{
+		print_count = narrow_string_snprintf(
+		               path,
+		               64,
+		               "/sys/dev/block/%u:%u/%squeue/rotational",
+		               (unsigned int) major( (dev_t) device_identifier ),
+		               (unsigned int) minor( (dev_t) device_identifier ),
+		               ( path_index == 0 ) ? "" : "../" );
+
+		if( ( print_count < 0 )
+		 || ( print_count >= 64 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set path.",
+			 function );
+
+			return( -1 );
+		}
+		file_stream = file_stream_open(
+		               path,
+		               FILE_STREAM_OPEN_READ );
+
+		if( file_stream != NULL )
+		{
+			break;
+		}
+	}
+	if( file_stream == NULL )
+	{
+		return( 0 );
+	}
+	if( file_stream_get_string(
+	     file_stream,
+	     value_string,
+	     4 ) == NULL )
+	{
+		file_stream_close(
+		 file_stream );
+
+		return( 0 );
+	}
+	file_stream_close(
+	 file_stream );
+
+	if( value_string[ 0 ] == '0' )
+	{
+		*is_rotational = 0;
+	}
+	else if( value_string[ 0 ] == '1' )
+	{
+		*is_rotational = 1;
+	}
+	else
+	{
+		return( 0 );
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Retrieves the index of the device that stores a file
+ * The device is added if not already known, files of which the device cannot be
+ * determined are assigned to a single device without concurrency limit
+ * Returns 1 if successful or -1 on error
+ */
+int device_scheduler_get_device_index_by_filename(
+     device_scheduler_t *device_scheduler,
+     const system_character_t *filename,
+     int *device_index,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_STAT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	struct stat file_statistics;
+#endif
+
+	device_scheduler_device_t *device  = NULL;
+	device_scheduler_device_t *devices = NULL;
+	static char *function              = "device_scheduler_get_device_index_by_filename";
+	uint64_t device_identifier         = 0;
+	uint8_t device_identifier_is_known = 0;
+	int is_rotational                  = -1;
+	int maximum_number_of_devices      = 0;
+	int result                         = 1;
+	int safe_device_index              = 0;
+
+	if( device_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( device_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_STAT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( stat(
+	     filename,
+	     &file_statistics ) == 0 )
+	{
+		device_identifier          = (uint64_t) file_statistics.st_dev;
+		device_identifier_is_known = 1;
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     device_scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( safe_device_index = 0;
+	     safe_device_index < device_scheduler->number_of_devices;
+	     safe_device_index++ )
+	{
+		device = &( device_scheduler->devices[ safe_device_index ] );
+
+		if( ( device->identifier_is_known == device_identifier_is_known )
+		 && ( device->identifier == device_identifier ) )
+		{
+			break;
+		}
+	}
+	if( safe_device_index >= device_scheduler->number_of_devices )
+	{
+		if( device_scheduler->number_of_devices >= device_scheduler->maximum_number_of_devices )
+		{
+			maximum_number_of_devices = device_scheduler->maximum_number_of_devices + 8;
+
+			devices = (device_scheduler_device_t *) memory_reallocate(
+			                                         device_scheduler->devices,
+			                                         sizeof( device_scheduler_device_t ) * maximum_number_of_devices );
+
+			if( devices == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize devices.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				device_scheduler->devices                   = devices;
+				device_scheduler->maximum_number_of_devices = maximum_number_of_devices;
+			}
+		}
+		if( result == 1 )
+		{
+			if( device_identifier_is_known != 0 )
+			{
+				if( device_scheduler_determine_is_rotational(
+				     device_identifier,
+				     &is_rotational,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine if device is rotational.",
+					 function );
+
+					result = -1;
+				}
+			}
+		}
+		if( result == 1 )
+		{
+			device = &( device_scheduler->devices[ safe_device_index ] );
+
+			if( memory_set(
+			     device,
+			     0,
+			     sizeof( device_scheduler_device_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear device.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( result == 1 )
+		{
+			device->identifier          = device_identifier;
+			device->identifier_is_known = device_identifier_is_known;
+			device->is_rotational       = is_rotational;
+
+			/* A rotational device is read by one source at a time so that it is read
+			 * sequentially instead of seeking between the sources
+			 */
+			if( is_rotational == 1 )
+			{
+				device->maximum_number_of_active_sources = 1;
+			}
+			device_scheduler->number_of_devices += 1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     device_scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*device_index = safe_device_index;
+	}
+	return( result );
+}
+
+/* Retrieves the index of the device that stores the data of a source
+ * The device is determined from the first data file of the source, where
+ * the data file is located relative to the source, as when the source is opened.
+ * If the data files cannot be determined the device of the source is used
+ * Returns 1 if successful or -1 on error
+ */
+int device_scheduler_get_device_index_by_source(
+     device_scheduler_t *device_scheduler,
+     const system_character_t *source,
+     int *device_index,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_STAT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	libcerror_error_t *open_error              = NULL;
+	libodraw_data_file_t *data_file            = NULL;
+	libodraw_handle_t *handle                  = NULL;
+	system_character_t *data_file_location     = NULL;
+	system_character_t *data_file_name         = NULL;
+	const system_character_t *data_file_start  = NULL;
+	const system_character_t *source_name_end  = NULL;
+	size_t data_file_location_size             = 0;
+	size_t data_file_name_length               = 0;
+	size_t data_file_name_size                 = 0;
+	size_t source_path_length                  = 0;
+	int number_of_data_files                   = 0;
+#endif
+	static char *function                      = "device_scheduler_get_device_index_by_source";
+	int result                                 = 0;
+
+	if( device_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_STAT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* Only the table of contents is read, the data files are not opened
+	 */
+	if( libodraw_handle_initialize(
+	     &handle,
+	     &open_error ) != 1 )
+	{
+		goto on_fallback;
+	}
+	if( libodraw_handle_open(
+	     handle,
+	     source,
+	     LIBODRAW_OPEN_READ,
+	     &open_error ) != 1 )
+	{
+		goto on_fallback;
+	}
+	if( libodraw_handle_get_number_of_data_files(
+	     handle,
+	     &number_of_data_files,
+	     &open_error ) != 1 )
+	{
+		goto on_fallback;
+	}
+	if( number_of_data_files == 0 )
+	{
+		goto on_fallback;
+	}
+	if( libodraw_handle_get_data_file(
+	     handle,
+	     0,
+	     &data_file,
+	     &open_error ) != 1 )
+	{
+		goto on_fallback;
+	}
+	if( libodraw_data_file_get_filename_size(
+	     data_file,
+	     &data_file_name_size,
+	     &open_error ) != 1 )
+	{
+		goto on_fallback;
+	}
+	if( ( data_file_name_size <= 1 )
+	 || ( data_file_name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		goto on_fallback;
+	}
+	data_file_name = system_string_allocate(
+	                  data_file_name_size );
+
+	if( data_file_name == NULL )
+	{
+		goto on_fallback;
+	}
+	if( libodraw_data_file_get_filename(
+	     data_file,
+	     data_file_name,
+	     data_file_name_size,
+	     &open_error ) != 1 )
+	{
+		goto on_fallback;
+	}
+	/* The data file is located in the directory of the source
+	 */
+	data_file_start = system_string_search_character_reverse(
+	                   data_file_name,
+	                   DEVICE_SCHEDULER_PATH_SEPARATOR,
+	                   data_file_name_size );
+
+	if( data_file_start != NULL )
+	{
+		data_file_start++;
+	}
+	else
+	{
+		data_file_start = data_file_name;
+	}
+	data_file_name_length = system_string_length(
+	                         data_file_start );
+
+	source_name_end = system_string_search_character_reverse(
+	                   source,
+	                   DEVICE_SCHEDULER_PATH_SEPARATOR,
+	                   system_string_length( source ) + 1 );
+
+	if( source_name_end != NULL )
+	{
+		source_path_length = (size_t) ( source_name_end - source ) + 1;
+	}
+	data_file_location_size = source_path_length + data_file_name_length + 1;
+
+	data_file_location = system_string_allocate(
+	                      data_file_location_size );
+
+	if( data_file_location == NULL )
+	{
+		goto on_fallback;
+	}
+	if( source_path_length > 0 )
+	{
+		if( system_string_copy(
+		     data_file_location,
+		     source,
+		     source_path_length ) == NULL )
+		{
+			goto on_fallback;
+		}
+	}
+	if( system_string_copy(
+	     &( data_file_location[ source_path_length ] ),
+	     data_file_start,
+	     data_file_name_length ) == NULL )
+	{
+		goto on_fallback;
+	}
+	data_file_location[ data_file_location_size - 1 ] = 0;
+
+	result = device_scheduler_get_device_index_by_filename(
+	          device_scheduler,
+	          data_file_location,
+	          device_index,
+	          error );
+
+on_fallback:
+	if( open_error != NULL )
+	{
+		libcerror_error_free(
+		 &open_error );
+	}
+	if( data_file_location != NULL )
+	{
+		memory_free(
+		 data_file_location );
+	}
+	if( data_file_name != NULL )
+	{
+		memory_free(
+		 data_file_name );
+	}
+	if( data_file != NULL )
+	{
+		libodraw_data_file_free(
+		 &data_file,
+		 NULL );
+	}
+	if( handle != NULL )
+	{
+		libodraw_handle_close(
+		 handle,
+		 NULL );
+		libodraw_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device index of data file.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_STAT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	if( result == 0 )
+	{
+		result = device_scheduler_get_device_index_by_filename(
+		          device_scheduler,
+		          source,
+		          device_index,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve device index of source.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends a pending source that is stored on a specific device
+ * Returns 1 if successful or -1 on error
+ */
+int device_scheduler_append_source(
+     device_scheduler_t *device_scheduler,
+     int device_index,
+     int *source_index,
+     libcerror_error_t **error )
+{
+	device_scheduler_device_t *device = NULL;
+	uint8_t *source_states            = NULL;
+	static char *function             = "device_scheduler_append_source";
+	int *source_device_indexes        = NULL;
+	int maximum_number_of_sources     = 0;
+	int result                        = 1;
+
+	if( device_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     device_scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( device_index < 0 )
+	 || ( device_index >= device_scheduler->number_of_devices ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid device index value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else if( device_scheduler->number_of_sources >= device_scheduler->maximum_number_of_sources )
+	{
+		if( device_scheduler->maximum_number_of_sources == 0 )
+		{
+			maximum_number_of_sources = 64;
+		}
+		else
+		{
+			maximum_number_of_sources = device_scheduler->maximum_number_of_sources * 2;
+		}
+		source_device_indexes = (int *) memory_reallocate(
+		                                 device_scheduler->source_device_indexes,
+		                                 sizeof( int ) * maximum_number_of_sources );
+
+		if( source_device_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize source device indexes.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			device_scheduler->source_device_indexes = source_device_indexes;
+
+			source_states = (uint8_t *) memory_reallocate(
+			                             device_scheduler->source_states,
+			                             sizeof( uint8_t ) * maximum_number_of_sources );
+
+			if( source_states == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize source states.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				device_scheduler->source_states             = source_states;
+				device_scheduler->maximum_number_of_sources = maximum_number_of_sources;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		device_scheduler->source_device_indexes[ device_scheduler->number_of_sources ] = device_index;
+		device_scheduler->source_states[ device_scheduler->number_of_sources ]         = DEVICE_SCHEDULER_SOURCE_STATE_PENDING;
+
+		*source_index = device_scheduler->number_of_sources;
+
+		device_scheduler->number_of_sources += 1;
+
+		device = &( device_scheduler->devices[ device_index ] );
+
+		device->queue_depth += 1;
+
+		if( device->queue_depth > device->maximum_queue_depth )
+		{
+			device->maximum_queue_depth = device->queue_depth;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     device_scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the next source to process
+ * This is the first pending source, in order of appending, of which the device
+ * has not reached its maximum number of active sources. When all the devices with
+ * pending sources are at their maximum, the function waits until a source is released.
+ * The source is marked active and must be released with device_scheduler_release_source
+ * Returns 1 if successful, 0 if no pending sources or -1 on error
+ */
+int device_scheduler_get_next_source(
+     device_scheduler_t *device_scheduler,
+     int *source_index,
+     libcerror_error_t **error )
+{
+	device_scheduler_device_t *device = NULL;
+	static char *function             = "device_scheduler_get_next_source";
+	int result                        = 0;
+	int safe_source_index             = 0;
+
+	if( device_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     device_scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( device_scheduler->first_pending_source_index < device_scheduler->number_of_sources )
+	{
+		for( safe_source_index = device_scheduler->first_pending_source_index;
+		     safe_source_index < device_scheduler->number_of_sources;
+		     safe_source_index++ )
+		{
+			if( device_scheduler->source_states[ safe_source_index ] != DEVICE_SCHEDULER_SOURCE_STATE_PENDING )
+			{
+				continue;
+			}
+			device = &( device_scheduler->devices[ device_scheduler->source_device_indexes[ safe_source_index ] ] );
+
+			if( ( device->maximum_number_of_active_sources == 0 )
+			 || ( device->number_of_active_sources < device->maximum_number_of_active_sources ) )
+			{
+				result = 1;
+
+				break;
+			}
+		}
+		if( result != 0 )
+		{
+			break;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_wait(
+		     device_scheduler->source_released_condition,
+		     device_scheduler->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for source released condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+#else
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid device scheduler - pending sources exceed maximum number of active sources.",
+		 function );
+
+		result = -1;
+
+		break;
+#endif
+	}
+	if( result == 1 )
+	{
+		device_scheduler->source_states[ safe_source_index ] = DEVICE_SCHEDULER_SOURCE_STATE_ACTIVE;
+
+		if( device->number_of_active_sources == 0 )
+		{
+			device->busy_start_time = time( NULL );
+		}
+		device->number_of_active_sources += 1;
+
+		while( ( device_scheduler->first_pending_source_index < device_scheduler->number_of_sources )
+		    && ( device_scheduler->source_states[ device_scheduler->first_pending_source_index ] != DEVICE_SCHEDULER_SOURCE_STATE_PENDING ) )
+		{
+			device_scheduler->first_pending_source_index += 1;
+		}
+		*source_index = safe_source_index;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     device_scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Releases an active source and updates the statistics of its device
+ * Returns 1 if successful or -1 on error
+ */
+int device_scheduler_release_source(
+     device_scheduler_t *device_scheduler,
+     int source_index,
+     size64_t number_of_bytes,
+     libcerror_error_t **error )
+{
+	device_scheduler_device_t *device = NULL;
+	static char *function             = "device_scheduler_release_source";
+	int result                        = 1;
+
+	if( device_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device scheduler.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     device_scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( source_index < 0 )
+	 || ( source_index >= device_scheduler->number_of_sources ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source index value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else if( device_scheduler->source_states[ source_index ] != DEVICE_SCHEDULER_SOURCE_STATE_ACTIVE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source: %d - not active.",
+		 function,
+		 source_index );
+
+		result = -1;
+	}
+	else
+	{
+		device_scheduler->source_states[ source_index ] = DEVICE_SCHEDULER_SOURCE_STATE_DONE;
+
+		device = &( device_scheduler->devices[ device_scheduler->source_device_indexes[ source_index ] ] );
+
+		device->number_of_active_sources -= 1;
+		device->queue_depth              -= 1;
+		device->number_of_sources        += 1;
+		device->number_of_bytes          += number_of_bytes;
+
+		if( device->number_of_active_sources == 0 )
+		{
+			device->busy_time += time( NULL ) - device->busy_start_time;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_broadcast(
+		     device_scheduler->source_released_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast source released condition.",
+			 function );
+
+			result = -1;
+		}
+#endif
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     device_scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Empties the sources
+ * The devices and their statistics are retained
+ * Returns 1 if successful or -1 on error
+ */
+int device_scheduler_empty_sources(
+     device_scheduler_t *device_scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "device_scheduler_empty_sources";
+	int device_index      = 0;
+
+	if( device_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	for( device_index = 0;
+	     device_index < device_scheduler->number_of_devices;
+	     device_index++ )
+	{
+		if( device_scheduler->devices[ device_index ].number_of_active_sources != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid device: %d - active sources.",
+			 function,
+			 device_index );
+
+			return( -1 );
+		}
+		device_scheduler->devices[ device_index ].queue_depth = 0;
+	}
+	device_scheduler->number_of_sources          = 0;
+	device_scheduler->first_pending_source_index = 0;
+
+	return( 1 );
+}
+
+/* Prints the per device statistics to a stream
+ * Returns 1 if successful or -1 on error
+ */
+int device_scheduler_fprint(
+     device_scheduler_t *device_scheduler,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	device_scheduler_device_t *device = NULL;
+	static char *function             = "device_scheduler_fprint";
+	int device_index                  = 0;
+
+	if( device_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	for( device_index = 0;
+	     device_index < device_scheduler->number_of_devices;
+	     device_index++ )
+	{
+		device = &( device_scheduler->devices[ device_index ] );
+
+		if( device->identifier_is_known == 0 )
+		{
+			fprintf(
+			 stream,
+			 "Device:\t\t\t\t\tunknown\n" );
+		}
+#if defined( __linux__ ) && defined( HAVE_SYS_SYSMACROS_H )
+		else
+		{
+			fprintf(
+			 stream,
+			 "Device:\t\t\t\t\t%u:%u\n",
+			 (unsigned int) major( (dev_t) device->identifier ),
+			 (unsigned int) minor( (dev_t) device->identifier ) );
+		}
+#else
+		else
+		{
+			fprintf(
+			 stream,
+			 "Device:\t\t\t\t\t0x%08" PRIx64 "\n",
+			 device->identifier );
+		}
+#endif
+		fprintf(
+		 stream,
+		 "\tRotational:\t\t\t%s\n",
+		 ( device->is_rotational == 1 ) ? "yes" : ( ( device->is_rotational == 0 ) ? "no" : "unknown" ) );
+
+		if( device->maximum_number_of_active_sources == 0 )
+		{
+			fprintf(
+			 stream,
+			 "\tMaximum concurrent sources:\tunlimited\n" );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "\tMaximum concurrent sources:\t%d\n",
+			 device->maximum_number_of_active_sources );
+		}
+		fprintf(
+		 stream,
+		 "\tMaximum queue depth:\t\t%d\n",
+		 device->maximum_queue_depth );
+
+		fprintf(
+		 stream,
+		 "\tNumber of sources:\t\t%d\n",
+		 device->number_of_sources );
+
+		fprintf(
+		 stream,
+		 "\tRead:\t\t\t\t" );
+
+		process_status_bytes_fprint(
+		 stream,
+		 device->number_of_bytes );
+
+		process_status_timestamp_fprint(
+		 stream,
+		 device->busy_time );
+
+		process_status_bytes_per_second_fprint(
+		 stream,
+		 device->number_of_bytes,
+		 device->busy_time );
+
+		fprintf(
+		 stream,
+		 "\n" );
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	return( 1 );
+}
+
@@ -0,0 +1,193 @@
+/*
+ * Device scheduler
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _DEVICE_SCHEDULER_H )
+#define _DEVICE_SCHEDULER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "odrawtools_libcerror.h"
+#include "odrawtools_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum DEVICE_SCHEDULER_SOURCE_STATES
+{
+	DEVICE_SCHEDULER_SOURCE_STATE_PENDING	= 0,
+	DEVICE_SCHEDULER_SOURCE_STATE_ACTIVE	= 1,
+	DEVICE_SCHEDULER_SOURCE_STATE_DONE	= 2
+};
+
+typedef struct device_scheduler_device device_scheduler_device_t;
+
+struct device_scheduler_device
+{
+	/* The device identifier
+	 */
+	uint64_t identifier;
+
+	/* Value to indicate the device identifier is known
+	 */
+	uint8_t identifier_is_known;
+
+	/* Value to indicate the device is rotational
+	 * -1 if unknown, 0 if not rotational or 1 if rotational
+	 */
+	int is_rotational;
+
+	/* The maximum number of sources that are active concurrently
+	 * 0 represents no limit
+	 */
+	int maximum_number_of_active_sources;
+
+	/* The number of active sources
+	 */
+	int number_of_active_sources;
+
+	/* The queue depth, which is the number of pending and active sources
+	 */
+	int queue_depth;
+
+	/* The maximum queue depth
+	 */
+	int maximum_queue_depth;
+
+	/* The number of sources processed
+	 */
+	int number_of_sources;
+
+	/* The number of bytes processed
+	 */
+	size64_t number_of_bytes;
+
+	/* The time the device became busy
+	 */
+	time_t busy_start_time;
+
+	/* The number of seconds the device was busy
+	 */
+	time_t busy_time;
+};
+
+typedef struct device_scheduler device_scheduler_t;
+
+struct device_scheduler
+{
+	/* The devices
+	 */
+	device_scheduler_device_t *devices;
+
+	/* The number of devices
+	 */
+	int number_of_devices;
+
+	/* The maximum number of devices
+	 */
+	int maximum_number_of_devices;
+
+	/* The device index per source
+	 */
+	int *source_device_indexes;
+
+	/* The state per source
+	 */
+	uint8_t *source_states;
+
+	/* The number of sources
+	 */
+	int number_of_sources;
+
+	/* The maximum number of sources
+	 */
+	int maximum_number_of_sources;
+
+	/* The index of the first source that is pending
+	 */
+	int first_pending_source_index;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the devices and sources
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when a source is released
+	 */
+	libcthreads_condition_t *source_released_condition;
+#endif
+};
+
+int device_scheduler_initialize(
+     device_scheduler_t **device_scheduler,
+     libcerror_error_t **error );
+
+int device_scheduler_free(
+     device_scheduler_t **device_scheduler,
+     libcerror_error_t **error );
+
+int device_scheduler_get_device_index_by_filename(
+     device_scheduler_t *device_scheduler,
+     const system_character_t *filename,
+     int *device_index,
+     libcerror_error_t **error );
+
+int device_scheduler_get_device_index_by_source(
+     device_scheduler_t *device_scheduler,
+     const system_character_t *source,
+     int *device_index,
+     libcerror_error_t **error );
+
+int device_scheduler_append_source(
+     device_scheduler_t *device_scheduler,
+     int device_index,
+     int *source_index,
+     libcerror_error_t **error );
+
+int device_scheduler_get_next_source(
+     device_scheduler_t *device_scheduler,
+     int *source_index,
+     libcerror_error_t **error );
+
+int device_scheduler_release_source(
+     device_scheduler_t *device_scheduler,
+     int source_index,
+     size64_t number_of_bytes,
+     libcerror_error_t **error );
+
+int device_scheduler_empty_sources(
+     device_scheduler_t *device_scheduler,
+     libcerror_error_t **error );
+
+int device_scheduler_fprint(
+     device_scheduler_t *device_scheduler,
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DEVICE_SCHEDULER_H ) */
+
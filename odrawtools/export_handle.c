@@ -0,0 +1,1895 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "byte_size_string.h"
+#include "export_handle.h"
+#include "odrawtools_libcerror.h"
+#include "odrawtools_libcfile.h"
+#include "odrawtools_libcnotify.h"
+#include "odrawtools_libcthreads.h"
+#include "odrawtools_libodraw.h"
+#include "process_status.h"
+#include "storage_media_buffer.h"
+
+#define EXPORT_HANDLE_NOTIFY_STREAM				stdout
+
+#define EXPORT_HANDLE_DEFAULT_PROCESS_BUFFER_SIZE		1048576
+#define EXPORT_HANDLE_DEFAULT_NUMBER_OF_THREADS			4
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS			32
+
+/* Creates an export handle
+ * Make sure the value export_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_initialize";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*export_handle = memory_allocate_structure(
+	                  export_handle_t );
+
+	if( *export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_handle,
+	     0,
+	     sizeof( export_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export handle.",
+		 function );
+
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+
+		return( -1 );
+	}
+	if( libodraw_handle_initialize(
+	     &( ( *export_handle )->input_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_initialize(
+	     &( ( *export_handle )->output_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize output file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *export_handle )->output_thread_failed_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output thread failed mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *export_handle )->output_format       = EXPORT_HANDLE_OUTPUT_FORMAT_ISO;
+	( *export_handle )->process_buffer_size = EXPORT_HANDLE_DEFAULT_PROCESS_BUFFER_SIZE;
+	( *export_handle )->number_of_threads   = EXPORT_HANDLE_DEFAULT_NUMBER_OF_THREADS;
+	( *export_handle )->notify_stream       = EXPORT_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *export_handle != NULL )
+	{
+		if( ( *export_handle )->output_file != NULL )
+		{
+			libcfile_file_free(
+			 &( ( *export_handle )->output_file ),
+			 NULL );
+		}
+		if( ( *export_handle )->input_handle != NULL )
+		{
+			libodraw_handle_free(
+			 &( ( *export_handle )->input_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an export handle
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_free";
+	int result            = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		if( ( ( *export_handle )->input_handle != NULL )
+		 && ( libodraw_handle_free(
+		       &( ( *export_handle )->input_handle ),
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input handle.",
+			 function );
+
+			result = -1;
+		}
+		if( ( ( *export_handle )->output_file != NULL )
+		 && ( libcfile_file_free(
+		       &( ( *export_handle )->output_file ),
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output file.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( ( *export_handle )->output_file_queue != NULL )
+		 && ( libcthreads_queue_free(
+		       &( ( *export_handle )->output_file_queue ),
+		       (int (*)(intptr_t **, libcerror_error_t **)) &libcfile_file_free,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output file queue.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *export_handle )->output_thread_failed_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output thread failed mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the export handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_signal_abort";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_handle != NULL )
+	{
+		if( libodraw_handle_signal_abort(
+		     export_handle->input_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input handle to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	export_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Opens the input of the export handle
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_input";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libodraw_handle_open_wide(
+	     export_handle->input_handle,
+	     filename,
+	     LIBODRAW_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libodraw_handle_open(
+	     export_handle->input_handle,
+	     filename,
+	     LIBODRAW_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_handle_open_data_files(
+	     export_handle->input_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open data files.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the output of the export handle
+ * When multi-threading is used every output thread is given its own output file
+ * so that buffers can be written at different offsets concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_output(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function        = "export_handle_open_output";
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcfile_file_t *output_file = NULL;
+	int thread_index             = 0;
+#endif
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcfile_file_open_wide(
+	     export_handle->output_file,
+	     filename,
+	     LIBCFILE_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+#else
+	if( libcfile_file_open(
+	     export_handle->output_file,
+	     filename,
+	     LIBCFILE_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->number_of_threads > 0 )
+	{
+		if( libcthreads_queue_initialize(
+		     &( export_handle->output_file_queue ),
+		     export_handle->number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize output file queue.",
+			 function );
+
+			goto on_error;
+		}
+		for( thread_index = 0;
+		     thread_index < export_handle->number_of_threads;
+		     thread_index++ )
+		{
+			if( libcfile_file_initialize(
+			     &output_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize output file: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			if( libcfile_file_open_wide(
+			     output_file,
+			     filename,
+			     LIBCFILE_OPEN_WRITE,
+			     error ) != 1 )
+#else
+			if( libcfile_file_open(
+			     output_file,
+			     filename,
+			     LIBCFILE_OPEN_WRITE,
+			     error ) != 1 )
+#endif
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open output file: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+			if( libcthreads_queue_push(
+			     export_handle->output_file_queue,
+			     (intptr_t *) output_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push output file: %d onto queue.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+			output_file = NULL;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( output_file != NULL )
+	{
+		libcfile_file_free(
+		 &output_file,
+		 NULL );
+	}
+	if( export_handle->output_file_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &( export_handle->output_file_queue ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libcfile_file_free,
+		 NULL );
+	}
+#endif
+	libcfile_file_close(
+	 export_handle->output_file,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Closes the export handle
+ * Returns the 0 if succesful or -1 on error
+ */
+int export_handle_close(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Freeing the output files also closes them
+	 */
+	if( export_handle->output_file_queue != NULL )
+	{
+		if( libcthreads_queue_free(
+		     &( export_handle->output_file_queue ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libcfile_file_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output file queue.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	if( libcfile_file_close(
+	     export_handle->output_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close output file.",
+		 function );
+
+		result = -1;
+	}
+	if( libodraw_handle_close(
+	     export_handle->input_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input handle.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Retrieves the size of the output
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_output_size(
+     export_handle_t *export_handle,
+     size64_t *output_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "export_handle_get_output_size";
+	uint64_t number_of_sectors = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_handle_get_number_of_sectors(
+	     export_handle->input_handle,
+	     &number_of_sectors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sectors.",
+		 function );
+
+		return( -1 );
+	}
+	*output_size = (size64_t) number_of_sectors * export_handle->output_bytes_per_sector;
+
+	return( 1 );
+}
+
+/* Reads sectors from the input into a storage media buffer
+ * Cooked (ISO) output is read using the media data of the input handle, raw output
+ * is read directly from the data file, where any sub-channel data is stripped
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t export_handle_read_storage_media_buffer(
+         export_handle_t *export_handle,
+         storage_media_buffer_t *storage_media_buffer,
+         int data_file_index,
+         off64_t data_file_offset,
+         uint32_t bytes_per_sector,
+         uint64_t start_sector,
+         uint64_t number_of_sectors,
+         libcerror_error_t **error )
+{
+	static char *function = "export_handle_read_storage_media_buffer";
+	size_t buffer_offset  = 0;
+	size_t read_size      = 0;
+	size_t sector_offset  = 0;
+	ssize_t read_count    = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_format == EXPORT_HANDLE_OUTPUT_FORMAT_RAW )
+	{
+		read_size = (size_t) number_of_sectors * bytes_per_sector;
+	}
+	else
+	{
+		read_size = (size_t) number_of_sectors * export_handle->output_bytes_per_sector;
+	}
+	if( read_size > storage_media_buffer->raw_buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid storage media buffer - raw buffer too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_format == EXPORT_HANDLE_OUTPUT_FORMAT_RAW )
+	{
+		read_count = libodraw_handle_read_data_file_buffer_at_offset(
+		              export_handle->input_handle,
+		              data_file_index,
+		              storage_media_buffer->raw_buffer,
+		              read_size,
+		              data_file_offset,
+		              error );
+	}
+	else
+	{
+		read_count = libodraw_handle_read_buffer_at_offset(
+		              export_handle->input_handle,
+		              storage_media_buffer->raw_buffer,
+		              read_size,
+		              (off64_t) ( start_sector * export_handle->output_bytes_per_sector ),
+		              error );
+	}
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sector: %" PRIu64 " - %" PRIu64 ".",
+		 function,
+		 start_sector,
+		 start_sector + number_of_sectors );
+
+		return( -1 );
+	}
+	if( ( export_handle->output_format == EXPORT_HANDLE_OUTPUT_FORMAT_RAW )
+	 && ( bytes_per_sector > export_handle->output_bytes_per_sector ) )
+	{
+		/* The first sector is already in place
+		 */
+		buffer_offset = export_handle->output_bytes_per_sector;
+		sector_offset = bytes_per_sector;
+
+		while( sector_offset < read_size )
+		{
+			memory_copy(
+			 &( storage_media_buffer->raw_buffer[ buffer_offset ] ),
+			 &( storage_media_buffer->raw_buffer[ sector_offset ] ),
+			 export_handle->output_bytes_per_sector );
+
+			buffer_offset += export_handle->output_bytes_per_sector;
+			sector_offset += bytes_per_sector;
+		}
+		read_count = (ssize_t) buffer_offset;
+	}
+	storage_media_buffer->raw_buffer_data_size = (size_t) read_count;
+	storage_media_buffer->storage_media_offset = (off64_t) ( start_sector * export_handle->output_bytes_per_sector );
+
+	return( read_count );
+}
+
+/* Writes a storage media buffer to the output
+ * Buffers that only contain 0-byte values are not written so that the output remains sparse
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t export_handle_write_storage_media_buffer(
+         export_handle_t *export_handle,
+         libcfile_file_t *output_file,
+         storage_media_buffer_t *storage_media_buffer,
+         libcerror_error_t **error )
+{
+	static char *function = "export_handle_write_storage_media_buffer";
+	ssize_t write_count   = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer->raw_buffer_data_size == 0 )
+	{
+		return( 0 );
+	}
+	if( ( storage_media_buffer->raw_buffer[ 0 ] == 0 )
+	 && ( memory_compare(
+	       storage_media_buffer->raw_buffer,
+	       &( storage_media_buffer->raw_buffer[ 1 ] ),
+	       storage_media_buffer->raw_buffer_data_size - 1 ) == 0 ) )
+	{
+		return( (ssize_t) storage_media_buffer->raw_buffer_data_size );
+	}
+	if( libcfile_file_seek_offset(
+	     output_file,
+	     storage_media_buffer->storage_media_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " in output file.",
+		 function,
+		 storage_media_buffer->storage_media_offset );
+
+		return( -1 );
+	}
+	write_count = libcfile_file_write_buffer(
+	               output_file,
+	               storage_media_buffer->raw_buffer,
+	               storage_media_buffer->raw_buffer_data_size,
+	               error );
+
+	if( write_count != (ssize_t) storage_media_buffer->raw_buffer_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer at offset: %" PRIi64 " to output file.",
+		 function,
+		 storage_media_buffer->storage_media_offset );
+
+		return( -1 );
+	}
+	return( write_count );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Marks that an output thread failed
+ * Returns 1 if successful, 0 if an output thread already failed or -1 on error
+ */
+int export_handle_set_output_thread_failed(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_output_thread_failed";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     export_handle->output_thread_failed_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab output thread failed mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_thread_failed == 0 )
+	{
+		export_handle->output_thread_failed = 1;
+
+		result = 1;
+	}
+	if( libcthreads_mutex_release(
+	     export_handle->output_thread_failed_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release output thread failed mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the value to indicate an output thread failed
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_output_thread_failed(
+     export_handle_t *export_handle,
+     int *output_thread_failed,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_get_output_thread_failed";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_thread_failed == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output thread failed.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     export_handle->output_thread_failed_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab output thread failed mutex.",
+		 function );
+
+		return( -1 );
+	}
+	*output_thread_failed = export_handle->output_thread_failed;
+
+	if( libcthreads_mutex_release(
+	     export_handle->output_thread_failed_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release output thread failed mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a storage media buffer to the output, called by the output thread pool
+ * The storage media buffer is always returned to the empty storage media buffer queue
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_output_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     export_handle_t *export_handle )
+{
+	libcerror_error_t *error     = NULL;
+	libcfile_file_t *output_file = NULL;
+	static char *function        = "export_handle_output_storage_media_buffer_callback";
+	ssize_t write_count          = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_pop(
+	     export_handle->output_file_queue,
+	     (intptr_t **) &output_file,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to pop output file from queue.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = export_handle_write_storage_media_buffer(
+	               export_handle,
+	               output_file,
+	               storage_media_buffer,
+	               &error );
+
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write storage media buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_push(
+	     export_handle->output_file_queue,
+	     (intptr_t *) output_file,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push output file onto queue.",
+		 function );
+
+		/* The output file is no longer managed by the queue
+		 */
+		libcfile_file_close(
+		 output_file,
+		 NULL );
+		libcfile_file_free(
+		 &output_file,
+		 NULL );
+
+		goto on_error;
+	}
+	output_file = NULL;
+
+	if( libcthreads_queue_push(
+	     export_handle->empty_storage_media_buffer_queue,
+	     (intptr_t *) storage_media_buffer,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push storage media buffer onto queue.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_handle != NULL )
+	{
+		if( output_file != NULL )
+		{
+			libcthreads_queue_push(
+			 export_handle->output_file_queue,
+			 (intptr_t *) output_file,
+			 NULL );
+		}
+		export_handle_set_output_thread_failed(
+		 export_handle,
+		 NULL );
+	}
+	if( storage_media_buffer != NULL )
+	{
+		/* Return the buffer so the reading thread does not block on the empty queue
+		 */
+		if( ( export_handle == NULL )
+		 || ( libcthreads_queue_push(
+		       export_handle->empty_storage_media_buffer_queue,
+		       (intptr_t *) storage_media_buffer,
+		       NULL ) != 1 ) )
+		{
+			storage_media_buffer_free(
+			 &storage_media_buffer,
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Exports the input
+ * The extents of the input are used to determine which sectors are stored in the data files,
+ * sparse extents are not written so that the output file contains holes
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_input(
+     export_handle_t *export_handle,
+     uint8_t print_status_information,
+     libcerror_error_t **error )
+{
+	process_status_t *process_status             = NULL;
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	static char *function                        = "export_handle_export_input";
+	size64_t export_count                        = 0;
+	size64_t extent_size                         = 0;
+	size64_t output_size                         = 0;
+	size_t buffer_size                           = 0;
+	ssize_t read_count                           = 0;
+	ssize_t write_count                          = 0;
+	off64_t data_file_offset                     = 0;
+	off64_t extent_offset                        = 0;
+	uint64_t extent_number_of_sectors            = 0;
+	uint64_t number_of_sectors                   = 0;
+	uint64_t sectors_per_buffer                  = 0;
+	uint64_t start_sector                        = 0;
+	uint32_t bytes_per_sector                    = 0;
+	uint32_t extent_flags                        = 0;
+	uint32_t maximum_bytes_per_sector            = 0;
+	uint32_t media_bytes_per_sector              = 0;
+	uint8_t track_type                           = 0;
+	int data_file_index                          = 0;
+	int extent_index                             = 0;
+	int number_of_extents                        = 0;
+	int status                                   = PROCESS_STATUS_COMPLETED;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int buffer_index                             = 0;
+	int number_of_buffers                        = 0;
+	int output_thread_failed                     = 0;
+#endif
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_handle_get_bytes_per_sector(
+	     export_handle->input_handle,
+	     &media_bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bytes per sector.",
+		 function );
+
+		goto on_error;
+	}
+	if( media_bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bytes per sector value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->output_format == EXPORT_HANDLE_OUTPUT_FORMAT_RAW )
+	{
+		export_handle->output_bytes_per_sector = 2352;
+		maximum_bytes_per_sector               = 2448;
+	}
+	else
+	{
+		export_handle->output_bytes_per_sector = media_bytes_per_sector;
+		maximum_bytes_per_sector               = media_bytes_per_sector;
+	}
+	if( export_handle_get_output_size(
+	     export_handle,
+	     &output_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve output size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_handle_get_number_of_extents(
+	     export_handle->input_handle,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		goto on_error;
+	}
+	sectors_per_buffer = export_handle->process_buffer_size / export_handle->output_bytes_per_sector;
+
+	if( sectors_per_buffer == 0 )
+	{
+		sectors_per_buffer = 1;
+	}
+	buffer_size = (size_t) sectors_per_buffer * maximum_bytes_per_sector;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->output_file_queue != NULL )
+	{
+		number_of_buffers = export_handle->number_of_threads * 2;
+
+		if( libcthreads_queue_initialize(
+		     &( export_handle->empty_storage_media_buffer_queue ),
+		     number_of_buffers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize empty storage media buffer queue.",
+			 function );
+
+			goto on_error;
+		}
+		for( buffer_index = 0;
+		     buffer_index < number_of_buffers;
+		     buffer_index++ )
+		{
+			if( storage_media_buffer_initialize(
+			     &storage_media_buffer,
+			     buffer_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create storage media buffer: %d.",
+				 function,
+				 buffer_index );
+
+				goto on_error;
+			}
+			if( libcthreads_queue_push(
+			     export_handle->empty_storage_media_buffer_queue,
+			     (intptr_t *) storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push storage media buffer: %d onto queue.",
+				 function,
+				 buffer_index );
+
+				goto on_error;
+			}
+			storage_media_buffer = NULL;
+		}
+		export_handle->output_thread_failed = 0;
+
+		if( libcthreads_thread_pool_create(
+		     &( export_handle->output_thread_pool ),
+		     NULL,
+		     export_handle->number_of_threads,
+		     number_of_buffers,
+		     (int (*)(intptr_t *, void *)) &export_handle_output_storage_media_buffer_callback,
+		     (void *) export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create output thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	if( storage_media_buffer_initialize(
+	     &storage_media_buffer,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create storage media buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status_initialize(
+	     &process_status,
+	     _SYSTEM_STRING( "Export" ),
+	     _SYSTEM_STRING( "exported" ),
+	     _SYSTEM_STRING( "Written" ),
+	     export_handle->notify_stream,
+	     print_status_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status_start(
+	     process_status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start process status.",
+		 function );
+
+		goto on_error;
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( libodraw_handle_get_extent(
+		     export_handle->input_handle,
+		     extent_index,
+		     &extent_offset,
+		     &extent_size,
+		     &data_file_index,
+		     &data_file_offset,
+		     &bytes_per_sector,
+		     &track_type,
+		     &extent_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		start_sector             = (uint64_t) extent_offset / media_bytes_per_sector;
+		extent_number_of_sectors = (uint64_t) extent_size / media_bytes_per_sector;
+
+		if( ( extent_flags & LIBODRAW_EXTENT_FLAG_IS_SPARSE ) != 0 )
+		{
+			export_count += extent_number_of_sectors * export_handle->output_bytes_per_sector;
+
+			continue;
+		}
+		if( ( export_handle->output_format == EXPORT_HANDLE_OUTPUT_FORMAT_RAW )
+		 && ( bytes_per_sector != 2352 )
+		 && ( bytes_per_sector != 2448 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported extent: %d bytes per sector: %" PRIu32 " for raw output.",
+			 function,
+			 extent_index,
+			 bytes_per_sector );
+
+			goto on_error;
+		}
+		while( extent_number_of_sectors > 0 )
+		{
+			number_of_sectors = sectors_per_buffer;
+
+			if( number_of_sectors > extent_number_of_sectors )
+			{
+				number_of_sectors = extent_number_of_sectors;
+			}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( export_handle->output_thread_pool != NULL )
+			{
+				if( libcthreads_queue_pop(
+				     export_handle->empty_storage_media_buffer_queue,
+				     (intptr_t **) &storage_media_buffer,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to pop storage media buffer from queue.",
+					 function );
+
+					goto on_error;
+				}
+				if( export_handle_get_output_thread_failed(
+				     export_handle,
+				     &output_thread_failed,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine if an output thread failed.",
+					 function );
+
+					goto on_error;
+				}
+				if( output_thread_failed != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write output.",
+					 function );
+
+					goto on_error;
+				}
+			}
+#endif
+			read_count = export_handle_read_storage_media_buffer(
+			              export_handle,
+			              storage_media_buffer,
+			              data_file_index,
+			              data_file_offset,
+			              bytes_per_sector,
+			              start_sector,
+			              number_of_sectors,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( export_handle->output_thread_pool != NULL )
+			{
+				if( libcthreads_thread_pool_push(
+				     export_handle->output_thread_pool,
+				     (intptr_t *) storage_media_buffer,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push storage media buffer onto output thread pool.",
+					 function );
+
+					goto on_error;
+				}
+				storage_media_buffer = NULL;
+			}
+			else
+#endif
+			{
+				write_count = export_handle_write_storage_media_buffer(
+				               export_handle,
+				               export_handle->output_file,
+				               storage_media_buffer,
+				               error );
+
+				if( write_count < 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write data.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			start_sector             += number_of_sectors;
+			extent_number_of_sectors -= number_of_sectors;
+			data_file_offset         += (off64_t) ( number_of_sectors * bytes_per_sector );
+			export_count             += (size64_t) read_count;
+
+			if( process_status_update(
+			     process_status,
+			     export_count,
+			     output_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update process status.",
+				 function );
+
+				goto on_error;
+			}
+			if( export_handle->abort != 0 )
+			{
+				break;
+			}
+		}
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->output_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( export_handle->output_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join output thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_queue_free(
+		     &( export_handle->empty_storage_media_buffer_queue ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &storage_media_buffer_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free empty storage media buffer queue.",
+			 function );
+
+			goto on_error;
+		}
+		if( export_handle_get_output_thread_failed(
+		     export_handle,
+		     &output_thread_failed,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if an output thread failed.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_thread_failed != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write output.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( storage_media_buffer != NULL )
+	{
+		if( storage_media_buffer_free(
+		     &storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free storage media buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( export_handle->abort == 0 )
+	{
+		/* Extend the output to the full size, trailing sparse extents and
+		 * buffers that were not written are left as holes
+		 */
+		if( libcfile_file_resize(
+		     export_handle->output_file,
+		     output_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to resize output file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		status = PROCESS_STATUS_ABORTED;
+	}
+	if( process_status_stop(
+	     process_status,
+	     export_count,
+	     status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to stop process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status_free(
+	     &process_status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free process status.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->output_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( export_handle->output_thread_pool ),
+		 NULL );
+	}
+	if( export_handle->empty_storage_media_buffer_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &( export_handle->empty_storage_media_buffer_queue ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &storage_media_buffer_free,
+		 NULL );
+	}
+#endif
+	if( process_status != NULL )
+	{
+		process_status_stop(
+		 process_status,
+		 export_count,
+		 PROCESS_STATUS_FAILED,
+		 NULL );
+		process_status_free(
+		 &process_status,
+		 NULL );
+	}
+	if( storage_media_buffer != NULL )
+	{
+		storage_media_buffer_free(
+		 &storage_media_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the output format
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_output_format(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_output_format";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 3 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "iso" ),
+		     3 ) == 0 )
+		{
+			export_handle->output_format = EXPORT_HANDLE_OUTPUT_FORMAT_ISO;
+			result                       = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "raw" ),
+		          3 ) == 0 )
+		{
+			export_handle->output_format = EXPORT_HANDLE_OUTPUT_FORMAT_RAW;
+			result                       = 1;
+		}
+	}
+	return( result );
+}
+
+/* Sets the process buffer size
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_process_buffer_size(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function  = "export_handle_set_process_buffer_size";
+	size_t string_length   = 0;
+	uint64_t size_variable = 0;
+	int result             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	result = byte_size_string_convert(
+	          string,
+	          string_length,
+	          &size_variable,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine process buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* The buffers are allocated for the largest sector size, sub-channel data included
+		 */
+		if( ( size_variable == 0 )
+		 || ( size_variable > (uint64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2448 * 2048 ) ) )
+		{
+			result = 0;
+		}
+		else
+		{
+			export_handle->process_buffer_size = (size_t) size_variable;
+		}
+	}
+	return( result );
+}
+
+/* Sets the number of output threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_number_of_threads";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int number_of_threads = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 2 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		number_of_threads *= 10;
+		number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( number_of_threads > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		return( 0 );
+	}
+	export_handle->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
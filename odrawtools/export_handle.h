@@ -0,0 +1,193 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_HANDLE_H )
+#define _EXPORT_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "odrawtools_libcerror.h"
+#include "odrawtools_libcfile.h"
+#include "odrawtools_libcthreads.h"
+#include "odrawtools_libodraw.h"
+#include "storage_media_buffer.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum EXPORT_HANDLE_OUTPUT_FORMATS
+{
+	EXPORT_HANDLE_OUTPUT_FORMAT_ISO	= (int) 'i',
+	EXPORT_HANDLE_OUTPUT_FORMAT_RAW	= (int) 'r'
+};
+
+typedef struct export_handle export_handle_t;
+
+struct export_handle
+{
+	/* The libodraw input handle
+	 */
+	libodraw_handle_t *input_handle;
+
+	/* The output file
+	 */
+	libcfile_file_t *output_file;
+
+	/* The output format
+	 */
+	int output_format;
+
+	/* The number of bytes per sector of the output
+	 */
+	uint32_t output_bytes_per_sector;
+
+	/* The process buffer size
+	 */
+	size_t process_buffer_size;
+
+	/* The number of output threads
+	 */
+	int number_of_threads;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The output thread pool
+	 */
+	libcthreads_thread_pool_t *output_thread_pool;
+
+	/* The queue of output files used by the output threads
+	 */
+	libcthreads_queue_t *output_file_queue;
+
+	/* The queue of storage media buffers available for reading
+	 */
+	libcthreads_queue_t *empty_storage_media_buffer_queue;
+
+	/* Value to indicate an output thread failed
+	 */
+	int output_thread_failed;
+
+	/* The mutex protecting the output thread failed value
+	 */
+	libcthreads_mutex_t *output_thread_failed_mutex;
+#endif
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     libcerror_error_t **error );
+
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error );
+
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_open_output(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_close(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_get_output_size(
+     export_handle_t *export_handle,
+     size64_t *output_size,
+     libcerror_error_t **error );
+
+ssize_t export_handle_read_storage_media_buffer(
+         export_handle_t *export_handle,
+         storage_media_buffer_t *storage_media_buffer,
+         int data_file_index,
+         off64_t data_file_offset,
+         uint32_t bytes_per_sector,
+         uint64_t start_sector,
+         uint64_t number_of_sectors,
+         libcerror_error_t **error );
+
+ssize_t export_handle_write_storage_media_buffer(
+         export_handle_t *export_handle,
+         libcfile_file_t *output_file,
+         storage_media_buffer_t *storage_media_buffer,
+         libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int export_handle_set_output_thread_failed(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_get_output_thread_failed(
+     export_handle_t *export_handle,
+     int *output_thread_failed,
+     libcerror_error_t **error );
+
+int export_handle_output_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     export_handle_t *export_handle );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int export_handle_export_input(
+     export_handle_t *export_handle,
+     uint8_t print_status_information,
+     libcerror_error_t **error );
+
+int export_handle_set_output_format(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_process_buffer_size(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXPORT_HANDLE_H ) */
+
@@ -33,11 +33,16 @@
 
 #include "info_handle.h"
 #include "odrawtools_libcerror.h"
+#include "odrawtools_libcnotify.h"
+#include "odrawtools_libcthreads.h"
 #include "odrawtools_libodraw.h"
 
-#define INFO_HANDLE_VALUE_SIZE			512
-#define INFO_HANDLE_VALUE_IDENTIFIER_SIZE	64
-#define INFO_HANDLE_NOTIFY_STREAM		stdout
+#define INFO_HANDLE_VALUE_SIZE				512
+#define INFO_HANDLE_VALUE_IDENTIFIER_SIZE		64
+#define INFO_HANDLE_NOTIFY_STREAM			stdout
+
+#define INFO_HANDLE_DEFAULT_NUMBER_OF_THREADS		4
+#define INFO_HANDLE_MAXIMUM_NUMBER_OF_THREADS		64
 
 /* Retrieves the data file type
  * Returns a string represenation of the data file type
@@ -112,6 +117,47 @@ const char *info_handle_get_track_type(
 	return( "UNKNOWN" );
 }
 
+/* Retrieves the sector class
+ * Returns a string represenation of the sector class
+ */
+const char *info_handle_get_sector_class(
+             uint8_t sector_class )
+{
+	switch( sector_class )
+	{
+		case LIBODRAW_SECTOR_CLASS_AUDIO:
+			return( "audio" );
+
+		case LIBODRAW_SECTOR_CLASS_MODE1:
+			return( "mode 1" );
+
+		case LIBODRAW_SECTOR_CLASS_MODE2_FORM1:
+			return( "mode 2 form 1" );
+
+		case LIBODRAW_SECTOR_CLASS_MODE2_FORM2:
+			return( "mode 2 form 2" );
+
+		case LIBODRAW_SECTOR_CLASS_MODE2_FORMLESS:
+			return( "mode 2 formless" );
+
+		case LIBODRAW_SECTOR_CLASS_ZERO:
+			return( "zero" );
+
+		case LIBODRAW_SECTOR_CLASS_BAD_SYNC:
+			return( "bad synchronisation" );
+
+		case LIBODRAW_SECTOR_CLASS_BAD_HEADER:
+			return( "bad header" );
+
+		case LIBODRAW_SECTOR_CLASS_MISSING:
+			return( "missing" );
+
+		default:
+			break;
+	}
+	return( "unknown" );
+}
+
 /* Creates an info handle
  * Make sure the value info_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -185,7 +231,8 @@ int info_handle_initialize(
 
 		goto on_error;
 	}
-	( *info_handle )->notify_stream = INFO_HANDLE_NOTIFY_STREAM;
+	( *info_handle )->notify_stream     = INFO_HANDLE_NOTIFY_STREAM;
+	( *info_handle )->number_of_threads = INFO_HANDLE_DEFAULT_NUMBER_OF_THREADS;
 
 	return( 1 );
 
@@ -223,6 +270,19 @@ int info_handle_free(
 	}
 	if( *info_handle != NULL )
 	{
+		if( info_handle_scan_handles_free(
+		     *info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scan handles.",
+			 function );
+
+			result = -1;
+		}
 		if( ( *info_handle )->input_handle != NULL )
 		{
 			if( libodraw_handle_free(
@@ -255,6 +315,7 @@ int info_handle_signal_abort(
      libcerror_error_t **error )
 {
 	static char *function = "info_handle_signal_abort";
+	int scan_handle_index = 0;
 
 	if( info_handle == NULL )
 	{
@@ -267,6 +328,34 @@ int info_handle_signal_abort(
 
 		return( -1 );
 	}
+	info_handle->abort = 1;
+
+	if( info_handle->scan_handles != NULL )
+	{
+		for( scan_handle_index = 0;
+		     scan_handle_index < info_handle->number_of_scan_handles;
+		     scan_handle_index++ )
+		{
+			if( info_handle->scan_handles[ scan_handle_index ] == NULL )
+			{
+				continue;
+			}
+			if( libodraw_handle_signal_abort(
+			     info_handle->scan_handles[ scan_handle_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to signal scan handle: %d to abort.",
+				 function,
+				 scan_handle_index );
+
+				return( -1 );
+			}
+		}
+	}
 	if( info_handle->input_handle != NULL )
 	{
 		if( libodraw_handle_signal_abort(
@@ -357,6 +446,72 @@ int info_handle_open_input(
 			return( -1 );
 		}
 	}
+	info_handle->source = filename;
+
+	return( 1 );
+}
+
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int info_handle_set_number_of_threads(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_number_of_threads";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int number_of_threads = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 2 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		number_of_threads *= 10;
+		number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( number_of_threads > INFO_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		return( 0 );
+	}
+	info_handle->number_of_threads = number_of_threads;
+
 	return( 1 );
 }
 
@@ -391,6 +546,21 @@ int info_handle_close(
 
 		return( -1 );
 	}
+	if( info_handle_scan_handles_free(
+	     info_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free scan handles.",
+		 function );
+
+		return( -1 );
+	}
+	info_handle->source = NULL;
+
 	if( libodraw_handle_close(
 	     info_handle->input_handle,
 	     error ) != 0 )
@@ -407,6 +577,78 @@ int info_handle_close(
 	return( 0 );
 }
 
+/* Closes and frees the scan handles
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_scan_handles_free(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_scan_handles_free";
+	int result            = 1;
+	int scan_handle_index = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->scan_handles == NULL )
+	{
+		return( 1 );
+	}
+	for( scan_handle_index = 0;
+	     scan_handle_index < info_handle->number_of_scan_handles;
+	     scan_handle_index++ )
+	{
+		if( info_handle->scan_handles[ scan_handle_index ] == NULL )
+		{
+			continue;
+		}
+		if( libodraw_handle_close(
+		     info_handle->scan_handles[ scan_handle_index ],
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close scan handle: %d.",
+			 function,
+			 scan_handle_index );
+
+			result = -1;
+		}
+		if( libodraw_handle_free(
+		     &( info_handle->scan_handles[ scan_handle_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scan handle: %d.",
+			 function,
+			 scan_handle_index );
+
+			result = -1;
+		}
+	}
+	memory_free(
+	 info_handle->scan_handles );
+
+	info_handle->scan_handles           = NULL;
+	info_handle->number_of_scan_handles = 0;
+
+	return( result );
+}
+
 /* Prints the data files
  * Returns 1 if successful or -1 on error
  */
@@ -960,8 +1202,9 @@ int info_handle_handle_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error )
 {
-	static char *function = "info_handle_handle_fprint";
-	size64_t media_size   = 0;
+	static char *function       = "info_handle_handle_fprint";
+	size64_t layout_memory_size = 0;
+	size64_t media_size         = 0;
 
 	if( info_handle == NULL )
 	{
@@ -1008,6 +1251,25 @@ int info_handle_handle_fprint(
 	 "\tmedia size: %" PRIu64 "\n",
 	 media_size );
 
+	if( libodraw_handle_get_layout_memory_size(
+	     info_handle->input_handle,
+	     &layout_memory_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve layout memory size.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tlayout memory size: %" PRIu64 " bytes\n",
+	 layout_memory_size );
+
 	fprintf(
 	 info_handle->notify_stream,
 	 "\n" );
@@ -1067,3 +1329,578 @@ int info_handle_handle_fprint(
 	return( 1 );
 }
 
+/* Scans the tracks assigned to a scan handle in a worker thread
+ * A scan handle scans every n-th track, where n is the number of scan handles
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_scan_handle_callback(
+     libodraw_handle_t *scan_handle,
+     info_handle_t *info_handle )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "info_handle_scan_handle_callback";
+	int number_of_tracks     = 0;
+	int scan_handle_index    = 0;
+	int track_index          = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		goto on_error;
+	}
+	for( scan_handle_index = 0;
+	     scan_handle_index < info_handle->number_of_scan_handles;
+	     scan_handle_index++ )
+	{
+		if( info_handle->scan_handles[ scan_handle_index ] == scan_handle )
+		{
+			break;
+		}
+	}
+	if( scan_handle_index >= info_handle->number_of_scan_handles )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_handle_get_number_of_tracks(
+	     scan_handle,
+	     &number_of_tracks,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tracks.",
+		 function );
+
+		goto on_error;
+	}
+	for( track_index = scan_handle_index;
+	     track_index < number_of_tracks;
+	     track_index += info_handle->number_of_scan_handles )
+	{
+		if( info_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libodraw_handle_scan_track(
+		     scan_handle,
+		     track_index,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan track: %d.",
+			 function,
+			 track_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( info_handle != NULL )
+	{
+		info_handle->thread_failed = 1;
+	}
+#endif
+	return( -1 );
+}
+
+/* Scans the sectors of all tracks
+ * The tracks are distributed over worker threads that each use their own handle,
+ * since a handle cannot be read from multiple threads at the same time
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_scan_sectors(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	int scan_handle_index                  = 0;
+#endif
+
+	static char *function                  = "info_handle_scan_sectors";
+	int number_of_tracks                   = 0;
+	int track_index                        = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->input_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing input handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->scan_handles != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - scan handles value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_handle_get_number_of_tracks(
+	     info_handle->input_handle,
+	     &number_of_tracks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tracks.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( info_handle->number_of_threads > 1 )
+	 && ( number_of_tracks > 1 )
+	 && ( info_handle->source != NULL ) )
+	{
+		info_handle->number_of_scan_handles = info_handle->number_of_threads;
+
+		if( info_handle->number_of_scan_handles > number_of_tracks )
+		{
+			info_handle->number_of_scan_handles = number_of_tracks;
+		}
+		info_handle->scan_handles = (libodraw_handle_t **) memory_allocate(
+		                                                    sizeof( libodraw_handle_t * ) * info_handle->number_of_scan_handles );
+
+		if( info_handle->scan_handles == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create scan handles.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     info_handle->scan_handles,
+		     0,
+		     sizeof( libodraw_handle_t * ) * info_handle->number_of_scan_handles ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear scan handles.",
+			 function );
+
+			goto on_error;
+		}
+		for( scan_handle_index = 0;
+		     scan_handle_index < info_handle->number_of_scan_handles;
+		     scan_handle_index++ )
+		{
+			if( libodraw_handle_initialize(
+			     &( info_handle->scan_handles[ scan_handle_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize scan handle: %d.",
+				 function,
+				 scan_handle_index );
+
+				goto on_error;
+			}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			if( libodraw_handle_open_wide(
+			     info_handle->scan_handles[ scan_handle_index ],
+			     info_handle->source,
+			     LIBODRAW_OPEN_READ,
+			     error ) != 1 )
+#else
+			if( libodraw_handle_open(
+			     info_handle->scan_handles[ scan_handle_index ],
+			     info_handle->source,
+			     LIBODRAW_OPEN_READ,
+			     error ) != 1 )
+#endif
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open scan handle: %d.",
+				 function,
+				 scan_handle_index );
+
+				goto on_error;
+			}
+			if( libodraw_handle_open_data_files(
+			     info_handle->scan_handles[ scan_handle_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open data files of scan handle: %d.",
+				 function,
+				 scan_handle_index );
+
+				goto on_error;
+			}
+		}
+		info_handle->thread_failed = 0;
+
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     info_handle->number_of_scan_handles,
+		     info_handle->number_of_scan_handles,
+		     (int (*)(intptr_t *, void *)) &info_handle_scan_handle_callback,
+		     (void *) info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( scan_handle_index = 0;
+		     scan_handle_index < info_handle->number_of_scan_handles;
+		     scan_handle_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) info_handle->scan_handles[ scan_handle_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push scan handle: %d onto thread pool.",
+				 function,
+				 scan_handle_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		if( info_handle->thread_failed != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan tracks.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		for( track_index = 0;
+		     track_index < number_of_tracks;
+		     track_index++ )
+		{
+			if( info_handle->abort != 0 )
+			{
+				break;
+			}
+			if( libodraw_handle_scan_track(
+			     info_handle->input_handle,
+			     track_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan track: %d.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	info_handle_scan_handles_free(
+	 info_handle,
+	 NULL );
+
+	return( -1 );
+#endif
+}
+
+/* Prints the sector scan information
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_sector_scan_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	libodraw_handle_t *scan_handle  = NULL;
+	static char *function           = "info_handle_sector_scan_fprint";
+	uint64_t anomaly_start_sector   = 0;
+	uint64_t data_file_start_sector = 0;
+	uint64_t number_of_sectors      = 0;
+	uint64_t start_sector           = 0;
+	uint64_t value_64bit            = 0;
+	uint8_t sector_class            = 0;
+	uint8_t track_type              = 0;
+	int anomaly_index               = 0;
+	int data_file_index             = 0;
+	int number_of_anomalies         = 0;
+	int number_of_tracks            = 0;
+	int result                      = 0;
+	int track_index                 = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->input_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing input handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_handle_get_number_of_tracks(
+	     info_handle->input_handle,
+	     &number_of_tracks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tracks.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Sector scan:\n" );
+
+	for( track_index = 0;
+	     track_index < number_of_tracks;
+	     track_index++ )
+	{
+		scan_handle = info_handle->input_handle;
+
+		if( info_handle->scan_handles != NULL )
+		{
+			scan_handle = info_handle->scan_handles[ track_index % info_handle->number_of_scan_handles ];
+		}
+		if( libodraw_handle_get_track(
+		     info_handle->input_handle,
+		     track_index,
+		     &start_sector,
+		     &number_of_sectors,
+		     &track_type,
+		     &data_file_index,
+		     &data_file_start_sector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the track: %d.",
+			 function,
+			 track_index );
+
+			return( -1 );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\ttrack: %d type: %s\n",
+		 track_index + 1,
+		 info_handle_get_track_type(
+		  track_type ) );
+
+		for( sector_class = 0;
+		     sector_class < (uint8_t) ( LIBODRAW_SECTOR_CLASS_MISSING + 1 );
+		     sector_class++ )
+		{
+			result = libodraw_handle_get_number_of_scanned_sectors(
+			          scan_handle,
+			          track_index,
+			          sector_class,
+			          &value_64bit,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of scanned sectors of track: %d.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 info_handle->notify_stream,
+				 "\t\tnot scanned\n" );
+
+				break;
+			}
+			if( value_64bit != 0 )
+			{
+				fprintf(
+				 info_handle->notify_stream,
+				 "\t\t%s sectors: %" PRIu64 "\n",
+				 info_handle_get_sector_class(
+				  sector_class ),
+				 value_64bit );
+			}
+		}
+		if( libodraw_handle_get_number_of_sector_anomalies(
+		     scan_handle,
+		     &number_of_anomalies,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of sector anomalies.",
+			 function );
+
+			return( -1 );
+		}
+		/* A scan handle contains the anomalies of all the tracks it scanned
+		 */
+		for( anomaly_index = 0;
+		     anomaly_index < number_of_anomalies;
+		     anomaly_index++ )
+		{
+			if( libodraw_handle_get_sector_anomaly(
+			     scan_handle,
+			     anomaly_index,
+			     &anomaly_start_sector,
+			     &value_64bit,
+			     &sector_class,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sector anomaly: %d.",
+				 function,
+				 anomaly_index );
+
+				return( -1 );
+			}
+			if( ( anomaly_start_sector < start_sector )
+			 || ( anomaly_start_sector >= ( start_sector + number_of_sectors ) ) )
+			{
+				continue;
+			}
+			fprintf(
+			 info_handle->notify_stream,
+			 "\t\tanomaly at sector(s): %" PRIu64 " - %" PRIu64 " number: %" PRIu64 " (%s)\n",
+			 anomaly_start_sector,
+			 anomaly_start_sector + value_64bit - 1,
+			 value_64bit,
+			 info_handle_get_sector_class(
+			  sector_class ) );
+		}
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
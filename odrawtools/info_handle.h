@@ -27,6 +27,7 @@
 #include <types.h>
 
 #include "odrawtools_libcerror.h"
+#include "odrawtools_libcthreads.h"
 #include "odrawtools_libodraw.h"
 
 #if defined( __cplusplus )
@@ -48,6 +49,32 @@ struct info_handle
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
+
+	/* The source filename
+	 */
+	const system_character_t *source;
+
+	/* The number of threads used to scan the sectors
+	 */
+	int number_of_threads;
+
+	/* The handles used to scan the sectors, one per worker thread
+	 */
+	libodraw_handle_t **scan_handles;
+
+	/* The number of scan handles
+	 */
+	int number_of_scan_handles;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Value to indicate a scan thread failed
+	 */
+	int thread_failed;
+#endif
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
 };
 
 const char *info_handle_get_data_file_type(
@@ -56,6 +83,9 @@ const char *info_handle_get_data_file_type(
 const char *info_handle_get_track_type(
              uint8_t track_type );
 
+const char *info_handle_get_sector_class(
+             uint8_t sector_class );
+
 int info_handle_initialize(
      info_handle_t **info_handle,
      libcerror_error_t **error );
@@ -73,10 +103,19 @@ int info_handle_open_input(
      const system_character_t *filename,
      libcerror_error_t **error );
 
+int info_handle_set_number_of_threads(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int info_handle_close(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_scan_handles_free(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 int info_handle_data_files_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
@@ -97,6 +136,18 @@ int info_handle_handle_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_scan_handle_callback(
+     libodraw_handle_t *scan_handle,
+     info_handle_t *info_handle );
+
+int info_handle_scan_sectors(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_sector_scan_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
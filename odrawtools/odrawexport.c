@@ -0,0 +1,476 @@
+/*
+ * Exports optical disc (split) RAW file(s) to an ISO or raw image
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "export_handle.h"
+#include "odrawtools_getopt.h"
+#include "odrawtools_libcerror.h"
+#include "odrawtools_libclocale.h"
+#include "odrawtools_libcnotify.h"
+#include "odrawtools_libodraw.h"
+#include "odrawtools_output.h"
+#include "odrawtools_signal.h"
+#include "odrawtools_unused.h"
+
+export_handle_t *odrawexport_export_handle = NULL;
+int odrawexport_abort                      = 0;
+
+/* Prints the executable usage information to the stream
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use odrawexport to export data stored in the optical disc (split)\n"
+	                 "RAW image file format to an ISO or raw image.\n\n" );
+
+	fprintf( stream, "Usage: odrawexport [ -f format ] [ -j number_of_threads ]\n"
+	                 "                   [ -p process_buffer_size ] [ -hqvV ]\n"
+	                 "                   -t target source\n\n" );
+
+	fprintf( stream, "\tsource: the source table of contents (TOC) file\n"
+	                 "\t        supported TOC file types: CDRWIN CUE\n\n" );
+
+	fprintf( stream, "\t-f:     specify the output format, options: iso (default) or raw\n"
+	                 "\t        iso writes 2048 bytes per sector, raw writes 2352 bytes per\n"
+	                 "\t        sector and requires the data files to contain raw sectors\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     specify the number of output threads (default is 4),\n"
+	                 "\t        0 writes the output from the reading thread\n" );
+	fprintf( stream, "\t-p:     specify the process buffer size (default is 1048576)\n" );
+	fprintf( stream, "\t-q:     quiet shows minimal status information\n" );
+	fprintf( stream, "\t-t:     specify the target file to export to\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for odrawexport
+ */
+void odrawexport_signal_handler(
+      odrawtools_signal_t signal ODRAWTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function   = "odrawexport_signal_handler";
+
+	ODRAWTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	odrawexport_abort = 1;
+
+	if( odrawexport_export_handle != NULL )
+	{
+		if( export_handle_signal_abort(
+		     odrawexport_export_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal export handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                       = NULL;
+	system_character_t *option_number_of_threads   = NULL;
+	system_character_t *option_output_format       = NULL;
+	system_character_t *option_process_buffer_size = NULL;
+	system_character_t *option_target              = NULL;
+	system_character_t *program                    = _SYSTEM_STRING( "odrawexport" );
+	system_character_t *source                     = NULL;
+	system_integer_t option                        = 0;
+	uint8_t print_status_information               = 1;
+	uint8_t verbose                                = 0;
+	int result                                     = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+             "odrawtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( odrawtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	odrawtools_output_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = odrawtools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "f:hj:p:qt:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				goto on_error;
+
+			case (system_integer_t) 'f':
+				option_output_format = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'p':
+				option_process_buffer_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'q':
+				print_status_information = 0;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_target = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				odrawtools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( option_target == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Missing target file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+
+#if !defined( HAVE_LOCAL_LIBODRAW )
+	libodraw_notify_set_verbose(
+	 verbose );
+	libodraw_notify_set_stream(
+	 stderr,
+	 NULL );
+#endif
+
+	if( export_handle_initialize(
+	     &odrawexport_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create export handle.\n" );
+
+		goto on_error;
+	}
+	if( option_output_format != NULL )
+	{
+		result = export_handle_set_output_format(
+			  odrawexport_export_handle,
+			  option_output_format,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set output format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format defaulting to: iso.\n" );
+		}
+	}
+	if( option_process_buffer_size != NULL )
+	{
+		result = export_handle_set_process_buffer_size(
+			  odrawexport_export_handle,
+			  option_process_buffer_size,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set process buffer size.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported process buffer size defaulting to: 1048576.\n" );
+		}
+	}
+	if( option_number_of_threads != NULL )
+	{
+		result = export_handle_set_number_of_threads(
+			  odrawexport_export_handle,
+			  option_number_of_threads,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: 4.\n" );
+		}
+	}
+	if( odrawtools_signal_attach(
+	     odrawexport_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_handle_open_input(
+	     odrawexport_export_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open file: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( export_handle_open_output(
+	     odrawexport_export_handle,
+	     option_target,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open target file: %" PRIs_SYSTEM ".\n",
+		 option_target );
+
+		goto on_error;
+	}
+	result = export_handle_export_input(
+		  odrawexport_export_handle,
+		  print_status_information,
+		  &error );
+
+	if( result != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to export input.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( odrawtools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_handle_close(
+	     odrawexport_export_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close export handle.\n" );
+
+		goto on_error;
+	}
+	if( export_handle_free(
+	     &odrawexport_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free export handle.\n" );
+
+		goto on_error;
+	}
+	if( odrawexport_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "%" PRIs_SYSTEM ": ABORTED\n",
+		 program );
+
+		return( EXIT_FAILURE );
+	}
+	if( result != 1 )
+	{
+		fprintf(
+		 stdout,
+		 "%" PRIs_SYSTEM ": FAILURE\n",
+		 program );
+
+		return( EXIT_FAILURE );
+	}
+	fprintf(
+	 stdout,
+	 "%" PRIs_SYSTEM ": SUCCESS\n",
+	 program );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( odrawexport_export_handle != NULL )
+	{
+		export_handle_close(
+		 odrawexport_export_handle,
+		 NULL );
+		export_handle_free(
+		 &odrawexport_export_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -39,6 +39,7 @@
 #include <unistd.h>
 #endif
 
+#include "catalogue_handle.h"
 #include "info_handle.h"
 #include "odrawtools_getopt.h"
 #include "odrawtools_libcerror.h"
@@ -49,8 +50,9 @@
 #include "odrawtools_signal.h"
 #include "odrawtools_unused.h"
 
-info_handle_t *odrawinfo_info_handle = NULL;
-int odrawinfo_abort                  = 0;
+catalogue_handle_t *odrawinfo_catalogue_handle = NULL;
+info_handle_t *odrawinfo_info_handle           = NULL;
+int odrawinfo_abort                            = 0;
 
 /* Prints the executable usage information
  */
@@ -64,13 +66,24 @@ void usage_fprint(
 	fprintf( stream, "Use odrawinfo to determine information about optical disc\n"
 	                 "(split) RAW file(s)\n\n" );
 
-	fprintf( stream, "Usage: odrawinfo [ -hivV ] source\n\n" );
+	fprintf( stream, "Usage: odrawinfo [ -j number_of_threads ] [ -hirsvV ] source\n"
+	                 "                 [ source ... ]\n\n" );
 
 	fprintf( stream, "\tsource: the source table of contents (TOC) file\n"
-	                 "\t        supported TOC file types: CDRWIN CUE\n\n" );
+	                 "\t        supported TOC file types: CDRWIN CUE\n"
+	                 "\t        in catalogue mode multiple sources and directories\n"
+	                 "\t        can be specified\n\n" );
 
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-i:     ignore data file(s)\n" );
+	fprintf( stream, "\t-j:     specify the number of threads used in catalogue mode and\n"
+	                 "\t        to scan the sectors (default is 4), 0 reads from the main\n"
+	                 "\t        thread\n" );
+	fprintf( stream, "\t-r:     catalogue mode, scans directories recursively for CUE\n"
+	                 "\t        files and prints a single line JSON record per source\n" );
+	fprintf( stream, "\t-s:     scan the sectors, prints the number of sectors per sector\n"
+	                 "\t        class for every track and the runs of sectors that do not\n"
+	                 "\t        match the track type\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 }
@@ -101,6 +114,20 @@ void odrawinfo_signal_handler(
 		libcerror_error_free(
 		 &error );
 	}
+	if( ( odrawinfo_catalogue_handle != NULL )
+	 && ( catalogue_handle_signal_abort(
+	       odrawinfo_catalogue_handle,
+	       &error ) != 1 ) )
+	{
+		libcnotify_printf(
+		 "%s: unable to signal catalogue handle to abort.\n",
+		 function );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
 	/* Force stdin to close otherwise any function reading it will remain blocked
 	 */
 #if defined( WINAPI ) && !defined( __CYGWIN__ )
@@ -125,12 +152,16 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error    = NULL;
-	system_character_t *program = _SYSTEM_STRING( "odrawinfo" );
-	system_character_t *source  = NULL;
-	system_integer_t option     = 0;
-	uint8_t ignore_data_files   = 0;
-	int verbose                 = 0;
+	libcerror_error_t *error                     = NULL;
+	system_character_t *option_number_of_threads = NULL;
+	system_character_t *program                  = _SYSTEM_STRING( "odrawinfo" );
+	system_character_t *source                   = NULL;
+	system_integer_t option                      = 0;
+	uint8_t catalogue_mode                       = 0;
+	uint8_t ignore_data_files                    = 0;
+	uint8_t scan_sectors                         = 0;
+	int result                                   = 0;
+	int verbose                                  = 0;
 
 	libcnotify_stream_set(
 	 stderr,
@@ -158,19 +189,19 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	odrawtools_output_version_fprint(
-	 stdout,
-	 program );
-
 	while( ( option = odrawtools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "ihvV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "ihj:rsvV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
 			case (system_integer_t) '?':
 			default:
+				odrawtools_output_version_fprint(
+				 stdout,
+				 program );
+
 				fprintf(
 				 stderr,
 				 "Invalid argument: %" PRIs_SYSTEM "\n",
@@ -182,6 +213,10 @@ int main( int argc, char * const argv[] )
 				return( EXIT_FAILURE );
 
 			case (system_integer_t) 'h':
+				odrawtools_output_version_fprint(
+				 stdout,
+				 program );
+
 				usage_fprint(
 				 stdout );
 
@@ -192,18 +227,45 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				catalogue_mode = 1;
+
+				break;
+
+			case (system_integer_t) 's':
+				scan_sectors = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
 				break;
 
 			case (system_integer_t) 'V':
+				odrawtools_output_version_fprint(
+				 stdout,
+				 program );
+
 				odrawtools_output_copyright_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 		}
 	}
+	/* The version is not printed in catalogue mode to keep the output machine-readable
+	 */
+	if( catalogue_mode == 0 )
+	{
+		odrawtools_output_version_fprint(
+		 stdout,
+		 program );
+	}
 	if( optind == argc )
 	{
 		fprintf(
@@ -215,6 +277,17 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
+	if( ( scan_sectors != 0 )
+	 && ( ( catalogue_mode != 0 )
+	  || ( ignore_data_files != 0 ) ) )
+	{
+		fprintf(
+		 stderr,
+		 "Scanning the sectors is not supported in catalogue mode or\n"
+		 "when ignoring the data files.\n" );
+
+		return( EXIT_FAILURE );
+	}
 	source = argv[ optind ];
 
 	libcnotify_verbose_set(
@@ -228,6 +301,121 @@ int main( int argc, char * const argv[] )
 	 verbose );
 #endif
 
+	if( catalogue_mode != 0 )
+	{
+		if( catalogue_handle_initialize(
+		     &odrawinfo_catalogue_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create catalogue handle.\n" );
+
+			goto on_error;
+		}
+		odrawinfo_catalogue_handle->ignore_data_files = ignore_data_files;
+
+		if( option_number_of_threads != NULL )
+		{
+			result = catalogue_handle_set_number_of_threads(
+				  odrawinfo_catalogue_handle,
+				  option_number_of_threads,
+				  &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set number of threads.\n" );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported number of threads defaulting to: 4.\n" );
+			}
+		}
+		if( odrawtools_signal_attach(
+		     odrawinfo_signal_handler,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to attach signal handler.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		while( optind < argc )
+		{
+			if( catalogue_handle_append_source(
+			     odrawinfo_catalogue_handle,
+			     argv[ optind ],
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to add source: %" PRIs_SYSTEM ".\n",
+				 argv[ optind ] );
+
+				goto on_error;
+			}
+			optind++;
+		}
+		if( catalogue_handle_process_sources(
+		     odrawinfo_catalogue_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to catalogue sources.\n" );
+
+			goto on_error;
+		}
+		if( odrawtools_signal_detach(
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to detach signal handler.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		result = odrawinfo_catalogue_handle->number_of_failed_sources;
+
+		if( catalogue_handle_free(
+		     &odrawinfo_catalogue_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free catalogue handle.\n" );
+
+			goto on_error;
+		}
+		if( odrawinfo_abort != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "%" PRIs_SYSTEM ": ABORTED\n",
+			 program );
+
+			return( EXIT_FAILURE );
+		}
+		if( result != 0 )
+		{
+			return( EXIT_FAILURE );
+		}
+		return( EXIT_SUCCESS );
+	}
+
 	if( info_handle_initialize(
 	     &odrawinfo_info_handle,
 	     &error ) != 1 )
@@ -244,6 +432,28 @@ int main( int argc, char * const argv[] )
 	}
 	odrawinfo_info_handle->ignore_data_files = ignore_data_files;
 
+	if( option_number_of_threads != NULL )
+	{
+		result = info_handle_set_number_of_threads(
+			  odrawinfo_info_handle,
+			  option_number_of_threads,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: 4.\n" );
+		}
+	}
 	if( odrawtools_signal_attach(
 	     odrawinfo_signal_handler,
 	     &error ) != 1 )
@@ -279,6 +489,32 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( scan_sectors != 0 )
+	{
+		if( info_handle_scan_sectors(
+		     odrawinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to scan sectors.\n" );
+
+			goto on_error;
+		}
+		if( odrawinfo_abort == 0 )
+		{
+			if( info_handle_sector_scan_fprint(
+			     odrawinfo_info_handle,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to print sector scan information.\n" );
+
+				goto on_error;
+			}
+		}
+	}
 	if( info_handle_close(
 	     odrawinfo_info_handle,
 	     &error ) != 0 )
@@ -330,6 +566,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( odrawinfo_catalogue_handle != NULL )
+	{
+		catalogue_handle_free(
+		 &odrawinfo_catalogue_handle,
+		 NULL );
+	}
 	if( odrawinfo_info_handle != NULL )
 	{
 		info_handle_free(
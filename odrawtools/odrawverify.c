@@ -32,6 +32,7 @@
 #include <stdlib.h>
 #endif
 
+#include "batch_verification_handle.h"
 #include "byte_size_string.h"
 #include "digest_hash.h"
 #include "log_handle.h"
@@ -43,10 +44,14 @@
 #include "odrawtools_output.h"
 #include "odrawtools_signal.h"
 #include "odrawtools_unused.h"
+#include "process_status.h"
+#include "scrub_handle.h"
 #include "verification_handle.h"
 
-verification_handle_t *odrawverify_verification_handle = NULL;
-int odrawverify_abort                                  = 0;
+batch_verification_handle_t *odrawverify_batch_verification_handle = NULL;
+scrub_handle_t *odrawverify_scrub_handle                           = NULL;
+verification_handle_t *odrawverify_verification_handle             = NULL;
+int odrawverify_abort                                              = 0;
 
 /* Prints the executable usage information to the stream
  */
@@ -60,22 +65,55 @@ void usage_fprint(
 	fprintf( stream, "Use odrawverify to verify data stored in the optical disc (split)\n"
 	                 "RAW image file format.\n\n" );
 
-	fprintf( stream, "Usage: odrawverify [ -d digest_type ] [ -l log_filename ]\n"
-	                 "                   [ -p process_buffer_size ] [ -hqvV ]\n"
-	                 "                   source\n\n" );
+	fprintf( stream, "Usage: odrawverify [ -d digest_type ] [ -f list_filename ]\n"
+	                 "                   [ -j number_of_threads ] [ -l log_filename ]\n"
+	                 "                   [ -p process_buffer_size ] [ -t telemetry_target ]\n"
+	                 "                   [ -DhqvVw ] source [ source ... ]\n\n" );
+
+	fprintf( stream, "       odrawverify -S manifest_filename [ -B bytes_per_second ]\n"
+	                 "                   [ -I reads_per_second ] [ -l log_filename ]\n"
+	                 "                   [ -p process_buffer_size ] [ -P progress_filename ]\n"
+	                 "                   [ -t telemetry_target ] [ -T maximum_duration ]\n"
+	                 "                   [ -DhqvV ]\n\n" );
 
 	fprintf( stream, "\tsource: the source table of contents (TOC) file\n"
-	                 "\t        supported TOC file types: CDRWIN CUE\n\n" );
+	                 "\t        supported TOC file types: CDRWIN CUE\n"
+	                 "\t        if multiple sources are specified they are verified\n"
+	                 "\t        in batch mode\n\n" );
 
+	fprintf( stream, "\t-B:     specify the maximum number of bytes read per second\n"
+	                 "\t        in scrub mode, for example 10MiB (default is no limit)\n" );
 	fprintf( stream, "\t-d:     calculate additional digest (hash) types besides md5,\n"
 	                 "\t        options: sha1, sha256\n" );
+	fprintf( stream, "\t-D:     use direct IO to read the data files, which bypasses\n"
+	                 "\t        the page cache\n" );
+	fprintf( stream, "\t-f:     verify the sources listed in list_filename, one per line,\n"
+	                 "\t        in batch mode\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-I:     specify the maximum number of reads per second in scrub\n"
+	                 "\t        mode (default is no limit)\n" );
+	fprintf( stream, "\t-j:     specify the number of threads used in batch mode\n"
+	                 "\t        (default is 4), 0 verifies the sources from the main thread\n" );
 	fprintf( stream, "\t-l:     logs verification errors and the digest (hash) to the\n"
 	                 "\t        log_filename\n" );
 	fprintf( stream, "\t-p:     specify the process buffer size (default is the 32768)\n" );
+	fprintf( stream, "\t-P:     store the scrub progress in progress_filename, a next\n"
+	                 "\t        run continues with the source after the last one scrubbed\n" );
 	fprintf( stream, "\t-q:     quiet shows minimal status information\n" );
+	fprintf( stream, "\t-S:     scrub the sources listed in manifest_filename in the\n"
+	                 "\t        background and compare their digest (hash) against the\n"
+	                 "\t        manifest, formatted as the output of md5sum, sha1sum\n"
+	                 "\t        or sha256sum\n" );
+	fprintf( stream, "\t-t:     emit progress and throughput telemetry as JSON lines to\n"
+	                 "\t        telemetry_target, options: fd:<number>, unix:<path>\n"
+	                 "\t        (not supported in batch mode)\n" );
+	fprintf( stream, "\t-T:     specify the maximum duration of a scrub run in seconds\n"
+	                 "\t        (default is no limit)\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\t-w:     zero-fill the sectors that cannot be read and continue\n"
+	                 "\t        the verification, the sectors are reported as read errors\n"
+	                 "\t        (not supported in scrub mode)\n" );
 }
 
 /* Signal handler for odrawverify
@@ -106,6 +144,38 @@ void odrawverify_signal_handler(
 			 &error );
 		}
 	}
+	if( odrawverify_batch_verification_handle != NULL )
+	{
+		if( batch_verification_handle_signal_abort(
+		     odrawverify_batch_verification_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal batch verification handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( odrawverify_scrub_handle != NULL )
+	{
+		if( scrub_handle_signal_abort(
+		     odrawverify_scrub_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal scrub handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
 	/* Force stdin to close otherwise any function reading it will remain blocked
 	 */
 #if defined( WINAPI ) && !defined( __CYGWIN__ )
@@ -130,18 +200,33 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error                           = NULL;
-	log_handle_t *log_handle                           = NULL;
-	system_character_t *log_filename                   = NULL;
-	system_character_t *option_additional_digest_types = NULL;
-	system_character_t *option_process_buffer_size     = NULL;
-	system_character_t *program                        = _SYSTEM_STRING( "odrawverify" );
-	system_character_t *source                         = NULL;
-	system_integer_t option                            = 0;
-	uint8_t calculate_md5                              = 1;
-	uint8_t print_status_information                   = 1;
-	uint8_t verbose                                    = 0;
-	int result                                         = 0;
+	libcerror_error_t *error                            = NULL;
+	log_handle_t *log_handle                            = NULL;
+	system_character_t *log_filename                    = NULL;
+	system_character_t *option_additional_digest_types  = NULL;
+	system_character_t *option_list_filename            = NULL;
+	system_character_t *option_manifest_filename        = NULL;
+	system_character_t *option_maximum_bytes_per_second = NULL;
+	system_character_t *option_maximum_duration         = NULL;
+	system_character_t *option_maximum_reads_per_second = NULL;
+	system_character_t *option_number_of_threads        = NULL;
+	system_character_t *option_process_buffer_size      = NULL;
+	system_character_t *option_progress_filename        = NULL;
+	system_character_t *option_telemetry_target         = NULL;
+	system_character_t *program                         = _SYSTEM_STRING( "odrawverify" );
+	system_character_t *source                          = NULL;
+	system_integer_t option                             = 0;
+	uint8_t batch_mode                                  = 0;
+	uint8_t calculate_md5                               = 1;
+	uint8_t print_status_information                    = 1;
+	uint8_t scrub_mode                                  = 0;
+	uint8_t telemetry_descriptor_is_socket              = 0;
+	uint8_t use_direct_io                               = 0;
+	uint8_t verbose                                     = 0;
+	uint8_t zero_on_read_error                          = 0;
+	int argument_index                                  = 0;
+	int result                                          = 0;
+	int telemetry_descriptor                            = -1;
 
 	libcnotify_stream_set(
 	 stderr,
@@ -176,7 +261,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = odrawtools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "d:hl:p:qvV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "B:d:Df:hI:j:l:p:P:qS:t:T:vVw" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -192,17 +277,42 @@ int main( int argc, char * const argv[] )
 
 				goto on_error;
 
+			case (system_integer_t) 'B':
+				option_maximum_bytes_per_second = optarg;
+
+				break;
+
 			case (system_integer_t) 'd':
 				option_additional_digest_types = optarg;
 
 				break;
 
+			case (system_integer_t) 'D':
+				use_direct_io = 1;
+
+				break;
+
+			case (system_integer_t) 'f':
+				option_list_filename = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'I':
+				option_maximum_reads_per_second = optarg;
+
+				break;
+
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
 			case (system_integer_t) 'l':
 				log_filename = optarg;
 
@@ -213,11 +323,31 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'P':
+				option_progress_filename = optarg;
+
+				break;
+
 			case (system_integer_t) 'q':
 				print_status_information = 0;
 
 				break;
 
+			case (system_integer_t) 'S':
+				option_manifest_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_telemetry_target = optarg;
+
+				break;
+
+			case (system_integer_t) 'T':
+				option_maximum_duration = optarg;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -228,9 +358,31 @@ int main( int argc, char * const argv[] )
 				 stdout );
 
 				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'w':
+				zero_on_read_error = 1;
+
+				break;
+		}
+	}
+	if( option_manifest_filename != NULL )
+	{
+		if( ( optind != argc )
+		 || ( option_list_filename != NULL ) )
+		{
+			fprintf(
+			 stderr,
+			 "Sources cannot be specified in scrub mode.\n" );
+
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_FAILURE );
 		}
+		scrub_mode = 1;
 	}
-	if( optind == argc )
+	else if( ( optind == argc )
+	      && ( option_list_filename == NULL ) )
 	{
 		fprintf(
 		 stderr,
@@ -241,7 +393,18 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
-	source = argv[ optind ];
+	if( scrub_mode == 0 )
+	{
+		if( ( option_list_filename != NULL )
+		 || ( ( argc - optind ) > 1 ) )
+		{
+			batch_mode = 1;
+		}
+		else
+		{
+			source = argv[ optind ];
+		}
+	}
 
 	libcnotify_verbose_set(
 	 verbose );
@@ -306,6 +469,280 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( verification_handle_set_use_direct_io(
+	     odrawverify_verification_handle,
+	     use_direct_io,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set use direct IO.\n" );
+
+		goto on_error;
+	}
+	if( ( zero_on_read_error != 0 )
+	 && ( scrub_mode != 0 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Zero-filling read errors is not supported in scrub mode.\n" );
+
+		zero_on_read_error = 0;
+	}
+	if( verification_handle_set_zero_on_read_error(
+	     odrawverify_verification_handle,
+	     zero_on_read_error,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set zero on read error.\n" );
+
+		goto on_error;
+	}
+	if( batch_mode != 0 )
+	{
+		if( batch_verification_handle_initialize(
+		     &odrawverify_batch_verification_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create batch verification handle.\n" );
+
+			goto on_error;
+		}
+		odrawverify_batch_verification_handle->process_buffer_size     = odrawverify_verification_handle->process_buffer_size;
+		odrawverify_batch_verification_handle->additional_digest_types = option_additional_digest_types;
+		odrawverify_batch_verification_handle->use_direct_io           = use_direct_io;
+		odrawverify_batch_verification_handle->zero_on_read_error      = zero_on_read_error;
+
+		if( option_number_of_threads != NULL )
+		{
+			result = batch_verification_handle_set_number_of_threads(
+				  odrawverify_batch_verification_handle,
+				  option_number_of_threads,
+				  &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set number of threads.\n" );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported number of threads defaulting to: 4.\n" );
+			}
+		}
+		for( argument_index = optind;
+		     argument_index < argc;
+		     argument_index++ )
+		{
+			if( batch_verification_handle_append_filename(
+			     odrawverify_batch_verification_handle,
+			     argv[ argument_index ],
+			     system_string_length(
+			      argv[ argument_index ] ),
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to append source: %" PRIs_SYSTEM ".\n",
+				 argv[ argument_index ] );
+
+				goto on_error;
+			}
+		}
+		if( option_list_filename != NULL )
+		{
+			if( batch_verification_handle_append_sources_from_list_file(
+			     odrawverify_batch_verification_handle,
+			     option_list_filename,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read sources from list file: %" PRIs_SYSTEM ".\n",
+				 option_list_filename );
+
+				goto on_error;
+			}
+		}
+	}
+	if( scrub_mode != 0 )
+	{
+		if( scrub_handle_initialize(
+		     &odrawverify_scrub_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create scrub handle.\n" );
+
+			goto on_error;
+		}
+		odrawverify_scrub_handle->process_buffer_size = odrawverify_verification_handle->process_buffer_size;
+		odrawverify_scrub_handle->use_direct_io       = use_direct_io;
+
+		if( option_maximum_bytes_per_second != NULL )
+		{
+			result = scrub_handle_set_maximum_bytes_per_second(
+				  odrawverify_scrub_handle,
+				  option_maximum_bytes_per_second,
+				  &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set maximum bytes per second.\n" );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported maximum bytes per second defaulting to: no limit.\n" );
+			}
+		}
+		if( option_maximum_reads_per_second != NULL )
+		{
+			result = scrub_handle_set_maximum_reads_per_second(
+				  odrawverify_scrub_handle,
+				  option_maximum_reads_per_second,
+				  &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set maximum reads per second.\n" );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported maximum reads per second defaulting to: no limit.\n" );
+			}
+		}
+		if( option_maximum_duration != NULL )
+		{
+			result = scrub_handle_set_maximum_duration(
+				  odrawverify_scrub_handle,
+				  option_maximum_duration,
+				  &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set maximum duration.\n" );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported maximum duration defaulting to: no limit.\n" );
+			}
+		}
+		if( scrub_handle_read_manifest(
+		     odrawverify_scrub_handle,
+		     option_manifest_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read manifest file: %" PRIs_SYSTEM ".\n",
+			 option_manifest_filename );
+
+			goto on_error;
+		}
+		if( option_progress_filename != NULL )
+		{
+			if( scrub_handle_read_progress(
+			     odrawverify_scrub_handle,
+			     option_progress_filename,
+			     &error ) == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read progress file: %" PRIs_SYSTEM ".\n",
+				 option_progress_filename );
+
+				goto on_error;
+			}
+		}
+		/* The sources are scrubbed from the main thread
+		 */
+		if( scrub_handle_set_idle_io_priority(
+		     odrawverify_scrub_handle,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set idle IO priority.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( option_telemetry_target != NULL )
+	{
+		if( batch_mode != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Telemetry is not supported in batch mode.\n" );
+		}
+		else
+		{
+			result = process_status_telemetry_open(
+			          option_telemetry_target,
+			          &telemetry_descriptor,
+			          &telemetry_descriptor_is_socket,
+			          &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to open telemetry target: %" PRIs_SYSTEM ".\n",
+				 option_telemetry_target );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported telemetry target: %" PRIs_SYSTEM ".\n",
+				 option_telemetry_target );
+			}
+			else
+			{
+				odrawverify_verification_handle->telemetry_descriptor           = telemetry_descriptor;
+				odrawverify_verification_handle->telemetry_descriptor_is_socket = telemetry_descriptor_is_socket;
+
+				if( odrawverify_scrub_handle != NULL )
+				{
+					odrawverify_scrub_handle->telemetry_descriptor           = telemetry_descriptor;
+					odrawverify_scrub_handle->telemetry_descriptor_is_socket = telemetry_descriptor_is_socket;
+				}
+			}
+		}
+	}
 	if( odrawtools_signal_attach(
 	     odrawverify_signal_handler,
 	     &error ) != 1 )
@@ -319,17 +756,20 @@ int main( int argc, char * const argv[] )
 		libcerror_error_free(
 		 &error );
 	}
-	if( verification_handle_open_input(
-	     odrawverify_verification_handle,
-	     source,
-	     &error ) != 1 )
+	if( source != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to open file: %" PRIs_SYSTEM ".\n",
-		 source );
+		if( verification_handle_open_input(
+		     odrawverify_verification_handle,
+		     source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open file: %" PRIs_SYSTEM ".\n",
+			 source );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
 	if( log_filename != NULL )
 	{
@@ -356,22 +796,89 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
-	result = verification_handle_verify_input(
-		  odrawverify_verification_handle,
-		  print_status_information,
-		  log_handle,
-		  &error );
+	if( scrub_mode != 0 )
+	{
+		result = scrub_handle_scrub_sources(
+			  odrawverify_scrub_handle,
+			  log_handle,
+			  &error );
 
-	if( result != 1 )
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to scrub sources.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		else if( ( odrawverify_scrub_handle->number_of_mismatched_sources > 0 )
+		      || ( odrawverify_scrub_handle->number_of_failed_sources > 0 ) )
+		{
+			fprintf(
+			 stdout,
+			 "Number of sources with a digest mismatch: %d\n"
+			 "Number of sources that failed to scrub: %d\n\n",
+			 odrawverify_scrub_handle->number_of_mismatched_sources,
+			 odrawverify_scrub_handle->number_of_failed_sources );
+
+			result = 0;
+		}
+	}
+	else if( batch_mode != 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to verify input.\n" );
+		result = batch_verification_handle_verify_sources(
+			  odrawverify_batch_verification_handle,
+			  log_handle,
+			  &error );
 
-		libcnotify_print_error_backtrace(
-		 error );
-		libcerror_error_free(
-		 &error );
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to verify sources.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		else if( odrawverify_batch_verification_handle->number_of_failed_sources > 0 )
+		{
+			fprintf(
+			 stdout,
+			 "Number of sources that failed verification: %d of %d\n\n",
+			 odrawverify_batch_verification_handle->number_of_failed_sources,
+			 odrawverify_batch_verification_handle->number_of_filenames );
+
+			result = 0;
+		}
+	}
+	else
+	{
+		result = verification_handle_verify_input(
+			  odrawverify_verification_handle,
+			  print_status_information,
+			  log_handle,
+			  &error );
+
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to verify input.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		else if( odrawverify_verification_handle->number_of_read_errors > 0 )
+		{
+			result = 0;
+		}
 	}
 	if( log_handle != NULL )
 	{
@@ -408,16 +915,18 @@ int main( int argc, char * const argv[] )
 		libcerror_error_free(
 		 &error );
 	}
-	if( verification_handle_close(
-	     odrawverify_verification_handle,
-	     &error ) != 0 )
+	if( source != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to close verification handle.\n" );
-
-		goto on_error;
+		if( verification_handle_close(
+		     odrawverify_verification_handle,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close verification handle.\n" );
 
+			goto on_error;
+		}
 	}
 	if( verification_handle_free(
 	     &odrawverify_verification_handle,
@@ -429,6 +938,46 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( odrawverify_batch_verification_handle != NULL )
+	{
+		if( batch_verification_handle_free(
+		     &odrawverify_batch_verification_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free batch verification handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( odrawverify_scrub_handle != NULL )
+	{
+		if( scrub_handle_free(
+		     &odrawverify_scrub_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free scrub handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( telemetry_descriptor != -1 )
+	{
+		if( process_status_telemetry_close(
+		     telemetry_descriptor,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close telemetry target.\n" );
+
+			goto on_error;
+		}
+		telemetry_descriptor = -1;
+	}
 	if( odrawverify_abort != 0 )
 	{
 		fprintf(
@@ -480,6 +1029,24 @@ on_error:
 		 &odrawverify_verification_handle,
 		 NULL );
 	}
+	if( odrawverify_batch_verification_handle != NULL )
+	{
+		batch_verification_handle_free(
+		 &odrawverify_batch_verification_handle,
+		 NULL );
+	}
+	if( odrawverify_scrub_handle != NULL )
+	{
+		scrub_handle_free(
+		 &odrawverify_scrub_handle,
+		 NULL );
+	}
+	if( telemetry_descriptor != -1 )
+	{
+		process_status_telemetry_close(
+		 telemetry_descriptor,
+		 NULL );
+	}
 	return( EXIT_FAILURE );
 }
 
@@ -32,9 +32,48 @@
 
 #include <time.h>
 
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_SYS_SOCKET_H )
+#include <sys/socket.h>
+#endif
+
+#if defined( HAVE_SYS_UN_H )
+#include <sys/un.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+#include <io.h>
+#endif
+
 #include "byte_size_string.h"
 #include "odrawtools_libcerror.h"
+#include "odrawtools_libcnotify.h"
+#include "odrawtools_libcthreads.h"
 #include "process_status.h"
+#include "rate_limiter.h"
+
+#define PROCESS_STATUS_MAXIMUM_TELEMETRY_LINE_SIZE	512
+
+/* The interval at which the telemetry lines are emitted, in microseconds
+ */
+#define PROCESS_STATUS_TELEMETRY_INTERVAL		1000000
+
+/* The interval at which the telemetry timer samples the phase, in microseconds
+ */
+#define PROCESS_STATUS_TELEMETRY_SAMPLE_INTERVAL	10000
+
+#if defined( MSG_NOSIGNAL )
+#define PROCESS_STATUS_SEND_FLAGS			MSG_NOSIGNAL
+#else
+#define PROCESS_STATUS_SEND_FLAGS			0
+#endif
 
 #if defined( HAVE_CTIME ) || defined( HAVE_CTIME_R ) || defined( WINAPI )
 
@@ -373,6 +412,8 @@ int process_status_initialize(
 	( *process_status )->status_summary_string    = status_summary_string;
 	( *process_status )->output_stream            = output_stream;
 	( *process_status )->print_status_information = print_status_information;
+	( *process_status )->telemetry_descriptor     = -1;
+	( *process_status )->telemetry_interval       = PROCESS_STATUS_TELEMETRY_INTERVAL;
 
 	return( 1 );
 
@@ -395,6 +436,7 @@ int process_status_free(
      libcerror_error_t **error )
 {
 	static char *function = "process_status_free";
+	int result            = 1;
 
 	if( process_status == NULL )
 	{
@@ -409,14 +451,671 @@ int process_status_free(
 	}
 	if( *process_status != NULL )
 	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *process_status )->telemetry_thread != NULL )
+		{
+			PROCESS_STATUS_SET_INT(
+			 ( *process_status )->telemetry_stop,
+			 1 );
+
+			if( libcthreads_thread_join(
+			     &( ( *process_status )->telemetry_thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join telemetry thread.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
 		memory_free(
 		 *process_status );
 
 		*process_status = NULL;
 	}
+	return( result );
+}
+
+/* Opens a telemetry descriptor
+ * The target is formatted as "fd:<number>" to use an already open file descriptor
+ * or "unix:<path>" to connect to a Unix domain stream socket
+ * Returns 1 if successful, 0 if the target is not supported or -1 on error
+ */
+int process_status_telemetry_open(
+     const system_character_t *target,
+     int *descriptor,
+     uint8_t *descriptor_is_socket,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_SYS_SOCKET_H ) && defined( HAVE_SYS_UN_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	struct sockaddr_un socket_address;
+#endif
+
+	static char *function = "process_status_telemetry_open";
+	size_t target_index   = 0;
+	size_t target_length  = 0;
+	int safe_descriptor   = 0;
+
+	if( target == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target.",
+		 function );
+
+		return( -1 );
+	}
+	if( descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( descriptor_is_socket == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor is socket.",
+		 function );
+
+		return( -1 );
+	}
+	target_length = system_string_length(
+	                 target );
+
+	if( ( target_length > 3 )
+	 && ( system_string_compare(
+	       target,
+	       _SYSTEM_STRING( "fd:" ),
+	       3 ) == 0 ) )
+	{
+		if( target_length > 12 )
+		{
+			return( 0 );
+		}
+		for( target_index = 3;
+		     target_index < target_length;
+		     target_index++ )
+		{
+			if( ( target[ target_index ] < (system_character_t) '0' )
+			 || ( target[ target_index ] > (system_character_t) '9' ) )
+			{
+				return( 0 );
+			}
+			safe_descriptor *= 10;
+			safe_descriptor += (int) ( target[ target_index ] - (system_character_t) '0' );
+
+			if( safe_descriptor > 65535 )
+			{
+				return( 0 );
+			}
+		}
+		*descriptor           = safe_descriptor;
+		*descriptor_is_socket = 0;
+
+		return( 1 );
+	}
+#if defined( HAVE_SYS_SOCKET_H ) && defined( HAVE_SYS_UN_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( ( target_length > 5 )
+	 && ( system_string_compare(
+	       target,
+	       _SYSTEM_STRING( "unix:" ),
+	       5 ) == 0 ) )
+	{
+		if( memory_set(
+		     &socket_address,
+		     0,
+		     sizeof( struct sockaddr_un ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear socket address.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( target_length - 5 ) >= sizeof( socket_address.sun_path ) )
+		{
+			return( 0 );
+		}
+		socket_address.sun_family = AF_UNIX;
+
+		if( narrow_string_copy(
+		     socket_address.sun_path,
+		     &( target[ 5 ] ),
+		     target_length - 5 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy socket path.",
+			 function );
+
+			return( -1 );
+		}
+		safe_descriptor = socket(
+		                   AF_UNIX,
+		                   SOCK_STREAM,
+		                   0 );
+
+		if( safe_descriptor == -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to create socket.",
+			 function );
+
+			return( -1 );
+		}
+		if( connect(
+		     safe_descriptor,
+		     (struct sockaddr *) &socket_address,
+		     sizeof( struct sockaddr_un ) ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to connect to socket: %s.",
+			 function,
+			 socket_address.sun_path );
+
+			close(
+			 safe_descriptor );
+
+			return( -1 );
+		}
+		*descriptor           = safe_descriptor;
+		*descriptor_is_socket = 1;
+
+		return( 1 );
+	}
+#endif /* defined( HAVE_SYS_SOCKET_H ) && defined( HAVE_SYS_UN_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	return( 0 );
+}
+
+/* Closes a telemetry descriptor
+ * Returns 0 if successful or -1 on error
+ */
+int process_status_telemetry_close(
+     int descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "process_status_telemetry_close";
+
+	if( descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid descriptor value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     descriptor ) != 0 )
+#else
+	if( close(
+	     descriptor ) != 0 )
+#endif
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Sets the telemetry descriptor
+ * The telemetry is emitted by a timer thread, hence it requires multi-thread support
+ * The descriptor is not managed by the process status
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int process_status_set_telemetry_descriptor(
+     process_status_t *process_status,
+     int descriptor,
+     uint8_t descriptor_is_socket,
+     libcerror_error_t **error )
+{
+	static char *function = "process_status_set_telemetry_descriptor";
+
+	if( process_status == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process status.",
+		 function );
+
+		return( -1 );
+	}
+	if( descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid descriptor value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( process_status->telemetry_thread != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid process status - telemetry thread value already set.",
+		 function );
+
+		return( -1 );
+	}
+	process_status->telemetry_descriptor           = descriptor;
+	process_status->telemetry_descriptor_is_socket = descriptor_is_socket;
+
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Emits a telemetry line
+ * The line is a JSON object terminated by a newline and is written with a single write
+ * so that lines of concurrent writers to the same descriptor are not interleaved
+ * A failing write disables the telemetry but does not fail the process
+ * Returns 1 if successful or -1 on error
+ */
+int process_status_telemetry_emit(
+     process_status_t *process_status,
+     int64_t current_time,
+     const char *event_string,
+     libcerror_error_t **error )
+{
+	char telemetry_line[ PROCESS_STATUS_MAXIMUM_TELEMETRY_LINE_SIZE ];
+	char eta_string[ 24 ];
+	char compute_percentage_string[ 8 ];
+	char io_wait_percentage_string[ 8 ];
+
+	static char *function            = "process_status_telemetry_emit";
+	size64_t bytes_per_second_10s    = 0;
+	size64_t bytes_per_second_1s     = 0;
+	size64_t bytes_processed         = 0;
+	size64_t bytes_total             = 0;
+	ssize_t write_count              = 0;
+	int64_t elapsed_time             = 0;
+	int64_t window_time              = 0;
+	uint32_t number_of_phase_samples = 0;
+	int last_sample_index            = 0;
+	int percentage                   = 0;
+	int print_count                  = 0;
+
+	if( process_status == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process status.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( process_status->telemetry_descriptor < 0 )
+	 || ( process_status->telemetry_write_failed != 0 ) )
+	{
+		return( 1 );
+	}
+	bytes_processed = PROCESS_STATUS_GET_64BIT(
+	                   process_status->bytes_processed );
+
+	bytes_total = PROCESS_STATUS_GET_64BIT(
+	               process_status->bytes_total );
+	elapsed_time    = current_time - process_status->telemetry_start_time;
+
+	if( process_status->number_of_telemetry_samples > 0 )
+	{
+		last_sample_index = process_status->number_of_telemetry_samples - 1;
+
+		if( last_sample_index > 0 )
+		{
+			window_time = process_status->telemetry_sample_times[ last_sample_index ]
+			            - process_status->telemetry_sample_times[ last_sample_index - 1 ];
+
+			if( window_time > 0 )
+			{
+				bytes_per_second_1s = ( ( process_status->telemetry_sample_bytes[ last_sample_index ]
+				                      - process_status->telemetry_sample_bytes[ last_sample_index - 1 ] ) * 1000000 ) / window_time;
+			}
+		}
+		/* The oldest sample is at most 10 telemetry intervals before the last sample
+		 */
+		window_time = process_status->telemetry_sample_times[ last_sample_index ]
+		            - process_status->telemetry_sample_times[ 0 ];
+
+		if( window_time > 0 )
+		{
+			bytes_per_second_10s = ( ( process_status->telemetry_sample_bytes[ last_sample_index ]
+			                       - process_status->telemetry_sample_bytes[ 0 ] ) * 1000000 ) / window_time;
+		}
+		else
+		{
+			bytes_per_second_10s = bytes_per_second_1s;
+		}
+	}
+	if( bytes_total > 0 )
+	{
+		percentage = (int) ( ( bytes_processed * 100 ) / bytes_total );
+	}
+	if( ( bytes_total >= bytes_processed )
+	 && ( bytes_per_second_10s > 0 ) )
+	{
+		print_count = narrow_string_snprintf(
+		               eta_string,
+		               24,
+		               "%" PRIu64 "",
+		               ( bytes_total - bytes_processed ) / bytes_per_second_10s );
+	}
+	else
+	{
+		print_count = narrow_string_snprintf(
+		               eta_string,
+		               24,
+		               "null" );
+	}
+	if( ( print_count < 0 )
+	 || ( print_count >= 24 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to format ETA.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_phase_samples = process_status->number_of_io_samples
+	                        + process_status->number_of_compute_samples;
+
+	if( number_of_phase_samples > 0 )
+	{
+		narrow_string_snprintf(
+		 io_wait_percentage_string,
+		 8,
+		 "%" PRIu32 "",
+		 ( process_status->number_of_io_samples * 100 ) / number_of_phase_samples );
+
+		narrow_string_snprintf(
+		 compute_percentage_string,
+		 8,
+		 "%" PRIu32 "",
+		 ( process_status->number_of_compute_samples * 100 ) / number_of_phase_samples );
+	}
+	else
+	{
+		narrow_string_snprintf(
+		 io_wait_percentage_string,
+		 8,
+		 "null" );
+
+		narrow_string_snprintf(
+		 compute_percentage_string,
+		 8,
+		 "null" );
+	}
+	process_status->number_of_io_samples      = 0;
+	process_status->number_of_compute_samples = 0;
+
+	print_count = narrow_string_snprintf(
+	               telemetry_line,
+	               PROCESS_STATUS_MAXIMUM_TELEMETRY_LINE_SIZE,
+	               "{\"event\":\"%s\",\"elapsed_ms\":%" PRIi64 ",\"bytes\":%" PRIu64 ",\"total\":%" PRIu64 ","
+	               "\"percentage\":%d,\"bytes_per_second_1s\":%" PRIu64 ",\"bytes_per_second_10s\":%" PRIu64 ","
+	               "\"eta_seconds\":%s,\"io_wait_percentage\":%s,\"compute_percentage\":%s}\n",
+	               event_string,
+	               elapsed_time / 1000,
+	               bytes_processed,
+	               bytes_total,
+	               percentage,
+	               bytes_per_second_1s,
+	               bytes_per_second_10s,
+	               eta_string,
+	               io_wait_percentage_string,
+	               compute_percentage_string );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= PROCESS_STATUS_MAXIMUM_TELEMETRY_LINE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to format telemetry line.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	write_count = (ssize_t) _write(
+	                         process_status->telemetry_descriptor,
+	                         telemetry_line,
+	                         (unsigned int) print_count );
+#else
+#if defined( HAVE_SYS_SOCKET_H )
+	if( process_status->telemetry_descriptor_is_socket != 0 )
+	{
+		/* Use send to prevent SIGPIPE when the reader has gone away
+		 */
+		write_count = send(
+		               process_status->telemetry_descriptor,
+		               telemetry_line,
+		               (size_t) print_count,
+		               PROCESS_STATUS_SEND_FLAGS );
+	}
+	else
+#endif
+	{
+		write_count = write(
+		               process_status->telemetry_descriptor,
+		               telemetry_line,
+		               (size_t) print_count );
+	}
+#endif
+	if( write_count != (ssize_t) print_count )
+	{
+		process_status->telemetry_write_failed = 1;
+	}
+	return( 1 );
+}
+
+/* Samples the process for telemetry
+ * The phase is sampled every call, the throughput is sampled and a telemetry line
+ * is emitted once every telemetry interval
+ * Returns 1 if successful or -1 on error
+ */
+int process_status_telemetry_sample(
+     process_status_t *process_status,
+     int64_t current_time,
+     libcerror_error_t **error )
+{
+	static char *function = "process_status_telemetry_sample";
+	int last_sample_index = 0;
+	int phase             = 0;
+	int sample_index      = 0;
+
+	if( process_status == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process status.",
+		 function );
+
+		return( -1 );
+	}
+	phase = PROCESS_STATUS_GET_INT(
+	         process_status->phase );
+
+	if( phase == PROCESS_STATUS_PHASE_IO )
+	{
+		process_status->number_of_io_samples += 1;
+	}
+	else if( phase == PROCESS_STATUS_PHASE_COMPUTE )
+	{
+		process_status->number_of_compute_samples += 1;
+	}
+	if( process_status->number_of_telemetry_samples > 0 )
+	{
+		last_sample_index = process_status->number_of_telemetry_samples - 1;
+
+		if( ( current_time - process_status->telemetry_sample_times[ last_sample_index ] ) < process_status->telemetry_interval )
+		{
+			return( 1 );
+		}
+	}
+	if( process_status->number_of_telemetry_samples >= PROCESS_STATUS_NUMBER_OF_TELEMETRY_SAMPLES )
+	{
+		for( sample_index = 1;
+		     sample_index < PROCESS_STATUS_NUMBER_OF_TELEMETRY_SAMPLES;
+		     sample_index++ )
+		{
+			process_status->telemetry_sample_times[ sample_index - 1 ] = process_status->telemetry_sample_times[ sample_index ];
+			process_status->telemetry_sample_bytes[ sample_index - 1 ] = process_status->telemetry_sample_bytes[ sample_index ];
+		}
+		process_status->number_of_telemetry_samples -= 1;
+	}
+	sample_index = process_status->number_of_telemetry_samples;
+
+	process_status->telemetry_sample_times[ sample_index ] = current_time;
+	process_status->telemetry_sample_bytes[ sample_index ] = PROCESS_STATUS_GET_64BIT(
+	                                                          process_status->bytes_processed );
+
+	process_status->number_of_telemetry_samples += 1;
+
+	/* The first sample marks the start of the throughput window
+	 */
+	if( sample_index == 0 )
+	{
+		return( 1 );
+	}
+	if( process_status_telemetry_emit(
+	     process_status,
+	     current_time,
+	     "progress",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to emit telemetry.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The telemetry timer thread
+ * The timer keeps the telemetry off the per buffer processing, which only stores
+ * the number of bytes processed and the phase
+ * Returns 1 if successful or -1 on error
+ */
+int process_status_telemetry_timer(
+     process_status_t *process_status )
+{
+	libcerror_error_t *error = NULL;
+	int64_t current_time     = 0;
+
+	if( process_status == NULL )
+	{
+		return( -1 );
+	}
+	while( PROCESS_STATUS_GET_INT( process_status->telemetry_stop ) == 0 )
+	{
+		if( rate_limiter_sleep(
+		     PROCESS_STATUS_TELEMETRY_SAMPLE_INTERVAL,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( rate_limiter_get_current_time(
+		     &current_time,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( process_status_telemetry_sample(
+		     process_status,
+		     current_time,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
 	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
 }
 
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 /* Starts the process status information
  * Returns 1 if successful or -1 on error
  */
@@ -470,6 +1169,58 @@ int process_status_start(
 		 process_status->output_stream,
 		 "This could take a while.\n\n" );
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( process_status->telemetry_descriptor >= 0 )
+	{
+		if( rate_limiter_get_current_time(
+		     &( process_status->telemetry_start_time ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve telemetry start time.",
+			 function );
+
+			return( -1 );
+		}
+		PROCESS_STATUS_SET_INT(
+		 process_status->telemetry_stop,
+		 0 );
+
+		if( process_status_telemetry_sample(
+		     process_status,
+		     process_status->telemetry_start_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to sample telemetry.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcthreads_thread_create(
+		     &( process_status->telemetry_thread ),
+		     NULL,
+		     (int (*)(void *)) &process_status_telemetry_timer,
+		     (void *) process_status,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create telemetry thread.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
 	return( 1 );
 }
 
@@ -500,6 +1251,14 @@ int process_status_update(
 
 		return( -1 );
 	}
+	PROCESS_STATUS_SET_64BIT(
+	 process_status->bytes_processed,
+	 bytes_read );
+
+	PROCESS_STATUS_SET_64BIT(
+	 process_status->bytes_total,
+	 bytes_total );
+
 	if( ( process_status->output_stream != NULL )
 	 && ( process_status->print_status_information != 0 )
 	 && ( process_status->status_update_string != NULL ) )
@@ -607,6 +1366,10 @@ int process_status_update_unknown_total(
 
 		return( -1 );
 	}
+	PROCESS_STATUS_SET_64BIT(
+	 process_status->bytes_processed,
+	 bytes_read );
+
 	if( ( process_status->output_stream != NULL )
 	 && ( process_status->print_status_information != 0 )
 	 && ( process_status->status_update_string != NULL ) )
@@ -676,9 +1439,14 @@ int process_status_stop(
 	system_character_t time_string[ 32 ];
 
 	const system_character_t *status_string = _SYSTEM_STRING( "" );
-	static char *function                   = "process_status_start";
+	static char *function                   = "process_status_stop";
 	time_t seconds_total                    = 0;
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	const char *event_string                = NULL;
+	int64_t current_time                    = 0;
+#endif
+
 	if( process_status == NULL )
 	{
 		libcerror_error_set(
@@ -706,6 +1474,73 @@ int process_status_stop(
 	process_status->last_timestamp = time(
 	                                  NULL );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( process_status->telemetry_thread != NULL )
+	{
+		PROCESS_STATUS_SET_INT(
+		 process_status->telemetry_stop,
+		 1 );
+
+		if( libcthreads_thread_join(
+		     &( process_status->telemetry_thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join telemetry thread.",
+			 function );
+
+			return( -1 );
+		}
+		if( rate_limiter_get_current_time(
+		     &current_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current time.",
+			 function );
+
+			return( -1 );
+		}
+		if( status == PROCESS_STATUS_ABORTED )
+		{
+			event_string = "aborted";
+		}
+		else if( status == PROCESS_STATUS_COMPLETED )
+		{
+			event_string = "completed";
+		}
+		else
+		{
+			event_string = "failed";
+		}
+		PROCESS_STATUS_SET_64BIT(
+		 process_status->bytes_processed,
+		 bytes_total );
+
+		if( process_status_telemetry_emit(
+		     process_status,
+		     current_time,
+		     event_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to emit telemetry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+
 	if( ( process_status->output_stream != NULL )
 	 && ( process_status->print_status_information != 0 )
 	 && ( process_status->status_process_string != NULL ) )
@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "odrawtools_libcerror.h"
+#include "odrawtools_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -38,6 +39,62 @@ enum PROCESS_STATUS
 	PROCESS_STATUS_FAILED		= (int) 'f'
 };
 
+enum PROCESS_STATUS_PHASES
+{
+	PROCESS_STATUS_PHASE_IDLE	= 0,
+	PROCESS_STATUS_PHASE_IO		= 1,
+	PROCESS_STATUS_PHASE_COMPUTE	= 2
+};
+
+/* The number of throughput samples retained by the telemetry timer, one per telemetry interval
+ */
+#define PROCESS_STATUS_NUMBER_OF_TELEMETRY_SAMPLES	11
+
+/* The values that are shared with the telemetry timer thread are accessed
+ * with relaxed atomic operations, so that a 64-bit value cannot be torn
+ * on a 32-bit target
+ */
+#if defined( __GNUC__ ) && defined( __ATOMIC_RELAXED ) && ( __GCC_ATOMIC_LLONG_LOCK_FREE == 2 )
+#define PROCESS_STATUS_GET_64BIT( value ) \
+	__atomic_load_n( &( value ), __ATOMIC_RELAXED )
+
+#define PROCESS_STATUS_SET_64BIT( value, new_value ) \
+	__atomic_store_n( &( value ), (size64_t) ( new_value ), __ATOMIC_RELAXED )
+
+#define PROCESS_STATUS_GET_INT( value ) \
+	__atomic_load_n( &( value ), __ATOMIC_RELAXED )
+
+#define PROCESS_STATUS_SET_INT( value, new_value ) \
+	__atomic_store_n( &( value ), (int) ( new_value ), __ATOMIC_RELAXED )
+
+#elif defined( _MSC_VER ) && defined( _WIN64 )
+#define PROCESS_STATUS_GET_64BIT( value ) \
+	(size64_t) InterlockedOr64( (volatile LONG64 *) &( value ), 0 )
+
+#define PROCESS_STATUS_SET_64BIT( value, new_value ) \
+	InterlockedExchange64( (volatile LONG64 *) &( value ), (LONG64) ( new_value ) )
+
+#define PROCESS_STATUS_GET_INT( value ) \
+	(int) InterlockedOr( (volatile LONG *) &( value ), 0 )
+
+#define PROCESS_STATUS_SET_INT( value, new_value ) \
+	InterlockedExchange( (volatile LONG *) &( value ), (LONG) ( new_value ) )
+
+#else
+#define PROCESS_STATUS_GET_64BIT( value ) \
+	( *( (volatile size64_t *) &( value ) ) )
+
+#define PROCESS_STATUS_SET_64BIT( value, new_value ) \
+	( *( (volatile size64_t *) &( value ) ) ) = (size64_t) ( new_value )
+
+#define PROCESS_STATUS_GET_INT( value ) \
+	( *( (volatile int *) &( value ) ) )
+
+#define PROCESS_STATUS_SET_INT( value, new_value ) \
+	( *( (volatile int *) &( value ) ) ) = (int) ( new_value )
+
+#endif
+
 typedef struct process_status process_status_t;
 
 struct process_status
@@ -77,6 +134,73 @@ struct process_status
 	/* The last percentage
 	 */
 	int8_t last_percentage;
+
+	/* The number of bytes processed, which is sampled by the telemetry timer
+	 * and accessed using PROCESS_STATUS_GET_64BIT and PROCESS_STATUS_SET_64BIT
+	 */
+	size64_t bytes_processed;
+
+	/* The total number of bytes to process, which is sampled by the telemetry timer
+	 * and accessed using PROCESS_STATUS_GET_64BIT and PROCESS_STATUS_SET_64BIT
+	 */
+	size64_t bytes_total;
+
+	/* The phase of the process, which is set directly by the per buffer processing
+	 * and sampled by the telemetry timer, accessed using PROCESS_STATUS_GET_INT
+	 * and PROCESS_STATUS_SET_INT
+	 */
+	int phase;
+
+	/* The telemetry descriptor, which is -1 if no telemetry is emitted
+	 */
+	int telemetry_descriptor;
+
+	/* Value to indicate the telemetry descriptor is a socket
+	 */
+	uint8_t telemetry_descriptor_is_socket;
+
+	/* Value to indicate writing to the telemetry descriptor failed
+	 */
+	uint8_t telemetry_write_failed;
+
+	/* The telemetry interval, in microseconds
+	 */
+	int64_t telemetry_interval;
+
+	/* The telemetry start time, in microseconds
+	 */
+	int64_t telemetry_start_time;
+
+	/* The times of the throughput samples, in microseconds
+	 */
+	int64_t telemetry_sample_times[ PROCESS_STATUS_NUMBER_OF_TELEMETRY_SAMPLES ];
+
+	/* The number of bytes processed of the throughput samples
+	 */
+	size64_t telemetry_sample_bytes[ PROCESS_STATUS_NUMBER_OF_TELEMETRY_SAMPLES ];
+
+	/* The number of throughput samples
+	 */
+	int number_of_telemetry_samples;
+
+	/* The number of phase samples in the IO phase since the last telemetry line
+	 */
+	uint32_t number_of_io_samples;
+
+	/* The number of phase samples in the compute phase since the last telemetry line
+	 */
+	uint32_t number_of_compute_samples;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The telemetry timer thread
+	 */
+	libcthreads_thread_t *telemetry_thread;
+
+	/* Value to indicate the telemetry timer should stop, accessed using
+	 * PROCESS_STATUS_GET_INT and PROCESS_STATUS_SET_INT
+	 */
+	int telemetry_stop;
+#endif
 };
 
 #if defined( HAVE_CTIME ) || defined( HAVE_CTIME_R ) || defined( WINAPI )
@@ -111,6 +235,40 @@ int process_status_free(
      process_status_t **process_status,
      libcerror_error_t **error );
 
+int process_status_telemetry_open(
+     const system_character_t *target,
+     int *descriptor,
+     uint8_t *descriptor_is_socket,
+     libcerror_error_t **error );
+
+int process_status_telemetry_close(
+     int descriptor,
+     libcerror_error_t **error );
+
+int process_status_set_telemetry_descriptor(
+     process_status_t *process_status,
+     int descriptor,
+     uint8_t descriptor_is_socket,
+     libcerror_error_t **error );
+
+int process_status_telemetry_emit(
+     process_status_t *process_status,
+     int64_t current_time,
+     const char *event_string,
+     libcerror_error_t **error );
+
+int process_status_telemetry_sample(
+     process_status_t *process_status,
+     int64_t current_time,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int process_status_telemetry_timer(
+     process_status_t *process_status );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int process_status_start(
      process_status_t *process_status,
      libcerror_error_t **error );
@@ -0,0 +1,511 @@
+/*
+ * Rate limiter
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#include <time.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "odrawtools_libcerror.h"
+#include "rate_limiter.h"
+
+/* The number of read latency samples before back off is considered
+ */
+#define RATE_LIMITER_MINIMUM_NUMBER_OF_LATENCY_SAMPLES	8
+
+/* The recent read latency, in microseconds, below which no back off is applied
+ * This prevents backing off on fluctuations in the latency of cached reads
+ */
+#define RATE_LIMITER_MINIMUM_BACK_OFF_LATENCY		1000
+
+/* The factor of the average read latency the recent read latency must exceed to back off
+ */
+#define RATE_LIMITER_BACK_OFF_LATENCY_FACTOR		3
+
+#define RATE_LIMITER_INITIAL_BACK_OFF_DELAY		10000
+#define RATE_LIMITER_MAXIMUM_BACK_OFF_DELAY		1000000
+
+/* Creates a rate limiter
+ * Make sure the value rate_limiter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int rate_limiter_initialize(
+     rate_limiter_t **rate_limiter,
+     uint64_t maximum_bytes_per_second,
+     uint32_t maximum_reads_per_second,
+     libcerror_error_t **error )
+{
+	static char *function = "rate_limiter_initialize";
+
+	if( rate_limiter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rate limiter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *rate_limiter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid rate limiter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_bytes_per_second > (uint64_t) ( INT64_MAX / 1000000 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum bytes per second value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*rate_limiter = memory_allocate_structure(
+	                 rate_limiter_t );
+
+	if( *rate_limiter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create rate limiter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *rate_limiter,
+	     0,
+	     sizeof( rate_limiter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear rate limiter.",
+		 function );
+
+		goto on_error;
+	}
+	( *rate_limiter )->maximum_bytes_per_second = maximum_bytes_per_second;
+	( *rate_limiter )->maximum_reads_per_second = maximum_reads_per_second;
+
+	/* Allow a burst of up to 1 second worth of reads
+	 */
+	( *rate_limiter )->available_bytes = (int64_t) maximum_bytes_per_second;
+	( *rate_limiter )->available_reads = (int64_t) maximum_reads_per_second * 1000000;
+
+	return( 1 );
+
+on_error:
+	if( *rate_limiter != NULL )
+	{
+		memory_free(
+		 *rate_limiter );
+
+		*rate_limiter = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a rate limiter
+ * Returns 1 if successful or -1 on error
+ */
+int rate_limiter_free(
+     rate_limiter_t **rate_limiter,
+     libcerror_error_t **error )
+{
+	static char *function = "rate_limiter_free";
+
+	if( rate_limiter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rate limiter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *rate_limiter != NULL )
+	{
+		memory_free(
+		 *rate_limiter );
+
+		*rate_limiter = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the current time of a monotonic clock in microseconds
+ * Returns 1 if successful or -1 on error
+ */
+int rate_limiter_get_current_time(
+     int64_t *current_time,
+     libcerror_error_t **error )
+{
+#if !defined( WINAPI ) && defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+#elif !defined( WINAPI ) && defined( HAVE_GETTIMEOFDAY )
+	struct timeval time_value;
+#endif
+
+	static char *function = "rate_limiter_get_current_time";
+
+	if( current_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	*current_time = (int64_t) GetTickCount64() * 1000;
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = ( (int64_t) time_value.tv_sec * 1000000 ) + ( time_value.tv_nsec / 1000 );
+
+#elif defined( HAVE_GETTIMEOFDAY )
+	if( gettimeofday(
+	     &time_value,
+	     NULL ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = ( (int64_t) time_value.tv_sec * 1000000 ) + time_value.tv_usec;
+
+#else
+	*current_time = (int64_t) time( NULL ) * 1000000;
+#endif
+	return( 1 );
+}
+
+/* Suspends the calling thread for a number of microseconds
+ * Returns 1 if successful or -1 on error
+ */
+int rate_limiter_sleep(
+     int64_t number_of_microseconds,
+     libcerror_error_t **error )
+{
+#if !defined( WINAPI ) && defined( HAVE_NANOSLEEP )
+	struct timespec remaining_time;
+	struct timespec sleep_time;
+#endif
+
+	static char *function = "rate_limiter_sleep";
+
+	if( number_of_microseconds < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of microseconds value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	Sleep(
+	 (DWORD) ( ( number_of_microseconds + 999 ) / 1000 ) );
+
+#elif defined( HAVE_NANOSLEEP )
+	sleep_time.tv_sec  = (time_t) ( number_of_microseconds / 1000000 );
+	sleep_time.tv_nsec = (long) ( number_of_microseconds % 1000000 ) * 1000;
+
+	while( nanosleep(
+	        &sleep_time,
+	        &remaining_time ) != 0 )
+	{
+		if( errno != EINTR )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 errno,
+			 "%s: unable to sleep.",
+			 function );
+
+			return( -1 );
+		}
+		sleep_time = remaining_time;
+	}
+#else
+	sleep(
+	 (unsigned int) ( ( number_of_microseconds + 999999 ) / 1000000 ) );
+#endif
+	return( 1 );
+}
+
+/* Waits until a read of a specific size is allowed by the limits
+ * The available bytes and reads are refilled at the maximum rate, up to 1 second
+ * worth, and the read is accounted for before it is done. The back off delay
+ * is added to every read
+ * Returns 1 if successful or -1 on error
+ */
+int rate_limiter_wait(
+     rate_limiter_t *rate_limiter,
+     size_t read_size,
+     libcerror_error_t **error )
+{
+	static char *function = "rate_limiter_wait";
+	int64_t current_time  = 0;
+	int64_t elapsed_time  = 0;
+	int64_t read_delay    = 0;
+	int64_t wait_time     = 0;
+
+	if( rate_limiter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rate limiter.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid read size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( rate_limiter_get_current_time(
+	     &current_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	if( rate_limiter->last_refill_time != 0 )
+	{
+		elapsed_time = current_time - rate_limiter->last_refill_time;
+
+		/* More than 1 second refills to the maximum
+		 */
+		if( ( elapsed_time < 0 )
+		 || ( elapsed_time > 1000000 ) )
+		{
+			elapsed_time = 1000000;
+		}
+	}
+	rate_limiter->last_refill_time = current_time;
+
+	if( rate_limiter->maximum_bytes_per_second > 0 )
+	{
+		rate_limiter->available_bytes += ( elapsed_time * (int64_t) rate_limiter->maximum_bytes_per_second ) / 1000000;
+
+		if( rate_limiter->available_bytes > (int64_t) rate_limiter->maximum_bytes_per_second )
+		{
+			rate_limiter->available_bytes = (int64_t) rate_limiter->maximum_bytes_per_second;
+		}
+		rate_limiter->available_bytes -= (int64_t) read_size;
+
+		if( rate_limiter->available_bytes < 0 )
+		{
+			wait_time = ( -rate_limiter->available_bytes * 1000000 ) / (int64_t) rate_limiter->maximum_bytes_per_second;
+		}
+	}
+	if( rate_limiter->maximum_reads_per_second > 0 )
+	{
+		rate_limiter->available_reads += elapsed_time * (int64_t) rate_limiter->maximum_reads_per_second;
+
+		if( rate_limiter->available_reads > ( (int64_t) rate_limiter->maximum_reads_per_second * 1000000 ) )
+		{
+			rate_limiter->available_reads = (int64_t) rate_limiter->maximum_reads_per_second * 1000000;
+		}
+		rate_limiter->available_reads -= 1000000;
+
+		if( rate_limiter->available_reads < 0 )
+		{
+			read_delay = -rate_limiter->available_reads / (int64_t) rate_limiter->maximum_reads_per_second;
+
+			if( read_delay > wait_time )
+			{
+				wait_time = read_delay;
+			}
+		}
+	}
+	wait_time += rate_limiter->back_off_delay;
+
+	if( wait_time > 0 )
+	{
+		if( rate_limiter_sleep(
+		     wait_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to sleep.",
+			 function );
+
+			return( -1 );
+		}
+		rate_limiter->total_wait_time += wait_time;
+	}
+	return( 1 );
+}
+
+/* Updates the read latency and adjusts the back off delay
+ * The back off delay is doubled while the recent read latency exceeds a factor
+ * of the average read latency and halved otherwise. The average read latency
+ * is only updated while not backing off so that it represents an idle device
+ * Returns 1 if successful or -1 on error
+ */
+int rate_limiter_update_latency(
+     rate_limiter_t *rate_limiter,
+     int64_t latency,
+     libcerror_error_t **error )
+{
+	static char *function = "rate_limiter_update_latency";
+
+	if( rate_limiter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rate limiter.",
+		 function );
+
+		return( -1 );
+	}
+	if( latency < 0 )
+	{
+		latency = 0;
+	}
+	if( rate_limiter->number_of_latency_samples == 0 )
+	{
+		rate_limiter->average_latency = latency;
+		rate_limiter->recent_latency  = latency;
+	}
+	else
+	{
+		rate_limiter->recent_latency += ( latency - rate_limiter->recent_latency ) / 4;
+
+		if( rate_limiter->back_off_delay == 0 )
+		{
+			rate_limiter->average_latency += ( latency - rate_limiter->average_latency ) / 64;
+		}
+	}
+	if( rate_limiter->number_of_latency_samples < RATE_LIMITER_MINIMUM_NUMBER_OF_LATENCY_SAMPLES )
+	{
+		rate_limiter->number_of_latency_samples += 1;
+
+		return( 1 );
+	}
+	if( ( rate_limiter->recent_latency > RATE_LIMITER_MINIMUM_BACK_OFF_LATENCY )
+	 && ( rate_limiter->recent_latency > ( rate_limiter->average_latency * RATE_LIMITER_BACK_OFF_LATENCY_FACTOR ) ) )
+	{
+		if( rate_limiter->back_off_delay == 0 )
+		{
+			rate_limiter->back_off_delay = RATE_LIMITER_INITIAL_BACK_OFF_DELAY;
+		}
+		else if( rate_limiter->back_off_delay < RATE_LIMITER_MAXIMUM_BACK_OFF_DELAY )
+		{
+			rate_limiter->back_off_delay *= 2;
+
+			if( rate_limiter->back_off_delay > RATE_LIMITER_MAXIMUM_BACK_OFF_DELAY )
+			{
+				rate_limiter->back_off_delay = RATE_LIMITER_MAXIMUM_BACK_OFF_DELAY;
+			}
+		}
+	}
+	else if( rate_limiter->back_off_delay > 0 )
+	{
+		rate_limiter->back_off_delay /= 2;
+
+		if( rate_limiter->back_off_delay < RATE_LIMITER_MINIMUM_BACK_OFF_LATENCY )
+		{
+			rate_limiter->back_off_delay = 0;
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,113 @@
+/*
+ * Rate limiter
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _RATE_LIMITER_H )
+#define _RATE_LIMITER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "odrawtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct rate_limiter rate_limiter_t;
+
+struct rate_limiter
+{
+	/* The maximum number of bytes per second, 0 represents no limit
+	 */
+	uint64_t maximum_bytes_per_second;
+
+	/* The maximum number of reads per second, 0 represents no limit
+	 */
+	uint32_t maximum_reads_per_second;
+
+	/* The available number of bytes, which is negative when reads are ahead of the limit
+	 */
+	int64_t available_bytes;
+
+	/* The available number of reads, in millionths of a read
+	 */
+	int64_t available_reads;
+
+	/* The time of the last refill of the available bytes and reads, in microseconds
+	 */
+	int64_t last_refill_time;
+
+	/* The long term average read latency, in microseconds
+	 */
+	int64_t average_latency;
+
+	/* The recent read latency, in microseconds
+	 */
+	int64_t recent_latency;
+
+	/* The number of read latency samples
+	 */
+	uint32_t number_of_latency_samples;
+
+	/* The delay that is added to every read to back off when the read latency rises, in microseconds
+	 */
+	int64_t back_off_delay;
+
+	/* The total time spent waiting, in microseconds
+	 */
+	int64_t total_wait_time;
+};
+
+int rate_limiter_initialize(
+     rate_limiter_t **rate_limiter,
+     uint64_t maximum_bytes_per_second,
+     uint32_t maximum_reads_per_second,
+     libcerror_error_t **error );
+
+int rate_limiter_free(
+     rate_limiter_t **rate_limiter,
+     libcerror_error_t **error );
+
+int rate_limiter_get_current_time(
+     int64_t *current_time,
+     libcerror_error_t **error );
+
+int rate_limiter_sleep(
+     int64_t number_of_microseconds,
+     libcerror_error_t **error );
+
+int rate_limiter_wait(
+     rate_limiter_t *rate_limiter,
+     size_t read_size,
+     libcerror_error_t **error );
+
+int rate_limiter_update_latency(
+     rate_limiter_t *rate_limiter,
+     int64_t latency,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _RATE_LIMITER_H ) */
+
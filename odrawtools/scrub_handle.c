@@ -0,0 +1,1583 @@
+/*
+ * Scrub handle
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_SYSCALL_H )
+#include <sys/syscall.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "byte_size_string.h"
+#include "log_handle.h"
+#include "odrawtools_libcerror.h"
+#include "odrawtools_libcnotify.h"
+#include "rate_limiter.h"
+#include "scrub_handle.h"
+#include "verification_handle.h"
+
+#define SCRUB_HANDLE_NOTIFY_STREAM		stdout
+
+#define SCRUB_HANDLE_MAXIMUM_LINE_SIZE		4096
+
+/* The Linux IO priority class and value of the idle IO scheduling class
+ */
+#define SCRUB_HANDLE_IOPRIO_WHO_PROCESS		1
+#define SCRUB_HANDLE_IOPRIO_CLASS_SHIFT		13
+#define SCRUB_HANDLE_IOPRIO_CLASS_IDLE		3
+
+/* Creates a scrub handle
+ * Make sure the value scrub_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int scrub_handle_initialize(
+     scrub_handle_t **scrub_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scrub_handle_initialize";
+
+	if( scrub_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scrub handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scrub_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scrub handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*scrub_handle = memory_allocate_structure(
+	                 scrub_handle_t );
+
+	if( *scrub_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scrub handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scrub_handle,
+	     0,
+	     sizeof( scrub_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scrub handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *scrub_handle )->notify_stream        = SCRUB_HANDLE_NOTIFY_STREAM;
+	( *scrub_handle )->telemetry_descriptor = -1;
+
+	return( 1 );
+
+on_error:
+	if( *scrub_handle != NULL )
+	{
+		memory_free(
+		 *scrub_handle );
+
+		*scrub_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a scrub handle
+ * Returns 1 if successful or -1 on error
+ */
+int scrub_handle_free(
+     scrub_handle_t **scrub_handle,
+     libcerror_error_t **error )
+{
+	static char *function    = "scrub_handle_free";
+	int manifest_entry_index = 0;
+	int result               = 1;
+
+	if( scrub_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scrub handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scrub_handle != NULL )
+	{
+		if( ( *scrub_handle )->rate_limiter != NULL )
+		{
+			if( rate_limiter_free(
+			     &( ( *scrub_handle )->rate_limiter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free rate limiter.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scrub_handle )->manifest_entries != NULL )
+		{
+			for( manifest_entry_index = 0;
+			     manifest_entry_index < ( *scrub_handle )->number_of_manifest_entries;
+			     manifest_entry_index++ )
+			{
+				memory_free(
+				 ( *scrub_handle )->manifest_entries[ manifest_entry_index ].filename );
+			}
+			memory_free(
+			 ( *scrub_handle )->manifest_entries );
+		}
+		memory_free(
+		 *scrub_handle );
+
+		*scrub_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the scrub handle to abort
+ * The source that is being scrubbed is signalled to abort as well
+ * Returns 1 if successful or -1 on error
+ */
+int scrub_handle_signal_abort(
+     scrub_handle_t *scrub_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scrub_handle_signal_abort";
+
+	if( scrub_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scrub handle.",
+		 function );
+
+		return( -1 );
+	}
+	scrub_handle->abort = 1;
+
+	if( scrub_handle->verification_handle != NULL )
+	{
+		if( verification_handle_signal_abort(
+		     scrub_handle->verification_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal verification handle to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Converts a decimal string into a 32-bit value
+ * Returns 1 if successful or 0 if unsupported value
+ */
+int scrub_handle_decimal_string_copy_to_32bit(
+     const system_character_t *string,
+     uint32_t *value_32bit )
+{
+	size_t string_index  = 0;
+	size_t string_length = 0;
+	uint64_t value_64bit = 0;
+
+	if( ( string == NULL )
+	 || ( value_32bit == NULL ) )
+	{
+		return( 0 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 10 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		value_64bit *= 10;
+		value_64bit += (uint64_t) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( value_64bit > (uint64_t) UINT32_MAX )
+	{
+		return( 0 );
+	}
+	*value_32bit = (uint32_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of bytes per second
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int scrub_handle_set_maximum_bytes_per_second(
+     scrub_handle_t *scrub_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function  = "scrub_handle_set_maximum_bytes_per_second";
+	size_t string_length   = 0;
+	uint64_t size_variable = 0;
+	int result             = 0;
+
+	if( scrub_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scrub handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	result = byte_size_string_convert(
+	          string,
+	          string_length,
+	          &size_variable,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine maximum bytes per second.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* Limit the value so that the rate limiter calculations cannot overflow
+		 */
+		if( size_variable > ( (uint64_t) INT64_MAX / 1000000 ) )
+		{
+			result = 0;
+		}
+		else
+		{
+			scrub_handle->maximum_bytes_per_second = size_variable;
+		}
+	}
+	return( result );
+}
+
+/* Sets the maximum number of reads per second
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int scrub_handle_set_maximum_reads_per_second(
+     scrub_handle_t *scrub_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "scrub_handle_set_maximum_reads_per_second";
+
+	if( scrub_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scrub handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	return( scrub_handle_decimal_string_copy_to_32bit(
+	         string,
+	         &( scrub_handle->maximum_reads_per_second ) ) );
+}
+
+/* Sets the maximum duration of a scrub run in seconds
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int scrub_handle_set_maximum_duration(
+     scrub_handle_t *scrub_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "scrub_handle_set_maximum_duration";
+
+	if( scrub_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scrub handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	return( scrub_handle_decimal_string_copy_to_32bit(
+	         string,
+	         &( scrub_handle->maximum_duration ) ) );
+}
+
+/* Sets the IO priority of the current thread to idle
+ * On Linux the idle IO scheduling class is used, which only issues reads when
+ * no other process has used the disk for a while
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int scrub_handle_set_idle_io_priority(
+     scrub_handle_t *scrub_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scrub_handle_set_idle_io_priority";
+
+	if( scrub_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scrub handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	if( SetThreadPriority(
+	     GetCurrentThread(),
+	     THREAD_MODE_BACKGROUND_BEGIN ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set background mode.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+#elif defined( __linux__ ) && defined( HAVE_SYS_SYSCALL_H ) && defined( SYS_ioprio_set )
+	if( syscall(
+	     SYS_ioprio_set,
+	     SCRUB_HANDLE_IOPRIO_WHO_PROCESS,
+	     0,
+	     SCRUB_HANDLE_IOPRIO_CLASS_IDLE << SCRUB_HANDLE_IOPRIO_CLASS_SHIFT ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set idle IO scheduling class.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+#else
+	return( 0 );
+
+#endif
+}
+
+/* Appends a manifest entry from a manifest line
+ * The line is formatted as: "<hexadecimal digest hash>  <filename>", where the filename
+ * can be prefixed by '*' to indicate binary mode, as written by md5sum, sha1sum and sha256sum
+ * Returns 1 if successful, 0 if the line is not supported or -1 on error
+ */
+int scrub_handle_append_manifest_entry(
+     scrub_handle_t *scrub_handle,
+     const system_character_t *line,
+     size_t line_length,
+     libcerror_error_t **error )
+{
+	scrub_manifest_entry_t *manifest_entries = NULL;
+	scrub_manifest_entry_t *manifest_entry   = NULL;
+	system_character_t *filename             = NULL;
+	static char *function                    = "scrub_handle_append_manifest_entry";
+	size_t digest_hash_string_length         = 0;
+	size_t filename_length                   = 0;
+	size_t line_index                        = 0;
+	uint8_t digest_type                      = 0;
+	int maximum_number_of_manifest_entries   = 0;
+
+	if( scrub_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scrub handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line.",
+		 function );
+
+		return( -1 );
+	}
+	while( line_index < line_length )
+	{
+		if( ( ( line[ line_index ] < (system_character_t) '0' )
+		  ||  ( line[ line_index ] > (system_character_t) '9' ) )
+		 && ( ( line[ line_index ] < (system_character_t) 'A' )
+		  ||  ( line[ line_index ] > (system_character_t) 'F' ) )
+		 && ( ( line[ line_index ] < (system_character_t) 'a' )
+		  ||  ( line[ line_index ] > (system_character_t) 'f' ) ) )
+		{
+			break;
+		}
+		line_index++;
+	}
+	digest_hash_string_length = line_index;
+
+	switch( digest_hash_string_length )
+	{
+		case 32:
+			digest_type = SCRUB_HANDLE_DIGEST_TYPE_MD5;
+			break;
+
+		case 40:
+			digest_type = SCRUB_HANDLE_DIGEST_TYPE_SHA1;
+			break;
+
+		case 64:
+			digest_type = SCRUB_HANDLE_DIGEST_TYPE_SHA256;
+			break;
+
+		default:
+			return( 0 );
+	}
+	if( ( line_index >= line_length )
+	 || ( ( line[ line_index ] != (system_character_t) ' ' )
+	  &&  ( line[ line_index ] != (system_character_t) '\t' ) ) )
+	{
+		return( 0 );
+	}
+	while( ( line_index < line_length )
+	    && ( ( line[ line_index ] == (system_character_t) ' ' )
+	     ||  ( line[ line_index ] == (system_character_t) '\t' ) ) )
+	{
+		line_index++;
+	}
+	if( ( line_index < line_length )
+	 && ( line[ line_index ] == (system_character_t) '*' ) )
+	{
+		line_index++;
+	}
+	filename_length = line_length - line_index;
+
+	if( filename_length == 0 )
+	{
+		return( 0 );
+	}
+	if( scrub_handle->number_of_manifest_entries >= scrub_handle->maximum_number_of_manifest_entries )
+	{
+		if( scrub_handle->maximum_number_of_manifest_entries == 0 )
+		{
+			maximum_number_of_manifest_entries = 1024;
+		}
+		else if( scrub_handle->maximum_number_of_manifest_entries < ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 / (int) sizeof( scrub_manifest_entry_t ) ) )
+		{
+			maximum_number_of_manifest_entries = scrub_handle->maximum_number_of_manifest_entries * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of manifest entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		manifest_entries = (scrub_manifest_entry_t *) memory_reallocate(
+		                                                scrub_handle->manifest_entries,
+		                                                sizeof( scrub_manifest_entry_t ) * maximum_number_of_manifest_entries );
+
+		if( manifest_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize manifest entries.",
+			 function );
+
+			return( -1 );
+		}
+		scrub_handle->manifest_entries                   = manifest_entries;
+		scrub_handle->maximum_number_of_manifest_entries = maximum_number_of_manifest_entries;
+	}
+	filename = system_string_allocate(
+	            filename_length + 1 );
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     filename,
+	     &( line[ line_index ] ),
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		memory_free(
+		 filename );
+
+		return( -1 );
+	}
+	filename[ filename_length ] = 0;
+
+	manifest_entry = &( scrub_handle->manifest_entries[ scrub_handle->number_of_manifest_entries ] );
+
+	if( system_string_copy(
+	     manifest_entry->digest_hash_string,
+	     line,
+	     digest_hash_string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy digest hash string.",
+		 function );
+
+		memory_free(
+		 filename );
+
+		return( -1 );
+	}
+	manifest_entry->digest_hash_string[ digest_hash_string_length ] = 0;
+
+	manifest_entry->filename    = filename;
+	manifest_entry->digest_type = digest_type;
+
+	scrub_handle->number_of_manifest_entries += 1;
+
+	return( 1 );
+}
+
+/* Reads the manifest
+ * Empty lines and lines starting with '#' are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int scrub_handle_read_manifest(
+     scrub_handle_t *scrub_handle,
+     const system_character_t *manifest_filename,
+     libcerror_error_t **error )
+{
+	system_character_t line[ SCRUB_HANDLE_MAXIMUM_LINE_SIZE ];
+
+	FILE *manifest_file_stream = NULL;
+	static char *function      = "scrub_handle_read_manifest";
+	size_t line_length         = 0;
+	int line_number            = 0;
+	int result                 = 0;
+
+	if( scrub_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scrub handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( manifest_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	manifest_file_stream = file_stream_open_wide(
+	                        manifest_filename,
+	                        _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	manifest_file_stream = file_stream_open(
+	                        manifest_filename,
+	                        FILE_STREAM_OPEN_READ );
+#endif
+	if( manifest_file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open manifest file.",
+		 function );
+
+		return( -1 );
+	}
+	while( file_stream_at_end(
+	        manifest_file_stream ) == 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( file_stream_get_string_wide(
+		     manifest_file_stream,
+		     line,
+		     SCRUB_HANDLE_MAXIMUM_LINE_SIZE ) == NULL )
+#else
+		if( file_stream_get_string(
+		     manifest_file_stream,
+		     line,
+		     SCRUB_HANDLE_MAXIMUM_LINE_SIZE ) == NULL )
+#endif
+		{
+			if( file_stream_at_end(
+			     manifest_file_stream ) != 0 )
+			{
+				break;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read line: %d from manifest file.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		line_length = system_string_length(
+		               line );
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (system_character_t) '\n' ) )
+		{
+			line_length -= 1;
+		}
+		else if( file_stream_at_end(
+		          manifest_file_stream ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid line: %d in manifest file value exceeds maximum.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (system_character_t) '\r' ) )
+		{
+			line_length -= 1;
+		}
+		if( ( line_length > 0 )
+		 && ( line[ 0 ] != (system_character_t) '#' ) )
+		{
+			result = scrub_handle_append_manifest_entry(
+			          scrub_handle,
+			          line,
+			          line_length,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append manifest entry of line: %d.",
+				 function,
+				 line_number );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported line: %d in manifest file.",
+				 function,
+				 line_number );
+
+				goto on_error;
+			}
+		}
+		line_number++;
+	}
+	if( file_stream_close(
+	     manifest_file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close manifest file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	file_stream_close(
+	 manifest_file_stream );
+
+	return( -1 );
+}
+
+/* Reads the progress of previous scrub runs
+ * The progress file contains a single line: "<next manifest entry index> <number of cycles>"
+ * The progress filename is retained so that the progress can be written after every source
+ * Returns 1 if successful, 0 if no progress file exists or -1 on error
+ */
+int scrub_handle_read_progress(
+     scrub_handle_t *scrub_handle,
+     const system_character_t *progress_filename,
+     libcerror_error_t **error )
+{
+	system_character_t line[ 64 ];
+
+	FILE *progress_file_stream    = NULL;
+	static char *function         = "scrub_handle_read_progress";
+	size_t line_index             = 0;
+	size_t line_length            = 0;
+	uint64_t value_64bit          = 0;
+	int next_manifest_entry_index = 0;
+	int value_index               = 0;
+
+	if( scrub_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scrub handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( progress_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid progress filename.",
+		 function );
+
+		return( -1 );
+	}
+	scrub_handle->progress_filename = progress_filename;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	progress_file_stream = file_stream_open_wide(
+	                        progress_filename,
+	                        _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	progress_file_stream = file_stream_open(
+	                        progress_filename,
+	                        FILE_STREAM_OPEN_READ );
+#endif
+	if( progress_file_stream == NULL )
+	{
+		/* The first scrub run starts without a progress file
+		 */
+		return( 0 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( file_stream_get_string_wide(
+	     progress_file_stream,
+	     line,
+	     64 ) == NULL )
+#else
+	if( file_stream_get_string(
+	     progress_file_stream,
+	     line,
+	     64 ) == NULL )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read progress file.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     progress_file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close progress file.",
+		 function );
+
+		return( -1 );
+	}
+	line_length = system_string_length(
+	               line );
+
+	for( value_index = 0;
+	     value_index < 2;
+	     value_index++ )
+	{
+		if( ( line_index >= line_length )
+		 || ( line[ line_index ] < (system_character_t) '0' )
+		 || ( line[ line_index ] > (system_character_t) '9' ) )
+		{
+			break;
+		}
+		value_64bit = 0;
+
+		while( ( line_index < line_length )
+		    && ( line[ line_index ] >= (system_character_t) '0' )
+		    && ( line[ line_index ] <= (system_character_t) '9' ) )
+		{
+			value_64bit *= 10;
+			value_64bit += (uint64_t) ( line[ line_index ] - (system_character_t) '0' );
+
+			if( value_64bit > (uint64_t) UINT32_MAX )
+			{
+				break;
+			}
+			line_index++;
+		}
+		if( value_64bit > (uint64_t) INT32_MAX )
+		{
+			break;
+		}
+		if( value_index == 0 )
+		{
+			next_manifest_entry_index = (int) value_64bit;
+		}
+		else
+		{
+			scrub_handle->number_of_cycles = (uint32_t) value_64bit;
+		}
+		while( ( line_index < line_length )
+		    && ( line[ line_index ] == (system_character_t) ' ' ) )
+		{
+			line_index++;
+		}
+	}
+	if( value_index != 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported progress file.",
+		 function );
+
+		return( -1 );
+	}
+	/* Start a new cycle if the manifest was changed to contain fewer entries
+	 */
+	if( next_manifest_entry_index >= scrub_handle->number_of_manifest_entries )
+	{
+		next_manifest_entry_index = 0;
+	}
+	scrub_handle->next_manifest_entry_index = next_manifest_entry_index;
+
+	return( 1 );
+
+on_error:
+	file_stream_close(
+	 progress_file_stream );
+
+	return( -1 );
+}
+
+/* Writes the progress of the scrub run
+ * Returns 1 if successful, 0 if no progress file was set or -1 on error
+ */
+int scrub_handle_write_progress(
+     scrub_handle_t *scrub_handle,
+     libcerror_error_t **error )
+{
+	FILE *progress_file_stream = NULL;
+	static char *function      = "scrub_handle_write_progress";
+
+	if( scrub_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scrub handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scrub_handle->progress_filename == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	progress_file_stream = file_stream_open_wide(
+	                        scrub_handle->progress_filename,
+	                        _SYSTEM_STRING( FILE_STREAM_OPEN_WRITE ) );
+#else
+	progress_file_stream = file_stream_open(
+	                        scrub_handle->progress_filename,
+	                        FILE_STREAM_OPEN_WRITE );
+#endif
+	if( progress_file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open progress file.",
+		 function );
+
+		return( -1 );
+	}
+	if( fprintf(
+	     progress_file_stream,
+	     "%d %" PRIu32 "\n",
+	     scrub_handle->next_manifest_entry_index,
+	     scrub_handle->number_of_cycles ) < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write progress file.",
+		 function );
+
+		file_stream_close(
+		 progress_file_stream );
+
+		return( -1 );
+	}
+	if( file_stream_close(
+	     progress_file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close progress file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the result of scrubbing a source to a stream
+ */
+void scrub_handle_entry_fprint(
+      scrub_manifest_entry_t *manifest_entry,
+      const system_character_t *calculated_digest_hash_string,
+      int result,
+      FILE *stream )
+{
+	fprintf(
+	 stream,
+	 "Source:\t\t\t\t\t%" PRIs_SYSTEM "\n",
+	 manifest_entry->filename );
+
+	fprintf(
+	 stream,
+	 "Stored digest hash:\t\t\t%" PRIs_SYSTEM "\n",
+	 manifest_entry->digest_hash_string );
+
+	if( calculated_digest_hash_string != NULL )
+	{
+		fprintf(
+		 stream,
+		 "Calculated digest hash:\t\t\t%" PRIs_SYSTEM "\n",
+		 calculated_digest_hash_string );
+	}
+	if( result == 1 )
+	{
+		fprintf(
+		 stream,
+		 "Scrub:\t\t\t\t\tSUCCESS\n\n" );
+	}
+	else if( result == 0 )
+	{
+		fprintf(
+		 stream,
+		 "Scrub:\t\t\t\t\tDIGEST MISMATCH\n\n" );
+	}
+	else
+	{
+		fprintf(
+		 stream,
+		 "Scrub:\t\t\t\t\tFAILURE\n\n" );
+	}
+}
+
+/* Scrubs the source of a manifest entry
+ * The digest hash of the source is calculated and compared against the digest hash stored in the manifest
+ * A source that cannot be read is recorded as a failure and does not fail the scrub
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int scrub_handle_scrub_entry(
+     scrub_handle_t *scrub_handle,
+     scrub_manifest_entry_t *manifest_entry,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *scrub_error                    = NULL;
+	system_character_t *calculated_digest_hash_string = NULL;
+	static char *function                             = "scrub_handle_scrub_entry";
+	int result                                        = 0;
+
+	if( scrub_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scrub handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scrub_handle->verification_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scrub handle - verification handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( manifest_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle_initialize(
+	     &( scrub_handle->verification_handle ),
+	     (uint8_t) ( manifest_entry->digest_type == SCRUB_HANDLE_DIGEST_TYPE_MD5 ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create verification handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The results are printed by the scrub handle
+	 */
+	scrub_handle->verification_handle->notify_stream                  = NULL;
+	scrub_handle->verification_handle->process_buffer_size            = scrub_handle->process_buffer_size;
+	scrub_handle->verification_handle->rate_limiter                   = scrub_handle->rate_limiter;
+	scrub_handle->verification_handle->telemetry_descriptor           = scrub_handle->telemetry_descriptor;
+	scrub_handle->verification_handle->telemetry_descriptor_is_socket = scrub_handle->telemetry_descriptor_is_socket;
+
+	if( manifest_entry->digest_type == SCRUB_HANDLE_DIGEST_TYPE_SHA1 )
+	{
+		result = verification_handle_set_additional_digest_types(
+		          scrub_handle->verification_handle,
+		          _SYSTEM_STRING( "sha1" ),
+		          error );
+	}
+	else if( manifest_entry->digest_type == SCRUB_HANDLE_DIGEST_TYPE_SHA256 )
+	{
+		result = verification_handle_set_additional_digest_types(
+		          scrub_handle->verification_handle,
+		          _SYSTEM_STRING( "sha256" ),
+		          error );
+	}
+	else
+	{
+		result = 1;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set additional digest types.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle_set_use_direct_io(
+	     scrub_handle->verification_handle,
+	     scrub_handle->use_direct_io,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set use direct IO.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle_open_input(
+	     scrub_handle->verification_handle,
+	     manifest_entry->filename,
+	     &scrub_error ) != 1 )
+	{
+		libcerror_error_set(
+		 &scrub_error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open source: %" PRIs_SYSTEM ".",
+		 function,
+		 manifest_entry->filename );
+
+		result = -1;
+	}
+	else
+	{
+		result = verification_handle_verify_input(
+		          scrub_handle->verification_handle,
+		          0,
+		          NULL,
+		          &scrub_error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &scrub_error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scrub source: %" PRIs_SYSTEM ".",
+			 function,
+			 manifest_entry->filename );
+
+			result = -1;
+		}
+		if( verification_handle_close(
+		     scrub_handle->verification_handle,
+		     ( result == 1 ) ? &scrub_error : NULL ) != 0 )
+		{
+			if( result == 1 )
+			{
+				libcerror_error_set(
+				 &scrub_error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close source: %" PRIs_SYSTEM ".",
+				 function,
+				 manifest_entry->filename );
+			}
+			result = -1;
+		}
+	}
+	if( scrub_error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 scrub_error );
+		libcerror_error_free(
+		 &scrub_error );
+	}
+	if( scrub_handle->verification_handle->abort != 0 )
+	{
+		/* Sources that were aborted are not scrubbed and are scrubbed again by the next run
+		 */
+		result = 0;
+	}
+	else
+	{
+		if( result == 1 )
+		{
+			switch( manifest_entry->digest_type )
+			{
+				case SCRUB_HANDLE_DIGEST_TYPE_MD5:
+					calculated_digest_hash_string = scrub_handle->verification_handle->calculated_md5_hash_string;
+					break;
+
+				case SCRUB_HANDLE_DIGEST_TYPE_SHA1:
+					calculated_digest_hash_string = scrub_handle->verification_handle->calculated_sha1_hash_string;
+					break;
+
+				case SCRUB_HANDLE_DIGEST_TYPE_SHA256:
+					calculated_digest_hash_string = scrub_handle->verification_handle->calculated_sha256_hash_string;
+					break;
+			}
+			if( ( calculated_digest_hash_string == NULL )
+			 || ( system_string_compare_no_case(
+			       calculated_digest_hash_string,
+			       manifest_entry->digest_hash_string,
+			       system_string_length(
+			        manifest_entry->digest_hash_string ) + 1 ) != 0 ) )
+			{
+				result = 0;
+			}
+		}
+		if( result == 1 )
+		{
+			scrub_handle->number_of_scrubbed_sources += 1;
+		}
+		else if( result == 0 )
+		{
+			scrub_handle->number_of_mismatched_sources += 1;
+		}
+		else
+		{
+			scrub_handle->number_of_failed_sources += 1;
+		}
+		if( scrub_handle->notify_stream != NULL )
+		{
+			scrub_handle_entry_fprint(
+			 manifest_entry,
+			 calculated_digest_hash_string,
+			 result,
+			 scrub_handle->notify_stream );
+		}
+		if( ( log_handle != NULL )
+		 && ( log_handle->log_stream != NULL ) )
+		{
+			scrub_handle_entry_fprint(
+			 manifest_entry,
+			 calculated_digest_hash_string,
+			 result,
+			 log_handle->log_stream );
+		}
+		result = 1;
+	}
+	if( verification_handle_free(
+	     &( scrub_handle->verification_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free verification handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( scrub_handle->verification_handle != NULL )
+	{
+		verification_handle_free(
+		 &( scrub_handle->verification_handle ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scrubs the sources in the manifest, starting at the source after the last one scrubbed
+ * by the previous run, until every source was scrubbed once or the maximum duration was exceeded
+ * The progress is written after every source so that a scrub cycle can be spread over multiple runs
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int scrub_handle_scrub_sources(
+     scrub_handle_t *scrub_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function          = "scrub_handle_scrub_sources";
+	int64_t current_time           = 0;
+	int64_t start_time             = 0;
+	int number_of_sources_scrubbed = 0;
+	int result                     = 0;
+
+	if( scrub_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scrub handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scrub_handle->rate_limiter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scrub handle - rate limiter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The rate limiter is also used without limits to back off when the read latency rises
+	 */
+	if( rate_limiter_initialize(
+	     &( scrub_handle->rate_limiter ),
+	     scrub_handle->maximum_bytes_per_second,
+	     scrub_handle->maximum_reads_per_second,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create rate limiter.",
+		 function );
+
+		goto on_error;
+	}
+	if( rate_limiter_get_current_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		goto on_error;
+	}
+	while( number_of_sources_scrubbed < scrub_handle->number_of_manifest_entries )
+	{
+		if( scrub_handle->abort != 0 )
+		{
+			break;
+		}
+		if( scrub_handle->maximum_duration > 0 )
+		{
+			if( rate_limiter_get_current_time(
+			     &current_time,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve current time.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( current_time - start_time ) >= ( (int64_t) scrub_handle->maximum_duration * 1000000 ) )
+			{
+				break;
+			}
+		}
+		result = scrub_handle_scrub_entry(
+		          scrub_handle,
+		          &( scrub_handle->manifest_entries[ scrub_handle->next_manifest_entry_index ] ),
+		          log_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scrub manifest entry: %d.",
+			 function,
+			 scrub_handle->next_manifest_entry_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		number_of_sources_scrubbed++;
+
+		scrub_handle->next_manifest_entry_index += 1;
+
+		if( scrub_handle->next_manifest_entry_index >= scrub_handle->number_of_manifest_entries )
+		{
+			scrub_handle->next_manifest_entry_index = 0;
+			scrub_handle->number_of_cycles         += 1;
+		}
+		if( scrub_handle_write_progress(
+		     scrub_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write progress.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( scrub_handle->notify_stream != NULL )
+	{
+		fprintf(
+		 scrub_handle->notify_stream,
+		 "Number of sources scrubbed:\t\t%d of %d\n",
+		 number_of_sources_scrubbed,
+		 scrub_handle->number_of_manifest_entries );
+
+		fprintf(
+		 scrub_handle->notify_stream,
+		 "Number of completed scrub cycles:\t%" PRIu32 "\n",
+		 scrub_handle->number_of_cycles );
+
+		fprintf(
+		 scrub_handle->notify_stream,
+		 "Time spent rate limiting:\t\t%" PRIi64 " second(s)\n\n",
+		 scrub_handle->rate_limiter->total_wait_time / 1000000 );
+	}
+	if( rate_limiter_free(
+	     &( scrub_handle->rate_limiter ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free rate limiter.",
+		 function );
+
+		goto on_error;
+	}
+	if( scrub_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( scrub_handle->rate_limiter != NULL )
+	{
+		rate_limiter_free(
+		 &( scrub_handle->rate_limiter ),
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,230 @@
+/*
+ * Scrub handle
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _SCRUB_HANDLE_H )
+#define _SCRUB_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "log_handle.h"
+#include "odrawtools_libcerror.h"
+#include "rate_limiter.h"
+#include "verification_handle.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the largest digest hash string, which is SHA256, including the end-of-string character
+ */
+#define SCRUB_HANDLE_DIGEST_HASH_STRING_SIZE	65
+
+enum SCRUB_HANDLE_DIGEST_TYPES
+{
+	SCRUB_HANDLE_DIGEST_TYPE_MD5		= 1,
+	SCRUB_HANDLE_DIGEST_TYPE_SHA1		= 2,
+	SCRUB_HANDLE_DIGEST_TYPE_SHA256		= 3
+};
+
+typedef struct scrub_manifest_entry scrub_manifest_entry_t;
+
+struct scrub_manifest_entry
+{
+	/* The source filename
+	 */
+	system_character_t *filename;
+
+	/* The stored digest hash string
+	 */
+	system_character_t digest_hash_string[ SCRUB_HANDLE_DIGEST_HASH_STRING_SIZE ];
+
+	/* The digest type
+	 */
+	uint8_t digest_type;
+};
+
+typedef struct scrub_handle scrub_handle_t;
+
+struct scrub_handle
+{
+	/* The manifest entries
+	 */
+	scrub_manifest_entry_t *manifest_entries;
+
+	/* The number of manifest entries
+	 */
+	int number_of_manifest_entries;
+
+	/* The number of allocated manifest entries
+	 */
+	int maximum_number_of_manifest_entries;
+
+	/* The progress filename, which is referenced from the caller
+	 */
+	const system_character_t *progress_filename;
+
+	/* The index of the next manifest entry to scrub
+	 */
+	int next_manifest_entry_index;
+
+	/* The number of completed scrub cycles
+	 */
+	uint32_t number_of_cycles;
+
+	/* The process buffer size
+	 */
+	size_t process_buffer_size;
+
+	/* Value to indicate if direct IO should be used to read the data files
+	 */
+	uint8_t use_direct_io;
+
+	/* The maximum number of bytes per second, 0 represents no limit
+	 */
+	uint64_t maximum_bytes_per_second;
+
+	/* The maximum number of reads per second, 0 represents no limit
+	 */
+	uint32_t maximum_reads_per_second;
+
+	/* The maximum duration of a scrub run in seconds, 0 represents no limit
+	 */
+	uint32_t maximum_duration;
+
+	/* The rate limiter
+	 */
+	rate_limiter_t *rate_limiter;
+
+	/* The telemetry descriptor, which is -1 if no telemetry is emitted
+	 * The descriptor is not managed by the scrub handle
+	 */
+	int telemetry_descriptor;
+
+	/* Value to indicate the telemetry descriptor is a socket
+	 */
+	uint8_t telemetry_descriptor_is_socket;
+
+	/* The verification handle of the source that is being scrubbed
+	 */
+	verification_handle_t *verification_handle;
+
+	/* The number of sources scrubbed
+	 */
+	int number_of_scrubbed_sources;
+
+	/* The number of sources of which the digest did not match the manifest
+	 */
+	int number_of_mismatched_sources;
+
+	/* The number of sources that could not be read
+	 */
+	int number_of_failed_sources;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int scrub_handle_initialize(
+     scrub_handle_t **scrub_handle,
+     libcerror_error_t **error );
+
+int scrub_handle_free(
+     scrub_handle_t **scrub_handle,
+     libcerror_error_t **error );
+
+int scrub_handle_signal_abort(
+     scrub_handle_t *scrub_handle,
+     libcerror_error_t **error );
+
+int scrub_handle_decimal_string_copy_to_32bit(
+     const system_character_t *string,
+     uint32_t *value_32bit );
+
+int scrub_handle_set_maximum_bytes_per_second(
+     scrub_handle_t *scrub_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int scrub_handle_set_maximum_reads_per_second(
+     scrub_handle_t *scrub_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int scrub_handle_set_maximum_duration(
+     scrub_handle_t *scrub_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int scrub_handle_set_idle_io_priority(
+     scrub_handle_t *scrub_handle,
+     libcerror_error_t **error );
+
+int scrub_handle_append_manifest_entry(
+     scrub_handle_t *scrub_handle,
+     const system_character_t *line,
+     size_t line_length,
+     libcerror_error_t **error );
+
+int scrub_handle_read_manifest(
+     scrub_handle_t *scrub_handle,
+     const system_character_t *manifest_filename,
+     libcerror_error_t **error );
+
+int scrub_handle_read_progress(
+     scrub_handle_t *scrub_handle,
+     const system_character_t *progress_filename,
+     libcerror_error_t **error );
+
+int scrub_handle_write_progress(
+     scrub_handle_t *scrub_handle,
+     libcerror_error_t **error );
+
+void scrub_handle_entry_fprint(
+      scrub_manifest_entry_t *manifest_entry,
+      const system_character_t *calculated_digest_hash_string,
+      int result,
+      FILE *stream );
+
+int scrub_handle_scrub_entry(
+     scrub_handle_t *scrub_handle,
+     scrub_manifest_entry_t *manifest_entry,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int scrub_handle_scrub_sources(
+     scrub_handle_t *scrub_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SCRUB_HANDLE_H ) */
+
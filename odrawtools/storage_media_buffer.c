@@ -107,12 +107,11 @@ int storage_media_buffer_initialize(
 	{
 		raw_buffer_size = size;
 
-/* TODO can low level functions and direct IO be combined ? */
 #if defined( memory_allocate_aligned )
 		if( memory_allocate_aligned(
 		     (void **) &( ( *buffer )->raw_buffer ),
 		     raw_buffer_size,
-		     512 ) != 0 )
+		     STORAGE_MEDIA_BUFFER_ALIGNMENT ) != 0 )
 		{
 			libcerror_error_set(
 			 error,
@@ -196,6 +195,7 @@ int storage_media_buffer_free(
 }
 
 /* Resizes a buffer
+ * The data in the buffer is not preserved, so that the buffer remains aligned
  * Returns 1 if successful or -1 on error
  */
 int storage_media_buffer_resize(
@@ -203,7 +203,7 @@ int storage_media_buffer_resize(
      size_t size,
      libcerror_error_t **error )
 {
-	void *reallocation    = NULL;
+	uint8_t *raw_buffer   = NULL;
 	static char *function = "storage_media_buffer_resize";
 
 	if( buffer == NULL )
@@ -219,22 +219,44 @@ int storage_media_buffer_resize(
 	}
 	if( size > buffer->raw_buffer_size )
 	{
-		reallocation = memory_reallocate(
-				buffer->raw_buffer,
-				sizeof( uint8_t ) * size );
+#if defined( memory_allocate_aligned )
+		if( memory_allocate_aligned(
+		     (void **) &raw_buffer,
+		     size,
+		     STORAGE_MEDIA_BUFFER_ALIGNMENT ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create aligned raw buffer.",
+			 function );
 
-		if( reallocation == NULL )
+			return( -1 );
+		}
+#else
+		raw_buffer = (uint8_t *) memory_allocate(
+		                          sizeof( uint8_t ) * size );
+
+		if( raw_buffer == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_MEMORY,
 			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to reallocate read buffer.",
+			 "%s: unable to create raw buffer.",
 			 function );
 
 			return( -1 );
 		}
-		buffer->raw_buffer           = (uint8_t *) reallocation;
+#endif /* defined( memory_allocate_aligned ) */
+
+		if( buffer->raw_buffer != NULL )
+		{
+			memory_free(
+			 buffer->raw_buffer );
+		}
+		buffer->raw_buffer           = raw_buffer;
 		buffer->raw_buffer_size      = size;
 		buffer->raw_buffer_data_size = 0;
 	}
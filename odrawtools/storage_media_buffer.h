@@ -31,6 +31,10 @@
 extern "C" {
 #endif
 
+/* The alignment of the raw buffer, which is suitable for direct IO
+ */
+#define STORAGE_MEDIA_BUFFER_ALIGNMENT		4096
+
 typedef struct storage_media_buffer storage_media_buffer_t;
 
 struct storage_media_buffer
@@ -46,6 +50,10 @@ struct storage_media_buffer
 	/* The size of the data in the raw buffer
 	 */
 	size_t raw_buffer_data_size;
+
+	/* The offset of the data in the storage media
+	 */
+	off64_t storage_media_offset;
 };
 
 int storage_media_buffer_initialize(
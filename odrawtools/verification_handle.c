@@ -155,8 +155,9 @@ int verification_handle_initialize(
 			goto on_error;
 		}
 	}
-	( *verification_handle )->calculate_md5 = calculate_md5;
-	( *verification_handle )->notify_stream = VERIFICATION_HANDLE_NOTIFY_STREAM;
+	( *verification_handle )->calculate_md5        = calculate_md5;
+	( *verification_handle )->notify_stream        = VERIFICATION_HANDLE_NOTIFY_STREAM;
+	( *verification_handle )->telemetry_descriptor = -1;
 
 	return( 1 );
 
@@ -287,6 +288,11 @@ int verification_handle_free(
 			memory_free(
 			 ( *verification_handle )->calculated_sha256_hash_string );
 		}
+		if( ( *verification_handle )->read_errors != NULL )
+		{
+			memory_free(
+			 ( *verification_handle )->read_errors );
+		}
 		memory_free(
 		 *verification_handle );
 
@@ -483,6 +489,191 @@ ssize_t verification_handle_prepare_read_buffer(
 	return( process_count );
 }
 
+/* Reads a buffer at a specific offset from the input of the verification handle
+ * A read that fails is split in two sector aligned halves that are read separately,
+ * until the sectors that cannot be read are isolated. These sectors are zero-filled
+ * and recorded as read errors
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_read_damaged_buffer(
+     verification_handle_t *verification_handle,
+     uint8_t *buffer,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error = NULL;
+	static char *function         = "verification_handle_read_damaged_buffer";
+	size_t split_size             = 0;
+	ssize_t read_count            = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verification handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	if( libodraw_handle_seek_offset(
+	     verification_handle->input_handle,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	read_count = libodraw_handle_read_buffer(
+	              verification_handle->input_handle,
+	              buffer,
+	              size,
+	              &read_error );
+
+	if( read_count == (ssize_t) size )
+	{
+		return( 1 );
+	}
+	if( read_count == -1 )
+	{
+		libcerror_error_free(
+		 &read_error );
+
+		if( size > verification_handle->bytes_per_sector )
+		{
+			split_size = ( size / 2 ) - ( ( size / 2 ) % verification_handle->bytes_per_sector );
+
+			if( split_size == 0 )
+			{
+				split_size = verification_handle->bytes_per_sector;
+			}
+			if( verification_handle_read_damaged_buffer(
+			     verification_handle,
+			     buffer,
+			     offset,
+			     split_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offset,
+				 offset );
+
+				return( -1 );
+			}
+			if( verification_handle_read_damaged_buffer(
+			     verification_handle,
+			     &( buffer[ split_size ] ),
+			     offset + (off64_t) split_size,
+			     size - split_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offset + (off64_t) split_size,
+				 offset + (off64_t) split_size );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+	}
+	else
+	{
+		/* The data missing after a short read cannot be isolated any further
+		 */
+		buffer += read_count;
+		offset += (off64_t) read_count;
+		size   -= (size_t) read_count;
+	}
+	if( memory_set(
+	     buffer,
+	     0,
+	     size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle_append_read_error(
+	     verification_handle,
+	     offset,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append read error.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Reads a buffer from the input of the verification handle
  * Returns the number of bytes written or -1 on error
  */
@@ -494,6 +685,8 @@ ssize_t verification_handle_read_buffer(
 {
 	static char *function = "verification_handle_read_buffer";
 	ssize_t read_count    = 0;
+	int64_t end_time      = 0;
+	int64_t start_time    = 0;
 
 	if( verification_handle == NULL )
 	{
@@ -517,22 +710,124 @@ ssize_t verification_handle_read_buffer(
 
 		return( -1 );
 	}
-	read_count = libodraw_handle_read_buffer(
-                      verification_handle->input_handle,
-                      storage_media_buffer->raw_buffer,
-                      read_size,
-	              error );
+	if( verification_handle->rate_limiter != NULL )
+	{
+		if( rate_limiter_wait(
+		     verification_handle->rate_limiter,
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to wait for rate limiter.",
+			 function );
 
-	if( read_count == -1 )
+			return( -1 );
+		}
+		if( rate_limiter_get_current_time(
+		     &start_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve start time.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( verification_handle->zero_on_read_error == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read storage media buffer.",
-		 function );
+		read_count = libodraw_handle_read_buffer(
+		              verification_handle->input_handle,
+		              storage_media_buffer->raw_buffer,
+		              read_size,
+		              error );
 
-		return( -1 );
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read storage media buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		/* The read starts at the offset directly after the previous read
+		 * and continues at that offset plus the read size regardless of
+		 * the number of sectors that could not be read
+		 */
+		if( verification_handle_read_damaged_buffer(
+		     verification_handle,
+		     storage_media_buffer->raw_buffer,
+		     verification_handle->last_offset_read,
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read storage media buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( libodraw_handle_seek_offset(
+		     verification_handle->input_handle,
+		     verification_handle->last_offset_read + (off64_t) read_size,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset after storage media buffer.",
+			 function );
+
+			return( -1 );
+		}
+		read_count = (ssize_t) read_size;
+	}
+	if( verification_handle->rate_limiter != NULL )
+	{
+		if( rate_limiter_get_current_time(
+		     &end_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve end time.",
+			 function );
+
+			return( -1 );
+		}
+		if( rate_limiter_update_latency(
+		     verification_handle->rate_limiter,
+		     end_time - start_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update read latency of rate limiter.",
+			 function );
+
+			return( -1 );
+		}
 	}
 	storage_media_buffer->raw_buffer_data_size = (size_t) read_count;
 
@@ -989,6 +1284,36 @@ int verification_handle_verify_input(
 
 		goto on_error;
 	}
+	if( verification_handle->zero_on_read_error != 0 )
+	{
+		if( libodraw_handle_get_bytes_per_sector(
+		     verification_handle->input_handle,
+		     &( verification_handle->bytes_per_sector ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve bytes per sector.",
+			 function );
+
+			goto on_error;
+		}
+		if( verification_handle->bytes_per_sector == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid bytes per sector value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	verification_handle->number_of_read_errors = 0;
+
 	if( verification_handle->process_buffer_size == 0 )
 	{
 		process_buffer_size = 32768;
@@ -1042,6 +1367,24 @@ int verification_handle_verify_input(
 
 		goto on_error;
 	}
+	if( verification_handle->telemetry_descriptor >= 0 )
+	{
+		if( process_status_set_telemetry_descriptor(
+		     process_status,
+		     verification_handle->telemetry_descriptor,
+		     verification_handle->telemetry_descriptor_is_socket,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set telemetry descriptor.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( process_status_start(
 	     process_status,
 	     error ) != 1 )
@@ -1063,6 +1406,10 @@ int verification_handle_verify_input(
 		{
 			read_size = (size_t) ( media_size - verify_count );
 		}
+		PROCESS_STATUS_SET_INT(
+		 process_status->phase,
+		 PROCESS_STATUS_PHASE_IO );
+
 		read_count = verification_handle_read_buffer(
 		              verification_handle,
 		              storage_media_buffer,
@@ -1091,6 +1438,10 @@ int verification_handle_verify_input(
 
 			goto on_error;
 		}
+		PROCESS_STATUS_SET_INT(
+		 process_status->phase,
+		 PROCESS_STATUS_PHASE_COMPUTE );
+
 		process_count = verification_handle_prepare_read_buffer(
 		                 verification_handle,
 		                 storage_media_buffer,
@@ -1230,23 +1581,41 @@ int verification_handle_verify_input(
 	}
 	if( verification_handle->abort == 0 )
 	{
-		if( verification_handle_hash_values_fprint(
-		     verification_handle,
-		     verification_handle->notify_stream,
-		     error ) != 1 )
+		if( verification_handle->notify_stream != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print hash values.",
-			 function );
+			if( verification_handle_hash_values_fprint(
+			     verification_handle,
+			     verification_handle->notify_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print hash values.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
+			fprintf(
+			 verification_handle->notify_stream,
+			 "\n" );
+
+			if( verification_handle_read_errors_fprint(
+			     verification_handle,
+			     verification_handle->notify_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print read errors.",
+				 function );
+
+				goto on_error;
+			}
 		}
-		fprintf(
-		 verification_handle->notify_stream,
-		 "\n" );
 
 		if( log_handle != NULL )
 		{
@@ -1264,6 +1633,20 @@ int verification_handle_verify_input(
 
 				goto on_error;
 			}
+			if( verification_handle_read_errors_fprint(
+			     verification_handle,
+			     log_handle->log_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print read errors in log handle.",
+				 function );
+
+				goto on_error;
+			}
 		}
 	}
 /* TODO use the information file to retrieve the stored hashes */
@@ -1604,6 +1987,167 @@ on_error:
 	return( -1 );
 }
 
+/* Sets if direct IO should be used to read the data files
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_set_use_direct_io(
+     verification_handle_t *verification_handle,
+     uint8_t use_direct_io,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_set_use_direct_io";
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libodraw_handle_set_use_direct_io(
+	     verification_handle->input_handle,
+	     use_direct_io,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set use direct IO in input handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets if data that cannot be read should be zero-filled
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_set_zero_on_read_error(
+     verification_handle_t *verification_handle,
+     uint8_t zero_on_read_error,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_set_zero_on_read_error";
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	verification_handle->zero_on_read_error = zero_on_read_error;
+
+	return( 1 );
+}
+
+/* Appends a read error
+ * A read error that directly follows the previous read error is merged with it
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_append_read_error(
+      verification_handle_t *verification_handle,
+      off64_t start_offset,
+      size_t number_of_bytes,
+      libcerror_error_t **error )
+{
+	verification_handle_read_error_t *read_error  = NULL;
+	verification_handle_read_error_t *read_errors = NULL;
+	static char *function                         = "verification_handle_append_read_error";
+	int maximum_number_of_read_errors             = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid start offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->number_of_read_errors > 0 )
+	{
+		read_error = &( verification_handle->read_errors[ verification_handle->number_of_read_errors - 1 ] );
+
+		if( ( read_error->start_offset + (off64_t) read_error->number_of_bytes ) == start_offset )
+		{
+			read_error->number_of_bytes += number_of_bytes;
+
+			return( 1 );
+		}
+	}
+	if( verification_handle->number_of_read_errors >= verification_handle->maximum_number_of_read_errors )
+	{
+		if( verification_handle->maximum_number_of_read_errors == 0 )
+		{
+			maximum_number_of_read_errors = 16;
+		}
+		else if( verification_handle->maximum_number_of_read_errors < ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 / (int) sizeof( verification_handle_read_error_t ) ) )
+		{
+			maximum_number_of_read_errors = verification_handle->maximum_number_of_read_errors * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of read errors value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		read_errors = (verification_handle_read_error_t *) memory_reallocate(
+		                                                     verification_handle->read_errors,
+		                                                     sizeof( verification_handle_read_error_t ) * maximum_number_of_read_errors );
+
+		if( read_errors == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize read errors.",
+			 function );
+
+			return( -1 );
+		}
+		verification_handle->read_errors                   = read_errors;
+		verification_handle->maximum_number_of_read_errors = maximum_number_of_read_errors;
+	}
+	read_error = &( verification_handle->read_errors[ verification_handle->number_of_read_errors ] );
+
+	read_error->start_offset    = start_offset;
+	read_error->number_of_bytes = (size64_t) number_of_bytes;
+
+	verification_handle->number_of_read_errors += 1;
+
+	return( 1 );
+}
+
 /* Print the hash values to a stream
  * Returns 1 if successful or -1 on error
  */
@@ -1660,3 +2204,86 @@ int verification_handle_hash_values_fprint(
 	return( 1 );
 }
 
+/* Print the read errors to a stream
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_read_errors_fprint(
+     verification_handle_t *verification_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	verification_handle_read_error_t *read_error = NULL;
+	static char *function                        = "verification_handle_read_errors_fprint";
+	uint64_t first_sector                        = 0;
+	uint64_t last_sector                         = 0;
+	int read_error_index                         = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->number_of_read_errors == 0 )
+	{
+		return( 1 );
+	}
+	if( verification_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verification handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "Read errors during verification:\n" );
+
+	fprintf(
+	 stream,
+	 "\ttotal number: %d\n",
+	 verification_handle->number_of_read_errors );
+
+	for( read_error_index = 0;
+	     read_error_index < verification_handle->number_of_read_errors;
+	     read_error_index++ )
+	{
+		read_error = &( verification_handle->read_errors[ read_error_index ] );
+
+		first_sector = (uint64_t) read_error->start_offset / verification_handle->bytes_per_sector;
+		last_sector  = ( (uint64_t) read_error->start_offset + read_error->number_of_bytes - 1 ) / verification_handle->bytes_per_sector;
+
+		fprintf(
+		 stream,
+		 "\tat sector(s): %" PRIu64 " - %" PRIu64 " (number: %" PRIu64 ")\n",
+		 first_sector,
+		 last_sector,
+		 last_sector - first_sector + 1 );
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	return( 1 );
+}
+
@@ -30,6 +30,7 @@
 #include "odrawtools_libcerror.h"
 #include "odrawtools_libodraw.h"
 #include "odrawtools_libhmac.h"
+#include "rate_limiter.h"
 #include "storage_media_buffer.h"
 
 #if defined( __cplusplus )
@@ -42,6 +43,19 @@ enum VERIFICATION_HANDLE_INPUT_FORMATS
 	VERIFICATION_HANDLE_INPUT_FORMAT_RAW	= (int) 'r'
 };
 
+typedef struct verification_handle_read_error verification_handle_read_error_t;
+
+struct verification_handle_read_error
+{
+	/* The start offset
+	 */
+	off64_t start_offset;
+
+	/* The number of bytes
+	 */
+	size64_t number_of_bytes;
+};
+
 typedef struct verification_handle verification_handle_t;
 
 struct verification_handle
@@ -106,6 +120,39 @@ struct verification_handle
 	 */
 	size_t process_buffer_size;
 
+	/* The number of bytes per sector, which is the granularity of the read errors
+	 */
+	uint32_t bytes_per_sector;
+
+	/* Value to indicate if data that cannot be read should be zero-filled
+	 */
+	uint8_t zero_on_read_error;
+
+	/* The read errors
+	 */
+	verification_handle_read_error_t *read_errors;
+
+	/* The number of read errors
+	 */
+	int number_of_read_errors;
+
+	/* The number of allocated read errors
+	 */
+	int maximum_number_of_read_errors;
+
+	/* The rate limiter of the reads, which is not managed by the verification handle
+	 */
+	rate_limiter_t *rate_limiter;
+
+	/* The telemetry descriptor, which is -1 if no telemetry is emitted
+	 * The descriptor is not managed by the verification handle
+	 */
+	int telemetry_descriptor;
+
+	/* Value to indicate the telemetry descriptor is a socket
+	 */
+	uint8_t telemetry_descriptor_is_socket;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -142,6 +189,13 @@ ssize_t verification_handle_prepare_read_buffer(
          storage_media_buffer_t *storage_media_buffer,
          libcerror_error_t **error );
 
+int verification_handle_read_damaged_buffer(
+     verification_handle_t *verification_handle,
+     uint8_t *buffer,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error );
+
 ssize_t verification_handle_read_buffer(
          verification_handle_t *verification_handle,
          storage_media_buffer_t *storage_media_buffer,
@@ -178,12 +232,27 @@ int verification_handle_set_additional_digest_types(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int verification_handle_set_use_direct_io(
+     verification_handle_t *verification_handle,
+     uint8_t use_direct_io,
+     libcerror_error_t **error );
+
+int verification_handle_set_zero_on_read_error(
+     verification_handle_t *verification_handle,
+     uint8_t zero_on_read_error,
+     libcerror_error_t **error );
+
 int verification_handle_append_read_error(
       verification_handle_t *verification_handle,
       off64_t start_offset,
       size_t number_of_bytes,
       libcerror_error_t **error );
 
+int verification_handle_read_errors_fprint(
+     verification_handle_t *verification_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
 int verification_handle_hash_values_fprint(
      verification_handle_t *verification_handle,
      FILE *stream,
@@ -0,0 +1,224 @@
+/*
+ * Python bindings module for libodraw (pyodraw)
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "pyodraw.h"
+#include "pyodraw_handle.h"
+#include "pyodraw_libcerror.h"
+#include "pyodraw_libodraw.h"
+#include "pyodraw_python.h"
+#include "pyodraw_unused.h"
+
+/* The pyodraw module methods
+ */
+PyMethodDef pyodraw_module_methods[] = {
+	{ "get_version",
+	  (PyCFunction) pyodraw_get_version,
+	  METH_NOARGS,
+	  "get_version() -> String\n"
+	  "\n"
+	  "Retrieves the version." },
+
+	{ "open",
+	  (PyCFunction) pyodraw_open_new_handle,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "open(filename, mode='r') -> Object\n"
+	  "\n"
+	  "Opens a handle." },
+
+	/* Sentinel */
+	{ NULL, NULL, 0, NULL }
+};
+
+/* Retrieves the pyodraw/libodraw version
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyodraw_get_version(
+           PyObject *self PYODRAW_ATTRIBUTE_UNUSED,
+           PyObject *arguments PYODRAW_ATTRIBUTE_UNUSED )
+{
+	const char *errors           = NULL;
+	const char *version_string   = NULL;
+	size_t version_string_length = 0;
+
+	PYODRAW_UNREFERENCED_PARAMETER( self )
+	PYODRAW_UNREFERENCED_PARAMETER( arguments )
+
+	Py_BEGIN_ALLOW_THREADS
+
+	version_string = libodraw_get_version();
+
+	Py_END_ALLOW_THREADS
+
+	version_string_length = narrow_string_length(
+	                         version_string );
+
+	/* Pass the string length to PyUnicode_DecodeUTF8
+	 * otherwise it makes the end of string character is part
+	 * of the string
+	 */
+	return( PyUnicode_DecodeUTF8(
+	         version_string,
+	         (Py_ssize_t) version_string_length,
+	         errors ) );
+}
+
+/* Creates a new handle object and opens it
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyodraw_open_new_handle(
+           PyObject *self PYODRAW_ATTRIBUTE_UNUSED,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *pyodraw_handle = NULL;
+
+	PYODRAW_UNREFERENCED_PARAMETER( self )
+
+	pyodraw_handle = pyodraw_handle_new();
+
+	if( pyodraw_handle == NULL )
+	{
+		return( NULL );
+	}
+	if( pyodraw_handle_open(
+	     (pyodraw_handle_t *) pyodraw_handle,
+	     arguments,
+	     keywords ) == NULL )
+	{
+		goto on_error;
+	}
+	return( pyodraw_handle );
+
+on_error:
+	Py_DecRef(
+	 pyodraw_handle );
+
+	return( NULL );
+}
+
+#if PY_MAJOR_VERSION >= 3
+
+/* The pyodraw module definition
+ */
+PyModuleDef pyodraw_module_definition = {
+	PyModuleDef_HEAD_INIT,
+
+	/* m_name */
+	"pyodraw",
+	/* m_doc */
+	"Python libodraw module (pyodraw).",
+	/* m_size */
+	-1,
+	/* m_methods */
+	pyodraw_module_methods,
+	/* m_reload */
+	NULL,
+	/* m_traverse */
+	NULL,
+	/* m_clear */
+	NULL,
+	/* m_free */
+	NULL,
+};
+
+#endif /* PY_MAJOR_VERSION >= 3 */
+
+/* Initializes the pyodraw module
+ */
+#if PY_MAJOR_VERSION >= 3
+PyMODINIT_FUNC PyInit_pyodraw(
+                void )
+#else
+PyMODINIT_FUNC initpyodraw(
+                void )
+#endif
+{
+	PyObject *module           = NULL;
+	PyGILState_STATE gil_state = 0;
+
+	/* Create the module
+	 * This function must be called before grabbing the GIL
+	 * otherwise the module will segfault on a version mismatch
+	 */
+#if PY_MAJOR_VERSION >= 3
+	module = PyModule_Create(
+	          &pyodraw_module_definition );
+#else
+	module = Py_InitModule3(
+	          "pyodraw",
+	          pyodraw_module_methods,
+	          "Python libodraw module (pyodraw)." );
+#endif
+	if( module == NULL )
+	{
+#if PY_MAJOR_VERSION >= 3
+		return( NULL );
+#else
+		return;
+#endif
+	}
+#if PY_VERSION_HEX < 0x03070000
+	PyEval_InitThreads();
+#endif
+	gil_state = PyGILState_Ensure();
+
+	/* Setup the handle type object
+	 */
+	pyodraw_handle_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyodraw_handle_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyodraw_handle_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "handle",
+	 (PyObject *) &pyodraw_handle_type_object );
+
+	PyGILState_Release(
+	 gil_state );
+
+#if PY_MAJOR_VERSION >= 3
+	return( module );
+#else
+	return;
+#endif
+
+on_error:
+	PyGILState_Release(
+	 gil_state );
+
+#if PY_MAJOR_VERSION >= 3
+	return( NULL );
+#else
+	return;
+#endif
+}
+
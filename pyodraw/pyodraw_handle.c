@@ -0,0 +1,1864 @@
+/*
+ * Python object wrapper of libodraw_handle_t
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <types.h>
+
+#include "pyodraw_error.h"
+#include "pyodraw_handle.h"
+#include "pyodraw_libcerror.h"
+#include "pyodraw_libodraw.h"
+#include "pyodraw_python.h"
+#include "pyodraw_unused.h"
+
+PyMethodDef pyodraw_handle_object_methods[] = {
+
+	{ "signal_abort",
+	  (PyCFunction) pyodraw_handle_signal_abort,
+	  METH_NOARGS,
+	  "signal_abort() -> None\n"
+	  "\n"
+	  "Signals the handle to abort the current activity." },
+
+	/* Functions to access the handle */
+
+	{ "open",
+	  (PyCFunction) pyodraw_handle_open,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "open(filename, mode='r') -> None\n"
+	  "\n"
+	  "Opens a handle." },
+
+	{ "open_data_files",
+	  (PyCFunction) pyodraw_handle_open_data_files,
+	  METH_NOARGS,
+	  "open_data_files() -> None\n"
+	  "\n"
+	  "Opens the data files." },
+
+	{ "close",
+	  (PyCFunction) pyodraw_handle_close,
+	  METH_NOARGS,
+	  "close() -> None\n"
+	  "\n"
+	  "Closes a handle." },
+
+	{ "read_buffer",
+	  (PyCFunction) pyodraw_handle_read_buffer,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer(size) -> Bytes\n"
+	  "\n"
+	  "Reads a buffer of data." },
+
+	{ "read_buffer_at_offset",
+	  (PyCFunction) pyodraw_handle_read_buffer_at_offset,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer_at_offset(size, offset) -> Bytes\n"
+	  "\n"
+	  "Reads a buffer of data at a specific offset." },
+
+	{ "readinto",
+	  (PyCFunction) pyodraw_handle_readinto,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "readinto(buffer) -> Integer\n"
+	  "\n"
+	  "Reads data directly into a writable buffer, such as a bytearray or memoryview." },
+
+	{ "readinto_at_offset",
+	  (PyCFunction) pyodraw_handle_readinto_at_offset,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "readinto_at_offset(buffer, offset) -> Integer\n"
+	  "\n"
+	  "Reads data at a specific offset directly into a writable buffer." },
+
+	{ "seek_offset",
+	  (PyCFunction) pyodraw_handle_seek_offset,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "seek_offset(offset, whence) -> None\n"
+	  "\n"
+	  "Seeks an offset within the data." },
+
+	{ "get_offset",
+	  (PyCFunction) pyodraw_handle_get_offset,
+	  METH_NOARGS,
+	  "get_offset() -> Integer\n"
+	  "\n"
+	  "Retrieves the current offset within the data." },
+
+	/* Some Pythonesque aliases */
+
+	{ "read",
+	  (PyCFunction) pyodraw_handle_read_buffer,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read(size) -> Bytes\n"
+	  "\n"
+	  "Reads a buffer of data." },
+
+	{ "seek",
+	  (PyCFunction) pyodraw_handle_seek_offset,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "seek(offset, whence) -> None\n"
+	  "\n"
+	  "Seeks an offset within the data." },
+
+	{ "tell",
+	  (PyCFunction) pyodraw_handle_get_offset,
+	  METH_NOARGS,
+	  "tell() -> Integer\n"
+	  "\n"
+	  "Retrieves the current offset within the data." },
+
+	/* Functions to access the media values */
+
+	{ "get_media_size",
+	  (PyCFunction) pyodraw_handle_get_media_size,
+	  METH_NOARGS,
+	  "get_media_size() -> Integer\n"
+	  "\n"
+	  "Retrieves the size of the media data." },
+
+	/* Functions to access the tracks and extents */
+
+	{ "get_number_of_tracks",
+	  (PyCFunction) pyodraw_handle_get_number_of_tracks,
+	  METH_NOARGS,
+	  "get_number_of_tracks() -> Integer\n"
+	  "\n"
+	  "Retrieves the number of tracks." },
+
+	{ "get_track",
+	  (PyCFunction) pyodraw_handle_get_track,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_track(track_index) -> Tuple\n"
+	  "\n"
+	  "Retrieves a specific track as a tuple of:\n"
+	  "(start_sector, number_of_sectors, type, data_file_index, data_file_start_sector)." },
+
+	{ "get_number_of_extents",
+	  (PyCFunction) pyodraw_handle_get_number_of_extents,
+	  METH_NOARGS,
+	  "get_number_of_extents() -> Integer\n"
+	  "\n"
+	  "Retrieves the number of extents in the media layout." },
+
+	{ "get_extent",
+	  (PyCFunction) pyodraw_handle_get_extent,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_extent(extent_index) -> Tuple\n"
+	  "\n"
+	  "Retrieves a specific extent of the media layout as a tuple of:\n"
+	  "(offset, size, data_file_index, data_file_offset, bytes_per_sector, track_type, flags)." },
+
+	/* Sentinel */
+	{ NULL, NULL, 0, NULL }
+};
+
+PyGetSetDef pyodraw_handle_object_get_set_definitions[] = {
+
+	{ "media_size",
+	  (getter) pyodraw_handle_get_media_size,
+	  (setter) 0,
+	  "The media size.",
+	  NULL },
+
+	{ "number_of_tracks",
+	  (getter) pyodraw_handle_get_number_of_tracks,
+	  (setter) 0,
+	  "The number of tracks.",
+	  NULL },
+
+	{ "number_of_extents",
+	  (getter) pyodraw_handle_get_number_of_extents,
+	  (setter) 0,
+	  "The number of extents.",
+	  NULL },
+
+	/* Sentinel */
+	{ NULL, NULL, NULL, NULL, NULL }
+};
+
+PyTypeObject pyodraw_handle_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyodraw.handle",
+	/* tp_basicsize */
+	sizeof( pyodraw_handle_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyodraw_handle_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT,
+	/* tp_doc */
+	"pyodraw handle object (wraps libodraw_handle_t)",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	0,
+	/* tp_iternext */
+	0,
+	/* tp_methods */
+	pyodraw_handle_object_methods,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	pyodraw_handle_object_get_set_definitions,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyodraw_handle_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Creates a new handle object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyodraw_handle_new(
+           void )
+{
+	pyodraw_handle_t *pyodraw_handle = NULL;
+	static char *function            = "pyodraw_handle_new";
+
+	pyodraw_handle = PyObject_New(
+	                  struct pyodraw_handle,
+	                  &pyodraw_handle_type_object );
+
+	if( pyodraw_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( pyodraw_handle_init(
+	     pyodraw_handle ) != 0 )
+	{
+		goto on_error;
+	}
+	return( (PyObject *) pyodraw_handle );
+
+on_error:
+	if( pyodraw_handle != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyodraw_handle );
+	}
+	return( NULL );
+}
+
+/* Initializes a handle object
+ * Returns 0 if successful or -1 on error
+ */
+int pyodraw_handle_init(
+     pyodraw_handle_t *pyodraw_handle )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyodraw_handle_init";
+
+	if( pyodraw_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure libodraw handle is set to NULL
+	 */
+	pyodraw_handle->handle = NULL;
+	pyodraw_handle->lock   = NULL;
+
+	if( libodraw_handle_initialize(
+	     &( pyodraw_handle->handle ),
+	     &error ) != 1 )
+	{
+		pyodraw_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to initialize handle.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	pyodraw_handle->lock = PyThread_allocate_lock();
+
+	if( pyodraw_handle->lock == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to allocate lock.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Frees a handle object
+ */
+void pyodraw_handle_free(
+      pyodraw_handle_t *pyodraw_handle )
+{
+	struct _typeobject *ob_type = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyodraw_handle_free";
+	int result                  = 0;
+
+	if( pyodraw_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid handle.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyodraw_handle );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pyodraw_handle->handle != NULL )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libodraw_handle_free(
+		          &( pyodraw_handle->handle ),
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyodraw_error_raise(
+			 error,
+			 PyExc_MemoryError,
+			 "%s: unable to free libodraw handle.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( pyodraw_handle->lock != NULL )
+	{
+		PyThread_free_lock(
+		 pyodraw_handle->lock );
+
+		pyodraw_handle->lock = NULL;
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyodraw_handle );
+}
+
+/* Signals the handle to abort the current activity
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyodraw_handle_signal_abort(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments PYODRAW_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyodraw_handle_signal_abort";
+	int result               = 0;
+
+	PYODRAW_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyodraw_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	/* The abort flag is set without taking the lock so that
+	 * a read blocked on another thread can be interrupted
+	 */
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libodraw_handle_signal_abort(
+	          pyodraw_handle->handle,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyodraw_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to signal abort.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Opens a handle
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyodraw_handle_open(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *string_object      = NULL;
+	libcerror_error_t *error     = NULL;
+	static char *function        = "pyodraw_handle_open";
+	static char *keyword_list[]  = { "filename", "mode", NULL };
+	const char *filename_narrow  = NULL;
+	char *mode                   = NULL;
+	int result                   = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	wchar_t *filename_wide       = NULL;
+#else
+	PyObject *utf8_string_object = NULL;
+#endif
+
+	if( pyodraw_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	/* Note that PyArg_ParseTupleAndKeywords with "s" will force Unicode strings to be converted to narrow character string.
+	 * On Windows the narrow character strings contains an extended ASCII string with a codepage. Hence we get a conversion
+	 * exception. This will also fail if the default encoding is not set correctly. We cannot use "u" here either since that
+	 * does not allow us to pass non Unicode string objects and Python (at least 2.7) does not seems to automatically upcast them.
+	 */
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O|s",
+	     keyword_list,
+	     &string_object,
+	     &mode ) == 0 )
+	{
+		return( NULL );
+	}
+	if( ( mode != NULL )
+	 && ( mode[ 0 ] != 'r' ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported mode: %s.",
+		 function,
+		 mode );
+
+		return( NULL );
+	}
+	PyErr_Clear();
+
+	result = PyObject_IsInstance(
+	          string_object,
+	          (PyObject *) &PyUnicode_Type );
+
+	if( result == -1 )
+	{
+		pyodraw_error_raise(
+		 NULL,
+		 PyExc_RuntimeError,
+		 "%s: unable to determine if string object is of type Unicode.",
+		 function );
+
+		return( NULL );
+	}
+	else if( result != 0 )
+	{
+		PyErr_Clear();
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		filename_wide = (wchar_t *) PyUnicode_AsWideCharString(
+		                             string_object,
+		                             NULL );
+
+		if( filename_wide == NULL )
+		{
+			pyodraw_error_raise(
+			 NULL,
+			 PyExc_RuntimeError,
+			 "%s: unable to convert Unicode string to wide character string.",
+			 function );
+
+			return( NULL );
+		}
+		Py_BEGIN_ALLOW_THREADS
+
+		PyThread_acquire_lock(
+		 pyodraw_handle->lock,
+		 WAIT_LOCK );
+
+		result = libodraw_handle_open_wide(
+		          pyodraw_handle->handle,
+		          filename_wide,
+		          LIBODRAW_OPEN_READ,
+		          &error );
+
+		PyThread_release_lock(
+		 pyodraw_handle->lock );
+
+		Py_END_ALLOW_THREADS
+
+		PyMem_Free(
+		 filename_wide );
+#else
+		utf8_string_object = PyUnicode_AsUTF8String(
+		                      string_object );
+
+		if( utf8_string_object == NULL )
+		{
+			pyodraw_error_raise(
+			 NULL,
+			 PyExc_RuntimeError,
+			 "%s: unable to convert Unicode string to UTF-8.",
+			 function );
+
+			return( NULL );
+		}
+#if PY_MAJOR_VERSION >= 3
+		filename_narrow = PyBytes_AsString(
+		                   utf8_string_object );
+#else
+		filename_narrow = PyString_AsString(
+		                   utf8_string_object );
+#endif
+		Py_BEGIN_ALLOW_THREADS
+
+		PyThread_acquire_lock(
+		 pyodraw_handle->lock,
+		 WAIT_LOCK );
+
+		result = libodraw_handle_open(
+		          pyodraw_handle->handle,
+		          filename_narrow,
+		          LIBODRAW_OPEN_READ,
+		          &error );
+
+		PyThread_release_lock(
+		 pyodraw_handle->lock );
+
+		Py_END_ALLOW_THREADS
+
+		Py_DecRef(
+		 utf8_string_object );
+#endif
+		if( result != 1 )
+		{
+			pyodraw_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to open handle.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	PyErr_Clear();
+
+#if PY_MAJOR_VERSION >= 3
+	result = PyObject_IsInstance(
+	          string_object,
+	          (PyObject *) &PyBytes_Type );
+#else
+	result = PyObject_IsInstance(
+	          string_object,
+	          (PyObject *) &PyString_Type );
+#endif
+	if( result == -1 )
+	{
+		pyodraw_error_raise(
+		 NULL,
+		 PyExc_RuntimeError,
+		 "%s: unable to determine if string object is of type string.",
+		 function );
+
+		return( NULL );
+	}
+	else if( result != 0 )
+	{
+		PyErr_Clear();
+
+#if PY_MAJOR_VERSION >= 3
+		filename_narrow = PyBytes_AsString(
+		                   string_object );
+#else
+		filename_narrow = PyString_AsString(
+		                   string_object );
+#endif
+		Py_BEGIN_ALLOW_THREADS
+
+		PyThread_acquire_lock(
+		 pyodraw_handle->lock,
+		 WAIT_LOCK );
+
+		result = libodraw_handle_open(
+		          pyodraw_handle->handle,
+		          filename_narrow,
+		          LIBODRAW_OPEN_READ,
+		          &error );
+
+		PyThread_release_lock(
+		 pyodraw_handle->lock );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyodraw_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to open handle.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	PyErr_Format(
+	 PyExc_TypeError,
+	 "%s: unsupported string object type.",
+	 function );
+
+	return( NULL );
+}
+
+/* Opens the data files
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyodraw_handle_open_data_files(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments PYODRAW_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyodraw_handle_open_data_files";
+	int result               = 0;
+
+	PYODRAW_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyodraw_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyodraw_handle->lock,
+	 WAIT_LOCK );
+
+	result = libodraw_handle_open_data_files(
+	          pyodraw_handle->handle,
+	          &error );
+
+	PyThread_release_lock(
+	 pyodraw_handle->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyodraw_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to open data files.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Closes a handle
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyodraw_handle_close(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments PYODRAW_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyodraw_handle_close";
+	int result               = 0;
+
+	PYODRAW_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyodraw_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyodraw_handle->lock,
+	 WAIT_LOCK );
+
+	result = libodraw_handle_close(
+	          pyodraw_handle->handle,
+	          &error );
+
+	PyThread_release_lock(
+	 pyodraw_handle->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 0 )
+	{
+		pyodraw_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to close handle.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Reads data at the current offset into a new bytes object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyodraw_handle_read_buffer(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *integer_object    = NULL;
+	PyObject *string_object     = NULL;
+	libcerror_error_t *error    = NULL;
+	char *buffer                = NULL;
+	static char *function       = "pyodraw_handle_read_buffer";
+	static char *keyword_list[] = { "size", NULL };
+	off64_t current_offset      = 0;
+	size64_t media_size         = 0;
+	ssize_t read_count          = 0;
+	int64_t read_size           = 0;
+	int result                  = 0;
+
+	if( pyodraw_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|O",
+	     keyword_list,
+	     &integer_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( ( integer_object == NULL )
+	 || ( integer_object == Py_None ) )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		PyThread_acquire_lock(
+		 pyodraw_handle->lock,
+		 WAIT_LOCK );
+
+		result = libodraw_handle_get_media_size(
+		          pyodraw_handle->handle,
+		          &media_size,
+		          &error );
+
+		if( result == 1 )
+		{
+			result = libodraw_handle_get_offset(
+			          pyodraw_handle->handle,
+			          &current_offset,
+			          &error );
+		}
+		PyThread_release_lock(
+		 pyodraw_handle->lock );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyodraw_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve media size or current offset.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		if( (size64_t) current_offset < media_size )
+		{
+			read_size = (int64_t) ( media_size - current_offset );
+		}
+	}
+	else
+	{
+		read_size = (int64_t) PyLong_AsLongLong(
+		                       integer_object );
+
+		if( ( read_size == -1 )
+		 && ( PyErr_Occurred() != NULL ) )
+		{
+			return( NULL );
+		}
+	}
+	if( read_size < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read size value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	/* Make sure the data fits into a memory buffer
+	 */
+	if( ( read_size > (int64_t) INT_MAX )
+	 || ( read_size > (int64_t) SSIZE_MAX ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument read size value exceeds maximum.",
+		 function );
+
+		return( NULL );
+	}
+	if( read_size == 0 )
+	{
+#if PY_MAJOR_VERSION >= 3
+		string_object = PyBytes_FromString(
+		                 "" );
+#else
+		string_object = PyString_FromString(
+		                 "" );
+#endif
+		return( string_object );
+	}
+#if PY_MAJOR_VERSION >= 3
+	string_object = PyBytes_FromStringAndSize(
+	                 NULL,
+	                 (Py_ssize_t) read_size );
+
+	buffer = PyBytes_AsString(
+	          string_object );
+#else
+	/* Note that a size of 0 is not supported
+	 */
+	string_object = PyString_FromStringAndSize(
+	                 NULL,
+	                 (Py_ssize_t) read_size );
+
+	buffer = PyString_AsString(
+	          string_object );
+#endif
+	if( buffer == NULL )
+	{
+		Py_XDECREF(
+		 string_object );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyodraw_handle->lock,
+	 WAIT_LOCK );
+
+	read_count = libodraw_handle_read_buffer(
+	              pyodraw_handle->handle,
+	              (uint8_t *) buffer,
+	              (size_t) read_size,
+	              &error );
+
+	PyThread_release_lock(
+	 pyodraw_handle->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( read_count == -1 )
+	{
+		pyodraw_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		Py_DecRef(
+		 (PyObject *) string_object );
+
+		return( NULL );
+	}
+	/* Need to resize the string here in case read_size was not fully read.
+	 */
+#if PY_MAJOR_VERSION >= 3
+	if( _PyBytes_Resize(
+	     &string_object,
+	     (Py_ssize_t) read_count ) != 0 )
+#else
+	if( _PyString_Resize(
+	     &string_object,
+	     (Py_ssize_t) read_count ) != 0 )
+#endif
+	{
+		Py_DecRef(
+		 (PyObject *) string_object );
+
+		return( NULL );
+	}
+	return( string_object );
+}
+
+/* Reads data at a specific offset into a new bytes object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyodraw_handle_read_buffer_at_offset(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *string_object     = NULL;
+	libcerror_error_t *error    = NULL;
+	char *buffer                = NULL;
+	static char *function       = "pyodraw_handle_read_buffer_at_offset";
+	static char *keyword_list[] = { "size", "offset", NULL };
+	ssize_t read_count          = 0;
+	int64_t read_offset         = 0;
+	int64_t read_size           = 0;
+
+	if( pyodraw_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "LL",
+	     keyword_list,
+	     &read_size,
+	     &read_offset ) == 0 )
+	{
+		return( NULL );
+	}
+	if( read_size < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read size value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	/* Make sure the data fits into a memory buffer
+	 */
+	if( ( read_size > (int64_t) INT_MAX )
+	 || ( read_size > (int64_t) SSIZE_MAX ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument read size value exceeds maximum.",
+		 function );
+
+		return( NULL );
+	}
+	if( read_offset < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read offset value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	if( read_size == 0 )
+	{
+#if PY_MAJOR_VERSION >= 3
+		string_object = PyBytes_FromString(
+		                 "" );
+#else
+		string_object = PyString_FromString(
+		                 "" );
+#endif
+		return( string_object );
+	}
+#if PY_MAJOR_VERSION >= 3
+	string_object = PyBytes_FromStringAndSize(
+	                 NULL,
+	                 (Py_ssize_t) read_size );
+
+	buffer = PyBytes_AsString(
+	          string_object );
+#else
+	/* Note that a size of 0 is not supported
+	 */
+	string_object = PyString_FromStringAndSize(
+	                 NULL,
+	                 (Py_ssize_t) read_size );
+
+	buffer = PyString_AsString(
+	          string_object );
+#endif
+	if( buffer == NULL )
+	{
+		Py_XDECREF(
+		 string_object );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyodraw_handle->lock,
+	 WAIT_LOCK );
+
+	read_count = libodraw_handle_read_buffer_at_offset(
+	              pyodraw_handle->handle,
+	              (uint8_t *) buffer,
+	              (size_t) read_size,
+	              (off64_t) read_offset,
+	              &error );
+
+	PyThread_release_lock(
+	 pyodraw_handle->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( read_count == -1 )
+	{
+		pyodraw_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		Py_DecRef(
+		 (PyObject *) string_object );
+
+		return( NULL );
+	}
+	/* Need to resize the string here in case read_size was not fully read.
+	 */
+#if PY_MAJOR_VERSION >= 3
+	if( _PyBytes_Resize(
+	     &string_object,
+	     (Py_ssize_t) read_count ) != 0 )
+#else
+	if( _PyString_Resize(
+	     &string_object,
+	     (Py_ssize_t) read_count ) != 0 )
+#endif
+	{
+		Py_DecRef(
+		 (PyObject *) string_object );
+
+		return( NULL );
+	}
+	return( string_object );
+}
+
+/* Reads data directly into a writable buffer object
+ * The data is read without an intermediate copy and with the GIL released
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyodraw_handle_readinto(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer;
+
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyodraw_handle_readinto";
+	static char *keyword_list[] = { "buffer", NULL };
+	ssize_t read_count          = 0;
+
+	if( pyodraw_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "w*",
+	     keyword_list,
+	     &buffer ) == 0 )
+	{
+		return( NULL );
+	}
+	if( (size_t) buffer.len > (size_t) SSIZE_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		PyBuffer_Release(
+		 &buffer );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyodraw_handle->lock,
+	 WAIT_LOCK );
+
+	read_count = libodraw_handle_read_buffer(
+	              pyodraw_handle->handle,
+	              buffer.buf,
+	              (size_t) buffer.len,
+	              &error );
+
+	PyThread_release_lock(
+	 pyodraw_handle->lock );
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(
+	 &buffer );
+
+	if( read_count == -1 )
+	{
+		pyodraw_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( PyLong_FromSsize_t(
+	         (Py_ssize_t) read_count ) );
+}
+
+/* Reads data at a specific offset directly into a writable buffer object
+ * The data is read without an intermediate copy and with the GIL released
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyodraw_handle_readinto_at_offset(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer;
+
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyodraw_handle_readinto_at_offset";
+	static char *keyword_list[] = { "buffer", "offset", NULL };
+	ssize_t read_count          = 0;
+	int64_t read_offset         = 0;
+
+	if( pyodraw_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "w*L",
+	     keyword_list,
+	     &buffer,
+	     &read_offset ) == 0 )
+	{
+		return( NULL );
+	}
+	if( (size_t) buffer.len > (size_t) SSIZE_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		PyBuffer_Release(
+		 &buffer );
+
+		return( NULL );
+	}
+	if( read_offset < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read offset value less than zero.",
+		 function );
+
+		PyBuffer_Release(
+		 &buffer );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyodraw_handle->lock,
+	 WAIT_LOCK );
+
+	read_count = libodraw_handle_read_buffer_at_offset(
+	              pyodraw_handle->handle,
+	              buffer.buf,
+	              (size_t) buffer.len,
+	              (off64_t) read_offset,
+	              &error );
+
+	PyThread_release_lock(
+	 pyodraw_handle->lock );
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(
+	 &buffer );
+
+	if( read_count == -1 )
+	{
+		pyodraw_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( PyLong_FromSsize_t(
+	         (Py_ssize_t) read_count ) );
+}
+
+/* Seeks a certain offset in the data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyodraw_handle_seek_offset(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyodraw_handle_seek_offset";
+	static char *keyword_list[] = { "offset", "whence", NULL };
+	off64_t offset              = 0;
+	int whence                  = 0;
+
+	if( pyodraw_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "L|i",
+	     keyword_list,
+	     &offset,
+	     &whence ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyodraw_handle->lock,
+	 WAIT_LOCK );
+
+	offset = libodraw_handle_seek_offset(
+	          pyodraw_handle->handle,
+	          offset,
+	          whence,
+	          &error );
+
+	PyThread_release_lock(
+	 pyodraw_handle->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( offset == -1 )
+	{
+		pyodraw_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to seek offset.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Retrieves the current offset in the data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyodraw_handle_get_offset(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments PYODRAW_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyodraw_handle_get_offset";
+	off64_t current_offset   = 0;
+	int result               = 0;
+
+	PYODRAW_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyodraw_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyodraw_handle->lock,
+	 WAIT_LOCK );
+
+	result = libodraw_handle_get_offset(
+	          pyodraw_handle->handle,
+	          &current_offset,
+	          &error );
+
+	PyThread_release_lock(
+	 pyodraw_handle->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyodraw_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve offset.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( PyLong_FromLongLong(
+	         (long long) current_offset ) );
+}
+
+/* Retrieves the media size
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyodraw_handle_get_media_size(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments PYODRAW_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyodraw_handle_get_media_size";
+	size64_t media_size      = 0;
+	int result               = 0;
+
+	PYODRAW_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyodraw_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyodraw_handle->lock,
+	 WAIT_LOCK );
+
+	result = libodraw_handle_get_media_size(
+	          pyodraw_handle->handle,
+	          &media_size,
+	          &error );
+
+	PyThread_release_lock(
+	 pyodraw_handle->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyodraw_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve media size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( PyLong_FromUnsignedLongLong(
+	         (unsigned long long) media_size ) );
+}
+
+/* Retrieves the number of tracks
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyodraw_handle_get_number_of_tracks(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments PYODRAW_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyodraw_handle_get_number_of_tracks";
+	int number_of_tracks     = 0;
+	int result               = 0;
+
+	PYODRAW_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyodraw_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyodraw_handle->lock,
+	 WAIT_LOCK );
+
+	result = libodraw_handle_get_number_of_tracks(
+	          pyodraw_handle->handle,
+	          &number_of_tracks,
+	          &error );
+
+	PyThread_release_lock(
+	 pyodraw_handle->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyodraw_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of tracks.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( PyLong_FromLong(
+	         (long) number_of_tracks ) );
+}
+
+/* Retrieves a specific track
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyodraw_handle_get_track(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error        = NULL;
+	static char *function           = "pyodraw_handle_get_track";
+	static char *keyword_list[]     = { "track_index", NULL };
+	uint64_t data_file_start_sector = 0;
+	uint64_t number_of_sectors      = 0;
+	uint64_t start_sector           = 0;
+	uint8_t track_type              = 0;
+	int data_file_index             = 0;
+	int result                      = 0;
+	int track_index                 = 0;
+
+	if( pyodraw_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &track_index ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyodraw_handle->lock,
+	 WAIT_LOCK );
+
+	result = libodraw_handle_get_track(
+	          pyodraw_handle->handle,
+	          track_index,
+	          &start_sector,
+	          &number_of_sectors,
+	          &track_type,
+	          &data_file_index,
+	          &data_file_start_sector,
+	          &error );
+
+	PyThread_release_lock(
+	 pyodraw_handle->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyodraw_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve track: %d.",
+		 function,
+		 track_index );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( Py_BuildValue(
+	         "(KKBiK)",
+	         (unsigned long long) start_sector,
+	         (unsigned long long) number_of_sectors,
+	         (unsigned char) track_type,
+	         data_file_index,
+	         (unsigned long long) data_file_start_sector ) );
+}
+
+/* Retrieves the number of extents
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyodraw_handle_get_number_of_extents(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments PYODRAW_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyodraw_handle_get_number_of_extents";
+	int number_of_extents    = 0;
+	int result               = 0;
+
+	PYODRAW_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyodraw_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyodraw_handle->lock,
+	 WAIT_LOCK );
+
+	result = libodraw_handle_get_number_of_extents(
+	          pyodraw_handle->handle,
+	          &number_of_extents,
+	          &error );
+
+	PyThread_release_lock(
+	 pyodraw_handle->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyodraw_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( PyLong_FromLong(
+	         (long) number_of_extents ) );
+}
+
+/* Retrieves a specific extent
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyodraw_handle_get_extent(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyodraw_handle_get_extent";
+	static char *keyword_list[] = { "extent_index", NULL };
+	off64_t data_file_offset    = 0;
+	off64_t extent_offset       = 0;
+	size64_t extent_size        = 0;
+	uint32_t bytes_per_sector   = 0;
+	uint32_t extent_flags       = 0;
+	uint8_t track_type          = 0;
+	int data_file_index         = 0;
+	int extent_index            = 0;
+	int result                  = 0;
+
+	if( pyodraw_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &extent_index ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyodraw_handle->lock,
+	 WAIT_LOCK );
+
+	result = libodraw_handle_get_extent(
+	          pyodraw_handle->handle,
+	          extent_index,
+	          &extent_offset,
+	          &extent_size,
+	          &data_file_index,
+	          &data_file_offset,
+	          &bytes_per_sector,
+	          &track_type,
+	          &extent_flags,
+	          &error );
+
+	PyThread_release_lock(
+	 pyodraw_handle->lock );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyodraw_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve extent: %d.",
+		 function,
+		 extent_index );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( Py_BuildValue(
+	         "(LKiLIBI)",
+	         (long long) extent_offset,
+	         (unsigned long long) extent_size,
+	         data_file_index,
+	         (long long) data_file_offset,
+	         (unsigned int) bytes_per_sector,
+	         (unsigned char) track_type,
+	         (unsigned int) extent_flags ) );
+}
+
@@ -0,0 +1,139 @@
+/*
+ * Python object wrapper of libodraw_handle_t
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _PYODRAW_HANDLE_H )
+#define _PYODRAW_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyodraw_libodraw.h"
+#include "pyodraw_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyodraw_handle pyodraw_handle_t;
+
+struct pyodraw_handle
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The libodraw handle
+	 */
+	libodraw_handle_t *handle;
+
+	/* The lock that serializes access to the libodraw handle
+	 * while the GIL is released
+	 */
+	PyThread_type_lock lock;
+};
+
+extern PyMethodDef pyodraw_handle_object_methods[];
+extern PyTypeObject pyodraw_handle_type_object;
+
+PyObject *pyodraw_handle_new(
+           void );
+
+int pyodraw_handle_init(
+     pyodraw_handle_t *pyodraw_handle );
+
+void pyodraw_handle_free(
+      pyodraw_handle_t *pyodraw_handle );
+
+PyObject *pyodraw_handle_signal_abort(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments );
+
+PyObject *pyodraw_handle_open(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyodraw_handle_open_data_files(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments );
+
+PyObject *pyodraw_handle_close(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments );
+
+PyObject *pyodraw_handle_read_buffer(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyodraw_handle_read_buffer_at_offset(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyodraw_handle_readinto(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyodraw_handle_readinto_at_offset(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyodraw_handle_seek_offset(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyodraw_handle_get_offset(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments );
+
+PyObject *pyodraw_handle_get_media_size(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments );
+
+PyObject *pyodraw_handle_get_number_of_tracks(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments );
+
+PyObject *pyodraw_handle_get_track(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyodraw_handle_get_number_of_extents(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments );
+
+PyObject *pyodraw_handle_get_extent(
+           pyodraw_handle_t *pyodraw_handle,
+           PyObject *arguments,
+           PyObject *keywords );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYODRAW_HANDLE_H ) */
+
@@ -0,0 +1,719 @@
+/*
+ * Library CUE parser throughput benchmark
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_STDARG_H ) || defined( WINAPI )
+#include <stdarg.h>
+#elif defined( HAVE_VARARGS_H )
+#include <varargs.h>
+#else
+#error Missing headers stdarg.h and varargs.h
+#endif
+
+#include <time.h>
+
+#include "odraw_test_getopt.h"
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_cue_reader.h"
+
+/* The default number of times each CUE sheet is parsed
+ */
+#define ODRAW_BENCH_DEFAULT_NUMBER_OF_ITERATIONS	1000
+
+/* The maximum size of a generated CUE sheet
+ */
+#define ODRAW_BENCH_MAXIMUM_SHEET_SIZE			( 1024 * 1024 )
+
+enum ODRAW_BENCH_SHEET_TYPES
+{
+	ODRAW_BENCH_SHEET_TYPE_SINGLE_TRACK,
+	ODRAW_BENCH_SHEET_TYPE_99_TRACKS,
+	ODRAW_BENCH_SHEET_TYPE_99_FILES,
+	ODRAW_BENCH_SHEET_TYPE_CD_TEXT,
+	ODRAW_BENCH_SHEET_TYPE_REMARKS,
+	ODRAW_BENCH_SHEET_TYPE_MULTI_SESSION,
+
+	ODRAW_BENCH_NUMBER_OF_SHEET_TYPES
+};
+
+static const char *odraw_bench_sheet_descriptions[ ODRAW_BENCH_NUMBER_OF_SHEET_TYPES ] = {
+	"single track",
+	"99 tracks",
+	"99 tracks, FILE per track",
+	"99 tracks, CD-TEXT",
+	"99 tracks, REM blocks",
+	"99 tracks, 2 sessions" };
+
+extern \
+int libodraw_cue_parser_parse_buffer(
+     libodraw_handle_t *handle,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Prints usage information
+ */
+void odraw_bench_cue_parser_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use odraw_bench_cue_parser to measure the throughput of the CUE parser.\n\n" );
+
+	fprintf( stream, "Usage: odraw_bench_cue_parser [ -i iterations ] [ -hr ]\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     number of times each CUE sheet is parsed, default is: %d\n",
+	 ODRAW_BENCH_DEFAULT_NUMBER_OF_ITERATIONS );
+	fprintf( stream, "\t-r:     use the hand-written CUE reader instead of the flex and bison\n"
+	                 "\t        based CUE parser\n" );
+}
+
+/* Appends a formatted line to a CUE sheet
+ * Returns 1 if successful or -1 on error
+ */
+int odraw_bench_cue_parser_append_line(
+     char *sheet,
+     size_t sheet_size,
+     size_t *sheet_offset,
+     size_t *number_of_lines,
+     const char *format,
+     ... )
+{
+	va_list argument_list;
+
+	int print_count = 0;
+
+	if( *sheet_offset >= sheet_size )
+	{
+		return( -1 );
+	}
+	va_start(
+	 argument_list,
+	 format );
+
+	print_count = narrow_string_vsnprintf(
+	               &( sheet[ *sheet_offset ] ),
+	               sheet_size - *sheet_offset,
+	               format,
+	               argument_list );
+
+	va_end(
+	 argument_list );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= ( sheet_size - *sheet_offset ) ) )
+	{
+		return( -1 );
+	}
+	*sheet_offset    += (size_t) print_count;
+	*number_of_lines += 1;
+
+	return( 1 );
+}
+
+/* Generates a CUE sheet of a specific type
+ * The sheet is terminated by the 2 zero bytes the parser requires
+ * Returns 1 if successful or -1 on error
+ */
+int odraw_bench_cue_parser_generate_sheet(
+     int sheet_type,
+     char *sheet,
+     size_t sheet_size,
+     size_t *data_size,
+     size_t *number_of_lines )
+{
+	size_t sheet_offset  = 0;
+	int number_of_tracks = 99;
+	int remark_index     = 0;
+	int track_number     = 0;
+
+	*number_of_lines = 0;
+
+	if( sheet_size < 2 )
+	{
+		return( -1 );
+	}
+	/* Keep room for the terminating zero bytes
+	 */
+	sheet_size -= 2;
+
+	if( sheet_type == ODRAW_BENCH_SHEET_TYPE_SINGLE_TRACK )
+	{
+		number_of_tracks = 1;
+	}
+	if( sheet_type == ODRAW_BENCH_SHEET_TYPE_CD_TEXT )
+	{
+		if( odraw_bench_cue_parser_append_line(
+		     sheet, sheet_size, &sheet_offset, number_of_lines,
+		     "CATALOG 0123456789012\n" ) != 1 )
+		{
+			return( -1 );
+		}
+		if( odraw_bench_cue_parser_append_line(
+		     sheet, sheet_size, &sheet_offset, number_of_lines,
+		     "PERFORMER \"The Benchmark Ensemble and Orchestra of Sustained Throughput\"\n" ) != 1 )
+		{
+			return( -1 );
+		}
+		if( odraw_bench_cue_parser_append_line(
+		     sheet, sheet_size, &sheet_offset, number_of_lines,
+		     "TITLE \"Ninety-nine Variations on a Table of Contents\"\n" ) != 1 )
+		{
+			return( -1 );
+		}
+		if( odraw_bench_cue_parser_append_line(
+		     sheet, sheet_size, &sheet_offset, number_of_lines,
+		     "SONGWRITER \"Anonymous\"\n" ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	if( sheet_type == ODRAW_BENCH_SHEET_TYPE_REMARKS )
+	{
+		if( odraw_bench_cue_parser_append_line(
+		     sheet, sheet_size, &sheet_offset, number_of_lines,
+		     "REM GENRE \"Classical\"\n" ) != 1 )
+		{
+			return( -1 );
+		}
+		if( odraw_bench_cue_parser_append_line(
+		     sheet, sheet_size, &sheet_offset, number_of_lines,
+		     "REM DATE 1999\n" ) != 1 )
+		{
+			return( -1 );
+		}
+		if( odraw_bench_cue_parser_append_line(
+		     sheet, sheet_size, &sheet_offset, number_of_lines,
+		     "REM DISCID 8A0B6263\n" ) != 1 )
+		{
+			return( -1 );
+		}
+		if( odraw_bench_cue_parser_append_line(
+		     sheet, sheet_size, &sheet_offset, number_of_lines,
+		     "REM COMMENT \"ExactAudioCopy v1.0b3\"\n" ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	if( sheet_type != ODRAW_BENCH_SHEET_TYPE_99_FILES )
+	{
+		if( odraw_bench_cue_parser_append_line(
+		     sheet, sheet_size, &sheet_offset, number_of_lines,
+		     "FILE \"image.bin\" BINARY\n" ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	for( track_number = 1;
+	     track_number <= number_of_tracks;
+	     track_number++ )
+	{
+		if( sheet_type == ODRAW_BENCH_SHEET_TYPE_MULTI_SESSION )
+		{
+			if( ( track_number == 1 )
+			 || ( track_number == 50 ) )
+			{
+				if( odraw_bench_cue_parser_append_line(
+				     sheet, sheet_size, &sheet_offset, number_of_lines,
+				     "REM SESSION %02d\n",
+				     ( track_number == 1 ) ? 1 : 2 ) != 1 )
+				{
+					return( -1 );
+				}
+			}
+		}
+		else if( sheet_type == ODRAW_BENCH_SHEET_TYPE_99_FILES )
+		{
+			if( odraw_bench_cue_parser_append_line(
+			     sheet, sheet_size, &sheet_offset, number_of_lines,
+			     "FILE \"track%02d.bin\" BINARY\n",
+			     track_number ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+		if( sheet_type == ODRAW_BENCH_SHEET_TYPE_SINGLE_TRACK )
+		{
+			if( odraw_bench_cue_parser_append_line(
+			     sheet, sheet_size, &sheet_offset, number_of_lines,
+			     "  TRACK %02d MODE1/2352\n",
+			     track_number ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( odraw_bench_cue_parser_append_line(
+			     sheet, sheet_size, &sheet_offset, number_of_lines,
+			     "  TRACK %02d AUDIO\n",
+			     track_number ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+		if( sheet_type == ODRAW_BENCH_SHEET_TYPE_CD_TEXT )
+		{
+			if( odraw_bench_cue_parser_append_line(
+			     sheet, sheet_size, &sheet_offset, number_of_lines,
+			     "    TITLE \"Variation %02d on a Table of Contents in the Key of Red Book\"\n",
+			     track_number ) != 1 )
+			{
+				return( -1 );
+			}
+			if( odraw_bench_cue_parser_append_line(
+			     sheet, sheet_size, &sheet_offset, number_of_lines,
+			     "    PERFORMER \"The Benchmark Ensemble and Orchestra of Sustained Throughput\"\n" ) != 1 )
+			{
+				return( -1 );
+			}
+			if( odraw_bench_cue_parser_append_line(
+			     sheet, sheet_size, &sheet_offset, number_of_lines,
+			     "    SONGWRITER \"Anonymous\"\n" ) != 1 )
+			{
+				return( -1 );
+			}
+			if( odraw_bench_cue_parser_append_line(
+			     sheet, sheet_size, &sheet_offset, number_of_lines,
+			     "    ISRC USABC99%05d\n",
+			     track_number ) != 1 )
+			{
+				return( -1 );
+			}
+			if( odraw_bench_cue_parser_append_line(
+			     sheet, sheet_size, &sheet_offset, number_of_lines,
+			     "    FLAGS DCP PRE\n" ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+		else if( sheet_type == ODRAW_BENCH_SHEET_TYPE_REMARKS )
+		{
+			for( remark_index = 0;
+			     remark_index < 8;
+			     remark_index++ )
+			{
+				if( odraw_bench_cue_parser_append_line(
+				     sheet, sheet_size, &sheet_offset, number_of_lines,
+				     "    REM REPLAYGAIN_TRACK_GAIN -%d.%02d dB track %02d remark %d\n",
+				     remark_index, track_number, track_number, remark_index ) != 1 )
+				{
+					return( -1 );
+				}
+			}
+		}
+		if( ( sheet_type != ODRAW_BENCH_SHEET_TYPE_SINGLE_TRACK )
+		 && ( sheet_type != ODRAW_BENCH_SHEET_TYPE_99_FILES )
+		 && ( track_number > 1 ) )
+		{
+			if( odraw_bench_cue_parser_append_line(
+			     sheet, sheet_size, &sheet_offset, number_of_lines,
+			     "    INDEX 00 %02d:%02d:00\n",
+			     ( ( track_number * 3 ) - 1 ) / 60,
+			     ( ( track_number * 3 ) - 1 ) % 60 ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+		if( ( sheet_type == ODRAW_BENCH_SHEET_TYPE_SINGLE_TRACK )
+		 || ( sheet_type == ODRAW_BENCH_SHEET_TYPE_99_FILES ) )
+		{
+			if( odraw_bench_cue_parser_append_line(
+			     sheet, sheet_size, &sheet_offset, number_of_lines,
+			     "    INDEX 01 00:00:00\n" ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( odraw_bench_cue_parser_append_line(
+			     sheet, sheet_size, &sheet_offset, number_of_lines,
+			     "    INDEX 01 %02d:%02d:00\n",
+			     ( track_number * 3 ) / 60,
+			     ( track_number * 3 ) % 60 ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+		if( ( sheet_type == ODRAW_BENCH_SHEET_TYPE_MULTI_SESSION )
+		 && ( track_number == 49 ) )
+		{
+			if( odraw_bench_cue_parser_append_line(
+			     sheet, sheet_size, &sheet_offset, number_of_lines,
+			     "REM LEAD-OUT 02:28:00\n" ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+	}
+	sheet[ sheet_offset++ ] = 0;
+	sheet[ sheet_offset++ ] = 0;
+
+	*data_size = sheet_offset;
+
+	return( 1 );
+}
+
+/* Parses a CUE sheet a number of times and prints the throughput
+ * Returns 1 if successful or -1 on error
+ */
+int odraw_bench_cue_parser_run(
+     const char *description,
+     const uint8_t *data,
+     size_t data_size,
+     size_t number_of_lines,
+     int number_of_iterations,
+     uint8_t use_cue_reader,
+     libcerror_error_t **error )
+{
+	libodraw_handle_t *handle     = NULL;
+	static char *function         = "odraw_bench_cue_parser_run";
+	clock_t elapsed_clock_ticks   = 0;
+	clock_t start_clock_ticks     = 0;
+	double microseconds_per_parse = 0.0;
+	double nanoseconds_per_line   = 0.0;
+	int iteration                 = 0;
+	int result                    = 0;
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+	size_t allocation_count       = 0;
+	size_t number_of_allocations  = 0;
+#endif
+
+	if( ( number_of_lines == 0 )
+	 || ( number_of_iterations <= 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of lines or iterations value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( libodraw_handle_initialize(
+		     &handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize handle.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+		allocation_count = odraw_test_malloc_count
+		                 + odraw_test_realloc_count;
+#endif
+		start_clock_ticks = clock();
+
+		if( use_cue_reader != 0 )
+		{
+			result = libodraw_cue_reader_parse_buffer(
+			          handle,
+			          data,
+			          data_size,
+			          error );
+		}
+		else
+		{
+			result = libodraw_cue_parser_parse_buffer(
+			          handle,
+			          data,
+			          data_size,
+			          error );
+		}
+
+		elapsed_clock_ticks += clock() - start_clock_ticks;
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+		number_of_allocations += odraw_test_malloc_count
+		                       + odraw_test_realloc_count
+		                       - allocation_count;
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse CUE sheet: %s.",
+			 function,
+			 description );
+
+			goto on_error;
+		}
+		if( libodraw_handle_free(
+		     &handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	microseconds_per_parse = ( (double) elapsed_clock_ticks * 1000000.0 )
+	                       / ( (double) CLOCKS_PER_SEC * (double) number_of_iterations );
+
+	nanoseconds_per_line = ( microseconds_per_parse * 1000.0 ) / (double) number_of_lines;
+
+	fprintf(
+	 stdout,
+	 "%-28s %6" PRIzd " %8" PRIzd " %12.2f %10.1f",
+	 description,
+	 number_of_lines,
+	 data_size - 2,
+	 microseconds_per_parse,
+	 nanoseconds_per_line );
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+	fprintf(
+	 stdout,
+	 " %12.2f %10.3f\n",
+	 (double) number_of_allocations / (double) number_of_iterations,
+	 (double) number_of_allocations / ( (double) number_of_iterations * (double) number_of_lines ) );
+#else
+	fprintf(
+	 stdout,
+	 " %12s %10s\n",
+	 "n/a",
+	 "n/a" );
+#endif
+	return( 1 );
+
+on_error:
+	if( handle != NULL )
+	{
+		libodraw_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+	libcerror_error_t *error = NULL;
+	char *sheet              = NULL;
+	system_integer_t option  = 0;
+	size_t number_of_lines   = 0;
+	size_t option_index      = 0;
+	size_t sheet_data_size   = 0;
+	int number_of_iterations = ODRAW_BENCH_DEFAULT_NUMBER_OF_ITERATIONS;
+	int sheet_type           = 0;
+	uint8_t use_cue_reader   = 0;
+
+	while( ( option = odraw_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hi:r" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				odraw_bench_cue_parser_usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				odraw_bench_cue_parser_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				number_of_iterations = 0;
+
+				for( option_index = 0;
+				     optarg[ option_index ] != 0;
+				     option_index++ )
+				{
+					if( ( optarg[ option_index ] < (system_character_t) '0' )
+					 || ( optarg[ option_index ] > (system_character_t) '9' )
+					 || ( number_of_iterations > ( ( INT_MAX - 9 ) / 10 ) ) )
+					{
+						number_of_iterations = 0;
+
+						break;
+					}
+					number_of_iterations *= 10;
+					number_of_iterations += (int) ( optarg[ option_index ] - (system_character_t) '0' );
+				}
+				if( number_of_iterations <= 0 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported number of iterations: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) 'r':
+				use_cue_reader = 1;
+
+				break;
+		}
+	}
+	sheet = (char *) memory_allocate(
+	                  sizeof( char ) * ODRAW_BENCH_MAXIMUM_SHEET_SIZE );
+
+	if( sheet == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create CUE sheet.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "%-28s %6s %8s %12s %10s %12s %10s\n",
+	 "CUE sheet",
+	 "Lines",
+	 "Bytes",
+	 "us/parse",
+	 "ns/line",
+	 "allocs/parse",
+	 "allocs/line" );
+
+	for( sheet_type = 0;
+	     sheet_type < ODRAW_BENCH_NUMBER_OF_SHEET_TYPES;
+	     sheet_type++ )
+	{
+		if( odraw_bench_cue_parser_generate_sheet(
+		     sheet_type,
+		     sheet,
+		     ODRAW_BENCH_MAXIMUM_SHEET_SIZE,
+		     &sheet_data_size,
+		     &number_of_lines ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to generate CUE sheet: %s.\n",
+			 odraw_bench_sheet_descriptions[ sheet_type ] );
+
+			goto on_error;
+		}
+		if( odraw_bench_cue_parser_run(
+		     odraw_bench_sheet_descriptions[ sheet_type ],
+		     (uint8_t *) sheet,
+		     sheet_data_size,
+		     number_of_lines,
+		     number_of_iterations,
+		     use_cue_reader,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run benchmark.\n" );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 sheet );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( sheet != NULL )
+	{
+		memory_free(
+		 sheet );
+	}
+	return( EXIT_FAILURE );
+
+#else
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+	fprintf(
+	 stderr,
+	 "Benchmark requires access to the internal CUE parser functions.\n" );
+
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,586 @@
+/*
+ * Library block_cache type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_block_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Reads a block for testing, the block data is filled with the block index
+ * Returns 1 if successful or -1 on error
+ */
+int odraw_test_block_cache_read_block(
+     intptr_t *data_handle ODRAW_TEST_ATTRIBUTE_UNUSED,
+     uint32_t block_index,
+     uint8_t *block_data,
+     size_t block_data_size,
+     libcerror_error_t **error ODRAW_TEST_ATTRIBUTE_UNUSED )
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( data_handle )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( memory_set(
+	     block_data,
+	     (int) ( block_index & 0xff ),
+	     block_data_size ) == NULL )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libodraw_block_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_block_cache_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libodraw_block_cache_t *block_cache = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 1;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libodraw_block_cache_initialize(
+	          &block_cache,
+	          16,
+	          64,
+	          NULL,
+	          &odraw_test_block_cache_read_block,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_block_cache_initialize(
+	          NULL,
+	          16,
+	          64,
+	          NULL,
+	          &odraw_test_block_cache_read_block,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block_cache = (libodraw_block_cache_t *) 0x12345678UL;
+
+	result = libodraw_block_cache_initialize(
+	          &block_cache,
+	          16,
+	          64,
+	          NULL,
+	          &odraw_test_block_cache_read_block,
+	          &error );
+
+	block_cache = NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_block_cache_initialize(
+	          &block_cache,
+	          16,
+	          0,
+	          NULL,
+	          &odraw_test_block_cache_read_block,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_block_cache_initialize(
+	          &block_cache,
+	          16,
+	          64,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_block_cache_initialize with malloc failing
+		 */
+		odraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libodraw_block_cache_initialize(
+		          &block_cache,
+		          16,
+		          64,
+		          NULL,
+		          &odraw_test_block_cache_read_block,
+		          &error );
+
+		if( odraw_test_malloc_attempts_before_fail != -1 )
+		{
+			odraw_test_malloc_attempts_before_fail = -1;
+
+			if( block_cache != NULL )
+			{
+				libodraw_block_cache_free(
+				 &block_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "block_cache",
+			 block_cache );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_block_cache_initialize with memset failing
+		 */
+		odraw_test_memset_attempts_before_fail = test_number;
+
+		result = libodraw_block_cache_initialize(
+		          &block_cache,
+		          16,
+		          64,
+		          NULL,
+		          &odraw_test_block_cache_read_block,
+		          &error );
+
+		if( odraw_test_memset_attempts_before_fail != -1 )
+		{
+			odraw_test_memset_attempts_before_fail = -1;
+
+			if( block_cache != NULL )
+			{
+				libodraw_block_cache_free(
+				 &block_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "block_cache",
+			 block_cache );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ODRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libodraw_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_block_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_block_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libodraw_block_cache_free(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_block_cache_get_block_data function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_block_cache_get_block_data(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libodraw_block_cache_t *block_cache = NULL;
+	const uint8_t *block_data           = NULL;
+	uint32_t block_index                = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_block_cache_initialize(
+	          &block_cache,
+	          64,
+	          64,
+	          NULL,
+	          &odraw_test_block_cache_read_block,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * reading more blocks than fit in the cache, sequentially and in reverse
+	 */
+	for( block_index = 0;
+	     block_index < 64;
+	     block_index++ )
+	{
+		result = libodraw_block_cache_get_block_data(
+		          block_cache,
+		          block_index,
+		          &block_data,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_IS_NOT_NULL(
+		 "block_data",
+		 block_data );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT8(
+		 "block_data[ 0 ]",
+		 block_data[ 0 ],
+		 (uint8_t) block_index );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT8(
+		 "block_data[ 63 ]",
+		 block_data[ 63 ],
+		 (uint8_t) block_index );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( block_index = 64;
+	     block_index > 0;
+	     block_index-- )
+	{
+		result = libodraw_block_cache_get_block_data(
+		          block_cache,
+		          block_index - 1,
+		          &block_data,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT8(
+		 "block_data[ 0 ]",
+		 block_data[ 0 ],
+		 (uint8_t) ( block_index - 1 ) );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libodraw_block_cache_get_block_data(
+	          NULL,
+	          0,
+	          &block_data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_block_cache_get_block_data(
+	          block_cache,
+	          64,
+	          &block_data,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_block_cache_get_block_data(
+	          block_cache,
+	          0,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libodraw_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_block_cache_initialize",
+	 odraw_test_block_cache_initialize );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_block_cache_free",
+	 odraw_test_block_cache_free );
+
+	/* TODO: add tests for libodraw_block_cache_get_entry */
+
+	/* TODO: add tests for libodraw_block_cache_get_free_entry */
+
+	ODRAW_TEST_RUN(
+	 "libodraw_block_cache_get_block_data",
+	 odraw_test_block_cache_get_block_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2473 @@
+/*
+ * Library chd_file type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_functions.h"
+#include "odraw_test_libbfio.h"
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_checksum.h"
+#include "../libodraw/libodraw_chd_file.h"
+#include "../libodraw/libodraw_definitions.h"
+
+/* An uncompressed CHD version 5 file of 3 hunks of 64 bytes, where the second hunk
+ * is not stored and the uncompressed map (at offset 128) refers to the other hunks
+ */
+uint8_t odraw_test_chd_file_uncompressed_data[ 320 ] = {
+	0x4d, 0x43, 0x6f, 0x6d, 0x70, 0x72, 0x48, 0x44, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x0e, 0x15, 0x1c, 0x23, 0x2a, 0x31, 0x38, 0x3f, 0x46, 0x4d, 0x54, 0x5b, 0x62, 0x69,
+	0x70, 0x77, 0x7e, 0x85, 0x8c, 0x93, 0x9a, 0xa1, 0xa8, 0xaf, 0xb6, 0xbd, 0xc4, 0xcb, 0xd2, 0xd9,
+	0xe0, 0xe7, 0xee, 0xf5, 0xfc, 0x03, 0x0a, 0x11, 0x18, 0x1f, 0x26, 0x2d, 0x34, 0x3b, 0x42, 0x49,
+	0x50, 0x57, 0x5e, 0x65, 0x6c, 0x73, 0x7a, 0x81, 0x88, 0x8f, 0x96, 0x9d, 0xa4, 0xab, 0xb2, 0xb9,
+	0x80, 0x87, 0x8e, 0x95, 0x9c, 0xa3, 0xaa, 0xb1, 0xb8, 0xbf, 0xc6, 0xcd, 0xd4, 0xdb, 0xe2, 0xe9,
+	0xf0, 0xf7, 0xfe, 0x05, 0x0c, 0x13, 0x1a, 0x21, 0x28, 0x2f, 0x36, 0x3d, 0x44, 0x4b, 0x52, 0x59,
+	0x60, 0x67, 0x6e, 0x75, 0x7c, 0x83, 0x8a, 0x91, 0x98, 0x9f, 0xa6, 0xad, 0xb4, 0xbb, 0xc2, 0xc9,
+	0xd0, 0xd7, 0xde, 0xe5, 0xec, 0xf3, 0xfa, 0x01, 0x08, 0x0f, 0x16, 0x1d, 0x24, 0x2b, 0x32, 0x39 };
+
+/* A CD CHD version 5 file with a MODE1_RAW and 2 AUDIO tracks of 4 frames each
+ * and a compressed map (at offset 1449). The hunks consist of 4 frames, the first is
+ * cdzl compressed with regenerated sync headers and ECC, the second is cdfl compressed
+ * and the third is a self reference to the second
+ */
+uint8_t odraw_test_chd_file_cd_zlib_data[ 1478 ] = {
+	0x4d, 0x43, 0x6f, 0x6d, 0x70, 0x72, 0x48, 0x44, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x05,
+	0x63, 0x64, 0x7a, 0x6c, 0x63, 0x64, 0x66, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xa9,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x26, 0x40, 0x00, 0x00, 0x09, 0x90,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x48, 0x54, 0x32,
+	0x01, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x54, 0x52, 0x41, 0x43,
+	0x4b, 0x3a, 0x31, 0x20, 0x54, 0x59, 0x50, 0x45, 0x3a, 0x4d, 0x4f, 0x44, 0x45, 0x31, 0x5f, 0x52,
+	0x41, 0x57, 0x20, 0x53, 0x55, 0x42, 0x54, 0x59, 0x50, 0x45, 0x3a, 0x4e, 0x4f, 0x4e, 0x45, 0x20,
+	0x46, 0x52, 0x41, 0x4d, 0x45, 0x53, 0x3a, 0x34, 0x20, 0x50, 0x52, 0x45, 0x47, 0x41, 0x50, 0x3a,
+	0x30, 0x20, 0x50, 0x47, 0x54, 0x59, 0x50, 0x45, 0x3a, 0x4d, 0x4f, 0x44, 0x45, 0x31, 0x20, 0x50,
+	0x47, 0x53, 0x55, 0x42, 0x3a, 0x52, 0x57, 0x20, 0x50, 0x4f, 0x53, 0x54, 0x47, 0x41, 0x50, 0x3a,
+	0x30, 0x00, 0x43, 0x48, 0x54, 0x32, 0x01, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x44, 0x54, 0x52, 0x41, 0x43, 0x4b, 0x3a, 0x32, 0x20, 0x54, 0x59, 0x50, 0x45, 0x3a, 0x41,
+	0x55, 0x44, 0x49, 0x4f, 0x20, 0x53, 0x55, 0x42, 0x54, 0x59, 0x50, 0x45, 0x3a, 0x4e, 0x4f, 0x4e,
+	0x45, 0x20, 0x46, 0x52, 0x41, 0x4d, 0x45, 0x53, 0x3a, 0x34, 0x20, 0x50, 0x52, 0x45, 0x47, 0x41,
+	0x50, 0x3a, 0x30, 0x20, 0x50, 0x47, 0x54, 0x59, 0x50, 0x45, 0x3a, 0x4d, 0x4f, 0x44, 0x45, 0x31,
+	0x20, 0x50, 0x47, 0x53, 0x55, 0x42, 0x3a, 0x52, 0x57, 0x20, 0x50, 0x4f, 0x53, 0x54, 0x47, 0x41,
+	0x50, 0x3a, 0x30, 0x00, 0x43, 0x48, 0x54, 0x32, 0x01, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x54, 0x52, 0x41, 0x43, 0x4b, 0x3a, 0x33, 0x20, 0x54, 0x59, 0x50, 0x45,
+	0x3a, 0x41, 0x55, 0x44, 0x49, 0x4f, 0x20, 0x53, 0x55, 0x42, 0x54, 0x59, 0x50, 0x45, 0x3a, 0x4e,
+	0x4f, 0x4e, 0x45, 0x20, 0x46, 0x52, 0x41, 0x4d, 0x45, 0x53, 0x3a, 0x34, 0x20, 0x50, 0x52, 0x45,
+	0x47, 0x41, 0x50, 0x3a, 0x30, 0x20, 0x50, 0x47, 0x54, 0x59, 0x50, 0x45, 0x3a, 0x4d, 0x4f, 0x44,
+	0x45, 0x31, 0x20, 0x50, 0x47, 0x53, 0x55, 0x42, 0x3a, 0x52, 0x57, 0x20, 0x50, 0x4f, 0x53, 0x54,
+	0x47, 0x41, 0x50, 0x3a, 0x30, 0x00, 0x0f, 0x01, 0x90, 0x63, 0x60, 0x40, 0x02, 0x4c, 0x0c, 0x8c,
+	0x0c, 0x8c, 0x4c, 0xcc, 0x2c, 0xac, 0x6c, 0xec, 0x1c, 0x9c, 0x5c, 0xdc, 0x3c, 0xbc, 0x7c, 0xfc,
+	0x02, 0x82, 0x42, 0xc2, 0x22, 0xa2, 0x62, 0xe2, 0x12, 0x92, 0x52, 0xd2, 0x32, 0xb2, 0x72, 0xf2,
+	0x0a, 0x8a, 0x4a, 0xca, 0x2a, 0xaa, 0x6a, 0xea, 0x1a, 0x9a, 0x5a, 0xda, 0x3a, 0xba, 0x7a, 0xfa,
+	0x06, 0x86, 0x46, 0xc6, 0x26, 0xa6, 0x66, 0xe6, 0x16, 0x96, 0x56, 0xd6, 0x36, 0xb6, 0x76, 0xf6,
+	0x0e, 0x8e, 0x4e, 0xce, 0x2e, 0xae, 0x6e, 0xee, 0x1e, 0x9e, 0x5e, 0xde, 0x3e, 0xbe, 0x7e, 0xfe,
+	0x01, 0x81, 0x41, 0xc1, 0x21, 0xa1, 0x61, 0xe1, 0x11, 0x91, 0x51, 0xd1, 0x31, 0xb1, 0x71, 0xf1,
+	0x09, 0x89, 0x49, 0xc9, 0x29, 0xa9, 0x69, 0xe9, 0x19, 0x99, 0x59, 0xd9, 0x39, 0xb9, 0x79, 0xf9,
+	0x05, 0x85, 0x45, 0xc5, 0x25, 0xa5, 0x65, 0xe5, 0x15, 0x95, 0x55, 0xd5, 0x35, 0xb5, 0x75, 0xf5,
+	0x0d, 0x8d, 0x4d, 0xcd, 0x2d, 0xad, 0x6d, 0xed, 0x1d, 0x9d, 0x5d, 0xdd, 0x3d, 0xbd, 0x7d, 0xfd,
+	0x13, 0x26, 0x4e, 0x9a, 0x3c, 0x65, 0xea, 0xb4, 0xe9, 0x33, 0x66, 0xce, 0x9a, 0x3d, 0x67, 0xee,
+	0xbc, 0xf9, 0x0b, 0x16, 0x2e, 0x5a, 0xbc, 0x64, 0xe9, 0xb2, 0xe5, 0x2b, 0x56, 0xae, 0x5a, 0xbd,
+	0x66, 0xed, 0xba, 0xf5, 0x1b, 0x36, 0x6e, 0xda, 0xbc, 0x65, 0xeb, 0xb6, 0xed, 0x3b, 0x76, 0xee,
+	0xda, 0xbd, 0x67, 0xef, 0xbe, 0xfd, 0x07, 0x0e, 0x1e, 0x3a, 0x7c, 0xe4, 0xe8, 0xb1, 0xe3, 0x27,
+	0x4e, 0x9e, 0x3a, 0x7d, 0xe6, 0xec, 0xb9, 0xf3, 0x17, 0x2e, 0x5e, 0xba, 0x7c, 0xe5, 0xea, 0xb5,
+	0xeb, 0x37, 0x6e, 0xde, 0xba, 0x7d, 0xe7, 0xee, 0xbd, 0xfb, 0x0f, 0x1e, 0x3e, 0x7a, 0xfc, 0xe4,
+	0xe9, 0xb3, 0xe7, 0x2f, 0x5e, 0xbe, 0x7a, 0xfd, 0xe6, 0xed, 0xbb, 0xf7, 0x1f, 0x3e, 0x7e, 0xfa,
+	0xfc, 0xe5, 0xeb, 0xb7, 0xef, 0x3f, 0x7e, 0xfe, 0xfa, 0xfd, 0xe7, 0xef, 0xbf, 0xff, 0xa3, 0xfe,
+	0x1f, 0xf5, 0xff, 0xa8, 0xff, 0x47, 0xfd, 0x3f, 0xea, 0xff, 0x51, 0xff, 0x8f, 0x44, 0xff, 0xab,
+	0x4f, 0xb7, 0x7c, 0xc6, 0x30, 0x0a, 0x88, 0x03, 0x4c, 0x8c, 0x8c, 0xa3, 0xf9, 0x63, 0xd4, 0xff,
+	0xa3, 0xfe, 0x1f, 0xf5, 0xff, 0xa8, 0xff, 0x47, 0xfd, 0x3f, 0xea, 0xff, 0x91, 0xe7, 0xff, 0x8b,
+	0x2d, 0x22, 0xe7, 0x46, 0x1b, 0x42, 0xc4, 0xb6, 0x97, 0x98, 0x18, 0x47, 0xf3, 0xc7, 0xa8, 0xff,
+	0x47, 0xfd, 0x3f, 0xea, 0xff, 0x51, 0xff, 0x8f, 0xfa, 0x7f, 0xd4, 0xff, 0x23, 0xcf, 0xff, 0x59,
+	0x41, 0x2f, 0x77, 0x8e, 0x36, 0x84, 0x88, 0x6d, 0x2f, 0x31, 0x33, 0x8e, 0xe6, 0x8f, 0x51, 0xff,
+	0x8f, 0xfa, 0x7f, 0xd4, 0xff, 0xa3, 0xfe, 0x1f, 0xf5, 0xff, 0xa8, 0xff, 0x47, 0x9e, 0xff, 0x7f,
+	0xcf, 0x15, 0x59, 0x3a, 0xda, 0x10, 0xc2, 0x0d, 0x00, 0x63, 0x60, 0x18, 0x05, 0x03, 0x09, 0x00,
+	0xff, 0xf8, 0x79, 0x88, 0x00, 0x09, 0x2f, 0x20, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3f, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x15, 0x20, 0x00, 0x00, 0x02, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+	0xd9, 0x7e, 0x63, 0x60, 0x18, 0x05, 0x03, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0xa6, 0x00, 0x12, 0x0a, 0x00, 0x00, 0x00, 0x22, 0x10, 0x51, 0x11, 0x02, 0x1b, 0x35,
+	0x3a, 0x71, 0x34, 0xe6, 0xbc, 0x80 };
+
+/* The same CD CHD version 5 file, where the first hunk is cdlz compressed
+ * and the compressed map is stored at offset 1384
+ */
+uint8_t odraw_test_chd_file_cd_lzma_data[ 1413 ] = {
+	0x4d, 0x43, 0x6f, 0x6d, 0x70, 0x72, 0x48, 0x44, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x05,
+	0x63, 0x64, 0x6c, 0x7a, 0x63, 0x64, 0x66, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x68,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x26, 0x40, 0x00, 0x00, 0x09, 0x90,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x48, 0x54, 0x32,
+	0x01, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x54, 0x52, 0x41, 0x43,
+	0x4b, 0x3a, 0x31, 0x20, 0x54, 0x59, 0x50, 0x45, 0x3a, 0x4d, 0x4f, 0x44, 0x45, 0x31, 0x5f, 0x52,
+	0x41, 0x57, 0x20, 0x53, 0x55, 0x42, 0x54, 0x59, 0x50, 0x45, 0x3a, 0x4e, 0x4f, 0x4e, 0x45, 0x20,
+	0x46, 0x52, 0x41, 0x4d, 0x45, 0x53, 0x3a, 0x34, 0x20, 0x50, 0x52, 0x45, 0x47, 0x41, 0x50, 0x3a,
+	0x30, 0x20, 0x50, 0x47, 0x54, 0x59, 0x50, 0x45, 0x3a, 0x4d, 0x4f, 0x44, 0x45, 0x31, 0x20, 0x50,
+	0x47, 0x53, 0x55, 0x42, 0x3a, 0x52, 0x57, 0x20, 0x50, 0x4f, 0x53, 0x54, 0x47, 0x41, 0x50, 0x3a,
+	0x30, 0x00, 0x43, 0x48, 0x54, 0x32, 0x01, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x44, 0x54, 0x52, 0x41, 0x43, 0x4b, 0x3a, 0x32, 0x20, 0x54, 0x59, 0x50, 0x45, 0x3a, 0x41,
+	0x55, 0x44, 0x49, 0x4f, 0x20, 0x53, 0x55, 0x42, 0x54, 0x59, 0x50, 0x45, 0x3a, 0x4e, 0x4f, 0x4e,
+	0x45, 0x20, 0x46, 0x52, 0x41, 0x4d, 0x45, 0x53, 0x3a, 0x34, 0x20, 0x50, 0x52, 0x45, 0x47, 0x41,
+	0x50, 0x3a, 0x30, 0x20, 0x50, 0x47, 0x54, 0x59, 0x50, 0x45, 0x3a, 0x4d, 0x4f, 0x44, 0x45, 0x31,
+	0x20, 0x50, 0x47, 0x53, 0x55, 0x42, 0x3a, 0x52, 0x57, 0x20, 0x50, 0x4f, 0x53, 0x54, 0x47, 0x41,
+	0x50, 0x3a, 0x30, 0x00, 0x43, 0x48, 0x54, 0x32, 0x01, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x54, 0x52, 0x41, 0x43, 0x4b, 0x3a, 0x33, 0x20, 0x54, 0x59, 0x50, 0x45,
+	0x3a, 0x41, 0x55, 0x44, 0x49, 0x4f, 0x20, 0x53, 0x55, 0x42, 0x54, 0x59, 0x50, 0x45, 0x3a, 0x4e,
+	0x4f, 0x4e, 0x45, 0x20, 0x46, 0x52, 0x41, 0x4d, 0x45, 0x53, 0x3a, 0x34, 0x20, 0x50, 0x52, 0x45,
+	0x47, 0x41, 0x50, 0x3a, 0x30, 0x20, 0x50, 0x47, 0x54, 0x59, 0x50, 0x45, 0x3a, 0x4d, 0x4f, 0x44,
+	0x45, 0x31, 0x20, 0x50, 0x47, 0x53, 0x55, 0x42, 0x3a, 0x52, 0x57, 0x20, 0x50, 0x4f, 0x53, 0x54,
+	0x47, 0x41, 0x50, 0x3a, 0x30, 0x00, 0x0f, 0x01, 0x4f, 0x00, 0x00, 0x6c, 0x7e, 0x8d, 0xff, 0x18,
+	0x03, 0xc0, 0x51, 0x8a, 0x2f, 0xec, 0xbf, 0x28, 0x8e, 0x44, 0xbb, 0xb1, 0x6e, 0xb4, 0xe2, 0xab,
+	0x02, 0x9b, 0x22, 0x9d, 0x90, 0x72, 0x5d, 0x6a, 0x0f, 0xd7, 0x45, 0x12, 0x72, 0x89, 0x68, 0x2f,
+	0x01, 0xe0, 0x44, 0xd6, 0x18, 0x74, 0x2d, 0xa3, 0xf5, 0x39, 0x09, 0xb8, 0xa2, 0xf4, 0x17, 0x71,
+	0x73, 0x5c, 0xb4, 0x1a, 0x07, 0x1d, 0x30, 0x31, 0x42, 0x4a, 0xf5, 0xe9, 0x57, 0xaf, 0xd3, 0xe7,
+	0xfe, 0xfe, 0xfe, 0x91, 0x97, 0x1d, 0x28, 0x18, 0x03, 0x15, 0x74, 0x6a, 0x73, 0x0d, 0x6f, 0x0e,
+	0x10, 0x52, 0xce, 0xb7, 0x79, 0x45, 0xfd, 0xb8, 0xda, 0xbe, 0x84, 0x72, 0x59, 0x79, 0x51, 0x7c,
+	0xd5, 0x10, 0x5f, 0x83, 0xae, 0x36, 0x88, 0x61, 0x16, 0x4e, 0xe2, 0x97, 0x85, 0x53, 0x9e, 0xaf,
+	0xde, 0x5f, 0x24, 0x96, 0xcc, 0x3c, 0x5d, 0xeb, 0x0a, 0x36, 0x1c, 0x51, 0x25, 0x78, 0x4d, 0x1d,
+	0xfd, 0xd3, 0x6f, 0x9b, 0x37, 0x71, 0xd4, 0x55, 0x4a, 0x31, 0xe8, 0x20, 0x85, 0xb5, 0xf1, 0x50,
+	0x08, 0x1d, 0x90, 0x58, 0x98, 0xbc, 0xde, 0xa7, 0x8b, 0xdd, 0x63, 0x33, 0xc6, 0xc6, 0xb4, 0x4a,
+	0xdf, 0xfc, 0x7c, 0x9b, 0x12, 0x32, 0xb8, 0xe7, 0x08, 0x38, 0x18, 0x55, 0x01, 0x74, 0x73, 0x33,
+	0x7c, 0x78, 0x5c, 0x93, 0xc3, 0x78, 0xc3, 0xf3, 0xd4, 0x69, 0x02, 0x33, 0xd4, 0x55, 0x52, 0x44,
+	0xa9, 0x52, 0x99, 0x93, 0xeb, 0x16, 0xb4, 0xb1, 0xac, 0x43, 0xf0, 0xb2, 0x6d, 0x2e, 0x82, 0x59,
+	0xf1, 0x42, 0xcc, 0x9a, 0x46, 0x76, 0x67, 0x03, 0x9f, 0x93, 0xb5, 0xca, 0x0a, 0xa1, 0x11, 0x05,
+	0x0e, 0x93, 0x1d, 0x96, 0xf2, 0xb7, 0x4a, 0x2b, 0x43, 0xef, 0xeb, 0x43, 0xaf, 0xd5, 0x1c, 0xb9,
+	0xd7, 0x2c, 0x07, 0x46, 0xdb, 0x49, 0x07, 0x9a, 0x42, 0x95, 0xed, 0xac, 0xcd, 0x08, 0x7d, 0x36,
+	0xa9, 0x98, 0x3d, 0xec, 0x1c, 0x8b, 0xcc, 0x7e, 0x60, 0x52, 0x03, 0x91, 0x90, 0x48, 0x7f, 0xe5,
+	0x76, 0x9f, 0xf0, 0xd2, 0x5a, 0x89, 0xb9, 0xd1, 0xbc, 0x43, 0x25, 0xd7, 0x63, 0x30, 0x1a, 0xd7,
+	0xac, 0xb7, 0xb6, 0x44, 0x24, 0x04, 0x32, 0x23, 0xde, 0xfc, 0x02, 0xb1, 0xc6, 0x5c, 0x92, 0x10,
+	0xff, 0x3e, 0x2d, 0x43, 0x3d, 0xfd, 0x65, 0xa8, 0x69, 0xe0, 0x42, 0xab, 0x23, 0x5d, 0xfe, 0x52,
+	0xf2, 0xb7, 0xcf, 0x5f, 0xfc, 0xf1, 0xc5, 0x0d, 0x63, 0x60, 0x18, 0x05, 0x03, 0x09, 0x00, 0xff,
+	0xf8, 0x79, 0x88, 0x00, 0x09, 0x2f, 0x20, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3f, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0x15, 0x20, 0x00, 0x00, 0x02, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xd9,
+	0x7e, 0x63, 0x60, 0x18, 0x05, 0x03, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0xa6, 0x53, 0x2e, 0x0a, 0x00, 0x00, 0x00, 0x22, 0x10, 0x51, 0x11, 0x02, 0x1a, 0xb3, 0x3a,
+	0x71, 0x34, 0xe6, 0xbc, 0x80 };
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Creates and opens a CHD file from test data
+ * Returns 1 if successful or -1 on error
+ */
+int odraw_test_chd_file_open_source(
+     libodraw_chd_file_t **chd_file,
+     libbfio_handle_t **file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "odraw_test_chd_file_open_source";
+
+	if( chd_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CHD file.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( odraw_test_open_file_io_handle(
+	     file_io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_chd_file_initialize(
+	     chd_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create CHD file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libodraw_chd_file_open_read(
+	     *chd_file,
+	     *file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open CHD file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *chd_file != NULL )
+	{
+		libodraw_chd_file_free(
+		 chd_file,
+		 NULL );
+	}
+	if( *file_io_handle != NULL )
+	{
+		odraw_test_close_file_io_handle(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a CHD file and closes its test data
+ * Returns 0 if successful or -1 on error
+ */
+int odraw_test_chd_file_close_source(
+     libodraw_chd_file_t **chd_file,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "odraw_test_chd_file_close_source";
+	int result            = 0;
+
+	if( libodraw_chd_file_free(
+	     chd_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free CHD file.",
+		 function );
+
+		result = -1;
+	}
+	if( odraw_test_close_file_io_handle(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Calculates the EDC checksum of the data of a CHD file
+ * The data is read in parts that are not aligned to the hunks
+ * Returns 1 if successful or -1 on error
+ */
+int odraw_test_chd_file_calculate_data_checksum(
+     libodraw_chd_file_t *chd_file,
+     uint32_t *checksum_value,
+     libcerror_error_t **error )
+{
+	uint8_t buffer[ 1000 ];
+
+	static char *function  = "odraw_test_chd_file_calculate_data_checksum";
+	ssize_t read_count     = 0;
+	off64_t offset         = 0;
+	uint32_t safe_checksum = 0;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		read_count = libodraw_chd_file_read_buffer_at_offset(
+		              chd_file,
+		              buffer,
+		              1000,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 ".",
+			 function,
+			 offset );
+
+			return( -1 );
+		}
+		if( libodraw_checksum_calculate_edc(
+		     &safe_checksum,
+		     buffer,
+		     (size_t) read_count,
+		     safe_checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			return( -1 );
+		}
+		offset += read_count;
+	}
+	while( read_count > 0 );
+
+	*checksum_value = safe_checksum;
+
+	return( 1 );
+}
+
+/* Tests the libodraw_chd_file_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_chd_file_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libodraw_chd_file_t *chd_file   = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libodraw_chd_file_initialize(
+	          &chd_file,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "chd_file",
+	 chd_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_chd_file_free(
+	          &chd_file,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "chd_file",
+	 chd_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_chd_file_initialize(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chd_file = (libodraw_chd_file_t *) 0x12345678UL;
+
+	result = libodraw_chd_file_initialize(
+	          &chd_file,
+	          &error );
+
+	chd_file = NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_chd_file_initialize with malloc failing
+		 */
+		odraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libodraw_chd_file_initialize(
+		          &chd_file,
+		          &error );
+
+		if( odraw_test_malloc_attempts_before_fail != -1 )
+		{
+			odraw_test_malloc_attempts_before_fail = -1;
+
+			if( chd_file != NULL )
+			{
+				libodraw_chd_file_free(
+				 &chd_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "chd_file",
+			 chd_file );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_chd_file_initialize with memset failing
+		 */
+		odraw_test_memset_attempts_before_fail = test_number;
+
+		result = libodraw_chd_file_initialize(
+		          &chd_file,
+		          &error );
+
+		if( odraw_test_memset_attempts_before_fail != -1 )
+		{
+			odraw_test_memset_attempts_before_fail = -1;
+
+			if( chd_file != NULL )
+			{
+				libodraw_chd_file_free(
+				 &chd_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "chd_file",
+			 chd_file );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ODRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chd_file != NULL )
+	{
+		libodraw_chd_file_free(
+		 &chd_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_chd_file_free function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_chd_file_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libodraw_chd_file_free(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_chd_file_open_read function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_chd_file_open_read(
+     void )
+{
+	uint8_t data[ 1478 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libodraw_chd_file_t *chd_file    = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = odraw_test_open_file_io_handle(
+	          &file_io_handle,
+	          odraw_test_chd_file_uncompressed_data,
+	          320,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_chd_file_initialize(
+	          &chd_file,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_chd_file_open_read(
+	          chd_file,
+	          file_io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT32(
+	 "chd_file->hunk_size",
+	 chd_file->hunk_size,
+	 (uint32_t) 64 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT32(
+	 "chd_file->number_of_hunks",
+	 chd_file->number_of_hunks,
+	 (uint32_t) 3 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "chd_file->number_of_tracks",
+	 chd_file->number_of_tracks,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libodraw_chd_file_open_read(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_chd_file_open_read(
+	          chd_file,
+	          file_io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = odraw_test_chd_file_close_source(
+	          &chd_file,
+	          &file_io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with an invalid signature
+	 */
+	result = memory_copy(
+	          data,
+	          odraw_test_chd_file_uncompressed_data,
+	          320 ) != NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	data[ 0 ] = (uint8_t) 'X';
+
+	result = odraw_test_chd_file_open_source(
+	          &chd_file,
+	          &file_io_handle,
+	          data,
+	          320,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open with a corrupted compressed map checksum
+	 */
+	result = memory_copy(
+	          data,
+	          odraw_test_chd_file_cd_zlib_data,
+	          1478 ) != NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	data[ 1459 ] ^= 0xff;
+
+	result = odraw_test_chd_file_open_source(
+	          &chd_file,
+	          &file_io_handle,
+	          data,
+	          1478,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open with data too small
+	 */
+	result = odraw_test_chd_file_open_source(
+	          &chd_file,
+	          &file_io_handle,
+	          odraw_test_chd_file_uncompressed_data,
+	          100,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chd_file != NULL )
+	{
+		libodraw_chd_file_free(
+		 &chd_file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_chd_file_read_track_metadata function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_chd_file_read_track_metadata(
+     void )
+{
+	uint8_t audio_track_metadata[ 43 ] = {
+		'T', 'R', 'A', 'C', 'K', ':', '1', ' ', 'T', 'Y', 'P', 'E', ':', 'A', 'U', 'D',
+		'I', 'O', ' ', 'S', 'U', 'B', 'T', 'Y', 'P', 'E', ':', 'N', 'O', 'N', 'E', ' ',
+		'F', 'R', 'A', 'M', 'E', 'S', ':', '1', '5', '0', 0 };
+
+	uint8_t invalid_track_metadata[ 28 ] = {
+		'T', 'R', 'A', 'C', 'K', ':', '1', ' ', 'T', 'Y', 'P', 'E', ':', 'U', 'N', 'K',
+		'N', 'O', 'W', 'N', ' ', 'F', 'R', 'A', 'M', 'E', 'S', 0 };
+
+	libcerror_error_t *error      = NULL;
+	libodraw_chd_file_t *chd_file = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_chd_file_initialize(
+	          &chd_file,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_chd_file_read_track_metadata(
+	          chd_file,
+	          audio_track_metadata,
+	          43,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "chd_file->number_of_tracks",
+	 chd_file->number_of_tracks,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT32(
+	 "chd_file->tracks[ 0 ].number_of_frames",
+	 chd_file->tracks[ 0 ].number_of_frames,
+	 (uint32_t) 150 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT32(
+	 "chd_file->tracks[ 0 ].bytes_per_frame",
+	 chd_file->tracks[ 0 ].bytes_per_frame,
+	 (uint32_t) 2352 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "chd_file->tracks[ 0 ].is_audio",
+	 chd_file->tracks[ 0 ].is_audio,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libodraw_chd_file_read_track_metadata(
+	          NULL,
+	          audio_track_metadata,
+	          43,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_chd_file_read_track_metadata(
+	          chd_file,
+	          NULL,
+	          43,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_chd_file_read_track_metadata(
+	          chd_file,
+	          invalid_track_metadata,
+	          28,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_chd_file_free(
+	          &chd_file,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chd_file != NULL )
+	{
+		libodraw_chd_file_free(
+		 &chd_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_chd_file_read_hunk function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_chd_file_read_hunk(
+     void )
+{
+	uint8_t hunk_data[ 9792 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libodraw_chd_file_t *chd_file    = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+	uint8_t data[ 1478 ];
+	uint8_t self_reference_hunk_data[ 9792 ];
+#endif
+
+	/* Test regular cases
+	 */
+	result = odraw_test_chd_file_open_source(
+	          &chd_file,
+	          &file_io_handle,
+	          odraw_test_chd_file_uncompressed_data,
+	          320,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "chd_file",
+	 chd_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_chd_file_read_hunk(
+	          chd_file,
+	          2,
+	          hunk_data,
+	          64,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hunk_data,
+	          &( odraw_test_chd_file_uncompressed_data[ 256 ] ),
+	          64 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libodraw_chd_file_read_hunk(
+	          NULL,
+	          0,
+	          hunk_data,
+	          64,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_chd_file_read_hunk(
+	          chd_file,
+	          3,
+	          hunk_data,
+	          64,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_chd_file_read_hunk(
+	          chd_file,
+	          0,
+	          NULL,
+	          64,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_chd_file_read_hunk(
+	          chd_file,
+	          0,
+	          hunk_data,
+	          63,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = odraw_test_chd_file_close_source(
+	          &chd_file,
+	          &file_io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+
+	/* Test reading a self reference to a cdfl compressed hunk
+	 */
+	result = odraw_test_chd_file_open_source(
+	          &chd_file,
+	          &file_io_handle,
+	          odraw_test_chd_file_cd_zlib_data,
+	          1478,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "chd_file",
+	 chd_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_chd_file_read_hunk(
+	          chd_file,
+	          1,
+	          hunk_data,
+	          9792,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_chd_file_read_hunk(
+	          chd_file,
+	          2,
+	          self_reference_hunk_data,
+	          9792,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hunk_data,
+	          self_reference_hunk_data,
+	          9792 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The audio samples are stored in big-endian
+	 */
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "hunk_data[ 5 ]",
+	 hunk_data[ 5 ],
+	 (uint8_t) 0x03 );
+
+	result = odraw_test_chd_file_close_source(
+	          &chd_file,
+	          &file_io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading a cdfl compressed hunk with a corrupted checksum
+	 */
+	result = memory_copy(
+	          data,
+	          odraw_test_chd_file_cd_zlib_data,
+	          1478 ) != NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	data[ 1429 ] ^= 0x01;
+
+	result = odraw_test_chd_file_open_source(
+	          &chd_file,
+	          &file_io_handle,
+	          data,
+	          1478,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "chd_file",
+	 chd_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_chd_file_read_hunk(
+	          chd_file,
+	          1,
+	          hunk_data,
+	          9792,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = odraw_test_chd_file_close_source(
+	          &chd_file,
+	          &file_io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( HAVE_ZLIB ) || defined( ZLIB_DLL ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chd_file != NULL )
+	{
+		libodraw_chd_file_free(
+		 &chd_file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_chd_file_decompress_cd_hunk function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_chd_file_decompress_cd_hunk(
+     void )
+{
+	uint8_t compressed_data[ 4 ] = {
+		0x00, 0x00, 0x10, 0x00 };
+
+	uint8_t hunk_data[ 2448 ];
+
+	libcerror_error_t *error      = NULL;
+	libodraw_chd_file_t *chd_file = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_chd_file_initialize(
+	          &chd_file,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_chd_file_decompress_cd_hunk(
+	          NULL,
+	          compressed_data,
+	          4,
+	          LIBODRAW_COMPRESSION_METHOD_DEFLATE,
+	          hunk_data,
+	          2448,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_chd_file_decompress_cd_hunk(
+	          chd_file,
+	          NULL,
+	          4,
+	          LIBODRAW_COMPRESSION_METHOD_DEFLATE,
+	          hunk_data,
+	          2448,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_chd_file_decompress_cd_hunk(
+	          chd_file,
+	          compressed_data,
+	          4,
+	          LIBODRAW_COMPRESSION_METHOD_DEFLATE,
+	          NULL,
+	          2448,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_chd_file_decompress_cd_hunk(
+	          chd_file,
+	          compressed_data,
+	          4,
+	          LIBODRAW_COMPRESSION_METHOD_DEFLATE,
+	          hunk_data,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_chd_file_decompress_cd_hunk(
+	          chd_file,
+	          compressed_data,
+	          4,
+	          LIBODRAW_COMPRESSION_METHOD_DEFLATE,
+	          hunk_data,
+	          2447,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with compressed data too small for the header
+	 */
+	result = libodraw_chd_file_decompress_cd_hunk(
+	          chd_file,
+	          compressed_data,
+	          2,
+	          LIBODRAW_COMPRESSION_METHOD_DEFLATE,
+	          hunk_data,
+	          2448,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a compressed sector data size that exceeds the compressed data
+	 */
+	result = libodraw_chd_file_decompress_cd_hunk(
+	          chd_file,
+	          compressed_data,
+	          4,
+	          LIBODRAW_COMPRESSION_METHOD_DEFLATE,
+	          hunk_data,
+	          2448,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with FLAC compressed data without frames
+	 */
+	result = libodraw_chd_file_decompress_cd_hunk(
+	          chd_file,
+	          compressed_data,
+	          4,
+	          LIBODRAW_COMPRESSION_METHOD_FLAC,
+	          hunk_data,
+	          2448,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_chd_file_free(
+	          &chd_file,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chd_file != NULL )
+	{
+		libodraw_chd_file_free(
+		 &chd_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_chd_file_decompress_flac_hunk function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_chd_file_decompress_flac_hunk(
+     void )
+{
+	uint8_t compressed_data[ 4 ] = {
+		'L', 0x00, 0x00, 0x00 };
+
+	uint8_t hunk_data[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libodraw_chd_file_decompress_flac_hunk(
+	          NULL,
+	          4,
+	          hunk_data,
+	          16,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_chd_file_decompress_flac_hunk(
+	          compressed_data,
+	          0,
+	          hunk_data,
+	          16,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_chd_file_decompress_flac_hunk(
+	          compressed_data,
+	          4,
+	          NULL,
+	          16,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported byte order
+	 */
+	compressed_data[ 0 ] = (uint8_t) 'X';
+
+	result = libodraw_chd_file_decompress_flac_hunk(
+	          compressed_data,
+	          4,
+	          hunk_data,
+	          16,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an invalid FLAC frame
+	 */
+	compressed_data[ 0 ] = (uint8_t) 'B';
+
+	result = libodraw_chd_file_decompress_flac_hunk(
+	          compressed_data,
+	          4,
+	          hunk_data,
+	          16,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_chd_file_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_chd_file_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ 64 ];
+	uint8_t data[ 320 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libodraw_chd_file_t *chd_file    = NULL;
+	ssize_t read_count               = 0;
+	uint32_t checksum_value          = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = odraw_test_chd_file_open_source(
+	          &chd_file,
+	          &file_io_handle,
+	          odraw_test_chd_file_uncompressed_data,
+	          320,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "chd_file",
+	 chd_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = odraw_test_chd_file_calculate_data_checksum(
+	          chd_file,
+	          &checksum_value,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0x97ba7124UL );
+
+	/* The second hunk is not stored and reads as zero bytes
+	 */
+	read_count = libodraw_chd_file_read_buffer_at_offset(
+	              chd_file,
+	              buffer,
+	              64,
+	              96,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 0 ]",
+	 buffer[ 0 ],
+	 (uint8_t) 0x00 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 32 ]",
+	 buffer[ 32 ],
+	 odraw_test_chd_file_uncompressed_data[ 256 ] );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading beyond the end of the data
+	 */
+	read_count = libodraw_chd_file_read_buffer_at_offset(
+	              chd_file,
+	              buffer,
+	              64,
+	              192,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libodraw_chd_file_read_buffer_at_offset(
+	              NULL,
+	              buffer,
+	              64,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libodraw_chd_file_read_buffer_at_offset(
+	              chd_file,
+	              NULL,
+	              64,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libodraw_chd_file_read_buffer_at_offset(
+	              chd_file,
+	              buffer,
+	              64,
+	              -1,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = odraw_test_chd_file_close_source(
+	          &chd_file,
+	          &file_io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading a hunk with an offset beyond the end of the file
+	 */
+	result = memory_copy(
+	          data,
+	          odraw_test_chd_file_uncompressed_data,
+	          320 ) != NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( data[ 136 ] ),
+	 0x00000100UL );
+
+	result = odraw_test_chd_file_open_source(
+	          &chd_file,
+	          &file_io_handle,
+	          data,
+	          320,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "chd_file",
+	 chd_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libodraw_chd_file_read_buffer_at_offset(
+	              chd_file,
+	              buffer,
+	              64,
+	              128,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = odraw_test_chd_file_close_source(
+	          &chd_file,
+	          &file_io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+
+	/* Test reading cdzl and cdfl compressed CD data
+	 */
+	result = odraw_test_chd_file_open_source(
+	          &chd_file,
+	          &file_io_handle,
+	          odraw_test_chd_file_cd_zlib_data,
+	          1478,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "chd_file",
+	 chd_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = odraw_test_chd_file_calculate_data_checksum(
+	          chd_file,
+	          &checksum_value,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0x3e29a8b5UL );
+
+	/* The audio samples are exposed in little-endian
+	 */
+	read_count = libodraw_chd_file_read_buffer_at_offset(
+	              chd_file,
+	              buffer,
+	              8,
+	              9408,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 4 ]",
+	 buffer[ 4 ],
+	 (uint8_t) 0x03 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 6 ]",
+	 buffer[ 6 ],
+	 (uint8_t) 0xfb );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = odraw_test_chd_file_close_source(
+	          &chd_file,
+	          &file_io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_LIBLZMA )
+
+	/* Test reading cdlz and cdfl compressed CD data
+	 */
+	result = odraw_test_chd_file_open_source(
+	          &chd_file,
+	          &file_io_handle,
+	          odraw_test_chd_file_cd_lzma_data,
+	          1413,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "chd_file",
+	 chd_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = odraw_test_chd_file_calculate_data_checksum(
+	          chd_file,
+	          &checksum_value,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0x3e29a8b5UL );
+
+	result = odraw_test_chd_file_close_source(
+	          &chd_file,
+	          &file_io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( HAVE_LIBLZMA ) */
+#endif /* defined( HAVE_ZLIB ) || defined( ZLIB_DLL ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chd_file != NULL )
+	{
+		libodraw_chd_file_free(
+		 &chd_file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_chd_file_get_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_chd_file_get_data_size(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libodraw_chd_file_t *chd_file    = NULL;
+	size64_t data_size               = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = odraw_test_chd_file_open_source(
+	          &chd_file,
+	          &file_io_handle,
+	          odraw_test_chd_file_uncompressed_data,
+	          320,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "chd_file",
+	 chd_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_chd_file_get_data_size(
+	          chd_file,
+	          &data_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 data_size,
+	 (uint64_t) 192 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = odraw_test_chd_file_close_source(
+	          &chd_file,
+	          &file_io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The exposed data of a CD consists of the sector data of the tracks
+	 */
+	result = odraw_test_chd_file_open_source(
+	          &chd_file,
+	          &file_io_handle,
+	          odraw_test_chd_file_cd_zlib_data,
+	          1478,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "chd_file",
+	 chd_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_chd_file_get_data_size(
+	          chd_file,
+	          &data_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 data_size,
+	 (uint64_t) 28224 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_chd_file_get_data_size(
+	          NULL,
+	          &data_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_chd_file_get_data_size(
+	          chd_file,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = odraw_test_chd_file_close_source(
+	          &chd_file,
+	          &file_io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chd_file != NULL )
+	{
+		libodraw_chd_file_free(
+		 &chd_file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_chd_file_initialize",
+	 odraw_test_chd_file_initialize );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_chd_file_free",
+	 odraw_test_chd_file_free );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_chd_file_open_read",
+	 odraw_test_chd_file_open_read );
+
+	/* TODO: add tests for libodraw_chd_file_read_file_header */
+
+	/* TODO: add tests for libodraw_chd_file_read_hunk_map */
+
+	/* TODO: add tests for libodraw_chd_file_read_compressed_hunk_map */
+
+	/* TODO: add tests for libodraw_chd_file_read_metadata */
+
+	ODRAW_TEST_RUN(
+	 "libodraw_chd_file_read_track_metadata",
+	 odraw_test_chd_file_read_track_metadata );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_chd_file_read_hunk",
+	 odraw_test_chd_file_read_hunk );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_chd_file_decompress_cd_hunk",
+	 odraw_test_chd_file_decompress_cd_hunk );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_chd_file_decompress_flac_hunk",
+	 odraw_test_chd_file_decompress_flac_hunk );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_chd_file_read_buffer_at_offset",
+	 odraw_test_chd_file_read_buffer_at_offset );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_chd_file_get_data_size",
+	 odraw_test_chd_file_get_data_size );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,805 @@
+/*
+ * Library checksum functions test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_checksum.h"
+
+uint8_t odraw_test_checksum_crc16_data[ 9 ] = {
+	'1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+/* The expected start of the P and Q parity of a mode 1 sector
+ * with the address 00:02:00 and data bytes 0x00 - 0xff repeated
+ */
+uint8_t odraw_test_checksum_p_parity[ 8 ] = {
+	0x42, 0x13, 0xc7, 0x94, 0x21, 0x72, 0xd5, 0x86 };
+
+uint8_t odraw_test_checksum_q_parity[ 8 ] = {
+	0x46, 0xe9, 0x44, 0x86, 0xf1, 0x2a, 0xe2, 0x0b };
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Tests the libodraw_checksum_calculate_crc16 function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_checksum_calculate_crc16(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint16_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libodraw_checksum_calculate_crc16(
+	          &checksum_value,
+	          odraw_test_checksum_crc16_data,
+	          9,
+	          0xffff,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT16(
+	 "checksum_value",
+	 checksum_value,
+	 (uint16_t) 0x29b1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test calculating the checksum in multiple parts
+	 */
+	result = libodraw_checksum_calculate_crc16(
+	          &checksum_value,
+	          odraw_test_checksum_crc16_data,
+	          4,
+	          0xffff,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_checksum_calculate_crc16(
+	          &checksum_value,
+	          &( odraw_test_checksum_crc16_data[ 4 ] ),
+	          5,
+	          checksum_value,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT16(
+	 "checksum_value",
+	 checksum_value,
+	 (uint16_t) 0x29b1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_checksum_calculate_crc16(
+	          NULL,
+	          odraw_test_checksum_crc16_data,
+	          9,
+	          0xffff,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_checksum_calculate_crc16(
+	          &checksum_value,
+	          NULL,
+	          9,
+	          0xffff,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_checksum_calculate_crc16(
+	          &checksum_value,
+	          odraw_test_checksum_crc16_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0xffff,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_checksum_calculate_crc8 function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_checksum_calculate_crc8(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t checksum_value   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libodraw_checksum_calculate_crc8(
+	          &checksum_value,
+	          odraw_test_checksum_crc16_data,
+	          9,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "checksum_value",
+	 checksum_value,
+	 (uint8_t) 0xf4 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test calculating the checksum in multiple parts
+	 */
+	result = libodraw_checksum_calculate_crc8(
+	          &checksum_value,
+	          odraw_test_checksum_crc16_data,
+	          4,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_checksum_calculate_crc8(
+	          &checksum_value,
+	          &( odraw_test_checksum_crc16_data[ 4 ] ),
+	          5,
+	          checksum_value,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "checksum_value",
+	 checksum_value,
+	 (uint8_t) 0xf4 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_checksum_calculate_crc8(
+	          NULL,
+	          odraw_test_checksum_crc16_data,
+	          9,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_checksum_calculate_crc8(
+	          &checksum_value,
+	          NULL,
+	          9,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_checksum_calculate_crc8(
+	          &checksum_value,
+	          odraw_test_checksum_crc16_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_checksum_calculate_crc16_ibm function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_checksum_calculate_crc16_ibm(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint16_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libodraw_checksum_calculate_crc16_ibm(
+	          &checksum_value,
+	          odraw_test_checksum_crc16_data,
+	          9,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT16(
+	 "checksum_value",
+	 checksum_value,
+	 (uint16_t) 0xfee8 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test calculating the checksum in multiple parts
+	 */
+	result = libodraw_checksum_calculate_crc16_ibm(
+	          &checksum_value,
+	          odraw_test_checksum_crc16_data,
+	          4,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_checksum_calculate_crc16_ibm(
+	          &checksum_value,
+	          &( odraw_test_checksum_crc16_data[ 4 ] ),
+	          5,
+	          checksum_value,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT16(
+	 "checksum_value",
+	 checksum_value,
+	 (uint16_t) 0xfee8 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_checksum_calculate_crc16_ibm(
+	          NULL,
+	          odraw_test_checksum_crc16_data,
+	          9,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_checksum_calculate_crc16_ibm(
+	          &checksum_value,
+	          NULL,
+	          9,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_checksum_calculate_crc16_ibm(
+	          &checksum_value,
+	          odraw_test_checksum_crc16_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_checksum_calculate_edc function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_checksum_calculate_edc(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libodraw_checksum_calculate_edc(
+	          &checksum_value,
+	          odraw_test_checksum_crc16_data,
+	          9,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0x6ec2edc4UL );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test calculating the checksum in multiple parts
+	 */
+	result = libodraw_checksum_calculate_edc(
+	          &checksum_value,
+	          odraw_test_checksum_crc16_data,
+	          4,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_checksum_calculate_edc(
+	          &checksum_value,
+	          &( odraw_test_checksum_crc16_data[ 4 ] ),
+	          5,
+	          checksum_value,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0x6ec2edc4UL );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_checksum_calculate_edc(
+	          NULL,
+	          odraw_test_checksum_crc16_data,
+	          9,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_checksum_calculate_edc(
+	          &checksum_value,
+	          NULL,
+	          9,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_checksum_calculate_edc(
+	          &checksum_value,
+	          odraw_test_checksum_crc16_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_checksum_calculate_ecc function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_checksum_calculate_ecc(
+     void )
+{
+	uint8_t sector_data[ 2352 ];
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = 0;
+
+	if( memory_set(
+	     sector_data,
+	     0,
+	     2352 ) != NULL )
+	{
+		result = 1;
+	}
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( data_offset = 1;
+	     data_offset < 11;
+	     data_offset++ )
+	{
+		sector_data[ data_offset ] = 0xff;
+	}
+	sector_data[ 13 ] = 0x02;
+	sector_data[ 15 ] = 0x01;
+
+	for( data_offset = 0;
+	     data_offset < 2048;
+	     data_offset++ )
+	{
+		sector_data[ 16 + data_offset ] = (uint8_t) ( data_offset & 0xff );
+	}
+	/* Test regular cases
+	 */
+	result = libodraw_checksum_calculate_ecc(
+	          sector_data,
+	          2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( sector_data[ 2076 ] ),
+	          odraw_test_checksum_p_parity,
+	          8 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( sector_data[ 2248 ] ),
+	          odraw_test_checksum_q_parity,
+	          8 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libodraw_checksum_calculate_ecc(
+	          NULL,
+	          2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_checksum_calculate_ecc(
+	          sector_data,
+	          2048,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	/* TODO: add tests for libodraw_checksum_initialize_crc16_table */
+
+	ODRAW_TEST_RUN(
+	 "libodraw_checksum_calculate_crc16",
+	 odraw_test_checksum_calculate_crc16 );
+
+	/* TODO: add tests for libodraw_checksum_initialize_crc8_table */
+
+	ODRAW_TEST_RUN(
+	 "libodraw_checksum_calculate_crc8",
+	 odraw_test_checksum_calculate_crc8 );
+
+	/* TODO: add tests for libodraw_checksum_initialize_crc16_ibm_table */
+
+	ODRAW_TEST_RUN(
+	 "libodraw_checksum_calculate_crc16_ibm",
+	 odraw_test_checksum_calculate_crc16_ibm );
+
+	/* TODO: add tests for libodraw_checksum_initialize_edc_table */
+
+	ODRAW_TEST_RUN(
+	 "libodraw_checksum_calculate_edc",
+	 odraw_test_checksum_calculate_edc );
+
+	/* TODO: add tests for libodraw_checksum_initialize_ecc_tables */
+
+	/* TODO: add tests for libodraw_checksum_calculate_ecc_parity */
+
+	ODRAW_TEST_RUN(
+	 "libodraw_checksum_calculate_ecc",
+	 odraw_test_checksum_calculate_ecc );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
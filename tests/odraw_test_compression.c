@@ -0,0 +1,249 @@
+/*
+ * Library compression functions test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_compression.h"
+#include "../libodraw/libodraw_definitions.h"
+
+/* Raw deflate compressed data of "libodraw compressed data test " repeated 4 times
+ */
+uint8_t odraw_test_compression_deflate_data[ 35 ] = {
+	0xcb, 0xc9, 0x4c, 0xca, 0x4f, 0x29, 0x4a, 0x2c, 0x57, 0x48, 0xce, 0xcf, 0x2d, 0x28, 0x4a, 0x2d,
+	0x2e, 0x4e, 0x4d, 0x51, 0x48, 0x49, 0x2c, 0x49, 0x54, 0x28, 0x49, 0x2d, 0x2e, 0x51, 0xc8, 0xa1,
+	0x99, 0x2c, 0x00 };
+
+uint8_t odraw_test_compression_uncompressed_data[ 31 ] = {
+	'l', 'i', 'b', 'o', 'd', 'r', 'a', 'w', ' ', 'c', 'o', 'm', 'p', 'r', 'e', 's',
+	's', 'e', 'd', ' ', 'd', 'a', 't', 'a', ' ', 't', 'e', 's', 't', ' ', 0 };
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Tests the libodraw_decompress_data function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_decompress_data(
+     void )
+{
+	uint8_t uncompressed_data[ 120 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+	size_t data_offset       = 0;
+#endif
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+
+	/* Test regular cases
+	 */
+	result = libodraw_decompress_data(
+	          odraw_test_compression_deflate_data,
+	          35,
+	          LIBODRAW_COMPRESSION_METHOD_DEFLATE,
+	          uncompressed_data,
+	          120,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 120;
+	     data_offset += 30 )
+	{
+		result = memory_compare(
+		          &( uncompressed_data[ data_offset ] ),
+		          odraw_test_compression_uncompressed_data,
+		          30 );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test decompressing only the start of the compressed data
+	 */
+	result = libodraw_decompress_data(
+	          odraw_test_compression_deflate_data,
+	          35,
+	          LIBODRAW_COMPRESSION_METHOD_DEFLATE,
+	          uncompressed_data,
+	          119,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_decompress_data(
+	          odraw_test_compression_deflate_data,
+	          20,
+	          LIBODRAW_COMPRESSION_METHOD_DEFLATE,
+	          uncompressed_data,
+	          120,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#endif /* defined( HAVE_ZLIB ) || defined( ZLIB_DLL ) */
+
+	/* Test error cases
+	 */
+	result = libodraw_decompress_data(
+	          NULL,
+	          35,
+	          LIBODRAW_COMPRESSION_METHOD_DEFLATE,
+	          uncompressed_data,
+	          120,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_decompress_data(
+	          odraw_test_compression_deflate_data,
+	          35,
+	          LIBODRAW_COMPRESSION_METHOD_DEFLATE,
+	          NULL,
+	          120,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_decompress_data(
+	          odraw_test_compression_deflate_data,
+	          35,
+	          -1,
+	          uncompressed_data,
+	          120,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_decompress_data",
+	 odraw_test_decompress_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1272 @@
+/*
+ * CUE file test corpus functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_cue_corpus.h"
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+
+/* The number of sectors of a track is determined by the INDEX 01 command of the next track
+ * or a REM LEAD-OUT or REM RUN-OUT command. The last track has 0 sectors since its size
+ * is determined by the size of its data file.
+ */
+
+/* The expected values of cue_parser.1
+ */
+const odraw_test_cue_corpus_data_file_t odraw_test_cue_corpus_file1_data_files[ 1 ] = {
+	{ "data.wav", LIBODRAW_FILE_TYPE_UNKNOWN }
+};
+
+/* The expected values of cue_parser.3
+ */
+const odraw_test_cue_corpus_data_file_t odraw_test_cue_corpus_file3_data_files[ 1 ] = {
+	{ "data.cdr", LIBODRAW_FILE_TYPE_UNKNOWN }
+};
+
+/* The expected values of cue_parser.4
+ */
+const odraw_test_cue_corpus_data_file_t odraw_test_cue_corpus_file4_data_files[ 1 ] = {
+	{ "pregapdata.wav", LIBODRAW_FILE_TYPE_UNKNOWN }
+};
+
+/* The expected values of cue_parser.6
+ */
+const odraw_test_cue_corpus_data_file_t odraw_test_cue_corpus_file6_data_files[ 1 ] = {
+	{ "tracks.bin", LIBODRAW_FILE_TYPE_BINARY_LITTLE_ENDIAN }
+};
+
+const odraw_test_cue_corpus_track_t odraw_test_cue_corpus_file6_tracks[ 99 ] = {
+	{ 0, 2273, LIBODRAW_TRACK_TYPE_MODE1_2352, 0, 0 },
+	{ 2273, 3196, LIBODRAW_TRACK_TYPE_AUDIO, 0, 2273 },
+	{ 5469, 3669, LIBODRAW_TRACK_TYPE_AUDIO, 0, 5469 },
+	{ 9138, 2092, LIBODRAW_TRACK_TYPE_AUDIO, 0, 9138 },
+	{ 11230, 3015, LIBODRAW_TRACK_TYPE_AUDIO, 0, 11230 },
+	{ 14245, 3488, LIBODRAW_TRACK_TYPE_AUDIO, 0, 14245 },
+	{ 17733, 1911, LIBODRAW_TRACK_TYPE_AUDIO, 0, 17733 },
+	{ 19644, 2834, LIBODRAW_TRACK_TYPE_AUDIO, 0, 19644 },
+	{ 22478, 3307, LIBODRAW_TRACK_TYPE_AUDIO, 0, 22478 },
+	{ 25785, 1730, LIBODRAW_TRACK_TYPE_AUDIO, 0, 25785 },
+	{ 27515, 2653, LIBODRAW_TRACK_TYPE_AUDIO, 0, 27515 },
+	{ 30168, 3126, LIBODRAW_TRACK_TYPE_AUDIO, 0, 30168 },
+	{ 33294, 1549, LIBODRAW_TRACK_TYPE_AUDIO, 0, 33294 },
+	{ 34843, 2472, LIBODRAW_TRACK_TYPE_AUDIO, 0, 34843 },
+	{ 37315, 2945, LIBODRAW_TRACK_TYPE_AUDIO, 0, 37315 },
+	{ 40260, 3868, LIBODRAW_TRACK_TYPE_AUDIO, 0, 40260 },
+	{ 44128, 2291, LIBODRAW_TRACK_TYPE_AUDIO, 0, 44128 },
+	{ 46419, 2764, LIBODRAW_TRACK_TYPE_AUDIO, 0, 46419 },
+	{ 49183, 3687, LIBODRAW_TRACK_TYPE_AUDIO, 0, 49183 },
+	{ 52870, 2110, LIBODRAW_TRACK_TYPE_AUDIO, 0, 52870 },
+	{ 54980, 2583, LIBODRAW_TRACK_TYPE_AUDIO, 0, 54980 },
+	{ 57563, 3506, LIBODRAW_TRACK_TYPE_AUDIO, 0, 57563 },
+	{ 61069, 1929, LIBODRAW_TRACK_TYPE_AUDIO, 0, 61069 },
+	{ 62998, 2402, LIBODRAW_TRACK_TYPE_AUDIO, 0, 62998 },
+	{ 65400, 3325, LIBODRAW_TRACK_TYPE_AUDIO, 0, 65400 },
+	{ 68725, 1748, LIBODRAW_TRACK_TYPE_AUDIO, 0, 68725 },
+	{ 70473, 2221, LIBODRAW_TRACK_TYPE_AUDIO, 0, 70473 },
+	{ 72694, 3144, LIBODRAW_TRACK_TYPE_AUDIO, 0, 72694 },
+	{ 75838, 4067, LIBODRAW_TRACK_TYPE_AUDIO, 0, 75838 },
+	{ 79905, 2040, LIBODRAW_TRACK_TYPE_AUDIO, 0, 79905 },
+	{ 81945, 2963, LIBODRAW_TRACK_TYPE_AUDIO, 0, 81945 },
+	{ 84908, 3886, LIBODRAW_TRACK_TYPE_AUDIO, 0, 84908 },
+	{ 88794, 1859, LIBODRAW_TRACK_TYPE_AUDIO, 0, 88794 },
+	{ 90653, 2782, LIBODRAW_TRACK_TYPE_AUDIO, 0, 90653 },
+	{ 93435, 3705, LIBODRAW_TRACK_TYPE_AUDIO, 0, 93435 },
+	{ 97140, 1678, LIBODRAW_TRACK_TYPE_AUDIO, 0, 97140 },
+	{ 98818, 2601, LIBODRAW_TRACK_TYPE_AUDIO, 0, 98818 },
+	{ 101419, 3524, LIBODRAW_TRACK_TYPE_AUDIO, 0, 101419 },
+	{ 104943, 1497, LIBODRAW_TRACK_TYPE_AUDIO, 0, 104943 },
+	{ 106440, 2420, LIBODRAW_TRACK_TYPE_AUDIO, 0, 106440 },
+	{ 108860, 3343, LIBODRAW_TRACK_TYPE_AUDIO, 0, 108860 },
+	{ 112203, 3816, LIBODRAW_TRACK_TYPE_AUDIO, 0, 112203 },
+	{ 116019, 2239, LIBODRAW_TRACK_TYPE_AUDIO, 0, 116019 },
+	{ 118258, 3162, LIBODRAW_TRACK_TYPE_AUDIO, 0, 118258 },
+	{ 121420, 3635, LIBODRAW_TRACK_TYPE_AUDIO, 0, 121420 },
+	{ 125055, 2058, LIBODRAW_TRACK_TYPE_AUDIO, 0, 125055 },
+	{ 127113, 2981, LIBODRAW_TRACK_TYPE_AUDIO, 0, 127113 },
+	{ 130094, 3454, LIBODRAW_TRACK_TYPE_AUDIO, 0, 130094 },
+	{ 133548, 1877, LIBODRAW_TRACK_TYPE_AUDIO, 0, 133548 },
+	{ 135425, 2800, LIBODRAW_TRACK_TYPE_AUDIO, 0, 135425 },
+	{ 138225, 3273, LIBODRAW_TRACK_TYPE_AUDIO, 0, 138225 },
+	{ 141498, 1696, LIBODRAW_TRACK_TYPE_AUDIO, 0, 141498 },
+	{ 143194, 2619, LIBODRAW_TRACK_TYPE_AUDIO, 0, 143194 },
+	{ 145813, 3092, LIBODRAW_TRACK_TYPE_AUDIO, 0, 145813 },
+	{ 148905, 1515, LIBODRAW_TRACK_TYPE_AUDIO, 0, 148905 },
+	{ 150420, 2438, LIBODRAW_TRACK_TYPE_AUDIO, 0, 150420 },
+	{ 152858, 2911, LIBODRAW_TRACK_TYPE_AUDIO, 0, 152858 },
+	{ 155769, 3834, LIBODRAW_TRACK_TYPE_AUDIO, 0, 155769 },
+	{ 159603, 2257, LIBODRAW_TRACK_TYPE_AUDIO, 0, 159603 },
+	{ 161860, 2730, LIBODRAW_TRACK_TYPE_AUDIO, 0, 161860 },
+	{ 164590, 3653, LIBODRAW_TRACK_TYPE_AUDIO, 0, 164590 },
+	{ 168243, 2076, LIBODRAW_TRACK_TYPE_AUDIO, 0, 168243 },
+	{ 170319, 2549, LIBODRAW_TRACK_TYPE_AUDIO, 0, 170319 },
+	{ 172868, 3472, LIBODRAW_TRACK_TYPE_AUDIO, 0, 172868 },
+	{ 176340, 1895, LIBODRAW_TRACK_TYPE_AUDIO, 0, 176340 },
+	{ 178235, 2368, LIBODRAW_TRACK_TYPE_AUDIO, 0, 178235 },
+	{ 180603, 3291, LIBODRAW_TRACK_TYPE_AUDIO, 0, 180603 },
+	{ 183894, 1714, LIBODRAW_TRACK_TYPE_AUDIO, 0, 183894 },
+	{ 185608, 2187, LIBODRAW_TRACK_TYPE_AUDIO, 0, 185608 },
+	{ 187795, 3110, LIBODRAW_TRACK_TYPE_AUDIO, 0, 187795 },
+	{ 190905, 4033, LIBODRAW_TRACK_TYPE_AUDIO, 0, 190905 },
+	{ 194938, 2006, LIBODRAW_TRACK_TYPE_AUDIO, 0, 194938 },
+	{ 196944, 2929, LIBODRAW_TRACK_TYPE_AUDIO, 0, 196944 },
+	{ 199873, 3852, LIBODRAW_TRACK_TYPE_AUDIO, 0, 199873 },
+	{ 203725, 1825, LIBODRAW_TRACK_TYPE_AUDIO, 0, 203725 },
+	{ 205550, 2748, LIBODRAW_TRACK_TYPE_AUDIO, 0, 205550 },
+	{ 208298, 3671, LIBODRAW_TRACK_TYPE_AUDIO, 0, 208298 },
+	{ 211969, 1644, LIBODRAW_TRACK_TYPE_AUDIO, 0, 211969 },
+	{ 213613, 2567, LIBODRAW_TRACK_TYPE_AUDIO, 0, 213613 },
+	{ 216180, 3490, LIBODRAW_TRACK_TYPE_AUDIO, 0, 216180 },
+	{ 219670, 1463, LIBODRAW_TRACK_TYPE_AUDIO, 0, 219670 },
+	{ 221133, 2386, LIBODRAW_TRACK_TYPE_AUDIO, 0, 221133 },
+	{ 223519, 3309, LIBODRAW_TRACK_TYPE_AUDIO, 0, 223519 },
+	{ 226828, 3782, LIBODRAW_TRACK_TYPE_AUDIO, 0, 226828 },
+	{ 230610, 2205, LIBODRAW_TRACK_TYPE_AUDIO, 0, 230610 },
+	{ 232815, 3128, LIBODRAW_TRACK_TYPE_AUDIO, 0, 232815 },
+	{ 235943, 3601, LIBODRAW_TRACK_TYPE_AUDIO, 0, 235943 },
+	{ 239544, 2024, LIBODRAW_TRACK_TYPE_AUDIO, 0, 239544 },
+	{ 241568, 2947, LIBODRAW_TRACK_TYPE_AUDIO, 0, 241568 },
+	{ 244515, 3420, LIBODRAW_TRACK_TYPE_AUDIO, 0, 244515 },
+	{ 247935, 1843, LIBODRAW_TRACK_TYPE_AUDIO, 0, 247935 },
+	{ 249778, 2766, LIBODRAW_TRACK_TYPE_AUDIO, 0, 249778 },
+	{ 252544, 3239, LIBODRAW_TRACK_TYPE_AUDIO, 0, 252544 },
+	{ 255783, 1662, LIBODRAW_TRACK_TYPE_AUDIO, 0, 255783 },
+	{ 257445, 2585, LIBODRAW_TRACK_TYPE_AUDIO, 0, 257445 },
+	{ 260030, 3058, LIBODRAW_TRACK_TYPE_AUDIO, 0, 260030 },
+	{ 263088, 3981, LIBODRAW_TRACK_TYPE_AUDIO, 0, 263088 },
+	{ 267069, 2404, LIBODRAW_TRACK_TYPE_AUDIO, 0, 267069 },
+	{ 269473, 0, LIBODRAW_TRACK_TYPE_AUDIO, 0, 269473 }
+};
+
+/* The expected values of cue_parser.7
+ */
+const odraw_test_cue_corpus_data_file_t odraw_test_cue_corpus_file7_data_files[ 6 ] = {
+	{ "track01.bin", LIBODRAW_FILE_TYPE_BINARY_LITTLE_ENDIAN },
+	{ "track03.wav", LIBODRAW_FILE_TYPE_AUDIO_WAVE },
+	{ "track04.bin", LIBODRAW_FILE_TYPE_BINARY_BIG_ENDIAN },
+	{ "track05.aiff", LIBODRAW_FILE_TYPE_AUDIO_AIFF },
+	{ "track06.mp3", LIBODRAW_FILE_TYPE_AUDIO_MPEG1_LAYER3 },
+	{ "track08.bin", LIBODRAW_FILE_TYPE_BINARY_LITTLE_ENDIAN }
+};
+
+const odraw_test_cue_corpus_track_t odraw_test_cue_corpus_file7_tracks[ 8 ] = {
+	{ 0, 45150, LIBODRAW_TRACK_TYPE_MODE1_2352, 0, 0 },
+	{ 45150, 0, LIBODRAW_TRACK_TYPE_AUDIO, 0, 45150 },
+	{ 0, 107, LIBODRAW_TRACK_TYPE_AUDIO, 1, 0 },
+	{ 107, 0, LIBODRAW_TRACK_TYPE_AUDIO, 2, 0 },
+	{ 0, 0, LIBODRAW_TRACK_TYPE_AUDIO, 3, 0 },
+	{ 0, 15010, LIBODRAW_TRACK_TYPE_AUDIO, 4, 0 },
+	{ 15010, 0, LIBODRAW_TRACK_TYPE_AUDIO, 4, 15010 },
+	{ 0, 0, LIBODRAW_TRACK_TYPE_MODE2_2352, 5, 0 }
+};
+
+/* The expected values of cue_parser.8
+ */
+const odraw_test_cue_corpus_data_file_t odraw_test_cue_corpus_file8_data_files[ 1 ] = {
+	{ "cdtext.bin", LIBODRAW_FILE_TYPE_BINARY_LITTLE_ENDIAN }
+};
+
+const odraw_test_cue_corpus_track_t odraw_test_cue_corpus_file8_tracks[ 12 ] = {
+	{ 0, 9225, LIBODRAW_TRACK_TYPE_AUDIO, 0, 0 },
+	{ 9225, 9300, LIBODRAW_TRACK_TYPE_AUDIO, 0, 9225 },
+	{ 18525, 9375, LIBODRAW_TRACK_TYPE_AUDIO, 0, 18525 },
+	{ 27900, 9450, LIBODRAW_TRACK_TYPE_AUDIO, 0, 27900 },
+	{ 37350, 9525, LIBODRAW_TRACK_TYPE_AUDIO, 0, 37350 },
+	{ 46875, 9600, LIBODRAW_TRACK_TYPE_AUDIO, 0, 46875 },
+	{ 56475, 9675, LIBODRAW_TRACK_TYPE_AUDIO, 0, 56475 },
+	{ 66150, 9750, LIBODRAW_TRACK_TYPE_AUDIO, 0, 66150 },
+	{ 75900, 9825, LIBODRAW_TRACK_TYPE_AUDIO, 0, 75900 },
+	{ 85725, 9900, LIBODRAW_TRACK_TYPE_AUDIO, 0, 85725 },
+	{ 95625, 9975, LIBODRAW_TRACK_TYPE_AUDIO, 0, 95625 },
+	{ 105600, 0, LIBODRAW_TRACK_TYPE_AUDIO, 0, 105600 }
+};
+
+/* The expected values of cue_parser.9
+ */
+const odraw_test_cue_corpus_sector_range_t odraw_test_cue_corpus_file9_sessions[ 2 ] = {
+	{ 0, 60900 },
+	{ 60900, 0 }
+};
+
+const odraw_test_cue_corpus_sector_range_t odraw_test_cue_corpus_file9_lead_outs[ 1 ] = {
+	{ 54000, 6900 }
+};
+
+const odraw_test_cue_corpus_data_file_t odraw_test_cue_corpus_file9_data_files[ 1 ] = {
+	{ "sessions.bin", LIBODRAW_FILE_TYPE_BINARY_LITTLE_ENDIAN }
+};
+
+const odraw_test_cue_corpus_track_t odraw_test_cue_corpus_file9_tracks[ 4 ] = {
+	{ 0, 18900, LIBODRAW_TRACK_TYPE_AUDIO, 0, 0 },
+	{ 18900, 19395, LIBODRAW_TRACK_TYPE_AUDIO, 0, 18900 },
+	{ 38295, 15705, LIBODRAW_TRACK_TYPE_AUDIO, 0, 38295 },
+	{ 60900, 0, LIBODRAW_TRACK_TYPE_MODE2_2352, 0, 60900 }
+};
+
+/* The number of CUE files in the test corpus
+ */
+#define ODRAW_TEST_CUE_CORPUS_NUMBER_OF_FILES	9
+
+/* The CUE files of the test corpus
+ */
+const odraw_test_cue_corpus_file_t odraw_test_cue_corpus_files[ ODRAW_TEST_CUE_CORPUS_NUMBER_OF_FILES ] = {
+	/* A cdrdao TOC file, which is not supported
+	 */
+	{ "cue_parser.1", -1,
+	  0, NULL,
+	  0, NULL,
+	  1, odraw_test_cue_corpus_file1_data_files,
+	  0, NULL },
+	/* A cdrdao TOC file with CD-TEXT, which is not supported
+	 */
+	{ "cue_parser.2", -1,
+	  0, NULL,
+	  0, NULL,
+	  0, NULL,
+	  0, NULL },
+	/* A cdrdao TOC file with a start position, which is not supported
+	 */
+	{ "cue_parser.3", -1,
+	  0, NULL,
+	  0, NULL,
+	  1, odraw_test_cue_corpus_file3_data_files,
+	  0, NULL },
+	/* A cdrdao TOC file with a pregap data file, which is not supported
+	 */
+	{ "cue_parser.4", -1,
+	  0, NULL,
+	  0, NULL,
+	  1, odraw_test_cue_corpus_file4_data_files,
+	  0, NULL },
+	/* A cdrdao TOC file with multiple tracks, which is not supported
+	 */
+	{ "cue_parser.5", -1,
+	  0, NULL,
+	  0, NULL,
+	  0, NULL,
+	  0, NULL },
+	/* 99 tracks in a single data file, every third track has a pregap
+	 */
+	{ "cue_parser.6", 1,
+	  0, NULL,
+	  0, NULL,
+	  1, odraw_test_cue_corpus_file6_data_files,
+	  99, odraw_test_cue_corpus_file6_tracks },
+	/* 8 tracks in 6 data files of different types, the MSF of an INDEX command
+	 * is relative to the start of its data file
+	 */
+	{ "cue_parser.7", 1,
+	  0, NULL,
+	  0, NULL,
+	  6, odraw_test_cue_corpus_file7_data_files,
+	  8, odraw_test_cue_corpus_file7_tracks },
+	/* 12 tracks with large CD-TEXT and REM blocks, CATALOG, CDTEXTFILE, ISRC and FLAGS
+	 */
+	{ "cue_parser.8", 1,
+	  0, NULL,
+	  0, NULL,
+	  1, odraw_test_cue_corpus_file8_data_files,
+	  12, odraw_test_cue_corpus_file8_tracks },
+	/* 2 sessions with a lead-out, original media type and run-out
+	 */
+	{ "cue_parser.9", 1,
+	  2, odraw_test_cue_corpus_file9_sessions,
+	  1, odraw_test_cue_corpus_file9_lead_outs,
+	  1, odraw_test_cue_corpus_file9_data_files,
+	  4, odraw_test_cue_corpus_file9_tracks }
+};
+
+/* Reads a CUE file of the test corpus
+ * The buffer is terminated by 2 zero bytes, as required by the CUE parser and reader
+ * Returns 1 if successful or -1 on error
+ */
+int odraw_test_cue_corpus_read_file(
+     const system_character_t *source,
+     uint8_t **buffer,
+     size_t *buffer_size,
+     libcerror_error_t **error )
+{
+	FILE *file_stream     = NULL;
+	uint8_t *safe_buffer  = NULL;
+	static char *function = "odraw_test_cue_corpus_read_file";
+	size_t read_count     = 0;
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_buffer = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * ( ODRAW_TEST_CUE_CORPUS_MAXIMUM_FILE_SIZE + 2 ) );
+
+	if( safe_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               source,
+	               _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	file_stream = file_stream_open(
+	               source,
+	               FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = file_stream_read(
+	              file_stream,
+	              safe_buffer,
+	              ODRAW_TEST_CUE_CORPUS_MAXIMUM_FILE_SIZE + 1 );
+
+	file_stream_close(
+	 file_stream );
+
+	if( read_count > ODRAW_TEST_CUE_CORPUS_MAXIMUM_FILE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	safe_buffer[ read_count ]     = 0;
+	safe_buffer[ read_count + 1 ] = 0;
+
+	*buffer      = safe_buffer;
+	*buffer_size = read_count + 2;
+
+	return( 1 );
+
+on_error:
+	if( safe_buffer != NULL )
+	{
+		memory_free(
+		 safe_buffer );
+	}
+	return( -1 );
+}
+
+/* Retrieves the expected values of a CUE file of the test corpus
+ * The file is matched on the last path segment of the source
+ * Returns 1 if successful, 0 if no such file or -1 on error
+ */
+int odraw_test_cue_corpus_get_file(
+     const system_character_t *source,
+     const odraw_test_cue_corpus_file_t **corpus_file,
+     libcerror_error_t **error )
+{
+	static char *function = "odraw_test_cue_corpus_get_file";
+	size_t name_index     = 0;
+	size_t name_length    = 0;
+	size_t source_length  = 0;
+	size_t source_offset  = 0;
+	int file_index        = 0;
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( corpus_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid corpus file.",
+		 function );
+
+		return( -1 );
+	}
+	source_length = system_string_length(
+	                 source );
+
+	for( file_index = 0;
+	     file_index < ODRAW_TEST_CUE_CORPUS_NUMBER_OF_FILES;
+	     file_index++ )
+	{
+		name_length = narrow_string_length(
+		               odraw_test_cue_corpus_files[ file_index ].name );
+
+		if( name_length > source_length )
+		{
+			continue;
+		}
+		source_offset = source_length - name_length;
+
+		if( ( source_offset > 0 )
+		 && ( source[ source_offset - 1 ] != (system_character_t) '/' )
+		 && ( source[ source_offset - 1 ] != (system_character_t) '\\' ) )
+		{
+			continue;
+		}
+		for( name_index = 0;
+		     name_index < name_length;
+		     name_index++ )
+		{
+			if( source[ source_offset + name_index ] != (system_character_t) odraw_test_cue_corpus_files[ file_index ].name[ name_index ] )
+			{
+				break;
+			}
+		}
+		if( name_index == name_length )
+		{
+			*corpus_file = &( odraw_test_cue_corpus_files[ file_index ] );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Checks the sessions, lead-outs, data files and tracks of a handle against the expected values
+ * of a CUE file of the test corpus
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_cue_corpus_check_handle(
+     libodraw_handle_t *handle,
+     const odraw_test_cue_corpus_file_t *corpus_file )
+{
+	char filename[ 64 ];
+
+	libcerror_error_t *error        = NULL;
+	libodraw_data_file_t *data_file = NULL;
+	size_t filename_size            = 0;
+	uint64_t data_file_start_sector = 0;
+	uint64_t number_of_sectors      = 0;
+	uint64_t start_sector           = 0;
+	uint8_t type                    = 0;
+	int data_file_index             = 0;
+	int entry_index                 = 0;
+	int number_of_entries           = 0;
+	int result                      = 0;
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "corpus_file",
+	 corpus_file );
+
+	/* Check the sessions
+	 */
+	result = libodraw_handle_get_number_of_sessions(
+	          handle,
+	          &number_of_entries,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sessions",
+	 number_of_entries,
+	 corpus_file->number_of_sessions );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		result = libodraw_handle_get_session(
+		          handle,
+		          entry_index,
+		          &start_sector,
+		          &number_of_sectors,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "session start_sector",
+		 start_sector,
+		 corpus_file->sessions[ entry_index ].start_sector );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "session number_of_sectors",
+		 number_of_sectors,
+		 corpus_file->sessions[ entry_index ].number_of_sectors );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Check the lead-outs
+	 */
+	result = libodraw_handle_get_number_of_lead_outs(
+	          handle,
+	          &number_of_entries,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_lead_outs",
+	 number_of_entries,
+	 corpus_file->number_of_lead_outs );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		result = libodraw_handle_get_lead_out(
+		          handle,
+		          entry_index,
+		          &start_sector,
+		          &number_of_sectors,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "lead-out start_sector",
+		 start_sector,
+		 corpus_file->lead_outs[ entry_index ].start_sector );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "lead-out number_of_sectors",
+		 number_of_sectors,
+		 corpus_file->lead_outs[ entry_index ].number_of_sectors );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Check the data files
+	 */
+	result = libodraw_handle_get_number_of_data_files(
+	          handle,
+	          &number_of_entries,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_data_files",
+	 number_of_entries,
+	 corpus_file->number_of_data_files );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		result = libodraw_handle_get_data_file(
+		          handle,
+		          entry_index,
+		          &data_file,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_IS_NOT_NULL(
+		 "data_file",
+		 data_file );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libodraw_data_file_get_filename_size(
+		          data_file,
+		          &filename_size,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_EQUAL_SIZE(
+		 "filename_size",
+		 filename_size,
+		 narrow_string_length( corpus_file->data_files[ entry_index ].filename ) + 1 );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libodraw_data_file_get_filename(
+		          data_file,
+		          filename,
+		          64,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = narrow_string_compare(
+		          filename,
+		          corpus_file->data_files[ entry_index ].filename,
+		          filename_size );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "filename",
+		 result,
+		 0 );
+
+		result = libodraw_data_file_get_type(
+		          data_file,
+		          &type,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT8(
+		 "data file type",
+		 type,
+		 corpus_file->data_files[ entry_index ].type );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libodraw_data_file_free(
+		          &data_file,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Check the tracks
+	 */
+	result = libodraw_handle_get_number_of_tracks(
+	          handle,
+	          &number_of_entries,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_tracks",
+	 number_of_entries,
+	 corpus_file->number_of_tracks );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		result = libodraw_handle_get_track(
+		          handle,
+		          entry_index,
+		          &start_sector,
+		          &number_of_sectors,
+		          &type,
+		          &data_file_index,
+		          &data_file_start_sector,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "track start_sector",
+		 start_sector,
+		 corpus_file->tracks[ entry_index ].start_sector );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "track number_of_sectors",
+		 number_of_sectors,
+		 corpus_file->tracks[ entry_index ].number_of_sectors );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT8(
+		 "track type",
+		 type,
+		 corpus_file->tracks[ entry_index ].type );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "track data_file_index",
+		 data_file_index,
+		 corpus_file->tracks[ entry_index ].data_file_index );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "track data_file_start_sector",
+		 data_file_start_sector,
+		 corpus_file->tracks[ entry_index ].data_file_start_sector );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_file != NULL )
+	{
+		libodraw_data_file_free(
+		 &data_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Compares the sessions, lead-outs, data files and tracks of two handles
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_cue_corpus_compare_handles(
+     libodraw_handle_t *handle,
+     libodraw_handle_t *compare_handle )
+{
+	char compare_filename[ 64 ];
+	char filename[ 64 ];
+
+	libcerror_error_t *error                = NULL;
+	libodraw_data_file_t *compare_data_file = NULL;
+	libodraw_data_file_t *data_file         = NULL;
+	size_t compare_filename_size            = 0;
+	size_t filename_size                    = 0;
+	uint64_t compare_data_file_start_sector = 0;
+	uint64_t compare_number_of_sectors      = 0;
+	uint64_t compare_start_sector           = 0;
+	uint64_t data_file_start_sector         = 0;
+	uint64_t number_of_sectors              = 0;
+	uint64_t start_sector                   = 0;
+	uint8_t compare_type                    = 0;
+	uint8_t type                            = 0;
+	int compare_data_file_index             = 0;
+	int compare_number_of_entries           = 0;
+	int data_file_index                     = 0;
+	int entry_index                         = 0;
+	int number_of_entries                   = 0;
+	int result                              = 0;
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "compare_handle",
+	 compare_handle );
+
+	/* Compare the sessions
+	 */
+	result = libodraw_handle_get_number_of_sessions(
+	          handle,
+	          &number_of_entries,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libodraw_handle_get_number_of_sessions(
+	          compare_handle,
+	          &compare_number_of_entries,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sessions",
+	 number_of_entries,
+	 compare_number_of_entries );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		result = libodraw_handle_get_session(
+		          handle,
+		          entry_index,
+		          &start_sector,
+		          &number_of_sectors,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libodraw_handle_get_session(
+		          compare_handle,
+		          entry_index,
+		          &compare_start_sector,
+		          &compare_number_of_sectors,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "session start_sector",
+		 start_sector,
+		 compare_start_sector );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "session number_of_sectors",
+		 number_of_sectors,
+		 compare_number_of_sectors );
+	}
+	/* Compare the lead-outs
+	 */
+	result = libodraw_handle_get_number_of_lead_outs(
+	          handle,
+	          &number_of_entries,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libodraw_handle_get_number_of_lead_outs(
+	          compare_handle,
+	          &compare_number_of_entries,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_lead_outs",
+	 number_of_entries,
+	 compare_number_of_entries );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		result = libodraw_handle_get_lead_out(
+		          handle,
+		          entry_index,
+		          &start_sector,
+		          &number_of_sectors,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libodraw_handle_get_lead_out(
+		          compare_handle,
+		          entry_index,
+		          &compare_start_sector,
+		          &compare_number_of_sectors,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "lead-out start_sector",
+		 start_sector,
+		 compare_start_sector );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "lead-out number_of_sectors",
+		 number_of_sectors,
+		 compare_number_of_sectors );
+	}
+	/* Compare the data files
+	 */
+	result = libodraw_handle_get_number_of_data_files(
+	          handle,
+	          &number_of_entries,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libodraw_handle_get_number_of_data_files(
+	          compare_handle,
+	          &compare_number_of_entries,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_data_files",
+	 number_of_entries,
+	 compare_number_of_entries );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		result = libodraw_handle_get_data_file(
+		          handle,
+		          entry_index,
+		          &data_file,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libodraw_handle_get_data_file(
+		          compare_handle,
+		          entry_index,
+		          &compare_data_file,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libodraw_data_file_get_filename_size(
+		          data_file,
+		          &filename_size,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libodraw_data_file_get_filename_size(
+		          compare_data_file,
+		          &compare_filename_size,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_EQUAL_SIZE(
+		 "filename_size",
+		 filename_size,
+		 compare_filename_size );
+
+		result = libodraw_data_file_get_filename(
+		          data_file,
+		          filename,
+		          64,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libodraw_data_file_get_filename(
+		          compare_data_file,
+		          compare_filename,
+		          64,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = narrow_string_compare(
+		          filename,
+		          compare_filename,
+		          filename_size );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "filename",
+		 result,
+		 0 );
+
+		result = libodraw_data_file_get_type(
+		          data_file,
+		          &type,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libodraw_data_file_get_type(
+		          compare_data_file,
+		          &compare_type,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT8(
+		 "data file type",
+		 type,
+		 compare_type );
+
+		result = libodraw_data_file_free(
+		          &compare_data_file,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libodraw_data_file_free(
+		          &data_file,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	/* Compare the tracks
+	 */
+	result = libodraw_handle_get_number_of_tracks(
+	          handle,
+	          &number_of_entries,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libodraw_handle_get_number_of_tracks(
+	          compare_handle,
+	          &compare_number_of_entries,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_tracks",
+	 number_of_entries,
+	 compare_number_of_entries );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		result = libodraw_handle_get_track(
+		          handle,
+		          entry_index,
+		          &start_sector,
+		          &number_of_sectors,
+		          &type,
+		          &data_file_index,
+		          &data_file_start_sector,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libodraw_handle_get_track(
+		          compare_handle,
+		          entry_index,
+		          &compare_start_sector,
+		          &compare_number_of_sectors,
+		          &compare_type,
+		          &compare_data_file_index,
+		          &compare_data_file_start_sector,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "track start_sector",
+		 start_sector,
+		 compare_start_sector );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "track number_of_sectors",
+		 number_of_sectors,
+		 compare_number_of_sectors );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT8(
+		 "track type",
+		 type,
+		 compare_type );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "track data_file_index",
+		 data_file_index,
+		 compare_data_file_index );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "track data_file_start_sector",
+		 data_file_start_sector,
+		 compare_data_file_start_sector );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compare_data_file != NULL )
+	{
+		libodraw_data_file_free(
+		 &compare_data_file,
+		 NULL );
+	}
+	if( data_file != NULL )
+	{
+		libodraw_data_file_free(
+		 &data_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
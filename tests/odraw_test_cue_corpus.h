@@ -0,0 +1,159 @@
+/*
+ * CUE file test corpus functions
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ODRAW_TEST_CUE_CORPUS_H )
+#define _ODRAW_TEST_CUE_CORPUS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of a CUE file in the test corpus
+ */
+#define ODRAW_TEST_CUE_CORPUS_MAXIMUM_FILE_SIZE	( 1024 * 1024 )
+
+typedef struct odraw_test_cue_corpus_sector_range odraw_test_cue_corpus_sector_range_t;
+
+struct odraw_test_cue_corpus_sector_range
+{
+	/* The start sector
+	 */
+	uint64_t start_sector;
+
+	/* The number of sectors
+	 */
+	uint64_t number_of_sectors;
+};
+
+typedef struct odraw_test_cue_corpus_data_file odraw_test_cue_corpus_data_file_t;
+
+struct odraw_test_cue_corpus_data_file
+{
+	/* The filename
+	 */
+	const char *filename;
+
+	/* The type
+	 */
+	uint8_t type;
+};
+
+typedef struct odraw_test_cue_corpus_track odraw_test_cue_corpus_track_t;
+
+struct odraw_test_cue_corpus_track
+{
+	/* The start sector
+	 */
+	uint64_t start_sector;
+
+	/* The number of sectors
+	 */
+	uint64_t number_of_sectors;
+
+	/* The type
+	 */
+	uint8_t type;
+
+	/* The data file index
+	 */
+	int data_file_index;
+
+	/* The data file start sector
+	 */
+	uint64_t data_file_start_sector;
+};
+
+typedef struct odraw_test_cue_corpus_file odraw_test_cue_corpus_file_t;
+
+struct odraw_test_cue_corpus_file
+{
+	/* The name of the file in the test data directory
+	 */
+	const char *name;
+
+	/* The expected parse result
+	 */
+	int result;
+
+	/* The number of sessions
+	 */
+	int number_of_sessions;
+
+	/* The sessions
+	 */
+	const odraw_test_cue_corpus_sector_range_t *sessions;
+
+	/* The number of lead-outs
+	 */
+	int number_of_lead_outs;
+
+	/* The lead-outs
+	 */
+	const odraw_test_cue_corpus_sector_range_t *lead_outs;
+
+	/* The number of data files
+	 */
+	int number_of_data_files;
+
+	/* The data files
+	 */
+	const odraw_test_cue_corpus_data_file_t *data_files;
+
+	/* The number of tracks
+	 */
+	int number_of_tracks;
+
+	/* The tracks
+	 */
+	const odraw_test_cue_corpus_track_t *tracks;
+};
+
+int odraw_test_cue_corpus_read_file(
+     const system_character_t *source,
+     uint8_t **buffer,
+     size_t *buffer_size,
+     libcerror_error_t **error );
+
+int odraw_test_cue_corpus_get_file(
+     const system_character_t *source,
+     const odraw_test_cue_corpus_file_t **corpus_file,
+     libcerror_error_t **error );
+
+int odraw_test_cue_corpus_check_handle(
+     libodraw_handle_t *handle,
+     const odraw_test_cue_corpus_file_t *corpus_file );
+
+int odraw_test_cue_corpus_compare_handles(
+     libodraw_handle_t *handle,
+     libodraw_handle_t *compare_handle );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ODRAW_TEST_CUE_CORPUS_H ) */
+
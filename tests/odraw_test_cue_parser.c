@@ -20,13 +20,16 @@
  */
 
 #include <common.h>
-#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "odraw_test_cue_corpus.h"
+#include "odraw_test_getopt.h"
 #include "odraw_test_libcerror.h"
 #include "odraw_test_libodraw.h"
 #include "odraw_test_macros.h"
@@ -84,23 +87,190 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libodraw_cue_parser_parse_buffer function on a CUE file of the test corpus
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_cue_parser_parse_buffer_file(
+     const system_character_t *source )
+{
+	const odraw_test_cue_corpus_file_t *corpus_file = NULL;
+	libcerror_error_t *error                        = NULL;
+	libodraw_handle_t *handle                       = NULL;
+	uint8_t *buffer                                 = NULL;
+	size_t buffer_size                              = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 * Every file of the test corpus must have expected values
+	 */
+	result = odraw_test_cue_corpus_get_file(
+	          source,
+	          &corpus_file,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "corpus_file",
+	 corpus_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = odraw_test_cue_corpus_read_file(
+	          source,
+	          &buffer,
+	          &buffer_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_handle_initialize(
+	          &handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_cue_parser_parse_buffer(
+	          handle,
+	          buffer,
+	          buffer_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 corpus_file->result );
+
+	if( result == 1 )
+	{
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* A syntax error is reported by the parser without setting an error
+	 */
+	else if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	/* The sessions, lead-outs, data files and tracks before an unsupported command are kept
+	 */
+	result = odraw_test_cue_corpus_check_handle(
+	          handle,
+	          corpus_file );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Clean up
+	 */
+	result = libodraw_handle_free(
+	          &handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libodraw_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
 
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 int wmain(
-     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     wchar_t * const argv[] )
 #else
 int main(
-     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     char * const argv[] )
 #endif
 {
-	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
-	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+	system_integer_t option = 0;
+
+	while( ( option = odraw_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
 
+				return( EXIT_FAILURE );
+		}
+	}
 #if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
 
 	/* TODO: add tests for libodraw_cue_parser_parse_number */
@@ -113,6 +283,22 @@ int main(
 	 "libodraw_cue_parser_parse_buffer",
 	 odraw_test_cue_parser_parse_buffer );
 
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* The CUE files of the test corpus are passed as arguments
+	 */
+	while( optind < argc )
+	{
+		ODRAW_TEST_RUN_WITH_ARGS(
+		 "libodraw_cue_parser_parse_buffer on corpus file",
+		 odraw_test_cue_parser_parse_buffer_file,
+		 argv[ optind ] );
+
+		optind++;
+	}
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
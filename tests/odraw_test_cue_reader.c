@@ -0,0 +1,1031 @@
+/*
+ * Library cue_reader functions test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_cue_corpus.h"
+#include "odraw_test_getopt.h"
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_cue_reader.h"
+
+extern \
+int libodraw_cue_parser_parse_buffer(
+     libodraw_handle_t *handle,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+/* A CUE file with 2 tracks in a single data file, including the 2 zero bytes at the end
+ */
+uint8_t odraw_test_cue_reader_data1[ 146 ] = {
+	'F', 'I', 'L', 'E', ' ', '"', 'd', 'a', 't', 'a', '.', 'b', 'i', 'n', '"', ' ',
+	'B', 'I', 'N', 'A', 'R', 'Y', '\n', ' ', ' ', 'T', 'R', 'A', 'C', 'K', ' ', '0',
+	'1', ' ', 'M', 'O', 'D', 'E', '1', '/', '2', '3', '5', '2', '\n', ' ', ' ', ' ',
+	' ', 'I', 'N', 'D', 'E', 'X', ' ', '0', '1', ' ', '0', '0', ':', '0', '0', ':',
+	'0', '0', '\n', ' ', ' ', 'T', 'R', 'A', 'C', 'K', ' ', '0', '2', ' ', 'A', 'U',
+	'D', 'I', 'O', '\n', ' ', ' ', ' ', ' ', 'R', 'E', 'M', ' ', 'a', ' ', 'r', 'e',
+	'm', 'a', 'r', 'k', '\n', ' ', ' ', ' ', ' ', 'I', 'N', 'D', 'E', 'X', ' ', '0',
+	'1', ' ', '0', '0', ':', '1', '0', ':', '0', '0', '\n', ' ', ' ', ' ', ' ', 'P',
+	'O', 'S', 'T', 'G', 'A', 'P', ' ', '0', '0', ':', '0', '2', ':', '0', '0', '\n',
+	0, 0 };
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Tests the libodraw_cue_reader_get_quoted_string_length function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_cue_reader_get_quoted_string_length(
+     void )
+{
+	size_t string_length = 0;
+
+	/* Test regular cases
+	 */
+	string_length = libodraw_cue_reader_get_quoted_string_length(
+	                 "\"data.bin\" BINARY",
+	                 17 );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "string_length",
+	 string_length,
+	 (size_t) 10 );
+
+	string_length = libodraw_cue_reader_get_quoted_string_length(
+	                 "''",
+	                 2 );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "string_length",
+	 string_length,
+	 (size_t) 2 );
+
+	/* An escaped quote is part of the string
+	 */
+	string_length = libodraw_cue_reader_get_quoted_string_length(
+	                 "\"a\\\"b\"",
+	                 6 );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "string_length",
+	 string_length,
+	 (size_t) 6 );
+
+	/* Test error cases
+	 */
+	string_length = libodraw_cue_reader_get_quoted_string_length(
+	                 "\"data.bin",
+	                 9 );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "string_length",
+	 string_length,
+	 (size_t) 0 );
+
+	string_length = libodraw_cue_reader_get_quoted_string_length(
+	                 "\"data\n\"",
+	                 7 );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "string_length",
+	 string_length,
+	 (size_t) 0 );
+
+	string_length = libodraw_cue_reader_get_quoted_string_length(
+	                 NULL,
+	                 2 );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "string_length",
+	 string_length,
+	 (size_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libodraw_cue_reader_get_token function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_cue_reader_get_token(
+     void )
+{
+	libodraw_cue_reader_token_t token;
+
+	const char *buffer       = "REM LEAD-OUT 01:02:03 ; comment\r\nNO COPY 1234567890123 cat|";
+	libcerror_error_t *error = NULL;
+	size_t buffer_offset     = 0;
+	size_t buffer_size       = 59;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libodraw_cue_reader_get_token(
+	          buffer,
+	          buffer_size,
+	          &buffer_offset,
+	          &token,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "token.type",
+	 token.type,
+	 LIBODRAW_CUE_READER_TOKEN_REMARK_LEAD_OUT );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_cue_reader_get_token(
+	          buffer,
+	          buffer_size,
+	          &buffer_offset,
+	          &token,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "token.type",
+	 token.type,
+	 LIBODRAW_CUE_READER_TOKEN_MSF );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "token.length",
+	 token.length,
+	 (size_t) 8 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The comment is skipped
+	 */
+	result = libodraw_cue_reader_get_token(
+	          buffer,
+	          buffer_size,
+	          &buffer_offset,
+	          &token,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "token.type",
+	 token.type,
+	 LIBODRAW_CUE_READER_TOKEN_END_OF_LINE );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_cue_reader_get_token(
+	          buffer,
+	          buffer_size,
+	          &buffer_offset,
+	          &token,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "token.type",
+	 token.type,
+	 LIBODRAW_CUE_READER_TOKEN_END_OF_LINE );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_cue_reader_get_token(
+	          buffer,
+	          buffer_size,
+	          &buffer_offset,
+	          &token,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "token.type",
+	 token.type,
+	 LIBODRAW_CUE_READER_TOKEN_NO_COPY );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_cue_reader_get_token(
+	          buffer,
+	          buffer_size,
+	          &buffer_offset,
+	          &token,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "token.type",
+	 token.type,
+	 LIBODRAW_CUE_READER_TOKEN_CATALOG_NUMBER );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The c character is part of the white space class of the flex based scanner,
+	 * hence the white space before "cat|" also consumes the c
+	 */
+	result = libodraw_cue_reader_get_token(
+	          buffer,
+	          buffer_size,
+	          &buffer_offset,
+	          &token,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "token.type",
+	 token.type,
+	 LIBODRAW_CUE_READER_TOKEN_STRING );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "token.length",
+	 token.length,
+	 (size_t) 3 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_cue_reader_get_token(
+	          buffer,
+	          buffer_size,
+	          &buffer_offset,
+	          &token,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "token.type",
+	 token.type,
+	 LIBODRAW_CUE_READER_TOKEN_END_OF_FILE );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_offset",
+	 buffer_offset,
+	 buffer_size );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	buffer_offset = 0;
+
+	result = libodraw_cue_reader_get_token(
+	          NULL,
+	          buffer_size,
+	          &buffer_offset,
+	          &token,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_cue_reader_get_token(
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          &buffer_offset,
+	          &token,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_cue_reader_get_token(
+	          buffer,
+	          buffer_size,
+	          NULL,
+	          &token,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_cue_reader_get_token(
+	          buffer,
+	          buffer_size,
+	          &buffer_offset,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_cue_reader_section_has_command function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_cue_reader_section_has_command(
+     void )
+{
+	int result = 0;
+
+	result = libodraw_cue_reader_section_has_command(
+	          LIBODRAW_CUE_READER_SECTION_HEADER,
+	          LIBODRAW_CUE_READER_TOKEN_CATALOG );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libodraw_cue_reader_section_has_command(
+	          LIBODRAW_CUE_READER_SECTION_HEADER,
+	          LIBODRAW_CUE_READER_TOKEN_END_OF_LINE );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libodraw_cue_reader_section_has_command(
+	          LIBODRAW_CUE_READER_SECTION_TRACK_INDEX_ITEMS,
+	          LIBODRAW_CUE_READER_TOKEN_INDEX );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libodraw_cue_reader_section_has_command(
+	          LIBODRAW_CUE_READER_SECTION_TRACK_TRAILING_ITEMS,
+	          LIBODRAW_CUE_READER_TOKEN_INDEX );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libodraw_cue_reader_section_has_command(
+	          LIBODRAW_CUE_READER_SECTION_TRACK_PRECEDING_ITEMS,
+	          LIBODRAW_CUE_READER_TOKEN_UNDEFINED );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libodraw_cue_reader_parse_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_cue_reader_parse_buffer(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libodraw_handle_t *handle       = NULL;
+	uint64_t data_file_start_sector = 0;
+	uint64_t number_of_sectors      = 0;
+	uint64_t start_sector           = 0;
+	uint8_t track_type              = 0;
+	int data_file_index             = 0;
+	int number_of_tracks            = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_handle_initialize(
+	          &handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_cue_reader_parse_buffer(
+	          handle,
+	          odraw_test_cue_reader_data1,
+	          146,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_handle_get_number_of_tracks(
+	          handle,
+	          &number_of_tracks,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_tracks",
+	 number_of_tracks,
+	 2 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_handle_get_track(
+	          handle,
+	          0,
+	          &start_sector,
+	          &number_of_sectors,
+	          &track_type,
+	          &data_file_index,
+	          &data_file_start_sector,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "start_sector",
+	 start_sector,
+	 (uint64_t) 0 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 750 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "track_type",
+	 (int) track_type,
+	 (int) LIBODRAW_TRACK_TYPE_MODE1_2352 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "data_file_index",
+	 data_file_index,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_cue_reader_parse_buffer(
+	          NULL,
+	          odraw_test_cue_reader_data1,
+	          146,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_cue_reader_parse_buffer(
+	          handle,
+	          NULL,
+	          146,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_cue_reader_parse_buffer(
+	          handle,
+	          odraw_test_cue_reader_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The buffer must end with 2 zero bytes
+	 */
+	result = libodraw_cue_reader_parse_buffer(
+	          handle,
+	          odraw_test_cue_reader_data1,
+	          145,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_handle_free(
+	          &handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libodraw_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_cue_reader_parse_buffer function on a CUE file of the test corpus
+ * The results are compared with those of the bison based CUE parser
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_cue_reader_parse_buffer_file(
+     const system_character_t *source )
+{
+	const odraw_test_cue_corpus_file_t *corpus_file = NULL;
+	libcerror_error_t *error                        = NULL;
+	libodraw_handle_t *handle                       = NULL;
+	libodraw_handle_t *parser_handle                = NULL;
+	uint8_t *buffer                                 = NULL;
+	size_t buffer_size                              = 0;
+	int parser_result                               = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 * Every file of the test corpus must have expected values
+	 */
+	result = odraw_test_cue_corpus_get_file(
+	          source,
+	          &corpus_file,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "corpus_file",
+	 corpus_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = odraw_test_cue_corpus_read_file(
+	          source,
+	          &buffer,
+	          &buffer_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_handle_initialize(
+	          &parser_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "parser_handle",
+	 parser_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A syntax error is reported by the parser without setting an error
+	 */
+	parser_result = libodraw_cue_parser_parse_buffer(
+	                 parser_handle,
+	                 buffer,
+	                 buffer_size,
+	                 &error );
+
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	result = libodraw_handle_initialize(
+	          &handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_cue_reader_parse_buffer(
+	          handle,
+	          buffer,
+	          buffer_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 parser_result );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 corpus_file->result );
+
+	if( result == 1 )
+	{
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	else
+	{
+		ODRAW_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	result = odraw_test_cue_corpus_compare_handles(
+	          handle,
+	          parser_handle );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = odraw_test_cue_corpus_check_handle(
+	          handle,
+	          corpus_file );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Clean up
+	 */
+	result = libodraw_handle_free(
+	          &handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_handle_free(
+	          &parser_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "parser_handle",
+	 parser_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libodraw_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( parser_handle != NULL )
+	{
+		libodraw_handle_free(
+		 &parser_handle,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	system_integer_t option = 0;
+
+	while( ( option = odraw_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_cue_reader_get_quoted_string_length",
+	 odraw_test_cue_reader_get_quoted_string_length );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_cue_reader_get_token",
+	 odraw_test_cue_reader_get_token );
+
+	/* TODO: add tests for libodraw_cue_reader_get_expected_token */
+
+	/* TODO: add tests for libodraw_cue_reader_process_file */
+
+	/* TODO: add tests for libodraw_cue_reader_process_index */
+
+	/* TODO: add tests for libodraw_cue_reader_process_datafile */
+
+	/* TODO: add tests for libodraw_cue_reader_process_lead_out */
+
+	/* TODO: add tests for libodraw_cue_reader_process_run_out */
+
+	/* TODO: add tests for libodraw_cue_reader_process_session */
+
+	/* TODO: add tests for libodraw_cue_reader_process_track */
+
+	/* TODO: add tests for libodraw_cue_reader_parse_command */
+
+	ODRAW_TEST_RUN(
+	 "libodraw_cue_reader_section_has_command",
+	 odraw_test_cue_reader_section_has_command );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_cue_reader_parse_buffer",
+	 odraw_test_cue_reader_parse_buffer );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* The CUE files of the test corpus are passed as arguments
+	 */
+	while( optind < argc )
+	{
+		ODRAW_TEST_RUN_WITH_ARGS(
+		 "libodraw_cue_reader_parse_buffer on corpus file",
+		 odraw_test_cue_reader_parse_buffer_file,
+		 argv[ optind ] );
+
+		optind++;
+	}
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,324 @@
+/*
+ * Library CUE writer functions test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_cue_writer.h"
+#include "../libodraw/libodraw_definitions.h"
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Tests the libodraw_cue_writer_get_file_type_string function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_cue_writer_get_file_type_string(
+     void )
+{
+	const char *string = NULL;
+	int result         = 0;
+
+	/* Test regular cases
+	 */
+	string = libodraw_cue_writer_get_file_type_string(
+	          LIBODRAW_FILE_TYPE_BINARY_LITTLE_ENDIAN );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	result = narrow_string_compare(
+	          string,
+	          "BINARY",
+	          7 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	string = libodraw_cue_writer_get_file_type_string(
+	          LIBODRAW_FILE_TYPE_BINARY_BIG_ENDIAN );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	result = narrow_string_compare(
+	          string,
+	          "MOTOROLA",
+	          9 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libodraw_cue_writer_get_track_type_string function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_cue_writer_get_track_type_string(
+     void )
+{
+	const char *string = NULL;
+	int result         = 0;
+
+	/* Test regular cases
+	 */
+	string = libodraw_cue_writer_get_track_type_string(
+	          LIBODRAW_TRACK_TYPE_MODE1_2352 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	result = narrow_string_compare(
+	          string,
+	          "MODE1/2352",
+	          11 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	string = libodraw_cue_writer_get_track_type_string(
+	          LIBODRAW_TRACK_TYPE_AUDIO );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	result = narrow_string_compare(
+	          string,
+	          "AUDIO",
+	          6 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	string = libodraw_cue_writer_get_track_type_string(
+	          LIBODRAW_TRACK_TYPE_UNKNOWN );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "string",
+	 string );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libodraw_cue_writer_copy_msf function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_cue_writer_copy_msf(
+     void )
+{
+	char string[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libodraw_cue_writer_copy_msf(
+	          string,
+	          16,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          string,
+	          "00:00:00",
+	          9 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libodraw_cue_writer_copy_msf(
+	          string,
+	          16,
+	          ( 60 * 75 ) + 75 + 1,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          string,
+	          "01:01:01",
+	          9 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libodraw_cue_writer_copy_msf(
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_cue_writer_copy_msf(
+	          string,
+	          4,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_cue_writer_copy_msf(
+	          string,
+	          16,
+	          100 * 60 * 75,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_cue_writer_get_file_type_string",
+	 odraw_test_cue_writer_get_file_type_string );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_cue_writer_get_track_type_string",
+	 odraw_test_cue_writer_get_track_type_string );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_cue_writer_copy_msf",
+	 odraw_test_cue_writer_copy_msf );
+
+	/* TODO: add tests for libodraw_cue_writer_write_data */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -118,6 +118,8 @@ int main(
 
 	/* TODO: add tests for libodraw_data_file_get_type */
 
+	/* TODO: add tests for libodraw_data_file_get_size */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
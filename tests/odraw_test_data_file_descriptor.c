@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -35,8 +36,22 @@
 
 #include "../libodraw/libodraw_data_file_descriptor.h"
 
+#define ODRAW_TEST_DATA_FILE_DESCRIPTOR_TEMPORARY_FILENAME	"odraw_test_data_file_descriptor.tmp"
+#define ODRAW_TEST_DATA_FILE_DESCRIPTOR_MISSING_FILENAME	"odraw_test_data_file_descriptor.missing"
+
+/* The size of a data file can only be determined from the file system metadata
+ * on Windows or when stat is available and narrow system strings are used
+ */
+#if defined( WINAPI ) || ( ( defined( HAVE_STAT ) || defined( HAVE_STATX ) ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) )
+#define ODRAW_TEST_DATA_FILE_DESCRIPTOR_HAVE_SIZE_FROM_FILE
+#endif
+
 #if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
 
+/* The data of a data file of 1 sector
+ */
+uint8_t odraw_test_data_file_descriptor_data[ 2352 ];
+
 /* Tests the libodraw_data_file_descriptor_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -510,6 +525,220 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+/* Tests the libodraw_data_file_descriptor_set_size_from_file function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_data_file_descriptor_set_size_from_file(
+     void )
+{
+	libcerror_error_t *error                              = NULL;
+	libodraw_data_file_descriptor_t *data_file_descriptor = NULL;
+	FILE *file_stream                                     = NULL;
+	size_t write_count                                    = 0;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_data_file_descriptor_initialize(
+	          &data_file_descriptor,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "data_file_descriptor",
+	 data_file_descriptor );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_stream = file_stream_open(
+	               ODRAW_TEST_DATA_FILE_DESCRIPTOR_TEMPORARY_FILENAME,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	write_count = file_stream_write(
+	               file_stream,
+	               odraw_test_data_file_descriptor_data,
+	               2352 );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "write_count",
+	 write_count,
+	 (size_t) 2352 );
+
+	result = file_stream_close(
+	          file_stream );
+
+	file_stream = NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test regular cases
+	 */
+	result = libodraw_data_file_descriptor_set_size_from_file(
+	          data_file_descriptor,
+	          _SYSTEM_STRING( ODRAW_TEST_DATA_FILE_DESCRIPTOR_TEMPORARY_FILENAME ),
+	          &error );
+
+#if defined( ODRAW_TEST_DATA_FILE_DESCRIPTOR_HAVE_SIZE_FROM_FILE )
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "data_file_descriptor->size",
+	 data_file_descriptor->size,
+	 (uint64_t) 2352 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "data_file_descriptor->size_set",
+	 data_file_descriptor->size_set,
+	 (uint8_t) 1 );
+
+#else
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( ODRAW_TEST_DATA_FILE_DESCRIPTOR_HAVE_SIZE_FROM_FILE ) */
+
+	/* Test error cases
+	 */
+	result = libodraw_data_file_descriptor_set_size_from_file(
+	          NULL,
+	          _SYSTEM_STRING( ODRAW_TEST_DATA_FILE_DESCRIPTOR_TEMPORARY_FILENAME ),
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_data_file_descriptor_set_size_from_file(
+	          data_file_descriptor,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( ODRAW_TEST_DATA_FILE_DESCRIPTOR_HAVE_SIZE_FROM_FILE )
+
+	/* Test set size from file with a missing file
+	 */
+	result = libodraw_data_file_descriptor_set_size_from_file(
+	          data_file_descriptor,
+	          _SYSTEM_STRING( ODRAW_TEST_DATA_FILE_DESCRIPTOR_MISSING_FILENAME ),
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "data_file_descriptor->size_set",
+	 data_file_descriptor->size_set,
+	 (uint8_t) 0 );
+
+#endif /* defined( ODRAW_TEST_DATA_FILE_DESCRIPTOR_HAVE_SIZE_FROM_FILE ) */
+
+	/* Clean up
+	 */
+	result = remove(
+	          ODRAW_TEST_DATA_FILE_DESCRIPTOR_TEMPORARY_FILENAME );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libodraw_data_file_descriptor_free(
+	          &data_file_descriptor,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "data_file_descriptor",
+	 data_file_descriptor );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	remove(
+	 ODRAW_TEST_DATA_FILE_DESCRIPTOR_TEMPORARY_FILENAME );
+
+	if( data_file_descriptor != NULL )
+	{
+		libodraw_data_file_descriptor_free(
+		 &data_file_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
 
 /* The main program
@@ -543,6 +772,10 @@ int main(
 
 	/* TODO: add tests for libodraw_data_file_descriptor_set_name */
 
+	ODRAW_TEST_RUN(
+	 "libodraw_data_file_descriptor_set_size_from_file",
+	 odraw_test_data_file_descriptor_set_size_from_file );
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 	/* TODO: add tests for libodraw_data_file_descriptor_get_name_size_wide */
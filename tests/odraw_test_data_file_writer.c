@@ -0,0 +1,557 @@
+/*
+ * Library data_file_writer type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_data_file_writer.h"
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Tests the libodraw_data_file_writer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_data_file_writer_initialize(
+     void )
+{
+	libodraw_data_file_writer_t *data_file_writer = NULL;
+	libcerror_error_t *error                      = NULL;
+	int result                                    = 0;
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests               = 1;
+	int number_of_memset_fail_tests               = 1;
+	int test_number                               = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libodraw_data_file_writer_initialize(
+	          &data_file_writer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "data_file_writer",
+	 data_file_writer );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_data_file_writer_free(
+	          &data_file_writer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "data_file_writer",
+	 data_file_writer );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_data_file_writer_initialize(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_file_writer = (libodraw_data_file_writer_t *) 0x12345678UL;
+
+	result = libodraw_data_file_writer_initialize(
+	          &data_file_writer,
+	          &error );
+
+	data_file_writer = NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_data_file_writer_initialize with malloc failing
+		 */
+		odraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libodraw_data_file_writer_initialize(
+		          &data_file_writer,
+		          &error );
+
+		if( odraw_test_malloc_attempts_before_fail != -1 )
+		{
+			odraw_test_malloc_attempts_before_fail = -1;
+
+			if( data_file_writer != NULL )
+			{
+				libodraw_data_file_writer_free(
+				 &data_file_writer,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "data_file_writer",
+			 data_file_writer );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_data_file_writer_initialize with memset failing
+		 */
+		odraw_test_memset_attempts_before_fail = test_number;
+
+		result = libodraw_data_file_writer_initialize(
+		          &data_file_writer,
+		          &error );
+
+		if( odraw_test_memset_attempts_before_fail != -1 )
+		{
+			odraw_test_memset_attempts_before_fail = -1;
+
+			if( data_file_writer != NULL )
+			{
+				libodraw_data_file_writer_free(
+				 &data_file_writer,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "data_file_writer",
+			 data_file_writer );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ODRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_file_writer != NULL )
+	{
+		libodraw_data_file_writer_free(
+		 &data_file_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_data_file_writer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_data_file_writer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libodraw_data_file_writer_free(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_data_file_writer_write_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_data_file_writer_write_buffer(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libodraw_data_file_writer_t *data_file_writer = NULL;
+	libcerror_error_t *error                      = NULL;
+	ssize_t write_count                           = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_data_file_writer_initialize(
+	          &data_file_writer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "data_file_writer",
+	 data_file_writer );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	write_count = libodraw_data_file_writer_write_buffer(
+	               NULL,
+	               buffer,
+	               16,
+	               &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test write buffer on a data file writer that was not opened
+	 */
+	write_count = libodraw_data_file_writer_write_buffer(
+	               data_file_writer,
+	               buffer,
+	               16,
+	               &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_data_file_writer_free(
+	          &data_file_writer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "data_file_writer",
+	 data_file_writer );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_file_writer != NULL )
+	{
+		libodraw_data_file_writer_free(
+		 &data_file_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_data_file_writer_get_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_data_file_writer_get_data_size(
+     void )
+{
+	libodraw_data_file_writer_t *data_file_writer = NULL;
+	libcerror_error_t *error                      = NULL;
+	size64_t data_size                            = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_data_file_writer_initialize(
+	          &data_file_writer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "data_file_writer",
+	 data_file_writer );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_data_file_writer_get_data_size(
+	          data_file_writer,
+	          &data_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 (uint64_t) data_size,
+	 (uint64_t) 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_data_file_writer_get_data_size(
+	          NULL,
+	          &data_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_data_file_writer_get_data_size(
+	          data_file_writer,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_data_file_writer_free(
+	          &data_file_writer,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "data_file_writer",
+	 data_file_writer );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_file_writer != NULL )
+	{
+		libodraw_data_file_writer_free(
+		 &data_file_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_data_file_writer_initialize",
+	 odraw_test_data_file_writer_initialize );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_data_file_writer_free",
+	 odraw_test_data_file_writer_free );
+
+	/* TODO: add tests for libodraw_data_file_writer_open */
+
+	/* TODO: add tests for libodraw_data_file_writer_close */
+
+	ODRAW_TEST_RUN(
+	 "libodraw_data_file_writer_write_buffer",
+	 odraw_test_data_file_writer_write_buffer );
+
+	/* TODO: add tests for libodraw_data_file_writer_write_pending_buffer */
+
+	/* TODO: add tests for libodraw_data_file_writer_queue_buffer */
+
+	/* TODO: add tests for libodraw_data_file_writer_wait_for_buffer */
+
+	ODRAW_TEST_RUN(
+	 "libodraw_data_file_writer_get_data_size",
+	 odraw_test_data_file_writer_get_data_size );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
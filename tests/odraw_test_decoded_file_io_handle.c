@@ -0,0 +1,781 @@
+/*
+ * Library decoded_file_io_handle type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libbfio.h"
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_decoded_file_io_handle.h"
+#include "../libodraw/libodraw_ecm_file.h"
+
+/* An ECM file that contains a single raw record of 16 bytes
+ */
+uint8_t odraw_test_decoded_file_io_handle_ecm_data[ 29 ] = {
+	'E', 'C', 'M', 0x00, 0x3c, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+	0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Creates a file IO handle of the ECM test data
+ * The file IO handle is not opened
+ * Returns 1 if successful or -1 on error
+ */
+int odraw_test_decoded_file_io_handle_initialize_ecm_file_io_handle(
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "odraw_test_decoded_file_io_handle_initialize_ecm_file_io_handle";
+
+	if( libbfio_memory_range_initialize(
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     *file_io_handle,
+	     odraw_test_decoded_file_io_handle_ecm_data,
+	     29,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range of file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libodraw_decoded_file_io_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_decoded_file_io_handle_initialize(
+     void )
+{
+	libbfio_handle_t *file_io_handle             = NULL;
+	libcerror_error_t *error                     = NULL;
+	libodraw_decoded_file_io_handle_t *io_handle = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = odraw_test_decoded_file_io_handle_initialize_ecm_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_decoded_file_io_handle_initialize(
+	          &io_handle,
+	          file_io_handle,
+	          (int (*)(intptr_t **, libcerror_error_t **)) libodraw_ecm_file_initialize,
+	          (int (*)(intptr_t **, libcerror_error_t **)) libodraw_ecm_file_free,
+	          (int (*)(intptr_t *, libbfio_handle_t *, libcerror_error_t **)) libodraw_ecm_file_open_read,
+	          (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libodraw_ecm_file_read_buffer_at_offset,
+	          (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libodraw_ecm_file_get_data_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_decoded_file_io_handle_initialize(
+	          NULL,
+	          file_io_handle,
+	          (int (*)(intptr_t **, libcerror_error_t **)) libodraw_ecm_file_initialize,
+	          (int (*)(intptr_t **, libcerror_error_t **)) libodraw_ecm_file_free,
+	          (int (*)(intptr_t *, libbfio_handle_t *, libcerror_error_t **)) libodraw_ecm_file_open_read,
+	          (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libodraw_ecm_file_read_buffer_at_offset,
+	          (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libodraw_ecm_file_get_data_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_decoded_file_io_handle_initialize(
+	          &io_handle,
+	          file_io_handle,
+	          (int (*)(intptr_t **, libcerror_error_t **)) libodraw_ecm_file_initialize,
+	          (int (*)(intptr_t **, libcerror_error_t **)) libodraw_ecm_file_free,
+	          (int (*)(intptr_t *, libbfio_handle_t *, libcerror_error_t **)) libodraw_ecm_file_open_read,
+	          (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libodraw_ecm_file_read_buffer_at_offset,
+	          (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libodraw_ecm_file_get_data_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_decoded_file_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The IO handle took over management of the file IO handle
+	 */
+	file_io_handle = NULL;
+
+	/* Test error cases
+	 */
+	result = libodraw_decoded_file_io_handle_initialize(
+	          &io_handle,
+	          NULL,
+	          (int (*)(intptr_t **, libcerror_error_t **)) libodraw_ecm_file_initialize,
+	          (int (*)(intptr_t **, libcerror_error_t **)) libodraw_ecm_file_free,
+	          (int (*)(intptr_t *, libbfio_handle_t *, libcerror_error_t **)) libodraw_ecm_file_open_read,
+	          (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libodraw_ecm_file_read_buffer_at_offset,
+	          (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libodraw_ecm_file_get_data_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_decoded_file_io_handle_initialize(
+	          &io_handle,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          (int (*)(intptr_t **, libcerror_error_t **)) libodraw_ecm_file_initialize,
+	          (int (*)(intptr_t **, libcerror_error_t **)) libodraw_ecm_file_free,
+	          (int (*)(intptr_t *, libbfio_handle_t *, libcerror_error_t **)) libodraw_ecm_file_open_read,
+	          NULL,
+	          (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libodraw_ecm_file_get_data_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libodraw_decoded_file_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_decoded_file_io_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_decoded_file_io_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libodraw_decoded_file_io_handle_free(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests reading the decoded data using the Basic File IO (bfio) handle
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_decoded_file_io_handle_read_buffer(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libbfio_handle_t *handle         = NULL;
+	libcerror_error_t *error         = NULL;
+	size64_t size                    = 0;
+	ssize_t read_count               = 0;
+	off64_t offset                   = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = odraw_test_decoded_file_io_handle_initialize_ecm_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_decoded_file_io_handle_initialize_handle(
+	          &handle,
+	          file_io_handle,
+	          (int (*)(intptr_t **, libcerror_error_t **)) libodraw_ecm_file_initialize,
+	          (int (*)(intptr_t **, libcerror_error_t **)) libodraw_ecm_file_free,
+	          (int (*)(intptr_t *, libbfio_handle_t *, libcerror_error_t **)) libodraw_ecm_file_open_read,
+	          (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libodraw_ecm_file_read_buffer_at_offset,
+	          (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libodraw_ecm_file_get_data_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The handle took over management of the file IO handle
+	 */
+	file_io_handle = NULL;
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_get_size(
+	          handle,
+	          &size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 16 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( odraw_test_decoded_file_io_handle_ecm_data[ 5 ] ),
+	          16 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          -4,
+	          SEEK_END,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 12 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer(
+	              handle,
+	              buffer,
+	              16,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 0 ]",
+	 buffer[ 0 ],
+	 (uint8_t) 0x0c );
+
+	/* Test error cases
+	 */
+	read_count = libbfio_handle_write_buffer(
+	              handle,
+	              buffer,
+	              16,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_decoded_file_io_handle_filename_has_extension function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_decoded_file_io_handle_filename_has_extension(
+     void )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = libodraw_decoded_file_io_handle_filename_has_extension(
+	          "track01.ecm",
+	          11,
+	          ".ecm",
+	          4 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libodraw_decoded_file_io_handle_filename_has_extension(
+	          "TRACK01.ECM",
+	          11,
+	          ".ecm",
+	          4 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libodraw_decoded_file_io_handle_filename_has_extension(
+	          "track01.bin",
+	          11,
+	          ".ecm",
+	          4 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libodraw_decoded_file_io_handle_filename_has_extension(
+	          "track01ecm",
+	          10,
+	          ".ecm",
+	          4 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libodraw_decoded_file_io_handle_filename_has_extension(
+	          "ecm",
+	          3,
+	          ".ecm",
+	          4 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libodraw_decoded_file_io_handle_filename_has_extension(
+	          NULL,
+	          11,
+	          ".ecm",
+	          4 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libodraw_decoded_file_io_handle_filename_has_extension(
+	          "track01.ecm",
+	          11,
+	          NULL,
+	          4 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libodraw_decoded_file_io_handle_filename_has_extension_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_decoded_file_io_handle_filename_has_extension_wide(
+     void )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = libodraw_decoded_file_io_handle_filename_has_extension_wide(
+	          L"track01.ecm",
+	          11,
+	          ".ecm",
+	          4 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libodraw_decoded_file_io_handle_filename_has_extension_wide(
+	          L"TRACK01.ECM",
+	          11,
+	          ".ecm",
+	          4 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libodraw_decoded_file_io_handle_filename_has_extension_wide(
+	          L"track01.bin",
+	          11,
+	          ".ecm",
+	          4 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libodraw_decoded_file_io_handle_filename_has_extension_wide(
+	          L"ecm",
+	          3,
+	          ".ecm",
+	          4 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libodraw_decoded_file_io_handle_filename_has_extension_wide(
+	          NULL,
+	          11,
+	          ".ecm",
+	          4 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_decoded_file_io_handle_initialize",
+	 odraw_test_decoded_file_io_handle_initialize );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_decoded_file_io_handle_free",
+	 odraw_test_decoded_file_io_handle_free );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_decoded_file_io_handle_read_buffer",
+	 odraw_test_decoded_file_io_handle_read_buffer );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_decoded_file_io_handle_filename_has_extension",
+	 odraw_test_decoded_file_io_handle_filename_has_extension );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_decoded_file_io_handle_filename_has_extension_wide",
+	 odraw_test_decoded_file_io_handle_filename_has_extension_wide );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,515 @@
+/*
+ * Library ecm_file type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_checksum.h"
+#include "../libodraw/libodraw_ecm_file.h"
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Tests the libodraw_ecm_file_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_ecm_file_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libodraw_ecm_file_t *ecm_file   = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libodraw_ecm_file_initialize(
+	          &ecm_file,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "ecm_file",
+	 ecm_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_ecm_file_free(
+	          &ecm_file,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "ecm_file",
+	 ecm_file );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_ecm_file_initialize(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ecm_file = (libodraw_ecm_file_t *) 0x12345678UL;
+
+	result = libodraw_ecm_file_initialize(
+	          &ecm_file,
+	          &error );
+
+	ecm_file = NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_ecm_file_initialize with malloc failing
+		 */
+		odraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libodraw_ecm_file_initialize(
+		          &ecm_file,
+		          &error );
+
+		if( odraw_test_malloc_attempts_before_fail != -1 )
+		{
+			odraw_test_malloc_attempts_before_fail = -1;
+
+			if( ecm_file != NULL )
+			{
+				libodraw_ecm_file_free(
+				 &ecm_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "ecm_file",
+			 ecm_file );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_ecm_file_initialize with memset failing
+		 */
+		odraw_test_memset_attempts_before_fail = test_number;
+
+		result = libodraw_ecm_file_initialize(
+		          &ecm_file,
+		          &error );
+
+		if( odraw_test_memset_attempts_before_fail != -1 )
+		{
+			odraw_test_memset_attempts_before_fail = -1;
+
+			if( ecm_file != NULL )
+			{
+				libodraw_ecm_file_free(
+				 &ecm_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "ecm_file",
+			 ecm_file );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ODRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( ecm_file != NULL )
+	{
+		libodraw_ecm_file_free(
+		 &ecm_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_ecm_file_free function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_ecm_file_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libodraw_ecm_file_free(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_ecm_file_decode_sector function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_ecm_file_decode_sector(
+     void )
+{
+	uint8_t encoded_data[ 2051 ];
+	uint8_t sector_data[ 2352 ];
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	uint32_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	encoded_data[ 0 ] = 0x00;
+	encoded_data[ 1 ] = 0x02;
+	encoded_data[ 2 ] = 0x00;
+
+	for( data_offset = 0;
+	     data_offset < 2048;
+	     data_offset++ )
+	{
+		encoded_data[ 3 + data_offset ] = (uint8_t) ( data_offset & 0xff );
+	}
+	/* Test regular cases
+	 */
+	result = libodraw_ecm_file_decode_sector(
+	          LIBODRAW_ECM_RECORD_TYPE_MODE1,
+	          encoded_data,
+	          sector_data,
+	          2352,
+	          2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "sector_data[ 15 ]",
+	 sector_data[ 15 ],
+	 (uint8_t) 1 );
+
+	result = memory_compare(
+	          &( sector_data[ 16 ] ),
+	          &( encoded_data[ 3 ] ),
+	          2048 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The EDC of the sector data including the stored EDC is 0
+	 */
+	result = libodraw_checksum_calculate_edc(
+	          &checksum_value,
+	          sector_data,
+	          2068,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libodraw_ecm_file_decode_sector(
+	          LIBODRAW_ECM_RECORD_TYPE_LITERAL,
+	          encoded_data,
+	          sector_data,
+	          2352,
+	          2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_ecm_file_decode_sector(
+	          LIBODRAW_ECM_RECORD_TYPE_MODE1,
+	          NULL,
+	          sector_data,
+	          2352,
+	          2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_ecm_file_decode_sector(
+	          LIBODRAW_ECM_RECORD_TYPE_MODE1,
+	          encoded_data,
+	          NULL,
+	          2352,
+	          2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_ecm_file_decode_sector(
+	          LIBODRAW_ECM_RECORD_TYPE_MODE1,
+	          encoded_data,
+	          sector_data,
+	          2048,
+	          2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_ecm_file_decode_sector(
+	          LIBODRAW_ECM_RECORD_TYPE_MODE1,
+	          encoded_data,
+	          sector_data,
+	          2352,
+	          2353,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_ecm_file_initialize",
+	 odraw_test_ecm_file_initialize );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_ecm_file_free",
+	 odraw_test_ecm_file_free );
+
+	/* TODO: add tests for libodraw_ecm_file_open_read */
+
+	/* TODO: add tests for libodraw_ecm_file_read_records */
+
+	/* TODO: add tests for libodraw_ecm_file_get_record_index_at_offset */
+
+	ODRAW_TEST_RUN(
+	 "libodraw_ecm_file_decode_sector",
+	 odraw_test_ecm_file_decode_sector );
+
+	/* TODO: add tests for libodraw_ecm_file_read_buffer_at_offset */
+
+	/* TODO: add tests for libodraw_ecm_file_get_data_size */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2023 @@
+/*
+ * Library FLAC functions test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_bit_stream.h"
+#include "../libodraw/libodraw_flac.h"
+
+/* Two FLAC frames of 192 16-bit stereo samples, the first contains fixed predicted
+ * right/side channels and the second constant silent channels
+ */
+uint8_t odraw_test_flac_frames_data[ 272 ] = {
+	0xff, 0xf8, 0x19, 0x98, 0x00, 0x5b, 0x14, 0xf0, 0x5e, 0x78, 0x44, 0x80, 0x34, 0x37, 0xa7, 0x13,
+	0x88, 0xbc, 0x4e, 0x74, 0xaf, 0xb3, 0xa5, 0x7d, 0x89, 0x73, 0x51, 0x89, 0x72, 0xf9, 0xa8, 0x72,
+	0xf9, 0xa8, 0x70, 0xd1, 0x0b, 0xe7, 0x0d, 0x10, 0xd4, 0x4b, 0x44, 0x35, 0x12, 0xd1, 0x03, 0x44,
+	0x5a, 0xc4, 0x0d, 0x11, 0x2d, 0xe5, 0x88, 0x96, 0xf2, 0xc4, 0x17, 0x88, 0x68, 0x82, 0xf3, 0x96,
+	0x8b, 0xce, 0x5a, 0x2f, 0x13, 0x9d, 0x38, 0x9c, 0x45, 0xb5, 0x18, 0x8b, 0x6a, 0x31, 0x2e, 0x5f,
+	0x62, 0x5c, 0xd4, 0x2f, 0x9c, 0xd4, 0x2f, 0x9c, 0x34, 0x43, 0x50, 0xe1, 0xa2, 0x17, 0xd6, 0xb1,
+	0x0b, 0xeb, 0x58, 0x81, 0xa2, 0x25, 0xa2, 0x06, 0x88, 0xb5, 0xa1, 0xa2, 0x2d, 0x68, 0x68, 0x82,
+	0xf3, 0x96, 0x20, 0xbc, 0x43, 0x7a, 0x71, 0x0d, 0xe9, 0xc4, 0xe2, 0x2f, 0x13, 0x9d, 0x2b, 0xec,
+	0xe9, 0x58, 0xa7, 0x05, 0xe7, 0x08, 0xc0, 0x06, 0xd4, 0x2e, 0xc4, 0x0d, 0x10, 0xd9, 0x10, 0x34,
+	0x42, 0xef, 0x96, 0x21, 0x77, 0xcb, 0x10, 0x35, 0xc8, 0x68, 0x81, 0xae, 0xe5, 0xa1, 0xae, 0xe5,
+	0xa1, 0xae, 0x4e, 0x72, 0xdc, 0x9c, 0x43, 0x6d, 0x18, 0x86, 0xda, 0x31, 0x39, 0x3d, 0x89, 0xcb,
+	0x42, 0xfb, 0x2d, 0x0b, 0xec, 0x2c, 0x43, 0x51, 0x85, 0x88, 0x5f, 0x36, 0x44, 0x2f, 0x9b, 0x22,
+	0x06, 0x88, 0x5d, 0x88, 0x1a, 0x21, 0xb2, 0x86, 0x88, 0x6c, 0xa1, 0xa2, 0x06, 0xbb, 0x96, 0x20,
+	0x6b, 0x90, 0xde, 0x5b, 0x90, 0xde, 0x5b, 0x93, 0x88, 0x6b, 0x93, 0x9c, 0xb9, 0xec, 0xe5, 0xcf,
+	0x62, 0x72, 0xd1, 0x89, 0xc9, 0xe6, 0xa3, 0x27, 0x9a, 0x8c, 0x2c, 0x42, 0xfb, 0x0b, 0x10, 0xd4,
+	0x2e, 0xc4, 0x35, 0x0b, 0xb1, 0x03, 0x44, 0x36, 0x44, 0x0d, 0x10, 0xbb, 0xe5, 0x88, 0x5d, 0xf0,
+	0x57, 0x6f, 0xff, 0xf8, 0x19, 0x18, 0x00, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xba };
+
+/* Hand-crafted subframes and residuals
+ */
+uint8_t odraw_test_flac_constant_subframe_data[ 2 ] = {
+	0x00, 0x05 };
+
+uint8_t odraw_test_flac_verbatim_subframe_data[ 3 ] = {
+	0x02, 0x7f, 0x80 };
+
+uint8_t odraw_test_flac_wasted_bits_subframe_data[ 2 ] = {
+	0x01, 0x83 };
+
+uint8_t odraw_test_flac_fixed_subframe_data[ 4 ] = {
+	0x12, 0x0a, 0x00, 0x56 };
+
+uint8_t odraw_test_flac_lpc_subframe_data[ 6 ] = {
+	0x40, 0x0a, 0x30, 0xa0, 0x01, 0x40 };
+
+uint8_t odraw_test_flac_residual_data[ 4 ] = {
+	0x04, 0x3e, 0x37, 0x40 };
+
+/* Rice coded values 5 and -1 with rice parameter 2, followed by -16 with rice parameter 0
+ */
+uint8_t odraw_test_flac_rice_data[ 5 ] = {
+	0x35, 0x00, 0x00, 0x00, 0x01 };
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Retrieves the expected left and right sample of the first frame
+ */
+void odraw_test_flac_get_expected_samples(
+      uint32_t sample_index,
+      int16_t *left_sample,
+      int16_t *right_sample )
+{
+	int32_t value_32bit = 0;
+
+	value_32bit = ( (int32_t) sample_index * 171 ) - 16000 + (int32_t) ( ( sample_index * sample_index * 7 ) % 17 ) - 8;
+
+	*left_sample = (int16_t) value_32bit;
+
+	if( value_32bit < 0 )
+	{
+		value_32bit = -( ( -value_32bit + 1 ) / 2 );
+	}
+	else
+	{
+		value_32bit /= 2;
+	}
+	*right_sample = (int16_t) ( value_32bit + (int32_t) ( ( sample_index * 13 ) % 5 ) );
+}
+
+/* Tests the libodraw_flac_read_frame_header function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_flac_read_frame_header(
+     void )
+{
+	uint8_t frame_header_data[ 6 ];
+
+	libodraw_flac_frame_header_t frame_header;
+
+	libcerror_error_t *error          = NULL;
+	libodraw_bit_stream_t *bit_stream = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libodraw_bit_stream_initialize(
+	          &bit_stream,
+	          odraw_test_flac_frames_data,
+	          272,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_flac_read_frame_header(
+	          &frame_header,
+	          bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT32(
+	 "frame_header.block_size",
+	 frame_header.block_size,
+	 (uint32_t) 192 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "frame_header.channel_assignment",
+	 frame_header.channel_assignment,
+	 LIBODRAW_FLAC_CHANNEL_ASSIGNMENT_RIGHT_SIDE );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "frame_header.number_of_channels",
+	 frame_header.number_of_channels,
+	 2 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "frame_header.bits_per_sample",
+	 frame_header.bits_per_sample,
+	 16 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset - ( bit_stream->bit_buffer_size / 8 )",
+	 bit_stream->byte_stream_offset - ( bit_stream->bit_buffer_size / 8 ),
+	 (size_t) 6 );
+
+	result = libodraw_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_flac_read_frame_header(
+	          NULL,
+	          bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_flac_read_frame_header(
+	          &frame_header,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an invalid sync code
+	 */
+	frame_header_data[ 0 ] = 0xff;
+	frame_header_data[ 1 ] = 0xf0;
+	frame_header_data[ 2 ] = 0x19;
+	frame_header_data[ 3 ] = 0x98;
+	frame_header_data[ 4 ] = 0x00;
+	frame_header_data[ 5 ] = 0x5b;
+
+	result = libodraw_bit_stream_initialize(
+	          &bit_stream,
+	          frame_header_data,
+	          6,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_flac_read_frame_header(
+	          &frame_header,
+	          bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an invalid checksum
+	 */
+	frame_header_data[ 1 ] = 0xf8;
+	frame_header_data[ 5 ] = 0x5c;
+
+	result = libodraw_bit_stream_initialize(
+	          &bit_stream,
+	          frame_header_data,
+	          6,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_flac_read_frame_header(
+	          &frame_header,
+	          bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with data too small
+	 */
+	result = libodraw_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_bit_stream_initialize(
+	          &bit_stream,
+	          frame_header_data,
+	          4,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_flac_read_frame_header(
+	          &frame_header,
+	          bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bit_stream != NULL )
+	{
+		libodraw_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_flac_read_signed_value function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_flac_read_signed_value(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libodraw_bit_stream_t *bit_stream = NULL;
+	int32_t value_32bit               = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_bit_stream_initialize(
+	          &bit_stream,
+	          odraw_test_flac_verbatim_subframe_data,
+	          3,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_flac_read_signed_value(
+	          bit_stream,
+	          8,
+	          &value_32bit,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "value_32bit",
+	 value_32bit,
+	 (int32_t) 2 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_flac_read_signed_value(
+	          bit_stream,
+	          8,
+	          &value_32bit,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "value_32bit",
+	 value_32bit,
+	 (int32_t) 127 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_flac_read_signed_value(
+	          bit_stream,
+	          4,
+	          &value_32bit,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "value_32bit",
+	 value_32bit,
+	 (int32_t) -8 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_flac_read_signed_value(
+	          bit_stream,
+	          0,
+	          &value_32bit,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "value_32bit",
+	 value_32bit,
+	 (int32_t) 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_flac_read_signed_value(
+	          NULL,
+	          8,
+	          &value_32bit,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_flac_read_signed_value(
+	          bit_stream,
+	          33,
+	          &value_32bit,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_flac_read_signed_value(
+	          bit_stream,
+	          8,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bit_stream != NULL )
+	{
+		libodraw_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_flac_read_rice_value function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_flac_read_rice_value(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libodraw_bit_stream_t *bit_stream = NULL;
+	int32_t value_32bit               = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_bit_stream_initialize(
+	          &bit_stream,
+	          odraw_test_flac_rice_data,
+	          5,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_flac_read_rice_value(
+	          bit_stream,
+	          2,
+	          &value_32bit,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "value_32bit",
+	 value_32bit,
+	 (int32_t) 5 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_flac_read_rice_value(
+	          bit_stream,
+	          2,
+	          &value_32bit,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "value_32bit",
+	 value_32bit,
+	 (int32_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a quotient of 31 which is followed by a 1-bit at the end of a 32-bit peek
+	 */
+	result = libodraw_flac_read_rice_value(
+	          bit_stream,
+	          0,
+	          &value_32bit,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "value_32bit",
+	 value_32bit,
+	 (int32_t) -16 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_flac_read_rice_value(
+	          NULL,
+	          2,
+	          &value_32bit,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_flac_read_rice_value(
+	          bit_stream,
+	          31,
+	          &value_32bit,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_flac_read_rice_value(
+	          bit_stream,
+	          2,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test reading beyond the end of the data
+	 */
+	result = libodraw_flac_read_rice_value(
+	          bit_stream,
+	          2,
+	          &value_32bit,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bit_stream != NULL )
+	{
+		libodraw_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_flac_read_residual function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_flac_read_residual(
+     void )
+{
+	int32_t samples[ 4 ];
+
+	libcerror_error_t *error          = NULL;
+	libodraw_bit_stream_t *bit_stream = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libodraw_bit_stream_initialize(
+	          &bit_stream,
+	          odraw_test_flac_residual_data,
+	          4,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_flac_read_residual(
+	          bit_stream,
+	          4,
+	          1,
+	          samples,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "samples[ 1 ]",
+	 samples[ 1 ],
+	 (int32_t) 0 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "samples[ 2 ]",
+	 samples[ 2 ],
+	 (int32_t) 3 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "samples[ 3 ]",
+	 samples[ 3 ],
+	 (int32_t) -3 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_bit_stream_initialize(
+	          &bit_stream,
+	          odraw_test_flac_residual_data,
+	          4,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_flac_read_residual(
+	          bit_stream,
+	          4,
+	          1,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a block size that is not a multiple of the number of partitions
+	 */
+	result = libodraw_flac_read_residual(
+	          bit_stream,
+	          5,
+	          1,
+	          samples,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a predictor order larger than the partition size
+	 */
+	result = libodraw_bit_stream_initialize(
+	          &bit_stream,
+	          odraw_test_flac_residual_data,
+	          4,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_flac_read_residual(
+	          bit_stream,
+	          4,
+	          3,
+	          samples,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bit_stream != NULL )
+	{
+		libodraw_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_flac_read_subframe function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_flac_read_subframe(
+     void )
+{
+	uint8_t subframe_data[ 2 ];
+	int32_t samples[ 3 ];
+
+	libcerror_error_t *error          = NULL;
+	libodraw_bit_stream_t *bit_stream = NULL;
+	int result                        = 0;
+
+	/* Test a constant subframe
+	 */
+	result = libodraw_bit_stream_initialize(
+	          &bit_stream,
+	          odraw_test_flac_constant_subframe_data,
+	          2,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_flac_read_subframe(
+	          bit_stream,
+	          3,
+	          8,
+	          samples,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "samples[ 0 ]",
+	 samples[ 0 ],
+	 (int32_t) 5 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "samples[ 1 ]",
+	 samples[ 1 ],
+	 (int32_t) 5 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "samples[ 2 ]",
+	 samples[ 2 ],
+	 (int32_t) 5 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a verbatim subframe
+	 */
+	result = libodraw_bit_stream_initialize(
+	          &bit_stream,
+	          odraw_test_flac_verbatim_subframe_data,
+	          3,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_flac_read_subframe(
+	          bit_stream,
+	          2,
+	          8,
+	          samples,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "samples[ 0 ]",
+	 samples[ 0 ],
+	 (int32_t) 127 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "samples[ 1 ]",
+	 samples[ 1 ],
+	 (int32_t) -128 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a constant subframe with wasted bits
+	 */
+	result = libodraw_bit_stream_initialize(
+	          &bit_stream,
+	          odraw_test_flac_wasted_bits_subframe_data,
+	          2,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_flac_read_subframe(
+	          bit_stream,
+	          3,
+	          8,
+	          samples,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "samples[ 0 ]",
+	 samples[ 0 ],
+	 (int32_t) 6 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "samples[ 1 ]",
+	 samples[ 1 ],
+	 (int32_t) 6 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "samples[ 2 ]",
+	 samples[ 2 ],
+	 (int32_t) 6 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a fixed predicted subframe
+	 */
+	result = libodraw_bit_stream_initialize(
+	          &bit_stream,
+	          odraw_test_flac_fixed_subframe_data,
+	          4,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_flac_read_subframe(
+	          bit_stream,
+	          3,
+	          8,
+	          samples,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "samples[ 0 ]",
+	 samples[ 0 ],
+	 (int32_t) 10 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "samples[ 1 ]",
+	 samples[ 1 ],
+	 (int32_t) 11 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "samples[ 2 ]",
+	 samples[ 2 ],
+	 (int32_t) 10 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a linear predicted subframe
+	 */
+	result = libodraw_bit_stream_initialize(
+	          &bit_stream,
+	          odraw_test_flac_lpc_subframe_data,
+	          6,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_flac_read_subframe(
+	          bit_stream,
+	          3,
+	          8,
+	          samples,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "samples[ 0 ]",
+	 samples[ 0 ],
+	 (int32_t) 10 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "samples[ 1 ]",
+	 samples[ 1 ],
+	 (int32_t) 20 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT32(
+	 "samples[ 2 ]",
+	 samples[ 2 ],
+	 (int32_t) 39 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_bit_stream_initialize(
+	          &bit_stream,
+	          odraw_test_flac_constant_subframe_data,
+	          2,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_flac_read_subframe(
+	          bit_stream,
+	          0,
+	          8,
+	          samples,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_flac_read_subframe(
+	          bit_stream,
+	          3,
+	          0,
+	          samples,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_flac_read_subframe(
+	          bit_stream,
+	          3,
+	          33,
+	          samples,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_flac_read_subframe(
+	          bit_stream,
+	          3,
+	          8,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a reserved subframe type
+	 */
+	subframe_data[ 0 ] = 0x04;
+	subframe_data[ 1 ] = 0x00;
+
+	result = libodraw_bit_stream_initialize(
+	          &bit_stream,
+	          subframe_data,
+	          2,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_flac_read_subframe(
+	          bit_stream,
+	          3,
+	          8,
+	          samples,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a predictor order larger than the block size
+	 */
+	subframe_data[ 0 ] = 0x18;
+
+	result = libodraw_bit_stream_initialize(
+	          &bit_stream,
+	          subframe_data,
+	          2,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_flac_read_subframe(
+	          bit_stream,
+	          3,
+	          8,
+	          samples,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bit_stream != NULL )
+	{
+		libodraw_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_flac_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_flac_decompress(
+     void )
+{
+	uint8_t frames_data[ 272 ];
+	uint8_t uncompressed_data[ 1536 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_offset = 0;
+	uint32_t sample_index         = 0;
+	uint32_t value_32bit          = 0;
+	uint16_t value_16bit          = 0;
+	int16_t left_sample           = 0;
+	int16_t right_sample          = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libodraw_flac_decompress(
+	          odraw_test_flac_frames_data,
+	          272,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          1536,
+	          _BYTE_STREAM_ENDIAN_LITTLE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 272 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( sample_index = 0;
+	     sample_index < 192;
+	     sample_index++ )
+	{
+		odraw_test_flac_get_expected_samples(
+		 sample_index,
+		 &left_sample,
+		 &right_sample );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( uncompressed_data[ sample_index * 4 ] ),
+		 value_16bit );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT16(
+		 "left sample",
+		 value_16bit,
+		 (uint16_t) left_sample );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( uncompressed_data[ ( sample_index * 4 ) + 2 ] ),
+		 value_16bit );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT16(
+		 "right sample",
+		 value_16bit,
+		 (uint16_t) right_sample );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( uncompressed_data[ 768 + ( sample_index * 4 ) ] ),
+		 value_32bit );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT32(
+		 "silent samples",
+		 value_32bit,
+		 (uint32_t) 0 );
+	}
+	/* Test decompressing only the first frame in big-endian
+	 */
+	result = libodraw_flac_decompress(
+	          odraw_test_flac_frames_data,
+	          272,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          768,
+	          _BYTE_STREAM_ENDIAN_BIG,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 258 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	odraw_test_flac_get_expected_samples(
+	 191,
+	 &left_sample,
+	 &right_sample );
+
+	byte_stream_copy_to_uint16_big_endian(
+	 &( uncompressed_data[ 764 ] ),
+	 value_16bit );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT16(
+	 "left sample",
+	 value_16bit,
+	 (uint16_t) left_sample );
+
+	/* Test error cases
+	 */
+	result = libodraw_flac_decompress(
+	          NULL,
+	          272,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          1536,
+	          _BYTE_STREAM_ENDIAN_LITTLE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_flac_decompress(
+	          odraw_test_flac_frames_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          1536,
+	          _BYTE_STREAM_ENDIAN_LITTLE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_flac_decompress(
+	          odraw_test_flac_frames_data,
+	          272,
+	          NULL,
+	          uncompressed_data,
+	          1536,
+	          _BYTE_STREAM_ENDIAN_LITTLE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_flac_decompress(
+	          odraw_test_flac_frames_data,
+	          272,
+	          &compressed_data_offset,
+	          NULL,
+	          1536,
+	          _BYTE_STREAM_ENDIAN_LITTLE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_flac_decompress(
+	          odraw_test_flac_frames_data,
+	          272,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          _BYTE_STREAM_ENDIAN_LITTLE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_flac_decompress(
+	          odraw_test_flac_frames_data,
+	          272,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          1535,
+	          _BYTE_STREAM_ENDIAN_LITTLE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_flac_decompress(
+	          odraw_test_flac_frames_data,
+	          272,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          1536,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with uncompressed data too small for the first frame
+	 */
+	result = libodraw_flac_decompress(
+	          odraw_test_flac_frames_data,
+	          272,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          512,
+	          _BYTE_STREAM_ENDIAN_LITTLE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with compressed data too small for the uncompressed data
+	 */
+	result = libodraw_flac_decompress(
+	          odraw_test_flac_frames_data,
+	          258,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          1536,
+	          _BYTE_STREAM_ENDIAN_LITTLE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a corrupted frame
+	 */
+	result = memory_copy(
+	          frames_data,
+	          odraw_test_flac_frames_data,
+	          272 ) != NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	frames_data[ 100 ] ^= 0x01;
+
+	result = libodraw_flac_decompress(
+	          frames_data,
+	          272,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          1536,
+	          _BYTE_STREAM_ENDIAN_LITTLE,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_flac_read_frame_header",
+	 odraw_test_flac_read_frame_header );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_flac_read_signed_value",
+	 odraw_test_flac_read_signed_value );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_flac_read_rice_value",
+	 odraw_test_flac_read_rice_value );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_flac_read_residual",
+	 odraw_test_flac_read_residual );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_flac_read_subframe",
+	 odraw_test_flac_read_subframe );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_flac_decompress",
+	 odraw_test_flac_decompress );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
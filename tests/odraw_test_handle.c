@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -32,12 +33,15 @@
 
 #include "odraw_test_functions.h"
 #include "odraw_test_getopt.h"
+#include "odraw_test_libbfio.h"
 #include "odraw_test_libcerror.h"
 #include "odraw_test_libodraw.h"
 #include "odraw_test_macros.h"
 #include "odraw_test_memory.h"
 
+#include "../libodraw/libodraw_data_file.h"
 #include "../libodraw/libodraw_handle.h"
+#include "../libodraw/libodraw_statistics.h"
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
 #error Unsupported size of wchar_t
@@ -47,6 +51,14 @@
 #define ODRAW_TEST_HANDLE_VERBOSE
  */
 
+/* A data file of 64 bytes for the data file read tests
+ */
+uint8_t odraw_test_handle_data_file_data[ 64 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+	0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f };
+
 /* Creates and opens a source handle
  * Returns 1 if successful or -1 on error
  */
@@ -425,24 +437,27 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libodraw_handle_open function
+/* Tests the libodraw_handle_clone function
  * Returns 1 if successful or 0 if not
  */
-int odraw_test_handle_open(
+int odraw_test_handle_clone(
      const system_character_t *source )
 {
-	char narrow_source[ 256 ];
+	uint8_t clone_buffer[ 64 ];
+	uint8_t source_buffer[ 64 ];
 
-	libcerror_error_t *error  = NULL;
-	libodraw_handle_t *handle = NULL;
-	int result                = 0;
+	libcerror_error_t *error         = NULL;
+	libodraw_handle_t *clone_handle  = NULL;
+	libodraw_handle_t *handle        = NULL;
+	libodraw_handle_t *source_handle = NULL;
+	ssize_t read_count               = 0;
+	int result                       = 0;
 
 	/* Initialize test
 	 */
-	result = odraw_test_get_narrow_source(
+	result = odraw_test_handle_open_source(
+	          &source_handle,
 	          source,
-	          narrow_source,
-	          256,
 	          &error );
 
 	ODRAW_TEST_ASSERT_EQUAL_INT(
@@ -450,12 +465,36 @@ int odraw_test_handle_open(
 	 result,
 	 1 );
 
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "source_handle",
+	 source_handle );
+
 	ODRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libodraw_handle_initialize(
-	          &handle,
+	read_count = libodraw_handle_read_buffer_at_offset(
+	              source_handle,
+	              source_buffer,
+	              64,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test clone of an open handle and read the same offset from both handles
+	 */
+	result = libodraw_handle_clone(
+	          &clone_handle,
+	          source_handle,
+	          0,
 	          &error );
 
 	ODRAW_TEST_ASSERT_EQUAL_INT(
@@ -464,19 +503,86 @@ int odraw_test_handle_open(
 	 1 );
 
 	ODRAW_TEST_ASSERT_IS_NOT_NULL(
-	 "handle",
-	 handle );
+	 "clone_handle",
+	 clone_handle );
 
 	ODRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open
+	read_count = libodraw_handle_read_buffer_at_offset(
+	              clone_handle,
+	              clone_buffer,
+	              64,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          clone_buffer,
+	          source_buffer,
+	          64 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test free of the source handle before the clone
 	 */
-	result = libodraw_handle_open(
-	          handle,
-	          narrow_source,
-	          LIBODRAW_OPEN_READ,
+	result = odraw_test_handle_close_source(
+	          &source_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "source_handle",
+	 source_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libodraw_handle_read_buffer_at_offset(
+	              clone_handle,
+	              clone_buffer,
+	              64,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          clone_buffer,
+	          source_buffer,
+	          64 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libodraw_handle_free(
+	          &clone_handle,
 	          &error );
 
 	ODRAW_TEST_ASSERT_EQUAL_INT(
@@ -484,34 +590,55 @@ int odraw_test_handle_open(
 	 result,
 	 1 );
 
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "clone_handle",
+	 clone_handle );
+
 	ODRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test free of the clone before the source handle
 	 */
-	result = libodraw_handle_open(
-	          handle,
-	          narrow_source,
-	          LIBODRAW_OPEN_READ,
+	result = odraw_test_handle_open_source(
+	          &source_handle,
+	          source,
 	          &error );
 
 	ODRAW_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "source_handle",
+	 source_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libodraw_handle_clone(
+	          &clone_handle,
+	          source_handle,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "clone_handle",
+	 clone_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Clean up
-	 */
 	result = libodraw_handle_free(
-	          &handle,
+	          &clone_handle,
 	          &error );
 
 	ODRAW_TEST_ASSERT_EQUAL_INT(
@@ -520,84 +647,79 @@ int odraw_test_handle_open(
 	 1 );
 
 	ODRAW_TEST_ASSERT_IS_NULL(
-	 "handle",
-	 handle );
+	 "clone_handle",
+	 clone_handle );
 
 	ODRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
+	read_count = libodraw_handle_read_buffer_at_offset(
+	              source_handle,
+	              clone_buffer,
+	              64,
+	              0,
+	              &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( handle != NULL )
-	{
-		libodraw_handle_free(
-		 &handle,
-		 NULL );
-	}
-	return( 0 );
-}
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-/* Tests the libodraw_handle_open_wide function
- * Returns 1 if successful or 0 if not
- */
-int odraw_test_handle_open_wide(
-     const system_character_t *source )
-{
-	wchar_t wide_source[ 256 ];
+	result = memory_compare(
+	          clone_buffer,
+	          source_buffer,
+	          64 );
 
-	libcerror_error_t *error  = NULL;
-	libodraw_handle_t *handle = NULL;
-	int result                = 0;
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	/* Initialize test
+	/* Test reopen of the source handle after the shared layout was released
 	 */
-	result = odraw_test_get_wide_source(
-	          source,
-	          wide_source,
-	          256,
+	result = libodraw_handle_close(
+	          source_handle,
 	          &error );
 
 	ODRAW_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	ODRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libodraw_handle_initialize(
-	          &handle,
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libodraw_handle_open_wide(
+	          source_handle,
+	          source,
+	          LIBODRAW_OPEN_READ,
+	          &error );
+#else
+	result = libodraw_handle_open(
+	          source_handle,
+	          source,
+	          LIBODRAW_OPEN_READ,
 	          &error );
+#endif
 
 	ODRAW_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 1 );
 
-	ODRAW_TEST_ASSERT_IS_NOT_NULL(
-	 "handle",
-	 handle );
-
 	ODRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open
-	 */
-	result = libodraw_handle_open_wide(
-	          handle,
-	          wide_source,
-	          LIBODRAW_OPEN_READ,
+	result = libodraw_handle_open_data_files(
+	          source_handle,
 	          &error );
 
 	ODRAW_TEST_ASSERT_EQUAL_INT(
@@ -609,12 +731,38 @@ int odraw_test_handle_open_wide(
 	 "error",
 	 error );
 
+	read_count = libodraw_handle_read_buffer_at_offset(
+	              source_handle,
+	              clone_buffer,
+	              64,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          clone_buffer,
+	          source_buffer,
+	          64 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
-	result = libodraw_handle_open_wide(
-	          handle,
-	          wide_source,
-	          LIBODRAW_OPEN_READ,
+	result = libodraw_handle_clone(
+	          NULL,
+	          source_handle,
+	          0,
 	          &error );
 
 	ODRAW_TEST_ASSERT_EQUAL_INT(
@@ -629,9 +777,67 @@ int odraw_test_handle_open_wide(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
+	clone_handle = (libodraw_handle_t *) 0x12345678UL;
+
+	result = libodraw_handle_clone(
+	          &clone_handle,
+	          source_handle,
+	          0,
+	          &error );
+
+	clone_handle = NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_handle_clone(
+	          &clone_handle,
+	          NULL,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_handle_clone(
+	          &clone_handle,
+	          source_handle,
+	          0xff,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test clone of a handle without open data files
 	 */
-	result = libodraw_handle_free(
+	result = libodraw_handle_initialize(
 	          &handle,
 	          &error );
 
@@ -640,7 +846,7 @@ int odraw_test_handle_open_wide(
 	 result,
 	 1 );
 
-	ODRAW_TEST_ASSERT_IS_NULL(
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
 	 "handle",
 	 handle );
 
@@ -648,14 +854,902 @@ int odraw_test_handle_open_wide(
 	 "error",
 	 error );
 
-	return( 1 );
-
-on_error:
+	result = libodraw_handle_clone(
+	          &clone_handle,
+	          handle,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_handle_free(
+	          &handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = odraw_test_handle_close_source(
+	          &source_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "source_handle",
+	 source_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libodraw_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( clone_handle != NULL )
+	{
+		libodraw_handle_free(
+		 &clone_handle,
+		 NULL );
+	}
+	if( source_handle != NULL )
+	{
+		odraw_test_handle_close_source(
+		 &source_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Tests the libodraw_handle_clone function with LIBODRAW_CLONE_FLAG_WITHOUT_DATA_FILES
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_handle_clone_without_data_files(
+     const system_character_t *source )
+{
+	uint8_t clone_buffer[ 64 ];
+	uint8_t source_buffer[ 64 ];
+
+	libbfio_pool_t *file_io_pool     = NULL;
+	libcerror_error_t *error         = NULL;
+	libodraw_handle_t *clone_handle  = NULL;
+	libodraw_handle_t *source_handle = NULL;
+	ssize_t read_count               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = odraw_test_handle_open_source(
+	          &source_handle,
+	          source,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "source_handle",
+	 source_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libodraw_handle_read_buffer_at_offset(
+	              source_handle,
+	              source_buffer,
+	              64,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_handle_clone(
+	          &clone_handle,
+	          source_handle,
+	          LIBODRAW_CLONE_FLAG_WITHOUT_DATA_FILES,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "clone_handle",
+	 clone_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_clone(
+	          &file_io_pool,
+	          ( (libodraw_internal_handle_t *) source_handle )->data_file_io_pool,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_handle_open_data_files_file_io_pool(
+	          clone_handle,
+	          file_io_pool,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libodraw_handle_read_buffer_at_offset(
+	              clone_handle,
+	              clone_buffer,
+	              64,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          clone_buffer,
+	          source_buffer,
+	          64 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libodraw_handle_open_data_files_file_io_pool(
+	          clone_handle,
+	          file_io_pool,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_handle_free(
+	          &clone_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "clone_handle",
+	 clone_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = odraw_test_handle_close_source(
+	          &source_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "source_handle",
+	 source_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( clone_handle != NULL )
+	{
+		libodraw_handle_free(
+		 &clone_handle,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( source_handle != NULL )
+	{
+		odraw_test_handle_close_source(
+		 &source_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* Tests the libodraw_handle_open function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_handle_open(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error  = NULL;
+	libodraw_handle_t *handle = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = odraw_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_handle_initialize(
+	          &handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libodraw_handle_open(
+	          handle,
+	          narrow_source,
+	          LIBODRAW_OPEN_READ,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_handle_open(
+	          handle,
+	          narrow_source,
+	          LIBODRAW_OPEN_READ,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_handle_free(
+	          &handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libodraw_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libodraw_handle_open_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_handle_open_wide(
+     const system_character_t *source )
+{
+	wchar_t wide_source[ 256 ];
+
+	libcerror_error_t *error  = NULL;
+	libodraw_handle_t *handle = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = odraw_test_get_wide_source(
+	          source,
+	          wide_source,
+	          256,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_handle_initialize(
+	          &handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libodraw_handle_open_wide(
+	          handle,
+	          wide_source,
+	          LIBODRAW_OPEN_READ,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_handle_open_wide(
+	          handle,
+	          wide_source,
+	          LIBODRAW_OPEN_READ,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_handle_free(
+	          &handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libodraw_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Tests the libodraw_handle_open_data_files function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_handle_open_data_files(
+     const system_character_t *source )
+{
+	uint8_t buffer[ 16 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libodraw_data_file_t *data_file  = NULL;
+	libodraw_handle_t *handle        = NULL;
+	off64_t data_file_offset         = 0;
+	off64_t extent_offset            = 0;
+	size64_t extent_size             = 0;
+	ssize_t read_count               = 0;
+	uint32_t bytes_per_sector        = 0;
+	uint32_t extent_flags            = 0;
+	uint8_t size_set                 = 0;
+	uint8_t track_type               = 0;
+	int data_file_index              = 0;
+	int extent_index                 = 0;
+	int number_of_data_files         = 0;
+	int number_of_extents            = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_handle_initialize(
+	          &handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_handle_open_data_files(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_handle_open_data_files(
+	          handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libodraw_handle_open_wide(
+	          handle,
+	          source,
+	          LIBODRAW_OPEN_READ,
+	          &error );
+#else
+	result = libodraw_handle_open(
+	          handle,
+	          source,
+	          LIBODRAW_OPEN_READ,
+	          &error );
+#endif
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_handle_open_data_files(
+	          handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The data files of which the size is known from the file system metadata
+	 * are not opened until they are read from
+	 */
+	result = libodraw_handle_get_number_of_data_files(
+	          handle,
+	          &number_of_data_files,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_file_index = 0;
+	     data_file_index < number_of_data_files;
+	     data_file_index++ )
+	{
+		result = libodraw_handle_get_data_file(
+		          handle,
+		          data_file_index,
+		          &data_file,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		size_set = ( (libodraw_internal_data_file_t *) data_file )->data_file_descriptor->size_set;
+
+		result = libodraw_data_file_free(
+		          &data_file,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( size_set != 0 )
+		{
+			result = libbfio_pool_get_handle(
+			          ( (libodraw_internal_handle_t *) handle )->data_file_io_pool,
+			          data_file_index,
+			          &file_io_handle,
+			          &error );
+
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libbfio_handle_is_open(
+			          file_io_handle,
+			          &error );
+
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Reading from an extent opens the data file of the extent
+	 */
+	result = libodraw_handle_get_number_of_extents(
+	          handle,
+	          &number_of_extents,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		result = libodraw_handle_get_extent(
+		          handle,
+		          extent_index,
+		          &extent_offset,
+		          &extent_size,
+		          &data_file_index,
+		          &data_file_offset,
+		          &bytes_per_sector,
+		          &track_type,
+		          &extent_flags,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( extent_flags & LIBODRAW_EXTENT_FLAG_IS_SPARSE ) == 0 )
+		{
+			break;
+		}
+	}
+	if( extent_index < number_of_extents )
+	{
+		read_count = libodraw_handle_read_buffer_at_offset(
+		              handle,
+		              buffer,
+		              16,
+		              extent_offset,
+		              &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 16 );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_pool_get_handle(
+		          ( (libodraw_internal_handle_t *) handle )->data_file_io_pool,
+		          data_file_index,
+		          &file_io_handle,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_is_open(
+		          file_io_handle,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libodraw_handle_close(
+	          handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_handle_free(
+	          &handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
 	if( error != NULL )
 	{
 		libcerror_error_free(
 		 &error );
 	}
+	if( data_file != NULL )
+	{
+		libodraw_data_file_free(
+		 &data_file,
+		 NULL );
+	}
 	if( handle != NULL )
 	{
 		libodraw_handle_free(
@@ -665,7 +1759,7 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
 
 /* Tests the libodraw_handle_close function
  * Returns 1 if successful or 0 if not
@@ -1245,13 +2339,350 @@ int odraw_test_handle_get_offset(
 		 result,
 		 -1 );
 
-		ODRAW_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+		ODRAW_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Tests the libodraw_internal_handle_read_data_file_buffer_from_pool function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_internal_handle_read_data_file_buffer_from_pool(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libbfio_pool_t *file_io_pool     = NULL;
+	libcerror_error_t *error         = NULL;
+	libodraw_handle_t *handle        = NULL;
+	ssize_t read_count               = 0;
+	uint64_t value                   = 0;
+	int entry                        = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_handle_initialize(
+	          &handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = odraw_test_open_file_io_handle(
+	          &file_io_handle,
+	          odraw_test_handle_data_file_data,
+	          64,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_initialize(
+	          &file_io_pool,
+	          0,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_append_handle(
+	          file_io_pool,
+	          &entry,
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The pool now manages the file IO handle
+	 */
+	file_io_handle = NULL;
+
+	result = libodraw_statistics_resize(
+	          ( (libodraw_internal_handle_t *) handle )->statistics,
+	          1,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libodraw_internal_handle_t *) handle )->data_file_io_pool = file_io_pool;
+
+	/* Test regular cases
+	 */
+	read_count = libodraw_internal_handle_read_data_file_buffer_from_pool(
+	              (libodraw_internal_handle_t *) handle,
+	              0,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libodraw_internal_handle_read_data_file_buffer_from_pool(
+	              (libodraw_internal_handle_t *) handle,
+	              0,
+	              buffer,
+	              16,
+	              16,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libodraw_internal_handle_read_data_file_buffer_from_pool(
+	              (libodraw_internal_handle_t *) handle,
+	              0,
+	              buffer,
+	              16,
+	              48,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libodraw_internal_handle_read_data_file_buffer_from_pool(
+	              (libodraw_internal_handle_t *) handle,
+	              0,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Only the reads that do not continue where the previous read ended count as a seek
+	 */
+	result = libodraw_handle_get_data_file_statistics(
+	          handle,
+	          0,
+	          LIBODRAW_STATISTICS_VALUE_TYPE_NUMBER_OF_READS,
+	          &value,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 4 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_handle_get_data_file_statistics(
+	          handle,
+	          0,
+	          LIBODRAW_STATISTICS_VALUE_TYPE_NUMBER_OF_SEEKS,
+	          &value,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 2 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_handle_get_statistics(
+	          handle,
+	          LIBODRAW_STATISTICS_VALUE_TYPE_NUMBER_OF_SEEKS,
+	          &value,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 2 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libodraw_internal_handle_read_data_file_buffer_from_pool(
+	              NULL,
+	              0,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libodraw_internal_handle_read_data_file_buffer_from_pool(
+	              (libodraw_internal_handle_t *) handle,
+	              1,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	( (libodraw_internal_handle_t *) handle )->data_file_io_pool = NULL;
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_handle_free(
+	          &handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -1260,11 +2691,31 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( handle != NULL )
+	{
+		( (libodraw_internal_handle_t *) handle )->data_file_io_pool = NULL;
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		odraw_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( handle != NULL )
+	{
+		libodraw_handle_free(
+		 &handle,
+		 NULL );
+	}
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
-
 /* Tests the libodraw_internal_handle_get_basename_size function
  * Returns 1 if successful or 0 if not
  */
@@ -1721,6 +3172,262 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libodraw_handle_get_number_of_extents function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_handle_get_number_of_extents(
+     libodraw_handle_t *handle )
+{
+	libcerror_error_t *error     = NULL;
+	int number_of_extents        = 0;
+	int number_of_extents_is_set = 0;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libodraw_handle_get_number_of_extents(
+	          handle,
+	          &number_of_extents,
+	          &error );
+
+	ODRAW_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_extents_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libodraw_handle_get_number_of_extents(
+	          NULL,
+	          &number_of_extents,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_extents_is_set != 0 )
+	{
+		result = libodraw_handle_get_number_of_extents(
+		          handle,
+		          NULL,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ODRAW_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_handle_get_extent function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_handle_get_extent(
+     libodraw_handle_t *handle )
+{
+	libcerror_error_t *error  = NULL;
+	off64_t data_file_offset  = 0;
+	off64_t expected_offset   = 0;
+	off64_t offset            = 0;
+	size64_t media_size       = 0;
+	size64_t size             = 0;
+	uint32_t bytes_per_sector = 0;
+	uint32_t flags            = 0;
+	uint8_t track_type        = 0;
+	int data_file_index       = 0;
+	int extent_index          = 0;
+	int number_of_extents     = 0;
+	int result                = 0;
+
+	result = libodraw_handle_get_number_of_extents(
+	          handle,
+	          &number_of_extents,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		result = libodraw_handle_get_extent(
+		          handle,
+		          extent_index,
+		          &offset,
+		          &size,
+		          &data_file_index,
+		          &data_file_offset,
+		          &bytes_per_sector,
+		          &track_type,
+		          &flags,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The extents should be contiguous
+		 */
+		ODRAW_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) expected_offset );
+
+		expected_offset += (off64_t) size;
+	}
+	if( number_of_extents > 0 )
+	{
+		ODRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "expected_offset",
+		 (uint64_t) expected_offset,
+		 (uint64_t) media_size );
+	}
+	/* Test error cases
+	 */
+	result = libodraw_handle_get_extent(
+	          NULL,
+	          0,
+	          &offset,
+	          &size,
+	          &data_file_index,
+	          &data_file_offset,
+	          &bytes_per_sector,
+	          &track_type,
+	          &flags,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_handle_get_extent(
+	          handle,
+	          -1,
+	          &offset,
+	          &size,
+	          &data_file_index,
+	          &data_file_offset,
+	          &bytes_per_sector,
+	          &track_type,
+	          &flags,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_extents > 0 )
+	{
+		result = libodraw_handle_get_extent(
+		          handle,
+		          0,
+		          NULL,
+		          &size,
+		          &data_file_index,
+		          &data_file_offset,
+		          &bytes_per_sector,
+		          &track_type,
+		          &flags,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ODRAW_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -1776,6 +3483,14 @@ int main(
 	 "libodraw_handle_free",
 	 odraw_test_handle_free );
 
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_internal_handle_read_data_file_buffer_from_pool",
+	 odraw_test_internal_handle_read_data_file_buffer_from_pool );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -1808,6 +3523,20 @@ int main(
 		 odraw_test_handle_open_close,
 		 source );
 
+		ODRAW_TEST_RUN_WITH_ARGS(
+		 "libodraw_handle_clone",
+		 odraw_test_handle_clone,
+		 source );
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+		ODRAW_TEST_RUN_WITH_ARGS(
+		 "libodraw_handle_clone_without_data_files",
+		 odraw_test_handle_clone_without_data_files,
+		 source );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
 		/* Initialize test
 		 */
 		result = odraw_test_handle_open_source(
@@ -1833,7 +3562,14 @@ int main(
 		 odraw_test_handle_signal_abort,
 		 handle );
 
-		/* TODO: add tests for libodraw_handle_open_data_files */
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+		ODRAW_TEST_RUN_WITH_ARGS(
+		 "libodraw_handle_open_data_files",
+		 odraw_test_handle_open_data_files,
+		 source );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
 
 		/* TODO: add tests for libodraw_handle_open_data_files_file_io_pool */
 
@@ -1864,6 +3600,20 @@ int main(
 
 		/* TODO: add tests for libodraw_handle_read_buffer_from_track */
 
+		/* TODO: add tests for libodraw_internal_handle_resize_data_file_access_counts */
+
+		/* TODO: add tests for libodraw_internal_handle_acquire_data_file */
+
+		/* TODO: add tests for libodraw_internal_handle_release_data_files */
+
+		/* TODO: add tests for libodraw_internal_handle_pre_open_next_track_data_file */
+
+		/* TODO: add tests for libodraw_internal_handle_read_data_file_buffer_at_offset */
+
+		/* TODO: add tests for libodraw_internal_handle_fill_read_ahead_buffer */
+
+		/* TODO: add tests for libodraw_internal_handle_copy_sector_data_to_buffer */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
 
 		/* TODO: add tests for libodraw_handle_read_buffer_at_offset */
@@ -1920,6 +3670,24 @@ int main(
 
 		/* TODO: add tests for libodraw_handle_set_maximum_number_of_open_handles */
 
+		/* TODO: add tests for libodraw_handle_share_maximum_number_of_open_handles */
+
+		/* TODO: add tests for libodraw_handle_set_use_layout_cache */
+
+		/* TODO: add tests for libodraw_handle_set_use_direct_io */
+
+		/* TODO: add tests for libodraw_handle_set_use_read_ahead */
+
+		/* TODO: add tests for libodraw_handle_set_read_ahead_window_size */
+
+		/* TODO: add tests for libodraw_handle_set_collect_timing_statistics */
+
+		/* TODO: add tests for libodraw_handle_get_statistics */
+
+		/* TODO: add tests for libodraw_handle_get_data_file_statistics */
+
+		/* TODO: add tests for libodraw_handle_reset_statistics */
+
 #if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
 
 		/* TODO: add tests for libodraw_handle_set_media_values */
@@ -1947,6 +3715,16 @@ int main(
 
 		/* TODO: add tests for libodraw_handle_append_data_file_wide */
 
+		ODRAW_TEST_RUN_WITH_ARGS(
+		 "libodraw_handle_get_number_of_extents",
+		 odraw_test_handle_get_number_of_extents,
+		 handle );
+
+		ODRAW_TEST_RUN_WITH_ARGS(
+		 "libodraw_handle_get_extent",
+		 odraw_test_handle_get_extent,
+		 handle );
+
 		/* Clean up
 		 */
 		result = odraw_test_handle_close_source(
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -398,6 +399,281 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libodraw_io_handle_copy_sector_payloads_to_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_io_handle_copy_sector_payloads_to_buffer(
+     void )
+{
+	uint8_t buffer[ 2324 * 2 ];
+	uint8_t sector_data[ 2352 * 2 ];
+	uint8_t form_map[ 2 ];
+
+	libcerror_error_t *error        = NULL;
+	libodraw_io_handle_t *io_handle = NULL;
+	ssize_t copy_count              = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A form 1 sector followed by a form 2 sector
+	 */
+	memory_set(
+	 sector_data,
+	 0,
+	 2352 * 2 );
+
+	memory_set(
+	 &( sector_data[ 24 ] ),
+	 0x11,
+	 2328 );
+
+	sector_data[ 2352 + 18 ] = 0x20;
+	sector_data[ 2352 + 22 ] = 0x20;
+
+	memory_set(
+	 &( sector_data[ 2352 + 24 ] ),
+	 0x22,
+	 2328 );
+
+	/* Test regular cases
+	 */
+	copy_count = libodraw_io_handle_copy_sector_payloads_to_buffer(
+	              io_handle,
+	              sector_data,
+	              2352 * 2,
+	              2352,
+	              LIBODRAW_TRACK_TYPE_MODE2_2352,
+	              LIBODRAW_SECTOR_PAYLOAD_MODE_MIXED,
+	              buffer,
+	              2324 * 2,
+	              form_map,
+	              2,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) ( 2048 + 2324 ) );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "form_map[ 0 ]",
+	 form_map[ 0 ],
+	 LIBODRAW_SECTOR_CLASS_MODE2_FORM1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "form_map[ 1 ]",
+	 form_map[ 1 ],
+	 LIBODRAW_SECTOR_CLASS_MODE2_FORM2 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 2047 ]",
+	 buffer[ 2047 ],
+	 0x11 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 2048 ]",
+	 buffer[ 2048 ],
+	 0x22 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 2048 + 2323 ]",
+	 buffer[ 2048 + 2323 ],
+	 0x22 );
+
+	copy_count = libodraw_io_handle_copy_sector_payloads_to_buffer(
+	              io_handle,
+	              sector_data,
+	              2352 * 2,
+	              2352,
+	              LIBODRAW_TRACK_TYPE_MODE2_2352,
+	              LIBODRAW_SECTOR_PAYLOAD_MODE_FORM2,
+	              buffer,
+	              2324 * 2,
+	              NULL,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) ( 2324 * 2 ) );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 2323 ]",
+	 buffer[ 2323 ],
+	 0x11 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 2324 ]",
+	 buffer[ 2324 ],
+	 0x22 );
+
+	/* Test error cases
+	 */
+	copy_count = libodraw_io_handle_copy_sector_payloads_to_buffer(
+	              NULL,
+	              sector_data,
+	              2352 * 2,
+	              2352,
+	              LIBODRAW_TRACK_TYPE_MODE2_2352,
+	              LIBODRAW_SECTOR_PAYLOAD_MODE_MIXED,
+	              buffer,
+	              2324 * 2,
+	              form_map,
+	              2,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Form 2 payloads cannot be read from a mode 1 track
+	 */
+	copy_count = libodraw_io_handle_copy_sector_payloads_to_buffer(
+	              io_handle,
+	              sector_data,
+	              2352 * 2,
+	              2352,
+	              LIBODRAW_TRACK_TYPE_MODE1_2352,
+	              LIBODRAW_SECTOR_PAYLOAD_MODE_FORM2,
+	              buffer,
+	              2324 * 2,
+	              NULL,
+	              0,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	copy_count = libodraw_io_handle_copy_sector_payloads_to_buffer(
+	              io_handle,
+	              sector_data,
+	              2352 * 2,
+	              2352,
+	              LIBODRAW_TRACK_TYPE_MODE2_2352,
+	              LIBODRAW_SECTOR_PAYLOAD_MODE_MIXED,
+	              buffer,
+	              2324,
+	              form_map,
+	              2,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	copy_count = libodraw_io_handle_copy_sector_payloads_to_buffer(
+	              io_handle,
+	              sector_data,
+	              2352 * 2,
+	              2352,
+	              LIBODRAW_TRACK_TYPE_MODE2_2352,
+	              LIBODRAW_SECTOR_PAYLOAD_MODE_MIXED,
+	              buffer,
+	              2324 * 2,
+	              form_map,
+	              1,
+	              &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "copy_count",
+	 copy_count,
+	 (ssize_t) -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libodraw_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
 
 /* The main program
@@ -429,6 +705,10 @@ int main(
 	 "libodraw_io_handle_clear",
 	 odraw_test_io_handle_clear );
 
+	ODRAW_TEST_RUN(
+	 "libodraw_io_handle_copy_sector_payloads_to_buffer",
+	 odraw_test_io_handle_copy_sector_payloads_to_buffer );
+
 	/* TODO: add tests for libodraw_io_handle_copy_sector_data_to_buffer */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
@@ -0,0 +1,1079 @@
+/*
+ * Library layout arena type test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_layout_arena.h"
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Tests the libodraw_layout_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_layout_arena_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libodraw_layout_arena_t *layout_arena = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libodraw_layout_arena_initialize(
+	          &layout_arena,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "layout_arena",
+	 layout_arena );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_layout_arena_free(
+	          &layout_arena,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "layout_arena",
+	 layout_arena );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_layout_arena_initialize(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	layout_arena = (libodraw_layout_arena_t *) 0x12345678UL;
+
+	result = libodraw_layout_arena_initialize(
+	          &layout_arena,
+	          &error );
+
+	layout_arena = NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_layout_arena_initialize with malloc failing
+		 */
+		odraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libodraw_layout_arena_initialize(
+		          &layout_arena,
+		          &error );
+
+		if( odraw_test_malloc_attempts_before_fail != -1 )
+		{
+			odraw_test_malloc_attempts_before_fail = -1;
+
+			if( layout_arena != NULL )
+			{
+				libodraw_layout_arena_free(
+				 &layout_arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "layout_arena",
+			 layout_arena );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_layout_arena_initialize with memset failing
+		 */
+		odraw_test_memset_attempts_before_fail = test_number;
+
+		result = libodraw_layout_arena_initialize(
+		          &layout_arena,
+		          &error );
+
+		if( odraw_test_memset_attempts_before_fail != -1 )
+		{
+			odraw_test_memset_attempts_before_fail = -1;
+
+			if( layout_arena != NULL )
+			{
+				libodraw_layout_arena_free(
+				 &layout_arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "layout_arena",
+			 layout_arena );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ODRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( layout_arena != NULL )
+	{
+		libodraw_layout_arena_free(
+		 &layout_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_layout_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_layout_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libodraw_layout_arena_free(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_layout_arena_append_track function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_layout_arena_append_track(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libodraw_layout_arena_t *layout_arena = NULL;
+	libodraw_track_value_t *track_value   = NULL;
+	int number_of_tracks                  = 0;
+	int result                            = 0;
+	int track_index                       = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_layout_arena_initialize(
+	          &layout_arena,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "layout_arena",
+	 layout_arena );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( track_index = 0;
+	     track_index < 9;
+	     track_index++ )
+	{
+		result = libodraw_layout_arena_append_track(
+		          layout_arena,
+		          &number_of_tracks,
+		          &track_value,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "number_of_tracks",
+		 number_of_tracks,
+		 track_index );
+
+		ODRAW_TEST_ASSERT_IS_NOT_NULL(
+		 "track_value",
+		 track_value );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "track_value->start_sector",
+		 track_value->start_sector,
+		 (uint64_t) 0 );
+
+		track_value->start_sector = (uint64_t) track_index * 1000;
+	}
+	result = libodraw_layout_arena_get_number_of_tracks(
+	          layout_arena,
+	          &number_of_tracks,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_tracks",
+	 number_of_tracks,
+	 9 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The records are retained when the region is resized
+	 */
+	for( track_index = 0;
+	     track_index < 9;
+	     track_index++ )
+	{
+		result = libodraw_layout_arena_get_track_by_index(
+		          layout_arena,
+		          track_index,
+		          &track_value,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_IS_NOT_NULL(
+		 "track_value",
+		 track_value );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ODRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "track_value->start_sector",
+		 track_value->start_sector,
+		 (uint64_t) track_index * 1000 );
+	}
+	/* Test error cases
+	 */
+	result = libodraw_layout_arena_append_track(
+	          NULL,
+	          &track_index,
+	          &track_value,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_layout_arena_append_track(
+	          layout_arena,
+	          NULL,
+	          &track_value,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_layout_arena_get_track_by_index(
+	          layout_arena,
+	          9,
+	          &track_value,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+
+	/* Test libodraw_layout_arena_append_track with malloc failing when the region is resized
+	 */
+	odraw_test_malloc_attempts_before_fail = 0;
+
+	for( track_index = 9;
+	     track_index < 16;
+	     track_index++ )
+	{
+		result = libodraw_layout_arena_append_track(
+		          layout_arena,
+		          &number_of_tracks,
+		          &track_value,
+		          &error );
+
+		if( result != 1 )
+		{
+			break;
+		}
+	}
+	if( odraw_test_malloc_attempts_before_fail != -1 )
+	{
+		odraw_test_malloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ODRAW_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libodraw_layout_arena_get_number_of_tracks(
+		          layout_arena,
+		          &number_of_tracks,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "number_of_tracks",
+		 number_of_tracks,
+		 track_index );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* defined( HAVE_ODRAW_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libodraw_layout_arena_free(
+	          &layout_arena,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "layout_arena",
+	 layout_arena );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( layout_arena != NULL )
+	{
+		libodraw_layout_arena_free(
+		 &layout_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_layout_arena_append_sector_range function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_layout_arena_append_sector_range(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libodraw_layout_arena_t *layout_arena = NULL;
+	libodraw_sector_range_t *sector_range = NULL;
+	libodraw_track_value_t *track_value   = NULL;
+	int number_of_sector_ranges           = 0;
+	int result                            = 0;
+	int sector_range_index                = 0;
+	int track_index                       = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_layout_arena_initialize(
+	          &layout_arena,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "layout_arena",
+	 layout_arena );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libodraw_layout_arena_append_sector_range(
+	          layout_arena,
+	          LIBODRAW_LAYOUT_ARENA_REGION_LEAD_OUTS,
+	          &sector_range_index,
+	          &sector_range,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_range",
+	 sector_range );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	sector_range->start_sector = 9220;
+
+	/* Resizing a region that precedes the lead-outs region retains the lead-outs
+	 */
+	for( track_index = 0;
+	     track_index < 5;
+	     track_index++ )
+	{
+		result = libodraw_layout_arena_append_track(
+		          layout_arena,
+		          &sector_range_index,
+		          &track_value,
+		          &error );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ODRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		track_value->start_sector = 0xffffffffffffffffUL;
+	}
+	result = libodraw_layout_arena_get_number_of_sector_ranges(
+	          layout_arena,
+	          LIBODRAW_LAYOUT_ARENA_REGION_LEAD_OUTS,
+	          &number_of_sector_ranges,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sector_ranges",
+	 number_of_sector_ranges,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_layout_arena_get_number_of_sector_ranges(
+	          layout_arena,
+	          LIBODRAW_LAYOUT_ARENA_REGION_SESSIONS,
+	          &number_of_sector_ranges,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sector_ranges",
+	 number_of_sector_ranges,
+	 0 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_layout_arena_get_sector_range_by_index(
+	          layout_arena,
+	          LIBODRAW_LAYOUT_ARENA_REGION_LEAD_OUTS,
+	          0,
+	          &sector_range,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_range",
+	 sector_range );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "sector_range->start_sector",
+	 sector_range->start_sector,
+	 (uint64_t) 9220 );
+
+	/* Test error cases
+	 */
+	result = libodraw_layout_arena_append_sector_range(
+	          layout_arena,
+	          LIBODRAW_LAYOUT_ARENA_REGION_TRACKS,
+	          &sector_range_index,
+	          &sector_range,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_layout_arena_append_sector_range(
+	          layout_arena,
+	          LIBODRAW_LAYOUT_ARENA_NUMBER_OF_REGIONS,
+	          &sector_range_index,
+	          &sector_range,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_layout_arena_get_sector_range_by_index(
+	          layout_arena,
+	          LIBODRAW_LAYOUT_ARENA_REGION_RUN_OUTS,
+	          0,
+	          &sector_range,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_layout_arena_free(
+	          &layout_arena,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "layout_arena",
+	 layout_arena );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( layout_arena != NULL )
+	{
+		libodraw_layout_arena_free(
+		 &layout_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_layout_arena_compact function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_layout_arena_compact(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libodraw_layout_arena_t *layout_arena = NULL;
+	libodraw_sector_range_t *sector_range = NULL;
+	libodraw_track_value_t *track_value   = NULL;
+	size_t memory_size                    = 0;
+	int record_index                      = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_layout_arena_initialize(
+	          &layout_arena,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "layout_arena",
+	 layout_arena );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_layout_arena_append_track(
+	          layout_arena,
+	          &record_index,
+	          &track_value,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	track_value->number_of_sectors = 9220;
+
+	result = libodraw_layout_arena_append_sector_range(
+	          layout_arena,
+	          LIBODRAW_LAYOUT_ARENA_REGION_SESSIONS,
+	          &record_index,
+	          &sector_range,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	sector_range->number_of_sectors = 20620;
+
+	/* Test regular cases
+	 */
+	result = libodraw_layout_arena_compact(
+	          layout_arena,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_layout_arena_get_memory_size(
+	          layout_arena,
+	          &memory_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "memory_size",
+	 memory_size,
+	 sizeof( libodraw_layout_arena_t ) + sizeof( libodraw_track_value_t ) + sizeof( libodraw_sector_range_t ) );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_layout_arena_get_track_by_index(
+	          layout_arena,
+	          0,
+	          &track_value,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "track_value->number_of_sectors",
+	 track_value->number_of_sectors,
+	 (uint64_t) 9220 );
+
+	result = libodraw_layout_arena_get_sector_range_by_index(
+	          layout_arena,
+	          LIBODRAW_LAYOUT_ARENA_REGION_SESSIONS,
+	          0,
+	          &sector_range,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "sector_range->number_of_sectors",
+	 sector_range->number_of_sectors,
+	 (uint64_t) 20620 );
+
+	/* An empty layout arena has no allocated data
+	 */
+	result = libodraw_layout_arena_empty(
+	          layout_arena,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_layout_arena_get_memory_size(
+	          layout_arena,
+	          &memory_size,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "memory_size",
+	 memory_size,
+	 sizeof( libodraw_layout_arena_t ) );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_layout_arena_compact(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_layout_arena_get_memory_size(
+	          layout_arena,
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_layout_arena_free(
+	          &layout_arena,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "layout_arena",
+	 layout_arena );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( layout_arena != NULL )
+	{
+		libodraw_layout_arena_free(
+		 &layout_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_layout_arena_initialize",
+	 odraw_test_layout_arena_initialize );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_layout_arena_free",
+	 odraw_test_layout_arena_free );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_layout_arena_append_track",
+	 odraw_test_layout_arena_append_track );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_layout_arena_append_sector_range",
+	 odraw_test_layout_arena_append_sector_range );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_layout_arena_compact",
+	 odraw_test_layout_arena_compact );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
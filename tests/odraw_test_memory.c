@@ -45,6 +45,9 @@ int odraw_test_memcpy_attempts_before_fail                           = -1;
 int odraw_test_memset_attempts_before_fail                           = -1;
 int odraw_test_realloc_attempts_before_fail                          = -1;
 
+size_t odraw_test_malloc_count                                       = 0;
+size_t odraw_test_realloc_count                                      = 0;
+
 /* Custom malloc for testing memory error cases
  * Note this function might fail if compiled with optimation
  * Returns a pointer to newly allocated data or NULL
@@ -70,6 +73,8 @@ void *malloc(
 	{
 		odraw_test_malloc_attempts_before_fail--;
 	}
+	odraw_test_malloc_count++;
+
 	ptr = odraw_test_real_malloc(
 	       size );
 
@@ -166,6 +171,8 @@ void *realloc(
 	{
 		odraw_test_realloc_attempts_before_fail--;
 	}
+	odraw_test_realloc_count++;
+
 	ptr = odraw_test_real_realloc(
 	       ptr,
 	       size );
@@ -42,6 +42,10 @@ extern int odraw_test_memset_attempts_before_fail;
 
 extern int odraw_test_realloc_attempts_before_fail;
 
+extern size_t odraw_test_malloc_count;
+
+extern size_t odraw_test_realloc_count;
+
 #endif /* defined( HAVE_ODRAW_TEST_MEMORY ) */
 
 #if defined( __cplusplus )
@@ -0,0 +1,871 @@
+/*
+ * Library sector scan functions test program
+ *
+ * Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "odraw_test_libcerror.h"
+#include "odraw_test_libodraw.h"
+#include "odraw_test_macros.h"
+#include "odraw_test_memory.h"
+#include "odraw_test_unused.h"
+
+#include "../libodraw/libodraw_definitions.h"
+#include "../libodraw/libodraw_sector_scan.h"
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+/* Creates a raw sector with synchronisation data and a header
+ */
+void odraw_test_sector_scan_set_raw_sector(
+      uint8_t *sector_data,
+      uint8_t mode,
+      uint8_t submode )
+{
+	memory_set(
+	 sector_data,
+	 0,
+	 2352 );
+
+	memory_set(
+	 &( sector_data[ 1 ] ),
+	 0xff,
+	 10 );
+
+	sector_data[ 12 ] = 0x00;
+	sector_data[ 13 ] = 0x02;
+	sector_data[ 14 ] = 0x16;
+	sector_data[ 15 ] = mode;
+
+	/* The sub-header is stored twice
+	 */
+	sector_data[ 18 ] = submode;
+	sector_data[ 22 ] = submode;
+
+	sector_data[ 24 ] = 0x43;
+	sector_data[ 25 ] = 0x44;
+}
+
+/* Tests the libodraw_sector_scan_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_scan_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libodraw_sector_scan_t *sector_scan = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 3;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libodraw_sector_scan_initialize(
+	          &sector_scan,
+	          2,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_scan",
+	 sector_scan );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_sector_scan_free(
+	          &sector_scan,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "sector_scan",
+	 sector_scan );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_sector_scan_initialize(
+	          NULL,
+	          2,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sector_scan = (libodraw_sector_scan_t *) 0x12345678UL;
+
+	result = libodraw_sector_scan_initialize(
+	          &sector_scan,
+	          2,
+	          &error );
+
+	sector_scan = NULL;
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_scan_initialize(
+	          &sector_scan,
+	          0,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "sector_scan",
+	 sector_scan );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ODRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_sector_scan_initialize with malloc failing
+		 */
+		odraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libodraw_sector_scan_initialize(
+		          &sector_scan,
+		          2,
+		          &error );
+
+		if( odraw_test_malloc_attempts_before_fail != -1 )
+		{
+			odraw_test_malloc_attempts_before_fail = -1;
+
+			if( sector_scan != NULL )
+			{
+				libodraw_sector_scan_free(
+				 &sector_scan,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "sector_scan",
+			 sector_scan );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libodraw_sector_scan_initialize with memset failing
+		 */
+		odraw_test_memset_attempts_before_fail = test_number;
+
+		result = libodraw_sector_scan_initialize(
+		          &sector_scan,
+		          2,
+		          &error );
+
+		if( odraw_test_memset_attempts_before_fail != -1 )
+		{
+			odraw_test_memset_attempts_before_fail = -1;
+
+			if( sector_scan != NULL )
+			{
+				libodraw_sector_scan_free(
+				 &sector_scan,
+				 NULL );
+			}
+		}
+		else
+		{
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ODRAW_TEST_ASSERT_IS_NULL(
+			 "sector_scan",
+			 sector_scan );
+
+			ODRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ODRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_scan != NULL )
+	{
+		libodraw_sector_scan_free(
+		 &sector_scan,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_sector_scan_free function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_scan_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libodraw_sector_scan_free(
+	          NULL,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libodraw_sector_scan_data_is_zero function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_scan_data_is_zero(
+     void )
+{
+	uint8_t data[ 256 ];
+
+	size_t data_offset = 0;
+	int result         = 0;
+
+	memory_set(
+	 data,
+	 0,
+	 256 );
+
+	/* Test regular cases
+	 */
+	result = libodraw_sector_scan_data_is_zero(
+	          data,
+	          256 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a non-zero byte at every position and with an unaligned start
+	 */
+	for( data_offset = 0;
+	     data_offset < 256;
+	     data_offset++ )
+	{
+		data[ data_offset ] = 0x01;
+
+		result = libodraw_sector_scan_data_is_zero(
+		          data,
+		          256 );
+
+		ODRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		if( data_offset > 0 )
+		{
+			result = libodraw_sector_scan_data_is_zero(
+			          &( data[ 1 ] ),
+			          data_offset );
+
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			result = libodraw_sector_scan_data_is_zero(
+			          &( data[ 1 ] ),
+			          data_offset - 1 );
+
+			ODRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+		data[ data_offset ] = 0x00;
+	}
+	result = libodraw_sector_scan_data_is_zero(
+	          data,
+	          0 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libodraw_sector_scan_classify_sector function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_scan_classify_sector(
+     void )
+{
+	uint8_t sector_data[ 2352 ];
+
+	uint8_t sector_class = 0;
+
+	/* Test regular cases
+	 */
+	memory_set(
+	 sector_data,
+	 0,
+	 2352 );
+
+	sector_class = libodraw_sector_scan_classify_sector(
+	                sector_data,
+	                2352,
+	                LIBODRAW_TRACK_TYPE_MODE1_2352 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "sector_class",
+	 sector_class,
+	 LIBODRAW_SECTOR_CLASS_ZERO );
+
+	odraw_test_sector_scan_set_raw_sector(
+	 sector_data,
+	 1,
+	 0 );
+
+	sector_class = libodraw_sector_scan_classify_sector(
+	                sector_data,
+	                2352,
+	                LIBODRAW_TRACK_TYPE_MODE1_2352 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "sector_class",
+	 sector_class,
+	 LIBODRAW_SECTOR_CLASS_MODE1 );
+
+	odraw_test_sector_scan_set_raw_sector(
+	 sector_data,
+	 2,
+	 0x08 );
+
+	sector_class = libodraw_sector_scan_classify_sector(
+	                sector_data,
+	                2352,
+	                LIBODRAW_TRACK_TYPE_MODE2_2352 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "sector_class",
+	 sector_class,
+	 LIBODRAW_SECTOR_CLASS_MODE2_FORM1 );
+
+	odraw_test_sector_scan_set_raw_sector(
+	 sector_data,
+	 2,
+	 0x20 );
+
+	sector_class = libodraw_sector_scan_classify_sector(
+	                sector_data,
+	                2352,
+	                LIBODRAW_TRACK_TYPE_MODE2_2352 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "sector_class",
+	 sector_class,
+	 LIBODRAW_SECTOR_CLASS_MODE2_FORM2 );
+
+	/* A sector without synchronisation data in an audio track is audio
+	 */
+	memory_set(
+	 sector_data,
+	 0x5a,
+	 2352 );
+
+	sector_class = libodraw_sector_scan_classify_sector(
+	                sector_data,
+	                2352,
+	                LIBODRAW_TRACK_TYPE_AUDIO );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "sector_class",
+	 sector_class,
+	 LIBODRAW_SECTOR_CLASS_AUDIO );
+
+	sector_class = libodraw_sector_scan_classify_sector(
+	                sector_data,
+	                2352,
+	                LIBODRAW_TRACK_TYPE_MODE1_2352 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "sector_class",
+	 sector_class,
+	 LIBODRAW_SECTOR_CLASS_BAD_SYNC );
+
+	/* A header with an invalid BCD address
+	 */
+	odraw_test_sector_scan_set_raw_sector(
+	 sector_data,
+	 1,
+	 0 );
+
+	sector_data[ 13 ] = 0x6a;
+
+	sector_class = libodraw_sector_scan_classify_sector(
+	                sector_data,
+	                2352,
+	                LIBODRAW_TRACK_TYPE_MODE1_2352 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "sector_class",
+	 sector_class,
+	 LIBODRAW_SECTOR_CLASS_BAD_HEADER );
+
+	/* Test error cases
+	 */
+	sector_class = libodraw_sector_scan_classify_sector(
+	                NULL,
+	                2352,
+	                LIBODRAW_TRACK_TYPE_MODE1_2352 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "sector_class",
+	 sector_class,
+	 LIBODRAW_SECTOR_CLASS_UNKNOWN );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libodraw_sector_scan_classify_sectors function
+ * Returns 1 if successful or 0 if not
+ */
+int odraw_test_sector_scan_classify_sectors(
+     void )
+{
+	uint8_t data[ 2352 * 4 ];
+
+	libcerror_error_t *error            = NULL;
+	libodraw_sector_scan_t *sector_scan = NULL;
+	uint64_t number_of_sectors          = 0;
+	uint64_t start_sector               = 0;
+	uint8_t sector_class                = 0;
+	int number_of_anomalies             = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libodraw_sector_scan_initialize(
+	          &sector_scan,
+	          1,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_scan",
+	 sector_scan );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A mode 1 sector followed by two contiguous mode 2 sectors and a zero sector
+	 */
+	odraw_test_sector_scan_set_raw_sector(
+	 data,
+	 1,
+	 0 );
+
+	odraw_test_sector_scan_set_raw_sector(
+	 &( data[ 2352 ] ),
+	 2,
+	 0x08 );
+
+	odraw_test_sector_scan_set_raw_sector(
+	 &( data[ 2352 * 2 ] ),
+	 2,
+	 0x08 );
+
+	memory_set(
+	 &( data[ 2352 * 3 ] ),
+	 0,
+	 2352 );
+
+	/* Test regular cases
+	 */
+	result = libodraw_sector_scan_classify_sectors(
+	          sector_scan,
+	          0,
+	          100,
+	          data,
+	          2352 * 4,
+	          2352,
+	          LIBODRAW_TRACK_TYPE_MODE1_2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_sector_scan_get_number_of_sectors(
+	          sector_scan,
+	          0,
+	          LIBODRAW_SECTOR_CLASS_MODE1,
+	          &number_of_sectors,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_sector_scan_get_number_of_sectors(
+	          sector_scan,
+	          0,
+	          LIBODRAW_SECTOR_CLASS_ZERO,
+	          &number_of_sectors,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The contiguous mode 2 sectors are merged into a single anomaly
+	 */
+	result = libodraw_sector_scan_get_number_of_anomalies(
+	          sector_scan,
+	          &number_of_anomalies,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_anomalies",
+	 number_of_anomalies,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libodraw_sector_scan_get_anomaly(
+	          sector_scan,
+	          0,
+	          &start_sector,
+	          &number_of_sectors,
+	          &sector_class,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "start_sector",
+	 start_sector,
+	 (uint64_t) 101 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 2 );
+
+	ODRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "sector_class",
+	 sector_class,
+	 LIBODRAW_SECTOR_CLASS_MODE2_FORM1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libodraw_sector_scan_classify_sectors(
+	          NULL,
+	          0,
+	          100,
+	          data,
+	          2352 * 4,
+	          2352,
+	          LIBODRAW_TRACK_TYPE_MODE1_2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_scan_classify_sectors(
+	          sector_scan,
+	          1,
+	          100,
+	          data,
+	          2352 * 4,
+	          2352,
+	          LIBODRAW_TRACK_TYPE_MODE1_2352,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libodraw_sector_scan_get_anomaly(
+	          sector_scan,
+	          1,
+	          &start_sector,
+	          &number_of_sectors,
+	          &sector_class,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ODRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libodraw_sector_scan_free(
+	          &sector_scan,
+	          &error );
+
+	ODRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "sector_scan",
+	 sector_scan );
+
+	ODRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_scan != NULL )
+	{
+		libodraw_sector_scan_free(
+		 &sector_scan,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ODRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ODRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	ODRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT )
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_scan_initialize",
+	 odraw_test_sector_scan_initialize );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_scan_free",
+	 odraw_test_sector_scan_free );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_scan_data_is_zero",
+	 odraw_test_sector_scan_data_is_zero );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_scan_classify_sector",
+	 odraw_test_sector_scan_classify_sector );
+
+	ODRAW_TEST_RUN(
+	 "libodraw_sector_scan_classify_sectors",
+	 odraw_test_sector_scan_classify_sectors );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBODRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,287 @@
+#!/usr/bin/env python
+#
+# Python-bindings handle type test script
+#
+# Copyright (C) 2010-2024, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+import argparse
+import os
+import shutil
+import sys
+import tempfile
+import threading
+import unittest
+
+import pyodraw
+
+
+class HandleTypeTests(unittest.TestCase):
+  """Tests the handle type."""
+
+  _BYTES_PER_SECTOR = 2048
+
+  _NUMBER_OF_SECTORS = 2
+
+  def setUp(self):
+    """Creates a CUE and BIN test file."""
+    self._temporary_directory = tempfile.mkdtemp()
+
+    self._data = bytearray()
+    for sector_index in range(self._NUMBER_OF_SECTORS):
+      self._data.extend(
+          bytes([0x41 + sector_index]) * self._BYTES_PER_SECTOR)
+
+    data_file_path = os.path.join(self._temporary_directory, "test.bin")
+    with open(data_file_path, "wb") as file_object:
+      file_object.write(self._data)
+
+    self._test_file = os.path.join(self._temporary_directory, "test.cue")
+    with open(self._test_file, "w") as file_object:
+      file_object.write(
+          "FILE \"test.bin\" BINARY\n"
+          "  TRACK 01 MODE1/2048\n"
+          "    INDEX 01 00:00:00\n")
+
+  def tearDown(self):
+    """Removes the CUE and BIN test file."""
+    shutil.rmtree(self._temporary_directory, True)
+
+  def _OpenHandle(self):
+    """Opens a handle on the test file."""
+    odraw_handle = pyodraw.handle()
+    odraw_handle.open(self._test_file)
+    odraw_handle.open_data_files()
+    return odraw_handle
+
+  def test_signal_abort(self):
+    """Tests the signal_abort function."""
+    odraw_handle = pyodraw.handle()
+
+    odraw_handle.signal_abort()
+
+  def test_open(self):
+    """Tests the open function."""
+    odraw_handle = pyodraw.handle()
+
+    odraw_handle.open(self._test_file)
+
+    with self.assertRaises(IOError):
+      odraw_handle.open(self._test_file)
+
+    odraw_handle.close()
+
+    with self.assertRaises(TypeError):
+      odraw_handle.open(None)
+
+    with self.assertRaises(ValueError):
+      odraw_handle.open(self._test_file, mode="w")
+
+  def test_close(self):
+    """Tests the close function."""
+    odraw_handle = pyodraw.handle()
+
+    with self.assertRaises(IOError):
+      odraw_handle.close()
+
+  def test_get_media_size(self):
+    """Tests the get_media_size function and media_size property."""
+    odraw_handle = self._OpenHandle()
+
+    media_size = odraw_handle.get_media_size()
+    self.assertEqual(media_size, len(self._data))
+
+    self.assertEqual(odraw_handle.media_size, len(self._data))
+
+    odraw_handle.close()
+
+  def test_read_buffer(self):
+    """Tests the read_buffer function."""
+    odraw_handle = self._OpenHandle()
+
+    data = odraw_handle.read_buffer(size=16)
+    self.assertEqual(data, bytes(self._data[:16]))
+
+    data = odraw_handle.read_buffer()
+    self.assertEqual(data, bytes(self._data[16:]))
+
+    data = odraw_handle.read_buffer(size=16)
+    self.assertEqual(data, b"")
+
+    with self.assertRaises(ValueError):
+      odraw_handle.read_buffer(size=-1)
+
+    odraw_handle.close()
+
+  def test_read_buffer_at_offset(self):
+    """Tests the read_buffer_at_offset function."""
+    odraw_handle = self._OpenHandle()
+
+    data = odraw_handle.read_buffer_at_offset(16, self._BYTES_PER_SECTOR - 8)
+    self.assertEqual(
+        data, bytes(self._data[self._BYTES_PER_SECTOR - 8:
+                               self._BYTES_PER_SECTOR + 8]))
+
+    data = odraw_handle.read_buffer_at_offset(16, len(self._data))
+    self.assertEqual(data, b"")
+
+    with self.assertRaises(ValueError):
+      odraw_handle.read_buffer_at_offset(-1, 0)
+
+    with self.assertRaises(ValueError):
+      odraw_handle.read_buffer_at_offset(16, -1)
+
+    odraw_handle.close()
+
+  def test_readinto(self):
+    """Tests the readinto function."""
+    odraw_handle = self._OpenHandle()
+
+    buffer = bytearray(self._BYTES_PER_SECTOR)
+    read_count = odraw_handle.readinto(buffer)
+    self.assertEqual(read_count, self._BYTES_PER_SECTOR)
+    self.assertEqual(buffer, self._data[:self._BYTES_PER_SECTOR])
+
+    buffer = bytearray(len(self._data))
+    view = memoryview(buffer)
+    read_count = odraw_handle.readinto(view[8:])
+    self.assertEqual(read_count, self._BYTES_PER_SECTOR)
+    self.assertEqual(
+        buffer[8:8 + self._BYTES_PER_SECTOR],
+        self._data[self._BYTES_PER_SECTOR:])
+
+    with self.assertRaises(TypeError):
+      odraw_handle.readinto(b"read-only")
+
+    odraw_handle.close()
+
+  def test_readinto_at_offset(self):
+    """Tests the readinto_at_offset function."""
+    odraw_handle = self._OpenHandle()
+
+    buffer = bytearray(16)
+    read_count = odraw_handle.readinto_at_offset(
+        buffer, self._BYTES_PER_SECTOR - 8)
+    self.assertEqual(read_count, 16)
+    self.assertEqual(
+        buffer, self._data[self._BYTES_PER_SECTOR - 8:
+                           self._BYTES_PER_SECTOR + 8])
+
+    with self.assertRaises(ValueError):
+      odraw_handle.readinto_at_offset(buffer, -1)
+
+    odraw_handle.close()
+
+  def test_readinto_threaded(self):
+    """Tests the readinto_at_offset function from multiple threads."""
+    odraw_handle = self._OpenHandle()
+
+    results = {}
+
+    def ReadSector(sector_index):
+      buffer = bytearray(self._BYTES_PER_SECTOR)
+      for _ in range(64):
+        odraw_handle.readinto_at_offset(
+            buffer, sector_index * self._BYTES_PER_SECTOR)
+      results[sector_index] = bytes(buffer)
+
+    threads = [
+        threading.Thread(target=ReadSector, args=(sector_index,))
+        for sector_index in range(self._NUMBER_OF_SECTORS)]
+    for thread in threads:
+      thread.start()
+    for thread in threads:
+      thread.join()
+
+    for sector_index in range(self._NUMBER_OF_SECTORS):
+      offset = sector_index * self._BYTES_PER_SECTOR
+      self.assertEqual(
+          results[sector_index],
+          bytes(self._data[offset:offset + self._BYTES_PER_SECTOR]))
+
+    odraw_handle.close()
+
+  def test_seek_offset(self):
+    """Tests the seek_offset function."""
+    odraw_handle = self._OpenHandle()
+
+    odraw_handle.seek_offset(16, os.SEEK_SET)
+
+    offset = odraw_handle.get_offset()
+    self.assertEqual(offset, 16)
+
+    odraw_handle.seek_offset(16, os.SEEK_CUR)
+
+    offset = odraw_handle.get_offset()
+    self.assertEqual(offset, 32)
+
+    odraw_handle.seek_offset(-16, os.SEEK_END)
+
+    offset = odraw_handle.get_offset()
+    self.assertEqual(offset, len(self._data) - 16)
+
+    with self.assertRaises(IOError):
+      odraw_handle.seek_offset(-1, os.SEEK_SET)
+
+    odraw_handle.close()
+
+  def test_get_track(self):
+    """Tests the get_number_of_tracks and get_track functions."""
+    odraw_handle = self._OpenHandle()
+
+    number_of_tracks = odraw_handle.get_number_of_tracks()
+    self.assertEqual(number_of_tracks, 1)
+
+    self.assertEqual(odraw_handle.number_of_tracks, 1)
+
+    track = odraw_handle.get_track(0)
+    self.assertEqual(len(track), 5)
+    self.assertEqual(track[0], 0)
+    self.assertEqual(track[1], self._NUMBER_OF_SECTORS)
+
+    with self.assertRaises(IOError):
+      odraw_handle.get_track(number_of_tracks)
+
+    odraw_handle.close()
+
+  def test_get_extent(self):
+    """Tests the get_number_of_extents and get_extent functions."""
+    odraw_handle = self._OpenHandle()
+
+    number_of_extents = odraw_handle.get_number_of_extents()
+    self.assertGreaterEqual(number_of_extents, 1)
+
+    self.assertEqual(odraw_handle.number_of_extents, number_of_extents)
+
+    extent = odraw_handle.get_extent(0)
+    self.assertEqual(len(extent), 7)
+    self.assertEqual(extent[0], 0)
+    self.assertEqual(extent[4], self._BYTES_PER_SECTOR)
+
+    with self.assertRaises(IOError):
+      odraw_handle.get_extent(number_of_extents)
+
+    odraw_handle.close()
+
+
+if __name__ == "__main__":
+  argument_parser = argparse.ArgumentParser()
+
+  options, unknown_options = argument_parser.parse_known_args()
+  unknown_options.insert(0, sys.argv[0])
+
+  unittest.main(argv=unknown_options, verbosity=2)
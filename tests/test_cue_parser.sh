@@ -0,0 +1,66 @@
+#!/usr/bin/env bash
+# Tests the CUE parser and reader on the CUE files in the test corpus.
+#
+# Version: 20261018
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+EXIT_IGNORE=77;
+
+if test -n "${SKIP_LIBRARY_TESTS}";
+then
+	exit ${EXIT_IGNORE};
+fi
+
+TEST_DATA_DIRECTORY="${srcdir:-.}/data";
+
+if ! test -d "${TEST_DATA_DIRECTORY}";
+then
+	echo "Test data directory not found.";
+
+	exit ${EXIT_IGNORE};
+fi
+
+RESULT=${EXIT_IGNORE};
+
+# The corpus is run through both the flex and bison based CUE parser and the hand-written CUE reader,
+# the results of the CUE reader are also compared with those of the CUE parser
+for TEST_NAME in cue_parser cue_reader;
+do
+	TEST_EXECUTABLE="./odraw_test_${TEST_NAME}";
+
+	if ! test -x "${TEST_EXECUTABLE}";
+	then
+		TEST_EXECUTABLE="${TEST_EXECUTABLE}.exe";
+	fi
+
+	if ! test -x "${TEST_EXECUTABLE}";
+	then
+		echo "Missing test executable: ${TEST_EXECUTABLE}";
+
+		exit ${EXIT_FAILURE};
+	fi
+
+	for INPUT_FILE in ${TEST_DATA_DIRECTORY}/cue_parser.*;
+	do
+		if ! test -f "${INPUT_FILE}";
+		then
+			continue;
+		fi
+		echo -n "Testing: ${TEST_NAME} with input: ${INPUT_FILE} ";
+
+		${TEST_EXECUTABLE} "${INPUT_FILE}" > /dev/null;
+		RESULT=$?;
+
+		if test ${RESULT} -ne ${EXIT_SUCCESS};
+		then
+			echo " (FAIL)";
+
+			exit ${RESULT};
+		fi
+		echo " (PASS)";
+	done
+done
+
+exit ${RESULT};
+
@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="cue_parser data_file data_file_descriptor error io_handle notify sector_range support track_value";
+LIBRARY_TESTS="bit_stream block_cache chd_file checksum compression cue_parser cue_reader cue_writer data_file data_file_descriptor data_file_writer decoded_file_io_handle ecm_file error extent flac huffman_tree io_handle layout_arena layout_cache notify open_file_budget read_ahead sector_range sector_scan shared_layout statistics support track_value zstd_file";
 LIBRARY_TESTS_WITH_INPUT="handle";
 OPTION_SETS=();
 
@@ -0,0 +1,62 @@
+#!/usr/bin/env bash
+# Tests Python module functions and types.
+#
+# Version: 20240306
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+EXIT_IGNORE=77;
+
+TEST_FUNCTIONS="support handle";
+
+TEST_TOOL_DIRECTORY=".";
+
+test_python_function()
+{
+	local TEST_FUNCTION=$1;
+
+	local TEST_DESCRIPTION="Testing Python-bindings functions: ${TEST_FUNCTION}";
+	local TEST_SCRIPT="${TEST_TOOL_DIRECTORY}/pyodraw_test_${TEST_FUNCTION}.py";
+
+	run_test_with_arguments "${TEST_DESCRIPTION}" "${TEST_SCRIPT}";
+	local RESULT=$?;
+
+	return ${RESULT};
+}
+
+if test -n "${SKIP_PYTHON_TESTS}";
+then
+	exit ${EXIT_IGNORE};
+fi
+
+TEST_RUNNER="tests/test_runner.sh";
+
+if ! test -f "${TEST_RUNNER}";
+then
+	TEST_RUNNER="./test_runner.sh";
+fi
+
+if ! test -f "${TEST_RUNNER}";
+then
+	echo "Missing test runner: ${TEST_RUNNER}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+source ${TEST_RUNNER};
+
+RESULT=${EXIT_IGNORE};
+
+for TEST_FUNCTION in ${TEST_FUNCTIONS};
+do
+	test_python_function "${TEST_FUNCTION}";
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		break;
+	fi
+done
+
+exit ${RESULT};
+